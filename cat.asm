@@ -0,0 +1,2245 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(2, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 94 04 00 00       	call   4db <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 98 04 00 00       	call   4f3 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(2, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 f7 0f 00 00       	push   $0xff7
+  6c:	6a 02                	push   $0x2
+  6e:	e8 bd 07 00 00       	call   830 <printf>
+      exit();
+  73:	e8 c8 00 00 00       	call   140 <exit>
+  }
+  exit();
+  78:	e8 c3 00 00 00       	call   140 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 b4 00 00 00       	call   140 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 c0 14 00 00       	push   $0x14c0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 23 04 00 00       	call   4d3 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 c0 14 00 00       	push   $0x14c0
+  c4:	56                   	push   %esi
+  c5:	e8 01 04 00 00       	call   4cb <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(2, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 d4 0f 00 00       	push   $0xfd4
+  e4:	6a 02                	push   $0x2
+  e6:	e8 45 07 00 00       	call   830 <printf>
+      exit();
+  eb:	e8 50 00 00 00       	call   140 <exit>
+    printf(2, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 e6 0f 00 00       	push   $0xfe6
+  f7:	6a 02                	push   $0x2
+  f9:	e8 32 07 00 00       	call   830 <printf>
+    exit();
+  fe:	e8 3d 00 00 00       	call   140 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+ 110:	a1 c0 16 00 00       	mov    0x16c0,%eax
+ 115:	85 c0                	test   %eax,%eax
+ 117:	74 17                	je     130 <fork+0x20>
+{
+ 119:	55                   	push   %ebp
+ 11a:	89 e5                	mov    %esp,%ebp
+ 11c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+ 11f:	ff d0                	call   *%eax
+  return _fork();
+}
+ 121:	c9                   	leave
+  return _fork();
+ 122:	e9 84 03 00 00       	jmp    4ab <_fork>
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+ 130:	e9 76 03 00 00       	jmp    4ab <_fork>
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <exit>:
+
+int
+exit(void)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+ 146:	a1 c0 16 00 00       	mov    0x16c0,%eax
+ 14b:	85 c0                	test   %eax,%eax
+ 14d:	74 02                	je     151 <exit+0x11>
+    stdioflush();
+ 14f:	ff d0                	call   *%eax
+  _exit();
+ 151:	e8 5d 03 00 00       	call   4b3 <_exit>
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+ 160:	55                   	push   %ebp
+  if(stdioflush)
+ 161:	a1 c0 16 00 00       	mov    0x16c0,%eax
+{
+ 166:	89 e5                	mov    %esp,%ebp
+ 168:	56                   	push   %esi
+ 169:	53                   	push   %ebx
+ 16a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 16d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+ 170:	85 c0                	test   %eax,%eax
+ 172:	74 02                	je     176 <exec+0x16>
+    stdioflush();
+ 174:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 176:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 179:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 17c:	5b                   	pop    %ebx
+ 17d:	5e                   	pop    %esi
+ 17e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 17f:	e9 67 03 00 00       	jmp    4eb <_exec>
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+ 195:	53                   	push   %ebx
+ 196:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+ 199:	a1 c0 16 00 00       	mov    0x16c0,%eax
+{
+ 19e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 1a4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 1a7:	85 c0                	test   %eax,%eax
+ 1a9:	74 02                	je     1ad <spawn+0x1d>
+    stdioflush();
+ 1ab:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 1ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 1b0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 1b3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1b6:	83 c4 0c             	add    $0xc,%esp
+ 1b9:	5b                   	pop    %ebx
+ 1ba:	5e                   	pop    %esi
+ 1bb:	5f                   	pop    %edi
+ 1bc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 1bd:	e9 79 04 00 00       	jmp    63b <_spawn>
+ 1c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	53                   	push   %ebx
+ 2f6:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 2f9:	a1 c0 16 00 00       	mov    0x16c0,%eax
+{
+ 2fe:	8b 75 08             	mov    0x8(%ebp),%esi
+ 301:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 304:	85 c0                	test   %eax,%eax
+ 306:	74 02                	je     30a <gets+0x1a>
+    stdioflush();
+ 308:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 30a:	a1 e8 18 00 00       	mov    0x18e8,%eax
+ 30f:	85 c0                	test   %eax,%eax
+ 311:	0f 84 99 00 00 00    	je     3b0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 317:	31 db                	xor    %ebx,%ebx
+ 319:	eb 21                	jmp    33c <gets+0x4c>
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 320:	8d 50 01             	lea    0x1(%eax),%edx
+ 323:	0f b6 80 e0 16 00 00 	movzbl 0x16e0(%eax),%eax
+ 32a:	89 15 e0 18 00 00    	mov    %edx,0x18e0
+    buf[i++] = c;
+ 330:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 334:	3c 0a                	cmp    $0xa,%al
+ 336:	74 60                	je     398 <gets+0xa8>
+ 338:	3c 0d                	cmp    $0xd,%al
+ 33a:	74 5c                	je     398 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 33c:	89 da                	mov    %ebx,%edx
+ 33e:	83 c3 01             	add    $0x1,%ebx
+ 341:	39 fb                	cmp    %edi,%ebx
+ 343:	7d 55                	jge    39a <gets+0xaa>
+    if(in.r == in.n){
+ 345:	a1 e0 18 00 00       	mov    0x18e0,%eax
+ 34a:	3b 05 e4 18 00 00    	cmp    0x18e4,%eax
+ 350:	75 ce                	jne    320 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 352:	83 ec 04             	sub    $0x4,%esp
+ 355:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 358:	c7 05 e4 18 00 00 00 	movl   $0x0,0x18e4
+ 35f:	00 00 00 
+ 362:	c7 05 e0 18 00 00 00 	movl   $0x0,0x18e0
+ 369:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 36c:	ff 35 e8 18 00 00    	push   0x18e8
+ 372:	68 e0 16 00 00       	push   $0x16e0
+ 377:	6a 00                	push   $0x0
+ 379:	e8 4d 01 00 00       	call   4cb <read>
+ 37e:	83 c4 10             	add    $0x10,%esp
+ 381:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 384:	85 c0                	test   %eax,%eax
+ 386:	a3 e4 18 00 00       	mov    %eax,0x18e4
+ 38b:	7e 56                	jle    3e3 <gets+0xf3>
+    c = in.buf[in.r++];
+ 38d:	a1 e0 18 00 00       	mov    0x18e0,%eax
+ 392:	eb 8c                	jmp    320 <gets+0x30>
+ 394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 398:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 39a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 39e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3a1:	89 f0                	mov    %esi,%eax
+ 3a3:	5b                   	pop    %ebx
+ 3a4:	5e                   	pop    %esi
+ 3a5:	5f                   	pop    %edi
+ 3a6:	5d                   	pop    %ebp
+ 3a7:	c3                   	ret
+ 3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 3b0:	83 ec 08             	sub    $0x8,%esp
+ 3b3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 3b6:	50                   	push   %eax
+ 3b7:	6a 00                	push   $0x0
+ 3b9:	e8 4d 01 00 00       	call   50b <fstat>
+ 3be:	83 c4 10             	add    $0x10,%esp
+ 3c1:	89 c2                	mov    %eax,%edx
+ 3c3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c8:	85 d2                	test   %edx,%edx
+ 3ca:	75 0d                	jne    3d9 <gets+0xe9>
+ 3cc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 3d1:	ba 00 02 00 00       	mov    $0x200,%edx
+ 3d6:	0f 44 c2             	cmove  %edx,%eax
+ 3d9:	a3 e8 18 00 00       	mov    %eax,0x18e8
+ 3de:	e9 34 ff ff ff       	jmp    317 <gets+0x27>
+        in.n = 0;
+ 3e3:	c7 05 e4 18 00 00 00 	movl   $0x0,0x18e4
+ 3ea:	00 00 00 
+        break;
+ 3ed:	eb ab                	jmp    39a <gets+0xaa>
+ 3ef:	90                   	nop
+
+000003f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	ff 75 08             	push   0x8(%ebp)
+ 3fd:	e8 f1 00 00 00       	call   4f3 <open>
+  if(fd < 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	78 27                	js     430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 409:	83 ec 08             	sub    $0x8,%esp
+ 40c:	ff 75 0c             	push   0xc(%ebp)
+ 40f:	89 c3                	mov    %eax,%ebx
+ 411:	50                   	push   %eax
+ 412:	e8 f4 00 00 00       	call   50b <fstat>
+  close(fd);
+ 417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 41a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 41c:	e8 ba 00 00 00       	call   4db <close>
+  return r;
+ 421:	83 c4 10             	add    $0x10,%esp
+}
+ 424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 427:	89 f0                	mov    %esi,%eax
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 435:	eb ed                	jmp    424 <stat+0x34>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	53                   	push   %ebx
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 447:	0f be 02             	movsbl (%edx),%eax
+ 44a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 44d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 455:	77 1e                	ja     475 <atoi+0x35>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 460:	83 c2 01             	add    $0x1,%edx
+ 463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 46a:	0f be 02             	movsbl (%edx),%eax
+ 46d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 470:	80 fb 09             	cmp    $0x9,%bl
+ 473:	76 eb                	jbe    460 <atoi+0x20>
+  return n;
+}
+ 475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 478:	89 c8                	mov    %ecx,%eax
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+
+000004ab <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 4ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <_exit>:
+RAWSYSCALL(exit)
+ 4b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <wait>:
+SYSCALL(wait)
+ 4bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <pipe>:
+SYSCALL(pipe)
+ 4c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <read>:
+SYSCALL(read)
+ 4cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <write>:
+SYSCALL(write)
+ 4d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <close>:
+SYSCALL(close)
+ 4db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <kill>:
+SYSCALL(kill)
+ 4e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <_exec>:
+RAWSYSCALL(exec)
+ 4eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <open>:
+SYSCALL(open)
+ 4f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mknod>:
+SYSCALL(mknod)
+ 4fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <unlink>:
+SYSCALL(unlink)
+ 503:	b8 12 00 00 00       	mov    $0x12,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <fstat>:
+SYSCALL(fstat)
+ 50b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <link>:
+SYSCALL(link)
+ 513:	b8 13 00 00 00       	mov    $0x13,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mkdir>:
+SYSCALL(mkdir)
+ 51b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <chdir>:
+SYSCALL(chdir)
+ 523:	b8 09 00 00 00       	mov    $0x9,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <dup>:
+SYSCALL(dup)
+ 52b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getpid>:
+SYSCALL(getpid)
+ 533:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sbrk>:
+SYSCALL(sbrk)
+ 53b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sleep>:
+SYSCALL(sleep)
+ 543:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <uptime>:
+SYSCALL(uptime)
+ 54b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 553:	b8 16 00 00 00       	mov    $0x16,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <get_parent_id>:
+SYSCALL(get_parent_id)
+ 55b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <get_children>:
+SYSCALL(get_children)
+ 563:	b8 18 00 00 00       	mov    $0x18,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <set_path>:
+SYSCALL(set_path)
+ 56b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <set_sleep>:
+SYSCALL(set_sleep)
+ 573:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <get_time>:
+SYSCALL(get_time)
+ 57b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <change_process_level>:
+SYSCALL(change_process_level)
+ 583:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 58b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 593:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <print_processes_info>:
+SYSCALL(print_processes_info)
+ 59b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 5a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <barrier_wait>:
+SYSCALL(barrier_wait)
+ 5ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 5b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 5bb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 5c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 5cb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sem_create>:
+SYSCALL(sem_create)
+ 5d3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <event_create>:
+SYSCALL(event_create)
+ 5db:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sync_post>:
+SYSCALL(sync_post)
+ 5e3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <sync_wait>:
+SYSCALL(sync_wait)
+ 5eb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sync_close>:
+SYSCALL(sync_close)
+ 5f3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <event_reset>:
+SYSCALL(event_reset)
+ 5fb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 603:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <mmap>:
+SYSCALL(mmap)
+ 60b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <munmap>:
+SYSCALL(munmap)
+ 613:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <shmget>:
+SYSCALL(shmget)
+ 61b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <shmat>:
+SYSCALL(shmat)
+ 623:	b8 30 00 00 00       	mov    $0x30,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <shmdt>:
+SYSCALL(shmdt)
+ 62b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <shmrm>:
+SYSCALL(shmrm)
+ 633:	b8 32 00 00 00       	mov    $0x32,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <_spawn>:
+RAWSYSCALL(spawn)
+ 63b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <memstat>:
+SYSCALL(memstat)
+ 643:	b8 34 00 00 00       	mov    $0x34,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+ 64b:	66 90                	xchg   %ax,%ax
+ 64d:	66 90                	xchg   %ax,%ax
+ 64f:	90                   	nop
+
+00000650 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 656:	a1 28 1b 00 00       	mov    0x1b28,%eax
+ 65b:	85 c0                	test   %eax,%eax
+ 65d:	7e 17                	jle    676 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 65f:	83 ec 04             	sub    $0x4,%esp
+ 662:	50                   	push   %eax
+ 663:	68 2c 1b 00 00       	push   $0x1b2c
+ 668:	ff 35 20 1b 00 00    	push   0x1b20
+ 66e:	e8 60 fe ff ff       	call   4d3 <write>
+ 673:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 676:	c7 05 28 1b 00 00 00 	movl   $0x0,0x1b28
+ 67d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 680:	c7 05 24 1b 00 00 00 	movl   $0x0,0x1b24
+ 687:	00 00 00 
+}
+ 68a:	c9                   	leave
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 696:	89 d1                	mov    %edx,%ecx
+{
+ 698:	56                   	push   %esi
+ 699:	53                   	push   %ebx
+ 69a:	89 c3                	mov    %eax,%ebx
+ 69c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 69f:	85 d2                	test   %edx,%edx
+ 6a1:	0f 89 b9 00 00 00    	jns    760 <printint+0xd0>
+ 6a7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ab:	0f 84 af 00 00 00    	je     760 <printint+0xd0>
+    x = -xx;
+ 6b1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6b8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6bb:	31 f6                	xor    %esi,%esi
+ 6bd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6c0:	89 c8                	mov    %ecx,%eax
+ 6c2:	31 d2                	xor    %edx,%edx
+ 6c4:	89 f3                	mov    %esi,%ebx
+ 6c6:	f7 f7                	div    %edi
+ 6c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6cb:	0f b6 92 6c 10 00 00 	movzbl 0x106c(%edx),%edx
+ 6d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6d6:	89 ca                	mov    %ecx,%edx
+ 6d8:	89 c1                	mov    %eax,%ecx
+ 6da:	39 fa                	cmp    %edi,%edx
+ 6dc:	73 e2                	jae    6c0 <printint+0x30>
+  if(neg)
+ 6de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 6e1:	89 d9                	mov    %ebx,%ecx
+ 6e3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e6:	85 c0                	test   %eax,%eax
+ 6e8:	74 07                	je     6f1 <printint+0x61>
+    buf[i++] = '-';
+ 6ea:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ef:	89 f1                	mov    %esi,%ecx
+ 6f1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 6f4:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 6f6:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 6f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6fc:	01 f7                	add    %esi,%edi
+ 6fe:	eb 09                	jmp    709 <printint+0x79>
+
+  while(--i >= 0)
+ 700:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 703:	39 f7                	cmp    %esi,%edi
+ 705:	74 36                	je     73d <printint+0xad>
+ 707:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 709:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 70c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 70f:	8d 42 01             	lea    0x1(%edx),%eax
+ 712:	89 43 08             	mov    %eax,0x8(%ebx)
+ 715:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 719:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 71e:	74 28                	je     748 <printint+0xb8>
+ 720:	80 f9 0a             	cmp    $0xa,%cl
+ 723:	75 db                	jne    700 <printint+0x70>
+ 725:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 729:	75 d5                	jne    700 <printint+0x70>
+  if(b->n > 0)
+ 72b:	85 c0                	test   %eax,%eax
+ 72d:	7f 19                	jg     748 <printint+0xb8>
+  b->n = 0;
+ 72f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 736:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 739:	39 f7                	cmp    %esi,%edi
+ 73b:	75 ca                	jne    707 <printint+0x77>
+}
+ 73d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 740:	5b                   	pop    %ebx
+ 741:	5e                   	pop    %esi
+ 742:	5f                   	pop    %edi
+ 743:	5d                   	pop    %ebp
+ 744:	c3                   	ret
+ 745:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 748:	83 ec 04             	sub    $0x4,%esp
+ 74b:	50                   	push   %eax
+ 74c:	ff 75 d4             	push   -0x2c(%ebp)
+ 74f:	ff 33                	push   (%ebx)
+ 751:	e8 7d fd ff ff       	call   4d3 <write>
+ 756:	83 c4 10             	add    $0x10,%esp
+ 759:	eb d4                	jmp    72f <printint+0x9f>
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+  neg = 0;
+ 760:	31 c0                	xor    %eax,%eax
+ 762:	e9 51 ff ff ff       	jmp    6b8 <printint+0x28>
+ 767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <putc>:
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	53                   	push   %ebx
+ 774:	89 c3                	mov    %eax,%ebx
+ 776:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 779:	8b 48 08             	mov    0x8(%eax),%ecx
+ 77c:	8d 41 01             	lea    0x1(%ecx),%eax
+ 77f:	89 43 08             	mov    %eax,0x8(%ebx)
+ 782:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 786:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 78b:	74 33                	je     7c0 <putc+0x50>
+ 78d:	80 fa 0a             	cmp    $0xa,%dl
+ 790:	74 0e                	je     7a0 <putc+0x30>
+}
+ 792:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 795:	c9                   	leave
+ 796:	c3                   	ret
+ 797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 7a0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 7a4:	75 ec                	jne    792 <putc+0x22>
+  if(b->n > 0)
+ 7a6:	85 c0                	test   %eax,%eax
+ 7a8:	7f 16                	jg     7c0 <putc+0x50>
+  b->n = 0;
+ 7aa:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 7b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7b4:	c9                   	leave
+ 7b5:	c3                   	ret
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	50                   	push   %eax
+ 7c4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7c7:	50                   	push   %eax
+ 7c8:	ff 33                	push   (%ebx)
+ 7ca:	e8 04 fd ff ff       	call   4d3 <write>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	eb d6                	jmp    7aa <putc+0x3a>
+ 7d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+
+000007e0 <fflush>:
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 7e6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 7ea:	74 04                	je     7f0 <fflush+0x10>
+}
+ 7ec:	c9                   	leave
+ 7ed:	c3                   	ret
+ 7ee:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 7f0:	a1 28 1b 00 00       	mov    0x1b28,%eax
+ 7f5:	85 c0                	test   %eax,%eax
+ 7f7:	7f 17                	jg     810 <fflush+0x30>
+  b->n = 0;
+ 7f9:	c7 05 28 1b 00 00 00 	movl   $0x0,0x1b28
+ 800:	00 00 00 
+  out.mode = 0;
+ 803:	c7 05 24 1b 00 00 00 	movl   $0x0,0x1b24
+ 80a:	00 00 00 
+}
+ 80d:	c9                   	leave
+ 80e:	c3                   	ret
+ 80f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	50                   	push   %eax
+ 814:	68 2c 1b 00 00       	push   $0x1b2c
+ 819:	ff 35 20 1b 00 00    	push   0x1b20
+ 81f:	e8 af fc ff ff       	call   4d3 <write>
+ 824:	83 c4 10             	add    $0x10,%esp
+ 827:	eb d0                	jmp    7f9 <fflush+0x19>
+ 829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 3c             	sub    $0x3c,%esp
+ 839:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 83c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 83f:	83 fe 01             	cmp    $0x1,%esi
+ 842:	0f 84 60 01 00 00    	je     9a8 <printf+0x178>
+    b->fd = fd;
+ 848:	89 35 00 19 00 00    	mov    %esi,0x1900
+  for(i = 0; fmt[i]; i++){
+ 84e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 851:	bf 00 19 00 00       	mov    $0x1900,%edi
+  for(i = 0; fmt[i]; i++){
+ 856:	84 c0                	test   %al,%al
+ 858:	74 65                	je     8bf <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 85a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 860:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 862:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 865:	eb 1f                	jmp    886 <printf+0x56>
+ 867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 3b                	je     8b0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 875:	89 f8                	mov    %edi,%eax
+ 877:	e8 f4 fe ff ff       	call   770 <putc>
+  for(i = 0; fmt[i]; i++){
+ 87c:	0f b6 03             	movzbl (%ebx),%eax
+ 87f:	83 c3 01             	add    $0x1,%ebx
+ 882:	84 c0                	test   %al,%al
+ 884:	74 39                	je     8bf <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 886:	0f be d0             	movsbl %al,%edx
+ 889:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 88c:	85 f6                	test   %esi,%esi
+ 88e:	74 e0                	je     870 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 890:	83 fe 25             	cmp    $0x25,%esi
+ 893:	75 e7                	jne    87c <printf+0x4c>
+      if(c == 'd'){
+ 895:	83 f8 25             	cmp    $0x25,%eax
+ 898:	74 57                	je     8f1 <printf+0xc1>
+ 89a:	83 e8 63             	sub    $0x63,%eax
+ 89d:	83 f8 15             	cmp    $0x15,%eax
+ 8a0:	77 36                	ja     8d8 <printf+0xa8>
+ 8a2:	ff 24 85 14 10 00 00 	jmp    *0x1014(,%eax,4)
+ 8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 8b0:	0f b6 03             	movzbl (%ebx),%eax
+ 8b3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8b6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8bb:	84 c0                	test   %al,%al
+ 8bd:	75 c7                	jne    886 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 8bf:	8b 47 04             	mov    0x4(%edi),%eax
+ 8c2:	85 c0                	test   %eax,%eax
+ 8c4:	0f 84 06 01 00 00    	je     9d0 <printf+0x1a0>
+    bflush(b);
+}
+ 8ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8cd:	5b                   	pop    %ebx
+ 8ce:	5e                   	pop    %esi
+ 8cf:	5f                   	pop    %edi
+ 8d0:	5d                   	pop    %ebp
+ 8d1:	c3                   	ret
+ 8d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 8d8:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 8db:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8de:	89 47 08             	mov    %eax,0x8(%edi)
+ 8e1:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 8e6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8eb:	0f 84 77 01 00 00    	je     a68 <printf+0x238>
+        putc(b, c);
+ 8f1:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 8f3:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 8f5:	e8 76 fe ff ff       	call   770 <putc>
+ 8fa:	eb 80                	jmp    87c <printf+0x4c>
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 900:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 16                	mov    (%esi),%edx
+ 90d:	6a 00                	push   $0x0
+        ap++;
+ 90f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 912:	89 f8                	mov    %edi,%eax
+ 914:	e8 77 fd ff ff       	call   690 <printint>
+        ap++;
+ 919:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 f6                	xor    %esi,%esi
+ 921:	e9 56 ff ff ff       	jmp    87c <printf+0x4c>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 933:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 93b:	85 c9                	test   %ecx,%ecx
+ 93d:	0f 84 cd 00 00 00    	je     a10 <printf+0x1e0>
+        while(*s != 0){
+ 943:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 946:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 948:	84 d2                	test   %dl,%dl
+ 94a:	0f 84 2c ff ff ff    	je     87c <printf+0x4c>
+          putc(b, *s);
+ 950:	89 f8                	mov    %edi,%eax
+ 952:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 955:	e8 16 fe ff ff       	call   770 <putc>
+          s++;
+ 95a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 95d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 961:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 964:	84 d2                	test   %dl,%dl
+ 966:	75 e8                	jne    950 <printf+0x120>
+      state = 0;
+ 968:	31 f6                	xor    %esi,%esi
+ 96a:	e9 0d ff ff ff       	jmp    87c <printf+0x4c>
+ 96f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 970:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 16                	mov    (%esi),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	eb 8e                	jmp    90f <printf+0xdf>
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 988:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 98b:	89 f8                	mov    %edi,%eax
+ 98d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 990:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 993:	e8 d8 fd ff ff       	call   770 <putc>
+        ap++;
+ 998:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 99b:	31 f6                	xor    %esi,%esi
+ 99d:	e9 da fe ff ff       	jmp    87c <printf+0x4c>
+ 9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 9a8:	8b 15 24 1b 00 00    	mov    0x1b24,%edx
+ 9ae:	85 d2                	test   %edx,%edx
+ 9b0:	74 6e                	je     a20 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 9b2:	0f b6 03             	movzbl (%ebx),%eax
+ 9b5:	bf 20 1b 00 00       	mov    $0x1b20,%edi
+ 9ba:	84 c0                	test   %al,%al
+ 9bc:	0f 85 98 fe ff ff    	jne    85a <printf+0x2a>
+ 9c2:	e9 03 ff ff ff       	jmp    8ca <printf+0x9a>
+ 9c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ce:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 9d0:	8b 47 08             	mov    0x8(%edi),%eax
+ 9d3:	85 c0                	test   %eax,%eax
+ 9d5:	7f 19                	jg     9f0 <printf+0x1c0>
+  b->n = 0;
+ 9d7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e1:	5b                   	pop    %ebx
+ 9e2:	5e                   	pop    %esi
+ 9e3:	5f                   	pop    %edi
+ 9e4:	5d                   	pop    %ebp
+ 9e5:	c3                   	ret
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 9f0:	83 ec 04             	sub    $0x4,%esp
+ 9f3:	50                   	push   %eax
+ 9f4:	8d 47 0c             	lea    0xc(%edi),%eax
+ 9f7:	50                   	push   %eax
+ 9f8:	ff 37                	push   (%edi)
+ 9fa:	e8 d4 fa ff ff       	call   4d3 <write>
+  b->n = 0;
+ 9ff:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ a06:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ a09:	eb d3                	jmp    9de <printf+0x1ae>
+ a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+ a10:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a15:	b9 0c 10 00 00       	mov    $0x100c,%ecx
+ a1a:	e9 31 ff ff ff       	jmp    950 <printf+0x120>
+ a1f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a20:	83 ec 08             	sub    $0x8,%esp
+ a23:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ a26:	c7 05 20 1b 00 00 01 	movl   $0x1,0x1b20
+ a2d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a30:	50                   	push   %eax
+ a31:	6a 01                	push   $0x1
+ a33:	e8 d3 fa ff ff       	call   50b <fstat>
+ a38:	83 c4 10             	add    $0x10,%esp
+ a3b:	85 c0                	test   %eax,%eax
+ a3d:	75 22                	jne    a61 <printf+0x231>
+ a3f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ a44:	b8 02 00 00 00       	mov    $0x2,%eax
+ a49:	0f 45 f0             	cmovne %eax,%esi
+ a4c:	89 35 24 1b 00 00    	mov    %esi,0x1b24
+      stdioflush = flushout;
+ a52:	c7 05 c0 16 00 00 50 	movl   $0x650,0x16c0
+ a59:	06 00 00 
+ a5c:	e9 51 ff ff ff       	jmp    9b2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a61:	be 02 00 00 00       	mov    $0x2,%esi
+ a66:	eb e4                	jmp    a4c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ a68:	83 ec 04             	sub    $0x4,%esp
+ a6b:	8d 47 0c             	lea    0xc(%edi),%eax
+ a6e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ a71:	68 00 02 00 00       	push   $0x200
+ a76:	50                   	push   %eax
+ a77:	ff 37                	push   (%edi)
+ a79:	e8 55 fa ff ff       	call   4d3 <write>
+  b->n = 0;
+ a7e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ a85:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ a88:	83 c4 10             	add    $0x10,%esp
+ a8b:	e9 61 fe ff ff       	jmp    8f1 <printf+0xc1>
+
+00000a90 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	53                   	push   %ebx
+ a95:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ a97:	a1 40 1d 00 00       	mov    0x1d40,%eax
+ a9c:	39 d8                	cmp    %ebx,%eax
+ a9e:	0f 83 e4 00 00 00    	jae    b88 <freepages+0xf8>
+ aa4:	85 c0                	test   %eax,%eax
+ aa6:	0f 84 dc 00 00 00    	je     b88 <freepages+0xf8>
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ab0:	89 c2                	mov    %eax,%edx
+ ab2:	8b 00                	mov    (%eax),%eax
+ ab4:	85 c0                	test   %eax,%eax
+ ab6:	74 04                	je     abc <freepages+0x2c>
+ ab8:	39 d8                	cmp    %ebx,%eax
+ aba:	72 f4                	jb     ab0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ abc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ abf:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ ac1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ ac3:	85 c0                	test   %eax,%eax
+ ac5:	74 15                	je     adc <freepages+0x4c>
+    p->prev = s;
+ ac7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ aca:	8b 73 10             	mov    0x10(%ebx),%esi
+ acd:	89 f1                	mov    %esi,%ecx
+ acf:	c1 e1 0c             	shl    $0xc,%ecx
+ ad2:	01 d9                	add    %ebx,%ecx
+ ad4:	39 c8                	cmp    %ecx,%eax
+ ad6:	0f 84 d8 00 00 00    	je     bb4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ adc:	8b 4a 10             	mov    0x10(%edx),%ecx
+ adf:	89 c8                	mov    %ecx,%eax
+ ae1:	c1 e0 0c             	shl    $0xc,%eax
+ ae4:	01 d0                	add    %edx,%eax
+ ae6:	39 c3                	cmp    %eax,%ebx
+ ae8:	74 16                	je     b00 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ aea:	8b 03                	mov    (%ebx),%eax
+ aec:	85 c0                	test   %eax,%eax
+ aee:	74 40                	je     b30 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ af0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ af3:	5b                   	pop    %ebx
+ af4:	5e                   	pop    %esi
+ af5:	5d                   	pop    %ebp
+ af6:	c3                   	ret
+ af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afe:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ b00:	03 4b 10             	add    0x10(%ebx),%ecx
+ b03:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ b06:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ b09:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ b0b:	85 c9                	test   %ecx,%ecx
+ b0d:	0f 84 dd 00 00 00    	je     bf0 <freepages+0x160>
+    s->prev->next = s->next;
+ b13:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ b15:	85 c0                	test   %eax,%eax
+ b17:	74 06                	je     b1f <freepages+0x8f>
+    s->next->prev = s->prev;
+ b19:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ b1c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ b1f:	8b 02                	mov    (%edx),%eax
+ b21:	89 d3                	mov    %edx,%ebx
+ b23:	85 c0                	test   %eax,%eax
+ b25:	75 c9                	jne    af0 <freepages+0x60>
+ b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2e:	66 90                	xchg   %ax,%ax
+ b30:	8b 43 10             	mov    0x10(%ebx),%eax
+ b33:	83 f8 0f             	cmp    $0xf,%eax
+ b36:	76 b8                	jbe    af0 <freepages+0x60>
+ b38:	83 ec 0c             	sub    $0xc,%esp
+ b3b:	c1 e0 0c             	shl    $0xc,%eax
+ b3e:	6a 00                	push   $0x0
+ b40:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ b43:	e8 f3 f9 ff ff       	call   53b <sbrk>
+ b48:	83 c4 10             	add    $0x10,%esp
+ b4b:	39 c6                	cmp    %eax,%esi
+ b4d:	75 a1                	jne    af0 <freepages+0x60>
+  if(s->prev)
+ b4f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ b52:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ b54:	85 d2                	test   %edx,%edx
+ b56:	0f 84 a5 00 00 00    	je     c01 <freepages+0x171>
+    s->prev->next = s->next;
+ b5c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ b5e:	85 c0                	test   %eax,%eax
+ b60:	74 06                	je     b68 <freepages+0xd8>
+    s->next->prev = s->prev;
+ b62:	8b 53 04             	mov    0x4(%ebx),%edx
+ b65:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ b68:	8b 43 10             	mov    0x10(%ebx),%eax
+ b6b:	83 ec 0c             	sub    $0xc,%esp
+ b6e:	c1 e0 0c             	shl    $0xc,%eax
+ b71:	f7 d8                	neg    %eax
+ b73:	50                   	push   %eax
+ b74:	e8 c2 f9 ff ff       	call   53b <sbrk>
+ b79:	83 c4 10             	add    $0x10,%esp
+}
+ b7c:	e9 6f ff ff ff       	jmp    af0 <freepages+0x60>
+ b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ b88:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ b8f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ b91:	89 1d 40 1d 00 00    	mov    %ebx,0x1d40
+  if(p)
+ b97:	85 c0                	test   %eax,%eax
+ b99:	74 95                	je     b30 <freepages+0xa0>
+    p->prev = s;
+ b9b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ b9e:	8b 73 10             	mov    0x10(%ebx),%esi
+ ba1:	89 f2                	mov    %esi,%edx
+ ba3:	c1 e2 0c             	shl    $0xc,%edx
+ ba6:	01 da                	add    %ebx,%edx
+ ba8:	39 d0                	cmp    %edx,%eax
+ baa:	0f 85 3a ff ff ff    	jne    aea <freepages+0x5a>
+ bb0:	89 c1                	mov    %eax,%ecx
+ bb2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ bb4:	8b 41 10             	mov    0x10(%ecx),%eax
+ bb7:	01 f0                	add    %esi,%eax
+ bb9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ bbc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ bbf:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ bc1:	85 f6                	test   %esi,%esi
+ bc3:	74 35                	je     bfa <freepages+0x16a>
+    s->prev->next = s->next;
+ bc5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ bc7:	85 c0                	test   %eax,%eax
+ bc9:	74 06                	je     bd1 <freepages+0x141>
+    s->next->prev = s->prev;
+ bcb:	8b 49 04             	mov    0x4(%ecx),%ecx
+ bce:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ bd1:	85 d2                	test   %edx,%edx
+ bd3:	0f 84 11 ff ff ff    	je     aea <freepages+0x5a>
+ bd9:	8b 4a 10             	mov    0x10(%edx),%ecx
+ bdc:	89 c8                	mov    %ecx,%eax
+ bde:	c1 e0 0c             	shl    $0xc,%eax
+ be1:	01 d0                	add    %edx,%eax
+ be3:	39 c3                	cmp    %eax,%ebx
+ be5:	0f 85 ff fe ff ff    	jne    aea <freepages+0x5a>
+ beb:	e9 10 ff ff ff       	jmp    b00 <freepages+0x70>
+    *l = s->next;
+ bf0:	a3 40 1d 00 00       	mov    %eax,0x1d40
+ bf5:	e9 1b ff ff ff       	jmp    b15 <freepages+0x85>
+ bfa:	a3 40 1d 00 00       	mov    %eax,0x1d40
+ bff:	eb c6                	jmp    bc7 <freepages+0x137>
+ c01:	a3 40 1d 00 00       	mov    %eax,0x1d40
+ c06:	e9 53 ff ff ff       	jmp    b5e <freepages+0xce>
+ c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c0f:	90                   	nop
+
+00000c10 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	56                   	push   %esi
+ c14:	53                   	push   %ebx
+ c15:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ c17:	a1 40 1d 00 00       	mov    0x1d40,%eax
+ c1c:	85 c0                	test   %eax,%eax
+ c1e:	74 5e                	je     c7e <getpages+0x6e>
+    if(s->npages < n)
+ c20:	8b 50 10             	mov    0x10(%eax),%edx
+ c23:	39 da                	cmp    %ebx,%edx
+ c25:	72 51                	jb     c78 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ c27:	39 d3                	cmp    %edx,%ebx
+ c29:	72 25                	jb     c50 <getpages+0x40>
+  if(s->prev)
+ c2b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ c2e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ c30:	85 c9                	test   %ecx,%ecx
+ c32:	0f 84 a8 00 00 00    	je     ce0 <getpages+0xd0>
+    s->prev->next = s->next;
+ c38:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ c3a:	85 d2                	test   %edx,%edx
+ c3c:	74 06                	je     c44 <getpages+0x34>
+    s->next->prev = s->prev;
+ c3e:	8b 48 04             	mov    0x4(%eax),%ecx
+ c41:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ c44:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ c47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c4a:	5b                   	pop    %ebx
+ c4b:	5e                   	pop    %esi
+ c4c:	5d                   	pop    %ebp
+ c4d:	c3                   	ret
+ c4e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c50:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ c52:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c54:	c1 e1 0c             	shl    $0xc,%ecx
+ c57:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ c59:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ c5c:	8b 70 04             	mov    0x4(%eax),%esi
+ c5f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ c62:	8b 10                	mov    (%eax),%edx
+ c64:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ c66:	85 f6                	test   %esi,%esi
+ c68:	74 66                	je     cd0 <getpages+0xc0>
+        rest->prev->next = rest;
+ c6a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ c6c:	8b 11                	mov    (%ecx),%edx
+ c6e:	85 d2                	test   %edx,%edx
+ c70:	75 cf                	jne    c41 <getpages+0x31>
+ c72:	eb d0                	jmp    c44 <getpages+0x34>
+ c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ c78:	8b 00                	mov    (%eax),%eax
+ c7a:	85 c0                	test   %eax,%eax
+ c7c:	75 a2                	jne    c20 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ c7e:	83 ec 0c             	sub    $0xc,%esp
+ c81:	6a 00                	push   $0x0
+ c83:	e8 b3 f8 ff ff       	call   53b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c88:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c8b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ c91:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c93:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ c99:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c9f:	29 d0                	sub    %edx,%eax
+ ca1:	c1 e8 0c             	shr    $0xc,%eax
+ ca4:	39 d8                	cmp    %ebx,%eax
+ ca6:	72 48                	jb     cf0 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ ca8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ caa:	89 d8                	mov    %ebx,%eax
+ cac:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ caf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ cb1:	c1 e0 0c             	shl    $0xc,%eax
+ cb4:	01 f0                	add    %esi,%eax
+ cb6:	50                   	push   %eax
+ cb7:	e8 7f f8 ff ff       	call   53b <sbrk>
+ cbc:	83 c4 10             	add    $0x10,%esp
+ cbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cc2:	74 2c                	je     cf0 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ cc4:	01 f0                	add    %esi,%eax
+ cc6:	e9 79 ff ff ff       	jmp    c44 <getpages+0x34>
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+        runs = rest;
+ cd0:	89 0d 40 1d 00 00    	mov    %ecx,0x1d40
+ cd6:	eb 96                	jmp    c6e <getpages+0x5e>
+ cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+    *l = s->next;
+ ce0:	89 15 40 1d 00 00    	mov    %edx,0x1d40
+ ce6:	e9 4f ff ff ff       	jmp    c3a <getpages+0x2a>
+ ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+    return 0;
+ cf0:	31 c0                	xor    %eax,%eax
+ cf2:	e9 50 ff ff ff       	jmp    c47 <getpages+0x37>
+ cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfe:	66 90                	xchg   %ax,%ax
+
+00000d00 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 1c             	sub    $0x1c,%esp
+ d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ d0c:	85 c0                	test   %eax,%eax
+ d0e:	0f 84 97 00 00 00    	je     dab <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ d14:	89 c3                	mov    %eax,%ebx
+ d16:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ d1c:	8b 73 14             	mov    0x14(%ebx),%esi
+ d1f:	83 fe 01             	cmp    $0x1,%esi
+ d22:	74 74                	je     d98 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ d24:	85 f6                	test   %esi,%esi
+ d26:	74 5d                	je     d85 <free+0x85>
+  if(s->free == 0)
+ d28:	8b 53 08             	mov    0x8(%ebx),%edx
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 85 00 00 00    	je     db8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ d33:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ d35:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ d38:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d3b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ d3e:	8b 04 f5 64 1d 00 00 	mov    0x1d64(,%esi,8),%eax
+  s->inuse--;
+ d45:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ d48:	83 c0 01             	add    $0x1,%eax
+ d4b:	89 04 f5 64 1d 00 00 	mov    %eax,0x1d64(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d52:	85 d2                	test   %edx,%edx
+ d54:	75 55                	jne    dab <free+0xab>
+ d56:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ d5b:	89 f1                	mov    %esi,%ecx
+ d5d:	d3 ea                	shr    %cl,%edx
+ d5f:	39 c2                	cmp    %eax,%edx
+ d61:	73 7d                	jae    de0 <free+0xe0>
+  if(s->prev)
+ d63:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ d66:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ d68:	85 ff                	test   %edi,%edi
+ d6a:	0f 84 a0 00 00 00    	je     e10 <free+0x110>
+    s->prev->next = s->next;
+ d70:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ d72:	85 c9                	test   %ecx,%ecx
+ d74:	74 06                	je     d7c <free+0x7c>
+    s->next->prev = s->prev;
+ d76:	8b 7b 04             	mov    0x4(%ebx),%edi
+ d79:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ d7c:	29 d0                	sub    %edx,%eax
+ d7e:	89 04 f5 64 1d 00 00 	mov    %eax,0x1d64(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ d88:	89 d8                	mov    %ebx,%eax
+}
+ d8a:	5b                   	pop    %ebx
+ d8b:	5e                   	pop    %esi
+ d8c:	5f                   	pop    %edi
+ d8d:	5d                   	pop    %ebp
+    freepages(s);
+ d8e:	e9 fd fc ff ff       	jmp    a90 <freepages>
+ d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d97:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ d98:	8b 43 10             	mov    0x10(%ebx),%eax
+ d9b:	83 ec 08             	sub    $0x8,%esp
+ d9e:	c1 e0 0c             	shl    $0xc,%eax
+ da1:	50                   	push   %eax
+ da2:	53                   	push   %ebx
+ da3:	e8 6b f8 ff ff       	call   613 <munmap>
+ da8:	83 c4 10             	add    $0x10,%esp
+}
+ dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dae:	5b                   	pop    %ebx
+ daf:	5e                   	pop    %esi
+ db0:	5f                   	pop    %edi
+ db1:	5d                   	pop    %ebp
+ db2:	c3                   	ret
+ db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ db7:	90                   	nop
+  s->next = *l;
+ db8:	8b 14 f5 60 1d 00 00 	mov    0x1d60(,%esi,8),%edx
+  s->prev = 0;
+ dbf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ dc6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ dc8:	85 d2                	test   %edx,%edx
+ dca:	74 06                	je     dd2 <free+0xd2>
+    (*l)->prev = s;
+ dcc:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ dcf:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ dd2:	89 1c f5 60 1d 00 00 	mov    %ebx,0x1d60(,%esi,8)
+}
+ dd9:	e9 55 ff ff ff       	jmp    d33 <free+0x33>
+ dde:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ de0:	83 ec 0c             	sub    $0xc,%esp
+ de3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ de6:	8b 7b 10             	mov    0x10(%ebx),%edi
+ de9:	6a 00                	push   $0x0
+ deb:	c1 e7 0c             	shl    $0xc,%edi
+ dee:	01 df                	add    %ebx,%edi
+ df0:	e8 46 f7 ff ff       	call   53b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ df5:	83 c4 10             	add    $0x10,%esp
+ df8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ dfb:	39 c7                	cmp    %eax,%edi
+ dfd:	75 ac                	jne    dab <free+0xab>
+ dff:	8b 04 f5 64 1d 00 00 	mov    0x1d64(,%esi,8),%eax
+ e06:	e9 58 ff ff ff       	jmp    d63 <free+0x63>
+ e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+    *l = s->next;
+ e10:	89 0c f5 60 1d 00 00 	mov    %ecx,0x1d60(,%esi,8)
+ e17:	e9 56 ff ff ff       	jmp    d72 <free+0x72>
+ e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e20 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e20:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e21:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ e26:	89 e5                	mov    %esp,%ebp
+ e28:	57                   	push   %edi
+ e29:	56                   	push   %esi
+ e2a:	53                   	push   %ebx
+ e2b:	83 ec 1c             	sub    $0x1c,%esp
+ e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ e31:	83 f8 10             	cmp    $0x10,%eax
+ e34:	0f 86 92 00 00 00    	jbe    ecc <malloc+0xac>
+ e3a:	ba 01 00 00 00       	mov    $0x1,%edx
+ e3f:	eb 13                	jmp    e54 <malloc+0x34>
+ e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e48:	89 d3                	mov    %edx,%ebx
+ e4a:	d3 e3                	shl    %cl,%ebx
+ e4c:	39 c3                	cmp    %eax,%ebx
+ e4e:	0f 83 84 00 00 00    	jae    ed8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e54:	83 c1 01             	add    $0x1,%ecx
+ e57:	83 f9 0b             	cmp    $0xb,%ecx
+ e5a:	75 ec                	jne    e48 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ e5c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ e61:	0f 87 c9 00 00 00    	ja     f30 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ e67:	05 17 10 00 00       	add    $0x1017,%eax
+ e6c:	89 c3                	mov    %eax,%ebx
+ e6e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ e71:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ e76:	77 28                	ja     ea0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ e78:	89 d8                	mov    %ebx,%eax
+ e7a:	e8 91 fd ff ff       	call   c10 <getpages>
+ e7f:	85 c0                	test   %eax,%eax
+ e81:	0f 84 a9 00 00 00    	je     f30 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ e87:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ e8e:	83 c0 18             	add    $0x18,%eax
+}
+ e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e94:	5b                   	pop    %ebx
+ e95:	5e                   	pop    %esi
+ e96:	5f                   	pop    %edi
+ e97:	5d                   	pop    %ebp
+ e98:	c3                   	ret
+ e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ ea0:	89 d8                	mov    %ebx,%eax
+ ea2:	83 ec 08             	sub    $0x8,%esp
+ ea5:	c1 e0 0c             	shl    $0xc,%eax
+ ea8:	6a 00                	push   $0x0
+ eaa:	6a ff                	push   $0xffffffff
+ eac:	6a 22                	push   $0x22
+ eae:	6a 03                	push   $0x3
+ eb0:	50                   	push   %eax
+ eb1:	6a 00                	push   $0x0
+ eb3:	e8 53 f7 ff ff       	call   60b <mmap>
+    if(s == MAP_FAILED)
+ eb8:	83 c4 20             	add    $0x20,%esp
+ ebb:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ebe:	74 b8                	je     e78 <malloc+0x58>
+      s->shift = MAPRUN;
+ ec0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ ec7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ eca:	eb c2                	jmp    e8e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ ecc:	bb 10 00 00 00       	mov    $0x10,%ebx
+ ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ ed8:	8b 34 cd 60 1d 00 00 	mov    0x1d60(,%ecx,8),%esi
+ edf:	85 f6                	test   %esi,%esi
+ ee1:	74 57                	je     f3a <malloc+0x11a>
+  classes[shift].nfree--;
+ ee3:	8b 1c cd 64 1d 00 00 	mov    0x1d64(,%ecx,8),%ebx
+  o = s->free;
+ eea:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ eed:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ ef0:	89 14 cd 64 1d 00 00 	mov    %edx,0x1d64(,%ecx,8)
+  s->free = NEXTFREE(o);
+ ef7:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ ef9:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ efd:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ f00:	85 ff                	test   %edi,%edi
+ f02:	75 8d                	jne    e91 <malloc+0x71>
+  if(s->prev)
+ f04:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ f07:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ f09:	85 db                	test   %ebx,%ebx
+ f0b:	0f 84 b7 00 00 00    	je     fc8 <malloc+0x1a8>
+    s->prev->next = s->next;
+ f11:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ f13:	85 d2                	test   %edx,%edx
+ f15:	0f 84 76 ff ff ff    	je     e91 <malloc+0x71>
+    s->next->prev = s->prev;
+ f1b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ f1e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ f21:	e9 6b ff ff ff       	jmp    e91 <malloc+0x71>
+ f26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f2d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ f33:	31 c0                	xor    %eax,%eax
+}
+ f35:	5b                   	pop    %ebx
+ f36:	5e                   	pop    %esi
+ f37:	5f                   	pop    %edi
+ f38:	5d                   	pop    %ebp
+ f39:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ f3a:	b8 01 00 00 00       	mov    $0x1,%eax
+ f3f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ f42:	e8 c9 fc ff ff       	call   c10 <getpages>
+ f47:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ f4a:	85 c0                	test   %eax,%eax
+ f4c:	89 c2                	mov    %eax,%edx
+ f4e:	74 e0                	je     f30 <malloc+0x110>
+    s->shift = shift;
+ f50:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f53:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ f55:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ f5c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f61:	89 df                	mov    %ebx,%edi
+ f63:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ f65:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ f67:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ f6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f6d:	83 e8 01             	sub    $0x1,%eax
+ f70:	d3 e0                	shl    %cl,%eax
+ f72:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ f75:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f79:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ f7c:	eb 04                	jmp    f82 <malloc+0x162>
+ f7e:	66 90                	xchg   %ax,%ax
+ f80:	89 c8                	mov    %ecx,%eax
+ f82:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ f85:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f87:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ f8a:	89 c6                	mov    %eax,%esi
+ f8c:	39 da                	cmp    %ebx,%edx
+ f8e:	7f f0                	jg     f80 <malloc+0x160>
+ f90:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ f93:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ f96:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ f99:	8b 04 cd 60 1d 00 00 	mov    0x1d60(,%ecx,8),%eax
+  s->prev = 0;
+ fa0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ fa7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ fa9:	85 c0                	test   %eax,%eax
+ fab:	74 03                	je     fb0 <malloc+0x190>
+    (*l)->prev = s;
+ fad:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ fb0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ fb3:	89 14 cd 60 1d 00 00 	mov    %edx,0x1d60(,%ecx,8)
+    classes[shift].nfree += n;
+ fba:	89 d6                	mov    %edx,%esi
+ fbc:	03 1c cd 64 1d 00 00 	add    0x1d64(,%ecx,8),%ebx
+ fc3:	e9 22 ff ff ff       	jmp    eea <malloc+0xca>
+    *l = s->next;
+ fc8:	89 14 cd 60 1d 00 00 	mov    %edx,0x1d60(,%ecx,8)
+ fcf:	e9 3f ff ff ff       	jmp    f13 <malloc+0xf3>
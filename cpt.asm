@@ -0,0 +1,2318 @@
+
+_cpt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    exit();
+  }
+}
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int out, in;
+
+  if (argc <= 1)
+      19:	83 f8 01             	cmp    $0x1,%eax
+      1c:	7e 7e                	jle    9c <main+0x9c>
+  {
+    printf(1, "cpt: too few arguments\n");
+    exit();
+  }
+  else if (argc == 2)
+      1e:	83 f8 02             	cmp    $0x2,%eax
+      21:	0f 84 9d 00 00 00    	je     c4 <main+0xc4>
+      exit();
+    }
+    cpt(0, out);
+    close(out);
+  }
+  else if (argc == 3)
+      27:	83 f8 03             	cmp    $0x3,%eax
+      2a:	74 16                	je     42 <main+0x42>
+    close(in);
+    close(out);
+  }
+  else
+  {
+    printf(1, "cpt: too many arguments\n");
+      2c:	50                   	push   %eax
+      2d:	50                   	push   %eax
+      2e:	68 c4 10 00 00       	push   $0x10c4
+      33:	6a 01                	push   $0x1
+      35:	e8 96 08 00 00       	call   8d0 <printf>
+      3a:	83 c4 10             	add    $0x10,%esp
+  }
+  exit();
+      3d:	e8 9e 01 00 00       	call   1e0 <exit>
+    if ((in = open(argv[1], 0)) < 0)
+      42:	50                   	push   %eax
+      43:	50                   	push   %eax
+      44:	6a 00                	push   $0x0
+      46:	ff 73 04             	push   0x4(%ebx)
+      49:	e8 45 05 00 00       	call   593 <open>
+      4e:	83 c4 10             	add    $0x10,%esp
+      51:	89 c6                	mov    %eax,%esi
+      53:	85 c0                	test   %eax,%eax
+      55:	78 58                	js     af <main+0xaf>
+    unlink(argv[2]);
+      57:	83 ec 0c             	sub    $0xc,%esp
+      5a:	ff 73 08             	push   0x8(%ebx)
+      5d:	e8 41 05 00 00       	call   5a3 <unlink>
+    if ((out = open(argv[2], O_CREATE | O_RDWR)) < 0)
+      62:	5f                   	pop    %edi
+      63:	58                   	pop    %eax
+      64:	68 02 02 00 00       	push   $0x202
+      69:	ff 73 08             	push   0x8(%ebx)
+      6c:	e8 22 05 00 00       	call   593 <open>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	89 c7                	mov    %eax,%edi
+      76:	85 c0                	test   %eax,%eax
+      78:	0f 88 83 00 00 00    	js     101 <main+0x101>
+    cpt(in, out);
+      7e:	52                   	push   %edx
+      7f:	52                   	push   %edx
+      80:	50                   	push   %eax
+      81:	56                   	push   %esi
+      82:	e8 99 00 00 00       	call   120 <cpt>
+    close(in);
+      87:	89 34 24             	mov    %esi,(%esp)
+      8a:	e8 ec 04 00 00       	call   57b <close>
+    close(out);
+      8f:	89 3c 24             	mov    %edi,(%esp)
+      92:	e8 e4 04 00 00       	call   57b <close>
+      97:	83 c4 10             	add    $0x10,%esp
+      9a:	eb a1                	jmp    3d <main+0x3d>
+    printf(1, "cpt: too few arguments\n");
+      9c:	51                   	push   %ecx
+      9d:	51                   	push   %ecx
+      9e:	68 97 10 00 00       	push   $0x1097
+      a3:	6a 01                	push   $0x1
+      a5:	e8 26 08 00 00       	call   8d0 <printf>
+    exit();
+      aa:	e8 31 01 00 00       	call   1e0 <exit>
+      printf(1, "cpt: cannot open %s\n", argv[1]);
+      af:	50                   	push   %eax
+      b0:	ff 73 04             	push   0x4(%ebx)
+      b3:	68 af 10 00 00       	push   $0x10af
+      b8:	6a 01                	push   $0x1
+      ba:	e8 11 08 00 00       	call   8d0 <printf>
+      exit();
+      bf:	e8 1c 01 00 00       	call   1e0 <exit>
+    unlink(argv[1]);
+      c4:	83 ec 0c             	sub    $0xc,%esp
+      c7:	ff 73 04             	push   0x4(%ebx)
+      ca:	e8 d4 04 00 00       	call   5a3 <unlink>
+    if ((out = open(argv[1], O_CREATE | O_RDWR)) < 0)
+      cf:	58                   	pop    %eax
+      d0:	5a                   	pop    %edx
+      d1:	68 02 02 00 00       	push   $0x202
+      d6:	ff 73 04             	push   0x4(%ebx)
+      d9:	e8 b5 04 00 00       	call   593 <open>
+      de:	83 c4 10             	add    $0x10,%esp
+      e1:	89 c6                	mov    %eax,%esi
+      e3:	85 c0                	test   %eax,%eax
+      e5:	78 c8                	js     af <main+0xaf>
+    cpt(0, out);
+      e7:	50                   	push   %eax
+      e8:	50                   	push   %eax
+      e9:	56                   	push   %esi
+      ea:	6a 00                	push   $0x0
+      ec:	e8 2f 00 00 00       	call   120 <cpt>
+    close(out);
+      f1:	89 34 24             	mov    %esi,(%esp)
+      f4:	e8 82 04 00 00       	call   57b <close>
+      f9:	83 c4 10             	add    $0x10,%esp
+      fc:	e9 3c ff ff ff       	jmp    3d <main+0x3d>
+      printf(1, "cpt: cannot create or edit %s\n", argv[2]);
+     101:	51                   	push   %ecx
+     102:	ff 73 08             	push   0x8(%ebx)
+     105:	68 e0 10 00 00       	push   $0x10e0
+     10a:	6a 01                	push   $0x1
+     10c:	e8 bf 07 00 00       	call   8d0 <printf>
+      close(in);
+     111:	89 34 24             	mov    %esi,(%esp)
+     114:	e8 62 04 00 00       	call   57b <close>
+      exit();
+     119:	e8 c2 00 00 00       	call   1e0 <exit>
+     11e:	66 90                	xchg   %ax,%ax
+
+00000120 <cpt>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	57                   	push   %edi
+     124:	56                   	push   %esi
+     125:	53                   	push   %ebx
+     126:	83 ec 0c             	sub    $0xc,%esp
+     129:	8b 75 08             	mov    0x8(%ebp),%esi
+     12c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  while ((n = read(in, buf, sizeof(buf))) > 0)
+     12f:	eb 26                	jmp    157 <cpt+0x37>
+     131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (write(out, buf, n) != n)
+     138:	83 ec 04             	sub    $0x4,%esp
+     13b:	53                   	push   %ebx
+     13c:	68 c0 15 00 00       	push   $0x15c0
+     141:	57                   	push   %edi
+     142:	e8 2c 04 00 00       	call   573 <write>
+     147:	83 c4 10             	add    $0x10,%esp
+     14a:	39 d8                	cmp    %ebx,%eax
+     14c:	75 2f                	jne    17d <cpt+0x5d>
+    if (buf[n - 1] == '\n')
+     14e:	80 b8 bf 15 00 00 0a 	cmpb   $0xa,0x15bf(%eax)
+     155:	74 3a                	je     191 <cpt+0x71>
+  while ((n = read(in, buf, sizeof(buf))) > 0)
+     157:	83 ec 04             	sub    $0x4,%esp
+     15a:	68 00 02 00 00       	push   $0x200
+     15f:	68 c0 15 00 00       	push   $0x15c0
+     164:	56                   	push   %esi
+     165:	e8 01 04 00 00       	call   56b <read>
+     16a:	83 c4 10             	add    $0x10,%esp
+     16d:	89 c3                	mov    %eax,%ebx
+     16f:	85 c0                	test   %eax,%eax
+     171:	7f c5                	jg     138 <cpt+0x18>
+  if (n < 0)
+     173:	75 21                	jne    196 <cpt+0x76>
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+      printf(1, "cpt: write error\n");
+     17d:	83 ec 08             	sub    $0x8,%esp
+     180:	68 74 10 00 00       	push   $0x1074
+     185:	6a 01                	push   $0x1
+     187:	e8 44 07 00 00       	call   8d0 <printf>
+      exit();
+     18c:	e8 4f 00 00 00       	call   1e0 <exit>
+      exit();
+     191:	e8 4a 00 00 00       	call   1e0 <exit>
+    printf(1, "cpt: read error\n");
+     196:	50                   	push   %eax
+     197:	50                   	push   %eax
+     198:	68 86 10 00 00       	push   $0x1086
+     19d:	6a 01                	push   $0x1
+     19f:	e8 2c 07 00 00       	call   8d0 <printf>
+    exit();
+     1a4:	e8 37 00 00 00       	call   1e0 <exit>
+     1a9:	66 90                	xchg   %ax,%ax
+     1ab:	66 90                	xchg   %ax,%ax
+     1ad:	66 90                	xchg   %ax,%ax
+     1af:	90                   	nop
+
+000001b0 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     1b0:	a1 c0 17 00 00       	mov    0x17c0,%eax
+     1b5:	85 c0                	test   %eax,%eax
+     1b7:	74 17                	je     1d0 <fork+0x20>
+{
+     1b9:	55                   	push   %ebp
+     1ba:	89 e5                	mov    %esp,%ebp
+     1bc:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     1bf:	ff d0                	call   *%eax
+  return _fork();
+}
+     1c1:	c9                   	leave
+  return _fork();
+     1c2:	e9 84 03 00 00       	jmp    54b <_fork>
+     1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ce:	66 90                	xchg   %ax,%ax
+     1d0:	e9 76 03 00 00       	jmp    54b <_fork>
+     1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <exit>:
+
+int
+exit(void)
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     1e6:	a1 c0 17 00 00       	mov    0x17c0,%eax
+     1eb:	85 c0                	test   %eax,%eax
+     1ed:	74 02                	je     1f1 <exit+0x11>
+    stdioflush();
+     1ef:	ff d0                	call   *%eax
+  _exit();
+     1f1:	e8 5d 03 00 00       	call   553 <_exit>
+     1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     200:	55                   	push   %ebp
+  if(stdioflush)
+     201:	a1 c0 17 00 00       	mov    0x17c0,%eax
+{
+     206:	89 e5                	mov    %esp,%ebp
+     208:	56                   	push   %esi
+     209:	53                   	push   %ebx
+     20a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     20d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     210:	85 c0                	test   %eax,%eax
+     212:	74 02                	je     216 <exec+0x16>
+    stdioflush();
+     214:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     216:	89 75 0c             	mov    %esi,0xc(%ebp)
+     219:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     21c:	5b                   	pop    %ebx
+     21d:	5e                   	pop    %esi
+     21e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     21f:	e9 67 03 00 00       	jmp    58b <_exec>
+     224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	57                   	push   %edi
+     234:	56                   	push   %esi
+     235:	53                   	push   %ebx
+     236:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     239:	a1 c0 17 00 00       	mov    0x17c0,%eax
+{
+     23e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     241:	8b 75 0c             	mov    0xc(%ebp),%esi
+     244:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     247:	85 c0                	test   %eax,%eax
+     249:	74 02                	je     24d <spawn+0x1d>
+    stdioflush();
+     24b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     24d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     250:	89 75 0c             	mov    %esi,0xc(%ebp)
+     253:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     256:	83 c4 0c             	add    $0xc,%esp
+     259:	5b                   	pop    %ebx
+     25a:	5e                   	pop    %esi
+     25b:	5f                   	pop    %edi
+     25c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     25d:	e9 79 04 00 00       	jmp    6db <_spawn>
+     262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     271:	31 c0                	xor    %eax,%eax
+{
+     273:	89 e5                	mov    %esp,%ebp
+     275:	53                   	push   %ebx
+     276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     287:	83 c0 01             	add    $0x1,%eax
+     28a:	84 d2                	test   %dl,%dl
+     28c:	75 f2                	jne    280 <strcpy+0x10>
+    ;
+  return os;
+}
+     28e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     291:	89 c8                	mov    %ecx,%eax
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	53                   	push   %ebx
+     2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2aa:	0f b6 02             	movzbl (%edx),%eax
+     2ad:	84 c0                	test   %al,%al
+     2af:	75 17                	jne    2c8 <strcmp+0x28>
+     2b1:	eb 3a                	jmp    2ed <strcmp+0x4d>
+     2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2b7:	90                   	nop
+     2b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2bc:	83 c2 01             	add    $0x1,%edx
+     2bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     2c2:	84 c0                	test   %al,%al
+     2c4:	74 1a                	je     2e0 <strcmp+0x40>
+    p++, q++;
+     2c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     2c8:	0f b6 19             	movzbl (%ecx),%ebx
+     2cb:	38 c3                	cmp    %al,%bl
+     2cd:	74 e9                	je     2b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     2cf:	29 d8                	sub    %ebx,%eax
+}
+     2d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d4:	c9                   	leave
+     2d5:	c3                   	ret
+     2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2e4:	31 c0                	xor    %eax,%eax
+     2e6:	29 d8                	sub    %ebx,%eax
+}
+     2e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2eb:	c9                   	leave
+     2ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2ed:	0f b6 19             	movzbl (%ecx),%ebx
+     2f0:	31 c0                	xor    %eax,%eax
+     2f2:	eb db                	jmp    2cf <strcmp+0x2f>
+     2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ff:	90                   	nop
+
+00000300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     306:	80 3a 00             	cmpb   $0x0,(%edx)
+     309:	74 15                	je     320 <strlen+0x20>
+     30b:	31 c0                	xor    %eax,%eax
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+     310:	83 c0 01             	add    $0x1,%eax
+     313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     317:	89 c1                	mov    %eax,%ecx
+     319:	75 f5                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+     31b:	89 c8                	mov    %ecx,%eax
+     31d:	5d                   	pop    %ebp
+     31e:	c3                   	ret
+     31f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     320:	31 c9                	xor    %ecx,%ecx
+}
+     322:	5d                   	pop    %ebp
+     323:	89 c8                	mov    %ecx,%eax
+     325:	c3                   	ret
+     326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	57                   	push   %edi
+     334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     33d:	89 d7                	mov    %edx,%edi
+     33f:	fc                   	cld
+     340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     345:	89 d0                	mov    %edx,%eax
+     347:	c9                   	leave
+     348:	c3                   	ret
+     349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	8b 45 08             	mov    0x8(%ebp),%eax
+     356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     35a:	0f b6 10             	movzbl (%eax),%edx
+     35d:	84 d2                	test   %dl,%dl
+     35f:	75 12                	jne    373 <strchr+0x23>
+     361:	eb 1d                	jmp    380 <strchr+0x30>
+     363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     367:	90                   	nop
+     368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     36c:	83 c0 01             	add    $0x1,%eax
+     36f:	84 d2                	test   %dl,%dl
+     371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+     373:	38 d1                	cmp    %dl,%cl
+     375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     377:	5d                   	pop    %ebp
+     378:	c3                   	ret
+     379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     380:	31 c0                	xor    %eax,%eax
+}
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+
+00000390 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+     395:	53                   	push   %ebx
+     396:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     399:	a1 c0 17 00 00       	mov    0x17c0,%eax
+{
+     39e:	8b 75 08             	mov    0x8(%ebp),%esi
+     3a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     3a4:	85 c0                	test   %eax,%eax
+     3a6:	74 02                	je     3aa <gets+0x1a>
+    stdioflush();
+     3a8:	ff d0                	call   *%eax
+  if(in.size == 0)
+     3aa:	a1 e8 19 00 00       	mov    0x19e8,%eax
+     3af:	85 c0                	test   %eax,%eax
+     3b1:	0f 84 99 00 00 00    	je     450 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     3b7:	31 db                	xor    %ebx,%ebx
+     3b9:	eb 21                	jmp    3dc <gets+0x4c>
+     3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     3c0:	8d 50 01             	lea    0x1(%eax),%edx
+     3c3:	0f b6 80 e0 17 00 00 	movzbl 0x17e0(%eax),%eax
+     3ca:	89 15 e0 19 00 00    	mov    %edx,0x19e0
+    buf[i++] = c;
+     3d0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3d4:	3c 0a                	cmp    $0xa,%al
+     3d6:	74 60                	je     438 <gets+0xa8>
+     3d8:	3c 0d                	cmp    $0xd,%al
+     3da:	74 5c                	je     438 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     3dc:	89 da                	mov    %ebx,%edx
+     3de:	83 c3 01             	add    $0x1,%ebx
+     3e1:	39 fb                	cmp    %edi,%ebx
+     3e3:	7d 55                	jge    43a <gets+0xaa>
+    if(in.r == in.n){
+     3e5:	a1 e0 19 00 00       	mov    0x19e0,%eax
+     3ea:	3b 05 e4 19 00 00    	cmp    0x19e4,%eax
+     3f0:	75 ce                	jne    3c0 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3f2:	83 ec 04             	sub    $0x4,%esp
+     3f5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     3f8:	c7 05 e4 19 00 00 00 	movl   $0x0,0x19e4
+     3ff:	00 00 00 
+     402:	c7 05 e0 19 00 00 00 	movl   $0x0,0x19e0
+     409:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     40c:	ff 35 e8 19 00 00    	push   0x19e8
+     412:	68 e0 17 00 00       	push   $0x17e0
+     417:	6a 00                	push   $0x0
+     419:	e8 4d 01 00 00       	call   56b <read>
+     41e:	83 c4 10             	add    $0x10,%esp
+     421:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     424:	85 c0                	test   %eax,%eax
+     426:	a3 e4 19 00 00       	mov    %eax,0x19e4
+     42b:	7e 56                	jle    483 <gets+0xf3>
+    c = in.buf[in.r++];
+     42d:	a1 e0 19 00 00       	mov    0x19e0,%eax
+     432:	eb 8c                	jmp    3c0 <gets+0x30>
+     434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     438:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     43a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     43e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     441:	89 f0                	mov    %esi,%eax
+     443:	5b                   	pop    %ebx
+     444:	5e                   	pop    %esi
+     445:	5f                   	pop    %edi
+     446:	5d                   	pop    %ebp
+     447:	c3                   	ret
+     448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     450:	83 ec 08             	sub    $0x8,%esp
+     453:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     456:	50                   	push   %eax
+     457:	6a 00                	push   $0x0
+     459:	e8 4d 01 00 00       	call   5ab <fstat>
+     45e:	83 c4 10             	add    $0x10,%esp
+     461:	89 c2                	mov    %eax,%edx
+     463:	b8 01 00 00 00       	mov    $0x1,%eax
+     468:	85 d2                	test   %edx,%edx
+     46a:	75 0d                	jne    479 <gets+0xe9>
+     46c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     471:	ba 00 02 00 00       	mov    $0x200,%edx
+     476:	0f 44 c2             	cmove  %edx,%eax
+     479:	a3 e8 19 00 00       	mov    %eax,0x19e8
+     47e:	e9 34 ff ff ff       	jmp    3b7 <gets+0x27>
+        in.n = 0;
+     483:	c7 05 e4 19 00 00 00 	movl   $0x0,0x19e4
+     48a:	00 00 00 
+        break;
+     48d:	eb ab                	jmp    43a <gets+0xaa>
+     48f:	90                   	nop
+
+00000490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	6a 00                	push   $0x0
+     49a:	ff 75 08             	push   0x8(%ebp)
+     49d:	e8 f1 00 00 00       	call   593 <open>
+  if(fd < 0)
+     4a2:	83 c4 10             	add    $0x10,%esp
+     4a5:	85 c0                	test   %eax,%eax
+     4a7:	78 27                	js     4d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     4a9:	83 ec 08             	sub    $0x8,%esp
+     4ac:	ff 75 0c             	push   0xc(%ebp)
+     4af:	89 c3                	mov    %eax,%ebx
+     4b1:	50                   	push   %eax
+     4b2:	e8 f4 00 00 00       	call   5ab <fstat>
+  close(fd);
+     4b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     4ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+     4bc:	e8 ba 00 00 00       	call   57b <close>
+  return r;
+     4c1:	83 c4 10             	add    $0x10,%esp
+}
+     4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4c7:	89 f0                	mov    %esi,%eax
+     4c9:	5b                   	pop    %ebx
+     4ca:	5e                   	pop    %esi
+     4cb:	5d                   	pop    %ebp
+     4cc:	c3                   	ret
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     4d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4d5:	eb ed                	jmp    4c4 <stat+0x34>
+     4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     4e7:	0f be 02             	movsbl (%edx),%eax
+     4ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4f5:	77 1e                	ja     515 <atoi+0x35>
+     4f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     500:	83 c2 01             	add    $0x1,%edx
+     503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     50a:	0f be 02             	movsbl (%edx),%eax
+     50d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     510:	80 fb 09             	cmp    $0x9,%bl
+     513:	76 eb                	jbe    500 <atoi+0x20>
+  return n;
+}
+     515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     518:	89 c8                	mov    %ecx,%eax
+     51a:	c9                   	leave
+     51b:	c3                   	ret
+     51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	56                   	push   %esi
+     525:	8b 45 10             	mov    0x10(%ebp),%eax
+     528:	8b 55 08             	mov    0x8(%ebp),%edx
+     52b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     52e:	85 c0                	test   %eax,%eax
+     530:	7e 13                	jle    545 <memmove+0x25>
+     532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     534:	89 d7                	mov    %edx,%edi
+     536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     541:	39 f8                	cmp    %edi,%eax
+     543:	75 fb                	jne    540 <memmove+0x20>
+  return vdst;
+}
+     545:	5e                   	pop    %esi
+     546:	89 d0                	mov    %edx,%eax
+     548:	5f                   	pop    %edi
+     549:	5d                   	pop    %ebp
+     54a:	c3                   	ret
+
+0000054b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     54b:	b8 01 00 00 00       	mov    $0x1,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <_exit>:
+RAWSYSCALL(exit)
+     553:	b8 02 00 00 00       	mov    $0x2,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <wait>:
+SYSCALL(wait)
+     55b:	b8 03 00 00 00       	mov    $0x3,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <pipe>:
+SYSCALL(pipe)
+     563:	b8 04 00 00 00       	mov    $0x4,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <read>:
+SYSCALL(read)
+     56b:	b8 05 00 00 00       	mov    $0x5,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <write>:
+SYSCALL(write)
+     573:	b8 10 00 00 00       	mov    $0x10,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <close>:
+SYSCALL(close)
+     57b:	b8 15 00 00 00       	mov    $0x15,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <kill>:
+SYSCALL(kill)
+     583:	b8 06 00 00 00       	mov    $0x6,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <_exec>:
+RAWSYSCALL(exec)
+     58b:	b8 07 00 00 00       	mov    $0x7,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <open>:
+SYSCALL(open)
+     593:	b8 0f 00 00 00       	mov    $0xf,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <mknod>:
+SYSCALL(mknod)
+     59b:	b8 11 00 00 00       	mov    $0x11,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <unlink>:
+SYSCALL(unlink)
+     5a3:	b8 12 00 00 00       	mov    $0x12,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <fstat>:
+SYSCALL(fstat)
+     5ab:	b8 08 00 00 00       	mov    $0x8,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <link>:
+SYSCALL(link)
+     5b3:	b8 13 00 00 00       	mov    $0x13,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <mkdir>:
+SYSCALL(mkdir)
+     5bb:	b8 14 00 00 00       	mov    $0x14,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <chdir>:
+SYSCALL(chdir)
+     5c3:	b8 09 00 00 00       	mov    $0x9,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <dup>:
+SYSCALL(dup)
+     5cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <getpid>:
+SYSCALL(getpid)
+     5d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <sbrk>:
+SYSCALL(sbrk)
+     5db:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <sleep>:
+SYSCALL(sleep)
+     5e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <uptime>:
+SYSCALL(uptime)
+     5eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     5f3:	b8 16 00 00 00       	mov    $0x16,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <get_parent_id>:
+SYSCALL(get_parent_id)
+     5fb:	b8 17 00 00 00       	mov    $0x17,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <get_children>:
+SYSCALL(get_children)
+     603:	b8 18 00 00 00       	mov    $0x18,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <set_path>:
+SYSCALL(set_path)
+     60b:	b8 19 00 00 00       	mov    $0x19,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <set_sleep>:
+SYSCALL(set_sleep)
+     613:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <get_time>:
+SYSCALL(get_time)
+     61b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <change_process_level>:
+SYSCALL(change_process_level)
+     623:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     633:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <print_processes_info>:
+SYSCALL(print_processes_info)
+     63b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <barrier_init>:
+
+SYSCALL(barrier_init)
+     643:	b8 20 00 00 00       	mov    $0x20,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <barrier_wait>:
+SYSCALL(barrier_wait)
+     64b:	b8 21 00 00 00       	mov    $0x21,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     653:	b8 22 00 00 00       	mov    $0x22,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     65b:	b8 23 00 00 00       	mov    $0x23,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <set_process_gang>:
+SYSCALL(set_process_gang)
+     663:	b8 24 00 00 00       	mov    $0x24,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     66b:	b8 25 00 00 00       	mov    $0x25,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <sem_create>:
+SYSCALL(sem_create)
+     673:	b8 26 00 00 00       	mov    $0x26,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+
+0000067b <event_create>:
+SYSCALL(event_create)
+     67b:	b8 27 00 00 00       	mov    $0x27,%eax
+     680:	cd 40                	int    $0x40
+     682:	c3                   	ret
+
+00000683 <sync_post>:
+SYSCALL(sync_post)
+     683:	b8 28 00 00 00       	mov    $0x28,%eax
+     688:	cd 40                	int    $0x40
+     68a:	c3                   	ret
+
+0000068b <sync_wait>:
+SYSCALL(sync_wait)
+     68b:	b8 29 00 00 00       	mov    $0x29,%eax
+     690:	cd 40                	int    $0x40
+     692:	c3                   	ret
+
+00000693 <sync_close>:
+SYSCALL(sync_close)
+     693:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     698:	cd 40                	int    $0x40
+     69a:	c3                   	ret
+
+0000069b <event_reset>:
+SYSCALL(event_reset)
+     69b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     6a0:	cd 40                	int    $0x40
+     6a2:	c3                   	ret
+
+000006a3 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     6a3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     6a8:	cd 40                	int    $0x40
+     6aa:	c3                   	ret
+
+000006ab <mmap>:
+SYSCALL(mmap)
+     6ab:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6b0:	cd 40                	int    $0x40
+     6b2:	c3                   	ret
+
+000006b3 <munmap>:
+SYSCALL(munmap)
+     6b3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6b8:	cd 40                	int    $0x40
+     6ba:	c3                   	ret
+
+000006bb <shmget>:
+SYSCALL(shmget)
+     6bb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6c0:	cd 40                	int    $0x40
+     6c2:	c3                   	ret
+
+000006c3 <shmat>:
+SYSCALL(shmat)
+     6c3:	b8 30 00 00 00       	mov    $0x30,%eax
+     6c8:	cd 40                	int    $0x40
+     6ca:	c3                   	ret
+
+000006cb <shmdt>:
+SYSCALL(shmdt)
+     6cb:	b8 31 00 00 00       	mov    $0x31,%eax
+     6d0:	cd 40                	int    $0x40
+     6d2:	c3                   	ret
+
+000006d3 <shmrm>:
+SYSCALL(shmrm)
+     6d3:	b8 32 00 00 00       	mov    $0x32,%eax
+     6d8:	cd 40                	int    $0x40
+     6da:	c3                   	ret
+
+000006db <_spawn>:
+RAWSYSCALL(spawn)
+     6db:	b8 33 00 00 00       	mov    $0x33,%eax
+     6e0:	cd 40                	int    $0x40
+     6e2:	c3                   	ret
+
+000006e3 <memstat>:
+SYSCALL(memstat)
+     6e3:	b8 34 00 00 00       	mov    $0x34,%eax
+     6e8:	cd 40                	int    $0x40
+     6ea:	c3                   	ret
+     6eb:	66 90                	xchg   %ax,%ax
+     6ed:	66 90                	xchg   %ax,%ax
+     6ef:	90                   	nop
+
+000006f0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     6f6:	a1 28 1c 00 00       	mov    0x1c28,%eax
+     6fb:	85 c0                	test   %eax,%eax
+     6fd:	7e 17                	jle    716 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     6ff:	83 ec 04             	sub    $0x4,%esp
+     702:	50                   	push   %eax
+     703:	68 2c 1c 00 00       	push   $0x1c2c
+     708:	ff 35 20 1c 00 00    	push   0x1c20
+     70e:	e8 60 fe ff ff       	call   573 <write>
+     713:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     716:	c7 05 28 1c 00 00 00 	movl   $0x0,0x1c28
+     71d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     720:	c7 05 24 1c 00 00 00 	movl   $0x0,0x1c24
+     727:	00 00 00 
+}
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	57                   	push   %edi
+     734:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     736:	89 d1                	mov    %edx,%ecx
+{
+     738:	56                   	push   %esi
+     739:	53                   	push   %ebx
+     73a:	89 c3                	mov    %eax,%ebx
+     73c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     73f:	85 d2                	test   %edx,%edx
+     741:	0f 89 b9 00 00 00    	jns    800 <printint+0xd0>
+     747:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     74b:	0f 84 af 00 00 00    	je     800 <printint+0xd0>
+    x = -xx;
+     751:	f7 d9                	neg    %ecx
+    neg = 1;
+     753:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     758:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     75b:	31 f6                	xor    %esi,%esi
+     75d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     760:	89 c8                	mov    %ecx,%eax
+     762:	31 d2                	xor    %edx,%edx
+     764:	89 f3                	mov    %esi,%ebx
+     766:	f7 f7                	div    %edi
+     768:	8d 76 01             	lea    0x1(%esi),%esi
+     76b:	0f b6 92 60 11 00 00 	movzbl 0x1160(%edx),%edx
+     772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     776:	89 ca                	mov    %ecx,%edx
+     778:	89 c1                	mov    %eax,%ecx
+     77a:	39 fa                	cmp    %edi,%edx
+     77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+     77e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     781:	89 d9                	mov    %ebx,%ecx
+     783:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     786:	85 c0                	test   %eax,%eax
+     788:	74 07                	je     791 <printint+0x61>
+    buf[i++] = '-';
+     78a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     78f:	89 f1                	mov    %esi,%ecx
+     791:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     794:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     796:	8d 43 0c             	lea    0xc(%ebx),%eax
+     799:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     79c:	01 f7                	add    %esi,%edi
+     79e:	eb 09                	jmp    7a9 <printint+0x79>
+
+  while(--i >= 0)
+     7a0:	8d 47 ff             	lea    -0x1(%edi),%eax
+     7a3:	39 f7                	cmp    %esi,%edi
+     7a5:	74 36                	je     7dd <printint+0xad>
+     7a7:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     7a9:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     7ac:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     7af:	8d 42 01             	lea    0x1(%edx),%eax
+     7b2:	89 43 08             	mov    %eax,0x8(%ebx)
+     7b5:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7b9:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7be:	74 28                	je     7e8 <printint+0xb8>
+     7c0:	80 f9 0a             	cmp    $0xa,%cl
+     7c3:	75 db                	jne    7a0 <printint+0x70>
+     7c5:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     7c9:	75 d5                	jne    7a0 <printint+0x70>
+  if(b->n > 0)
+     7cb:	85 c0                	test   %eax,%eax
+     7cd:	7f 19                	jg     7e8 <printint+0xb8>
+  b->n = 0;
+     7cf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     7d6:	8d 47 ff             	lea    -0x1(%edi),%eax
+     7d9:	39 f7                	cmp    %esi,%edi
+     7db:	75 ca                	jne    7a7 <printint+0x77>
+}
+     7dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7e0:	5b                   	pop    %ebx
+     7e1:	5e                   	pop    %esi
+     7e2:	5f                   	pop    %edi
+     7e3:	5d                   	pop    %ebp
+     7e4:	c3                   	ret
+     7e5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     7e8:	83 ec 04             	sub    $0x4,%esp
+     7eb:	50                   	push   %eax
+     7ec:	ff 75 d4             	push   -0x2c(%ebp)
+     7ef:	ff 33                	push   (%ebx)
+     7f1:	e8 7d fd ff ff       	call   573 <write>
+     7f6:	83 c4 10             	add    $0x10,%esp
+     7f9:	eb d4                	jmp    7cf <printint+0x9f>
+     7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ff:	90                   	nop
+  neg = 0;
+     800:	31 c0                	xor    %eax,%eax
+     802:	e9 51 ff ff ff       	jmp    758 <printint+0x28>
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+
+00000810 <putc>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	53                   	push   %ebx
+     814:	89 c3                	mov    %eax,%ebx
+     816:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     819:	8b 48 08             	mov    0x8(%eax),%ecx
+     81c:	8d 41 01             	lea    0x1(%ecx),%eax
+     81f:	89 43 08             	mov    %eax,0x8(%ebx)
+     822:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     826:	3d 00 02 00 00       	cmp    $0x200,%eax
+     82b:	74 33                	je     860 <putc+0x50>
+     82d:	80 fa 0a             	cmp    $0xa,%dl
+     830:	74 0e                	je     840 <putc+0x30>
+}
+     832:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     835:	c9                   	leave
+     836:	c3                   	ret
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     840:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     844:	75 ec                	jne    832 <putc+0x22>
+  if(b->n > 0)
+     846:	85 c0                	test   %eax,%eax
+     848:	7f 16                	jg     860 <putc+0x50>
+  b->n = 0;
+     84a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     851:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     854:	c9                   	leave
+     855:	c3                   	ret
+     856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     860:	83 ec 04             	sub    $0x4,%esp
+     863:	50                   	push   %eax
+     864:	8d 43 0c             	lea    0xc(%ebx),%eax
+     867:	50                   	push   %eax
+     868:	ff 33                	push   (%ebx)
+     86a:	e8 04 fd ff ff       	call   573 <write>
+     86f:	83 c4 10             	add    $0x10,%esp
+     872:	eb d6                	jmp    84a <putc+0x3a>
+     874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     87f:	90                   	nop
+
+00000880 <fflush>:
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     886:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     88a:	74 04                	je     890 <fflush+0x10>
+}
+     88c:	c9                   	leave
+     88d:	c3                   	ret
+     88e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     890:	a1 28 1c 00 00       	mov    0x1c28,%eax
+     895:	85 c0                	test   %eax,%eax
+     897:	7f 17                	jg     8b0 <fflush+0x30>
+  b->n = 0;
+     899:	c7 05 28 1c 00 00 00 	movl   $0x0,0x1c28
+     8a0:	00 00 00 
+  out.mode = 0;
+     8a3:	c7 05 24 1c 00 00 00 	movl   $0x0,0x1c24
+     8aa:	00 00 00 
+}
+     8ad:	c9                   	leave
+     8ae:	c3                   	ret
+     8af:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     8b0:	83 ec 04             	sub    $0x4,%esp
+     8b3:	50                   	push   %eax
+     8b4:	68 2c 1c 00 00       	push   $0x1c2c
+     8b9:	ff 35 20 1c 00 00    	push   0x1c20
+     8bf:	e8 af fc ff ff       	call   573 <write>
+     8c4:	83 c4 10             	add    $0x10,%esp
+     8c7:	eb d0                	jmp    899 <fflush+0x19>
+     8c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	56                   	push   %esi
+     8d5:	53                   	push   %ebx
+     8d6:	83 ec 3c             	sub    $0x3c,%esp
+     8d9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     8dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     8df:	83 fe 01             	cmp    $0x1,%esi
+     8e2:	0f 84 60 01 00 00    	je     a48 <printf+0x178>
+    b->fd = fd;
+     8e8:	89 35 00 1a 00 00    	mov    %esi,0x1a00
+  for(i = 0; fmt[i]; i++){
+     8ee:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     8f1:	bf 00 1a 00 00       	mov    $0x1a00,%edi
+  for(i = 0; fmt[i]; i++){
+     8f6:	84 c0                	test   %al,%al
+     8f8:	74 65                	je     95f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     8fa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8fd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     900:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     902:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     905:	eb 1f                	jmp    926 <printf+0x56>
+     907:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     90e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     910:	83 f8 25             	cmp    $0x25,%eax
+     913:	74 3b                	je     950 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     915:	89 f8                	mov    %edi,%eax
+     917:	e8 f4 fe ff ff       	call   810 <putc>
+  for(i = 0; fmt[i]; i++){
+     91c:	0f b6 03             	movzbl (%ebx),%eax
+     91f:	83 c3 01             	add    $0x1,%ebx
+     922:	84 c0                	test   %al,%al
+     924:	74 39                	je     95f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     926:	0f be d0             	movsbl %al,%edx
+     929:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     92c:	85 f6                	test   %esi,%esi
+     92e:	74 e0                	je     910 <printf+0x40>
+      }
+    } else if(state == '%'){
+     930:	83 fe 25             	cmp    $0x25,%esi
+     933:	75 e7                	jne    91c <printf+0x4c>
+      if(c == 'd'){
+     935:	83 f8 25             	cmp    $0x25,%eax
+     938:	74 57                	je     991 <printf+0xc1>
+     93a:	83 e8 63             	sub    $0x63,%eax
+     93d:	83 f8 15             	cmp    $0x15,%eax
+     940:	77 36                	ja     978 <printf+0xa8>
+     942:	ff 24 85 08 11 00 00 	jmp    *0x1108(,%eax,4)
+     949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     950:	0f b6 03             	movzbl (%ebx),%eax
+     953:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     956:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     95b:	84 c0                	test   %al,%al
+     95d:	75 c7                	jne    926 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     95f:	8b 47 04             	mov    0x4(%edi),%eax
+     962:	85 c0                	test   %eax,%eax
+     964:	0f 84 06 01 00 00    	je     a70 <printf+0x1a0>
+    bflush(b);
+}
+     96a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     96d:	5b                   	pop    %ebx
+     96e:	5e                   	pop    %esi
+     96f:	5f                   	pop    %edi
+     970:	5d                   	pop    %ebp
+     971:	c3                   	ret
+     972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     978:	8b 4f 08             	mov    0x8(%edi),%ecx
+     97b:	8d 41 01             	lea    0x1(%ecx),%eax
+     97e:	89 47 08             	mov    %eax,0x8(%edi)
+     981:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     986:	3d 00 02 00 00       	cmp    $0x200,%eax
+     98b:	0f 84 77 01 00 00    	je     b08 <printf+0x238>
+        putc(b, c);
+     991:	89 f8                	mov    %edi,%eax
+      state = 0;
+     993:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     995:	e8 76 fe ff ff       	call   810 <putc>
+     99a:	eb 80                	jmp    91c <printf+0x4c>
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     9a0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9a3:	83 ec 0c             	sub    $0xc,%esp
+     9a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     9ab:	8b 16                	mov    (%esi),%edx
+     9ad:	6a 00                	push   $0x0
+        ap++;
+     9af:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     9b2:	89 f8                	mov    %edi,%eax
+     9b4:	e8 77 fd ff ff       	call   730 <printint>
+        ap++;
+     9b9:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     9bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9bf:	31 f6                	xor    %esi,%esi
+     9c1:	e9 56 ff ff ff       	jmp    91c <printf+0x4c>
+     9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     9d0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     9d3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     9d5:	83 c0 04             	add    $0x4,%eax
+     9d8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     9db:	85 c9                	test   %ecx,%ecx
+     9dd:	0f 84 cd 00 00 00    	je     ab0 <printf+0x1e0>
+        while(*s != 0){
+     9e3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     9e6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     9e8:	84 d2                	test   %dl,%dl
+     9ea:	0f 84 2c ff ff ff    	je     91c <printf+0x4c>
+          putc(b, *s);
+     9f0:	89 f8                	mov    %edi,%eax
+     9f2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     9f5:	e8 16 fe ff ff       	call   810 <putc>
+          s++;
+     9fa:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     9fd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     a01:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     a04:	84 d2                	test   %dl,%dl
+     a06:	75 e8                	jne    9f0 <printf+0x120>
+      state = 0;
+     a08:	31 f6                	xor    %esi,%esi
+     a0a:	e9 0d ff ff ff       	jmp    91c <printf+0x4c>
+     a0f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     a10:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     a13:	83 ec 0c             	sub    $0xc,%esp
+     a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a1b:	8b 16                	mov    (%esi),%edx
+     a1d:	6a 01                	push   $0x1
+     a1f:	eb 8e                	jmp    9af <printf+0xdf>
+     a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     a28:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     a2b:	89 f8                	mov    %edi,%eax
+     a2d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     a30:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     a33:	e8 d8 fd ff ff       	call   810 <putc>
+        ap++;
+     a38:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     a3b:	31 f6                	xor    %esi,%esi
+     a3d:	e9 da fe ff ff       	jmp    91c <printf+0x4c>
+     a42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     a48:	8b 15 24 1c 00 00    	mov    0x1c24,%edx
+     a4e:	85 d2                	test   %edx,%edx
+     a50:	74 6e                	je     ac0 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     a52:	0f b6 03             	movzbl (%ebx),%eax
+     a55:	bf 20 1c 00 00       	mov    $0x1c20,%edi
+     a5a:	84 c0                	test   %al,%al
+     a5c:	0f 85 98 fe ff ff    	jne    8fa <printf+0x2a>
+     a62:	e9 03 ff ff ff       	jmp    96a <printf+0x9a>
+     a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a70:	8b 47 08             	mov    0x8(%edi),%eax
+     a73:	85 c0                	test   %eax,%eax
+     a75:	7f 19                	jg     a90 <printf+0x1c0>
+  b->n = 0;
+     a77:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     a7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a81:	5b                   	pop    %ebx
+     a82:	5e                   	pop    %esi
+     a83:	5f                   	pop    %edi
+     a84:	5d                   	pop    %ebp
+     a85:	c3                   	ret
+     a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a90:	83 ec 04             	sub    $0x4,%esp
+     a93:	50                   	push   %eax
+     a94:	8d 47 0c             	lea    0xc(%edi),%eax
+     a97:	50                   	push   %eax
+     a98:	ff 37                	push   (%edi)
+     a9a:	e8 d4 fa ff ff       	call   573 <write>
+  b->n = 0;
+     a9f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     aa6:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     aa9:	eb d3                	jmp    a7e <printf+0x1ae>
+     aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+     ab0:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     ab5:	b9 ff 10 00 00       	mov    $0x10ff,%ecx
+     aba:	e9 31 ff ff ff       	jmp    9f0 <printf+0x120>
+     abf:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ac0:	83 ec 08             	sub    $0x8,%esp
+     ac3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     ac6:	c7 05 20 1c 00 00 01 	movl   $0x1,0x1c20
+     acd:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ad0:	50                   	push   %eax
+     ad1:	6a 01                	push   $0x1
+     ad3:	e8 d3 fa ff ff       	call   5ab <fstat>
+     ad8:	83 c4 10             	add    $0x10,%esp
+     adb:	85 c0                	test   %eax,%eax
+     add:	75 22                	jne    b01 <printf+0x231>
+     adf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     ae4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ae9:	0f 45 f0             	cmovne %eax,%esi
+     aec:	89 35 24 1c 00 00    	mov    %esi,0x1c24
+      stdioflush = flushout;
+     af2:	c7 05 c0 17 00 00 f0 	movl   $0x6f0,0x17c0
+     af9:	06 00 00 
+     afc:	e9 51 ff ff ff       	jmp    a52 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     b01:	be 02 00 00 00       	mov    $0x2,%esi
+     b06:	eb e4                	jmp    aec <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     b08:	83 ec 04             	sub    $0x4,%esp
+     b0b:	8d 47 0c             	lea    0xc(%edi),%eax
+     b0e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     b11:	68 00 02 00 00       	push   $0x200
+     b16:	50                   	push   %eax
+     b17:	ff 37                	push   (%edi)
+     b19:	e8 55 fa ff ff       	call   573 <write>
+  b->n = 0;
+     b1e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     b25:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     b28:	83 c4 10             	add    $0x10,%esp
+     b2b:	e9 61 fe ff ff       	jmp    991 <printf+0xc1>
+
+00000b30 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	56                   	push   %esi
+     b34:	53                   	push   %ebx
+     b35:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     b37:	a1 40 1e 00 00       	mov    0x1e40,%eax
+     b3c:	39 d8                	cmp    %ebx,%eax
+     b3e:	0f 83 e4 00 00 00    	jae    c28 <freepages+0xf8>
+     b44:	85 c0                	test   %eax,%eax
+     b46:	0f 84 dc 00 00 00    	je     c28 <freepages+0xf8>
+     b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b50:	89 c2                	mov    %eax,%edx
+     b52:	8b 00                	mov    (%eax),%eax
+     b54:	85 c0                	test   %eax,%eax
+     b56:	74 04                	je     b5c <freepages+0x2c>
+     b58:	39 d8                	cmp    %ebx,%eax
+     b5a:	72 f4                	jb     b50 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     b5c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     b5f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     b61:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     b63:	85 c0                	test   %eax,%eax
+     b65:	74 15                	je     b7c <freepages+0x4c>
+    p->prev = s;
+     b67:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     b6a:	8b 73 10             	mov    0x10(%ebx),%esi
+     b6d:	89 f1                	mov    %esi,%ecx
+     b6f:	c1 e1 0c             	shl    $0xc,%ecx
+     b72:	01 d9                	add    %ebx,%ecx
+     b74:	39 c8                	cmp    %ecx,%eax
+     b76:	0f 84 d8 00 00 00    	je     c54 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     b7c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     b7f:	89 c8                	mov    %ecx,%eax
+     b81:	c1 e0 0c             	shl    $0xc,%eax
+     b84:	01 d0                	add    %edx,%eax
+     b86:	39 c3                	cmp    %eax,%ebx
+     b88:	74 16                	je     ba0 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b8a:	8b 03                	mov    (%ebx),%eax
+     b8c:	85 c0                	test   %eax,%eax
+     b8e:	74 40                	je     bd0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     b90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b93:	5b                   	pop    %ebx
+     b94:	5e                   	pop    %esi
+     b95:	5d                   	pop    %ebp
+     b96:	c3                   	ret
+     b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     ba0:	03 4b 10             	add    0x10(%ebx),%ecx
+     ba3:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     ba6:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     ba9:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     bab:	85 c9                	test   %ecx,%ecx
+     bad:	0f 84 dd 00 00 00    	je     c90 <freepages+0x160>
+    s->prev->next = s->next;
+     bb3:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     bb5:	85 c0                	test   %eax,%eax
+     bb7:	74 06                	je     bbf <freepages+0x8f>
+    s->next->prev = s->prev;
+     bb9:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     bbc:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     bbf:	8b 02                	mov    (%edx),%eax
+     bc1:	89 d3                	mov    %edx,%ebx
+     bc3:	85 c0                	test   %eax,%eax
+     bc5:	75 c9                	jne    b90 <freepages+0x60>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+     bd0:	8b 43 10             	mov    0x10(%ebx),%eax
+     bd3:	83 f8 0f             	cmp    $0xf,%eax
+     bd6:	76 b8                	jbe    b90 <freepages+0x60>
+     bd8:	83 ec 0c             	sub    $0xc,%esp
+     bdb:	c1 e0 0c             	shl    $0xc,%eax
+     bde:	6a 00                	push   $0x0
+     be0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     be3:	e8 f3 f9 ff ff       	call   5db <sbrk>
+     be8:	83 c4 10             	add    $0x10,%esp
+     beb:	39 c6                	cmp    %eax,%esi
+     bed:	75 a1                	jne    b90 <freepages+0x60>
+  if(s->prev)
+     bef:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     bf2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     bf4:	85 d2                	test   %edx,%edx
+     bf6:	0f 84 a5 00 00 00    	je     ca1 <freepages+0x171>
+    s->prev->next = s->next;
+     bfc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     bfe:	85 c0                	test   %eax,%eax
+     c00:	74 06                	je     c08 <freepages+0xd8>
+    s->next->prev = s->prev;
+     c02:	8b 53 04             	mov    0x4(%ebx),%edx
+     c05:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     c08:	8b 43 10             	mov    0x10(%ebx),%eax
+     c0b:	83 ec 0c             	sub    $0xc,%esp
+     c0e:	c1 e0 0c             	shl    $0xc,%eax
+     c11:	f7 d8                	neg    %eax
+     c13:	50                   	push   %eax
+     c14:	e8 c2 f9 ff ff       	call   5db <sbrk>
+     c19:	83 c4 10             	add    $0x10,%esp
+}
+     c1c:	e9 6f ff ff ff       	jmp    b90 <freepages+0x60>
+     c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     c28:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     c2f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     c31:	89 1d 40 1e 00 00    	mov    %ebx,0x1e40
+  if(p)
+     c37:	85 c0                	test   %eax,%eax
+     c39:	74 95                	je     bd0 <freepages+0xa0>
+    p->prev = s;
+     c3b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     c3e:	8b 73 10             	mov    0x10(%ebx),%esi
+     c41:	89 f2                	mov    %esi,%edx
+     c43:	c1 e2 0c             	shl    $0xc,%edx
+     c46:	01 da                	add    %ebx,%edx
+     c48:	39 d0                	cmp    %edx,%eax
+     c4a:	0f 85 3a ff ff ff    	jne    b8a <freepages+0x5a>
+     c50:	89 c1                	mov    %eax,%ecx
+     c52:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     c54:	8b 41 10             	mov    0x10(%ecx),%eax
+     c57:	01 f0                	add    %esi,%eax
+     c59:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     c5c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     c5f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     c61:	85 f6                	test   %esi,%esi
+     c63:	74 35                	je     c9a <freepages+0x16a>
+    s->prev->next = s->next;
+     c65:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     c67:	85 c0                	test   %eax,%eax
+     c69:	74 06                	je     c71 <freepages+0x141>
+    s->next->prev = s->prev;
+     c6b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     c6e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     c71:	85 d2                	test   %edx,%edx
+     c73:	0f 84 11 ff ff ff    	je     b8a <freepages+0x5a>
+     c79:	8b 4a 10             	mov    0x10(%edx),%ecx
+     c7c:	89 c8                	mov    %ecx,%eax
+     c7e:	c1 e0 0c             	shl    $0xc,%eax
+     c81:	01 d0                	add    %edx,%eax
+     c83:	39 c3                	cmp    %eax,%ebx
+     c85:	0f 85 ff fe ff ff    	jne    b8a <freepages+0x5a>
+     c8b:	e9 10 ff ff ff       	jmp    ba0 <freepages+0x70>
+    *l = s->next;
+     c90:	a3 40 1e 00 00       	mov    %eax,0x1e40
+     c95:	e9 1b ff ff ff       	jmp    bb5 <freepages+0x85>
+     c9a:	a3 40 1e 00 00       	mov    %eax,0x1e40
+     c9f:	eb c6                	jmp    c67 <freepages+0x137>
+     ca1:	a3 40 1e 00 00       	mov    %eax,0x1e40
+     ca6:	e9 53 ff ff ff       	jmp    bfe <freepages+0xce>
+     cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     caf:	90                   	nop
+
+00000cb0 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	56                   	push   %esi
+     cb4:	53                   	push   %ebx
+     cb5:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     cb7:	a1 40 1e 00 00       	mov    0x1e40,%eax
+     cbc:	85 c0                	test   %eax,%eax
+     cbe:	74 5e                	je     d1e <getpages+0x6e>
+    if(s->npages < n)
+     cc0:	8b 50 10             	mov    0x10(%eax),%edx
+     cc3:	39 da                	cmp    %ebx,%edx
+     cc5:	72 51                	jb     d18 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     cc7:	39 d3                	cmp    %edx,%ebx
+     cc9:	72 25                	jb     cf0 <getpages+0x40>
+  if(s->prev)
+     ccb:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     cce:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     cd0:	85 c9                	test   %ecx,%ecx
+     cd2:	0f 84 a8 00 00 00    	je     d80 <getpages+0xd0>
+    s->prev->next = s->next;
+     cd8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     cda:	85 d2                	test   %edx,%edx
+     cdc:	74 06                	je     ce4 <getpages+0x34>
+    s->next->prev = s->prev;
+     cde:	8b 48 04             	mov    0x4(%eax),%ecx
+     ce1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     ce4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     ce7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cea:	5b                   	pop    %ebx
+     ceb:	5e                   	pop    %esi
+     cec:	5d                   	pop    %ebp
+     ced:	c3                   	ret
+     cee:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     cf0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     cf2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     cf4:	c1 e1 0c             	shl    $0xc,%ecx
+     cf7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     cf9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     cfc:	8b 70 04             	mov    0x4(%eax),%esi
+     cff:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     d02:	8b 10                	mov    (%eax),%edx
+     d04:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     d06:	85 f6                	test   %esi,%esi
+     d08:	74 66                	je     d70 <getpages+0xc0>
+        rest->prev->next = rest;
+     d0a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     d0c:	8b 11                	mov    (%ecx),%edx
+     d0e:	85 d2                	test   %edx,%edx
+     d10:	75 cf                	jne    ce1 <getpages+0x31>
+     d12:	eb d0                	jmp    ce4 <getpages+0x34>
+     d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     d18:	8b 00                	mov    (%eax),%eax
+     d1a:	85 c0                	test   %eax,%eax
+     d1c:	75 a2                	jne    cc0 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     d1e:	83 ec 0c             	sub    $0xc,%esp
+     d21:	6a 00                	push   $0x0
+     d23:	e8 b3 f8 ff ff       	call   5db <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d28:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     d2b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     d31:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d33:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     d39:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d3f:	29 d0                	sub    %edx,%eax
+     d41:	c1 e8 0c             	shr    $0xc,%eax
+     d44:	39 d8                	cmp    %ebx,%eax
+     d46:	72 48                	jb     d90 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     d48:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d4a:	89 d8                	mov    %ebx,%eax
+     d4c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     d4f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d51:	c1 e0 0c             	shl    $0xc,%eax
+     d54:	01 f0                	add    %esi,%eax
+     d56:	50                   	push   %eax
+     d57:	e8 7f f8 ff ff       	call   5db <sbrk>
+     d5c:	83 c4 10             	add    $0x10,%esp
+     d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d62:	74 2c                	je     d90 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     d64:	01 f0                	add    %esi,%eax
+     d66:	e9 79 ff ff ff       	jmp    ce4 <getpages+0x34>
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+        runs = rest;
+     d70:	89 0d 40 1e 00 00    	mov    %ecx,0x1e40
+     d76:	eb 96                	jmp    d0e <getpages+0x5e>
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+    *l = s->next;
+     d80:	89 15 40 1e 00 00    	mov    %edx,0x1e40
+     d86:	e9 4f ff ff ff       	jmp    cda <getpages+0x2a>
+     d8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d8f:	90                   	nop
+    return 0;
+     d90:	31 c0                	xor    %eax,%eax
+     d92:	e9 50 ff ff ff       	jmp    ce7 <getpages+0x37>
+     d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	57                   	push   %edi
+     da4:	56                   	push   %esi
+     da5:	53                   	push   %ebx
+     da6:	83 ec 1c             	sub    $0x1c,%esp
+     da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     dac:	85 c0                	test   %eax,%eax
+     dae:	0f 84 97 00 00 00    	je     e4b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     db4:	89 c3                	mov    %eax,%ebx
+     db6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     dbc:	8b 73 14             	mov    0x14(%ebx),%esi
+     dbf:	83 fe 01             	cmp    $0x1,%esi
+     dc2:	74 74                	je     e38 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     dc4:	85 f6                	test   %esi,%esi
+     dc6:	74 5d                	je     e25 <free+0x85>
+  if(s->free == 0)
+     dc8:	8b 53 08             	mov    0x8(%ebx),%edx
+     dcb:	85 d2                	test   %edx,%edx
+     dcd:	0f 84 85 00 00 00    	je     e58 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     dd3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     dd5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     dd8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     ddb:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     dde:	8b 04 f5 64 1e 00 00 	mov    0x1e64(,%esi,8),%eax
+  s->inuse--;
+     de5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     de8:	83 c0 01             	add    $0x1,%eax
+     deb:	89 04 f5 64 1e 00 00 	mov    %eax,0x1e64(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     df2:	85 d2                	test   %edx,%edx
+     df4:	75 55                	jne    e4b <free+0xab>
+     df6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     dfb:	89 f1                	mov    %esi,%ecx
+     dfd:	d3 ea                	shr    %cl,%edx
+     dff:	39 c2                	cmp    %eax,%edx
+     e01:	73 7d                	jae    e80 <free+0xe0>
+  if(s->prev)
+     e03:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     e06:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     e08:	85 ff                	test   %edi,%edi
+     e0a:	0f 84 a0 00 00 00    	je     eb0 <free+0x110>
+    s->prev->next = s->next;
+     e10:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     e12:	85 c9                	test   %ecx,%ecx
+     e14:	74 06                	je     e1c <free+0x7c>
+    s->next->prev = s->prev;
+     e16:	8b 7b 04             	mov    0x4(%ebx),%edi
+     e19:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     e1c:	29 d0                	sub    %edx,%eax
+     e1e:	89 04 f5 64 1e 00 00 	mov    %eax,0x1e64(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     e28:	89 d8                	mov    %ebx,%eax
+}
+     e2a:	5b                   	pop    %ebx
+     e2b:	5e                   	pop    %esi
+     e2c:	5f                   	pop    %edi
+     e2d:	5d                   	pop    %ebp
+    freepages(s);
+     e2e:	e9 fd fc ff ff       	jmp    b30 <freepages>
+     e33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e37:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     e38:	8b 43 10             	mov    0x10(%ebx),%eax
+     e3b:	83 ec 08             	sub    $0x8,%esp
+     e3e:	c1 e0 0c             	shl    $0xc,%eax
+     e41:	50                   	push   %eax
+     e42:	53                   	push   %ebx
+     e43:	e8 6b f8 ff ff       	call   6b3 <munmap>
+     e48:	83 c4 10             	add    $0x10,%esp
+}
+     e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e4e:	5b                   	pop    %ebx
+     e4f:	5e                   	pop    %esi
+     e50:	5f                   	pop    %edi
+     e51:	5d                   	pop    %ebp
+     e52:	c3                   	ret
+     e53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e57:	90                   	nop
+  s->next = *l;
+     e58:	8b 14 f5 60 1e 00 00 	mov    0x1e60(,%esi,8),%edx
+  s->prev = 0;
+     e5f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     e66:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     e68:	85 d2                	test   %edx,%edx
+     e6a:	74 06                	je     e72 <free+0xd2>
+    (*l)->prev = s;
+     e6c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     e6f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+     e72:	89 1c f5 60 1e 00 00 	mov    %ebx,0x1e60(,%esi,8)
+}
+     e79:	e9 55 ff ff ff       	jmp    dd3 <free+0x33>
+     e7e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+     e80:	83 ec 0c             	sub    $0xc,%esp
+     e83:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e86:	8b 7b 10             	mov    0x10(%ebx),%edi
+     e89:	6a 00                	push   $0x0
+     e8b:	c1 e7 0c             	shl    $0xc,%edi
+     e8e:	01 df                	add    %ebx,%edi
+     e90:	e8 46 f7 ff ff       	call   5db <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     e95:	83 c4 10             	add    $0x10,%esp
+     e98:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     e9b:	39 c7                	cmp    %eax,%edi
+     e9d:	75 ac                	jne    e4b <free+0xab>
+     e9f:	8b 04 f5 64 1e 00 00 	mov    0x1e64(,%esi,8),%eax
+     ea6:	e9 58 ff ff ff       	jmp    e03 <free+0x63>
+     eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eaf:	90                   	nop
+    *l = s->next;
+     eb0:	89 0c f5 60 1e 00 00 	mov    %ecx,0x1e60(,%esi,8)
+     eb7:	e9 56 ff ff ff       	jmp    e12 <free+0x72>
+     ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ec0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     ec0:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     ec1:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	57                   	push   %edi
+     ec9:	56                   	push   %esi
+     eca:	53                   	push   %ebx
+     ecb:	83 ec 1c             	sub    $0x1c,%esp
+     ece:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+     ed1:	83 f8 10             	cmp    $0x10,%eax
+     ed4:	0f 86 92 00 00 00    	jbe    f6c <malloc+0xac>
+     eda:	ba 01 00 00 00       	mov    $0x1,%edx
+     edf:	eb 13                	jmp    ef4 <malloc+0x34>
+     ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ee8:	89 d3                	mov    %edx,%ebx
+     eea:	d3 e3                	shl    %cl,%ebx
+     eec:	39 c3                	cmp    %eax,%ebx
+     eee:	0f 83 84 00 00 00    	jae    f78 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     ef4:	83 c1 01             	add    $0x1,%ecx
+     ef7:	83 f9 0b             	cmp    $0xb,%ecx
+     efa:	75 ec                	jne    ee8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+     efc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+     f01:	0f 87 c9 00 00 00    	ja     fd0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+     f07:	05 17 10 00 00       	add    $0x1017,%eax
+     f0c:	89 c3                	mov    %eax,%ebx
+     f0e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+     f11:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+     f16:	77 28                	ja     f40 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+     f18:	89 d8                	mov    %ebx,%eax
+     f1a:	e8 91 fd ff ff       	call   cb0 <getpages>
+     f1f:	85 c0                	test   %eax,%eax
+     f21:	0f 84 a9 00 00 00    	je     fd0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+     f27:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+     f2e:	83 c0 18             	add    $0x18,%eax
+}
+     f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f34:	5b                   	pop    %ebx
+     f35:	5e                   	pop    %esi
+     f36:	5f                   	pop    %edi
+     f37:	5d                   	pop    %ebp
+     f38:	c3                   	ret
+     f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+     f40:	89 d8                	mov    %ebx,%eax
+     f42:	83 ec 08             	sub    $0x8,%esp
+     f45:	c1 e0 0c             	shl    $0xc,%eax
+     f48:	6a 00                	push   $0x0
+     f4a:	6a ff                	push   $0xffffffff
+     f4c:	6a 22                	push   $0x22
+     f4e:	6a 03                	push   $0x3
+     f50:	50                   	push   %eax
+     f51:	6a 00                	push   $0x0
+     f53:	e8 53 f7 ff ff       	call   6ab <mmap>
+    if(s == MAP_FAILED)
+     f58:	83 c4 20             	add    $0x20,%esp
+     f5b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f5e:	74 b8                	je     f18 <malloc+0x58>
+      s->shift = MAPRUN;
+     f60:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+     f67:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+     f6a:	eb c2                	jmp    f2e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+     f6c:	bb 10 00 00 00       	mov    $0x10,%ebx
+     f71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+     f78:	8b 34 cd 60 1e 00 00 	mov    0x1e60(,%ecx,8),%esi
+     f7f:	85 f6                	test   %esi,%esi
+     f81:	74 57                	je     fda <malloc+0x11a>
+  classes[shift].nfree--;
+     f83:	8b 1c cd 64 1e 00 00 	mov    0x1e64(,%ecx,8),%ebx
+  o = s->free;
+     f8a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+     f8d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     f90:	89 14 cd 64 1e 00 00 	mov    %edx,0x1e64(,%ecx,8)
+  s->free = NEXTFREE(o);
+     f97:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+     f99:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+     f9d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+     fa0:	85 ff                	test   %edi,%edi
+     fa2:	75 8d                	jne    f31 <malloc+0x71>
+  if(s->prev)
+     fa4:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+     fa7:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+     fa9:	85 db                	test   %ebx,%ebx
+     fab:	0f 84 b7 00 00 00    	je     1068 <malloc+0x1a8>
+    s->prev->next = s->next;
+     fb1:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+     fb3:	85 d2                	test   %edx,%edx
+     fb5:	0f 84 76 ff ff ff    	je     f31 <malloc+0x71>
+    s->next->prev = s->prev;
+     fbb:	8b 4e 04             	mov    0x4(%esi),%ecx
+     fbe:	89 4a 04             	mov    %ecx,0x4(%edx)
+     fc1:	e9 6b ff ff ff       	jmp    f31 <malloc+0x71>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     fd3:	31 c0                	xor    %eax,%eax
+}
+     fd5:	5b                   	pop    %ebx
+     fd6:	5e                   	pop    %esi
+     fd7:	5f                   	pop    %edi
+     fd8:	5d                   	pop    %ebp
+     fd9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+     fda:	b8 01 00 00 00       	mov    $0x1,%eax
+     fdf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     fe2:	e8 c9 fc ff ff       	call   cb0 <getpages>
+     fe7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     fea:	85 c0                	test   %eax,%eax
+     fec:	89 c2                	mov    %eax,%edx
+     fee:	74 e0                	je     fd0 <malloc+0x110>
+    s->shift = shift;
+     ff0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     ff3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+     ff5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+     ffc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1001:	89 df                	mov    %ebx,%edi
+    1003:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    1005:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    1007:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    100a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    100d:	83 e8 01             	sub    $0x1,%eax
+    1010:	d3 e0                	shl    %cl,%eax
+    1012:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1015:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1019:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    101c:	eb 04                	jmp    1022 <malloc+0x162>
+    101e:	66 90                	xchg   %ax,%ax
+    1020:	89 c8                	mov    %ecx,%eax
+    1022:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1025:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1027:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    102a:	89 c6                	mov    %eax,%esi
+    102c:	39 da                	cmp    %ebx,%edx
+    102e:	7f f0                	jg     1020 <malloc+0x160>
+    1030:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1033:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1036:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1039:	8b 04 cd 60 1e 00 00 	mov    0x1e60(,%ecx,8),%eax
+  s->prev = 0;
+    1040:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1047:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1049:	85 c0                	test   %eax,%eax
+    104b:	74 03                	je     1050 <malloc+0x190>
+    (*l)->prev = s;
+    104d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1050:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1053:	89 14 cd 60 1e 00 00 	mov    %edx,0x1e60(,%ecx,8)
+    classes[shift].nfree += n;
+    105a:	89 d6                	mov    %edx,%esi
+    105c:	03 1c cd 64 1e 00 00 	add    0x1e64(,%ecx,8),%ebx
+    1063:	e9 22 ff ff ff       	jmp    f8a <malloc+0xca>
+    *l = s->next;
+    1068:	89 14 cd 60 1e 00 00 	mov    %edx,0x1e60(,%ecx,8)
+    106f:	e9 3f ff ff ff       	jmp    fb3 <malloc+0xf3>
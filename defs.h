@@ -2,11 +2,16 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct kmem_cache;
+struct memstat;
+struct vma;
+struct ksync;
 struct pipe;
 struct proc;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
+struct spawn_action;
 struct stat;
 struct superblock;
 
@@ -23,7 +28,11 @@ void consoleintr(int (*)(void));
 void panic(char *) __attribute__((noreturn));
 
 // exec.c
+void cmdcacheinit(void);
+void cmdinval(void);
+int setpath(char *);
 int exec(char *, char **);
+int execinto(struct proc *, char *, char **);
 
 // file.c
 struct file *filealloc(void);
@@ -40,11 +49,14 @@ int dirlink(struct inode *, char *, uint);
 struct inode *dirlookup(struct inode *, char *, uint *);
 struct inode *ialloc(uint, short);
 struct inode *idup(struct inode *);
+struct inode *iget(uint, uint);
 void iinit(int dev);
 void ilock(struct inode *);
+void ilockshared(struct inode *);
 void iput(struct inode *);
 void iunlock(struct inode *);
 void iunlockput(struct inode *);
+void iunlockshared(struct inode *);
 void iupdate(struct inode *);
 int namecmp(const char *, const char *);
 struct inode *namei(char *);
@@ -64,16 +76,37 @@ extern uchar ioapicid;
 void ioapicinit(void);
 
 // kalloc.c
+extern uint physstop;
 char *kalloc(void);
 void kfree(char *);
+int kfreepages(void);
+int ktotalpages(void);
+char* kalloc_zeroed(void);
+char* kalloc_pages(int);
+void kfree_pages(char *, int);
+void print_kalloc_stats(void);
+void kzerofill(void);
 void kinit1(void *, void *);
 void kinit2(void *, void *);
+void kref(char *);
+int krefcount(char *);
 
 // kbd.c
 void kbdintr(void);
 
+// ksync.c
+struct ksync *eventalloc(void);
+void ksyncclose(struct ksync *);
+struct ksync *ksyncdup(struct ksync *);
+void ksyncinit(void);
+void ksyncpost(struct ksync *);
+int ksyncreset(struct ksync *);
+int ksyncwait(struct ksync *);
+struct ksync *semalloc(int);
+
 // lapic.c
 void cmostime(struct rtcdate *r);
+uint cmosmemtop(void);
 int lapicid(void);
 extern volatile uint *lapic;
 void lapiceoi(void);
@@ -87,16 +120,38 @@ void log_write(struct buf *);
 void begin_op();
 void end_op();
 
+// mmap.c
+struct vma *findvma(struct proc *, uint);
+uint vmabase(struct proc *);
+int vmaoverlap(struct proc *, uint, uint);
+int vmaload(struct proc *, uint, uint, int, struct inode *, uint, uint);
+int vmaslots(struct proc *);
+uint uvmlimit(struct proc *, uint);
+uint vmamap(struct proc *, uint, uint, int, int, struct file *, uint);
+int vmafault(struct proc *, struct vma *, uint);
+int vmaunmap(struct proc *, uint, uint);
+void vmaclear(struct proc *);
+int vmafork(struct proc *, struct proc *);
+
 // mp.c
 extern int ismp;
 void mpinit(void);
 
+// pcache.c
+void pcacheinit(void);
+char *pcacheget(struct inode *, uint, uint);
+void pcacheinval(struct inode *);
+int pcachepages(void);
+void print_pcache_stats(void);
+
 // picirq.c
 void picenable(int);
 void picinit(void);
 
 // pipe.c
 int pipealloc(struct file **, struct file **);
+int pipepages(void);
+void pipeinit(void);
 void pipeclose(struct pipe *, int);
 int piperead(struct pipe *, char *, int);
 int pipewrite(struct pipe *, char *, int);
@@ -106,19 +161,22 @@ int pipewrite(struct pipe *, char *, int);
 int cpuid(void);
 void exit(void);
 int fork(void);
+int spawn(char *, char **, struct spawn_action *, int);
 int growproc(int);
 int kill(int);
 struct cpu *mycpu(void);
 struct proc *myproc();
 void pinit(void);
+int reclaim(int);
 void procdump(void);
 void scheduler(void) __attribute__((noreturn));
 void sched(void);
 void setproc(struct proc *);
 void sleep(void *, struct spinlock *);
+struct proc *swapproc(int *);
+int memstat(int, struct memstat *);
 void userinit(void);
 int wait(void);
-void add_path(char *);
 int get_children_of(int);
 void wakeup(void *);
 void yield(void);
@@ -136,11 +194,34 @@ void release(struct spinlock *);
 void pushcli(void);
 void popcli(void);
 
+// shm.c
+void shminit(void);
+int shmget(int, uint);
+uint shmat(struct proc *, int);
+int shmdt(struct proc *, uint);
+int shmrm(int);
+
+// slab.c
+void slabinit(void);
+struct kmem_cache *kmem_cache_create(char *, uint, void (*)(void *));
+void *kmem_cache_alloc(struct kmem_cache *);
+void kmem_cache_free(struct kmem_cache *, void *);
+int kmem_cache_pages(struct kmem_cache *);
+void *kmalloc(uint);
+void kmfree(void *);
+void print_slab_stats(void);
+
 // sleeplock.c
 void acquiresleep(struct sleeplock *);
 void releasesleep(struct sleeplock *);
+void acquiresleepshared(struct sleeplock *);
+void releasesleepshared(struct sleeplock *);
 int holdingsleep(struct sleeplock *);
 void initsleeplock(struct sleeplock *, char *);
+void print_lock_stats(void);
+
+// sysfile.c
+struct file *fileopen(char *, int);
 
 // string.c
 int memcmp(const void *, const void *, uint);
@@ -151,6 +232,17 @@ int strlen(const char *);
 int strncmp(const char *, const char *, uint);
 char *strncpy(char *, const char *, int);
 
+// swap.c
+void swapinit(int);
+int swapout(void);
+int swapin(uint);
+void swapdup(uint);
+void swapfree(uint);
+int swapfreepages(void);
+int swappages(void);
+char *kallocswap(int);
+void print_swap_stats(void);
+
 // syscall.c
 int argint(int, int *);
 int argptr(int, char **, int);
@@ -182,12 +274,19 @@ int allocuvm(pde_t *, uint, uint);
 int deallocuvm(pde_t *, uint, uint);
 void freevm(pde_t *);
 void inituvm(pde_t *, char *, uint);
-int loaduvm(pde_t *, char *, struct inode *, uint, uint);
 pde_t *copyuvm(pde_t *, uint);
+int shareuvm(pde_t *, pde_t *, uint, uint, int);
+uint *walkpgdir(pde_t *, const void *, int);
+int mappages(pde_t *, void *, uint, uint, int);
 void switchuvm(struct proc *);
 void switchkvm(void);
 int copyout(pde_t *, uint, void *, uint);
 void clearpteu(pde_t *pgdir, char *uva);
+int pagefault(uint, uint);
+int uvmprefault(char *, uint, int);
+void vmmemstat(struct memstat *);
+void uvmresident(pde_t *, struct memstat *);
+void print_vm_stats(void);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x) / sizeof((x)[0]))
@@ -0,0 +1,2159 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 34 0f 00 00       	push   $0xf34
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 36 0f 00 00       	push   $0xf36
+  3e:	6a 01                	push   $0x1
+  40:	e8 4b 07 00 00       	call   790 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 3b 0f 00 00       	push   $0xf3b
+  55:	50                   	push   %eax
+  56:	68 36 0f 00 00       	push   $0xf36
+  5b:	6a 01                	push   $0x1
+  5d:	e8 2e 07 00 00       	call   790 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 36 00 00 00       	call   a0 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+  70:	a1 c0 13 00 00       	mov    0x13c0,%eax
+  75:	85 c0                	test   %eax,%eax
+  77:	74 17                	je     90 <fork+0x20>
+{
+  79:	55                   	push   %ebp
+  7a:	89 e5                	mov    %esp,%ebp
+  7c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+  7f:	ff d0                	call   *%eax
+  return _fork();
+}
+  81:	c9                   	leave
+  return _fork();
+  82:	e9 84 03 00 00       	jmp    40b <_fork>
+  87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8e:	66 90                	xchg   %ax,%ax
+  90:	e9 76 03 00 00       	jmp    40b <_fork>
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <exit>:
+
+int
+exit(void)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+  a6:	a1 c0 13 00 00       	mov    0x13c0,%eax
+  ab:	85 c0                	test   %eax,%eax
+  ad:	74 02                	je     b1 <exit+0x11>
+    stdioflush();
+  af:	ff d0                	call   *%eax
+  _exit();
+  b1:	e8 5d 03 00 00       	call   413 <_exit>
+  b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000c0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+  c0:	55                   	push   %ebp
+  if(stdioflush)
+  c1:	a1 c0 13 00 00       	mov    0x13c0,%eax
+{
+  c6:	89 e5                	mov    %esp,%ebp
+  c8:	56                   	push   %esi
+  c9:	53                   	push   %ebx
+  ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+  d0:	85 c0                	test   %eax,%eax
+  d2:	74 02                	je     d6 <exec+0x16>
+    stdioflush();
+  d4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+  d6:	89 75 0c             	mov    %esi,0xc(%ebp)
+  d9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+  dc:	5b                   	pop    %ebx
+  dd:	5e                   	pop    %esi
+  de:	5d                   	pop    %ebp
+  return _exec(path, argv);
+  df:	e9 67 03 00 00       	jmp    44b <_exec>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	56                   	push   %esi
+  f5:	53                   	push   %ebx
+  f6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+  f9:	a1 c0 13 00 00       	mov    0x13c0,%eax
+{
+  fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 101:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 104:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 107:	85 c0                	test   %eax,%eax
+ 109:	74 02                	je     10d <spawn+0x1d>
+    stdioflush();
+ 10b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 10d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 110:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 113:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 116:	83 c4 0c             	add    $0xc,%esp
+ 119:	5b                   	pop    %ebx
+ 11a:	5e                   	pop    %esi
+ 11b:	5f                   	pop    %edi
+ 11c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 11d:	e9 79 04 00 00       	jmp    59b <_spawn>
+ 122:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 130:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 131:	31 c0                	xor    %eax,%eax
+{
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	53                   	push   %ebx
+ 136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 140:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 144:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 147:	83 c0 01             	add    $0x1,%eax
+ 14a:	84 d2                	test   %dl,%dl
+ 14c:	75 f2                	jne    140 <strcpy+0x10>
+    ;
+  return os;
+}
+ 14e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 151:	89 c8                	mov    %ecx,%eax
+ 153:	c9                   	leave
+ 154:	c3                   	ret
+ 155:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	53                   	push   %ebx
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+ 167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 16a:	0f b6 02             	movzbl (%edx),%eax
+ 16d:	84 c0                	test   %al,%al
+ 16f:	75 17                	jne    188 <strcmp+0x28>
+ 171:	eb 3a                	jmp    1ad <strcmp+0x4d>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 17c:	83 c2 01             	add    $0x1,%edx
+ 17f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 182:	84 c0                	test   %al,%al
+ 184:	74 1a                	je     1a0 <strcmp+0x40>
+    p++, q++;
+ 186:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 188:	0f b6 19             	movzbl (%ecx),%ebx
+ 18b:	38 c3                	cmp    %al,%bl
+ 18d:	74 e9                	je     178 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 18f:	29 d8                	sub    %ebx,%eax
+}
+ 191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 194:	c9                   	leave
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1a4:	31 c0                	xor    %eax,%eax
+ 1a6:	29 d8                	sub    %ebx,%eax
+}
+ 1a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 1b0:	31 c0                	xor    %eax,%eax
+ 1b2:	eb db                	jmp    18f <strcmp+0x2f>
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	75 f5                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1db:	89 c8                	mov    %ecx,%eax
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1e0:	31 c9                	xor    %ecx,%ecx
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	c9                   	leave
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	53                   	push   %ebx
+ 256:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 259:	a1 c0 13 00 00       	mov    0x13c0,%eax
+{
+ 25e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 261:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 264:	85 c0                	test   %eax,%eax
+ 266:	74 02                	je     26a <gets+0x1a>
+    stdioflush();
+ 268:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 26a:	a1 e8 15 00 00       	mov    0x15e8,%eax
+ 26f:	85 c0                	test   %eax,%eax
+ 271:	0f 84 99 00 00 00    	je     310 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 277:	31 db                	xor    %ebx,%ebx
+ 279:	eb 21                	jmp    29c <gets+0x4c>
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 280:	8d 50 01             	lea    0x1(%eax),%edx
+ 283:	0f b6 80 e0 13 00 00 	movzbl 0x13e0(%eax),%eax
+ 28a:	89 15 e0 15 00 00    	mov    %edx,0x15e0
+    buf[i++] = c;
+ 290:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 294:	3c 0a                	cmp    $0xa,%al
+ 296:	74 60                	je     2f8 <gets+0xa8>
+ 298:	3c 0d                	cmp    $0xd,%al
+ 29a:	74 5c                	je     2f8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 29c:	89 da                	mov    %ebx,%edx
+ 29e:	83 c3 01             	add    $0x1,%ebx
+ 2a1:	39 fb                	cmp    %edi,%ebx
+ 2a3:	7d 55                	jge    2fa <gets+0xaa>
+    if(in.r == in.n){
+ 2a5:	a1 e0 15 00 00       	mov    0x15e0,%eax
+ 2aa:	3b 05 e4 15 00 00    	cmp    0x15e4,%eax
+ 2b0:	75 ce                	jne    280 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2b2:	83 ec 04             	sub    $0x4,%esp
+ 2b5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 2b8:	c7 05 e4 15 00 00 00 	movl   $0x0,0x15e4
+ 2bf:	00 00 00 
+ 2c2:	c7 05 e0 15 00 00 00 	movl   $0x0,0x15e0
+ 2c9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2cc:	ff 35 e8 15 00 00    	push   0x15e8
+ 2d2:	68 e0 13 00 00       	push   $0x13e0
+ 2d7:	6a 00                	push   $0x0
+ 2d9:	e8 4d 01 00 00       	call   42b <read>
+ 2de:	83 c4 10             	add    $0x10,%esp
+ 2e1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 2e4:	85 c0                	test   %eax,%eax
+ 2e6:	a3 e4 15 00 00       	mov    %eax,0x15e4
+ 2eb:	7e 56                	jle    343 <gets+0xf3>
+    c = in.buf[in.r++];
+ 2ed:	a1 e0 15 00 00       	mov    0x15e0,%eax
+ 2f2:	eb 8c                	jmp    280 <gets+0x30>
+ 2f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 2f8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 2fa:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 2fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 301:	89 f0                	mov    %esi,%eax
+ 303:	5b                   	pop    %ebx
+ 304:	5e                   	pop    %esi
+ 305:	5f                   	pop    %edi
+ 306:	5d                   	pop    %ebp
+ 307:	c3                   	ret
+ 308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 310:	83 ec 08             	sub    $0x8,%esp
+ 313:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 316:	50                   	push   %eax
+ 317:	6a 00                	push   $0x0
+ 319:	e8 4d 01 00 00       	call   46b <fstat>
+ 31e:	83 c4 10             	add    $0x10,%esp
+ 321:	89 c2                	mov    %eax,%edx
+ 323:	b8 01 00 00 00       	mov    $0x1,%eax
+ 328:	85 d2                	test   %edx,%edx
+ 32a:	75 0d                	jne    339 <gets+0xe9>
+ 32c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 331:	ba 00 02 00 00       	mov    $0x200,%edx
+ 336:	0f 44 c2             	cmove  %edx,%eax
+ 339:	a3 e8 15 00 00       	mov    %eax,0x15e8
+ 33e:	e9 34 ff ff ff       	jmp    277 <gets+0x27>
+        in.n = 0;
+ 343:	c7 05 e4 15 00 00 00 	movl   $0x0,0x15e4
+ 34a:	00 00 00 
+        break;
+ 34d:	eb ab                	jmp    2fa <gets+0xaa>
+ 34f:	90                   	nop
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <_exit>:
+RAWSYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <_exec>:
+RAWSYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <get_parent_id>:
+SYSCALL(get_parent_id)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <get_children>:
+SYSCALL(get_children)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <set_path>:
+SYSCALL(set_path)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <set_sleep>:
+SYSCALL(set_sleep)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <get_time>:
+SYSCALL(get_time)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <change_process_level>:
+SYSCALL(change_process_level)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 4eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <print_processes_info>:
+SYSCALL(print_processes_info)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 503:	b8 20 00 00 00       	mov    $0x20,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <barrier_wait>:
+SYSCALL(barrier_wait)
+ 50b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 513:	b8 22 00 00 00       	mov    $0x22,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 51b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 523:	b8 24 00 00 00       	mov    $0x24,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 52b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sem_create>:
+SYSCALL(sem_create)
+ 533:	b8 26 00 00 00       	mov    $0x26,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <event_create>:
+SYSCALL(event_create)
+ 53b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sync_post>:
+SYSCALL(sync_post)
+ 543:	b8 28 00 00 00       	mov    $0x28,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sync_wait>:
+SYSCALL(sync_wait)
+ 54b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sync_close>:
+SYSCALL(sync_close)
+ 553:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <event_reset>:
+SYSCALL(event_reset)
+ 55b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 563:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mmap>:
+SYSCALL(mmap)
+ 56b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <munmap>:
+SYSCALL(munmap)
+ 573:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <shmget>:
+SYSCALL(shmget)
+ 57b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <shmat>:
+SYSCALL(shmat)
+ 583:	b8 30 00 00 00       	mov    $0x30,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <shmdt>:
+SYSCALL(shmdt)
+ 58b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <shmrm>:
+SYSCALL(shmrm)
+ 593:	b8 32 00 00 00       	mov    $0x32,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <_spawn>:
+RAWSYSCALL(spawn)
+ 59b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <memstat>:
+SYSCALL(memstat)
+ 5a3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 5b6:	a1 28 18 00 00       	mov    0x1828,%eax
+ 5bb:	85 c0                	test   %eax,%eax
+ 5bd:	7e 17                	jle    5d6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 5bf:	83 ec 04             	sub    $0x4,%esp
+ 5c2:	50                   	push   %eax
+ 5c3:	68 2c 18 00 00       	push   $0x182c
+ 5c8:	ff 35 20 18 00 00    	push   0x1820
+ 5ce:	e8 60 fe ff ff       	call   433 <write>
+ 5d3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 5d6:	c7 05 28 18 00 00 00 	movl   $0x0,0x1828
+ 5dd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 5e0:	c7 05 24 18 00 00 00 	movl   $0x0,0x1824
+ 5e7:	00 00 00 
+}
+ 5ea:	c9                   	leave
+ 5eb:	c3                   	ret
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5f6:	89 d1                	mov    %edx,%ecx
+{
+ 5f8:	56                   	push   %esi
+ 5f9:	53                   	push   %ebx
+ 5fa:	89 c3                	mov    %eax,%ebx
+ 5fc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 5ff:	85 d2                	test   %edx,%edx
+ 601:	0f 89 b9 00 00 00    	jns    6c0 <printint+0xd0>
+ 607:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 60b:	0f 84 af 00 00 00    	je     6c0 <printint+0xd0>
+    x = -xx;
+ 611:	f7 d9                	neg    %ecx
+    neg = 1;
+ 613:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 618:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 61b:	31 f6                	xor    %esi,%esi
+ 61d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 620:	89 c8                	mov    %ecx,%eax
+ 622:	31 d2                	xor    %edx,%edx
+ 624:	89 f3                	mov    %esi,%ebx
+ 626:	f7 f7                	div    %edi
+ 628:	8d 76 01             	lea    0x1(%esi),%esi
+ 62b:	0f b6 92 9c 0f 00 00 	movzbl 0xf9c(%edx),%edx
+ 632:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 636:	89 ca                	mov    %ecx,%edx
+ 638:	89 c1                	mov    %eax,%ecx
+ 63a:	39 fa                	cmp    %edi,%edx
+ 63c:	73 e2                	jae    620 <printint+0x30>
+  if(neg)
+ 63e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 641:	89 d9                	mov    %ebx,%ecx
+ 643:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 646:	85 c0                	test   %eax,%eax
+ 648:	74 07                	je     651 <printint+0x61>
+    buf[i++] = '-';
+ 64a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 64f:	89 f1                	mov    %esi,%ecx
+ 651:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 654:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 656:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 659:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 65c:	01 f7                	add    %esi,%edi
+ 65e:	eb 09                	jmp    669 <printint+0x79>
+
+  while(--i >= 0)
+ 660:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 663:	39 f7                	cmp    %esi,%edi
+ 665:	74 36                	je     69d <printint+0xad>
+ 667:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 669:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 66c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 66f:	8d 42 01             	lea    0x1(%edx),%eax
+ 672:	89 43 08             	mov    %eax,0x8(%ebx)
+ 675:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 679:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 67e:	74 28                	je     6a8 <printint+0xb8>
+ 680:	80 f9 0a             	cmp    $0xa,%cl
+ 683:	75 db                	jne    660 <printint+0x70>
+ 685:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 689:	75 d5                	jne    660 <printint+0x70>
+  if(b->n > 0)
+ 68b:	85 c0                	test   %eax,%eax
+ 68d:	7f 19                	jg     6a8 <printint+0xb8>
+  b->n = 0;
+ 68f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 696:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 699:	39 f7                	cmp    %esi,%edi
+ 69b:	75 ca                	jne    667 <printint+0x77>
+}
+ 69d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a0:	5b                   	pop    %ebx
+ 6a1:	5e                   	pop    %esi
+ 6a2:	5f                   	pop    %edi
+ 6a3:	5d                   	pop    %ebp
+ 6a4:	c3                   	ret
+ 6a5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 6a8:	83 ec 04             	sub    $0x4,%esp
+ 6ab:	50                   	push   %eax
+ 6ac:	ff 75 d4             	push   -0x2c(%ebp)
+ 6af:	ff 33                	push   (%ebx)
+ 6b1:	e8 7d fd ff ff       	call   433 <write>
+ 6b6:	83 c4 10             	add    $0x10,%esp
+ 6b9:	eb d4                	jmp    68f <printint+0x9f>
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  neg = 0;
+ 6c0:	31 c0                	xor    %eax,%eax
+ 6c2:	e9 51 ff ff ff       	jmp    618 <printint+0x28>
+ 6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <putc>:
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	53                   	push   %ebx
+ 6d4:	89 c3                	mov    %eax,%ebx
+ 6d6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 6d9:	8b 48 08             	mov    0x8(%eax),%ecx
+ 6dc:	8d 41 01             	lea    0x1(%ecx),%eax
+ 6df:	89 43 08             	mov    %eax,0x8(%ebx)
+ 6e2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6e6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6eb:	74 33                	je     720 <putc+0x50>
+ 6ed:	80 fa 0a             	cmp    $0xa,%dl
+ 6f0:	74 0e                	je     700 <putc+0x30>
+}
+ 6f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6f5:	c9                   	leave
+ 6f6:	c3                   	ret
+ 6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fe:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 700:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 704:	75 ec                	jne    6f2 <putc+0x22>
+  if(b->n > 0)
+ 706:	85 c0                	test   %eax,%eax
+ 708:	7f 16                	jg     720 <putc+0x50>
+  b->n = 0;
+ 70a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 714:	c9                   	leave
+ 715:	c3                   	ret
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	50                   	push   %eax
+ 724:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 727:	50                   	push   %eax
+ 728:	ff 33                	push   (%ebx)
+ 72a:	e8 04 fd ff ff       	call   433 <write>
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	eb d6                	jmp    70a <putc+0x3a>
+ 734:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+
+00000740 <fflush>:
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 746:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 74a:	74 04                	je     750 <fflush+0x10>
+}
+ 74c:	c9                   	leave
+ 74d:	c3                   	ret
+ 74e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 750:	a1 28 18 00 00       	mov    0x1828,%eax
+ 755:	85 c0                	test   %eax,%eax
+ 757:	7f 17                	jg     770 <fflush+0x30>
+  b->n = 0;
+ 759:	c7 05 28 18 00 00 00 	movl   $0x0,0x1828
+ 760:	00 00 00 
+  out.mode = 0;
+ 763:	c7 05 24 18 00 00 00 	movl   $0x0,0x1824
+ 76a:	00 00 00 
+}
+ 76d:	c9                   	leave
+ 76e:	c3                   	ret
+ 76f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	50                   	push   %eax
+ 774:	68 2c 18 00 00       	push   $0x182c
+ 779:	ff 35 20 18 00 00    	push   0x1820
+ 77f:	e8 af fc ff ff       	call   433 <write>
+ 784:	83 c4 10             	add    $0x10,%esp
+ 787:	eb d0                	jmp    759 <fflush+0x19>
+ 789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 3c             	sub    $0x3c,%esp
+ 799:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 79c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 79f:	83 fe 01             	cmp    $0x1,%esi
+ 7a2:	0f 84 60 01 00 00    	je     908 <printf+0x178>
+    b->fd = fd;
+ 7a8:	89 35 00 16 00 00    	mov    %esi,0x1600
+  for(i = 0; fmt[i]; i++){
+ 7ae:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 7b1:	bf 00 16 00 00       	mov    $0x1600,%edi
+  for(i = 0; fmt[i]; i++){
+ 7b6:	84 c0                	test   %al,%al
+ 7b8:	74 65                	je     81f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 7ba:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7bd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 7c0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 7c2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 7c5:	eb 1f                	jmp    7e6 <printf+0x56>
+ 7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ce:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 7d0:	83 f8 25             	cmp    $0x25,%eax
+ 7d3:	74 3b                	je     810 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 7d5:	89 f8                	mov    %edi,%eax
+ 7d7:	e8 f4 fe ff ff       	call   6d0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 7dc:	0f b6 03             	movzbl (%ebx),%eax
+ 7df:	83 c3 01             	add    $0x1,%ebx
+ 7e2:	84 c0                	test   %al,%al
+ 7e4:	74 39                	je     81f <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 7e6:	0f be d0             	movsbl %al,%edx
+ 7e9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 7ec:	85 f6                	test   %esi,%esi
+ 7ee:	74 e0                	je     7d0 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 7f0:	83 fe 25             	cmp    $0x25,%esi
+ 7f3:	75 e7                	jne    7dc <printf+0x4c>
+      if(c == 'd'){
+ 7f5:	83 f8 25             	cmp    $0x25,%eax
+ 7f8:	74 57                	je     851 <printf+0xc1>
+ 7fa:	83 e8 63             	sub    $0x63,%eax
+ 7fd:	83 f8 15             	cmp    $0x15,%eax
+ 800:	77 36                	ja     838 <printf+0xa8>
+ 802:	ff 24 85 44 0f 00 00 	jmp    *0xf44(,%eax,4)
+ 809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 810:	0f b6 03             	movzbl (%ebx),%eax
+ 813:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 816:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 81b:	84 c0                	test   %al,%al
+ 81d:	75 c7                	jne    7e6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 81f:	8b 47 04             	mov    0x4(%edi),%eax
+ 822:	85 c0                	test   %eax,%eax
+ 824:	0f 84 06 01 00 00    	je     930 <printf+0x1a0>
+    bflush(b);
+}
+ 82a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82d:	5b                   	pop    %ebx
+ 82e:	5e                   	pop    %esi
+ 82f:	5f                   	pop    %edi
+ 830:	5d                   	pop    %ebp
+ 831:	c3                   	ret
+ 832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 838:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 83b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 83e:	89 47 08             	mov    %eax,0x8(%edi)
+ 841:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 846:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 84b:	0f 84 77 01 00 00    	je     9c8 <printf+0x238>
+        putc(b, c);
+ 851:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 853:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 855:	e8 76 fe ff ff       	call   6d0 <putc>
+ 85a:	eb 80                	jmp    7dc <printf+0x4c>
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 860:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 86b:	8b 16                	mov    (%esi),%edx
+ 86d:	6a 00                	push   $0x0
+        ap++;
+ 86f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 872:	89 f8                	mov    %edi,%eax
+ 874:	e8 77 fd ff ff       	call   5f0 <printint>
+        ap++;
+ 879:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 87c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87f:	31 f6                	xor    %esi,%esi
+ 881:	e9 56 ff ff ff       	jmp    7dc <printf+0x4c>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 890:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 893:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 895:	83 c0 04             	add    $0x4,%eax
+ 898:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 89b:	85 c9                	test   %ecx,%ecx
+ 89d:	0f 84 cd 00 00 00    	je     970 <printf+0x1e0>
+        while(*s != 0){
+ 8a3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 8a6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 8a8:	84 d2                	test   %dl,%dl
+ 8aa:	0f 84 2c ff ff ff    	je     7dc <printf+0x4c>
+          putc(b, *s);
+ 8b0:	89 f8                	mov    %edi,%eax
+ 8b2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 8b5:	e8 16 fe ff ff       	call   6d0 <putc>
+          s++;
+ 8ba:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 8bd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 8c1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 8c4:	84 d2                	test   %dl,%dl
+ 8c6:	75 e8                	jne    8b0 <printf+0x120>
+      state = 0;
+ 8c8:	31 f6                	xor    %esi,%esi
+ 8ca:	e9 0d ff ff ff       	jmp    7dc <printf+0x4c>
+ 8cf:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 8d0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8db:	8b 16                	mov    (%esi),%edx
+ 8dd:	6a 01                	push   $0x1
+ 8df:	eb 8e                	jmp    86f <printf+0xdf>
+ 8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 8e8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8eb:	89 f8                	mov    %edi,%eax
+ 8ed:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 8f0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 8f3:	e8 d8 fd ff ff       	call   6d0 <putc>
+        ap++;
+ 8f8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 8fb:	31 f6                	xor    %esi,%esi
+ 8fd:	e9 da fe ff ff       	jmp    7dc <printf+0x4c>
+ 902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 908:	8b 15 24 18 00 00    	mov    0x1824,%edx
+ 90e:	85 d2                	test   %edx,%edx
+ 910:	74 6e                	je     980 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 912:	0f b6 03             	movzbl (%ebx),%eax
+ 915:	bf 20 18 00 00       	mov    $0x1820,%edi
+ 91a:	84 c0                	test   %al,%al
+ 91c:	0f 85 98 fe ff ff    	jne    7ba <printf+0x2a>
+ 922:	e9 03 ff ff ff       	jmp    82a <printf+0x9a>
+ 927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 930:	8b 47 08             	mov    0x8(%edi),%eax
+ 933:	85 c0                	test   %eax,%eax
+ 935:	7f 19                	jg     950 <printf+0x1c0>
+  b->n = 0;
+ 937:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 93e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 941:	5b                   	pop    %ebx
+ 942:	5e                   	pop    %esi
+ 943:	5f                   	pop    %edi
+ 944:	5d                   	pop    %ebp
+ 945:	c3                   	ret
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	50                   	push   %eax
+ 954:	8d 47 0c             	lea    0xc(%edi),%eax
+ 957:	50                   	push   %eax
+ 958:	ff 37                	push   (%edi)
+ 95a:	e8 d4 fa ff ff       	call   433 <write>
+  b->n = 0;
+ 95f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ 966:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 969:	eb d3                	jmp    93e <printf+0x1ae>
+ 96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+ 970:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 975:	b9 3d 0f 00 00       	mov    $0xf3d,%ecx
+ 97a:	e9 31 ff ff ff       	jmp    8b0 <printf+0x120>
+ 97f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 980:	83 ec 08             	sub    $0x8,%esp
+ 983:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ 986:	c7 05 20 18 00 00 01 	movl   $0x1,0x1820
+ 98d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 990:	50                   	push   %eax
+ 991:	6a 01                	push   $0x1
+ 993:	e8 d3 fa ff ff       	call   46b <fstat>
+ 998:	83 c4 10             	add    $0x10,%esp
+ 99b:	85 c0                	test   %eax,%eax
+ 99d:	75 22                	jne    9c1 <printf+0x231>
+ 99f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 9a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9a9:	0f 45 f0             	cmovne %eax,%esi
+ 9ac:	89 35 24 18 00 00    	mov    %esi,0x1824
+      stdioflush = flushout;
+ 9b2:	c7 05 c0 13 00 00 b0 	movl   $0x5b0,0x13c0
+ 9b9:	05 00 00 
+ 9bc:	e9 51 ff ff ff       	jmp    912 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 9c1:	be 02 00 00 00       	mov    $0x2,%esi
+ 9c6:	eb e4                	jmp    9ac <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ 9c8:	83 ec 04             	sub    $0x4,%esp
+ 9cb:	8d 47 0c             	lea    0xc(%edi),%eax
+ 9ce:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 9d1:	68 00 02 00 00       	push   $0x200
+ 9d6:	50                   	push   %eax
+ 9d7:	ff 37                	push   (%edi)
+ 9d9:	e8 55 fa ff ff       	call   433 <write>
+  b->n = 0;
+ 9de:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9e5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 9e8:	83 c4 10             	add    $0x10,%esp
+ 9eb:	e9 61 fe ff ff       	jmp    851 <printf+0xc1>
+
+000009f0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	56                   	push   %esi
+ 9f4:	53                   	push   %ebx
+ 9f5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ 9f7:	a1 40 1a 00 00       	mov    0x1a40,%eax
+ 9fc:	39 d8                	cmp    %ebx,%eax
+ 9fe:	0f 83 e4 00 00 00    	jae    ae8 <freepages+0xf8>
+ a04:	85 c0                	test   %eax,%eax
+ a06:	0f 84 dc 00 00 00    	je     ae8 <freepages+0xf8>
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a10:	89 c2                	mov    %eax,%edx
+ a12:	8b 00                	mov    (%eax),%eax
+ a14:	85 c0                	test   %eax,%eax
+ a16:	74 04                	je     a1c <freepages+0x2c>
+ a18:	39 d8                	cmp    %ebx,%eax
+ a1a:	72 f4                	jb     a10 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ a1c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ a1f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ a21:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ a23:	85 c0                	test   %eax,%eax
+ a25:	74 15                	je     a3c <freepages+0x4c>
+    p->prev = s;
+ a27:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ a2a:	8b 73 10             	mov    0x10(%ebx),%esi
+ a2d:	89 f1                	mov    %esi,%ecx
+ a2f:	c1 e1 0c             	shl    $0xc,%ecx
+ a32:	01 d9                	add    %ebx,%ecx
+ a34:	39 c8                	cmp    %ecx,%eax
+ a36:	0f 84 d8 00 00 00    	je     b14 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ a3c:	8b 4a 10             	mov    0x10(%edx),%ecx
+ a3f:	89 c8                	mov    %ecx,%eax
+ a41:	c1 e0 0c             	shl    $0xc,%eax
+ a44:	01 d0                	add    %edx,%eax
+ a46:	39 c3                	cmp    %eax,%ebx
+ a48:	74 16                	je     a60 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a4a:	8b 03                	mov    (%ebx),%eax
+ a4c:	85 c0                	test   %eax,%eax
+ a4e:	74 40                	je     a90 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ a50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a53:	5b                   	pop    %ebx
+ a54:	5e                   	pop    %esi
+ a55:	5d                   	pop    %ebp
+ a56:	c3                   	ret
+ a57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ a60:	03 4b 10             	add    0x10(%ebx),%ecx
+ a63:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ a66:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ a69:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ a6b:	85 c9                	test   %ecx,%ecx
+ a6d:	0f 84 dd 00 00 00    	je     b50 <freepages+0x160>
+    s->prev->next = s->next;
+ a73:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ a75:	85 c0                	test   %eax,%eax
+ a77:	74 06                	je     a7f <freepages+0x8f>
+    s->next->prev = s->prev;
+ a79:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ a7c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a7f:	8b 02                	mov    (%edx),%eax
+ a81:	89 d3                	mov    %edx,%ebx
+ a83:	85 c0                	test   %eax,%eax
+ a85:	75 c9                	jne    a50 <freepages+0x60>
+ a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8e:	66 90                	xchg   %ax,%ax
+ a90:	8b 43 10             	mov    0x10(%ebx),%eax
+ a93:	83 f8 0f             	cmp    $0xf,%eax
+ a96:	76 b8                	jbe    a50 <freepages+0x60>
+ a98:	83 ec 0c             	sub    $0xc,%esp
+ a9b:	c1 e0 0c             	shl    $0xc,%eax
+ a9e:	6a 00                	push   $0x0
+ aa0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ aa3:	e8 f3 f9 ff ff       	call   49b <sbrk>
+ aa8:	83 c4 10             	add    $0x10,%esp
+ aab:	39 c6                	cmp    %eax,%esi
+ aad:	75 a1                	jne    a50 <freepages+0x60>
+  if(s->prev)
+ aaf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ ab2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ ab4:	85 d2                	test   %edx,%edx
+ ab6:	0f 84 a5 00 00 00    	je     b61 <freepages+0x171>
+    s->prev->next = s->next;
+ abc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ abe:	85 c0                	test   %eax,%eax
+ ac0:	74 06                	je     ac8 <freepages+0xd8>
+    s->next->prev = s->prev;
+ ac2:	8b 53 04             	mov    0x4(%ebx),%edx
+ ac5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ ac8:	8b 43 10             	mov    0x10(%ebx),%eax
+ acb:	83 ec 0c             	sub    $0xc,%esp
+ ace:	c1 e0 0c             	shl    $0xc,%eax
+ ad1:	f7 d8                	neg    %eax
+ ad3:	50                   	push   %eax
+ ad4:	e8 c2 f9 ff ff       	call   49b <sbrk>
+ ad9:	83 c4 10             	add    $0x10,%esp
+}
+ adc:	e9 6f ff ff ff       	jmp    a50 <freepages+0x60>
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ ae8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ aef:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ af1:	89 1d 40 1a 00 00    	mov    %ebx,0x1a40
+  if(p)
+ af7:	85 c0                	test   %eax,%eax
+ af9:	74 95                	je     a90 <freepages+0xa0>
+    p->prev = s;
+ afb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ afe:	8b 73 10             	mov    0x10(%ebx),%esi
+ b01:	89 f2                	mov    %esi,%edx
+ b03:	c1 e2 0c             	shl    $0xc,%edx
+ b06:	01 da                	add    %ebx,%edx
+ b08:	39 d0                	cmp    %edx,%eax
+ b0a:	0f 85 3a ff ff ff    	jne    a4a <freepages+0x5a>
+ b10:	89 c1                	mov    %eax,%ecx
+ b12:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ b14:	8b 41 10             	mov    0x10(%ecx),%eax
+ b17:	01 f0                	add    %esi,%eax
+ b19:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ b1c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ b1f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ b21:	85 f6                	test   %esi,%esi
+ b23:	74 35                	je     b5a <freepages+0x16a>
+    s->prev->next = s->next;
+ b25:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ b27:	85 c0                	test   %eax,%eax
+ b29:	74 06                	je     b31 <freepages+0x141>
+    s->next->prev = s->prev;
+ b2b:	8b 49 04             	mov    0x4(%ecx),%ecx
+ b2e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ b31:	85 d2                	test   %edx,%edx
+ b33:	0f 84 11 ff ff ff    	je     a4a <freepages+0x5a>
+ b39:	8b 4a 10             	mov    0x10(%edx),%ecx
+ b3c:	89 c8                	mov    %ecx,%eax
+ b3e:	c1 e0 0c             	shl    $0xc,%eax
+ b41:	01 d0                	add    %edx,%eax
+ b43:	39 c3                	cmp    %eax,%ebx
+ b45:	0f 85 ff fe ff ff    	jne    a4a <freepages+0x5a>
+ b4b:	e9 10 ff ff ff       	jmp    a60 <freepages+0x70>
+    *l = s->next;
+ b50:	a3 40 1a 00 00       	mov    %eax,0x1a40
+ b55:	e9 1b ff ff ff       	jmp    a75 <freepages+0x85>
+ b5a:	a3 40 1a 00 00       	mov    %eax,0x1a40
+ b5f:	eb c6                	jmp    b27 <freepages+0x137>
+ b61:	a3 40 1a 00 00       	mov    %eax,0x1a40
+ b66:	e9 53 ff ff ff       	jmp    abe <freepages+0xce>
+ b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+
+00000b70 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	56                   	push   %esi
+ b74:	53                   	push   %ebx
+ b75:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ b77:	a1 40 1a 00 00       	mov    0x1a40,%eax
+ b7c:	85 c0                	test   %eax,%eax
+ b7e:	74 5e                	je     bde <getpages+0x6e>
+    if(s->npages < n)
+ b80:	8b 50 10             	mov    0x10(%eax),%edx
+ b83:	39 da                	cmp    %ebx,%edx
+ b85:	72 51                	jb     bd8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ b87:	39 d3                	cmp    %edx,%ebx
+ b89:	72 25                	jb     bb0 <getpages+0x40>
+  if(s->prev)
+ b8b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ b8e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ b90:	85 c9                	test   %ecx,%ecx
+ b92:	0f 84 a8 00 00 00    	je     c40 <getpages+0xd0>
+    s->prev->next = s->next;
+ b98:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ b9a:	85 d2                	test   %edx,%edx
+ b9c:	74 06                	je     ba4 <getpages+0x34>
+    s->next->prev = s->prev;
+ b9e:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ ba4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ ba7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ baa:	5b                   	pop    %ebx
+ bab:	5e                   	pop    %esi
+ bac:	5d                   	pop    %ebp
+ bad:	c3                   	ret
+ bae:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ bb0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ bb2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ bb4:	c1 e1 0c             	shl    $0xc,%ecx
+ bb7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ bb9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ bbc:	8b 70 04             	mov    0x4(%eax),%esi
+ bbf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ bc2:	8b 10                	mov    (%eax),%edx
+ bc4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ bc6:	85 f6                	test   %esi,%esi
+ bc8:	74 66                	je     c30 <getpages+0xc0>
+        rest->prev->next = rest;
+ bca:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ bcc:	8b 11                	mov    (%ecx),%edx
+ bce:	85 d2                	test   %edx,%edx
+ bd0:	75 cf                	jne    ba1 <getpages+0x31>
+ bd2:	eb d0                	jmp    ba4 <getpages+0x34>
+ bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ bd8:	8b 00                	mov    (%eax),%eax
+ bda:	85 c0                	test   %eax,%eax
+ bdc:	75 a2                	jne    b80 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ bde:	83 ec 0c             	sub    $0xc,%esp
+ be1:	6a 00                	push   $0x0
+ be3:	e8 b3 f8 ff ff       	call   49b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ be8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ beb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ bf1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bf3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ bf9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bff:	29 d0                	sub    %edx,%eax
+ c01:	c1 e8 0c             	shr    $0xc,%eax
+ c04:	39 d8                	cmp    %ebx,%eax
+ c06:	72 48                	jb     c50 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ c08:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c0a:	89 d8                	mov    %ebx,%eax
+ c0c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c0f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c11:	c1 e0 0c             	shl    $0xc,%eax
+ c14:	01 f0                	add    %esi,%eax
+ c16:	50                   	push   %eax
+ c17:	e8 7f f8 ff ff       	call   49b <sbrk>
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c22:	74 2c                	je     c50 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ c24:	01 f0                	add    %esi,%eax
+ c26:	e9 79 ff ff ff       	jmp    ba4 <getpages+0x34>
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+        runs = rest;
+ c30:	89 0d 40 1a 00 00    	mov    %ecx,0x1a40
+ c36:	eb 96                	jmp    bce <getpages+0x5e>
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+    *l = s->next;
+ c40:	89 15 40 1a 00 00    	mov    %edx,0x1a40
+ c46:	e9 4f ff ff ff       	jmp    b9a <getpages+0x2a>
+ c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+    return 0;
+ c50:	31 c0                	xor    %eax,%eax
+ c52:	e9 50 ff ff ff       	jmp    ba7 <getpages+0x37>
+ c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5e:	66 90                	xchg   %ax,%ax
+
+00000c60 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	53                   	push   %ebx
+ c66:	83 ec 1c             	sub    $0x1c,%esp
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ c6c:	85 c0                	test   %eax,%eax
+ c6e:	0f 84 97 00 00 00    	je     d0b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ c74:	89 c3                	mov    %eax,%ebx
+ c76:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ c7c:	8b 73 14             	mov    0x14(%ebx),%esi
+ c7f:	83 fe 01             	cmp    $0x1,%esi
+ c82:	74 74                	je     cf8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ c84:	85 f6                	test   %esi,%esi
+ c86:	74 5d                	je     ce5 <free+0x85>
+  if(s->free == 0)
+ c88:	8b 53 08             	mov    0x8(%ebx),%edx
+ c8b:	85 d2                	test   %edx,%edx
+ c8d:	0f 84 85 00 00 00    	je     d18 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ c93:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ c95:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ c98:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c9b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ c9e:	8b 04 f5 64 1a 00 00 	mov    0x1a64(,%esi,8),%eax
+  s->inuse--;
+ ca5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ ca8:	83 c0 01             	add    $0x1,%eax
+ cab:	89 04 f5 64 1a 00 00 	mov    %eax,0x1a64(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ cb2:	85 d2                	test   %edx,%edx
+ cb4:	75 55                	jne    d0b <free+0xab>
+ cb6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ cbb:	89 f1                	mov    %esi,%ecx
+ cbd:	d3 ea                	shr    %cl,%edx
+ cbf:	39 c2                	cmp    %eax,%edx
+ cc1:	73 7d                	jae    d40 <free+0xe0>
+  if(s->prev)
+ cc3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ cc6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ cc8:	85 ff                	test   %edi,%edi
+ cca:	0f 84 a0 00 00 00    	je     d70 <free+0x110>
+    s->prev->next = s->next;
+ cd0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ cd2:	85 c9                	test   %ecx,%ecx
+ cd4:	74 06                	je     cdc <free+0x7c>
+    s->next->prev = s->prev;
+ cd6:	8b 7b 04             	mov    0x4(%ebx),%edi
+ cd9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ cdc:	29 d0                	sub    %edx,%eax
+ cde:	89 04 f5 64 1a 00 00 	mov    %eax,0x1a64(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ ce5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ ce8:	89 d8                	mov    %ebx,%eax
+}
+ cea:	5b                   	pop    %ebx
+ ceb:	5e                   	pop    %esi
+ cec:	5f                   	pop    %edi
+ ced:	5d                   	pop    %ebp
+    freepages(s);
+ cee:	e9 fd fc ff ff       	jmp    9f0 <freepages>
+ cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cf7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ cf8:	8b 43 10             	mov    0x10(%ebx),%eax
+ cfb:	83 ec 08             	sub    $0x8,%esp
+ cfe:	c1 e0 0c             	shl    $0xc,%eax
+ d01:	50                   	push   %eax
+ d02:	53                   	push   %ebx
+ d03:	e8 6b f8 ff ff       	call   573 <munmap>
+ d08:	83 c4 10             	add    $0x10,%esp
+}
+ d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d0e:	5b                   	pop    %ebx
+ d0f:	5e                   	pop    %esi
+ d10:	5f                   	pop    %edi
+ d11:	5d                   	pop    %ebp
+ d12:	c3                   	ret
+ d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d17:	90                   	nop
+  s->next = *l;
+ d18:	8b 14 f5 60 1a 00 00 	mov    0x1a60(,%esi,8),%edx
+  s->prev = 0;
+ d1f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ d26:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ d28:	85 d2                	test   %edx,%edx
+ d2a:	74 06                	je     d32 <free+0xd2>
+    (*l)->prev = s;
+ d2c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ d2f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ d32:	89 1c f5 60 1a 00 00 	mov    %ebx,0x1a60(,%esi,8)
+}
+ d39:	e9 55 ff ff ff       	jmp    c93 <free+0x33>
+ d3e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ d40:	83 ec 0c             	sub    $0xc,%esp
+ d43:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ d46:	8b 7b 10             	mov    0x10(%ebx),%edi
+ d49:	6a 00                	push   $0x0
+ d4b:	c1 e7 0c             	shl    $0xc,%edi
+ d4e:	01 df                	add    %ebx,%edi
+ d50:	e8 46 f7 ff ff       	call   49b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d55:	83 c4 10             	add    $0x10,%esp
+ d58:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ d5b:	39 c7                	cmp    %eax,%edi
+ d5d:	75 ac                	jne    d0b <free+0xab>
+ d5f:	8b 04 f5 64 1a 00 00 	mov    0x1a64(,%esi,8),%eax
+ d66:	e9 58 ff ff ff       	jmp    cc3 <free+0x63>
+ d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+    *l = s->next;
+ d70:	89 0c f5 60 1a 00 00 	mov    %ecx,0x1a60(,%esi,8)
+ d77:	e9 56 ff ff ff       	jmp    cd2 <free+0x72>
+ d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d80 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d80:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ d81:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ d86:	89 e5                	mov    %esp,%ebp
+ d88:	57                   	push   %edi
+ d89:	56                   	push   %esi
+ d8a:	53                   	push   %ebx
+ d8b:	83 ec 1c             	sub    $0x1c,%esp
+ d8e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ d91:	83 f8 10             	cmp    $0x10,%eax
+ d94:	0f 86 92 00 00 00    	jbe    e2c <malloc+0xac>
+ d9a:	ba 01 00 00 00       	mov    $0x1,%edx
+ d9f:	eb 13                	jmp    db4 <malloc+0x34>
+ da1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ da8:	89 d3                	mov    %edx,%ebx
+ daa:	d3 e3                	shl    %cl,%ebx
+ dac:	39 c3                	cmp    %eax,%ebx
+ dae:	0f 83 84 00 00 00    	jae    e38 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ db4:	83 c1 01             	add    $0x1,%ecx
+ db7:	83 f9 0b             	cmp    $0xb,%ecx
+ dba:	75 ec                	jne    da8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ dbc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ dc1:	0f 87 c9 00 00 00    	ja     e90 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ dc7:	05 17 10 00 00       	add    $0x1017,%eax
+ dcc:	89 c3                	mov    %eax,%ebx
+ dce:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ dd1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ dd6:	77 28                	ja     e00 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ dd8:	89 d8                	mov    %ebx,%eax
+ dda:	e8 91 fd ff ff       	call   b70 <getpages>
+ ddf:	85 c0                	test   %eax,%eax
+ de1:	0f 84 a9 00 00 00    	je     e90 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ de7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ dee:	83 c0 18             	add    $0x18,%eax
+}
+ df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ df4:	5b                   	pop    %ebx
+ df5:	5e                   	pop    %esi
+ df6:	5f                   	pop    %edi
+ df7:	5d                   	pop    %ebp
+ df8:	c3                   	ret
+ df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ e00:	89 d8                	mov    %ebx,%eax
+ e02:	83 ec 08             	sub    $0x8,%esp
+ e05:	c1 e0 0c             	shl    $0xc,%eax
+ e08:	6a 00                	push   $0x0
+ e0a:	6a ff                	push   $0xffffffff
+ e0c:	6a 22                	push   $0x22
+ e0e:	6a 03                	push   $0x3
+ e10:	50                   	push   %eax
+ e11:	6a 00                	push   $0x0
+ e13:	e8 53 f7 ff ff       	call   56b <mmap>
+    if(s == MAP_FAILED)
+ e18:	83 c4 20             	add    $0x20,%esp
+ e1b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e1e:	74 b8                	je     dd8 <malloc+0x58>
+      s->shift = MAPRUN;
+ e20:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ e27:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ e2a:	eb c2                	jmp    dee <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ e2c:	bb 10 00 00 00       	mov    $0x10,%ebx
+ e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ e38:	8b 34 cd 60 1a 00 00 	mov    0x1a60(,%ecx,8),%esi
+ e3f:	85 f6                	test   %esi,%esi
+ e41:	74 57                	je     e9a <malloc+0x11a>
+  classes[shift].nfree--;
+ e43:	8b 1c cd 64 1a 00 00 	mov    0x1a64(,%ecx,8),%ebx
+  o = s->free;
+ e4a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ e4d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ e50:	89 14 cd 64 1a 00 00 	mov    %edx,0x1a64(,%ecx,8)
+  s->free = NEXTFREE(o);
+ e57:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ e59:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ e5d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ e60:	85 ff                	test   %edi,%edi
+ e62:	75 8d                	jne    df1 <malloc+0x71>
+  if(s->prev)
+ e64:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ e67:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ e69:	85 db                	test   %ebx,%ebx
+ e6b:	0f 84 b7 00 00 00    	je     f28 <malloc+0x1a8>
+    s->prev->next = s->next;
+ e71:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ e73:	85 d2                	test   %edx,%edx
+ e75:	0f 84 76 ff ff ff    	je     df1 <malloc+0x71>
+    s->next->prev = s->prev;
+ e7b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ e7e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ e81:	e9 6b ff ff ff       	jmp    df1 <malloc+0x71>
+ e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e8d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ e93:	31 c0                	xor    %eax,%eax
+}
+ e95:	5b                   	pop    %ebx
+ e96:	5e                   	pop    %esi
+ e97:	5f                   	pop    %edi
+ e98:	5d                   	pop    %ebp
+ e99:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ e9a:	b8 01 00 00 00       	mov    $0x1,%eax
+ e9f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ ea2:	e8 c9 fc ff ff       	call   b70 <getpages>
+ ea7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ eaa:	85 c0                	test   %eax,%eax
+ eac:	89 c2                	mov    %eax,%edx
+ eae:	74 e0                	je     e90 <malloc+0x110>
+    s->shift = shift;
+ eb0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ eb3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ eb5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ ebc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ec1:	89 df                	mov    %ebx,%edi
+ ec3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ ec5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ ec7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ eca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ecd:	83 e8 01             	sub    $0x1,%eax
+ ed0:	d3 e0                	shl    %cl,%eax
+ ed2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ ed5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ed9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ edc:	eb 04                	jmp    ee2 <malloc+0x162>
+ ede:	66 90                	xchg   %ax,%ax
+ ee0:	89 c8                	mov    %ecx,%eax
+ ee2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ ee5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ee7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ eea:	89 c6                	mov    %eax,%esi
+ eec:	39 da                	cmp    %ebx,%edx
+ eee:	7f f0                	jg     ee0 <malloc+0x160>
+ ef0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ ef3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ ef6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ ef9:	8b 04 cd 60 1a 00 00 	mov    0x1a60(,%ecx,8),%eax
+  s->prev = 0;
+ f00:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ f07:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ f09:	85 c0                	test   %eax,%eax
+ f0b:	74 03                	je     f10 <malloc+0x190>
+    (*l)->prev = s;
+ f0d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ f10:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ f13:	89 14 cd 60 1a 00 00 	mov    %edx,0x1a60(,%ecx,8)
+    classes[shift].nfree += n;
+ f1a:	89 d6                	mov    %edx,%esi
+ f1c:	03 1c cd 64 1a 00 00 	add    0x1a64(,%ecx,8),%ebx
+ f23:	e9 22 ff ff ff       	jmp    e4a <malloc+0xca>
+    *l = s->next;
+ f28:	89 14 cd 60 1a 00 00 	mov    %edx,0x1a60(,%ecx,8)
+ f2f:	e9 3f ff ff ff       	jmp    e73 <malloc+0xf3>
@@ -6,88 +6,171 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "mman.h"
 
-char PATH[100][100];
-int num_of_pathes = 0;
+// Commands found by searching a search path (see setpath): the
+// inode that a bare name resolved to, or none, for a given path
+// and current directory. Any change to a directory drops them all.
+struct cmdent {
+  char name[DIRSIZ + 1];  // "" if the entry is free
+  uint pathid;
+  uint cwddev;
+  uint cwdinum;
+  uint dev;
+  uint inum;              // 0: not found
+  uint used;
+};
 
-void add_path(char *path)
+struct {
+  struct spinlock lock;
+  struct cmdent e[NCMDCACHE];
+  uint gen;               // counts invalidations
+  uint clock;
+} cmdcache;
+
+static uint nextpathid;
+
+void cmdcacheinit(void)
+{
+  initlock(&cmdcache.lock, "cmdcache");
+}
+
+// A directory changed: forget every resolved command.
+void cmdinval(void)
+{
+  acquire(&cmdcache.lock);
+  memset(cmdcache.e, 0, sizeof(cmdcache.e));
+  cmdcache.gen++;
+  release(&cmdcache.lock);
+}
+
+// Set the search path of the current process, directories
+// separated by ':'. Its children inherit it.
+int setpath(char *path)
 {
-  char sub_path[100];
-  int i = 0;
-  int j = 0;
-  while (path[i] != '\0')
+  struct proc *curproc = myproc();
+
+  if (strlen(path) >= PATHLEN)
+    return -1;
+  safestrcpy(curproc->path, path, PATHLEN);
+  acquire(&cmdcache.lock);
+  curproc->pathid = ++nextpathid;
+  release(&cmdcache.lock);
+  return 0;
+}
+
+// Look name up from the current directory, then in each
+// directory of the search path of the current process.
+static struct inode *searchpath(char *name)
+{
+  struct proc *curproc = myproc();
+  char cand[PATHLEN + DIRSIZ + 2];
+  struct inode *ip;
+  char *dir, *end;
+  int n;
+
+  if ((ip = namei(name)) != 0)
+    return ip;
+  for (dir = curproc->path; *dir; dir = *end ? end + 1 : end)
   {
-    if (path[i] == ':')
-    {
-      sub_path[j] = '\0';
-      // cprintf(sub_path);
-      j = 0;
-      i++;
-      strncpy(PATH[num_of_pathes++], sub_path, strlen(sub_path));
-      // if (strncmp(PATH[num_of_pathes - 1], "/", 2))
-      // {
-      //   PATH[num_of_pathes - 1][strlen(sub_path)] = '/';
-      //   PATH[num_of_pathes - 1][strlen(sub_path) + 1] = '\0';
-      // }
-      // cprintf("%s \n", PATH[num_of_pathes - 1]);
+    for (end = dir; *end && *end != ':'; end++)
+      ;
+    if ((n = end - dir) == 0)
       continue;
+    memmove(cand, dir, n);
+    if (cand[n - 1] != '/')
+      cand[n++] = '/';
+    safestrcpy(cand + n, name, DIRSIZ + 1);
+    if ((ip = namei(cand)) != 0)
+      return ip;
+  }
+  return 0;
+}
+
+// Return the inode of the program that exec of path runs,
+// or 0. A bare command name is searched for with searchpath
+// and the result cached. Called inside a transaction.
+static struct inode *findcmd(char *path)
+{
+  struct proc *curproc = myproc();
+  struct cmdent *e, *victim;
+  struct inode *ip;
+  char *s;
+  uint gen;
+
+  for (s = path; *s && *s != '/'; s++)
+    ;
+  if (*s || s - path > DIRSIZ)
+    return namei(path);
+
+  acquire(&cmdcache.lock);
+  victim = cmdcache.e;
+  for (e = cmdcache.e; e < &cmdcache.e[NCMDCACHE]; e++)
+  {
+    if (e->name[0] && e->pathid == curproc->pathid &&
+        e->cwddev == curproc->cwd->dev && e->cwdinum == curproc->cwd->inum &&
+        strncmp(e->name, path, DIRSIZ) == 0)
+    {
+      e->used = ++cmdcache.clock;
+      release(&cmdcache.lock);
+      return e->inum ? iget(e->dev, e->inum) : 0;
     }
-    sub_path[j] = path[i];
-    i++;
-    j++;
+    if (victim->name[0] &&
+        (e->name[0] == 0 || cmdcache.clock - e->used > cmdcache.clock - victim->used))
+      victim = e;
   }
-  int k;
-  for (k = 0; k < num_of_pathes; k++)
+  gen = cmdcache.gen;
+  release(&cmdcache.lock);
+
+  ip = searchpath(path);
+
+  acquire(&cmdcache.lock);
+  // Unless a directory changed meanwhile.
+  if (cmdcache.gen == gen)
   {
-    cprintf("%s \n", PATH[k]);
+    safestrcpy(victim->name, path, DIRSIZ + 1);
+    victim->pathid = curproc->pathid;
+    victim->cwddev = curproc->cwd->dev;
+    victim->cwdinum = curproc->cwd->inum;
+    victim->dev = ip ? ip->dev : 0;
+    victim->inum = ip ? ip->inum : 0;
+    victim->used = ++cmdcache.clock;
   }
+  release(&cmdcache.lock);
+  return ip;
 }
 
-int exec(char *path, char **argv)
+// Load the program at path into p, with the argument strings
+// argv on its stack: into the current process for exec(), or
+// into a new process that has no memory yet for spawn().
+// Returns 0, or -1 leaving p as it was.
+//
+// The segments are not read here: each becomes a private file
+// region of p (see vmaload in mmap.c), whose pages are read from
+// the file, or zeroed for the bss, when the program touches them.
+int execinto(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nseg, prot;
   uint argc, sz, sp, ustack[3 + MAXARG + 1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
+  struct proghdr seg[NVMA];
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
-  int success = 0;
+
   begin_op();
-  if ((ip = namei(path)) == 0)
-  {
-    int k;
-    for (k = 0; k < num_of_pathes; k++)
-    {
-      char command[100];
-      strncpy(command, PATH[k], strlen(PATH[k]));
-      int i = 0;
-      while (path[i] != '\0')
-      {
-        command[i + strlen(PATH[k])] = path[i];
-        i++;
-      }
-      command[i + strlen(PATH[k])] = '\0';
-      cprintf("%s \n", command);
-      if ((ip = namei(command)) != 0)
-      {
-        success = 1;
-        break;
-      }
-    }
-  }
-  else
-  {
-    success = 1;
-  }
-  if (!success)
+  if ((ip = findcmd(path)) == 0)
   {
     end_op();
     cprintf("exec: fail\n");
     return -1;
   }
-  ilock(ip);
+  ilockshared(ip);
   pgdir = 0;
 
   // Check ELF header
@@ -99,34 +182,35 @@ int exec(char *path, char **argv)
   if ((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Check the program's segments; they are mapped at commit.
   sz = 0;
+  nseg = 0;
   for (i = 0, off = elf.phoff; i < elf.phnum; i++, off += sizeof(ph))
   {
     if (readi(ip, (char *)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
-    if (ph.type != ELF_PROG_LOAD)
+    if (ph.type != ELF_PROG_LOAD || ph.memsz == 0)
       continue;
     if (ph.memsz < ph.filesz)
       goto bad;
-    if (ph.vaddr + ph.memsz < ph.vaddr)
+    if (ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz > KERNBASE)
       goto bad;
-    if ((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if (ph.vaddr % PGSIZE != 0 || ph.vaddr < sz)
       goto bad;
-    if (ph.vaddr % PGSIZE != 0)
+    if (ph.off + ph.filesz < ph.off || ph.off + ph.filesz > ip->size)
       goto bad;
-    if (loaduvm(pgdir, (char *)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if (nseg == NVMA)
       goto bad;
+    seg[nseg++] = ph;
+    sz = PGROUNDUP(ph.vaddr + ph.memsz);
   }
-  iunlockput(ip);
+  iunlockshared(ip);
   end_op();
-  ip = 0;
 
   // Allocate two pages at the next page boundary.
   // Make the first inaccessible.  Use the second as the user stack.
-  sz = PGROUNDUP(sz);
   if ((sz = allocuvm(pgdir, sz, sz + 2 * PGSIZE)) == 0)
-    goto bad;
+    goto badstack;
   clearpteu(pgdir, (char *)(sz - 2 * PGSIZE));
   sp = sz;
 
@@ -134,10 +218,10 @@ int exec(char *path, char **argv)
   for (argc = 0; argv[argc]; argc++)
   {
     if (argc >= MAXARG)
-      goto bad;
+      goto badstack;
     sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
     if (copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
-      goto bad;
+      goto badstack;
     ustack[3 + argc] = sp;
   }
   ustack[3 + argc] = 0;
@@ -148,33 +232,64 @@ int exec(char *path, char **argv)
 
   sp -= (3 + argc + 1) * 4;
   if (copyout(pgdir, sp, ustack, (3 + argc + 1) * 4) < 0)
-    goto bad;
+    goto badstack;
 
   // Save program name for debugging.
   for (last = s = path; *s; s++)
     if (*s == '/')
       last = s + 1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
+
+  // exec frees all of p's regions at commit; spawn's new
+  // process has none, but check rather than assume.
+  if (p != myproc() && vmaslots(p) < nseg)
+    goto badstack;
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->level = 0;
-  curproc->ticket = 1e5;
-  curproc->tf->eip = elf.entry; // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  oldpgdir = p->pgdir;
+  if (p == myproc())
+    vmaclear(p);
+  for (i = 0; i < nseg; i++)
+  {
+    prot = PROT_READ;
+    if (seg[i].flags & ELF_PROG_FLAG_WRITE)
+      prot |= PROT_WRITE;
+    if (vmaload(p, seg[i].vaddr, PGROUNDUP(seg[i].vaddr + seg[i].memsz),
+                prot, ip, seg[i].off, seg[i].filesz) < 0)
+      panic("execinto: vmaload");
+  }
+  begin_op();
+  iput(ip);
+  end_op();
+  p->pgdir = pgdir;
+  p->sz = sz;
+  p->level = 0;
+  p->ticket = 1e5;
+  p->tf->eip = elf.entry; // main
+  p->tf->esp = sp;
+  if (p == myproc())
+    switchuvm(p);
+  if (oldpgdir)
+    freevm(oldpgdir);
   return 0;
 
 bad:
   if (pgdir)
     freevm(pgdir);
-  if (ip)
-  {
-    iunlockput(ip);
-    end_op();
-  }
+  iunlockshared(ip);
+  iput(ip);
+  end_op();
   return -1;
+
+badstack:
+  freevm(pgdir);
+  begin_op();
+  iput(ip);
+  end_op();
+  return -1;
+}
+
+int exec(char *path, char **argv)
+{
+  return execinto(myproc(), path, argv);
 }
@@ -5,6 +5,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -84,9 +85,9 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
-    iunlock(f->ip);
+    iunlockshared(f->ip);
     return 0;
   }
   return -1;
@@ -96,17 +97,27 @@ filestat(struct file *f, struct stat *st)
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  int r, shared;
 
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    // A shared lock is enough unless f->off is shared with
+    // another process (after fork or dup) or the inode is a
+    // device, whose read routine drops and retakes ip->lock.
+    shared = f->ip->type != T_DEV && f->ref == 1;
+    if(shared)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
-    iunlock(f->ip);
+    if(shared)
+      iunlockshared(f->ip);
+    else
+      iunlock(f->ip);
     return r;
   }
   panic("fileread");
@@ -139,7 +150,10 @@ filewrite(struct file *f, char *addr, int n)
 
       begin_op();
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+      // A running program's text is read from its file.
+      if (f->ip->ntext > 0)
+        r = -1;
+      else if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
         f->off += r;
       iunlock(f->ip);
       end_op();
@@ -14,6 +14,7 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int ntext;          // program segments mapping it; writes fail while > 0
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -0,0 +1,2303 @@
+
+_foo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+  int child_count = argc == 4 ? atoi(argv[1]) : 10;
+      14:	83 39 04             	cmpl   $0x4,(%ecx)
+{
+      17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int child_count = argc == 4 ? atoi(argv[1]) : 10;
+      1a:	0f 84 c3 00 00 00    	je     e3 <main+0xe3>
+  if(child_count > 100) {
+    printf(1, "child count should be less than 100\n");
+    exit();
+  }
+  int for_duration = argc == 4 ? atoi(argv[2]) : 1000000000;
+  int level = argc == 4 ? atoi(argv[3]) : 0;
+      20:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  int child_count = argc == 4 ? atoi(argv[1]) : 10;
+      27:	be 0a 00 00 00       	mov    $0xa,%esi
+  int for_duration = argc == 4 ? atoi(argv[2]) : 1000000000;
+      2c:	bf 00 ca 9a 3b       	mov    $0x3b9aca00,%edi
+  int is_child = 0;
+  for(int i = 0; i < child_count; i++) {
+      31:	31 db                	xor    %ebx,%ebx
+      33:	eb 19                	jmp    4e <main+0x4e>
+      35:	8d 76 00             	lea    0x0(%esi),%esi
+    if(pid == 0) {
+      is_child = 1;
+      break;
+    }
+    else if (pid > 0) {
+      change_process_level(pid, level);
+      38:	83 ec 08             	sub    $0x8,%esp
+      3b:	ff 75 e4             	push   -0x1c(%ebp)
+  for(int i = 0; i < child_count; i++) {
+      3e:	83 c3 01             	add    $0x1,%ebx
+      change_process_level(pid, level);
+      41:	50                   	push   %eax
+      42:	e8 7c 05 00 00       	call   5c3 <change_process_level>
+      47:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0; i < child_count; i++) {
+      4a:	39 f3                	cmp    %esi,%ebx
+      4c:	7d 24                	jge    72 <main+0x72>
+    int pid = fork();
+      4e:	e8 fd 00 00 00       	call   150 <fork>
+    if(pid == 0) {
+      53:	85 c0                	test   %eax,%eax
+      55:	74 5d                	je     b4 <main+0xb4>
+    else if (pid > 0) {
+      57:	7f df                	jg     38 <main+0x38>
+    }
+    else {
+      printf(1, "error forking\n");
+      59:	83 ec 08             	sub    $0x8,%esp
+  for(int i = 0; i < child_count; i++) {
+      5c:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "error forking\n");
+      5f:	68 39 10 00 00       	push   $0x1039
+      64:	6a 01                	push   $0x1
+      66:	e8 05 08 00 00       	call   870 <printf>
+      6b:	83 c4 10             	add    $0x10,%esp
+  for(int i = 0; i < child_count; i++) {
+      6e:	39 f3                	cmp    %esi,%ebx
+      70:	7c dc                	jl     4e <main+0x4e>
+  int is_child = 0;
+      72:	31 d2                	xor    %edx,%edx
+    }
+  }
+  int c = 2;
+      74:	bb 02 00 00 00       	mov    $0x2,%ebx
+  for(int i = 0; i < for_duration; i++)
+      79:	85 ff                	test   %edi,%edi
+      7b:	7f 45                	jg     c2 <main+0xc2>
+    c *= 2;
+  if (is_child == 0) {
+    for(int i = 0; i < child_count; i++) {
+      7d:	31 ff                	xor    %edi,%edi
+      7f:	90                   	nop
+      wait();
+      80:	e8 76 04 00 00       	call   4fb <wait>
+    for(int i = 0; i < child_count; i++) {
+      85:	83 c7 01             	add    $0x1,%edi
+      88:	39 f7                	cmp    %esi,%edi
+      8a:	75 f4                	jne    80 <main+0x80>
+    }
+    int pid = getpid();
+      8c:	e8 e2 04 00 00       	call   573 <getpid>
+    change_process_level(pid, level);
+      91:	52                   	push   %edx
+      92:	52                   	push   %edx
+      93:	ff 75 e4             	push   -0x1c(%ebp)
+      96:	50                   	push   %eax
+      97:	e8 27 05 00 00       	call   5c3 <change_process_level>
+      9c:	83 c4 10             	add    $0x10,%esp
+  }
+
+  printf(1, "%d", c);
+      9f:	83 ec 04             	sub    $0x4,%esp
+      a2:	53                   	push   %ebx
+      a3:	68 48 10 00 00       	push   $0x1048
+      a8:	6a 01                	push   $0x1
+      aa:	e8 c1 07 00 00       	call   870 <printf>
+  exit();
+      af:	e8 cc 00 00 00       	call   180 <exit>
+      is_child = 1;
+      b4:	ba 01 00 00 00       	mov    $0x1,%edx
+  int c = 2;
+      b9:	bb 02 00 00 00       	mov    $0x2,%ebx
+  for(int i = 0; i < for_duration; i++)
+      be:	85 ff                	test   %edi,%edi
+      c0:	7e dd                	jle    9f <main+0x9f>
+      c2:	31 c0                	xor    %eax,%eax
+  int c = 2;
+      c4:	bb 02 00 00 00       	mov    $0x2,%ebx
+      c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(int i = 0; i < for_duration; i++)
+      d0:	83 c0 01             	add    $0x1,%eax
+    c *= 2;
+      d3:	01 db                	add    %ebx,%ebx
+  for(int i = 0; i < for_duration; i++)
+      d5:	39 f8                	cmp    %edi,%eax
+      d7:	7c f7                	jl     d0 <main+0xd0>
+  if (is_child == 0) {
+      d9:	85 d2                	test   %edx,%edx
+      db:	75 c2                	jne    9f <main+0x9f>
+    for(int i = 0; i < child_count; i++) {
+      dd:	85 f6                	test   %esi,%esi
+      df:	7f 9c                	jg     7d <main+0x7d>
+      e1:	eb a9                	jmp    8c <main+0x8c>
+  int child_count = argc == 4 ? atoi(argv[1]) : 10;
+      e3:	83 ec 0c             	sub    $0xc,%esp
+      e6:	ff 73 04             	push   0x4(%ebx)
+      e9:	e8 92 03 00 00       	call   480 <atoi>
+  if(child_count > 100) {
+      ee:	83 c4 10             	add    $0x10,%esp
+  int child_count = argc == 4 ? atoi(argv[1]) : 10;
+      f1:	89 c6                	mov    %eax,%esi
+  if(child_count > 100) {
+      f3:	83 f8 64             	cmp    $0x64,%eax
+      f6:	7f 2c                	jg     124 <main+0x124>
+  int for_duration = argc == 4 ? atoi(argv[2]) : 1000000000;
+      f8:	83 ec 0c             	sub    $0xc,%esp
+      fb:	ff 73 08             	push   0x8(%ebx)
+      fe:	e8 7d 03 00 00       	call   480 <atoi>
+  int level = argc == 4 ? atoi(argv[3]) : 0;
+     103:	59                   	pop    %ecx
+     104:	ff 73 0c             	push   0xc(%ebx)
+  int for_duration = argc == 4 ? atoi(argv[2]) : 1000000000;
+     107:	89 c7                	mov    %eax,%edi
+  int level = argc == 4 ? atoi(argv[3]) : 0;
+     109:	e8 72 03 00 00       	call   480 <atoi>
+  for(int i = 0; i < child_count; i++) {
+     10e:	83 c4 10             	add    $0x10,%esp
+  int level = argc == 4 ? atoi(argv[3]) : 0;
+     111:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(int i = 0; i < child_count; i++) {
+     114:	85 f6                	test   %esi,%esi
+     116:	0f 8f 15 ff ff ff    	jg     31 <main+0x31>
+  for(int i = 0; i < for_duration; i++)
+     11c:	85 ff                	test   %edi,%edi
+     11e:	7e 17                	jle    137 <main+0x137>
+  int is_child = 0;
+     120:	31 d2                	xor    %edx,%edx
+     122:	eb 9e                	jmp    c2 <main+0xc2>
+    printf(1, "child count should be less than 100\n");
+     124:	53                   	push   %ebx
+     125:	53                   	push   %ebx
+     126:	68 14 10 00 00       	push   $0x1014
+     12b:	6a 01                	push   $0x1
+     12d:	e8 3e 07 00 00       	call   870 <printf>
+    exit();
+     132:	e8 49 00 00 00       	call   180 <exit>
+  int c = 2;
+     137:	bb 02 00 00 00       	mov    $0x2,%ebx
+     13c:	e9 4b ff ff ff       	jmp    8c <main+0x8c>
+     141:	66 90                	xchg   %ax,%ax
+     143:	66 90                	xchg   %ax,%ax
+     145:	66 90                	xchg   %ax,%ax
+     147:	66 90                	xchg   %ax,%ax
+     149:	66 90                	xchg   %ax,%ax
+     14b:	66 90                	xchg   %ax,%ax
+     14d:	66 90                	xchg   %ax,%ax
+     14f:	90                   	nop
+
+00000150 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     150:	a1 e0 14 00 00       	mov    0x14e0,%eax
+     155:	85 c0                	test   %eax,%eax
+     157:	74 17                	je     170 <fork+0x20>
+{
+     159:	55                   	push   %ebp
+     15a:	89 e5                	mov    %esp,%ebp
+     15c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     15f:	ff d0                	call   *%eax
+  return _fork();
+}
+     161:	c9                   	leave
+  return _fork();
+     162:	e9 84 03 00 00       	jmp    4eb <_fork>
+     167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16e:	66 90                	xchg   %ax,%ax
+     170:	e9 76 03 00 00       	jmp    4eb <_fork>
+     175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <exit>:
+
+int
+exit(void)
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     186:	a1 e0 14 00 00       	mov    0x14e0,%eax
+     18b:	85 c0                	test   %eax,%eax
+     18d:	74 02                	je     191 <exit+0x11>
+    stdioflush();
+     18f:	ff d0                	call   *%eax
+  _exit();
+     191:	e8 5d 03 00 00       	call   4f3 <_exit>
+     196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     1a0:	55                   	push   %ebp
+  if(stdioflush)
+     1a1:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+     1a6:	89 e5                	mov    %esp,%ebp
+     1a8:	56                   	push   %esi
+     1a9:	53                   	push   %ebx
+     1aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     1b0:	85 c0                	test   %eax,%eax
+     1b2:	74 02                	je     1b6 <exec+0x16>
+    stdioflush();
+     1b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     1b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1bc:	5b                   	pop    %ebx
+     1bd:	5e                   	pop    %esi
+     1be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     1bf:	e9 67 03 00 00       	jmp    52b <_exec>
+     1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	57                   	push   %edi
+     1d4:	56                   	push   %esi
+     1d5:	53                   	push   %ebx
+     1d6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     1d9:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+     1de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     1e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     1e7:	85 c0                	test   %eax,%eax
+     1e9:	74 02                	je     1ed <spawn+0x1d>
+    stdioflush();
+     1eb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     1ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+     1f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1f6:	83 c4 0c             	add    $0xc,%esp
+     1f9:	5b                   	pop    %ebx
+     1fa:	5e                   	pop    %esi
+     1fb:	5f                   	pop    %edi
+     1fc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     1fd:	e9 79 04 00 00       	jmp    67b <_spawn>
+     202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     211:	31 c0                	xor    %eax,%eax
+{
+     213:	89 e5                	mov    %esp,%ebp
+     215:	53                   	push   %ebx
+     216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     227:	83 c0 01             	add    $0x1,%eax
+     22a:	84 d2                	test   %dl,%dl
+     22c:	75 f2                	jne    220 <strcpy+0x10>
+    ;
+  return os;
+}
+     22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     231:	89 c8                	mov    %ecx,%eax
+     233:	c9                   	leave
+     234:	c3                   	ret
+     235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	53                   	push   %ebx
+     244:	8b 55 08             	mov    0x8(%ebp),%edx
+     247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     24a:	0f b6 02             	movzbl (%edx),%eax
+     24d:	84 c0                	test   %al,%al
+     24f:	75 17                	jne    268 <strcmp+0x28>
+     251:	eb 3a                	jmp    28d <strcmp+0x4d>
+     253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     257:	90                   	nop
+     258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     25c:	83 c2 01             	add    $0x1,%edx
+     25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     262:	84 c0                	test   %al,%al
+     264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+     266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     268:	0f b6 19             	movzbl (%ecx),%ebx
+     26b:	38 c3                	cmp    %al,%bl
+     26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     26f:	29 d8                	sub    %ebx,%eax
+}
+     271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     274:	c9                   	leave
+     275:	c3                   	ret
+     276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     284:	31 c0                	xor    %eax,%eax
+     286:	29 d8                	sub    %ebx,%eax
+}
+     288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     28b:	c9                   	leave
+     28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     28d:	0f b6 19             	movzbl (%ecx),%ebx
+     290:	31 c0                	xor    %eax,%eax
+     292:	eb db                	jmp    26f <strcmp+0x2f>
+     294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     29f:	90                   	nop
+
+000002a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2a6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2a9:	74 15                	je     2c0 <strlen+0x20>
+     2ab:	31 c0                	xor    %eax,%eax
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+     2b0:	83 c0 01             	add    $0x1,%eax
+     2b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2b7:	89 c1                	mov    %eax,%ecx
+     2b9:	75 f5                	jne    2b0 <strlen+0x10>
+    ;
+  return n;
+}
+     2bb:	89 c8                	mov    %ecx,%eax
+     2bd:	5d                   	pop    %ebp
+     2be:	c3                   	ret
+     2bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2c0:	31 c9                	xor    %ecx,%ecx
+}
+     2c2:	5d                   	pop    %ebp
+     2c3:	89 c8                	mov    %ecx,%eax
+     2c5:	c3                   	ret
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	57                   	push   %edi
+     2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2dd:	89 d7                	mov    %edx,%edi
+     2df:	fc                   	cld
+     2e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2e5:	89 d0                	mov    %edx,%eax
+     2e7:	c9                   	leave
+     2e8:	c3                   	ret
+     2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2fa:	0f b6 10             	movzbl (%eax),%edx
+     2fd:	84 d2                	test   %dl,%dl
+     2ff:	75 12                	jne    313 <strchr+0x23>
+     301:	eb 1d                	jmp    320 <strchr+0x30>
+     303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     307:	90                   	nop
+     308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     30c:	83 c0 01             	add    $0x1,%eax
+     30f:	84 d2                	test   %dl,%dl
+     311:	74 0d                	je     320 <strchr+0x30>
+    if(*s == c)
+     313:	38 d1                	cmp    %dl,%cl
+     315:	75 f1                	jne    308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     317:	5d                   	pop    %ebp
+     318:	c3                   	ret
+     319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     320:	31 c0                	xor    %eax,%eax
+}
+     322:	5d                   	pop    %ebp
+     323:	c3                   	ret
+     324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     32f:	90                   	nop
+
+00000330 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	57                   	push   %edi
+     334:	56                   	push   %esi
+     335:	53                   	push   %ebx
+     336:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     339:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+     33e:	8b 75 08             	mov    0x8(%ebp),%esi
+     341:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     344:	85 c0                	test   %eax,%eax
+     346:	74 02                	je     34a <gets+0x1a>
+    stdioflush();
+     348:	ff d0                	call   *%eax
+  if(in.size == 0)
+     34a:	a1 08 17 00 00       	mov    0x1708,%eax
+     34f:	85 c0                	test   %eax,%eax
+     351:	0f 84 99 00 00 00    	je     3f0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     357:	31 db                	xor    %ebx,%ebx
+     359:	eb 21                	jmp    37c <gets+0x4c>
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     360:	8d 50 01             	lea    0x1(%eax),%edx
+     363:	0f b6 80 00 15 00 00 	movzbl 0x1500(%eax),%eax
+     36a:	89 15 00 17 00 00    	mov    %edx,0x1700
+    buf[i++] = c;
+     370:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     374:	3c 0a                	cmp    $0xa,%al
+     376:	74 60                	je     3d8 <gets+0xa8>
+     378:	3c 0d                	cmp    $0xd,%al
+     37a:	74 5c                	je     3d8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     37c:	89 da                	mov    %ebx,%edx
+     37e:	83 c3 01             	add    $0x1,%ebx
+     381:	39 fb                	cmp    %edi,%ebx
+     383:	7d 55                	jge    3da <gets+0xaa>
+    if(in.r == in.n){
+     385:	a1 00 17 00 00       	mov    0x1700,%eax
+     38a:	3b 05 04 17 00 00    	cmp    0x1704,%eax
+     390:	75 ce                	jne    360 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     392:	83 ec 04             	sub    $0x4,%esp
+     395:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     398:	c7 05 04 17 00 00 00 	movl   $0x0,0x1704
+     39f:	00 00 00 
+     3a2:	c7 05 00 17 00 00 00 	movl   $0x0,0x1700
+     3a9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3ac:	ff 35 08 17 00 00    	push   0x1708
+     3b2:	68 00 15 00 00       	push   $0x1500
+     3b7:	6a 00                	push   $0x0
+     3b9:	e8 4d 01 00 00       	call   50b <read>
+     3be:	83 c4 10             	add    $0x10,%esp
+     3c1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     3c4:	85 c0                	test   %eax,%eax
+     3c6:	a3 04 17 00 00       	mov    %eax,0x1704
+     3cb:	7e 56                	jle    423 <gets+0xf3>
+    c = in.buf[in.r++];
+     3cd:	a1 00 17 00 00       	mov    0x1700,%eax
+     3d2:	eb 8c                	jmp    360 <gets+0x30>
+     3d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     3d8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     3da:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     3de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3e1:	89 f0                	mov    %esi,%eax
+     3e3:	5b                   	pop    %ebx
+     3e4:	5e                   	pop    %esi
+     3e5:	5f                   	pop    %edi
+     3e6:	5d                   	pop    %ebp
+     3e7:	c3                   	ret
+     3e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     3f0:	83 ec 08             	sub    $0x8,%esp
+     3f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3f6:	50                   	push   %eax
+     3f7:	6a 00                	push   $0x0
+     3f9:	e8 4d 01 00 00       	call   54b <fstat>
+     3fe:	83 c4 10             	add    $0x10,%esp
+     401:	89 c2                	mov    %eax,%edx
+     403:	b8 01 00 00 00       	mov    $0x1,%eax
+     408:	85 d2                	test   %edx,%edx
+     40a:	75 0d                	jne    419 <gets+0xe9>
+     40c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     411:	ba 00 02 00 00       	mov    $0x200,%edx
+     416:	0f 44 c2             	cmove  %edx,%eax
+     419:	a3 08 17 00 00       	mov    %eax,0x1708
+     41e:	e9 34 ff ff ff       	jmp    357 <gets+0x27>
+        in.n = 0;
+     423:	c7 05 04 17 00 00 00 	movl   $0x0,0x1704
+     42a:	00 00 00 
+        break;
+     42d:	eb ab                	jmp    3da <gets+0xaa>
+     42f:	90                   	nop
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	56                   	push   %esi
+     434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     435:	83 ec 08             	sub    $0x8,%esp
+     438:	6a 00                	push   $0x0
+     43a:	ff 75 08             	push   0x8(%ebp)
+     43d:	e8 f1 00 00 00       	call   533 <open>
+  if(fd < 0)
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	ff 75 0c             	push   0xc(%ebp)
+     44f:	89 c3                	mov    %eax,%ebx
+     451:	50                   	push   %eax
+     452:	e8 f4 00 00 00       	call   54b <fstat>
+  close(fd);
+     457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     45c:	e8 ba 00 00 00       	call   51b <close>
+  return r;
+     461:	83 c4 10             	add    $0x10,%esp
+}
+     464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     467:	89 f0                	mov    %esi,%eax
+     469:	5b                   	pop    %ebx
+     46a:	5e                   	pop    %esi
+     46b:	5d                   	pop    %ebp
+     46c:	c3                   	ret
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     475:	eb ed                	jmp    464 <stat+0x34>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	53                   	push   %ebx
+     484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     487:	0f be 02             	movsbl (%edx),%eax
+     48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     495:	77 1e                	ja     4b5 <atoi+0x35>
+     497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4a0:	83 c2 01             	add    $0x1,%edx
+     4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4aa:	0f be 02             	movsbl (%edx),%eax
+     4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4b0:	80 fb 09             	cmp    $0x9,%bl
+     4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+     4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4b8:	89 c8                	mov    %ecx,%eax
+     4ba:	c9                   	leave
+     4bb:	c3                   	ret
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+     4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     4ce:	85 c0                	test   %eax,%eax
+     4d0:	7e 13                	jle    4e5 <memmove+0x25>
+     4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4d4:	89 d7                	mov    %edx,%edi
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4e1:	39 f8                	cmp    %edi,%eax
+     4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+     4e5:	5e                   	pop    %esi
+     4e6:	89 d0                	mov    %edx,%eax
+     4e8:	5f                   	pop    %edi
+     4e9:	5d                   	pop    %ebp
+     4ea:	c3                   	ret
+
+000004eb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     4eb:	b8 01 00 00 00       	mov    $0x1,%eax
+     4f0:	cd 40                	int    $0x40
+     4f2:	c3                   	ret
+
+000004f3 <_exit>:
+RAWSYSCALL(exit)
+     4f3:	b8 02 00 00 00       	mov    $0x2,%eax
+     4f8:	cd 40                	int    $0x40
+     4fa:	c3                   	ret
+
+000004fb <wait>:
+SYSCALL(wait)
+     4fb:	b8 03 00 00 00       	mov    $0x3,%eax
+     500:	cd 40                	int    $0x40
+     502:	c3                   	ret
+
+00000503 <pipe>:
+SYSCALL(pipe)
+     503:	b8 04 00 00 00       	mov    $0x4,%eax
+     508:	cd 40                	int    $0x40
+     50a:	c3                   	ret
+
+0000050b <read>:
+SYSCALL(read)
+     50b:	b8 05 00 00 00       	mov    $0x5,%eax
+     510:	cd 40                	int    $0x40
+     512:	c3                   	ret
+
+00000513 <write>:
+SYSCALL(write)
+     513:	b8 10 00 00 00       	mov    $0x10,%eax
+     518:	cd 40                	int    $0x40
+     51a:	c3                   	ret
+
+0000051b <close>:
+SYSCALL(close)
+     51b:	b8 15 00 00 00       	mov    $0x15,%eax
+     520:	cd 40                	int    $0x40
+     522:	c3                   	ret
+
+00000523 <kill>:
+SYSCALL(kill)
+     523:	b8 06 00 00 00       	mov    $0x6,%eax
+     528:	cd 40                	int    $0x40
+     52a:	c3                   	ret
+
+0000052b <_exec>:
+RAWSYSCALL(exec)
+     52b:	b8 07 00 00 00       	mov    $0x7,%eax
+     530:	cd 40                	int    $0x40
+     532:	c3                   	ret
+
+00000533 <open>:
+SYSCALL(open)
+     533:	b8 0f 00 00 00       	mov    $0xf,%eax
+     538:	cd 40                	int    $0x40
+     53a:	c3                   	ret
+
+0000053b <mknod>:
+SYSCALL(mknod)
+     53b:	b8 11 00 00 00       	mov    $0x11,%eax
+     540:	cd 40                	int    $0x40
+     542:	c3                   	ret
+
+00000543 <unlink>:
+SYSCALL(unlink)
+     543:	b8 12 00 00 00       	mov    $0x12,%eax
+     548:	cd 40                	int    $0x40
+     54a:	c3                   	ret
+
+0000054b <fstat>:
+SYSCALL(fstat)
+     54b:	b8 08 00 00 00       	mov    $0x8,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <link>:
+SYSCALL(link)
+     553:	b8 13 00 00 00       	mov    $0x13,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <mkdir>:
+SYSCALL(mkdir)
+     55b:	b8 14 00 00 00       	mov    $0x14,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <chdir>:
+SYSCALL(chdir)
+     563:	b8 09 00 00 00       	mov    $0x9,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <dup>:
+SYSCALL(dup)
+     56b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <getpid>:
+SYSCALL(getpid)
+     573:	b8 0b 00 00 00       	mov    $0xb,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <sbrk>:
+SYSCALL(sbrk)
+     57b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <sleep>:
+SYSCALL(sleep)
+     583:	b8 0d 00 00 00       	mov    $0xd,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <uptime>:
+SYSCALL(uptime)
+     58b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     593:	b8 16 00 00 00       	mov    $0x16,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <get_parent_id>:
+SYSCALL(get_parent_id)
+     59b:	b8 17 00 00 00       	mov    $0x17,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <get_children>:
+SYSCALL(get_children)
+     5a3:	b8 18 00 00 00       	mov    $0x18,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <set_path>:
+SYSCALL(set_path)
+     5ab:	b8 19 00 00 00       	mov    $0x19,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <set_sleep>:
+SYSCALL(set_sleep)
+     5b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <get_time>:
+SYSCALL(get_time)
+     5bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <change_process_level>:
+SYSCALL(change_process_level)
+     5c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     5cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     5d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <print_processes_info>:
+SYSCALL(print_processes_info)
+     5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <barrier_init>:
+
+SYSCALL(barrier_init)
+     5e3:	b8 20 00 00 00       	mov    $0x20,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <barrier_wait>:
+SYSCALL(barrier_wait)
+     5eb:	b8 21 00 00 00       	mov    $0x21,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     5f3:	b8 22 00 00 00       	mov    $0x22,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     5fb:	b8 23 00 00 00       	mov    $0x23,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <set_process_gang>:
+SYSCALL(set_process_gang)
+     603:	b8 24 00 00 00       	mov    $0x24,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     60b:	b8 25 00 00 00       	mov    $0x25,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <sem_create>:
+SYSCALL(sem_create)
+     613:	b8 26 00 00 00       	mov    $0x26,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <event_create>:
+SYSCALL(event_create)
+     61b:	b8 27 00 00 00       	mov    $0x27,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <sync_post>:
+SYSCALL(sync_post)
+     623:	b8 28 00 00 00       	mov    $0x28,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <sync_wait>:
+SYSCALL(sync_wait)
+     62b:	b8 29 00 00 00       	mov    $0x29,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <sync_close>:
+SYSCALL(sync_close)
+     633:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <event_reset>:
+SYSCALL(event_reset)
+     63b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     643:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <mmap>:
+SYSCALL(mmap)
+     64b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <munmap>:
+SYSCALL(munmap)
+     653:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <shmget>:
+SYSCALL(shmget)
+     65b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <shmat>:
+SYSCALL(shmat)
+     663:	b8 30 00 00 00       	mov    $0x30,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <shmdt>:
+SYSCALL(shmdt)
+     66b:	b8 31 00 00 00       	mov    $0x31,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <shmrm>:
+SYSCALL(shmrm)
+     673:	b8 32 00 00 00       	mov    $0x32,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+
+0000067b <_spawn>:
+RAWSYSCALL(spawn)
+     67b:	b8 33 00 00 00       	mov    $0x33,%eax
+     680:	cd 40                	int    $0x40
+     682:	c3                   	ret
+
+00000683 <memstat>:
+SYSCALL(memstat)
+     683:	b8 34 00 00 00       	mov    $0x34,%eax
+     688:	cd 40                	int    $0x40
+     68a:	c3                   	ret
+     68b:	66 90                	xchg   %ax,%ax
+     68d:	66 90                	xchg   %ax,%ax
+     68f:	90                   	nop
+
+00000690 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     696:	a1 48 19 00 00       	mov    0x1948,%eax
+     69b:	85 c0                	test   %eax,%eax
+     69d:	7e 17                	jle    6b6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     69f:	83 ec 04             	sub    $0x4,%esp
+     6a2:	50                   	push   %eax
+     6a3:	68 4c 19 00 00       	push   $0x194c
+     6a8:	ff 35 40 19 00 00    	push   0x1940
+     6ae:	e8 60 fe ff ff       	call   513 <write>
+     6b3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     6b6:	c7 05 48 19 00 00 00 	movl   $0x0,0x1948
+     6bd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     6c0:	c7 05 44 19 00 00 00 	movl   $0x0,0x1944
+     6c7:	00 00 00 
+}
+     6ca:	c9                   	leave
+     6cb:	c3                   	ret
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6d6:	89 d1                	mov    %edx,%ecx
+{
+     6d8:	56                   	push   %esi
+     6d9:	53                   	push   %ebx
+     6da:	89 c3                	mov    %eax,%ebx
+     6dc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     6df:	85 d2                	test   %edx,%edx
+     6e1:	0f 89 b9 00 00 00    	jns    7a0 <printint+0xd0>
+     6e7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     6eb:	0f 84 af 00 00 00    	je     7a0 <printint+0xd0>
+    x = -xx;
+     6f1:	f7 d9                	neg    %ecx
+    neg = 1;
+     6f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     6f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     6fb:	31 f6                	xor    %esi,%esi
+     6fd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     700:	89 c8                	mov    %ecx,%eax
+     702:	31 d2                	xor    %edx,%edx
+     704:	89 f3                	mov    %esi,%ebx
+     706:	f7 f7                	div    %edi
+     708:	8d 76 01             	lea    0x1(%esi),%esi
+     70b:	0f b6 92 ac 10 00 00 	movzbl 0x10ac(%edx),%edx
+     712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     716:	89 ca                	mov    %ecx,%edx
+     718:	89 c1                	mov    %eax,%ecx
+     71a:	39 fa                	cmp    %edi,%edx
+     71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+     71e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     721:	89 d9                	mov    %ebx,%ecx
+     723:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     726:	85 c0                	test   %eax,%eax
+     728:	74 07                	je     731 <printint+0x61>
+    buf[i++] = '-';
+     72a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     72f:	89 f1                	mov    %esi,%ecx
+     731:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     734:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     736:	8d 43 0c             	lea    0xc(%ebx),%eax
+     739:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     73c:	01 f7                	add    %esi,%edi
+     73e:	eb 09                	jmp    749 <printint+0x79>
+
+  while(--i >= 0)
+     740:	8d 47 ff             	lea    -0x1(%edi),%eax
+     743:	39 f7                	cmp    %esi,%edi
+     745:	74 36                	je     77d <printint+0xad>
+     747:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     749:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     74c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     74f:	8d 42 01             	lea    0x1(%edx),%eax
+     752:	89 43 08             	mov    %eax,0x8(%ebx)
+     755:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     759:	3d 00 02 00 00       	cmp    $0x200,%eax
+     75e:	74 28                	je     788 <printint+0xb8>
+     760:	80 f9 0a             	cmp    $0xa,%cl
+     763:	75 db                	jne    740 <printint+0x70>
+     765:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     769:	75 d5                	jne    740 <printint+0x70>
+  if(b->n > 0)
+     76b:	85 c0                	test   %eax,%eax
+     76d:	7f 19                	jg     788 <printint+0xb8>
+  b->n = 0;
+     76f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     776:	8d 47 ff             	lea    -0x1(%edi),%eax
+     779:	39 f7                	cmp    %esi,%edi
+     77b:	75 ca                	jne    747 <printint+0x77>
+}
+     77d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     780:	5b                   	pop    %ebx
+     781:	5e                   	pop    %esi
+     782:	5f                   	pop    %edi
+     783:	5d                   	pop    %ebp
+     784:	c3                   	ret
+     785:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     788:	83 ec 04             	sub    $0x4,%esp
+     78b:	50                   	push   %eax
+     78c:	ff 75 d4             	push   -0x2c(%ebp)
+     78f:	ff 33                	push   (%ebx)
+     791:	e8 7d fd ff ff       	call   513 <write>
+     796:	83 c4 10             	add    $0x10,%esp
+     799:	eb d4                	jmp    76f <printint+0x9f>
+     79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+  neg = 0;
+     7a0:	31 c0                	xor    %eax,%eax
+     7a2:	e9 51 ff ff ff       	jmp    6f8 <printint+0x28>
+     7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <putc>:
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	53                   	push   %ebx
+     7b4:	89 c3                	mov    %eax,%ebx
+     7b6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     7b9:	8b 48 08             	mov    0x8(%eax),%ecx
+     7bc:	8d 41 01             	lea    0x1(%ecx),%eax
+     7bf:	89 43 08             	mov    %eax,0x8(%ebx)
+     7c2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7cb:	74 33                	je     800 <putc+0x50>
+     7cd:	80 fa 0a             	cmp    $0xa,%dl
+     7d0:	74 0e                	je     7e0 <putc+0x30>
+}
+     7d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7d5:	c9                   	leave
+     7d6:	c3                   	ret
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7e0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     7e4:	75 ec                	jne    7d2 <putc+0x22>
+  if(b->n > 0)
+     7e6:	85 c0                	test   %eax,%eax
+     7e8:	7f 16                	jg     800 <putc+0x50>
+  b->n = 0;
+     7ea:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     7f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7f4:	c9                   	leave
+     7f5:	c3                   	ret
+     7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     800:	83 ec 04             	sub    $0x4,%esp
+     803:	50                   	push   %eax
+     804:	8d 43 0c             	lea    0xc(%ebx),%eax
+     807:	50                   	push   %eax
+     808:	ff 33                	push   (%ebx)
+     80a:	e8 04 fd ff ff       	call   513 <write>
+     80f:	83 c4 10             	add    $0x10,%esp
+     812:	eb d6                	jmp    7ea <putc+0x3a>
+     814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+
+00000820 <fflush>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     826:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     82a:	74 04                	je     830 <fflush+0x10>
+}
+     82c:	c9                   	leave
+     82d:	c3                   	ret
+     82e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     830:	a1 48 19 00 00       	mov    0x1948,%eax
+     835:	85 c0                	test   %eax,%eax
+     837:	7f 17                	jg     850 <fflush+0x30>
+  b->n = 0;
+     839:	c7 05 48 19 00 00 00 	movl   $0x0,0x1948
+     840:	00 00 00 
+  out.mode = 0;
+     843:	c7 05 44 19 00 00 00 	movl   $0x0,0x1944
+     84a:	00 00 00 
+}
+     84d:	c9                   	leave
+     84e:	c3                   	ret
+     84f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     850:	83 ec 04             	sub    $0x4,%esp
+     853:	50                   	push   %eax
+     854:	68 4c 19 00 00       	push   $0x194c
+     859:	ff 35 40 19 00 00    	push   0x1940
+     85f:	e8 af fc ff ff       	call   513 <write>
+     864:	83 c4 10             	add    $0x10,%esp
+     867:	eb d0                	jmp    839 <fflush+0x19>
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	57                   	push   %edi
+     874:	56                   	push   %esi
+     875:	53                   	push   %ebx
+     876:	83 ec 3c             	sub    $0x3c,%esp
+     879:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     87c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     87f:	83 fe 01             	cmp    $0x1,%esi
+     882:	0f 84 60 01 00 00    	je     9e8 <printf+0x178>
+    b->fd = fd;
+     888:	89 35 20 17 00 00    	mov    %esi,0x1720
+  for(i = 0; fmt[i]; i++){
+     88e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     891:	bf 20 17 00 00       	mov    $0x1720,%edi
+  for(i = 0; fmt[i]; i++){
+     896:	84 c0                	test   %al,%al
+     898:	74 65                	je     8ff <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     89a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     89d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     8a0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     8a2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     8a5:	eb 1f                	jmp    8c6 <printf+0x56>
+     8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ae:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     8b0:	83 f8 25             	cmp    $0x25,%eax
+     8b3:	74 3b                	je     8f0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     8b5:	89 f8                	mov    %edi,%eax
+     8b7:	e8 f4 fe ff ff       	call   7b0 <putc>
+  for(i = 0; fmt[i]; i++){
+     8bc:	0f b6 03             	movzbl (%ebx),%eax
+     8bf:	83 c3 01             	add    $0x1,%ebx
+     8c2:	84 c0                	test   %al,%al
+     8c4:	74 39                	je     8ff <printf+0x8f>
+    c = fmt[i] & 0xff;
+     8c6:	0f be d0             	movsbl %al,%edx
+     8c9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     8cc:	85 f6                	test   %esi,%esi
+     8ce:	74 e0                	je     8b0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     8d0:	83 fe 25             	cmp    $0x25,%esi
+     8d3:	75 e7                	jne    8bc <printf+0x4c>
+      if(c == 'd'){
+     8d5:	83 f8 25             	cmp    $0x25,%eax
+     8d8:	74 57                	je     931 <printf+0xc1>
+     8da:	83 e8 63             	sub    $0x63,%eax
+     8dd:	83 f8 15             	cmp    $0x15,%eax
+     8e0:	77 36                	ja     918 <printf+0xa8>
+     8e2:	ff 24 85 54 10 00 00 	jmp    *0x1054(,%eax,4)
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     8f0:	0f b6 03             	movzbl (%ebx),%eax
+     8f3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     8f6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     8fb:	84 c0                	test   %al,%al
+     8fd:	75 c7                	jne    8c6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     8ff:	8b 47 04             	mov    0x4(%edi),%eax
+     902:	85 c0                	test   %eax,%eax
+     904:	0f 84 06 01 00 00    	je     a10 <printf+0x1a0>
+    bflush(b);
+}
+     90a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     90d:	5b                   	pop    %ebx
+     90e:	5e                   	pop    %esi
+     90f:	5f                   	pop    %edi
+     910:	5d                   	pop    %ebp
+     911:	c3                   	ret
+     912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     918:	8b 4f 08             	mov    0x8(%edi),%ecx
+     91b:	8d 41 01             	lea    0x1(%ecx),%eax
+     91e:	89 47 08             	mov    %eax,0x8(%edi)
+     921:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     926:	3d 00 02 00 00       	cmp    $0x200,%eax
+     92b:	0f 84 77 01 00 00    	je     aa8 <printf+0x238>
+        putc(b, c);
+     931:	89 f8                	mov    %edi,%eax
+      state = 0;
+     933:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     935:	e8 76 fe ff ff       	call   7b0 <putc>
+     93a:	eb 80                	jmp    8bc <printf+0x4c>
+     93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     940:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     943:	83 ec 0c             	sub    $0xc,%esp
+     946:	b9 10 00 00 00       	mov    $0x10,%ecx
+     94b:	8b 16                	mov    (%esi),%edx
+     94d:	6a 00                	push   $0x0
+        ap++;
+     94f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     952:	89 f8                	mov    %edi,%eax
+     954:	e8 77 fd ff ff       	call   6d0 <printint>
+        ap++;
+     959:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     95c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     95f:	31 f6                	xor    %esi,%esi
+     961:	e9 56 ff ff ff       	jmp    8bc <printf+0x4c>
+     966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     970:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     973:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     975:	83 c0 04             	add    $0x4,%eax
+     978:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     97b:	85 c9                	test   %ecx,%ecx
+     97d:	0f 84 cd 00 00 00    	je     a50 <printf+0x1e0>
+        while(*s != 0){
+     983:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     986:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     988:	84 d2                	test   %dl,%dl
+     98a:	0f 84 2c ff ff ff    	je     8bc <printf+0x4c>
+          putc(b, *s);
+     990:	89 f8                	mov    %edi,%eax
+     992:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     995:	e8 16 fe ff ff       	call   7b0 <putc>
+          s++;
+     99a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     99d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     9a1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     9a4:	84 d2                	test   %dl,%dl
+     9a6:	75 e8                	jne    990 <printf+0x120>
+      state = 0;
+     9a8:	31 f6                	xor    %esi,%esi
+     9aa:	e9 0d ff ff ff       	jmp    8bc <printf+0x4c>
+     9af:	90                   	nop
+        printint(b, *ap, 10, 1);
+     9b0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9b3:	83 ec 0c             	sub    $0xc,%esp
+     9b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9bb:	8b 16                	mov    (%esi),%edx
+     9bd:	6a 01                	push   $0x1
+     9bf:	eb 8e                	jmp    94f <printf+0xdf>
+     9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     9c8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9cb:	89 f8                	mov    %edi,%eax
+     9cd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     9d0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     9d3:	e8 d8 fd ff ff       	call   7b0 <putc>
+        ap++;
+     9d8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     9db:	31 f6                	xor    %esi,%esi
+     9dd:	e9 da fe ff ff       	jmp    8bc <printf+0x4c>
+     9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     9e8:	8b 15 44 19 00 00    	mov    0x1944,%edx
+     9ee:	85 d2                	test   %edx,%edx
+     9f0:	74 6e                	je     a60 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     9f2:	0f b6 03             	movzbl (%ebx),%eax
+     9f5:	bf 40 19 00 00       	mov    $0x1940,%edi
+     9fa:	84 c0                	test   %al,%al
+     9fc:	0f 85 98 fe ff ff    	jne    89a <printf+0x2a>
+     a02:	e9 03 ff ff ff       	jmp    90a <printf+0x9a>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a10:	8b 47 08             	mov    0x8(%edi),%eax
+     a13:	85 c0                	test   %eax,%eax
+     a15:	7f 19                	jg     a30 <printf+0x1c0>
+  b->n = 0;
+     a17:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     a1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a21:	5b                   	pop    %ebx
+     a22:	5e                   	pop    %esi
+     a23:	5f                   	pop    %edi
+     a24:	5d                   	pop    %ebp
+     a25:	c3                   	ret
+     a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a30:	83 ec 04             	sub    $0x4,%esp
+     a33:	50                   	push   %eax
+     a34:	8d 47 0c             	lea    0xc(%edi),%eax
+     a37:	50                   	push   %eax
+     a38:	ff 37                	push   (%edi)
+     a3a:	e8 d4 fa ff ff       	call   513 <write>
+  b->n = 0;
+     a3f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     a46:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a49:	eb d3                	jmp    a1e <printf+0x1ae>
+     a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+     a50:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     a55:	b9 4b 10 00 00       	mov    $0x104b,%ecx
+     a5a:	e9 31 ff ff ff       	jmp    990 <printf+0x120>
+     a5f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a60:	83 ec 08             	sub    $0x8,%esp
+     a63:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     a66:	c7 05 40 19 00 00 01 	movl   $0x1,0x1940
+     a6d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a70:	50                   	push   %eax
+     a71:	6a 01                	push   $0x1
+     a73:	e8 d3 fa ff ff       	call   54b <fstat>
+     a78:	83 c4 10             	add    $0x10,%esp
+     a7b:	85 c0                	test   %eax,%eax
+     a7d:	75 22                	jne    aa1 <printf+0x231>
+     a7f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     a84:	b8 02 00 00 00       	mov    $0x2,%eax
+     a89:	0f 45 f0             	cmovne %eax,%esi
+     a8c:	89 35 44 19 00 00    	mov    %esi,0x1944
+      stdioflush = flushout;
+     a92:	c7 05 e0 14 00 00 90 	movl   $0x690,0x14e0
+     a99:	06 00 00 
+     a9c:	e9 51 ff ff ff       	jmp    9f2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     aa1:	be 02 00 00 00       	mov    $0x2,%esi
+     aa6:	eb e4                	jmp    a8c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     aa8:	83 ec 04             	sub    $0x4,%esp
+     aab:	8d 47 0c             	lea    0xc(%edi),%eax
+     aae:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     ab1:	68 00 02 00 00       	push   $0x200
+     ab6:	50                   	push   %eax
+     ab7:	ff 37                	push   (%edi)
+     ab9:	e8 55 fa ff ff       	call   513 <write>
+  b->n = 0;
+     abe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     ac5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	e9 61 fe ff ff       	jmp    931 <printf+0xc1>
+
+00000ad0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	56                   	push   %esi
+     ad4:	53                   	push   %ebx
+     ad5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     ad7:	a1 60 1b 00 00       	mov    0x1b60,%eax
+     adc:	39 d8                	cmp    %ebx,%eax
+     ade:	0f 83 e4 00 00 00    	jae    bc8 <freepages+0xf8>
+     ae4:	85 c0                	test   %eax,%eax
+     ae6:	0f 84 dc 00 00 00    	je     bc8 <freepages+0xf8>
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     af0:	89 c2                	mov    %eax,%edx
+     af2:	8b 00                	mov    (%eax),%eax
+     af4:	85 c0                	test   %eax,%eax
+     af6:	74 04                	je     afc <freepages+0x2c>
+     af8:	39 d8                	cmp    %ebx,%eax
+     afa:	72 f4                	jb     af0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     afc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     aff:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     b01:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     b03:	85 c0                	test   %eax,%eax
+     b05:	74 15                	je     b1c <freepages+0x4c>
+    p->prev = s;
+     b07:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     b0a:	8b 73 10             	mov    0x10(%ebx),%esi
+     b0d:	89 f1                	mov    %esi,%ecx
+     b0f:	c1 e1 0c             	shl    $0xc,%ecx
+     b12:	01 d9                	add    %ebx,%ecx
+     b14:	39 c8                	cmp    %ecx,%eax
+     b16:	0f 84 d8 00 00 00    	je     bf4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     b1c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     b1f:	89 c8                	mov    %ecx,%eax
+     b21:	c1 e0 0c             	shl    $0xc,%eax
+     b24:	01 d0                	add    %edx,%eax
+     b26:	39 c3                	cmp    %eax,%ebx
+     b28:	74 16                	je     b40 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b2a:	8b 03                	mov    (%ebx),%eax
+     b2c:	85 c0                	test   %eax,%eax
+     b2e:	74 40                	je     b70 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     b30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b33:	5b                   	pop    %ebx
+     b34:	5e                   	pop    %esi
+     b35:	5d                   	pop    %ebp
+     b36:	c3                   	ret
+     b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b3e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     b40:	03 4b 10             	add    0x10(%ebx),%ecx
+     b43:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     b46:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     b49:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b4b:	85 c9                	test   %ecx,%ecx
+     b4d:	0f 84 dd 00 00 00    	je     c30 <freepages+0x160>
+    s->prev->next = s->next;
+     b53:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     b55:	85 c0                	test   %eax,%eax
+     b57:	74 06                	je     b5f <freepages+0x8f>
+    s->next->prev = s->prev;
+     b59:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b5c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b5f:	8b 02                	mov    (%edx),%eax
+     b61:	89 d3                	mov    %edx,%ebx
+     b63:	85 c0                	test   %eax,%eax
+     b65:	75 c9                	jne    b30 <freepages+0x60>
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+     b70:	8b 43 10             	mov    0x10(%ebx),%eax
+     b73:	83 f8 0f             	cmp    $0xf,%eax
+     b76:	76 b8                	jbe    b30 <freepages+0x60>
+     b78:	83 ec 0c             	sub    $0xc,%esp
+     b7b:	c1 e0 0c             	shl    $0xc,%eax
+     b7e:	6a 00                	push   $0x0
+     b80:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     b83:	e8 f3 f9 ff ff       	call   57b <sbrk>
+     b88:	83 c4 10             	add    $0x10,%esp
+     b8b:	39 c6                	cmp    %eax,%esi
+     b8d:	75 a1                	jne    b30 <freepages+0x60>
+  if(s->prev)
+     b8f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     b92:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b94:	85 d2                	test   %edx,%edx
+     b96:	0f 84 a5 00 00 00    	je     c41 <freepages+0x171>
+    s->prev->next = s->next;
+     b9c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     b9e:	85 c0                	test   %eax,%eax
+     ba0:	74 06                	je     ba8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     ba2:	8b 53 04             	mov    0x4(%ebx),%edx
+     ba5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     ba8:	8b 43 10             	mov    0x10(%ebx),%eax
+     bab:	83 ec 0c             	sub    $0xc,%esp
+     bae:	c1 e0 0c             	shl    $0xc,%eax
+     bb1:	f7 d8                	neg    %eax
+     bb3:	50                   	push   %eax
+     bb4:	e8 c2 f9 ff ff       	call   57b <sbrk>
+     bb9:	83 c4 10             	add    $0x10,%esp
+}
+     bbc:	e9 6f ff ff ff       	jmp    b30 <freepages+0x60>
+     bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     bc8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     bcf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     bd1:	89 1d 60 1b 00 00    	mov    %ebx,0x1b60
+  if(p)
+     bd7:	85 c0                	test   %eax,%eax
+     bd9:	74 95                	je     b70 <freepages+0xa0>
+    p->prev = s;
+     bdb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     bde:	8b 73 10             	mov    0x10(%ebx),%esi
+     be1:	89 f2                	mov    %esi,%edx
+     be3:	c1 e2 0c             	shl    $0xc,%edx
+     be6:	01 da                	add    %ebx,%edx
+     be8:	39 d0                	cmp    %edx,%eax
+     bea:	0f 85 3a ff ff ff    	jne    b2a <freepages+0x5a>
+     bf0:	89 c1                	mov    %eax,%ecx
+     bf2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     bf4:	8b 41 10             	mov    0x10(%ecx),%eax
+     bf7:	01 f0                	add    %esi,%eax
+     bf9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     bfc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     bff:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     c01:	85 f6                	test   %esi,%esi
+     c03:	74 35                	je     c3a <freepages+0x16a>
+    s->prev->next = s->next;
+     c05:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     c07:	85 c0                	test   %eax,%eax
+     c09:	74 06                	je     c11 <freepages+0x141>
+    s->next->prev = s->prev;
+     c0b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     c0e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     c11:	85 d2                	test   %edx,%edx
+     c13:	0f 84 11 ff ff ff    	je     b2a <freepages+0x5a>
+     c19:	8b 4a 10             	mov    0x10(%edx),%ecx
+     c1c:	89 c8                	mov    %ecx,%eax
+     c1e:	c1 e0 0c             	shl    $0xc,%eax
+     c21:	01 d0                	add    %edx,%eax
+     c23:	39 c3                	cmp    %eax,%ebx
+     c25:	0f 85 ff fe ff ff    	jne    b2a <freepages+0x5a>
+     c2b:	e9 10 ff ff ff       	jmp    b40 <freepages+0x70>
+    *l = s->next;
+     c30:	a3 60 1b 00 00       	mov    %eax,0x1b60
+     c35:	e9 1b ff ff ff       	jmp    b55 <freepages+0x85>
+     c3a:	a3 60 1b 00 00       	mov    %eax,0x1b60
+     c3f:	eb c6                	jmp    c07 <freepages+0x137>
+     c41:	a3 60 1b 00 00       	mov    %eax,0x1b60
+     c46:	e9 53 ff ff ff       	jmp    b9e <freepages+0xce>
+     c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+
+00000c50 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	56                   	push   %esi
+     c54:	53                   	push   %ebx
+     c55:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     c57:	a1 60 1b 00 00       	mov    0x1b60,%eax
+     c5c:	85 c0                	test   %eax,%eax
+     c5e:	74 5e                	je     cbe <getpages+0x6e>
+    if(s->npages < n)
+     c60:	8b 50 10             	mov    0x10(%eax),%edx
+     c63:	39 da                	cmp    %ebx,%edx
+     c65:	72 51                	jb     cb8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     c67:	39 d3                	cmp    %edx,%ebx
+     c69:	72 25                	jb     c90 <getpages+0x40>
+  if(s->prev)
+     c6b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     c6e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     c70:	85 c9                	test   %ecx,%ecx
+     c72:	0f 84 a8 00 00 00    	je     d20 <getpages+0xd0>
+    s->prev->next = s->next;
+     c78:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     c7a:	85 d2                	test   %edx,%edx
+     c7c:	74 06                	je     c84 <getpages+0x34>
+    s->next->prev = s->prev;
+     c7e:	8b 48 04             	mov    0x4(%eax),%ecx
+     c81:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     c84:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c8a:	5b                   	pop    %ebx
+     c8b:	5e                   	pop    %esi
+     c8c:	5d                   	pop    %ebp
+     c8d:	c3                   	ret
+     c8e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     c90:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     c92:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     c94:	c1 e1 0c             	shl    $0xc,%ecx
+     c97:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     c99:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     c9c:	8b 70 04             	mov    0x4(%eax),%esi
+     c9f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     ca2:	8b 10                	mov    (%eax),%edx
+     ca4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     ca6:	85 f6                	test   %esi,%esi
+     ca8:	74 66                	je     d10 <getpages+0xc0>
+        rest->prev->next = rest;
+     caa:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     cac:	8b 11                	mov    (%ecx),%edx
+     cae:	85 d2                	test   %edx,%edx
+     cb0:	75 cf                	jne    c81 <getpages+0x31>
+     cb2:	eb d0                	jmp    c84 <getpages+0x34>
+     cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     cb8:	8b 00                	mov    (%eax),%eax
+     cba:	85 c0                	test   %eax,%eax
+     cbc:	75 a2                	jne    c60 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     cbe:	83 ec 0c             	sub    $0xc,%esp
+     cc1:	6a 00                	push   $0x0
+     cc3:	e8 b3 f8 ff ff       	call   57b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cc8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     ccb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     cd1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cd3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     cd9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cdf:	29 d0                	sub    %edx,%eax
+     ce1:	c1 e8 0c             	shr    $0xc,%eax
+     ce4:	39 d8                	cmp    %ebx,%eax
+     ce6:	72 48                	jb     d30 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     ce8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     cea:	89 d8                	mov    %ebx,%eax
+     cec:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     cef:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     cf1:	c1 e0 0c             	shl    $0xc,%eax
+     cf4:	01 f0                	add    %esi,%eax
+     cf6:	50                   	push   %eax
+     cf7:	e8 7f f8 ff ff       	call   57b <sbrk>
+     cfc:	83 c4 10             	add    $0x10,%esp
+     cff:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d02:	74 2c                	je     d30 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     d04:	01 f0                	add    %esi,%eax
+     d06:	e9 79 ff ff ff       	jmp    c84 <getpages+0x34>
+     d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+        runs = rest;
+     d10:	89 0d 60 1b 00 00    	mov    %ecx,0x1b60
+     d16:	eb 96                	jmp    cae <getpages+0x5e>
+     d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+    *l = s->next;
+     d20:	89 15 60 1b 00 00    	mov    %edx,0x1b60
+     d26:	e9 4f ff ff ff       	jmp    c7a <getpages+0x2a>
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+    return 0;
+     d30:	31 c0                	xor    %eax,%eax
+     d32:	e9 50 ff ff ff       	jmp    c87 <getpages+0x37>
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	53                   	push   %ebx
+     d46:	83 ec 1c             	sub    $0x1c,%esp
+     d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     d4c:	85 c0                	test   %eax,%eax
+     d4e:	0f 84 97 00 00 00    	je     deb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     d54:	89 c3                	mov    %eax,%ebx
+     d56:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     d5c:	8b 73 14             	mov    0x14(%ebx),%esi
+     d5f:	83 fe 01             	cmp    $0x1,%esi
+     d62:	74 74                	je     dd8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     d64:	85 f6                	test   %esi,%esi
+     d66:	74 5d                	je     dc5 <free+0x85>
+  if(s->free == 0)
+     d68:	8b 53 08             	mov    0x8(%ebx),%edx
+     d6b:	85 d2                	test   %edx,%edx
+     d6d:	0f 84 85 00 00 00    	je     df8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     d73:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     d75:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     d78:	8b 43 0c             	mov    0xc(%ebx),%eax
+     d7b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     d7e:	8b 04 f5 84 1b 00 00 	mov    0x1b84(,%esi,8),%eax
+  s->inuse--;
+     d85:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     d88:	83 c0 01             	add    $0x1,%eax
+     d8b:	89 04 f5 84 1b 00 00 	mov    %eax,0x1b84(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     d92:	85 d2                	test   %edx,%edx
+     d94:	75 55                	jne    deb <free+0xab>
+     d96:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     d9b:	89 f1                	mov    %esi,%ecx
+     d9d:	d3 ea                	shr    %cl,%edx
+     d9f:	39 c2                	cmp    %eax,%edx
+     da1:	73 7d                	jae    e20 <free+0xe0>
+  if(s->prev)
+     da3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     da6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     da8:	85 ff                	test   %edi,%edi
+     daa:	0f 84 a0 00 00 00    	je     e50 <free+0x110>
+    s->prev->next = s->next;
+     db0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     db2:	85 c9                	test   %ecx,%ecx
+     db4:	74 06                	je     dbc <free+0x7c>
+    s->next->prev = s->prev;
+     db6:	8b 7b 04             	mov    0x4(%ebx),%edi
+     db9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     dbc:	29 d0                	sub    %edx,%eax
+     dbe:	89 04 f5 84 1b 00 00 	mov    %eax,0x1b84(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     dc8:	89 d8                	mov    %ebx,%eax
+}
+     dca:	5b                   	pop    %ebx
+     dcb:	5e                   	pop    %esi
+     dcc:	5f                   	pop    %edi
+     dcd:	5d                   	pop    %ebp
+    freepages(s);
+     dce:	e9 fd fc ff ff       	jmp    ad0 <freepages>
+     dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dd7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     dd8:	8b 43 10             	mov    0x10(%ebx),%eax
+     ddb:	83 ec 08             	sub    $0x8,%esp
+     dde:	c1 e0 0c             	shl    $0xc,%eax
+     de1:	50                   	push   %eax
+     de2:	53                   	push   %ebx
+     de3:	e8 6b f8 ff ff       	call   653 <munmap>
+     de8:	83 c4 10             	add    $0x10,%esp
+}
+     deb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dee:	5b                   	pop    %ebx
+     def:	5e                   	pop    %esi
+     df0:	5f                   	pop    %edi
+     df1:	5d                   	pop    %ebp
+     df2:	c3                   	ret
+     df3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     df7:	90                   	nop
+  s->next = *l;
+     df8:	8b 14 f5 80 1b 00 00 	mov    0x1b80(,%esi,8),%edx
+  s->prev = 0;
+     dff:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     e06:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     e08:	85 d2                	test   %edx,%edx
+     e0a:	74 06                	je     e12 <free+0xd2>
+    (*l)->prev = s;
+     e0c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     e0f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+     e12:	89 1c f5 80 1b 00 00 	mov    %ebx,0x1b80(,%esi,8)
+}
+     e19:	e9 55 ff ff ff       	jmp    d73 <free+0x33>
+     e1e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+     e20:	83 ec 0c             	sub    $0xc,%esp
+     e23:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e26:	8b 7b 10             	mov    0x10(%ebx),%edi
+     e29:	6a 00                	push   $0x0
+     e2b:	c1 e7 0c             	shl    $0xc,%edi
+     e2e:	01 df                	add    %ebx,%edi
+     e30:	e8 46 f7 ff ff       	call   57b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     e35:	83 c4 10             	add    $0x10,%esp
+     e38:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     e3b:	39 c7                	cmp    %eax,%edi
+     e3d:	75 ac                	jne    deb <free+0xab>
+     e3f:	8b 04 f5 84 1b 00 00 	mov    0x1b84(,%esi,8),%eax
+     e46:	e9 58 ff ff ff       	jmp    da3 <free+0x63>
+     e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e4f:	90                   	nop
+    *l = s->next;
+     e50:	89 0c f5 80 1b 00 00 	mov    %ecx,0x1b80(,%esi,8)
+     e57:	e9 56 ff ff ff       	jmp    db2 <free+0x72>
+     e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     e60:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     e61:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+     e66:	89 e5                	mov    %esp,%ebp
+     e68:	57                   	push   %edi
+     e69:	56                   	push   %esi
+     e6a:	53                   	push   %ebx
+     e6b:	83 ec 1c             	sub    $0x1c,%esp
+     e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+     e71:	83 f8 10             	cmp    $0x10,%eax
+     e74:	0f 86 92 00 00 00    	jbe    f0c <malloc+0xac>
+     e7a:	ba 01 00 00 00       	mov    $0x1,%edx
+     e7f:	eb 13                	jmp    e94 <malloc+0x34>
+     e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e88:	89 d3                	mov    %edx,%ebx
+     e8a:	d3 e3                	shl    %cl,%ebx
+     e8c:	39 c3                	cmp    %eax,%ebx
+     e8e:	0f 83 84 00 00 00    	jae    f18 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     e94:	83 c1 01             	add    $0x1,%ecx
+     e97:	83 f9 0b             	cmp    $0xb,%ecx
+     e9a:	75 ec                	jne    e88 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+     e9c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+     ea1:	0f 87 c9 00 00 00    	ja     f70 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+     ea7:	05 17 10 00 00       	add    $0x1017,%eax
+     eac:	89 c3                	mov    %eax,%ebx
+     eae:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+     eb1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+     eb6:	77 28                	ja     ee0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+     eb8:	89 d8                	mov    %ebx,%eax
+     eba:	e8 91 fd ff ff       	call   c50 <getpages>
+     ebf:	85 c0                	test   %eax,%eax
+     ec1:	0f 84 a9 00 00 00    	je     f70 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+     ec7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+     ece:	83 c0 18             	add    $0x18,%eax
+}
+     ed1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ed4:	5b                   	pop    %ebx
+     ed5:	5e                   	pop    %esi
+     ed6:	5f                   	pop    %edi
+     ed7:	5d                   	pop    %ebp
+     ed8:	c3                   	ret
+     ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+     ee0:	89 d8                	mov    %ebx,%eax
+     ee2:	83 ec 08             	sub    $0x8,%esp
+     ee5:	c1 e0 0c             	shl    $0xc,%eax
+     ee8:	6a 00                	push   $0x0
+     eea:	6a ff                	push   $0xffffffff
+     eec:	6a 22                	push   $0x22
+     eee:	6a 03                	push   $0x3
+     ef0:	50                   	push   %eax
+     ef1:	6a 00                	push   $0x0
+     ef3:	e8 53 f7 ff ff       	call   64b <mmap>
+    if(s == MAP_FAILED)
+     ef8:	83 c4 20             	add    $0x20,%esp
+     efb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     efe:	74 b8                	je     eb8 <malloc+0x58>
+      s->shift = MAPRUN;
+     f00:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+     f07:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+     f0a:	eb c2                	jmp    ece <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+     f0c:	bb 10 00 00 00       	mov    $0x10,%ebx
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+     f18:	8b 34 cd 80 1b 00 00 	mov    0x1b80(,%ecx,8),%esi
+     f1f:	85 f6                	test   %esi,%esi
+     f21:	74 57                	je     f7a <malloc+0x11a>
+  classes[shift].nfree--;
+     f23:	8b 1c cd 84 1b 00 00 	mov    0x1b84(,%ecx,8),%ebx
+  o = s->free;
+     f2a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+     f2d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     f30:	89 14 cd 84 1b 00 00 	mov    %edx,0x1b84(,%ecx,8)
+  s->free = NEXTFREE(o);
+     f37:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+     f39:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+     f3d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+     f40:	85 ff                	test   %edi,%edi
+     f42:	75 8d                	jne    ed1 <malloc+0x71>
+  if(s->prev)
+     f44:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+     f47:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+     f49:	85 db                	test   %ebx,%ebx
+     f4b:	0f 84 b7 00 00 00    	je     1008 <malloc+0x1a8>
+    s->prev->next = s->next;
+     f51:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+     f53:	85 d2                	test   %edx,%edx
+     f55:	0f 84 76 ff ff ff    	je     ed1 <malloc+0x71>
+    s->next->prev = s->prev;
+     f5b:	8b 4e 04             	mov    0x4(%esi),%ecx
+     f5e:	89 4a 04             	mov    %ecx,0x4(%edx)
+     f61:	e9 6b ff ff ff       	jmp    ed1 <malloc+0x71>
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     f73:	31 c0                	xor    %eax,%eax
+}
+     f75:	5b                   	pop    %ebx
+     f76:	5e                   	pop    %esi
+     f77:	5f                   	pop    %edi
+     f78:	5d                   	pop    %ebp
+     f79:	c3                   	ret
+    if((s = getpages(1)) == 0)
+     f7a:	b8 01 00 00 00       	mov    $0x1,%eax
+     f7f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     f82:	e8 c9 fc ff ff       	call   c50 <getpages>
+     f87:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f8a:	85 c0                	test   %eax,%eax
+     f8c:	89 c2                	mov    %eax,%edx
+     f8e:	74 e0                	je     f70 <malloc+0x110>
+    s->shift = shift;
+     f90:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     f93:	f7 db                	neg    %ebx
+    s->inuse = 0;
+     f95:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+     f9c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fa1:	89 df                	mov    %ebx,%edi
+     fa3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+     fa5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+     fa7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     faa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     fad:	83 e8 01             	sub    $0x1,%eax
+     fb0:	d3 e0                	shl    %cl,%eax
+     fb2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     fb5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fb9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     fbc:	eb 04                	jmp    fc2 <malloc+0x162>
+     fbe:	66 90                	xchg   %ax,%ax
+     fc0:	89 c8                	mov    %ecx,%eax
+     fc2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+     fc5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fc7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+     fca:	89 c6                	mov    %eax,%esi
+     fcc:	39 da                	cmp    %ebx,%edx
+     fce:	7f f0                	jg     fc0 <malloc+0x160>
+     fd0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     fd3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     fd6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+     fd9:	8b 04 cd 80 1b 00 00 	mov    0x1b80(,%ecx,8),%eax
+  s->prev = 0;
+     fe0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+     fe7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+     fe9:	85 c0                	test   %eax,%eax
+     feb:	74 03                	je     ff0 <malloc+0x190>
+    (*l)->prev = s;
+     fed:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+     ff0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+     ff3:	89 14 cd 80 1b 00 00 	mov    %edx,0x1b80(,%ecx,8)
+    classes[shift].nfree += n;
+     ffa:	89 d6                	mov    %edx,%esi
+     ffc:	03 1c cd 84 1b 00 00 	add    0x1b84(,%ecx,8),%ebx
+    1003:	e9 22 ff ff ff       	jmp    f2a <malloc+0xca>
+    *l = s->next;
+    1008:	89 14 cd 80 1b 00 00 	mov    %edx,0x1b80(,%ecx,8)
+    100f:	e9 3f ff ff ff       	jmp    f53 <malloc+0xf3>
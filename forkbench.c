@@ -0,0 +1,59 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Measure fork() latency for a process with a large heap.
+// forkbench [heap MB] [forks]
+//
+// The first run forks children that exit right away (what a
+// shell does before exec); the second has each child write
+// every heap page, the worst case for copy-on-write.
+
+#define MB (1024 * 1024)
+
+int run(char *heap, int size, int forks, int touch)
+{
+  int i, j, pid, t0;
+
+  t0 = uptime();
+  for (i = 0; i < forks; i++)
+  {
+    pid = fork();
+    if (pid < 0)
+    {
+      printf(1, "forkbench: fork failed\n");
+      exit();
+    }
+    if (pid == 0)
+    {
+      if (touch)
+        for (j = 0; j < size; j += 4096)
+          heap[j] = j;
+      exit();
+    }
+    wait();
+  }
+  return uptime() - t0;
+}
+
+int main(int argc, char *argv[])
+{
+  int mb = argc > 1 ? atoi(argv[1]) : 16;
+  int forks = argc > 2 ? atoi(argv[2]) : 20;
+  char *heap;
+  int i, t;
+
+  if ((heap = sbrk(mb * MB)) == (char *)-1)
+  {
+    printf(1, "forkbench: cannot grow heap to %d MB\n", mb);
+    exit();
+  }
+  for (i = 0; i < mb * MB; i += 4096)
+    heap[i] = i;
+
+  t = run(heap, mb * MB, forks, 0);
+  printf(1, "forkbench: %d fork+exit of a %d MB process: %d ticks\n", forks, mb, t);
+  t = run(heap, mb * MB, forks, 1);
+  printf(1, "forkbench: %d fork+write-all of a %d MB process: %d ticks\n", forks, mb, t);
+  exit();
+}
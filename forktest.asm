@@ -0,0 +1,1008 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 40 01 00 00       	call   150 <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 50 02 00 00       	call   270 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 b6 04 00 00       	call   4e3 <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 5c 06 00 00       	push   $0x65c
+  4e:	e8 1d 02 00 00       	call   270 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 5c 06 00 00       	push   $0x65c
+  5c:	6a 01                	push   $0x1
+  5e:	e8 80 04 00 00       	call   4e3 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 9a 00 00 00       	call   120 <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 36 04 00 00       	call   4cb <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 28 04 00 00       	call   4cb <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 8e 06 00 00       	push   $0x68e
+  b0:	e8 bb 01 00 00       	call   270 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 8e 06 00 00       	push   $0x68e
+  be:	6a 01                	push   $0x1
+  c0:	e8 1e 04 00 00       	call   4e3 <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 7e 00 00 00       	call   150 <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 67 06 00 00       	push   $0x667
+  da:	e8 91 01 00 00       	call   270 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 67 06 00 00       	push   $0x667
+  e8:	6a 01                	push   $0x1
+  ea:	e8 f4 03 00 00       	call   4e3 <write>
+      exit();
+  ef:	e8 5c 00 00 00       	call   150 <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 7b 06 00 00       	push   $0x67b
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 49 00 00 00       	call   150 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 9c 06 00 00       	push   $0x69c
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 32 00 00 00       	call   150 <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+ 120:	a1 40 09 00 00       	mov    0x940,%eax
+ 125:	85 c0                	test   %eax,%eax
+ 127:	74 17                	je     140 <fork+0x20>
+{
+ 129:	55                   	push   %ebp
+ 12a:	89 e5                	mov    %esp,%ebp
+ 12c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+ 12f:	ff d0                	call   *%eax
+  return _fork();
+}
+ 131:	c9                   	leave
+  return _fork();
+ 132:	e9 84 03 00 00       	jmp    4bb <_fork>
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+ 140:	e9 76 03 00 00       	jmp    4bb <_fork>
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <exit>:
+
+int
+exit(void)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+ 156:	a1 40 09 00 00       	mov    0x940,%eax
+ 15b:	85 c0                	test   %eax,%eax
+ 15d:	74 02                	je     161 <exit+0x11>
+    stdioflush();
+ 15f:	ff d0                	call   *%eax
+  _exit();
+ 161:	e8 5d 03 00 00       	call   4c3 <_exit>
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+ 170:	55                   	push   %ebp
+  if(stdioflush)
+ 171:	a1 40 09 00 00       	mov    0x940,%eax
+{
+ 176:	89 e5                	mov    %esp,%ebp
+ 178:	56                   	push   %esi
+ 179:	53                   	push   %ebx
+ 17a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 17d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+ 180:	85 c0                	test   %eax,%eax
+ 182:	74 02                	je     186 <exec+0x16>
+    stdioflush();
+ 184:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 186:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 189:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 18c:	5b                   	pop    %ebx
+ 18d:	5e                   	pop    %esi
+ 18e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 18f:	e9 67 03 00 00       	jmp    4fb <_exec>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+ 1a9:	a1 40 09 00 00       	mov    0x940,%eax
+{
+ 1ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 1b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 1b7:	85 c0                	test   %eax,%eax
+ 1b9:	74 02                	je     1bd <spawn+0x1d>
+    stdioflush();
+ 1bb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 1bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 1c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 1c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1c6:	83 c4 0c             	add    $0xc,%esp
+ 1c9:	5b                   	pop    %ebx
+ 1ca:	5e                   	pop    %esi
+ 1cb:	5f                   	pop    %edi
+ 1cc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 1cd:	e9 79 04 00 00       	jmp    64b <_spawn>
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f7:	83 c0 01             	add    $0x1,%eax
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	75 f2                	jne    1f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 201:	89 c8                	mov    %ecx,%eax
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+ 205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 276:	80 3a 00             	cmpb   $0x0,(%edx)
+ 279:	74 15                	je     290 <strlen+0x20>
+ 27b:	31 c0                	xor    %eax,%eax
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 287:	89 c1                	mov    %eax,%ecx
+ 289:	75 f5                	jne    280 <strlen+0x10>
+    ;
+  return n;
+}
+ 28b:	89 c8                	mov    %ecx,%eax
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+ 28f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 290:	31 c9                	xor    %ecx,%ecx
+}
+ 292:	5d                   	pop    %ebp
+ 293:	89 c8                	mov    %ecx,%eax
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ad:	89 d7                	mov    %edx,%edi
+ 2af:	fc                   	cld
+ 2b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2b5:	89 d0                	mov    %edx,%eax
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	84 d2                	test   %dl,%dl
+ 2cf:	75 12                	jne    2e3 <strchr+0x23>
+ 2d1:	eb 1d                	jmp    2f0 <strchr+0x30>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2dc:	83 c0 01             	add    $0x1,%eax
+ 2df:	84 d2                	test   %dl,%dl
+ 2e1:	74 0d                	je     2f0 <strchr+0x30>
+    if(*s == c)
+ 2e3:	38 d1                	cmp    %dl,%cl
+ 2e5:	75 f1                	jne    2d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2f0:	31 c0                	xor    %eax,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	53                   	push   %ebx
+ 306:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 309:	a1 40 09 00 00       	mov    0x940,%eax
+{
+ 30e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 311:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 314:	85 c0                	test   %eax,%eax
+ 316:	74 02                	je     31a <gets+0x1a>
+    stdioflush();
+ 318:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 31a:	a1 68 0b 00 00       	mov    0xb68,%eax
+ 31f:	85 c0                	test   %eax,%eax
+ 321:	0f 84 99 00 00 00    	je     3c0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 327:	31 db                	xor    %ebx,%ebx
+ 329:	eb 21                	jmp    34c <gets+0x4c>
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 330:	8d 50 01             	lea    0x1(%eax),%edx
+ 333:	0f b6 80 60 09 00 00 	movzbl 0x960(%eax),%eax
+ 33a:	89 15 60 0b 00 00    	mov    %edx,0xb60
+    buf[i++] = c;
+ 340:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 344:	3c 0a                	cmp    $0xa,%al
+ 346:	74 60                	je     3a8 <gets+0xa8>
+ 348:	3c 0d                	cmp    $0xd,%al
+ 34a:	74 5c                	je     3a8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 34c:	89 da                	mov    %ebx,%edx
+ 34e:	83 c3 01             	add    $0x1,%ebx
+ 351:	39 fb                	cmp    %edi,%ebx
+ 353:	7d 55                	jge    3aa <gets+0xaa>
+    if(in.r == in.n){
+ 355:	a1 60 0b 00 00       	mov    0xb60,%eax
+ 35a:	3b 05 64 0b 00 00    	cmp    0xb64,%eax
+ 360:	75 ce                	jne    330 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 362:	83 ec 04             	sub    $0x4,%esp
+ 365:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 368:	c7 05 64 0b 00 00 00 	movl   $0x0,0xb64
+ 36f:	00 00 00 
+ 372:	c7 05 60 0b 00 00 00 	movl   $0x0,0xb60
+ 379:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 37c:	ff 35 68 0b 00 00    	push   0xb68
+ 382:	68 60 09 00 00       	push   $0x960
+ 387:	6a 00                	push   $0x0
+ 389:	e8 4d 01 00 00       	call   4db <read>
+ 38e:	83 c4 10             	add    $0x10,%esp
+ 391:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 394:	85 c0                	test   %eax,%eax
+ 396:	a3 64 0b 00 00       	mov    %eax,0xb64
+ 39b:	7e 56                	jle    3f3 <gets+0xf3>
+    c = in.buf[in.r++];
+ 39d:	a1 60 0b 00 00       	mov    0xb60,%eax
+ 3a2:	eb 8c                	jmp    330 <gets+0x30>
+ 3a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 3a8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 3aa:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 3ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3b1:	89 f0                	mov    %esi,%eax
+ 3b3:	5b                   	pop    %ebx
+ 3b4:	5e                   	pop    %esi
+ 3b5:	5f                   	pop    %edi
+ 3b6:	5d                   	pop    %ebp
+ 3b7:	c3                   	ret
+ 3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 3c0:	83 ec 08             	sub    $0x8,%esp
+ 3c3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 3c6:	50                   	push   %eax
+ 3c7:	6a 00                	push   $0x0
+ 3c9:	e8 4d 01 00 00       	call   51b <fstat>
+ 3ce:	83 c4 10             	add    $0x10,%esp
+ 3d1:	89 c2                	mov    %eax,%edx
+ 3d3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d8:	85 d2                	test   %edx,%edx
+ 3da:	75 0d                	jne    3e9 <gets+0xe9>
+ 3dc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 3e1:	ba 00 02 00 00       	mov    $0x200,%edx
+ 3e6:	0f 44 c2             	cmove  %edx,%eax
+ 3e9:	a3 68 0b 00 00       	mov    %eax,0xb68
+ 3ee:	e9 34 ff ff ff       	jmp    327 <gets+0x27>
+        in.n = 0;
+ 3f3:	c7 05 64 0b 00 00 00 	movl   $0x0,0xb64
+ 3fa:	00 00 00 
+        break;
+ 3fd:	eb ab                	jmp    3aa <gets+0xaa>
+ 3ff:	90                   	nop
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <_exit>:
+RAWSYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <_exec>:
+RAWSYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <get_parent_id>:
+SYSCALL(get_parent_id)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <get_children>:
+SYSCALL(get_children)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <set_path>:
+SYSCALL(set_path)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <set_sleep>:
+SYSCALL(set_sleep)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <get_time>:
+SYSCALL(get_time)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <change_process_level>:
+SYSCALL(change_process_level)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <print_processes_info>:
+SYSCALL(print_processes_info)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 5b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <barrier_wait>:
+SYSCALL(barrier_wait)
+ 5bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 5c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 5cb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 5d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 5db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sem_create>:
+SYSCALL(sem_create)
+ 5e3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <event_create>:
+SYSCALL(event_create)
+ 5eb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sync_post>:
+SYSCALL(sync_post)
+ 5f3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sync_wait>:
+SYSCALL(sync_wait)
+ 5fb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <sync_close>:
+SYSCALL(sync_close)
+ 603:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <event_reset>:
+SYSCALL(event_reset)
+ 60b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 613:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mmap>:
+SYSCALL(mmap)
+ 61b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <munmap>:
+SYSCALL(munmap)
+ 623:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <shmget>:
+SYSCALL(shmget)
+ 62b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <shmat>:
+SYSCALL(shmat)
+ 633:	b8 30 00 00 00       	mov    $0x30,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <shmdt>:
+SYSCALL(shmdt)
+ 63b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <shmrm>:
+SYSCALL(shmrm)
+ 643:	b8 32 00 00 00       	mov    $0x32,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <_spawn>:
+RAWSYSCALL(spawn)
+ 64b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <memstat>:
+SYSCALL(memstat)
+ 653:	b8 34 00 00 00       	mov    $0x34,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
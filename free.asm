@@ -0,0 +1,2257 @@
+
+_free:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+// Without a pid, the process shown is free itself.
+
+#define KB(pages) ((pages) * 4)
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	31 db                	xor    %ebx,%ebx
+      12:	51                   	push   %ecx
+      13:	83 ec 58             	sub    $0x58,%esp
+  struct memstat ms;
+  int pid = argc > 1 ? atoi(argv[1]) : 0;
+      16:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      19:	8b 41 04             	mov    0x4(%ecx),%eax
+  int pid = argc > 1 ? atoi(argv[1]) : 0;
+      1c:	7e 10                	jle    2e <main+0x2e>
+      1e:	83 ec 0c             	sub    $0xc,%esp
+      21:	ff 70 04             	push   0x4(%eax)
+      24:	e8 47 04 00 00       	call   470 <atoi>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	89 c3                	mov    %eax,%ebx
+
+  if (memstat(pid, &ms) < 0)
+      2e:	83 ec 08             	sub    $0x8,%esp
+      31:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+      34:	50                   	push   %eax
+      35:	53                   	push   %ebx
+      36:	e8 38 06 00 00       	call   673 <memstat>
+      3b:	83 c4 10             	add    $0x10,%esp
+      3e:	85 c0                	test   %eax,%eax
+      40:	0f 88 c5 00 00 00    	js     10b <main+0x10b>
+  {
+    printf(2, "free: no process %d\n", pid);
+    exit();
+  }
+  printf(1, "memory:  total %d KB, free %d KB, used %d KB\n",
+         KB(ms.total), KB(ms.free), KB(ms.total - ms.free));
+      46:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+      49:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  printf(1, "memory:  total %d KB, free %d KB, used %d KB\n",
+      4c:	83 ec 0c             	sub    $0xc,%esp
+         KB(ms.total), KB(ms.free), KB(ms.total - ms.free));
+      4f:	89 c1                	mov    %eax,%ecx
+  printf(1, "memory:  total %d KB, free %d KB, used %d KB\n",
+      51:	c1 e0 02             	shl    $0x2,%eax
+         KB(ms.total), KB(ms.free), KB(ms.total - ms.free));
+      54:	29 d1                	sub    %edx,%ecx
+  printf(1, "memory:  total %d KB, free %d KB, used %d KB\n",
+      56:	c1 e2 02             	shl    $0x2,%edx
+      59:	c1 e1 02             	shl    $0x2,%ecx
+      5c:	51                   	push   %ecx
+      5d:	52                   	push   %edx
+      5e:	50                   	push   %eax
+      5f:	68 2c 10 00 00       	push   $0x102c
+      64:	6a 01                	push   $0x1
+      66:	e8 f5 07 00 00       	call   860 <printf>
+  printf(1, "kernel:  page tables %d KB, stacks %d KB, objects %d KB (pipes %d KB)\n",
+      6b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      6e:	83 c4 18             	add    $0x18,%esp
+      71:	c1 e0 02             	shl    $0x2,%eax
+      74:	50                   	push   %eax
+      75:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+      78:	c1 e0 02             	shl    $0x2,%eax
+      7b:	50                   	push   %eax
+      7c:	8b 45 c0             	mov    -0x40(%ebp),%eax
+      7f:	c1 e0 02             	shl    $0x2,%eax
+      82:	50                   	push   %eax
+      83:	8b 45 bc             	mov    -0x44(%ebp),%eax
+      86:	c1 e0 02             	shl    $0x2,%eax
+      89:	50                   	push   %eax
+      8a:	68 5c 10 00 00       	push   $0x105c
+      8f:	6a 01                	push   $0x1
+      91:	e8 ca 07 00 00       	call   860 <printf>
+         KB(ms.pgtables), KB(ms.kstacks), KB(ms.slab), KB(ms.pipes));
+  printf(1, "cache:   %d KB\n", KB(ms.pcache));
+      96:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      99:	83 c4 1c             	add    $0x1c,%esp
+      9c:	c1 e0 02             	shl    $0x2,%eax
+      9f:	50                   	push   %eax
+      a0:	68 19 10 00 00       	push   $0x1019
+      a5:	6a 01                	push   $0x1
+      a7:	e8 b4 07 00 00       	call   860 <printf>
+  printf(1, "swap:    total %d KB, free %d KB\n", KB(ms.swap), KB(ms.swapfree));
+      ac:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      af:	c1 e0 02             	shl    $0x2,%eax
+      b2:	50                   	push   %eax
+      b3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+      b6:	c1 e0 02             	shl    $0x2,%eax
+      b9:	50                   	push   %eax
+      ba:	68 a4 10 00 00       	push   $0x10a4
+      bf:	6a 01                	push   $0x1
+      c1:	e8 9a 07 00 00       	call   860 <printf>
+  printf(1, "pid %d: size %d KB, resident %d KB, shared %d KB, swapped %d KB\n",
+      c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      c9:	8b 75 d8             	mov    -0x28(%ebp),%esi
+      cc:	83 c4 20             	add    $0x20,%esp
+      cf:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+      d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      d9:	c1 ee 0a             	shr    $0xa,%esi
+      dc:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      e3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      e6:	8d 3c 85 00 00 00 00 	lea    0x0(,%eax,4),%edi
+      ed:	85 db                	test   %ebx,%ebx
+      ef:	74 2d                	je     11e <main+0x11e>
+      f1:	50                   	push   %eax
+      f2:	51                   	push   %ecx
+      f3:	52                   	push   %edx
+      f4:	57                   	push   %edi
+      f5:	56                   	push   %esi
+      f6:	53                   	push   %ebx
+      f7:	68 c8 10 00 00       	push   $0x10c8
+      fc:	6a 01                	push   $0x1
+      fe:	e8 5d 07 00 00       	call   860 <printf>
+         pid ? pid : getpid(), ms.sz / 1024, KB(ms.rss), KB(ms.shared),
+         KB(ms.swapped));
+  exit();
+     103:	83 c4 20             	add    $0x20,%esp
+     106:	e8 65 00 00 00       	call   170 <exit>
+    printf(2, "free: no process %d\n", pid);
+     10b:	52                   	push   %edx
+     10c:	53                   	push   %ebx
+     10d:	68 04 10 00 00       	push   $0x1004
+     112:	6a 02                	push   $0x2
+     114:	e8 47 07 00 00       	call   860 <printf>
+    exit();
+     119:	e8 52 00 00 00       	call   170 <exit>
+     11e:	89 55 a0             	mov    %edx,-0x60(%ebp)
+     121:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+         pid ? pid : getpid(), ms.sz / 1024, KB(ms.rss), KB(ms.shared),
+     124:	e8 3a 04 00 00       	call   563 <getpid>
+     129:	8b 55 a0             	mov    -0x60(%ebp),%edx
+     12c:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+     12f:	89 c3                	mov    %eax,%ebx
+     131:	eb be                	jmp    f1 <main+0xf1>
+     133:	66 90                	xchg   %ax,%ax
+     135:	66 90                	xchg   %ax,%ax
+     137:	66 90                	xchg   %ax,%ax
+     139:	66 90                	xchg   %ax,%ax
+     13b:	66 90                	xchg   %ax,%ax
+     13d:	66 90                	xchg   %ax,%ax
+     13f:	90                   	nop
+
+00000140 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     140:	a1 a0 15 00 00       	mov    0x15a0,%eax
+     145:	85 c0                	test   %eax,%eax
+     147:	74 17                	je     160 <fork+0x20>
+{
+     149:	55                   	push   %ebp
+     14a:	89 e5                	mov    %esp,%ebp
+     14c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     14f:	ff d0                	call   *%eax
+  return _fork();
+}
+     151:	c9                   	leave
+  return _fork();
+     152:	e9 84 03 00 00       	jmp    4db <_fork>
+     157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15e:	66 90                	xchg   %ax,%ax
+     160:	e9 76 03 00 00       	jmp    4db <_fork>
+     165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <exit>:
+
+int
+exit(void)
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     176:	a1 a0 15 00 00       	mov    0x15a0,%eax
+     17b:	85 c0                	test   %eax,%eax
+     17d:	74 02                	je     181 <exit+0x11>
+    stdioflush();
+     17f:	ff d0                	call   *%eax
+  _exit();
+     181:	e8 5d 03 00 00       	call   4e3 <_exit>
+     186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000190 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     190:	55                   	push   %ebp
+  if(stdioflush)
+     191:	a1 a0 15 00 00       	mov    0x15a0,%eax
+{
+     196:	89 e5                	mov    %esp,%ebp
+     198:	56                   	push   %esi
+     199:	53                   	push   %ebx
+     19a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     19d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     1a0:	85 c0                	test   %eax,%eax
+     1a2:	74 02                	je     1a6 <exec+0x16>
+    stdioflush();
+     1a4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     1a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1ac:	5b                   	pop    %ebx
+     1ad:	5e                   	pop    %esi
+     1ae:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     1af:	e9 67 03 00 00       	jmp    51b <_exec>
+     1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1bf:	90                   	nop
+
+000001c0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	57                   	push   %edi
+     1c4:	56                   	push   %esi
+     1c5:	53                   	push   %ebx
+     1c6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     1c9:	a1 a0 15 00 00       	mov    0x15a0,%eax
+{
+     1ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     1d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     1d7:	85 c0                	test   %eax,%eax
+     1d9:	74 02                	je     1dd <spawn+0x1d>
+    stdioflush();
+     1db:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     1dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     1e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1e6:	83 c4 0c             	add    $0xc,%esp
+     1e9:	5b                   	pop    %ebx
+     1ea:	5e                   	pop    %esi
+     1eb:	5f                   	pop    %edi
+     1ec:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     1ed:	e9 79 04 00 00       	jmp    66b <_spawn>
+     1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     201:	31 c0                	xor    %eax,%eax
+{
+     203:	89 e5                	mov    %esp,%ebp
+     205:	53                   	push   %ebx
+     206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     217:	83 c0 01             	add    $0x1,%eax
+     21a:	84 d2                	test   %dl,%dl
+     21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+     21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     221:	89 c8                	mov    %ecx,%eax
+     223:	c9                   	leave
+     224:	c3                   	ret
+     225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	53                   	push   %ebx
+     234:	8b 55 08             	mov    0x8(%ebp),%edx
+     237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     23a:	0f b6 02             	movzbl (%edx),%eax
+     23d:	84 c0                	test   %al,%al
+     23f:	75 17                	jne    258 <strcmp+0x28>
+     241:	eb 3a                	jmp    27d <strcmp+0x4d>
+     243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     247:	90                   	nop
+     248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     24c:	83 c2 01             	add    $0x1,%edx
+     24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     252:	84 c0                	test   %al,%al
+     254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+     256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     258:	0f b6 19             	movzbl (%ecx),%ebx
+     25b:	38 c3                	cmp    %al,%bl
+     25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     25f:	29 d8                	sub    %ebx,%eax
+}
+     261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     264:	c9                   	leave
+     265:	c3                   	ret
+     266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     274:	31 c0                	xor    %eax,%eax
+     276:	29 d8                	sub    %ebx,%eax
+}
+     278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     27b:	c9                   	leave
+     27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     27d:	0f b6 19             	movzbl (%ecx),%ebx
+     280:	31 c0                	xor    %eax,%eax
+     282:	eb db                	jmp    25f <strcmp+0x2f>
+     284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     296:	80 3a 00             	cmpb   $0x0,(%edx)
+     299:	74 15                	je     2b0 <strlen+0x20>
+     29b:	31 c0                	xor    %eax,%eax
+     29d:	8d 76 00             	lea    0x0(%esi),%esi
+     2a0:	83 c0 01             	add    $0x1,%eax
+     2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2a7:	89 c1                	mov    %eax,%ecx
+     2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+     2ab:	89 c8                	mov    %ecx,%eax
+     2ad:	5d                   	pop    %ebp
+     2ae:	c3                   	ret
+     2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2b0:	31 c9                	xor    %ecx,%ecx
+}
+     2b2:	5d                   	pop    %ebp
+     2b3:	89 c8                	mov    %ecx,%eax
+     2b5:	c3                   	ret
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	57                   	push   %edi
+     2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2cd:	89 d7                	mov    %edx,%edi
+     2cf:	fc                   	cld
+     2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     2d5:	89 d0                	mov    %edx,%eax
+     2d7:	c9                   	leave
+     2d8:	c3                   	ret
+     2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2ea:	0f b6 10             	movzbl (%eax),%edx
+     2ed:	84 d2                	test   %dl,%dl
+     2ef:	75 12                	jne    303 <strchr+0x23>
+     2f1:	eb 1d                	jmp    310 <strchr+0x30>
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+     2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     2fc:	83 c0 01             	add    $0x1,%eax
+     2ff:	84 d2                	test   %dl,%dl
+     301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+     303:	38 d1                	cmp    %dl,%cl
+     305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     307:	5d                   	pop    %ebp
+     308:	c3                   	ret
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     310:	31 c0                	xor    %eax,%eax
+}
+     312:	5d                   	pop    %ebp
+     313:	c3                   	ret
+     314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     31f:	90                   	nop
+
+00000320 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	57                   	push   %edi
+     324:	56                   	push   %esi
+     325:	53                   	push   %ebx
+     326:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     329:	a1 a0 15 00 00       	mov    0x15a0,%eax
+{
+     32e:	8b 75 08             	mov    0x8(%ebp),%esi
+     331:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     334:	85 c0                	test   %eax,%eax
+     336:	74 02                	je     33a <gets+0x1a>
+    stdioflush();
+     338:	ff d0                	call   *%eax
+  if(in.size == 0)
+     33a:	a1 c8 17 00 00       	mov    0x17c8,%eax
+     33f:	85 c0                	test   %eax,%eax
+     341:	0f 84 99 00 00 00    	je     3e0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     347:	31 db                	xor    %ebx,%ebx
+     349:	eb 21                	jmp    36c <gets+0x4c>
+     34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     34f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     350:	8d 50 01             	lea    0x1(%eax),%edx
+     353:	0f b6 80 c0 15 00 00 	movzbl 0x15c0(%eax),%eax
+     35a:	89 15 c0 17 00 00    	mov    %edx,0x17c0
+    buf[i++] = c;
+     360:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     364:	3c 0a                	cmp    $0xa,%al
+     366:	74 60                	je     3c8 <gets+0xa8>
+     368:	3c 0d                	cmp    $0xd,%al
+     36a:	74 5c                	je     3c8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     36c:	89 da                	mov    %ebx,%edx
+     36e:	83 c3 01             	add    $0x1,%ebx
+     371:	39 fb                	cmp    %edi,%ebx
+     373:	7d 55                	jge    3ca <gets+0xaa>
+    if(in.r == in.n){
+     375:	a1 c0 17 00 00       	mov    0x17c0,%eax
+     37a:	3b 05 c4 17 00 00    	cmp    0x17c4,%eax
+     380:	75 ce                	jne    350 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     382:	83 ec 04             	sub    $0x4,%esp
+     385:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     388:	c7 05 c4 17 00 00 00 	movl   $0x0,0x17c4
+     38f:	00 00 00 
+     392:	c7 05 c0 17 00 00 00 	movl   $0x0,0x17c0
+     399:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     39c:	ff 35 c8 17 00 00    	push   0x17c8
+     3a2:	68 c0 15 00 00       	push   $0x15c0
+     3a7:	6a 00                	push   $0x0
+     3a9:	e8 4d 01 00 00       	call   4fb <read>
+     3ae:	83 c4 10             	add    $0x10,%esp
+     3b1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     3b4:	85 c0                	test   %eax,%eax
+     3b6:	a3 c4 17 00 00       	mov    %eax,0x17c4
+     3bb:	7e 56                	jle    413 <gets+0xf3>
+    c = in.buf[in.r++];
+     3bd:	a1 c0 17 00 00       	mov    0x17c0,%eax
+     3c2:	eb 8c                	jmp    350 <gets+0x30>
+     3c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     3c8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     3ca:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     3ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d1:	89 f0                	mov    %esi,%eax
+     3d3:	5b                   	pop    %ebx
+     3d4:	5e                   	pop    %esi
+     3d5:	5f                   	pop    %edi
+     3d6:	5d                   	pop    %ebp
+     3d7:	c3                   	ret
+     3d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3df:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     3e0:	83 ec 08             	sub    $0x8,%esp
+     3e3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3e6:	50                   	push   %eax
+     3e7:	6a 00                	push   $0x0
+     3e9:	e8 4d 01 00 00       	call   53b <fstat>
+     3ee:	83 c4 10             	add    $0x10,%esp
+     3f1:	89 c2                	mov    %eax,%edx
+     3f3:	b8 01 00 00 00       	mov    $0x1,%eax
+     3f8:	85 d2                	test   %edx,%edx
+     3fa:	75 0d                	jne    409 <gets+0xe9>
+     3fc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     401:	ba 00 02 00 00       	mov    $0x200,%edx
+     406:	0f 44 c2             	cmove  %edx,%eax
+     409:	a3 c8 17 00 00       	mov    %eax,0x17c8
+     40e:	e9 34 ff ff ff       	jmp    347 <gets+0x27>
+        in.n = 0;
+     413:	c7 05 c4 17 00 00 00 	movl   $0x0,0x17c4
+     41a:	00 00 00 
+        break;
+     41d:	eb ab                	jmp    3ca <gets+0xaa>
+     41f:	90                   	nop
+
+00000420 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	56                   	push   %esi
+     424:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     425:	83 ec 08             	sub    $0x8,%esp
+     428:	6a 00                	push   $0x0
+     42a:	ff 75 08             	push   0x8(%ebp)
+     42d:	e8 f1 00 00 00       	call   523 <open>
+  if(fd < 0)
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	78 27                	js     460 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     439:	83 ec 08             	sub    $0x8,%esp
+     43c:	ff 75 0c             	push   0xc(%ebp)
+     43f:	89 c3                	mov    %eax,%ebx
+     441:	50                   	push   %eax
+     442:	e8 f4 00 00 00       	call   53b <fstat>
+  close(fd);
+     447:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     44a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     44c:	e8 ba 00 00 00       	call   50b <close>
+  return r;
+     451:	83 c4 10             	add    $0x10,%esp
+}
+     454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     457:	89 f0                	mov    %esi,%eax
+     459:	5b                   	pop    %ebx
+     45a:	5e                   	pop    %esi
+     45b:	5d                   	pop    %ebp
+     45c:	c3                   	ret
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     460:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     465:	eb ed                	jmp    454 <stat+0x34>
+     467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46e:	66 90                	xchg   %ax,%ax
+
+00000470 <atoi>:
+
+int
+atoi(const char *s)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     477:	0f be 02             	movsbl (%edx),%eax
+     47a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     47d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     485:	77 1e                	ja     4a5 <atoi+0x35>
+     487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     490:	83 c2 01             	add    $0x1,%edx
+     493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     49a:	0f be 02             	movsbl (%edx),%eax
+     49d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4a0:	80 fb 09             	cmp    $0x9,%bl
+     4a3:	76 eb                	jbe    490 <atoi+0x20>
+  return n;
+}
+     4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a8:	89 c8                	mov    %ecx,%eax
+     4aa:	c9                   	leave
+     4ab:	c3                   	ret
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	57                   	push   %edi
+     4b4:	56                   	push   %esi
+     4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     4be:	85 c0                	test   %eax,%eax
+     4c0:	7e 13                	jle    4d5 <memmove+0x25>
+     4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4c4:	89 d7                	mov    %edx,%edi
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4d1:	39 f8                	cmp    %edi,%eax
+     4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+     4d5:	5e                   	pop    %esi
+     4d6:	89 d0                	mov    %edx,%eax
+     4d8:	5f                   	pop    %edi
+     4d9:	5d                   	pop    %ebp
+     4da:	c3                   	ret
+
+000004db <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     4db:	b8 01 00 00 00       	mov    $0x1,%eax
+     4e0:	cd 40                	int    $0x40
+     4e2:	c3                   	ret
+
+000004e3 <_exit>:
+RAWSYSCALL(exit)
+     4e3:	b8 02 00 00 00       	mov    $0x2,%eax
+     4e8:	cd 40                	int    $0x40
+     4ea:	c3                   	ret
+
+000004eb <wait>:
+SYSCALL(wait)
+     4eb:	b8 03 00 00 00       	mov    $0x3,%eax
+     4f0:	cd 40                	int    $0x40
+     4f2:	c3                   	ret
+
+000004f3 <pipe>:
+SYSCALL(pipe)
+     4f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     4f8:	cd 40                	int    $0x40
+     4fa:	c3                   	ret
+
+000004fb <read>:
+SYSCALL(read)
+     4fb:	b8 05 00 00 00       	mov    $0x5,%eax
+     500:	cd 40                	int    $0x40
+     502:	c3                   	ret
+
+00000503 <write>:
+SYSCALL(write)
+     503:	b8 10 00 00 00       	mov    $0x10,%eax
+     508:	cd 40                	int    $0x40
+     50a:	c3                   	ret
+
+0000050b <close>:
+SYSCALL(close)
+     50b:	b8 15 00 00 00       	mov    $0x15,%eax
+     510:	cd 40                	int    $0x40
+     512:	c3                   	ret
+
+00000513 <kill>:
+SYSCALL(kill)
+     513:	b8 06 00 00 00       	mov    $0x6,%eax
+     518:	cd 40                	int    $0x40
+     51a:	c3                   	ret
+
+0000051b <_exec>:
+RAWSYSCALL(exec)
+     51b:	b8 07 00 00 00       	mov    $0x7,%eax
+     520:	cd 40                	int    $0x40
+     522:	c3                   	ret
+
+00000523 <open>:
+SYSCALL(open)
+     523:	b8 0f 00 00 00       	mov    $0xf,%eax
+     528:	cd 40                	int    $0x40
+     52a:	c3                   	ret
+
+0000052b <mknod>:
+SYSCALL(mknod)
+     52b:	b8 11 00 00 00       	mov    $0x11,%eax
+     530:	cd 40                	int    $0x40
+     532:	c3                   	ret
+
+00000533 <unlink>:
+SYSCALL(unlink)
+     533:	b8 12 00 00 00       	mov    $0x12,%eax
+     538:	cd 40                	int    $0x40
+     53a:	c3                   	ret
+
+0000053b <fstat>:
+SYSCALL(fstat)
+     53b:	b8 08 00 00 00       	mov    $0x8,%eax
+     540:	cd 40                	int    $0x40
+     542:	c3                   	ret
+
+00000543 <link>:
+SYSCALL(link)
+     543:	b8 13 00 00 00       	mov    $0x13,%eax
+     548:	cd 40                	int    $0x40
+     54a:	c3                   	ret
+
+0000054b <mkdir>:
+SYSCALL(mkdir)
+     54b:	b8 14 00 00 00       	mov    $0x14,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <chdir>:
+SYSCALL(chdir)
+     553:	b8 09 00 00 00       	mov    $0x9,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <dup>:
+SYSCALL(dup)
+     55b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <getpid>:
+SYSCALL(getpid)
+     563:	b8 0b 00 00 00       	mov    $0xb,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <sbrk>:
+SYSCALL(sbrk)
+     56b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <sleep>:
+SYSCALL(sleep)
+     573:	b8 0d 00 00 00       	mov    $0xd,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <uptime>:
+SYSCALL(uptime)
+     57b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     583:	b8 16 00 00 00       	mov    $0x16,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <get_parent_id>:
+SYSCALL(get_parent_id)
+     58b:	b8 17 00 00 00       	mov    $0x17,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <get_children>:
+SYSCALL(get_children)
+     593:	b8 18 00 00 00       	mov    $0x18,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <set_path>:
+SYSCALL(set_path)
+     59b:	b8 19 00 00 00       	mov    $0x19,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <set_sleep>:
+SYSCALL(set_sleep)
+     5a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <get_time>:
+SYSCALL(get_time)
+     5ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <change_process_level>:
+SYSCALL(change_process_level)
+     5b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     5bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     5c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <print_processes_info>:
+SYSCALL(print_processes_info)
+     5cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <barrier_init>:
+
+SYSCALL(barrier_init)
+     5d3:	b8 20 00 00 00       	mov    $0x20,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <barrier_wait>:
+SYSCALL(barrier_wait)
+     5db:	b8 21 00 00 00       	mov    $0x21,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     5e3:	b8 22 00 00 00       	mov    $0x22,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     5eb:	b8 23 00 00 00       	mov    $0x23,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <set_process_gang>:
+SYSCALL(set_process_gang)
+     5f3:	b8 24 00 00 00       	mov    $0x24,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     5fb:	b8 25 00 00 00       	mov    $0x25,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <sem_create>:
+SYSCALL(sem_create)
+     603:	b8 26 00 00 00       	mov    $0x26,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <event_create>:
+SYSCALL(event_create)
+     60b:	b8 27 00 00 00       	mov    $0x27,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <sync_post>:
+SYSCALL(sync_post)
+     613:	b8 28 00 00 00       	mov    $0x28,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <sync_wait>:
+SYSCALL(sync_wait)
+     61b:	b8 29 00 00 00       	mov    $0x29,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <sync_close>:
+SYSCALL(sync_close)
+     623:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <event_reset>:
+SYSCALL(event_reset)
+     62b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     633:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <mmap>:
+SYSCALL(mmap)
+     63b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <munmap>:
+SYSCALL(munmap)
+     643:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <shmget>:
+SYSCALL(shmget)
+     64b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <shmat>:
+SYSCALL(shmat)
+     653:	b8 30 00 00 00       	mov    $0x30,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <shmdt>:
+SYSCALL(shmdt)
+     65b:	b8 31 00 00 00       	mov    $0x31,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <shmrm>:
+SYSCALL(shmrm)
+     663:	b8 32 00 00 00       	mov    $0x32,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <_spawn>:
+RAWSYSCALL(spawn)
+     66b:	b8 33 00 00 00       	mov    $0x33,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <memstat>:
+SYSCALL(memstat)
+     673:	b8 34 00 00 00       	mov    $0x34,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+     67b:	66 90                	xchg   %ax,%ax
+     67d:	66 90                	xchg   %ax,%ax
+     67f:	90                   	nop
+
+00000680 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     686:	a1 08 1a 00 00       	mov    0x1a08,%eax
+     68b:	85 c0                	test   %eax,%eax
+     68d:	7e 17                	jle    6a6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     68f:	83 ec 04             	sub    $0x4,%esp
+     692:	50                   	push   %eax
+     693:	68 0c 1a 00 00       	push   $0x1a0c
+     698:	ff 35 00 1a 00 00    	push   0x1a00
+     69e:	e8 60 fe ff ff       	call   503 <write>
+     6a3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     6a6:	c7 05 08 1a 00 00 00 	movl   $0x0,0x1a08
+     6ad:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     6b0:	c7 05 04 1a 00 00 00 	movl   $0x0,0x1a04
+     6b7:	00 00 00 
+}
+     6ba:	c9                   	leave
+     6bb:	c3                   	ret
+     6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6c6:	89 d1                	mov    %edx,%ecx
+{
+     6c8:	56                   	push   %esi
+     6c9:	53                   	push   %ebx
+     6ca:	89 c3                	mov    %eax,%ebx
+     6cc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     6cf:	85 d2                	test   %edx,%edx
+     6d1:	0f 89 b9 00 00 00    	jns    790 <printint+0xd0>
+     6d7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     6db:	0f 84 af 00 00 00    	je     790 <printint+0xd0>
+    x = -xx;
+     6e1:	f7 d9                	neg    %ecx
+    neg = 1;
+     6e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     6e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     6eb:	31 f6                	xor    %esi,%esi
+     6ed:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     6f0:	89 c8                	mov    %ecx,%eax
+     6f2:	31 d2                	xor    %edx,%edx
+     6f4:	89 f3                	mov    %esi,%ebx
+     6f6:	f7 f7                	div    %edi
+     6f8:	8d 76 01             	lea    0x1(%esi),%esi
+     6fb:	0f b6 92 68 11 00 00 	movzbl 0x1168(%edx),%edx
+     702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     706:	89 ca                	mov    %ecx,%edx
+     708:	89 c1                	mov    %eax,%ecx
+     70a:	39 fa                	cmp    %edi,%edx
+     70c:	73 e2                	jae    6f0 <printint+0x30>
+  if(neg)
+     70e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     711:	89 d9                	mov    %ebx,%ecx
+     713:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     716:	85 c0                	test   %eax,%eax
+     718:	74 07                	je     721 <printint+0x61>
+    buf[i++] = '-';
+     71a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     71f:	89 f1                	mov    %esi,%ecx
+     721:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     724:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     726:	8d 43 0c             	lea    0xc(%ebx),%eax
+     729:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     72c:	01 f7                	add    %esi,%edi
+     72e:	eb 09                	jmp    739 <printint+0x79>
+
+  while(--i >= 0)
+     730:	8d 47 ff             	lea    -0x1(%edi),%eax
+     733:	39 f7                	cmp    %esi,%edi
+     735:	74 36                	je     76d <printint+0xad>
+     737:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     739:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     73c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     73f:	8d 42 01             	lea    0x1(%edx),%eax
+     742:	89 43 08             	mov    %eax,0x8(%ebx)
+     745:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     749:	3d 00 02 00 00       	cmp    $0x200,%eax
+     74e:	74 28                	je     778 <printint+0xb8>
+     750:	80 f9 0a             	cmp    $0xa,%cl
+     753:	75 db                	jne    730 <printint+0x70>
+     755:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     759:	75 d5                	jne    730 <printint+0x70>
+  if(b->n > 0)
+     75b:	85 c0                	test   %eax,%eax
+     75d:	7f 19                	jg     778 <printint+0xb8>
+  b->n = 0;
+     75f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     766:	8d 47 ff             	lea    -0x1(%edi),%eax
+     769:	39 f7                	cmp    %esi,%edi
+     76b:	75 ca                	jne    737 <printint+0x77>
+}
+     76d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     770:	5b                   	pop    %ebx
+     771:	5e                   	pop    %esi
+     772:	5f                   	pop    %edi
+     773:	5d                   	pop    %ebp
+     774:	c3                   	ret
+     775:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     778:	83 ec 04             	sub    $0x4,%esp
+     77b:	50                   	push   %eax
+     77c:	ff 75 d4             	push   -0x2c(%ebp)
+     77f:	ff 33                	push   (%ebx)
+     781:	e8 7d fd ff ff       	call   503 <write>
+     786:	83 c4 10             	add    $0x10,%esp
+     789:	eb d4                	jmp    75f <printint+0x9f>
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+  neg = 0;
+     790:	31 c0                	xor    %eax,%eax
+     792:	e9 51 ff ff ff       	jmp    6e8 <printint+0x28>
+     797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <putc>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	53                   	push   %ebx
+     7a4:	89 c3                	mov    %eax,%ebx
+     7a6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     7a9:	8b 48 08             	mov    0x8(%eax),%ecx
+     7ac:	8d 41 01             	lea    0x1(%ecx),%eax
+     7af:	89 43 08             	mov    %eax,0x8(%ebx)
+     7b2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7b6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7bb:	74 33                	je     7f0 <putc+0x50>
+     7bd:	80 fa 0a             	cmp    $0xa,%dl
+     7c0:	74 0e                	je     7d0 <putc+0x30>
+}
+     7c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7c5:	c9                   	leave
+     7c6:	c3                   	ret
+     7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ce:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7d0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     7d4:	75 ec                	jne    7c2 <putc+0x22>
+  if(b->n > 0)
+     7d6:	85 c0                	test   %eax,%eax
+     7d8:	7f 16                	jg     7f0 <putc+0x50>
+  b->n = 0;
+     7da:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     7e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7e4:	c9                   	leave
+     7e5:	c3                   	ret
+     7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     7f0:	83 ec 04             	sub    $0x4,%esp
+     7f3:	50                   	push   %eax
+     7f4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     7f7:	50                   	push   %eax
+     7f8:	ff 33                	push   (%ebx)
+     7fa:	e8 04 fd ff ff       	call   503 <write>
+     7ff:	83 c4 10             	add    $0x10,%esp
+     802:	eb d6                	jmp    7da <putc+0x3a>
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <fflush>:
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     816:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     81a:	74 04                	je     820 <fflush+0x10>
+}
+     81c:	c9                   	leave
+     81d:	c3                   	ret
+     81e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     820:	a1 08 1a 00 00       	mov    0x1a08,%eax
+     825:	85 c0                	test   %eax,%eax
+     827:	7f 17                	jg     840 <fflush+0x30>
+  b->n = 0;
+     829:	c7 05 08 1a 00 00 00 	movl   $0x0,0x1a08
+     830:	00 00 00 
+  out.mode = 0;
+     833:	c7 05 04 1a 00 00 00 	movl   $0x0,0x1a04
+     83a:	00 00 00 
+}
+     83d:	c9                   	leave
+     83e:	c3                   	ret
+     83f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     840:	83 ec 04             	sub    $0x4,%esp
+     843:	50                   	push   %eax
+     844:	68 0c 1a 00 00       	push   $0x1a0c
+     849:	ff 35 00 1a 00 00    	push   0x1a00
+     84f:	e8 af fc ff ff       	call   503 <write>
+     854:	83 c4 10             	add    $0x10,%esp
+     857:	eb d0                	jmp    829 <fflush+0x19>
+     859:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000860 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	53                   	push   %ebx
+     866:	83 ec 3c             	sub    $0x3c,%esp
+     869:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     86c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     86f:	83 fe 01             	cmp    $0x1,%esi
+     872:	0f 84 60 01 00 00    	je     9d8 <printf+0x178>
+    b->fd = fd;
+     878:	89 35 e0 17 00 00    	mov    %esi,0x17e0
+  for(i = 0; fmt[i]; i++){
+     87e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     881:	bf e0 17 00 00       	mov    $0x17e0,%edi
+  for(i = 0; fmt[i]; i++){
+     886:	84 c0                	test   %al,%al
+     888:	74 65                	je     8ef <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     88a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     88d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     890:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     892:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     895:	eb 1f                	jmp    8b6 <printf+0x56>
+     897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     8a0:	83 f8 25             	cmp    $0x25,%eax
+     8a3:	74 3b                	je     8e0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     8a5:	89 f8                	mov    %edi,%eax
+     8a7:	e8 f4 fe ff ff       	call   7a0 <putc>
+  for(i = 0; fmt[i]; i++){
+     8ac:	0f b6 03             	movzbl (%ebx),%eax
+     8af:	83 c3 01             	add    $0x1,%ebx
+     8b2:	84 c0                	test   %al,%al
+     8b4:	74 39                	je     8ef <printf+0x8f>
+    c = fmt[i] & 0xff;
+     8b6:	0f be d0             	movsbl %al,%edx
+     8b9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     8bc:	85 f6                	test   %esi,%esi
+     8be:	74 e0                	je     8a0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     8c0:	83 fe 25             	cmp    $0x25,%esi
+     8c3:	75 e7                	jne    8ac <printf+0x4c>
+      if(c == 'd'){
+     8c5:	83 f8 25             	cmp    $0x25,%eax
+     8c8:	74 57                	je     921 <printf+0xc1>
+     8ca:	83 e8 63             	sub    $0x63,%eax
+     8cd:	83 f8 15             	cmp    $0x15,%eax
+     8d0:	77 36                	ja     908 <printf+0xa8>
+     8d2:	ff 24 85 10 11 00 00 	jmp    *0x1110(,%eax,4)
+     8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     8e0:	0f b6 03             	movzbl (%ebx),%eax
+     8e3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     8e6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     8eb:	84 c0                	test   %al,%al
+     8ed:	75 c7                	jne    8b6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     8ef:	8b 47 04             	mov    0x4(%edi),%eax
+     8f2:	85 c0                	test   %eax,%eax
+     8f4:	0f 84 06 01 00 00    	je     a00 <printf+0x1a0>
+    bflush(b);
+}
+     8fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8fd:	5b                   	pop    %ebx
+     8fe:	5e                   	pop    %esi
+     8ff:	5f                   	pop    %edi
+     900:	5d                   	pop    %ebp
+     901:	c3                   	ret
+     902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     908:	8b 4f 08             	mov    0x8(%edi),%ecx
+     90b:	8d 41 01             	lea    0x1(%ecx),%eax
+     90e:	89 47 08             	mov    %eax,0x8(%edi)
+     911:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     916:	3d 00 02 00 00       	cmp    $0x200,%eax
+     91b:	0f 84 77 01 00 00    	je     a98 <printf+0x238>
+        putc(b, c);
+     921:	89 f8                	mov    %edi,%eax
+      state = 0;
+     923:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     925:	e8 76 fe ff ff       	call   7a0 <putc>
+     92a:	eb 80                	jmp    8ac <printf+0x4c>
+     92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     930:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     933:	83 ec 0c             	sub    $0xc,%esp
+     936:	b9 10 00 00 00       	mov    $0x10,%ecx
+     93b:	8b 16                	mov    (%esi),%edx
+     93d:	6a 00                	push   $0x0
+        ap++;
+     93f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     942:	89 f8                	mov    %edi,%eax
+     944:	e8 77 fd ff ff       	call   6c0 <printint>
+        ap++;
+     949:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     94c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     94f:	31 f6                	xor    %esi,%esi
+     951:	e9 56 ff ff ff       	jmp    8ac <printf+0x4c>
+     956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     960:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     963:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     965:	83 c0 04             	add    $0x4,%eax
+     968:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     96b:	85 c9                	test   %ecx,%ecx
+     96d:	0f 84 cd 00 00 00    	je     a40 <printf+0x1e0>
+        while(*s != 0){
+     973:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     976:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     978:	84 d2                	test   %dl,%dl
+     97a:	0f 84 2c ff ff ff    	je     8ac <printf+0x4c>
+          putc(b, *s);
+     980:	89 f8                	mov    %edi,%eax
+     982:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     985:	e8 16 fe ff ff       	call   7a0 <putc>
+          s++;
+     98a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     98d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     991:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     994:	84 d2                	test   %dl,%dl
+     996:	75 e8                	jne    980 <printf+0x120>
+      state = 0;
+     998:	31 f6                	xor    %esi,%esi
+     99a:	e9 0d ff ff ff       	jmp    8ac <printf+0x4c>
+     99f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     9a0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9a3:	83 ec 0c             	sub    $0xc,%esp
+     9a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9ab:	8b 16                	mov    (%esi),%edx
+     9ad:	6a 01                	push   $0x1
+     9af:	eb 8e                	jmp    93f <printf+0xdf>
+     9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     9b8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9bb:	89 f8                	mov    %edi,%eax
+     9bd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     9c0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     9c3:	e8 d8 fd ff ff       	call   7a0 <putc>
+        ap++;
+     9c8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     9cb:	31 f6                	xor    %esi,%esi
+     9cd:	e9 da fe ff ff       	jmp    8ac <printf+0x4c>
+     9d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     9d8:	8b 15 04 1a 00 00    	mov    0x1a04,%edx
+     9de:	85 d2                	test   %edx,%edx
+     9e0:	74 6e                	je     a50 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     9e2:	0f b6 03             	movzbl (%ebx),%eax
+     9e5:	bf 00 1a 00 00       	mov    $0x1a00,%edi
+     9ea:	84 c0                	test   %al,%al
+     9ec:	0f 85 98 fe ff ff    	jne    88a <printf+0x2a>
+     9f2:	e9 03 ff ff ff       	jmp    8fa <printf+0x9a>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a00:	8b 47 08             	mov    0x8(%edi),%eax
+     a03:	85 c0                	test   %eax,%eax
+     a05:	7f 19                	jg     a20 <printf+0x1c0>
+  b->n = 0;
+     a07:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     a0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a11:	5b                   	pop    %ebx
+     a12:	5e                   	pop    %esi
+     a13:	5f                   	pop    %edi
+     a14:	5d                   	pop    %ebp
+     a15:	c3                   	ret
+     a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a20:	83 ec 04             	sub    $0x4,%esp
+     a23:	50                   	push   %eax
+     a24:	8d 47 0c             	lea    0xc(%edi),%eax
+     a27:	50                   	push   %eax
+     a28:	ff 37                	push   (%edi)
+     a2a:	e8 d4 fa ff ff       	call   503 <write>
+  b->n = 0;
+     a2f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     a36:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a39:	eb d3                	jmp    a0e <printf+0x1ae>
+     a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+     a40:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     a45:	b9 09 11 00 00       	mov    $0x1109,%ecx
+     a4a:	e9 31 ff ff ff       	jmp    980 <printf+0x120>
+     a4f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a50:	83 ec 08             	sub    $0x8,%esp
+     a53:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     a56:	c7 05 00 1a 00 00 01 	movl   $0x1,0x1a00
+     a5d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a60:	50                   	push   %eax
+     a61:	6a 01                	push   $0x1
+     a63:	e8 d3 fa ff ff       	call   53b <fstat>
+     a68:	83 c4 10             	add    $0x10,%esp
+     a6b:	85 c0                	test   %eax,%eax
+     a6d:	75 22                	jne    a91 <printf+0x231>
+     a6f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     a74:	b8 02 00 00 00       	mov    $0x2,%eax
+     a79:	0f 45 f0             	cmovne %eax,%esi
+     a7c:	89 35 04 1a 00 00    	mov    %esi,0x1a04
+      stdioflush = flushout;
+     a82:	c7 05 a0 15 00 00 80 	movl   $0x680,0x15a0
+     a89:	06 00 00 
+     a8c:	e9 51 ff ff ff       	jmp    9e2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a91:	be 02 00 00 00       	mov    $0x2,%esi
+     a96:	eb e4                	jmp    a7c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     a98:	83 ec 04             	sub    $0x4,%esp
+     a9b:	8d 47 0c             	lea    0xc(%edi),%eax
+     a9e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     aa1:	68 00 02 00 00       	push   $0x200
+     aa6:	50                   	push   %eax
+     aa7:	ff 37                	push   (%edi)
+     aa9:	e8 55 fa ff ff       	call   503 <write>
+  b->n = 0;
+     aae:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     ab5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     ab8:	83 c4 10             	add    $0x10,%esp
+     abb:	e9 61 fe ff ff       	jmp    921 <printf+0xc1>
+
+00000ac0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	56                   	push   %esi
+     ac4:	53                   	push   %ebx
+     ac5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     ac7:	a1 20 1c 00 00       	mov    0x1c20,%eax
+     acc:	39 d8                	cmp    %ebx,%eax
+     ace:	0f 83 e4 00 00 00    	jae    bb8 <freepages+0xf8>
+     ad4:	85 c0                	test   %eax,%eax
+     ad6:	0f 84 dc 00 00 00    	je     bb8 <freepages+0xf8>
+     adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ae0:	89 c2                	mov    %eax,%edx
+     ae2:	8b 00                	mov    (%eax),%eax
+     ae4:	85 c0                	test   %eax,%eax
+     ae6:	74 04                	je     aec <freepages+0x2c>
+     ae8:	39 d8                	cmp    %ebx,%eax
+     aea:	72 f4                	jb     ae0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     aec:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     aef:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     af1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     af3:	85 c0                	test   %eax,%eax
+     af5:	74 15                	je     b0c <freepages+0x4c>
+    p->prev = s;
+     af7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     afa:	8b 73 10             	mov    0x10(%ebx),%esi
+     afd:	89 f1                	mov    %esi,%ecx
+     aff:	c1 e1 0c             	shl    $0xc,%ecx
+     b02:	01 d9                	add    %ebx,%ecx
+     b04:	39 c8                	cmp    %ecx,%eax
+     b06:	0f 84 d8 00 00 00    	je     be4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     b0c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     b0f:	89 c8                	mov    %ecx,%eax
+     b11:	c1 e0 0c             	shl    $0xc,%eax
+     b14:	01 d0                	add    %edx,%eax
+     b16:	39 c3                	cmp    %eax,%ebx
+     b18:	74 16                	je     b30 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b1a:	8b 03                	mov    (%ebx),%eax
+     b1c:	85 c0                	test   %eax,%eax
+     b1e:	74 40                	je     b60 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     b20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b23:	5b                   	pop    %ebx
+     b24:	5e                   	pop    %esi
+     b25:	5d                   	pop    %ebp
+     b26:	c3                   	ret
+     b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     b30:	03 4b 10             	add    0x10(%ebx),%ecx
+     b33:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     b36:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     b39:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b3b:	85 c9                	test   %ecx,%ecx
+     b3d:	0f 84 dd 00 00 00    	je     c20 <freepages+0x160>
+    s->prev->next = s->next;
+     b43:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     b45:	85 c0                	test   %eax,%eax
+     b47:	74 06                	je     b4f <freepages+0x8f>
+    s->next->prev = s->prev;
+     b49:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b4c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b4f:	8b 02                	mov    (%edx),%eax
+     b51:	89 d3                	mov    %edx,%ebx
+     b53:	85 c0                	test   %eax,%eax
+     b55:	75 c9                	jne    b20 <freepages+0x60>
+     b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5e:	66 90                	xchg   %ax,%ax
+     b60:	8b 43 10             	mov    0x10(%ebx),%eax
+     b63:	83 f8 0f             	cmp    $0xf,%eax
+     b66:	76 b8                	jbe    b20 <freepages+0x60>
+     b68:	83 ec 0c             	sub    $0xc,%esp
+     b6b:	c1 e0 0c             	shl    $0xc,%eax
+     b6e:	6a 00                	push   $0x0
+     b70:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     b73:	e8 f3 f9 ff ff       	call   56b <sbrk>
+     b78:	83 c4 10             	add    $0x10,%esp
+     b7b:	39 c6                	cmp    %eax,%esi
+     b7d:	75 a1                	jne    b20 <freepages+0x60>
+  if(s->prev)
+     b7f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     b82:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b84:	85 d2                	test   %edx,%edx
+     b86:	0f 84 a5 00 00 00    	je     c31 <freepages+0x171>
+    s->prev->next = s->next;
+     b8c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     b8e:	85 c0                	test   %eax,%eax
+     b90:	74 06                	je     b98 <freepages+0xd8>
+    s->next->prev = s->prev;
+     b92:	8b 53 04             	mov    0x4(%ebx),%edx
+     b95:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     b98:	8b 43 10             	mov    0x10(%ebx),%eax
+     b9b:	83 ec 0c             	sub    $0xc,%esp
+     b9e:	c1 e0 0c             	shl    $0xc,%eax
+     ba1:	f7 d8                	neg    %eax
+     ba3:	50                   	push   %eax
+     ba4:	e8 c2 f9 ff ff       	call   56b <sbrk>
+     ba9:	83 c4 10             	add    $0x10,%esp
+}
+     bac:	e9 6f ff ff ff       	jmp    b20 <freepages+0x60>
+     bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     bb8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     bbf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     bc1:	89 1d 20 1c 00 00    	mov    %ebx,0x1c20
+  if(p)
+     bc7:	85 c0                	test   %eax,%eax
+     bc9:	74 95                	je     b60 <freepages+0xa0>
+    p->prev = s;
+     bcb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     bce:	8b 73 10             	mov    0x10(%ebx),%esi
+     bd1:	89 f2                	mov    %esi,%edx
+     bd3:	c1 e2 0c             	shl    $0xc,%edx
+     bd6:	01 da                	add    %ebx,%edx
+     bd8:	39 d0                	cmp    %edx,%eax
+     bda:	0f 85 3a ff ff ff    	jne    b1a <freepages+0x5a>
+     be0:	89 c1                	mov    %eax,%ecx
+     be2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     be4:	8b 41 10             	mov    0x10(%ecx),%eax
+     be7:	01 f0                	add    %esi,%eax
+     be9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     bec:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     bef:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     bf1:	85 f6                	test   %esi,%esi
+     bf3:	74 35                	je     c2a <freepages+0x16a>
+    s->prev->next = s->next;
+     bf5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     bf7:	85 c0                	test   %eax,%eax
+     bf9:	74 06                	je     c01 <freepages+0x141>
+    s->next->prev = s->prev;
+     bfb:	8b 49 04             	mov    0x4(%ecx),%ecx
+     bfe:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     c01:	85 d2                	test   %edx,%edx
+     c03:	0f 84 11 ff ff ff    	je     b1a <freepages+0x5a>
+     c09:	8b 4a 10             	mov    0x10(%edx),%ecx
+     c0c:	89 c8                	mov    %ecx,%eax
+     c0e:	c1 e0 0c             	shl    $0xc,%eax
+     c11:	01 d0                	add    %edx,%eax
+     c13:	39 c3                	cmp    %eax,%ebx
+     c15:	0f 85 ff fe ff ff    	jne    b1a <freepages+0x5a>
+     c1b:	e9 10 ff ff ff       	jmp    b30 <freepages+0x70>
+    *l = s->next;
+     c20:	a3 20 1c 00 00       	mov    %eax,0x1c20
+     c25:	e9 1b ff ff ff       	jmp    b45 <freepages+0x85>
+     c2a:	a3 20 1c 00 00       	mov    %eax,0x1c20
+     c2f:	eb c6                	jmp    bf7 <freepages+0x137>
+     c31:	a3 20 1c 00 00       	mov    %eax,0x1c20
+     c36:	e9 53 ff ff ff       	jmp    b8e <freepages+0xce>
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+
+00000c40 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	56                   	push   %esi
+     c44:	53                   	push   %ebx
+     c45:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     c47:	a1 20 1c 00 00       	mov    0x1c20,%eax
+     c4c:	85 c0                	test   %eax,%eax
+     c4e:	74 5e                	je     cae <getpages+0x6e>
+    if(s->npages < n)
+     c50:	8b 50 10             	mov    0x10(%eax),%edx
+     c53:	39 da                	cmp    %ebx,%edx
+     c55:	72 51                	jb     ca8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     c57:	39 d3                	cmp    %edx,%ebx
+     c59:	72 25                	jb     c80 <getpages+0x40>
+  if(s->prev)
+     c5b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     c5e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     c60:	85 c9                	test   %ecx,%ecx
+     c62:	0f 84 a8 00 00 00    	je     d10 <getpages+0xd0>
+    s->prev->next = s->next;
+     c68:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     c6a:	85 d2                	test   %edx,%edx
+     c6c:	74 06                	je     c74 <getpages+0x34>
+    s->next->prev = s->prev;
+     c6e:	8b 48 04             	mov    0x4(%eax),%ecx
+     c71:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     c74:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c7a:	5b                   	pop    %ebx
+     c7b:	5e                   	pop    %esi
+     c7c:	5d                   	pop    %ebp
+     c7d:	c3                   	ret
+     c7e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     c80:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     c82:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     c84:	c1 e1 0c             	shl    $0xc,%ecx
+     c87:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     c89:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     c8c:	8b 70 04             	mov    0x4(%eax),%esi
+     c8f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     c92:	8b 10                	mov    (%eax),%edx
+     c94:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     c96:	85 f6                	test   %esi,%esi
+     c98:	74 66                	je     d00 <getpages+0xc0>
+        rest->prev->next = rest;
+     c9a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     c9c:	8b 11                	mov    (%ecx),%edx
+     c9e:	85 d2                	test   %edx,%edx
+     ca0:	75 cf                	jne    c71 <getpages+0x31>
+     ca2:	eb d0                	jmp    c74 <getpages+0x34>
+     ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     ca8:	8b 00                	mov    (%eax),%eax
+     caa:	85 c0                	test   %eax,%eax
+     cac:	75 a2                	jne    c50 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     cae:	83 ec 0c             	sub    $0xc,%esp
+     cb1:	6a 00                	push   $0x0
+     cb3:	e8 b3 f8 ff ff       	call   56b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cb8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     cbb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     cc1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cc3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     cc9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     ccf:	29 d0                	sub    %edx,%eax
+     cd1:	c1 e8 0c             	shr    $0xc,%eax
+     cd4:	39 d8                	cmp    %ebx,%eax
+     cd6:	72 48                	jb     d20 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     cd8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     cda:	89 d8                	mov    %ebx,%eax
+     cdc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     cdf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     ce1:	c1 e0 0c             	shl    $0xc,%eax
+     ce4:	01 f0                	add    %esi,%eax
+     ce6:	50                   	push   %eax
+     ce7:	e8 7f f8 ff ff       	call   56b <sbrk>
+     cec:	83 c4 10             	add    $0x10,%esp
+     cef:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cf2:	74 2c                	je     d20 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     cf4:	01 f0                	add    %esi,%eax
+     cf6:	e9 79 ff ff ff       	jmp    c74 <getpages+0x34>
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+        runs = rest;
+     d00:	89 0d 20 1c 00 00    	mov    %ecx,0x1c20
+     d06:	eb 96                	jmp    c9e <getpages+0x5e>
+     d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0f:	90                   	nop
+    *l = s->next;
+     d10:	89 15 20 1c 00 00    	mov    %edx,0x1c20
+     d16:	e9 4f ff ff ff       	jmp    c6a <getpages+0x2a>
+     d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+    return 0;
+     d20:	31 c0                	xor    %eax,%eax
+     d22:	e9 50 ff ff ff       	jmp    c77 <getpages+0x37>
+     d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2e:	66 90                	xchg   %ax,%ax
+
+00000d30 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	57                   	push   %edi
+     d34:	56                   	push   %esi
+     d35:	53                   	push   %ebx
+     d36:	83 ec 1c             	sub    $0x1c,%esp
+     d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     d3c:	85 c0                	test   %eax,%eax
+     d3e:	0f 84 97 00 00 00    	je     ddb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     d44:	89 c3                	mov    %eax,%ebx
+     d46:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     d4c:	8b 73 14             	mov    0x14(%ebx),%esi
+     d4f:	83 fe 01             	cmp    $0x1,%esi
+     d52:	74 74                	je     dc8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     d54:	85 f6                	test   %esi,%esi
+     d56:	74 5d                	je     db5 <free+0x85>
+  if(s->free == 0)
+     d58:	8b 53 08             	mov    0x8(%ebx),%edx
+     d5b:	85 d2                	test   %edx,%edx
+     d5d:	0f 84 85 00 00 00    	je     de8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     d63:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     d65:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     d68:	8b 43 0c             	mov    0xc(%ebx),%eax
+     d6b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     d6e:	8b 04 f5 44 1c 00 00 	mov    0x1c44(,%esi,8),%eax
+  s->inuse--;
+     d75:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     d78:	83 c0 01             	add    $0x1,%eax
+     d7b:	89 04 f5 44 1c 00 00 	mov    %eax,0x1c44(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     d82:	85 d2                	test   %edx,%edx
+     d84:	75 55                	jne    ddb <free+0xab>
+     d86:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     d8b:	89 f1                	mov    %esi,%ecx
+     d8d:	d3 ea                	shr    %cl,%edx
+     d8f:	39 c2                	cmp    %eax,%edx
+     d91:	73 7d                	jae    e10 <free+0xe0>
+  if(s->prev)
+     d93:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     d96:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     d98:	85 ff                	test   %edi,%edi
+     d9a:	0f 84 a0 00 00 00    	je     e40 <free+0x110>
+    s->prev->next = s->next;
+     da0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     da2:	85 c9                	test   %ecx,%ecx
+     da4:	74 06                	je     dac <free+0x7c>
+    s->next->prev = s->prev;
+     da6:	8b 7b 04             	mov    0x4(%ebx),%edi
+     da9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     dac:	29 d0                	sub    %edx,%eax
+     dae:	89 04 f5 44 1c 00 00 	mov    %eax,0x1c44(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     db8:	89 d8                	mov    %ebx,%eax
+}
+     dba:	5b                   	pop    %ebx
+     dbb:	5e                   	pop    %esi
+     dbc:	5f                   	pop    %edi
+     dbd:	5d                   	pop    %ebp
+    freepages(s);
+     dbe:	e9 fd fc ff ff       	jmp    ac0 <freepages>
+     dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dc7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     dc8:	8b 43 10             	mov    0x10(%ebx),%eax
+     dcb:	83 ec 08             	sub    $0x8,%esp
+     dce:	c1 e0 0c             	shl    $0xc,%eax
+     dd1:	50                   	push   %eax
+     dd2:	53                   	push   %ebx
+     dd3:	e8 6b f8 ff ff       	call   643 <munmap>
+     dd8:	83 c4 10             	add    $0x10,%esp
+}
+     ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dde:	5b                   	pop    %ebx
+     ddf:	5e                   	pop    %esi
+     de0:	5f                   	pop    %edi
+     de1:	5d                   	pop    %ebp
+     de2:	c3                   	ret
+     de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     de7:	90                   	nop
+  s->next = *l;
+     de8:	8b 14 f5 40 1c 00 00 	mov    0x1c40(,%esi,8),%edx
+  s->prev = 0;
+     def:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     df6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     df8:	85 d2                	test   %edx,%edx
+     dfa:	74 06                	je     e02 <free+0xd2>
+    (*l)->prev = s;
+     dfc:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     dff:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+     e02:	89 1c f5 40 1c 00 00 	mov    %ebx,0x1c40(,%esi,8)
+}
+     e09:	e9 55 ff ff ff       	jmp    d63 <free+0x33>
+     e0e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+     e10:	83 ec 0c             	sub    $0xc,%esp
+     e13:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e16:	8b 7b 10             	mov    0x10(%ebx),%edi
+     e19:	6a 00                	push   $0x0
+     e1b:	c1 e7 0c             	shl    $0xc,%edi
+     e1e:	01 df                	add    %ebx,%edi
+     e20:	e8 46 f7 ff ff       	call   56b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     e2b:	39 c7                	cmp    %eax,%edi
+     e2d:	75 ac                	jne    ddb <free+0xab>
+     e2f:	8b 04 f5 44 1c 00 00 	mov    0x1c44(,%esi,8),%eax
+     e36:	e9 58 ff ff ff       	jmp    d93 <free+0x63>
+     e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+    *l = s->next;
+     e40:	89 0c f5 40 1c 00 00 	mov    %ecx,0x1c40(,%esi,8)
+     e47:	e9 56 ff ff ff       	jmp    da2 <free+0x72>
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e50 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     e50:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     e51:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+     e56:	89 e5                	mov    %esp,%ebp
+     e58:	57                   	push   %edi
+     e59:	56                   	push   %esi
+     e5a:	53                   	push   %ebx
+     e5b:	83 ec 1c             	sub    $0x1c,%esp
+     e5e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+     e61:	83 f8 10             	cmp    $0x10,%eax
+     e64:	0f 86 92 00 00 00    	jbe    efc <malloc+0xac>
+     e6a:	ba 01 00 00 00       	mov    $0x1,%edx
+     e6f:	eb 13                	jmp    e84 <malloc+0x34>
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e78:	89 d3                	mov    %edx,%ebx
+     e7a:	d3 e3                	shl    %cl,%ebx
+     e7c:	39 c3                	cmp    %eax,%ebx
+     e7e:	0f 83 84 00 00 00    	jae    f08 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     e84:	83 c1 01             	add    $0x1,%ecx
+     e87:	83 f9 0b             	cmp    $0xb,%ecx
+     e8a:	75 ec                	jne    e78 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+     e8c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+     e91:	0f 87 c9 00 00 00    	ja     f60 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+     e97:	05 17 10 00 00       	add    $0x1017,%eax
+     e9c:	89 c3                	mov    %eax,%ebx
+     e9e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+     ea1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+     ea6:	77 28                	ja     ed0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+     ea8:	89 d8                	mov    %ebx,%eax
+     eaa:	e8 91 fd ff ff       	call   c40 <getpages>
+     eaf:	85 c0                	test   %eax,%eax
+     eb1:	0f 84 a9 00 00 00    	je     f60 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+     eb7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+     ebe:	83 c0 18             	add    $0x18,%eax
+}
+     ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ec4:	5b                   	pop    %ebx
+     ec5:	5e                   	pop    %esi
+     ec6:	5f                   	pop    %edi
+     ec7:	5d                   	pop    %ebp
+     ec8:	c3                   	ret
+     ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+     ed0:	89 d8                	mov    %ebx,%eax
+     ed2:	83 ec 08             	sub    $0x8,%esp
+     ed5:	c1 e0 0c             	shl    $0xc,%eax
+     ed8:	6a 00                	push   $0x0
+     eda:	6a ff                	push   $0xffffffff
+     edc:	6a 22                	push   $0x22
+     ede:	6a 03                	push   $0x3
+     ee0:	50                   	push   %eax
+     ee1:	6a 00                	push   $0x0
+     ee3:	e8 53 f7 ff ff       	call   63b <mmap>
+    if(s == MAP_FAILED)
+     ee8:	83 c4 20             	add    $0x20,%esp
+     eeb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eee:	74 b8                	je     ea8 <malloc+0x58>
+      s->shift = MAPRUN;
+     ef0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+     ef7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+     efa:	eb c2                	jmp    ebe <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+     efc:	bb 10 00 00 00       	mov    $0x10,%ebx
+     f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+     f08:	8b 34 cd 40 1c 00 00 	mov    0x1c40(,%ecx,8),%esi
+     f0f:	85 f6                	test   %esi,%esi
+     f11:	74 57                	je     f6a <malloc+0x11a>
+  classes[shift].nfree--;
+     f13:	8b 1c cd 44 1c 00 00 	mov    0x1c44(,%ecx,8),%ebx
+  o = s->free;
+     f1a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+     f1d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     f20:	89 14 cd 44 1c 00 00 	mov    %edx,0x1c44(,%ecx,8)
+  s->free = NEXTFREE(o);
+     f27:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+     f29:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+     f2d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+     f30:	85 ff                	test   %edi,%edi
+     f32:	75 8d                	jne    ec1 <malloc+0x71>
+  if(s->prev)
+     f34:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+     f37:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+     f39:	85 db                	test   %ebx,%ebx
+     f3b:	0f 84 b7 00 00 00    	je     ff8 <malloc+0x1a8>
+    s->prev->next = s->next;
+     f41:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+     f43:	85 d2                	test   %edx,%edx
+     f45:	0f 84 76 ff ff ff    	je     ec1 <malloc+0x71>
+    s->next->prev = s->prev;
+     f4b:	8b 4e 04             	mov    0x4(%esi),%ecx
+     f4e:	89 4a 04             	mov    %ecx,0x4(%edx)
+     f51:	e9 6b ff ff ff       	jmp    ec1 <malloc+0x71>
+     f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     f63:	31 c0                	xor    %eax,%eax
+}
+     f65:	5b                   	pop    %ebx
+     f66:	5e                   	pop    %esi
+     f67:	5f                   	pop    %edi
+     f68:	5d                   	pop    %ebp
+     f69:	c3                   	ret
+    if((s = getpages(1)) == 0)
+     f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+     f6f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     f72:	e8 c9 fc ff ff       	call   c40 <getpages>
+     f77:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     f7a:	85 c0                	test   %eax,%eax
+     f7c:	89 c2                	mov    %eax,%edx
+     f7e:	74 e0                	je     f60 <malloc+0x110>
+    s->shift = shift;
+     f80:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     f83:	f7 db                	neg    %ebx
+    s->inuse = 0;
+     f85:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+     f8c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     f91:	89 df                	mov    %ebx,%edi
+     f93:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+     f95:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+     f97:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     f9a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f9d:	83 e8 01             	sub    $0x1,%eax
+     fa0:	d3 e0                	shl    %cl,%eax
+     fa2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     fa5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fa9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     fac:	eb 04                	jmp    fb2 <malloc+0x162>
+     fae:	66 90                	xchg   %ax,%ax
+     fb0:	89 c8                	mov    %ecx,%eax
+     fb2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+     fb5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fb7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+     fba:	89 c6                	mov    %eax,%esi
+     fbc:	39 da                	cmp    %ebx,%edx
+     fbe:	7f f0                	jg     fb0 <malloc+0x160>
+     fc0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     fc3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     fc6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+     fc9:	8b 04 cd 40 1c 00 00 	mov    0x1c40(,%ecx,8),%eax
+  s->prev = 0;
+     fd0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+     fd7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+     fd9:	85 c0                	test   %eax,%eax
+     fdb:	74 03                	je     fe0 <malloc+0x190>
+    (*l)->prev = s;
+     fdd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+     fe0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+     fe3:	89 14 cd 40 1c 00 00 	mov    %edx,0x1c40(,%ecx,8)
+    classes[shift].nfree += n;
+     fea:	89 d6                	mov    %edx,%esi
+     fec:	03 1c cd 44 1c 00 00 	add    0x1c44(,%ecx,8),%ebx
+     ff3:	e9 22 ff ff ff       	jmp    f1a <malloc+0xca>
+    *l = s->next;
+     ff8:	89 14 cd 40 1c 00 00 	mov    %edx,0x1c40(,%ecx,8)
+     fff:	e9 3f ff ff ff       	jmp    f43 <malloc+0xf3>
@@ -0,0 +1,33 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "memstat.h"
+
+// Show how memory is used, in KB.
+// free [pid]
+//
+// Without a pid, the process shown is free itself.
+
+#define KB(pages) ((pages) * 4)
+
+int main(int argc, char *argv[])
+{
+  struct memstat ms;
+  int pid = argc > 1 ? atoi(argv[1]) : 0;
+
+  if (memstat(pid, &ms) < 0)
+  {
+    printf(2, "free: no process %d\n", pid);
+    exit();
+  }
+  printf(1, "memory:  total %d KB, free %d KB, used %d KB\n",
+         KB(ms.total), KB(ms.free), KB(ms.total - ms.free));
+  printf(1, "kernel:  page tables %d KB, stacks %d KB, objects %d KB (pipes %d KB)\n",
+         KB(ms.pgtables), KB(ms.kstacks), KB(ms.slab), KB(ms.pipes));
+  printf(1, "cache:   %d KB\n", KB(ms.pcache));
+  printf(1, "swap:    total %d KB, free %d KB\n", KB(ms.swap), KB(ms.swapfree));
+  printf(1, "pid %d: size %d KB, resident %d KB, shared %d KB, swapped %d KB\n",
+         pid ? pid : getpid(), ms.sz / 1024, KB(ms.rss), KB(ms.shared),
+         KB(ms.swapped));
+  exit();
+}
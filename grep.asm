@@ -0,0 +1,2572 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+      21:	8b 43 04             	mov    0x4(%ebx),%eax
+      24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+      27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+      30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+      33:	75 2d                	jne    62 <main+0x62>
+      35:	eb 6c                	jmp    a3 <main+0xa3>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+      40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+      43:	83 c6 01             	add    $0x1,%esi
+      46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+      49:	50                   	push   %eax
+      4a:	ff 75 e0             	push   -0x20(%ebp)
+      4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+      52:	89 3c 24             	mov    %edi,(%esp)
+      55:	e8 e1 06 00 00       	call   73b <close>
+  for(i = 2; i < argc; i++){
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+      62:	83 ec 08             	sub    $0x8,%esp
+      65:	6a 00                	push   $0x0
+      67:	ff 33                	push   (%ebx)
+      69:	e8 e5 06 00 00       	call   753 <open>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	89 c7                	mov    %eax,%edi
+      73:	85 c0                	test   %eax,%eax
+      75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      77:	50                   	push   %eax
+      78:	ff 33                	push   (%ebx)
+      7a:	68 34 12 00 00       	push   $0x1234
+      7f:	6a 01                	push   $0x1
+      81:	e8 0a 0a 00 00       	call   a90 <printf>
+      exit();
+      86:	e8 15 03 00 00       	call   3a0 <exit>
+  }
+  exit();
+      8b:	e8 10 03 00 00       	call   3a0 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+      90:	51                   	push   %ecx
+      91:	51                   	push   %ecx
+      92:	68 4c 12 00 00       	push   $0x124c
+      97:	6a 02                	push   $0x2
+      99:	e8 f2 09 00 00       	call   a90 <printf>
+    exit();
+      9e:	e8 fd 02 00 00       	call   3a0 <exit>
+    grep(pattern, 0);
+      a3:	52                   	push   %edx
+      a4:	52                   	push   %edx
+      a5:	6a 00                	push   $0x0
+      a7:	50                   	push   %eax
+      a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+      ad:	e8 ee 02 00 00       	call   3a0 <exit>
+      b2:	66 90                	xchg   %ax,%ax
+      b4:	66 90                	xchg   %ax,%ax
+      b6:	66 90                	xchg   %ax,%ax
+      b8:	66 90                	xchg   %ax,%ax
+      ba:	66 90                	xchg   %ax,%ax
+      bc:	66 90                	xchg   %ax,%ax
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 0c             	sub    $0xc,%esp
+      c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+      cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+      cf:	0f b6 0f             	movzbl (%edi),%ecx
+      d2:	84 c9                	test   %cl,%cl
+      d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      de:	3c 2a                	cmp    $0x2a,%al
+      e0:	74 2d                	je     10f <matchhere+0x4f>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      eb:	80 f9 24             	cmp    $0x24,%cl
+      ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      f0:	89 f2                	mov    %esi,%edx
+      f2:	84 d2                	test   %dl,%dl
+      f4:	74 6e                	je     164 <matchhere+0xa4>
+      f6:	80 f9 2e             	cmp    $0x2e,%cl
+      f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      fb:	83 c3 01             	add    $0x1,%ebx
+      fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     101:	84 c0                	test   %al,%al
+     103:	74 6b                	je     170 <matchhere+0xb0>
+     105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     10b:	3c 2a                	cmp    $0x2a,%al
+     10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     10f:	8d 77 02             	lea    0x2(%edi),%esi
+     112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	53                   	push   %ebx
+     11c:	56                   	push   %esi
+     11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     129:	0f be 13             	movsbl (%ebx),%edx
+     12c:	84 d2                	test   %dl,%dl
+     12e:	74 45                	je     175 <matchhere+0xb5>
+     130:	83 c3 01             	add    $0x1,%ebx
+     133:	39 fa                	cmp    %edi,%edx
+     135:	74 e1                	je     118 <matchhere+0x58>
+     137:	83 ff 2e             	cmp    $0x2e,%edi
+     13a:	74 dc                	je     118 <matchhere+0x58>
+     13c:	eb 37                	jmp    175 <matchhere+0xb5>
+     13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     140:	84 c0                	test   %al,%al
+     142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     144:	89 f2                	mov    %esi,%edx
+     146:	84 d2                	test   %dl,%dl
+     148:	74 1a                	je     164 <matchhere+0xa4>
+     14a:	80 fa 24             	cmp    $0x24,%dl
+     14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     14f:	83 c3 01             	add    $0x1,%ebx
+     152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     155:	89 c1                	mov    %eax,%ecx
+     157:	eb ae                	jmp    107 <matchhere+0x47>
+     159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     160:	38 ca                	cmp    %cl,%dl
+     162:	74 97                	je     fb <matchhere+0x3b>
+}
+     164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     167:	31 c0                	xor    %eax,%eax
+}
+     169:	5b                   	pop    %ebx
+     16a:	5e                   	pop    %esi
+     16b:	5f                   	pop    %edi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+    return 1;
+     170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+    return *text == '\0';
+     17d:	89 f0                	mov    %esi,%eax
+     17f:	84 c0                	test   %al,%al
+     181:	0f 94 c0             	sete   %al
+     184:	0f b6 c0             	movzbl %al,%eax
+     187:	eb ec                	jmp    175 <matchhere+0xb5>
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     19e:	75 11                	jne    1b1 <match+0x21>
+     1a0:	eb 2e                	jmp    1d0 <match+0x40>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1a8:	83 c6 01             	add    $0x1,%esi
+     1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+     1b1:	83 ec 08             	sub    $0x8,%esp
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 c0                	test   %eax,%eax
+     1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+     1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     1d0:	83 c3 01             	add    $0x1,%ebx
+     1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	57                   	push   %edi
+     1f4:	56                   	push   %esi
+     1f5:	53                   	push   %ebx
+  m = 0;
+     1f6:	31 db                	xor    %ebx,%ebx
+     1f8:	89 df                	mov    %ebx,%edi
+{
+     1fa:	83 ec 1c             	sub    $0x1c,%esp
+     1fd:	8b 75 08             	mov    0x8(%ebp),%esi
+    return matchhere(re+1, text);
+     200:	8d 46 01             	lea    0x1(%esi),%eax
+     203:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     210:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     215:	83 ec 04             	sub    $0x4,%esp
+     218:	29 f8                	sub    %edi,%eax
+     21a:	50                   	push   %eax
+     21b:	8d 87 e0 17 00 00    	lea    0x17e0(%edi),%eax
+     221:	50                   	push   %eax
+     222:	ff 75 0c             	push   0xc(%ebp)
+     225:	e8 01 05 00 00       	call   72b <read>
+     22a:	83 c4 10             	add    $0x10,%esp
+     22d:	85 c0                	test   %eax,%eax
+     22f:	0f 8e d0 00 00 00    	jle    305 <grep+0x115>
+    m += n;
+     235:	01 c7                	add    %eax,%edi
+    p = buf;
+     237:	bb e0 17 00 00       	mov    $0x17e0,%ebx
+    buf[m] = '\0';
+     23c:	c6 87 e0 17 00 00 00 	movb   $0x0,0x17e0(%edi)
+    while((q = strchr(p, '\n')) != 0){
+     243:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+     246:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	6a 0a                	push   $0xa
+     255:	ff 75 e4             	push   -0x1c(%ebp)
+     258:	e8 b3 02 00 00       	call   510 <strchr>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	89 c7                	mov    %eax,%edi
+     262:	85 c0                	test   %eax,%eax
+     264:	74 62                	je     2c8 <grep+0xd8>
+      *q = 0;
+     266:	c6 07 00             	movb   $0x0,(%edi)
+  if(re[0] == '^')
+     269:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     26c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     26f:	75 10                	jne    281 <grep+0x91>
+     271:	eb 3d                	jmp    2b0 <grep+0xc0>
+     273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     277:	90                   	nop
+  }while(*text++ != '\0');
+     278:	83 c3 01             	add    $0x1,%ebx
+     27b:	80 7b ff 00          	cmpb   $0x0,-0x1(%ebx)
+     27f:	74 26                	je     2a7 <grep+0xb7>
+    if(matchhere(re, text))
+     281:	83 ec 08             	sub    $0x8,%esp
+     284:	53                   	push   %ebx
+     285:	56                   	push   %esi
+     286:	e8 35 fe ff ff       	call   c0 <matchhere>
+     28b:	83 c4 10             	add    $0x10,%esp
+     28e:	85 c0                	test   %eax,%eax
+     290:	74 e6                	je     278 <grep+0x88>
+        printf(1, "%s\n", p);
+     292:	83 ec 04             	sub    $0x4,%esp
+     295:	ff 75 e4             	push   -0x1c(%ebp)
+     298:	68 46 12 00 00       	push   $0x1246
+     29d:	6a 01                	push   $0x1
+     29f:	e8 ec 07 00 00       	call   a90 <printf>
+     2a4:	83 c4 10             	add    $0x10,%esp
+      p = q+1;
+     2a7:	8d 47 01             	lea    0x1(%edi),%eax
+     2aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     2ad:	eb a1                	jmp    250 <grep+0x60>
+     2af:	90                   	nop
+    return matchhere(re+1, text);
+     2b0:	83 ec 08             	sub    $0x8,%esp
+     2b3:	53                   	push   %ebx
+     2b4:	ff 75 e0             	push   -0x20(%ebp)
+     2b7:	e8 04 fe ff ff       	call   c0 <matchhere>
+     2bc:	83 c4 10             	add    $0x10,%esp
+      if(match(pattern, p))
+     2bf:	85 c0                	test   %eax,%eax
+     2c1:	74 e4                	je     2a7 <grep+0xb7>
+     2c3:	eb cd                	jmp    292 <grep+0xa2>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p == buf)
+     2c8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     2cb:	8b 7d dc             	mov    -0x24(%ebp),%edi
+     2ce:	81 fb e0 17 00 00    	cmp    $0x17e0,%ebx
+     2d4:	74 28                	je     2fe <grep+0x10e>
+    if(m > 0){
+     2d6:	85 ff                	test   %edi,%edi
+     2d8:	0f 8e 32 ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+     2de:	89 d8                	mov    %ebx,%eax
+      memmove(buf, p, m);
+     2e0:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     2e3:	2d e0 17 00 00       	sub    $0x17e0,%eax
+     2e8:	29 c7                	sub    %eax,%edi
+      memmove(buf, p, m);
+     2ea:	57                   	push   %edi
+     2eb:	53                   	push   %ebx
+     2ec:	68 e0 17 00 00       	push   $0x17e0
+     2f1:	e8 ea 03 00 00       	call   6e0 <memmove>
+     2f6:	83 c4 10             	add    $0x10,%esp
+     2f9:	e9 12 ff ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+     2fe:	31 ff                	xor    %edi,%edi
+     300:	e9 0b ff ff ff       	jmp    210 <grep+0x20>
+}
+     305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     308:	5b                   	pop    %ebx
+     309:	5e                   	pop    %esi
+     30a:	5f                   	pop    %edi
+     30b:	5d                   	pop    %ebp
+     30c:	c3                   	ret
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <matchstar>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	56                   	push   %esi
+     315:	53                   	push   %ebx
+     316:	83 ec 0c             	sub    $0xc,%esp
+     319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     31c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     31f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     328:	83 ec 08             	sub    $0x8,%esp
+     32b:	57                   	push   %edi
+     32c:	56                   	push   %esi
+     32d:	e8 8e fd ff ff       	call   c0 <matchhere>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	75 1f                	jne    358 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     339:	0f be 17             	movsbl (%edi),%edx
+     33c:	84 d2                	test   %dl,%dl
+     33e:	74 0c                	je     34c <matchstar+0x3c>
+     340:	83 c7 01             	add    $0x1,%edi
+     343:	39 da                	cmp    %ebx,%edx
+     345:	74 e1                	je     328 <matchstar+0x18>
+     347:	83 fb 2e             	cmp    $0x2e,%ebx
+     34a:	74 dc                	je     328 <matchstar+0x18>
+}
+     34c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     34f:	5b                   	pop    %ebx
+     350:	5e                   	pop    %esi
+     351:	5f                   	pop    %edi
+     352:	5d                   	pop    %ebp
+     353:	c3                   	ret
+     354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     35b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     360:	5b                   	pop    %ebx
+     361:	5e                   	pop    %esi
+     362:	5f                   	pop    %edi
+     363:	5d                   	pop    %ebp
+     364:	c3                   	ret
+     365:	66 90                	xchg   %ax,%ax
+     367:	66 90                	xchg   %ax,%ax
+     369:	66 90                	xchg   %ax,%ax
+     36b:	66 90                	xchg   %ax,%ax
+     36d:	66 90                	xchg   %ax,%ax
+     36f:	90                   	nop
+
+00000370 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     370:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+     375:	85 c0                	test   %eax,%eax
+     377:	74 17                	je     390 <fork+0x20>
+{
+     379:	55                   	push   %ebp
+     37a:	89 e5                	mov    %esp,%ebp
+     37c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     37f:	ff d0                	call   *%eax
+  return _fork();
+}
+     381:	c9                   	leave
+  return _fork();
+     382:	e9 84 03 00 00       	jmp    70b <_fork>
+     387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38e:	66 90                	xchg   %ax,%ax
+     390:	e9 76 03 00 00       	jmp    70b <_fork>
+     395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <exit>:
+
+int
+exit(void)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     3a6:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+     3ab:	85 c0                	test   %eax,%eax
+     3ad:	74 02                	je     3b1 <exit+0x11>
+    stdioflush();
+     3af:	ff d0                	call   *%eax
+  _exit();
+     3b1:	e8 5d 03 00 00       	call   713 <_exit>
+     3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     3c0:	55                   	push   %ebp
+  if(stdioflush)
+     3c1:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+{
+     3c6:	89 e5                	mov    %esp,%ebp
+     3c8:	56                   	push   %esi
+     3c9:	53                   	push   %ebx
+     3ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     3d0:	85 c0                	test   %eax,%eax
+     3d2:	74 02                	je     3d6 <exec+0x16>
+    stdioflush();
+     3d4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     3d6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     3d9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     3dc:	5b                   	pop    %ebx
+     3dd:	5e                   	pop    %esi
+     3de:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     3df:	e9 67 03 00 00       	jmp    74b <_exec>
+     3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+
+000003f0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	57                   	push   %edi
+     3f4:	56                   	push   %esi
+     3f5:	53                   	push   %ebx
+     3f6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     3f9:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+{
+     3fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     401:	8b 75 0c             	mov    0xc(%ebp),%esi
+     404:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     407:	85 c0                	test   %eax,%eax
+     409:	74 02                	je     40d <spawn+0x1d>
+    stdioflush();
+     40b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     40d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     410:	89 75 0c             	mov    %esi,0xc(%ebp)
+     413:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     416:	83 c4 0c             	add    $0xc,%esp
+     419:	5b                   	pop    %ebx
+     41a:	5e                   	pop    %esi
+     41b:	5f                   	pop    %edi
+     41c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     41d:	e9 79 04 00 00       	jmp    89b <_spawn>
+     422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     430:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     431:	31 c0                	xor    %eax,%eax
+{
+     433:	89 e5                	mov    %esp,%ebp
+     435:	53                   	push   %ebx
+     436:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     439:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     440:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     444:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     447:	83 c0 01             	add    $0x1,%eax
+     44a:	84 d2                	test   %dl,%dl
+     44c:	75 f2                	jne    440 <strcpy+0x10>
+    ;
+  return os;
+}
+     44e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     451:	89 c8                	mov    %ecx,%eax
+     453:	c9                   	leave
+     454:	c3                   	ret
+     455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	53                   	push   %ebx
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+     467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     46a:	0f b6 02             	movzbl (%edx),%eax
+     46d:	84 c0                	test   %al,%al
+     46f:	75 17                	jne    488 <strcmp+0x28>
+     471:	eb 3a                	jmp    4ad <strcmp+0x4d>
+     473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     477:	90                   	nop
+     478:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     47c:	83 c2 01             	add    $0x1,%edx
+     47f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     482:	84 c0                	test   %al,%al
+     484:	74 1a                	je     4a0 <strcmp+0x40>
+    p++, q++;
+     486:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     488:	0f b6 19             	movzbl (%ecx),%ebx
+     48b:	38 c3                	cmp    %al,%bl
+     48d:	74 e9                	je     478 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     48f:	29 d8                	sub    %ebx,%eax
+}
+     491:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     494:	c9                   	leave
+     495:	c3                   	ret
+     496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     4a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     4a4:	31 c0                	xor    %eax,%eax
+     4a6:	29 d8                	sub    %ebx,%eax
+}
+     4a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4ab:	c9                   	leave
+     4ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     4ad:	0f b6 19             	movzbl (%ecx),%ebx
+     4b0:	31 c0                	xor    %eax,%eax
+     4b2:	eb db                	jmp    48f <strcmp+0x2f>
+     4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4c6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4c9:	74 15                	je     4e0 <strlen+0x20>
+     4cb:	31 c0                	xor    %eax,%eax
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+     4d0:	83 c0 01             	add    $0x1,%eax
+     4d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4d7:	89 c1                	mov    %eax,%ecx
+     4d9:	75 f5                	jne    4d0 <strlen+0x10>
+    ;
+  return n;
+}
+     4db:	89 c8                	mov    %ecx,%eax
+     4dd:	5d                   	pop    %ebp
+     4de:	c3                   	ret
+     4df:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4e0:	31 c9                	xor    %ecx,%ecx
+}
+     4e2:	5d                   	pop    %ebp
+     4e3:	89 c8                	mov    %ecx,%eax
+     4e5:	c3                   	ret
+     4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	57                   	push   %edi
+     4f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     4f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     4fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4fd:	89 d7                	mov    %edx,%edi
+     4ff:	fc                   	cld
+     500:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     502:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     505:	89 d0                	mov    %edx,%eax
+     507:	c9                   	leave
+     508:	c3                   	ret
+     509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	8b 45 08             	mov    0x8(%ebp),%eax
+     516:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     51a:	0f b6 10             	movzbl (%eax),%edx
+     51d:	84 d2                	test   %dl,%dl
+     51f:	75 12                	jne    533 <strchr+0x23>
+     521:	eb 1d                	jmp    540 <strchr+0x30>
+     523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     527:	90                   	nop
+     528:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     52c:	83 c0 01             	add    $0x1,%eax
+     52f:	84 d2                	test   %dl,%dl
+     531:	74 0d                	je     540 <strchr+0x30>
+    if(*s == c)
+     533:	38 d1                	cmp    %dl,%cl
+     535:	75 f1                	jne    528 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     537:	5d                   	pop    %ebp
+     538:	c3                   	ret
+     539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     540:	31 c0                	xor    %eax,%eax
+}
+     542:	5d                   	pop    %ebp
+     543:	c3                   	ret
+     544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+     556:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     559:	a1 e0 1b 00 00       	mov    0x1be0,%eax
+{
+     55e:	8b 75 08             	mov    0x8(%ebp),%esi
+     561:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     564:	85 c0                	test   %eax,%eax
+     566:	74 02                	je     56a <gets+0x1a>
+    stdioflush();
+     568:	ff d0                	call   *%eax
+  if(in.size == 0)
+     56a:	a1 08 1e 00 00       	mov    0x1e08,%eax
+     56f:	85 c0                	test   %eax,%eax
+     571:	0f 84 99 00 00 00    	je     610 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     577:	31 db                	xor    %ebx,%ebx
+     579:	eb 21                	jmp    59c <gets+0x4c>
+     57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     580:	8d 50 01             	lea    0x1(%eax),%edx
+     583:	0f b6 80 00 1c 00 00 	movzbl 0x1c00(%eax),%eax
+     58a:	89 15 00 1e 00 00    	mov    %edx,0x1e00
+    buf[i++] = c;
+     590:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     594:	3c 0a                	cmp    $0xa,%al
+     596:	74 60                	je     5f8 <gets+0xa8>
+     598:	3c 0d                	cmp    $0xd,%al
+     59a:	74 5c                	je     5f8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     59c:	89 da                	mov    %ebx,%edx
+     59e:	83 c3 01             	add    $0x1,%ebx
+     5a1:	39 fb                	cmp    %edi,%ebx
+     5a3:	7d 55                	jge    5fa <gets+0xaa>
+    if(in.r == in.n){
+     5a5:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     5aa:	3b 05 04 1e 00 00    	cmp    0x1e04,%eax
+     5b0:	75 ce                	jne    580 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     5b2:	83 ec 04             	sub    $0x4,%esp
+     5b5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     5b8:	c7 05 04 1e 00 00 00 	movl   $0x0,0x1e04
+     5bf:	00 00 00 
+     5c2:	c7 05 00 1e 00 00 00 	movl   $0x0,0x1e00
+     5c9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     5cc:	ff 35 08 1e 00 00    	push   0x1e08
+     5d2:	68 00 1c 00 00       	push   $0x1c00
+     5d7:	6a 00                	push   $0x0
+     5d9:	e8 4d 01 00 00       	call   72b <read>
+     5de:	83 c4 10             	add    $0x10,%esp
+     5e1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     5e4:	85 c0                	test   %eax,%eax
+     5e6:	a3 04 1e 00 00       	mov    %eax,0x1e04
+     5eb:	7e 56                	jle    643 <gets+0xf3>
+    c = in.buf[in.r++];
+     5ed:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     5f2:	eb 8c                	jmp    580 <gets+0x30>
+     5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     5f8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     5fa:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     5fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     601:	89 f0                	mov    %esi,%eax
+     603:	5b                   	pop    %ebx
+     604:	5e                   	pop    %esi
+     605:	5f                   	pop    %edi
+     606:	5d                   	pop    %ebp
+     607:	c3                   	ret
+     608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     610:	83 ec 08             	sub    $0x8,%esp
+     613:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     616:	50                   	push   %eax
+     617:	6a 00                	push   $0x0
+     619:	e8 4d 01 00 00       	call   76b <fstat>
+     61e:	83 c4 10             	add    $0x10,%esp
+     621:	89 c2                	mov    %eax,%edx
+     623:	b8 01 00 00 00       	mov    $0x1,%eax
+     628:	85 d2                	test   %edx,%edx
+     62a:	75 0d                	jne    639 <gets+0xe9>
+     62c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     631:	ba 00 02 00 00       	mov    $0x200,%edx
+     636:	0f 44 c2             	cmove  %edx,%eax
+     639:	a3 08 1e 00 00       	mov    %eax,0x1e08
+     63e:	e9 34 ff ff ff       	jmp    577 <gets+0x27>
+        in.n = 0;
+     643:	c7 05 04 1e 00 00 00 	movl   $0x0,0x1e04
+     64a:	00 00 00 
+        break;
+     64d:	eb ab                	jmp    5fa <gets+0xaa>
+     64f:	90                   	nop
+
+00000650 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	56                   	push   %esi
+     654:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     655:	83 ec 08             	sub    $0x8,%esp
+     658:	6a 00                	push   $0x0
+     65a:	ff 75 08             	push   0x8(%ebp)
+     65d:	e8 f1 00 00 00       	call   753 <open>
+  if(fd < 0)
+     662:	83 c4 10             	add    $0x10,%esp
+     665:	85 c0                	test   %eax,%eax
+     667:	78 27                	js     690 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     669:	83 ec 08             	sub    $0x8,%esp
+     66c:	ff 75 0c             	push   0xc(%ebp)
+     66f:	89 c3                	mov    %eax,%ebx
+     671:	50                   	push   %eax
+     672:	e8 f4 00 00 00       	call   76b <fstat>
+  close(fd);
+     677:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     67a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     67c:	e8 ba 00 00 00       	call   73b <close>
+  return r;
+     681:	83 c4 10             	add    $0x10,%esp
+}
+     684:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     687:	89 f0                	mov    %esi,%eax
+     689:	5b                   	pop    %ebx
+     68a:	5e                   	pop    %esi
+     68b:	5d                   	pop    %ebp
+     68c:	c3                   	ret
+     68d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     690:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     695:	eb ed                	jmp    684 <stat+0x34>
+     697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     6a7:	0f be 02             	movsbl (%edx),%eax
+     6aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     6ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     6b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     6b5:	77 1e                	ja     6d5 <atoi+0x35>
+     6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     6c0:	83 c2 01             	add    $0x1,%edx
+     6c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     6c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     6ca:	0f be 02             	movsbl (%edx),%eax
+     6cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     6d0:	80 fb 09             	cmp    $0x9,%bl
+     6d3:	76 eb                	jbe    6c0 <atoi+0x20>
+  return n;
+}
+     6d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d8:	89 c8                	mov    %ecx,%eax
+     6da:	c9                   	leave
+     6db:	c3                   	ret
+     6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	57                   	push   %edi
+     6e4:	56                   	push   %esi
+     6e5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     6ee:	85 c0                	test   %eax,%eax
+     6f0:	7e 13                	jle    705 <memmove+0x25>
+     6f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     6f4:	89 d7                	mov    %edx,%edi
+     6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     700:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     701:	39 f8                	cmp    %edi,%eax
+     703:	75 fb                	jne    700 <memmove+0x20>
+  return vdst;
+}
+     705:	5e                   	pop    %esi
+     706:	89 d0                	mov    %edx,%eax
+     708:	5f                   	pop    %edi
+     709:	5d                   	pop    %ebp
+     70a:	c3                   	ret
+
+0000070b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     70b:	b8 01 00 00 00       	mov    $0x1,%eax
+     710:	cd 40                	int    $0x40
+     712:	c3                   	ret
+
+00000713 <_exit>:
+RAWSYSCALL(exit)
+     713:	b8 02 00 00 00       	mov    $0x2,%eax
+     718:	cd 40                	int    $0x40
+     71a:	c3                   	ret
+
+0000071b <wait>:
+SYSCALL(wait)
+     71b:	b8 03 00 00 00       	mov    $0x3,%eax
+     720:	cd 40                	int    $0x40
+     722:	c3                   	ret
+
+00000723 <pipe>:
+SYSCALL(pipe)
+     723:	b8 04 00 00 00       	mov    $0x4,%eax
+     728:	cd 40                	int    $0x40
+     72a:	c3                   	ret
+
+0000072b <read>:
+SYSCALL(read)
+     72b:	b8 05 00 00 00       	mov    $0x5,%eax
+     730:	cd 40                	int    $0x40
+     732:	c3                   	ret
+
+00000733 <write>:
+SYSCALL(write)
+     733:	b8 10 00 00 00       	mov    $0x10,%eax
+     738:	cd 40                	int    $0x40
+     73a:	c3                   	ret
+
+0000073b <close>:
+SYSCALL(close)
+     73b:	b8 15 00 00 00       	mov    $0x15,%eax
+     740:	cd 40                	int    $0x40
+     742:	c3                   	ret
+
+00000743 <kill>:
+SYSCALL(kill)
+     743:	b8 06 00 00 00       	mov    $0x6,%eax
+     748:	cd 40                	int    $0x40
+     74a:	c3                   	ret
+
+0000074b <_exec>:
+RAWSYSCALL(exec)
+     74b:	b8 07 00 00 00       	mov    $0x7,%eax
+     750:	cd 40                	int    $0x40
+     752:	c3                   	ret
+
+00000753 <open>:
+SYSCALL(open)
+     753:	b8 0f 00 00 00       	mov    $0xf,%eax
+     758:	cd 40                	int    $0x40
+     75a:	c3                   	ret
+
+0000075b <mknod>:
+SYSCALL(mknod)
+     75b:	b8 11 00 00 00       	mov    $0x11,%eax
+     760:	cd 40                	int    $0x40
+     762:	c3                   	ret
+
+00000763 <unlink>:
+SYSCALL(unlink)
+     763:	b8 12 00 00 00       	mov    $0x12,%eax
+     768:	cd 40                	int    $0x40
+     76a:	c3                   	ret
+
+0000076b <fstat>:
+SYSCALL(fstat)
+     76b:	b8 08 00 00 00       	mov    $0x8,%eax
+     770:	cd 40                	int    $0x40
+     772:	c3                   	ret
+
+00000773 <link>:
+SYSCALL(link)
+     773:	b8 13 00 00 00       	mov    $0x13,%eax
+     778:	cd 40                	int    $0x40
+     77a:	c3                   	ret
+
+0000077b <mkdir>:
+SYSCALL(mkdir)
+     77b:	b8 14 00 00 00       	mov    $0x14,%eax
+     780:	cd 40                	int    $0x40
+     782:	c3                   	ret
+
+00000783 <chdir>:
+SYSCALL(chdir)
+     783:	b8 09 00 00 00       	mov    $0x9,%eax
+     788:	cd 40                	int    $0x40
+     78a:	c3                   	ret
+
+0000078b <dup>:
+SYSCALL(dup)
+     78b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     790:	cd 40                	int    $0x40
+     792:	c3                   	ret
+
+00000793 <getpid>:
+SYSCALL(getpid)
+     793:	b8 0b 00 00 00       	mov    $0xb,%eax
+     798:	cd 40                	int    $0x40
+     79a:	c3                   	ret
+
+0000079b <sbrk>:
+SYSCALL(sbrk)
+     79b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7a0:	cd 40                	int    $0x40
+     7a2:	c3                   	ret
+
+000007a3 <sleep>:
+SYSCALL(sleep)
+     7a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7a8:	cd 40                	int    $0x40
+     7aa:	c3                   	ret
+
+000007ab <uptime>:
+SYSCALL(uptime)
+     7ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7b0:	cd 40                	int    $0x40
+     7b2:	c3                   	ret
+
+000007b3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     7b3:	b8 16 00 00 00       	mov    $0x16,%eax
+     7b8:	cd 40                	int    $0x40
+     7ba:	c3                   	ret
+
+000007bb <get_parent_id>:
+SYSCALL(get_parent_id)
+     7bb:	b8 17 00 00 00       	mov    $0x17,%eax
+     7c0:	cd 40                	int    $0x40
+     7c2:	c3                   	ret
+
+000007c3 <get_children>:
+SYSCALL(get_children)
+     7c3:	b8 18 00 00 00       	mov    $0x18,%eax
+     7c8:	cd 40                	int    $0x40
+     7ca:	c3                   	ret
+
+000007cb <set_path>:
+SYSCALL(set_path)
+     7cb:	b8 19 00 00 00       	mov    $0x19,%eax
+     7d0:	cd 40                	int    $0x40
+     7d2:	c3                   	ret
+
+000007d3 <set_sleep>:
+SYSCALL(set_sleep)
+     7d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7d8:	cd 40                	int    $0x40
+     7da:	c3                   	ret
+
+000007db <get_time>:
+SYSCALL(get_time)
+     7db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7e0:	cd 40                	int    $0x40
+     7e2:	c3                   	ret
+
+000007e3 <change_process_level>:
+SYSCALL(change_process_level)
+     7e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7e8:	cd 40                	int    $0x40
+     7ea:	c3                   	ret
+
+000007eb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     7eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7f0:	cd 40                	int    $0x40
+     7f2:	c3                   	ret
+
+000007f3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     7f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7f8:	cd 40                	int    $0x40
+     7fa:	c3                   	ret
+
+000007fb <print_processes_info>:
+SYSCALL(print_processes_info)
+     7fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     800:	cd 40                	int    $0x40
+     802:	c3                   	ret
+
+00000803 <barrier_init>:
+
+SYSCALL(barrier_init)
+     803:	b8 20 00 00 00       	mov    $0x20,%eax
+     808:	cd 40                	int    $0x40
+     80a:	c3                   	ret
+
+0000080b <barrier_wait>:
+SYSCALL(barrier_wait)
+     80b:	b8 21 00 00 00       	mov    $0x21,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     813:	b8 22 00 00 00       	mov    $0x22,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     81b:	b8 23 00 00 00       	mov    $0x23,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <set_process_gang>:
+SYSCALL(set_process_gang)
+     823:	b8 24 00 00 00       	mov    $0x24,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     82b:	b8 25 00 00 00       	mov    $0x25,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <sem_create>:
+SYSCALL(sem_create)
+     833:	b8 26 00 00 00       	mov    $0x26,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <event_create>:
+SYSCALL(event_create)
+     83b:	b8 27 00 00 00       	mov    $0x27,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <sync_post>:
+SYSCALL(sync_post)
+     843:	b8 28 00 00 00       	mov    $0x28,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <sync_wait>:
+SYSCALL(sync_wait)
+     84b:	b8 29 00 00 00       	mov    $0x29,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <sync_close>:
+SYSCALL(sync_close)
+     853:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <event_reset>:
+SYSCALL(event_reset)
+     85b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     863:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <mmap>:
+SYSCALL(mmap)
+     86b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <munmap>:
+SYSCALL(munmap)
+     873:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+
+0000087b <shmget>:
+SYSCALL(shmget)
+     87b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     880:	cd 40                	int    $0x40
+     882:	c3                   	ret
+
+00000883 <shmat>:
+SYSCALL(shmat)
+     883:	b8 30 00 00 00       	mov    $0x30,%eax
+     888:	cd 40                	int    $0x40
+     88a:	c3                   	ret
+
+0000088b <shmdt>:
+SYSCALL(shmdt)
+     88b:	b8 31 00 00 00       	mov    $0x31,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <shmrm>:
+SYSCALL(shmrm)
+     893:	b8 32 00 00 00       	mov    $0x32,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <_spawn>:
+RAWSYSCALL(spawn)
+     89b:	b8 33 00 00 00       	mov    $0x33,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <memstat>:
+SYSCALL(memstat)
+     8a3:	b8 34 00 00 00       	mov    $0x34,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+     8ab:	66 90                	xchg   %ax,%ax
+     8ad:	66 90                	xchg   %ax,%ax
+     8af:	90                   	nop
+
+000008b0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     8b6:	a1 48 20 00 00       	mov    0x2048,%eax
+     8bb:	85 c0                	test   %eax,%eax
+     8bd:	7e 17                	jle    8d6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     8bf:	83 ec 04             	sub    $0x4,%esp
+     8c2:	50                   	push   %eax
+     8c3:	68 4c 20 00 00       	push   $0x204c
+     8c8:	ff 35 40 20 00 00    	push   0x2040
+     8ce:	e8 60 fe ff ff       	call   733 <write>
+     8d3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     8d6:	c7 05 48 20 00 00 00 	movl   $0x0,0x2048
+     8dd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     8e0:	c7 05 44 20 00 00 00 	movl   $0x0,0x2044
+     8e7:	00 00 00 
+}
+     8ea:	c9                   	leave
+     8eb:	c3                   	ret
+     8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8f6:	89 d1                	mov    %edx,%ecx
+{
+     8f8:	56                   	push   %esi
+     8f9:	53                   	push   %ebx
+     8fa:	89 c3                	mov    %eax,%ebx
+     8fc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     8ff:	85 d2                	test   %edx,%edx
+     901:	0f 89 b9 00 00 00    	jns    9c0 <printint+0xd0>
+     907:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     90b:	0f 84 af 00 00 00    	je     9c0 <printint+0xd0>
+    x = -xx;
+     911:	f7 d9                	neg    %ecx
+    neg = 1;
+     913:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     918:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     91b:	31 f6                	xor    %esi,%esi
+     91d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     920:	89 c8                	mov    %ecx,%eax
+     922:	31 d2                	xor    %edx,%edx
+     924:	89 f3                	mov    %esi,%ebx
+     926:	f7 f7                	div    %edi
+     928:	8d 76 01             	lea    0x1(%esi),%esi
+     92b:	0f b6 92 cc 12 00 00 	movzbl 0x12cc(%edx),%edx
+     932:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     936:	89 ca                	mov    %ecx,%edx
+     938:	89 c1                	mov    %eax,%ecx
+     93a:	39 fa                	cmp    %edi,%edx
+     93c:	73 e2                	jae    920 <printint+0x30>
+  if(neg)
+     93e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     941:	89 d9                	mov    %ebx,%ecx
+     943:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     946:	85 c0                	test   %eax,%eax
+     948:	74 07                	je     951 <printint+0x61>
+    buf[i++] = '-';
+     94a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     94f:	89 f1                	mov    %esi,%ecx
+     951:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     954:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     956:	8d 43 0c             	lea    0xc(%ebx),%eax
+     959:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     95c:	01 f7                	add    %esi,%edi
+     95e:	eb 09                	jmp    969 <printint+0x79>
+
+  while(--i >= 0)
+     960:	8d 47 ff             	lea    -0x1(%edi),%eax
+     963:	39 f7                	cmp    %esi,%edi
+     965:	74 36                	je     99d <printint+0xad>
+     967:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     969:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     96c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     96f:	8d 42 01             	lea    0x1(%edx),%eax
+     972:	89 43 08             	mov    %eax,0x8(%ebx)
+     975:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     979:	3d 00 02 00 00       	cmp    $0x200,%eax
+     97e:	74 28                	je     9a8 <printint+0xb8>
+     980:	80 f9 0a             	cmp    $0xa,%cl
+     983:	75 db                	jne    960 <printint+0x70>
+     985:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     989:	75 d5                	jne    960 <printint+0x70>
+  if(b->n > 0)
+     98b:	85 c0                	test   %eax,%eax
+     98d:	7f 19                	jg     9a8 <printint+0xb8>
+  b->n = 0;
+     98f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     996:	8d 47 ff             	lea    -0x1(%edi),%eax
+     999:	39 f7                	cmp    %esi,%edi
+     99b:	75 ca                	jne    967 <printint+0x77>
+}
+     99d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9a0:	5b                   	pop    %ebx
+     9a1:	5e                   	pop    %esi
+     9a2:	5f                   	pop    %edi
+     9a3:	5d                   	pop    %ebp
+     9a4:	c3                   	ret
+     9a5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     9a8:	83 ec 04             	sub    $0x4,%esp
+     9ab:	50                   	push   %eax
+     9ac:	ff 75 d4             	push   -0x2c(%ebp)
+     9af:	ff 33                	push   (%ebx)
+     9b1:	e8 7d fd ff ff       	call   733 <write>
+     9b6:	83 c4 10             	add    $0x10,%esp
+     9b9:	eb d4                	jmp    98f <printint+0x9f>
+     9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+  neg = 0;
+     9c0:	31 c0                	xor    %eax,%eax
+     9c2:	e9 51 ff ff ff       	jmp    918 <printint+0x28>
+     9c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ce:	66 90                	xchg   %ax,%ax
+
+000009d0 <putc>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	53                   	push   %ebx
+     9d4:	89 c3                	mov    %eax,%ebx
+     9d6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     9d9:	8b 48 08             	mov    0x8(%eax),%ecx
+     9dc:	8d 41 01             	lea    0x1(%ecx),%eax
+     9df:	89 43 08             	mov    %eax,0x8(%ebx)
+     9e2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     9e6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9eb:	74 33                	je     a20 <putc+0x50>
+     9ed:	80 fa 0a             	cmp    $0xa,%dl
+     9f0:	74 0e                	je     a00 <putc+0x30>
+}
+     9f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9f5:	c9                   	leave
+     9f6:	c3                   	ret
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     a00:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     a04:	75 ec                	jne    9f2 <putc+0x22>
+  if(b->n > 0)
+     a06:	85 c0                	test   %eax,%eax
+     a08:	7f 16                	jg     a20 <putc+0x50>
+  b->n = 0;
+     a0a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a14:	c9                   	leave
+     a15:	c3                   	ret
+     a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a20:	83 ec 04             	sub    $0x4,%esp
+     a23:	50                   	push   %eax
+     a24:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a27:	50                   	push   %eax
+     a28:	ff 33                	push   (%ebx)
+     a2a:	e8 04 fd ff ff       	call   733 <write>
+     a2f:	83 c4 10             	add    $0x10,%esp
+     a32:	eb d6                	jmp    a0a <putc+0x3a>
+     a34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+
+00000a40 <fflush>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     a46:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     a4a:	74 04                	je     a50 <fflush+0x10>
+}
+     a4c:	c9                   	leave
+     a4d:	c3                   	ret
+     a4e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a50:	a1 48 20 00 00       	mov    0x2048,%eax
+     a55:	85 c0                	test   %eax,%eax
+     a57:	7f 17                	jg     a70 <fflush+0x30>
+  b->n = 0;
+     a59:	c7 05 48 20 00 00 00 	movl   $0x0,0x2048
+     a60:	00 00 00 
+  out.mode = 0;
+     a63:	c7 05 44 20 00 00 00 	movl   $0x0,0x2044
+     a6a:	00 00 00 
+}
+     a6d:	c9                   	leave
+     a6e:	c3                   	ret
+     a6f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     a70:	83 ec 04             	sub    $0x4,%esp
+     a73:	50                   	push   %eax
+     a74:	68 4c 20 00 00       	push   $0x204c
+     a79:	ff 35 40 20 00 00    	push   0x2040
+     a7f:	e8 af fc ff ff       	call   733 <write>
+     a84:	83 c4 10             	add    $0x10,%esp
+     a87:	eb d0                	jmp    a59 <fflush+0x19>
+     a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+     a96:	83 ec 3c             	sub    $0x3c,%esp
+     a99:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     a9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     a9f:	83 fe 01             	cmp    $0x1,%esi
+     aa2:	0f 84 60 01 00 00    	je     c08 <printf+0x178>
+    b->fd = fd;
+     aa8:	89 35 20 1e 00 00    	mov    %esi,0x1e20
+  for(i = 0; fmt[i]; i++){
+     aae:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     ab1:	bf 20 1e 00 00       	mov    $0x1e20,%edi
+  for(i = 0; fmt[i]; i++){
+     ab6:	84 c0                	test   %al,%al
+     ab8:	74 65                	je     b1f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     aba:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     abd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     ac0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     ac2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     ac5:	eb 1f                	jmp    ae6 <printf+0x56>
+     ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ace:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     ad0:	83 f8 25             	cmp    $0x25,%eax
+     ad3:	74 3b                	je     b10 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     ad5:	89 f8                	mov    %edi,%eax
+     ad7:	e8 f4 fe ff ff       	call   9d0 <putc>
+  for(i = 0; fmt[i]; i++){
+     adc:	0f b6 03             	movzbl (%ebx),%eax
+     adf:	83 c3 01             	add    $0x1,%ebx
+     ae2:	84 c0                	test   %al,%al
+     ae4:	74 39                	je     b1f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     ae6:	0f be d0             	movsbl %al,%edx
+     ae9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     aec:	85 f6                	test   %esi,%esi
+     aee:	74 e0                	je     ad0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     af0:	83 fe 25             	cmp    $0x25,%esi
+     af3:	75 e7                	jne    adc <printf+0x4c>
+      if(c == 'd'){
+     af5:	83 f8 25             	cmp    $0x25,%eax
+     af8:	74 57                	je     b51 <printf+0xc1>
+     afa:	83 e8 63             	sub    $0x63,%eax
+     afd:	83 f8 15             	cmp    $0x15,%eax
+     b00:	77 36                	ja     b38 <printf+0xa8>
+     b02:	ff 24 85 74 12 00 00 	jmp    *0x1274(,%eax,4)
+     b09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     b10:	0f b6 03             	movzbl (%ebx),%eax
+     b13:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b16:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b1b:	84 c0                	test   %al,%al
+     b1d:	75 c7                	jne    ae6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     b1f:	8b 47 04             	mov    0x4(%edi),%eax
+     b22:	85 c0                	test   %eax,%eax
+     b24:	0f 84 06 01 00 00    	je     c30 <printf+0x1a0>
+    bflush(b);
+}
+     b2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b2d:	5b                   	pop    %ebx
+     b2e:	5e                   	pop    %esi
+     b2f:	5f                   	pop    %edi
+     b30:	5d                   	pop    %ebp
+     b31:	c3                   	ret
+     b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     b38:	8b 4f 08             	mov    0x8(%edi),%ecx
+     b3b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b3e:	89 47 08             	mov    %eax,0x8(%edi)
+     b41:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     b46:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b4b:	0f 84 77 01 00 00    	je     cc8 <printf+0x238>
+        putc(b, c);
+     b51:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b53:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b55:	e8 76 fe ff ff       	call   9d0 <putc>
+     b5a:	eb 80                	jmp    adc <printf+0x4c>
+     b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     b60:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b63:	83 ec 0c             	sub    $0xc,%esp
+     b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b6b:	8b 16                	mov    (%esi),%edx
+     b6d:	6a 00                	push   $0x0
+        ap++;
+     b6f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     b72:	89 f8                	mov    %edi,%eax
+     b74:	e8 77 fd ff ff       	call   8f0 <printint>
+        ap++;
+     b79:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     b7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b7f:	31 f6                	xor    %esi,%esi
+     b81:	e9 56 ff ff ff       	jmp    adc <printf+0x4c>
+     b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b90:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     b93:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     b95:	83 c0 04             	add    $0x4,%eax
+     b98:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     b9b:	85 c9                	test   %ecx,%ecx
+     b9d:	0f 84 cd 00 00 00    	je     c70 <printf+0x1e0>
+        while(*s != 0){
+     ba3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     ba6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     ba8:	84 d2                	test   %dl,%dl
+     baa:	0f 84 2c ff ff ff    	je     adc <printf+0x4c>
+          putc(b, *s);
+     bb0:	89 f8                	mov    %edi,%eax
+     bb2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     bb5:	e8 16 fe ff ff       	call   9d0 <putc>
+          s++;
+     bba:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     bbd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     bc1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     bc4:	84 d2                	test   %dl,%dl
+     bc6:	75 e8                	jne    bb0 <printf+0x120>
+      state = 0;
+     bc8:	31 f6                	xor    %esi,%esi
+     bca:	e9 0d ff ff ff       	jmp    adc <printf+0x4c>
+     bcf:	90                   	nop
+        printint(b, *ap, 10, 1);
+     bd0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     bd3:	83 ec 0c             	sub    $0xc,%esp
+     bd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     bdb:	8b 16                	mov    (%esi),%edx
+     bdd:	6a 01                	push   $0x1
+     bdf:	eb 8e                	jmp    b6f <printf+0xdf>
+     be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     be8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     beb:	89 f8                	mov    %edi,%eax
+     bed:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     bf0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     bf3:	e8 d8 fd ff ff       	call   9d0 <putc>
+        ap++;
+     bf8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     bfb:	31 f6                	xor    %esi,%esi
+     bfd:	e9 da fe ff ff       	jmp    adc <printf+0x4c>
+     c02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     c08:	8b 15 44 20 00 00    	mov    0x2044,%edx
+     c0e:	85 d2                	test   %edx,%edx
+     c10:	74 6e                	je     c80 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     c12:	0f b6 03             	movzbl (%ebx),%eax
+     c15:	bf 40 20 00 00       	mov    $0x2040,%edi
+     c1a:	84 c0                	test   %al,%al
+     c1c:	0f 85 98 fe ff ff    	jne    aba <printf+0x2a>
+     c22:	e9 03 ff ff ff       	jmp    b2a <printf+0x9a>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     c30:	8b 47 08             	mov    0x8(%edi),%eax
+     c33:	85 c0                	test   %eax,%eax
+     c35:	7f 19                	jg     c50 <printf+0x1c0>
+  b->n = 0;
+     c37:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c41:	5b                   	pop    %ebx
+     c42:	5e                   	pop    %esi
+     c43:	5f                   	pop    %edi
+     c44:	5d                   	pop    %ebp
+     c45:	c3                   	ret
+     c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     c50:	83 ec 04             	sub    $0x4,%esp
+     c53:	50                   	push   %eax
+     c54:	8d 47 0c             	lea    0xc(%edi),%eax
+     c57:	50                   	push   %eax
+     c58:	ff 37                	push   (%edi)
+     c5a:	e8 d4 fa ff ff       	call   733 <write>
+  b->n = 0;
+     c5f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     c66:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c69:	eb d3                	jmp    c3e <printf+0x1ae>
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+     c70:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     c75:	b9 6c 12 00 00       	mov    $0x126c,%ecx
+     c7a:	e9 31 ff ff ff       	jmp    bb0 <printf+0x120>
+     c7f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c80:	83 ec 08             	sub    $0x8,%esp
+     c83:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     c86:	c7 05 40 20 00 00 01 	movl   $0x1,0x2040
+     c8d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c90:	50                   	push   %eax
+     c91:	6a 01                	push   $0x1
+     c93:	e8 d3 fa ff ff       	call   76b <fstat>
+     c98:	83 c4 10             	add    $0x10,%esp
+     c9b:	85 c0                	test   %eax,%eax
+     c9d:	75 22                	jne    cc1 <printf+0x231>
+     c9f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     ca4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ca9:	0f 45 f0             	cmovne %eax,%esi
+     cac:	89 35 44 20 00 00    	mov    %esi,0x2044
+      stdioflush = flushout;
+     cb2:	c7 05 e0 1b 00 00 b0 	movl   $0x8b0,0x1be0
+     cb9:	08 00 00 
+     cbc:	e9 51 ff ff ff       	jmp    c12 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     cc1:	be 02 00 00 00       	mov    $0x2,%esi
+     cc6:	eb e4                	jmp    cac <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     cc8:	83 ec 04             	sub    $0x4,%esp
+     ccb:	8d 47 0c             	lea    0xc(%edi),%eax
+     cce:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     cd1:	68 00 02 00 00       	push   $0x200
+     cd6:	50                   	push   %eax
+     cd7:	ff 37                	push   (%edi)
+     cd9:	e8 55 fa ff ff       	call   733 <write>
+  b->n = 0;
+     cde:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     ce5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     ce8:	83 c4 10             	add    $0x10,%esp
+     ceb:	e9 61 fe ff ff       	jmp    b51 <printf+0xc1>
+
+00000cf0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	56                   	push   %esi
+     cf4:	53                   	push   %ebx
+     cf5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     cf7:	a1 60 22 00 00       	mov    0x2260,%eax
+     cfc:	39 d8                	cmp    %ebx,%eax
+     cfe:	0f 83 e4 00 00 00    	jae    de8 <freepages+0xf8>
+     d04:	85 c0                	test   %eax,%eax
+     d06:	0f 84 dc 00 00 00    	je     de8 <freepages+0xf8>
+     d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d10:	89 c2                	mov    %eax,%edx
+     d12:	8b 00                	mov    (%eax),%eax
+     d14:	85 c0                	test   %eax,%eax
+     d16:	74 04                	je     d1c <freepages+0x2c>
+     d18:	39 d8                	cmp    %ebx,%eax
+     d1a:	72 f4                	jb     d10 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     d1c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     d1f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     d21:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     d23:	85 c0                	test   %eax,%eax
+     d25:	74 15                	je     d3c <freepages+0x4c>
+    p->prev = s;
+     d27:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     d2a:	8b 73 10             	mov    0x10(%ebx),%esi
+     d2d:	89 f1                	mov    %esi,%ecx
+     d2f:	c1 e1 0c             	shl    $0xc,%ecx
+     d32:	01 d9                	add    %ebx,%ecx
+     d34:	39 c8                	cmp    %ecx,%eax
+     d36:	0f 84 d8 00 00 00    	je     e14 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     d3c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     d3f:	89 c8                	mov    %ecx,%eax
+     d41:	c1 e0 0c             	shl    $0xc,%eax
+     d44:	01 d0                	add    %edx,%eax
+     d46:	39 c3                	cmp    %eax,%ebx
+     d48:	74 16                	je     d60 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     d4a:	8b 03                	mov    (%ebx),%eax
+     d4c:	85 c0                	test   %eax,%eax
+     d4e:	74 40                	je     d90 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     d50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d53:	5b                   	pop    %ebx
+     d54:	5e                   	pop    %esi
+     d55:	5d                   	pop    %ebp
+     d56:	c3                   	ret
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     d60:	03 4b 10             	add    0x10(%ebx),%ecx
+     d63:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     d66:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     d69:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     d6b:	85 c9                	test   %ecx,%ecx
+     d6d:	0f 84 dd 00 00 00    	je     e50 <freepages+0x160>
+    s->prev->next = s->next;
+     d73:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     d75:	85 c0                	test   %eax,%eax
+     d77:	74 06                	je     d7f <freepages+0x8f>
+    s->next->prev = s->prev;
+     d79:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     d7c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     d7f:	8b 02                	mov    (%edx),%eax
+     d81:	89 d3                	mov    %edx,%ebx
+     d83:	85 c0                	test   %eax,%eax
+     d85:	75 c9                	jne    d50 <freepages+0x60>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+     d90:	8b 43 10             	mov    0x10(%ebx),%eax
+     d93:	83 f8 0f             	cmp    $0xf,%eax
+     d96:	76 b8                	jbe    d50 <freepages+0x60>
+     d98:	83 ec 0c             	sub    $0xc,%esp
+     d9b:	c1 e0 0c             	shl    $0xc,%eax
+     d9e:	6a 00                	push   $0x0
+     da0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     da3:	e8 f3 f9 ff ff       	call   79b <sbrk>
+     da8:	83 c4 10             	add    $0x10,%esp
+     dab:	39 c6                	cmp    %eax,%esi
+     dad:	75 a1                	jne    d50 <freepages+0x60>
+  if(s->prev)
+     daf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     db2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     db4:	85 d2                	test   %edx,%edx
+     db6:	0f 84 a5 00 00 00    	je     e61 <freepages+0x171>
+    s->prev->next = s->next;
+     dbc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     dbe:	85 c0                	test   %eax,%eax
+     dc0:	74 06                	je     dc8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     dc2:	8b 53 04             	mov    0x4(%ebx),%edx
+     dc5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     dc8:	8b 43 10             	mov    0x10(%ebx),%eax
+     dcb:	83 ec 0c             	sub    $0xc,%esp
+     dce:	c1 e0 0c             	shl    $0xc,%eax
+     dd1:	f7 d8                	neg    %eax
+     dd3:	50                   	push   %eax
+     dd4:	e8 c2 f9 ff ff       	call   79b <sbrk>
+     dd9:	83 c4 10             	add    $0x10,%esp
+}
+     ddc:	e9 6f ff ff ff       	jmp    d50 <freepages+0x60>
+     de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     de8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     def:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     df1:	89 1d 60 22 00 00    	mov    %ebx,0x2260
+  if(p)
+     df7:	85 c0                	test   %eax,%eax
+     df9:	74 95                	je     d90 <freepages+0xa0>
+    p->prev = s;
+     dfb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     dfe:	8b 73 10             	mov    0x10(%ebx),%esi
+     e01:	89 f2                	mov    %esi,%edx
+     e03:	c1 e2 0c             	shl    $0xc,%edx
+     e06:	01 da                	add    %ebx,%edx
+     e08:	39 d0                	cmp    %edx,%eax
+     e0a:	0f 85 3a ff ff ff    	jne    d4a <freepages+0x5a>
+     e10:	89 c1                	mov    %eax,%ecx
+     e12:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     e14:	8b 41 10             	mov    0x10(%ecx),%eax
+     e17:	01 f0                	add    %esi,%eax
+     e19:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     e1c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     e1f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     e21:	85 f6                	test   %esi,%esi
+     e23:	74 35                	je     e5a <freepages+0x16a>
+    s->prev->next = s->next;
+     e25:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     e27:	85 c0                	test   %eax,%eax
+     e29:	74 06                	je     e31 <freepages+0x141>
+    s->next->prev = s->prev;
+     e2b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     e2e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     e31:	85 d2                	test   %edx,%edx
+     e33:	0f 84 11 ff ff ff    	je     d4a <freepages+0x5a>
+     e39:	8b 4a 10             	mov    0x10(%edx),%ecx
+     e3c:	89 c8                	mov    %ecx,%eax
+     e3e:	c1 e0 0c             	shl    $0xc,%eax
+     e41:	01 d0                	add    %edx,%eax
+     e43:	39 c3                	cmp    %eax,%ebx
+     e45:	0f 85 ff fe ff ff    	jne    d4a <freepages+0x5a>
+     e4b:	e9 10 ff ff ff       	jmp    d60 <freepages+0x70>
+    *l = s->next;
+     e50:	a3 60 22 00 00       	mov    %eax,0x2260
+     e55:	e9 1b ff ff ff       	jmp    d75 <freepages+0x85>
+     e5a:	a3 60 22 00 00       	mov    %eax,0x2260
+     e5f:	eb c6                	jmp    e27 <freepages+0x137>
+     e61:	a3 60 22 00 00       	mov    %eax,0x2260
+     e66:	e9 53 ff ff ff       	jmp    dbe <freepages+0xce>
+     e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+     e75:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     e77:	a1 60 22 00 00       	mov    0x2260,%eax
+     e7c:	85 c0                	test   %eax,%eax
+     e7e:	74 5e                	je     ede <getpages+0x6e>
+    if(s->npages < n)
+     e80:	8b 50 10             	mov    0x10(%eax),%edx
+     e83:	39 da                	cmp    %ebx,%edx
+     e85:	72 51                	jb     ed8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     e87:	39 d3                	cmp    %edx,%ebx
+     e89:	72 25                	jb     eb0 <getpages+0x40>
+  if(s->prev)
+     e8b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     e8e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     e90:	85 c9                	test   %ecx,%ecx
+     e92:	0f 84 a8 00 00 00    	je     f40 <getpages+0xd0>
+    s->prev->next = s->next;
+     e98:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     e9a:	85 d2                	test   %edx,%edx
+     e9c:	74 06                	je     ea4 <getpages+0x34>
+    s->next->prev = s->prev;
+     e9e:	8b 48 04             	mov    0x4(%eax),%ecx
+     ea1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     ea4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eaa:	5b                   	pop    %ebx
+     eab:	5e                   	pop    %esi
+     eac:	5d                   	pop    %ebp
+     ead:	c3                   	ret
+     eae:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     eb0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     eb2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     eb4:	c1 e1 0c             	shl    $0xc,%ecx
+     eb7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     eb9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     ebc:	8b 70 04             	mov    0x4(%eax),%esi
+     ebf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     ec2:	8b 10                	mov    (%eax),%edx
+     ec4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     ec6:	85 f6                	test   %esi,%esi
+     ec8:	74 66                	je     f30 <getpages+0xc0>
+        rest->prev->next = rest;
+     eca:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     ecc:	8b 11                	mov    (%ecx),%edx
+     ece:	85 d2                	test   %edx,%edx
+     ed0:	75 cf                	jne    ea1 <getpages+0x31>
+     ed2:	eb d0                	jmp    ea4 <getpages+0x34>
+     ed4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     ed8:	8b 00                	mov    (%eax),%eax
+     eda:	85 c0                	test   %eax,%eax
+     edc:	75 a2                	jne    e80 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     ede:	83 ec 0c             	sub    $0xc,%esp
+     ee1:	6a 00                	push   $0x0
+     ee3:	e8 b3 f8 ff ff       	call   79b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     ee8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     eeb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     ef1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     ef3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     ef9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     eff:	29 d0                	sub    %edx,%eax
+     f01:	c1 e8 0c             	shr    $0xc,%eax
+     f04:	39 d8                	cmp    %ebx,%eax
+     f06:	72 48                	jb     f50 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     f08:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     f0a:	89 d8                	mov    %ebx,%eax
+     f0c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     f0f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     f11:	c1 e0 0c             	shl    $0xc,%eax
+     f14:	01 f0                	add    %esi,%eax
+     f16:	50                   	push   %eax
+     f17:	e8 7f f8 ff ff       	call   79b <sbrk>
+     f1c:	83 c4 10             	add    $0x10,%esp
+     f1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f22:	74 2c                	je     f50 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     f24:	01 f0                	add    %esi,%eax
+     f26:	e9 79 ff ff ff       	jmp    ea4 <getpages+0x34>
+     f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+        runs = rest;
+     f30:	89 0d 60 22 00 00    	mov    %ecx,0x2260
+     f36:	eb 96                	jmp    ece <getpages+0x5e>
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+    *l = s->next;
+     f40:	89 15 60 22 00 00    	mov    %edx,0x2260
+     f46:	e9 4f ff ff ff       	jmp    e9a <getpages+0x2a>
+     f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+    return 0;
+     f50:	31 c0                	xor    %eax,%eax
+     f52:	e9 50 ff ff ff       	jmp    ea7 <getpages+0x37>
+     f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5e:	66 90                	xchg   %ax,%ax
+
+00000f60 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 1c             	sub    $0x1c,%esp
+     f69:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     f6c:	85 c0                	test   %eax,%eax
+     f6e:	0f 84 97 00 00 00    	je     100b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     f74:	89 c3                	mov    %eax,%ebx
+     f76:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     f7c:	8b 73 14             	mov    0x14(%ebx),%esi
+     f7f:	83 fe 01             	cmp    $0x1,%esi
+     f82:	74 74                	je     ff8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     f84:	85 f6                	test   %esi,%esi
+     f86:	74 5d                	je     fe5 <free+0x85>
+  if(s->free == 0)
+     f88:	8b 53 08             	mov    0x8(%ebx),%edx
+     f8b:	85 d2                	test   %edx,%edx
+     f8d:	0f 84 85 00 00 00    	je     1018 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     f93:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     f95:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     f98:	8b 43 0c             	mov    0xc(%ebx),%eax
+     f9b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     f9e:	8b 04 f5 84 22 00 00 	mov    0x2284(,%esi,8),%eax
+  s->inuse--;
+     fa5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     fa8:	83 c0 01             	add    $0x1,%eax
+     fab:	89 04 f5 84 22 00 00 	mov    %eax,0x2284(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     fb2:	85 d2                	test   %edx,%edx
+     fb4:	75 55                	jne    100b <free+0xab>
+     fb6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     fbb:	89 f1                	mov    %esi,%ecx
+     fbd:	d3 ea                	shr    %cl,%edx
+     fbf:	39 c2                	cmp    %eax,%edx
+     fc1:	73 7d                	jae    1040 <free+0xe0>
+  if(s->prev)
+     fc3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     fc6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     fc8:	85 ff                	test   %edi,%edi
+     fca:	0f 84 a0 00 00 00    	je     1070 <free+0x110>
+    s->prev->next = s->next;
+     fd0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     fd2:	85 c9                	test   %ecx,%ecx
+     fd4:	74 06                	je     fdc <free+0x7c>
+    s->next->prev = s->prev;
+     fd6:	8b 7b 04             	mov    0x4(%ebx),%edi
+     fd9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     fdc:	29 d0                	sub    %edx,%eax
+     fde:	89 04 f5 84 22 00 00 	mov    %eax,0x2284(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     fe5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     fe8:	89 d8                	mov    %ebx,%eax
+}
+     fea:	5b                   	pop    %ebx
+     feb:	5e                   	pop    %esi
+     fec:	5f                   	pop    %edi
+     fed:	5d                   	pop    %ebp
+    freepages(s);
+     fee:	e9 fd fc ff ff       	jmp    cf0 <freepages>
+     ff3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ff7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     ff8:	8b 43 10             	mov    0x10(%ebx),%eax
+     ffb:	83 ec 08             	sub    $0x8,%esp
+     ffe:	c1 e0 0c             	shl    $0xc,%eax
+    1001:	50                   	push   %eax
+    1002:	53                   	push   %ebx
+    1003:	e8 6b f8 ff ff       	call   873 <munmap>
+    1008:	83 c4 10             	add    $0x10,%esp
+}
+    100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    100e:	5b                   	pop    %ebx
+    100f:	5e                   	pop    %esi
+    1010:	5f                   	pop    %edi
+    1011:	5d                   	pop    %ebp
+    1012:	c3                   	ret
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+  s->next = *l;
+    1018:	8b 14 f5 80 22 00 00 	mov    0x2280(,%esi,8),%edx
+  s->prev = 0;
+    101f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    1026:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    1028:	85 d2                	test   %edx,%edx
+    102a:	74 06                	je     1032 <free+0xd2>
+    (*l)->prev = s;
+    102c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    102f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1032:	89 1c f5 80 22 00 00 	mov    %ebx,0x2280(,%esi,8)
+}
+    1039:	e9 55 ff ff ff       	jmp    f93 <free+0x33>
+    103e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1046:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1049:	6a 00                	push   $0x0
+    104b:	c1 e7 0c             	shl    $0xc,%edi
+    104e:	01 df                	add    %ebx,%edi
+    1050:	e8 46 f7 ff ff       	call   79b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1055:	83 c4 10             	add    $0x10,%esp
+    1058:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    105b:	39 c7                	cmp    %eax,%edi
+    105d:	75 ac                	jne    100b <free+0xab>
+    105f:	8b 04 f5 84 22 00 00 	mov    0x2284(,%esi,8),%eax
+    1066:	e9 58 ff ff ff       	jmp    fc3 <free+0x63>
+    106b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+    *l = s->next;
+    1070:	89 0c f5 80 22 00 00 	mov    %ecx,0x2280(,%esi,8)
+    1077:	e9 56 ff ff ff       	jmp    fd2 <free+0x72>
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001080 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1080:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1081:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    1086:	89 e5                	mov    %esp,%ebp
+    1088:	57                   	push   %edi
+    1089:	56                   	push   %esi
+    108a:	53                   	push   %ebx
+    108b:	83 ec 1c             	sub    $0x1c,%esp
+    108e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    1091:	83 f8 10             	cmp    $0x10,%eax
+    1094:	0f 86 92 00 00 00    	jbe    112c <malloc+0xac>
+    109a:	ba 01 00 00 00       	mov    $0x1,%edx
+    109f:	eb 13                	jmp    10b4 <malloc+0x34>
+    10a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10a8:	89 d3                	mov    %edx,%ebx
+    10aa:	d3 e3                	shl    %cl,%ebx
+    10ac:	39 c3                	cmp    %eax,%ebx
+    10ae:	0f 83 84 00 00 00    	jae    1138 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    10b4:	83 c1 01             	add    $0x1,%ecx
+    10b7:	83 f9 0b             	cmp    $0xb,%ecx
+    10ba:	75 ec                	jne    10a8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    10bc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    10c1:	0f 87 c9 00 00 00    	ja     1190 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    10c7:	05 17 10 00 00       	add    $0x1017,%eax
+    10cc:	89 c3                	mov    %eax,%ebx
+    10ce:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    10d1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    10d6:	77 28                	ja     1100 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    10d8:	89 d8                	mov    %ebx,%eax
+    10da:	e8 91 fd ff ff       	call   e70 <getpages>
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	0f 84 a9 00 00 00    	je     1190 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    10e7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    10ee:	83 c0 18             	add    $0x18,%eax
+}
+    10f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10f4:	5b                   	pop    %ebx
+    10f5:	5e                   	pop    %esi
+    10f6:	5f                   	pop    %edi
+    10f7:	5d                   	pop    %ebp
+    10f8:	c3                   	ret
+    10f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    1100:	89 d8                	mov    %ebx,%eax
+    1102:	83 ec 08             	sub    $0x8,%esp
+    1105:	c1 e0 0c             	shl    $0xc,%eax
+    1108:	6a 00                	push   $0x0
+    110a:	6a ff                	push   $0xffffffff
+    110c:	6a 22                	push   $0x22
+    110e:	6a 03                	push   $0x3
+    1110:	50                   	push   %eax
+    1111:	6a 00                	push   $0x0
+    1113:	e8 53 f7 ff ff       	call   86b <mmap>
+    if(s == MAP_FAILED)
+    1118:	83 c4 20             	add    $0x20,%esp
+    111b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    111e:	74 b8                	je     10d8 <malloc+0x58>
+      s->shift = MAPRUN;
+    1120:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    1127:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    112a:	eb c2                	jmp    10ee <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    112c:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1138:	8b 34 cd 80 22 00 00 	mov    0x2280(,%ecx,8),%esi
+    113f:	85 f6                	test   %esi,%esi
+    1141:	74 57                	je     119a <malloc+0x11a>
+  classes[shift].nfree--;
+    1143:	8b 1c cd 84 22 00 00 	mov    0x2284(,%ecx,8),%ebx
+  o = s->free;
+    114a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    114d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1150:	89 14 cd 84 22 00 00 	mov    %edx,0x2284(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1157:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1159:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    115d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1160:	85 ff                	test   %edi,%edi
+    1162:	75 8d                	jne    10f1 <malloc+0x71>
+  if(s->prev)
+    1164:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1167:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1169:	85 db                	test   %ebx,%ebx
+    116b:	0f 84 b7 00 00 00    	je     1228 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1171:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1173:	85 d2                	test   %edx,%edx
+    1175:	0f 84 76 ff ff ff    	je     10f1 <malloc+0x71>
+    s->next->prev = s->prev;
+    117b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    117e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1181:	e9 6b ff ff ff       	jmp    10f1 <malloc+0x71>
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    1193:	31 c0                	xor    %eax,%eax
+}
+    1195:	5b                   	pop    %ebx
+    1196:	5e                   	pop    %esi
+    1197:	5f                   	pop    %edi
+    1198:	5d                   	pop    %ebp
+    1199:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    119a:	b8 01 00 00 00       	mov    $0x1,%eax
+    119f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    11a2:	e8 c9 fc ff ff       	call   e70 <getpages>
+    11a7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    11aa:	85 c0                	test   %eax,%eax
+    11ac:	89 c2                	mov    %eax,%edx
+    11ae:	74 e0                	je     1190 <malloc+0x110>
+    s->shift = shift;
+    11b0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11b3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    11b5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    11bc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11c1:	89 df                	mov    %ebx,%edi
+    11c3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    11c5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    11c7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    11ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11cd:	83 e8 01             	sub    $0x1,%eax
+    11d0:	d3 e0                	shl    %cl,%eax
+    11d2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    11d5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    11dc:	eb 04                	jmp    11e2 <malloc+0x162>
+    11de:	66 90                	xchg   %ax,%ax
+    11e0:	89 c8                	mov    %ecx,%eax
+    11e2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    11e5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11e7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    11ea:	89 c6                	mov    %eax,%esi
+    11ec:	39 da                	cmp    %ebx,%edx
+    11ee:	7f f0                	jg     11e0 <malloc+0x160>
+    11f0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    11f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    11f6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    11f9:	8b 04 cd 80 22 00 00 	mov    0x2280(,%ecx,8),%eax
+  s->prev = 0;
+    1200:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1207:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1209:	85 c0                	test   %eax,%eax
+    120b:	74 03                	je     1210 <malloc+0x190>
+    (*l)->prev = s;
+    120d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1210:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1213:	89 14 cd 80 22 00 00 	mov    %edx,0x2280(,%ecx,8)
+    classes[shift].nfree += n;
+    121a:	89 d6                	mov    %edx,%esi
+    121c:	03 1c cd 84 22 00 00 	add    0x2284(,%ecx,8),%ebx
+    1223:	e9 22 ff ff ff       	jmp    114a <malloc+0xca>
+    *l = s->next;
+    1228:	89 14 cd 80 22 00 00 	mov    %edx,0x2280(,%ecx,8)
+    122f:	e9 3f ff ff ff       	jmp    1173 <malloc+0xf3>
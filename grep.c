@@ -20,10 +20,8 @@ grep(char *pattern, int fd)
     p = buf;
     while((q = strchr(p, '\n')) != 0){
       *q = 0;
-      if(match(pattern, p)){
-        *q = '\n';
-        write(1, p, q+1 - p);
-      }
+      if(match(pattern, p))
+        printf(1, "%s\n", p);
       p = q+1;
     }
     if(p == buf)
@@ -0,0 +1,2226 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 c4 0f 00 00       	push   $0xfc4
+  19:	e8 c5 04 00 00       	call   4e3 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 af 00 00 00    	js     d8 <main+0xd8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 e8 04 00 00       	call   51b <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 dc 04 00 00       	call   51b <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 cc 0f 00 00       	push   $0xfcc
+  50:	6a 01                	push   $0x1
+  52:	e8 c9 07 00 00       	call   820 <printf>
+    pid = fork();
+  57:	e8 a4 00 00 00       	call   100 <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 3c                	js     a1 <main+0xa1>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 4d                	je     b4 <main+0xb4>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    printf(1, "Zhivar Sourati - MohsenFayyaz.ir - Bardia Eghbali\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 14 10 00 00       	push   $0x1014
+  6f:	6a 01                	push   $0x1
+  71:	e8 aa 07 00 00       	call   820 <printf>
+    while((wpid=wait()) >= 0 && wpid != pid)
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  80:	e8 26 04 00 00       	call   4ab <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	78 bf                	js     48 <main+0x48>
+  89:	39 c3                	cmp    %eax,%ebx
+  8b:	74 bb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 0b 10 00 00       	push   $0x100b
+  95:	6a 01                	push   $0x1
+  97:	e8 84 07 00 00       	call   820 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	eb df                	jmp    80 <main+0x80>
+      printf(1, "init: fork failed\n");
+  a1:	53                   	push   %ebx
+  a2:	53                   	push   %ebx
+  a3:	68 df 0f 00 00       	push   $0xfdf
+  a8:	6a 01                	push   $0x1
+  aa:	e8 71 07 00 00       	call   820 <printf>
+      exit();
+  af:	e8 7c 00 00 00       	call   130 <exit>
+      exec("sh", argv);
+  b4:	50                   	push   %eax
+  b5:	50                   	push   %eax
+  b6:	68 c0 14 00 00       	push   $0x14c0
+  bb:	68 f2 0f 00 00       	push   $0xff2
+  c0:	e8 8b 00 00 00       	call   150 <exec>
+      printf(1, "init: exec sh failed\n");
+  c5:	5a                   	pop    %edx
+  c6:	59                   	pop    %ecx
+  c7:	68 f5 0f 00 00       	push   $0xff5
+  cc:	6a 01                	push   $0x1
+  ce:	e8 4d 07 00 00       	call   820 <printf>
+      exit();
+  d3:	e8 58 00 00 00       	call   130 <exit>
+    mknod("console", 1, 1);
+  d8:	50                   	push   %eax
+  d9:	6a 01                	push   $0x1
+  db:	6a 01                	push   $0x1
+  dd:	68 c4 0f 00 00       	push   $0xfc4
+  e2:	e8 04 04 00 00       	call   4eb <mknod>
+    open("console", O_RDWR);
+  e7:	58                   	pop    %eax
+  e8:	5a                   	pop    %edx
+  e9:	6a 02                	push   $0x2
+  eb:	68 c4 0f 00 00       	push   $0xfc4
+  f0:	e8 ee 03 00 00       	call   4e3 <open>
+  f5:	83 c4 10             	add    $0x10,%esp
+  f8:	e9 2c ff ff ff       	jmp    29 <main+0x29>
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+ 100:	a1 e0 14 00 00       	mov    0x14e0,%eax
+ 105:	85 c0                	test   %eax,%eax
+ 107:	74 17                	je     120 <fork+0x20>
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+ 10f:	ff d0                	call   *%eax
+  return _fork();
+}
+ 111:	c9                   	leave
+  return _fork();
+ 112:	e9 84 03 00 00       	jmp    49b <_fork>
+ 117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11e:	66 90                	xchg   %ax,%ax
+ 120:	e9 76 03 00 00       	jmp    49b <_fork>
+ 125:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <exit>:
+
+int
+exit(void)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+ 136:	a1 e0 14 00 00       	mov    0x14e0,%eax
+ 13b:	85 c0                	test   %eax,%eax
+ 13d:	74 02                	je     141 <exit+0x11>
+    stdioflush();
+ 13f:	ff d0                	call   *%eax
+  _exit();
+ 141:	e8 5d 03 00 00       	call   4a3 <_exit>
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000150 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+ 150:	55                   	push   %ebp
+  if(stdioflush)
+ 151:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+ 156:	89 e5                	mov    %esp,%ebp
+ 158:	56                   	push   %esi
+ 159:	53                   	push   %ebx
+ 15a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 15d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+ 160:	85 c0                	test   %eax,%eax
+ 162:	74 02                	je     166 <exec+0x16>
+    stdioflush();
+ 164:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 166:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 169:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 16c:	5b                   	pop    %ebx
+ 16d:	5e                   	pop    %esi
+ 16e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 16f:	e9 67 03 00 00       	jmp    4db <_exec>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+ 189:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+ 18e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 191:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 194:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 197:	85 c0                	test   %eax,%eax
+ 199:	74 02                	je     19d <spawn+0x1d>
+    stdioflush();
+ 19b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 19d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 1a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 1a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1a6:	83 c4 0c             	add    $0xc,%esp
+ 1a9:	5b                   	pop    %ebx
+ 1aa:	5e                   	pop    %esi
+ 1ab:	5f                   	pop    %edi
+ 1ac:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 1ad:	e9 79 04 00 00       	jmp    62b <_spawn>
+ 1b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 2e9:	a1 e0 14 00 00       	mov    0x14e0,%eax
+{
+ 2ee:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2f1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 2f4:	85 c0                	test   %eax,%eax
+ 2f6:	74 02                	je     2fa <gets+0x1a>
+    stdioflush();
+ 2f8:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 2fa:	a1 08 17 00 00       	mov    0x1708,%eax
+ 2ff:	85 c0                	test   %eax,%eax
+ 301:	0f 84 99 00 00 00    	je     3a0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 307:	31 db                	xor    %ebx,%ebx
+ 309:	eb 21                	jmp    32c <gets+0x4c>
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 310:	8d 50 01             	lea    0x1(%eax),%edx
+ 313:	0f b6 80 00 15 00 00 	movzbl 0x1500(%eax),%eax
+ 31a:	89 15 00 17 00 00    	mov    %edx,0x1700
+    buf[i++] = c;
+ 320:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 324:	3c 0a                	cmp    $0xa,%al
+ 326:	74 60                	je     388 <gets+0xa8>
+ 328:	3c 0d                	cmp    $0xd,%al
+ 32a:	74 5c                	je     388 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 32c:	89 da                	mov    %ebx,%edx
+ 32e:	83 c3 01             	add    $0x1,%ebx
+ 331:	39 fb                	cmp    %edi,%ebx
+ 333:	7d 55                	jge    38a <gets+0xaa>
+    if(in.r == in.n){
+ 335:	a1 00 17 00 00       	mov    0x1700,%eax
+ 33a:	3b 05 04 17 00 00    	cmp    0x1704,%eax
+ 340:	75 ce                	jne    310 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 342:	83 ec 04             	sub    $0x4,%esp
+ 345:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 348:	c7 05 04 17 00 00 00 	movl   $0x0,0x1704
+ 34f:	00 00 00 
+ 352:	c7 05 00 17 00 00 00 	movl   $0x0,0x1700
+ 359:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 35c:	ff 35 08 17 00 00    	push   0x1708
+ 362:	68 00 15 00 00       	push   $0x1500
+ 367:	6a 00                	push   $0x0
+ 369:	e8 4d 01 00 00       	call   4bb <read>
+ 36e:	83 c4 10             	add    $0x10,%esp
+ 371:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 374:	85 c0                	test   %eax,%eax
+ 376:	a3 04 17 00 00       	mov    %eax,0x1704
+ 37b:	7e 56                	jle    3d3 <gets+0xf3>
+    c = in.buf[in.r++];
+ 37d:	a1 00 17 00 00       	mov    0x1700,%eax
+ 382:	eb 8c                	jmp    310 <gets+0x30>
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 388:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 38a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 38e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 391:	89 f0                	mov    %esi,%eax
+ 393:	5b                   	pop    %ebx
+ 394:	5e                   	pop    %esi
+ 395:	5f                   	pop    %edi
+ 396:	5d                   	pop    %ebp
+ 397:	c3                   	ret
+ 398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 3a0:	83 ec 08             	sub    $0x8,%esp
+ 3a3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 3a6:	50                   	push   %eax
+ 3a7:	6a 00                	push   $0x0
+ 3a9:	e8 4d 01 00 00       	call   4fb <fstat>
+ 3ae:	83 c4 10             	add    $0x10,%esp
+ 3b1:	89 c2                	mov    %eax,%edx
+ 3b3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b8:	85 d2                	test   %edx,%edx
+ 3ba:	75 0d                	jne    3c9 <gets+0xe9>
+ 3bc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 3c1:	ba 00 02 00 00       	mov    $0x200,%edx
+ 3c6:	0f 44 c2             	cmove  %edx,%eax
+ 3c9:	a3 08 17 00 00       	mov    %eax,0x1708
+ 3ce:	e9 34 ff ff ff       	jmp    307 <gets+0x27>
+        in.n = 0;
+ 3d3:	c7 05 04 17 00 00 00 	movl   $0x0,0x1704
+ 3da:	00 00 00 
+        break;
+ 3dd:	eb ab                	jmp    38a <gets+0xaa>
+ 3df:	90                   	nop
+
+000003e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	56                   	push   %esi
+ 3e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	6a 00                	push   $0x0
+ 3ea:	ff 75 08             	push   0x8(%ebp)
+ 3ed:	e8 f1 00 00 00       	call   4e3 <open>
+  if(fd < 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	78 27                	js     420 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	ff 75 0c             	push   0xc(%ebp)
+ 3ff:	89 c3                	mov    %eax,%ebx
+ 401:	50                   	push   %eax
+ 402:	e8 f4 00 00 00       	call   4fb <fstat>
+  close(fd);
+ 407:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 40a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 40c:	e8 ba 00 00 00       	call   4cb <close>
+  return r;
+ 411:	83 c4 10             	add    $0x10,%esp
+}
+ 414:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 417:	89 f0                	mov    %esi,%eax
+ 419:	5b                   	pop    %ebx
+ 41a:	5e                   	pop    %esi
+ 41b:	5d                   	pop    %ebp
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 420:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 425:	eb ed                	jmp    414 <stat+0x34>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 437:	0f be 02             	movsbl (%edx),%eax
+ 43a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 43d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 440:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 445:	77 1e                	ja     465 <atoi+0x35>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 450:	83 c2 01             	add    $0x1,%edx
+ 453:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 456:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 45a:	0f be 02             	movsbl (%edx),%eax
+ 45d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 460:	80 fb 09             	cmp    $0x9,%bl
+ 463:	76 eb                	jbe    450 <atoi+0x20>
+  return n;
+}
+ 465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 468:	89 c8                	mov    %ecx,%eax
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	8b 45 10             	mov    0x10(%ebp),%eax
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 47e:	85 c0                	test   %eax,%eax
+ 480:	7e 13                	jle    495 <memmove+0x25>
+ 482:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 484:	89 d7                	mov    %edx,%edi
+ 486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 490:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 491:	39 f8                	cmp    %edi,%eax
+ 493:	75 fb                	jne    490 <memmove+0x20>
+  return vdst;
+}
+ 495:	5e                   	pop    %esi
+ 496:	89 d0                	mov    %edx,%eax
+ 498:	5f                   	pop    %edi
+ 499:	5d                   	pop    %ebp
+ 49a:	c3                   	ret
+
+0000049b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 49b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <_exit>:
+RAWSYSCALL(exit)
+ 4a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <wait>:
+SYSCALL(wait)
+ 4ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+ 4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <read>:
+SYSCALL(read)
+ 4bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <write>:
+SYSCALL(write)
+ 4c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <close>:
+SYSCALL(close)
+ 4cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <kill>:
+SYSCALL(kill)
+ 4d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <_exec>:
+RAWSYSCALL(exec)
+ 4db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <open>:
+SYSCALL(open)
+ 4e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <mknod>:
+SYSCALL(mknod)
+ 4eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <unlink>:
+SYSCALL(unlink)
+ 4f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <fstat>:
+SYSCALL(fstat)
+ 4fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <link>:
+SYSCALL(link)
+ 503:	b8 13 00 00 00       	mov    $0x13,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mkdir>:
+SYSCALL(mkdir)
+ 50b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <chdir>:
+SYSCALL(chdir)
+ 513:	b8 09 00 00 00       	mov    $0x9,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <dup>:
+SYSCALL(dup)
+ 51b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpid>:
+SYSCALL(getpid)
+ 523:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sbrk>:
+SYSCALL(sbrk)
+ 52b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+ 533:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <uptime>:
+SYSCALL(uptime)
+ 53b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 543:	b8 16 00 00 00       	mov    $0x16,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <get_parent_id>:
+SYSCALL(get_parent_id)
+ 54b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <get_children>:
+SYSCALL(get_children)
+ 553:	b8 18 00 00 00       	mov    $0x18,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <set_path>:
+SYSCALL(set_path)
+ 55b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <set_sleep>:
+SYSCALL(set_sleep)
+ 563:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <get_time>:
+SYSCALL(get_time)
+ 56b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <change_process_level>:
+SYSCALL(change_process_level)
+ 573:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 57b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 583:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <print_processes_info>:
+SYSCALL(print_processes_info)
+ 58b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 593:	b8 20 00 00 00       	mov    $0x20,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <barrier_wait>:
+SYSCALL(barrier_wait)
+ 59b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 5a3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 5ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 5b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 5bb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sem_create>:
+SYSCALL(sem_create)
+ 5c3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <event_create>:
+SYSCALL(event_create)
+ 5cb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sync_post>:
+SYSCALL(sync_post)
+ 5d3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sync_wait>:
+SYSCALL(sync_wait)
+ 5db:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sync_close>:
+SYSCALL(sync_close)
+ 5e3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <event_reset>:
+SYSCALL(event_reset)
+ 5eb:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 5f3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mmap>:
+SYSCALL(mmap)
+ 5fb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <munmap>:
+SYSCALL(munmap)
+ 603:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <shmget>:
+SYSCALL(shmget)
+ 60b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <shmat>:
+SYSCALL(shmat)
+ 613:	b8 30 00 00 00       	mov    $0x30,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <shmdt>:
+SYSCALL(shmdt)
+ 61b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <shmrm>:
+SYSCALL(shmrm)
+ 623:	b8 32 00 00 00       	mov    $0x32,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <_spawn>:
+RAWSYSCALL(spawn)
+ 62b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <memstat>:
+SYSCALL(memstat)
+ 633:	b8 34 00 00 00       	mov    $0x34,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 646:	a1 48 19 00 00       	mov    0x1948,%eax
+ 64b:	85 c0                	test   %eax,%eax
+ 64d:	7e 17                	jle    666 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 64f:	83 ec 04             	sub    $0x4,%esp
+ 652:	50                   	push   %eax
+ 653:	68 4c 19 00 00       	push   $0x194c
+ 658:	ff 35 40 19 00 00    	push   0x1940
+ 65e:	e8 60 fe ff ff       	call   4c3 <write>
+ 663:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 666:	c7 05 48 19 00 00 00 	movl   $0x0,0x1948
+ 66d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 670:	c7 05 44 19 00 00 00 	movl   $0x0,0x1944
+ 677:	00 00 00 
+}
+ 67a:	c9                   	leave
+ 67b:	c3                   	ret
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 686:	89 d1                	mov    %edx,%ecx
+{
+ 688:	56                   	push   %esi
+ 689:	53                   	push   %ebx
+ 68a:	89 c3                	mov    %eax,%ebx
+ 68c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 68f:	85 d2                	test   %edx,%edx
+ 691:	0f 89 b9 00 00 00    	jns    750 <printint+0xd0>
+ 697:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 69b:	0f 84 af 00 00 00    	je     750 <printint+0xd0>
+    x = -xx;
+ 6a1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6a8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6ab:	31 f6                	xor    %esi,%esi
+ 6ad:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6b0:	89 c8                	mov    %ecx,%eax
+ 6b2:	31 d2                	xor    %edx,%edx
+ 6b4:	89 f3                	mov    %esi,%ebx
+ 6b6:	f7 f7                	div    %edi
+ 6b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6bb:	0f b6 92 a8 10 00 00 	movzbl 0x10a8(%edx),%edx
+ 6c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6c6:	89 ca                	mov    %ecx,%edx
+ 6c8:	89 c1                	mov    %eax,%ecx
+ 6ca:	39 fa                	cmp    %edi,%edx
+ 6cc:	73 e2                	jae    6b0 <printint+0x30>
+  if(neg)
+ 6ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 6d1:	89 d9                	mov    %ebx,%ecx
+ 6d3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d6:	85 c0                	test   %eax,%eax
+ 6d8:	74 07                	je     6e1 <printint+0x61>
+    buf[i++] = '-';
+ 6da:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6df:	89 f1                	mov    %esi,%ecx
+ 6e1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 6e4:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 6e6:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 6e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6ec:	01 f7                	add    %esi,%edi
+ 6ee:	eb 09                	jmp    6f9 <printint+0x79>
+
+  while(--i >= 0)
+ 6f0:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 6f3:	39 f7                	cmp    %esi,%edi
+ 6f5:	74 36                	je     72d <printint+0xad>
+ 6f7:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 6f9:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 6fc:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 6ff:	8d 42 01             	lea    0x1(%edx),%eax
+ 702:	89 43 08             	mov    %eax,0x8(%ebx)
+ 705:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 709:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 70e:	74 28                	je     738 <printint+0xb8>
+ 710:	80 f9 0a             	cmp    $0xa,%cl
+ 713:	75 db                	jne    6f0 <printint+0x70>
+ 715:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 719:	75 d5                	jne    6f0 <printint+0x70>
+  if(b->n > 0)
+ 71b:	85 c0                	test   %eax,%eax
+ 71d:	7f 19                	jg     738 <printint+0xb8>
+  b->n = 0;
+ 71f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 726:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 729:	39 f7                	cmp    %esi,%edi
+ 72b:	75 ca                	jne    6f7 <printint+0x77>
+}
+ 72d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 730:	5b                   	pop    %ebx
+ 731:	5e                   	pop    %esi
+ 732:	5f                   	pop    %edi
+ 733:	5d                   	pop    %ebp
+ 734:	c3                   	ret
+ 735:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 738:	83 ec 04             	sub    $0x4,%esp
+ 73b:	50                   	push   %eax
+ 73c:	ff 75 d4             	push   -0x2c(%ebp)
+ 73f:	ff 33                	push   (%ebx)
+ 741:	e8 7d fd ff ff       	call   4c3 <write>
+ 746:	83 c4 10             	add    $0x10,%esp
+ 749:	eb d4                	jmp    71f <printint+0x9f>
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  neg = 0;
+ 750:	31 c0                	xor    %eax,%eax
+ 752:	e9 51 ff ff ff       	jmp    6a8 <printint+0x28>
+ 757:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75e:	66 90                	xchg   %ax,%ax
+
+00000760 <putc>:
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	53                   	push   %ebx
+ 764:	89 c3                	mov    %eax,%ebx
+ 766:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 769:	8b 48 08             	mov    0x8(%eax),%ecx
+ 76c:	8d 41 01             	lea    0x1(%ecx),%eax
+ 76f:	89 43 08             	mov    %eax,0x8(%ebx)
+ 772:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 776:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 77b:	74 33                	je     7b0 <putc+0x50>
+ 77d:	80 fa 0a             	cmp    $0xa,%dl
+ 780:	74 0e                	je     790 <putc+0x30>
+}
+ 782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 785:	c9                   	leave
+ 786:	c3                   	ret
+ 787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 790:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 794:	75 ec                	jne    782 <putc+0x22>
+  if(b->n > 0)
+ 796:	85 c0                	test   %eax,%eax
+ 798:	7f 16                	jg     7b0 <putc+0x50>
+  b->n = 0;
+ 79a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 7a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a4:	c9                   	leave
+ 7a5:	c3                   	ret
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	50                   	push   %eax
+ 7b4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7b7:	50                   	push   %eax
+ 7b8:	ff 33                	push   (%ebx)
+ 7ba:	e8 04 fd ff ff       	call   4c3 <write>
+ 7bf:	83 c4 10             	add    $0x10,%esp
+ 7c2:	eb d6                	jmp    79a <putc+0x3a>
+ 7c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+
+000007d0 <fflush>:
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 7d6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 7da:	74 04                	je     7e0 <fflush+0x10>
+}
+ 7dc:	c9                   	leave
+ 7dd:	c3                   	ret
+ 7de:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 7e0:	a1 48 19 00 00       	mov    0x1948,%eax
+ 7e5:	85 c0                	test   %eax,%eax
+ 7e7:	7f 17                	jg     800 <fflush+0x30>
+  b->n = 0;
+ 7e9:	c7 05 48 19 00 00 00 	movl   $0x0,0x1948
+ 7f0:	00 00 00 
+  out.mode = 0;
+ 7f3:	c7 05 44 19 00 00 00 	movl   $0x0,0x1944
+ 7fa:	00 00 00 
+}
+ 7fd:	c9                   	leave
+ 7fe:	c3                   	ret
+ 7ff:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	50                   	push   %eax
+ 804:	68 4c 19 00 00       	push   $0x194c
+ 809:	ff 35 40 19 00 00    	push   0x1940
+ 80f:	e8 af fc ff ff       	call   4c3 <write>
+ 814:	83 c4 10             	add    $0x10,%esp
+ 817:	eb d0                	jmp    7e9 <fflush+0x19>
+ 819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 3c             	sub    $0x3c,%esp
+ 829:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 82c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 82f:	83 fe 01             	cmp    $0x1,%esi
+ 832:	0f 84 60 01 00 00    	je     998 <printf+0x178>
+    b->fd = fd;
+ 838:	89 35 20 17 00 00    	mov    %esi,0x1720
+  for(i = 0; fmt[i]; i++){
+ 83e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 841:	bf 20 17 00 00       	mov    $0x1720,%edi
+  for(i = 0; fmt[i]; i++){
+ 846:	84 c0                	test   %al,%al
+ 848:	74 65                	je     8af <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 84a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 84d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 850:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 852:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 855:	eb 1f                	jmp    876 <printf+0x56>
+ 857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 3b                	je     8a0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 865:	89 f8                	mov    %edi,%eax
+ 867:	e8 f4 fe ff ff       	call   760 <putc>
+  for(i = 0; fmt[i]; i++){
+ 86c:	0f b6 03             	movzbl (%ebx),%eax
+ 86f:	83 c3 01             	add    $0x1,%ebx
+ 872:	84 c0                	test   %al,%al
+ 874:	74 39                	je     8af <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 876:	0f be d0             	movsbl %al,%edx
+ 879:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 87c:	85 f6                	test   %esi,%esi
+ 87e:	74 e0                	je     860 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 880:	83 fe 25             	cmp    $0x25,%esi
+ 883:	75 e7                	jne    86c <printf+0x4c>
+      if(c == 'd'){
+ 885:	83 f8 25             	cmp    $0x25,%eax
+ 888:	74 57                	je     8e1 <printf+0xc1>
+ 88a:	83 e8 63             	sub    $0x63,%eax
+ 88d:	83 f8 15             	cmp    $0x15,%eax
+ 890:	77 36                	ja     8c8 <printf+0xa8>
+ 892:	ff 24 85 50 10 00 00 	jmp    *0x1050(,%eax,4)
+ 899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 8a0:	0f b6 03             	movzbl (%ebx),%eax
+ 8a3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8a6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8ab:	84 c0                	test   %al,%al
+ 8ad:	75 c7                	jne    876 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 8af:	8b 47 04             	mov    0x4(%edi),%eax
+ 8b2:	85 c0                	test   %eax,%eax
+ 8b4:	0f 84 06 01 00 00    	je     9c0 <printf+0x1a0>
+    bflush(b);
+}
+ 8ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8bd:	5b                   	pop    %ebx
+ 8be:	5e                   	pop    %esi
+ 8bf:	5f                   	pop    %edi
+ 8c0:	5d                   	pop    %ebp
+ 8c1:	c3                   	ret
+ 8c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 8c8:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 8cb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8ce:	89 47 08             	mov    %eax,0x8(%edi)
+ 8d1:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 8d6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8db:	0f 84 77 01 00 00    	je     a58 <printf+0x238>
+        putc(b, c);
+ 8e1:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 8e3:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 8e5:	e8 76 fe ff ff       	call   760 <putc>
+ 8ea:	eb 80                	jmp    86c <printf+0x4c>
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 8f0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8fb:	8b 16                	mov    (%esi),%edx
+ 8fd:	6a 00                	push   $0x0
+        ap++;
+ 8ff:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 902:	89 f8                	mov    %edi,%eax
+ 904:	e8 77 fd ff ff       	call   680 <printint>
+        ap++;
+ 909:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 90c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90f:	31 f6                	xor    %esi,%esi
+ 911:	e9 56 ff ff ff       	jmp    86c <printf+0x4c>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 920:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 923:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 925:	83 c0 04             	add    $0x4,%eax
+ 928:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 92b:	85 c9                	test   %ecx,%ecx
+ 92d:	0f 84 cd 00 00 00    	je     a00 <printf+0x1e0>
+        while(*s != 0){
+ 933:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 936:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 938:	84 d2                	test   %dl,%dl
+ 93a:	0f 84 2c ff ff ff    	je     86c <printf+0x4c>
+          putc(b, *s);
+ 940:	89 f8                	mov    %edi,%eax
+ 942:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 945:	e8 16 fe ff ff       	call   760 <putc>
+          s++;
+ 94a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 94d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 951:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 954:	84 d2                	test   %dl,%dl
+ 956:	75 e8                	jne    940 <printf+0x120>
+      state = 0;
+ 958:	31 f6                	xor    %esi,%esi
+ 95a:	e9 0d ff ff ff       	jmp    86c <printf+0x4c>
+ 95f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 960:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 96b:	8b 16                	mov    (%esi),%edx
+ 96d:	6a 01                	push   $0x1
+ 96f:	eb 8e                	jmp    8ff <printf+0xdf>
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 978:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 97b:	89 f8                	mov    %edi,%eax
+ 97d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 980:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 983:	e8 d8 fd ff ff       	call   760 <putc>
+        ap++;
+ 988:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 98b:	31 f6                	xor    %esi,%esi
+ 98d:	e9 da fe ff ff       	jmp    86c <printf+0x4c>
+ 992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 998:	8b 15 44 19 00 00    	mov    0x1944,%edx
+ 99e:	85 d2                	test   %edx,%edx
+ 9a0:	74 6e                	je     a10 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 9a2:	0f b6 03             	movzbl (%ebx),%eax
+ 9a5:	bf 40 19 00 00       	mov    $0x1940,%edi
+ 9aa:	84 c0                	test   %al,%al
+ 9ac:	0f 85 98 fe ff ff    	jne    84a <printf+0x2a>
+ 9b2:	e9 03 ff ff ff       	jmp    8ba <printf+0x9a>
+ 9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9be:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 9c0:	8b 47 08             	mov    0x8(%edi),%eax
+ 9c3:	85 c0                	test   %eax,%eax
+ 9c5:	7f 19                	jg     9e0 <printf+0x1c0>
+  b->n = 0;
+ 9c7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d1:	5b                   	pop    %ebx
+ 9d2:	5e                   	pop    %esi
+ 9d3:	5f                   	pop    %edi
+ 9d4:	5d                   	pop    %ebp
+ 9d5:	c3                   	ret
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	50                   	push   %eax
+ 9e4:	8d 47 0c             	lea    0xc(%edi),%eax
+ 9e7:	50                   	push   %eax
+ 9e8:	ff 37                	push   (%edi)
+ 9ea:	e8 d4 fa ff ff       	call   4c3 <write>
+  b->n = 0;
+ 9ef:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ 9f6:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 9f9:	eb d3                	jmp    9ce <printf+0x1ae>
+ 9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+ a00:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a05:	b9 47 10 00 00       	mov    $0x1047,%ecx
+ a0a:	e9 31 ff ff ff       	jmp    940 <printf+0x120>
+ a0f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a10:	83 ec 08             	sub    $0x8,%esp
+ a13:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ a16:	c7 05 40 19 00 00 01 	movl   $0x1,0x1940
+ a1d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a20:	50                   	push   %eax
+ a21:	6a 01                	push   $0x1
+ a23:	e8 d3 fa ff ff       	call   4fb <fstat>
+ a28:	83 c4 10             	add    $0x10,%esp
+ a2b:	85 c0                	test   %eax,%eax
+ a2d:	75 22                	jne    a51 <printf+0x231>
+ a2f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ a34:	b8 02 00 00 00       	mov    $0x2,%eax
+ a39:	0f 45 f0             	cmovne %eax,%esi
+ a3c:	89 35 44 19 00 00    	mov    %esi,0x1944
+      stdioflush = flushout;
+ a42:	c7 05 e0 14 00 00 40 	movl   $0x640,0x14e0
+ a49:	06 00 00 
+ a4c:	e9 51 ff ff ff       	jmp    9a2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a51:	be 02 00 00 00       	mov    $0x2,%esi
+ a56:	eb e4                	jmp    a3c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ a58:	83 ec 04             	sub    $0x4,%esp
+ a5b:	8d 47 0c             	lea    0xc(%edi),%eax
+ a5e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ a61:	68 00 02 00 00       	push   $0x200
+ a66:	50                   	push   %eax
+ a67:	ff 37                	push   (%edi)
+ a69:	e8 55 fa ff ff       	call   4c3 <write>
+  b->n = 0;
+ a6e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ a75:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ a78:	83 c4 10             	add    $0x10,%esp
+ a7b:	e9 61 fe ff ff       	jmp    8e1 <printf+0xc1>
+
+00000a80 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	56                   	push   %esi
+ a84:	53                   	push   %ebx
+ a85:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ a87:	a1 60 1b 00 00       	mov    0x1b60,%eax
+ a8c:	39 d8                	cmp    %ebx,%eax
+ a8e:	0f 83 e4 00 00 00    	jae    b78 <freepages+0xf8>
+ a94:	85 c0                	test   %eax,%eax
+ a96:	0f 84 dc 00 00 00    	je     b78 <freepages+0xf8>
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aa0:	89 c2                	mov    %eax,%edx
+ aa2:	8b 00                	mov    (%eax),%eax
+ aa4:	85 c0                	test   %eax,%eax
+ aa6:	74 04                	je     aac <freepages+0x2c>
+ aa8:	39 d8                	cmp    %ebx,%eax
+ aaa:	72 f4                	jb     aa0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ aac:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ aaf:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ ab1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ ab3:	85 c0                	test   %eax,%eax
+ ab5:	74 15                	je     acc <freepages+0x4c>
+    p->prev = s;
+ ab7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ aba:	8b 73 10             	mov    0x10(%ebx),%esi
+ abd:	89 f1                	mov    %esi,%ecx
+ abf:	c1 e1 0c             	shl    $0xc,%ecx
+ ac2:	01 d9                	add    %ebx,%ecx
+ ac4:	39 c8                	cmp    %ecx,%eax
+ ac6:	0f 84 d8 00 00 00    	je     ba4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ acc:	8b 4a 10             	mov    0x10(%edx),%ecx
+ acf:	89 c8                	mov    %ecx,%eax
+ ad1:	c1 e0 0c             	shl    $0xc,%eax
+ ad4:	01 d0                	add    %edx,%eax
+ ad6:	39 c3                	cmp    %eax,%ebx
+ ad8:	74 16                	je     af0 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ ada:	8b 03                	mov    (%ebx),%eax
+ adc:	85 c0                	test   %eax,%eax
+ ade:	74 40                	je     b20 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ ae0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ae3:	5b                   	pop    %ebx
+ ae4:	5e                   	pop    %esi
+ ae5:	5d                   	pop    %ebp
+ ae6:	c3                   	ret
+ ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aee:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ af0:	03 4b 10             	add    0x10(%ebx),%ecx
+ af3:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ af6:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ af9:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ afb:	85 c9                	test   %ecx,%ecx
+ afd:	0f 84 dd 00 00 00    	je     be0 <freepages+0x160>
+    s->prev->next = s->next;
+ b03:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ b05:	85 c0                	test   %eax,%eax
+ b07:	74 06                	je     b0f <freepages+0x8f>
+    s->next->prev = s->prev;
+ b09:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ b0c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ b0f:	8b 02                	mov    (%edx),%eax
+ b11:	89 d3                	mov    %edx,%ebx
+ b13:	85 c0                	test   %eax,%eax
+ b15:	75 c9                	jne    ae0 <freepages+0x60>
+ b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1e:	66 90                	xchg   %ax,%ax
+ b20:	8b 43 10             	mov    0x10(%ebx),%eax
+ b23:	83 f8 0f             	cmp    $0xf,%eax
+ b26:	76 b8                	jbe    ae0 <freepages+0x60>
+ b28:	83 ec 0c             	sub    $0xc,%esp
+ b2b:	c1 e0 0c             	shl    $0xc,%eax
+ b2e:	6a 00                	push   $0x0
+ b30:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ b33:	e8 f3 f9 ff ff       	call   52b <sbrk>
+ b38:	83 c4 10             	add    $0x10,%esp
+ b3b:	39 c6                	cmp    %eax,%esi
+ b3d:	75 a1                	jne    ae0 <freepages+0x60>
+  if(s->prev)
+ b3f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ b42:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ b44:	85 d2                	test   %edx,%edx
+ b46:	0f 84 a5 00 00 00    	je     bf1 <freepages+0x171>
+    s->prev->next = s->next;
+ b4c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ b4e:	85 c0                	test   %eax,%eax
+ b50:	74 06                	je     b58 <freepages+0xd8>
+    s->next->prev = s->prev;
+ b52:	8b 53 04             	mov    0x4(%ebx),%edx
+ b55:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ b58:	8b 43 10             	mov    0x10(%ebx),%eax
+ b5b:	83 ec 0c             	sub    $0xc,%esp
+ b5e:	c1 e0 0c             	shl    $0xc,%eax
+ b61:	f7 d8                	neg    %eax
+ b63:	50                   	push   %eax
+ b64:	e8 c2 f9 ff ff       	call   52b <sbrk>
+ b69:	83 c4 10             	add    $0x10,%esp
+}
+ b6c:	e9 6f ff ff ff       	jmp    ae0 <freepages+0x60>
+ b71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ b78:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ b7f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ b81:	89 1d 60 1b 00 00    	mov    %ebx,0x1b60
+  if(p)
+ b87:	85 c0                	test   %eax,%eax
+ b89:	74 95                	je     b20 <freepages+0xa0>
+    p->prev = s;
+ b8b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ b8e:	8b 73 10             	mov    0x10(%ebx),%esi
+ b91:	89 f2                	mov    %esi,%edx
+ b93:	c1 e2 0c             	shl    $0xc,%edx
+ b96:	01 da                	add    %ebx,%edx
+ b98:	39 d0                	cmp    %edx,%eax
+ b9a:	0f 85 3a ff ff ff    	jne    ada <freepages+0x5a>
+ ba0:	89 c1                	mov    %eax,%ecx
+ ba2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ ba4:	8b 41 10             	mov    0x10(%ecx),%eax
+ ba7:	01 f0                	add    %esi,%eax
+ ba9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ bac:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ baf:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ bb1:	85 f6                	test   %esi,%esi
+ bb3:	74 35                	je     bea <freepages+0x16a>
+    s->prev->next = s->next;
+ bb5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ bb7:	85 c0                	test   %eax,%eax
+ bb9:	74 06                	je     bc1 <freepages+0x141>
+    s->next->prev = s->prev;
+ bbb:	8b 49 04             	mov    0x4(%ecx),%ecx
+ bbe:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ bc1:	85 d2                	test   %edx,%edx
+ bc3:	0f 84 11 ff ff ff    	je     ada <freepages+0x5a>
+ bc9:	8b 4a 10             	mov    0x10(%edx),%ecx
+ bcc:	89 c8                	mov    %ecx,%eax
+ bce:	c1 e0 0c             	shl    $0xc,%eax
+ bd1:	01 d0                	add    %edx,%eax
+ bd3:	39 c3                	cmp    %eax,%ebx
+ bd5:	0f 85 ff fe ff ff    	jne    ada <freepages+0x5a>
+ bdb:	e9 10 ff ff ff       	jmp    af0 <freepages+0x70>
+    *l = s->next;
+ be0:	a3 60 1b 00 00       	mov    %eax,0x1b60
+ be5:	e9 1b ff ff ff       	jmp    b05 <freepages+0x85>
+ bea:	a3 60 1b 00 00       	mov    %eax,0x1b60
+ bef:	eb c6                	jmp    bb7 <freepages+0x137>
+ bf1:	a3 60 1b 00 00       	mov    %eax,0x1b60
+ bf6:	e9 53 ff ff ff       	jmp    b4e <freepages+0xce>
+ bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bff:	90                   	nop
+
+00000c00 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	56                   	push   %esi
+ c04:	53                   	push   %ebx
+ c05:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ c07:	a1 60 1b 00 00       	mov    0x1b60,%eax
+ c0c:	85 c0                	test   %eax,%eax
+ c0e:	74 5e                	je     c6e <getpages+0x6e>
+    if(s->npages < n)
+ c10:	8b 50 10             	mov    0x10(%eax),%edx
+ c13:	39 da                	cmp    %ebx,%edx
+ c15:	72 51                	jb     c68 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ c17:	39 d3                	cmp    %edx,%ebx
+ c19:	72 25                	jb     c40 <getpages+0x40>
+  if(s->prev)
+ c1b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ c1e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ c20:	85 c9                	test   %ecx,%ecx
+ c22:	0f 84 a8 00 00 00    	je     cd0 <getpages+0xd0>
+    s->prev->next = s->next;
+ c28:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ c2a:	85 d2                	test   %edx,%edx
+ c2c:	74 06                	je     c34 <getpages+0x34>
+    s->next->prev = s->prev;
+ c2e:	8b 48 04             	mov    0x4(%eax),%ecx
+ c31:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ c34:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ c37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c3a:	5b                   	pop    %ebx
+ c3b:	5e                   	pop    %esi
+ c3c:	5d                   	pop    %ebp
+ c3d:	c3                   	ret
+ c3e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c40:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ c42:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c44:	c1 e1 0c             	shl    $0xc,%ecx
+ c47:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ c49:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ c4c:	8b 70 04             	mov    0x4(%eax),%esi
+ c4f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ c52:	8b 10                	mov    (%eax),%edx
+ c54:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ c56:	85 f6                	test   %esi,%esi
+ c58:	74 66                	je     cc0 <getpages+0xc0>
+        rest->prev->next = rest;
+ c5a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ c5c:	8b 11                	mov    (%ecx),%edx
+ c5e:	85 d2                	test   %edx,%edx
+ c60:	75 cf                	jne    c31 <getpages+0x31>
+ c62:	eb d0                	jmp    c34 <getpages+0x34>
+ c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	85 c0                	test   %eax,%eax
+ c6c:	75 a2                	jne    c10 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ c6e:	83 ec 0c             	sub    $0xc,%esp
+ c71:	6a 00                	push   $0x0
+ c73:	e8 b3 f8 ff ff       	call   52b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c78:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c7b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ c81:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c83:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ c89:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c8f:	29 d0                	sub    %edx,%eax
+ c91:	c1 e8 0c             	shr    $0xc,%eax
+ c94:	39 d8                	cmp    %ebx,%eax
+ c96:	72 48                	jb     ce0 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ c98:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c9a:	89 d8                	mov    %ebx,%eax
+ c9c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c9f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ ca1:	c1 e0 0c             	shl    $0xc,%eax
+ ca4:	01 f0                	add    %esi,%eax
+ ca6:	50                   	push   %eax
+ ca7:	e8 7f f8 ff ff       	call   52b <sbrk>
+ cac:	83 c4 10             	add    $0x10,%esp
+ caf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cb2:	74 2c                	je     ce0 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ cb4:	01 f0                	add    %esi,%eax
+ cb6:	e9 79 ff ff ff       	jmp    c34 <getpages+0x34>
+ cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+        runs = rest;
+ cc0:	89 0d 60 1b 00 00    	mov    %ecx,0x1b60
+ cc6:	eb 96                	jmp    c5e <getpages+0x5e>
+ cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+    *l = s->next;
+ cd0:	89 15 60 1b 00 00    	mov    %edx,0x1b60
+ cd6:	e9 4f ff ff ff       	jmp    c2a <getpages+0x2a>
+ cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+    return 0;
+ ce0:	31 c0                	xor    %eax,%eax
+ ce2:	e9 50 ff ff ff       	jmp    c37 <getpages+0x37>
+ ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	57                   	push   %edi
+ cf4:	56                   	push   %esi
+ cf5:	53                   	push   %ebx
+ cf6:	83 ec 1c             	sub    $0x1c,%esp
+ cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ cfc:	85 c0                	test   %eax,%eax
+ cfe:	0f 84 97 00 00 00    	je     d9b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ d04:	89 c3                	mov    %eax,%ebx
+ d06:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ d0c:	8b 73 14             	mov    0x14(%ebx),%esi
+ d0f:	83 fe 01             	cmp    $0x1,%esi
+ d12:	74 74                	je     d88 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ d14:	85 f6                	test   %esi,%esi
+ d16:	74 5d                	je     d75 <free+0x85>
+  if(s->free == 0)
+ d18:	8b 53 08             	mov    0x8(%ebx),%edx
+ d1b:	85 d2                	test   %edx,%edx
+ d1d:	0f 84 85 00 00 00    	je     da8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ d23:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ d25:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ d28:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d2b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ d2e:	8b 04 f5 84 1b 00 00 	mov    0x1b84(,%esi,8),%eax
+  s->inuse--;
+ d35:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ d38:	83 c0 01             	add    $0x1,%eax
+ d3b:	89 04 f5 84 1b 00 00 	mov    %eax,0x1b84(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d42:	85 d2                	test   %edx,%edx
+ d44:	75 55                	jne    d9b <free+0xab>
+ d46:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ d4b:	89 f1                	mov    %esi,%ecx
+ d4d:	d3 ea                	shr    %cl,%edx
+ d4f:	39 c2                	cmp    %eax,%edx
+ d51:	73 7d                	jae    dd0 <free+0xe0>
+  if(s->prev)
+ d53:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ d56:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ d58:	85 ff                	test   %edi,%edi
+ d5a:	0f 84 a0 00 00 00    	je     e00 <free+0x110>
+    s->prev->next = s->next;
+ d60:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ d62:	85 c9                	test   %ecx,%ecx
+ d64:	74 06                	je     d6c <free+0x7c>
+    s->next->prev = s->prev;
+ d66:	8b 7b 04             	mov    0x4(%ebx),%edi
+ d69:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ d6c:	29 d0                	sub    %edx,%eax
+ d6e:	89 04 f5 84 1b 00 00 	mov    %eax,0x1b84(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ d75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ d78:	89 d8                	mov    %ebx,%eax
+}
+ d7a:	5b                   	pop    %ebx
+ d7b:	5e                   	pop    %esi
+ d7c:	5f                   	pop    %edi
+ d7d:	5d                   	pop    %ebp
+    freepages(s);
+ d7e:	e9 fd fc ff ff       	jmp    a80 <freepages>
+ d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d87:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ d88:	8b 43 10             	mov    0x10(%ebx),%eax
+ d8b:	83 ec 08             	sub    $0x8,%esp
+ d8e:	c1 e0 0c             	shl    $0xc,%eax
+ d91:	50                   	push   %eax
+ d92:	53                   	push   %ebx
+ d93:	e8 6b f8 ff ff       	call   603 <munmap>
+ d98:	83 c4 10             	add    $0x10,%esp
+}
+ d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d9e:	5b                   	pop    %ebx
+ d9f:	5e                   	pop    %esi
+ da0:	5f                   	pop    %edi
+ da1:	5d                   	pop    %ebp
+ da2:	c3                   	ret
+ da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ da7:	90                   	nop
+  s->next = *l;
+ da8:	8b 14 f5 80 1b 00 00 	mov    0x1b80(,%esi,8),%edx
+  s->prev = 0;
+ daf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ db6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ db8:	85 d2                	test   %edx,%edx
+ dba:	74 06                	je     dc2 <free+0xd2>
+    (*l)->prev = s;
+ dbc:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ dbf:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ dc2:	89 1c f5 80 1b 00 00 	mov    %ebx,0x1b80(,%esi,8)
+}
+ dc9:	e9 55 ff ff ff       	jmp    d23 <free+0x33>
+ dce:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ dd0:	83 ec 0c             	sub    $0xc,%esp
+ dd3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ dd6:	8b 7b 10             	mov    0x10(%ebx),%edi
+ dd9:	6a 00                	push   $0x0
+ ddb:	c1 e7 0c             	shl    $0xc,%edi
+ dde:	01 df                	add    %ebx,%edi
+ de0:	e8 46 f7 ff ff       	call   52b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ de5:	83 c4 10             	add    $0x10,%esp
+ de8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ deb:	39 c7                	cmp    %eax,%edi
+ ded:	75 ac                	jne    d9b <free+0xab>
+ def:	8b 04 f5 84 1b 00 00 	mov    0x1b84(,%esi,8),%eax
+ df6:	e9 58 ff ff ff       	jmp    d53 <free+0x63>
+ dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+    *l = s->next;
+ e00:	89 0c f5 80 1b 00 00 	mov    %ecx,0x1b80(,%esi,8)
+ e07:	e9 56 ff ff ff       	jmp    d62 <free+0x72>
+ e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e10:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e11:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ e16:	89 e5                	mov    %esp,%ebp
+ e18:	57                   	push   %edi
+ e19:	56                   	push   %esi
+ e1a:	53                   	push   %ebx
+ e1b:	83 ec 1c             	sub    $0x1c,%esp
+ e1e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ e21:	83 f8 10             	cmp    $0x10,%eax
+ e24:	0f 86 92 00 00 00    	jbe    ebc <malloc+0xac>
+ e2a:	ba 01 00 00 00       	mov    $0x1,%edx
+ e2f:	eb 13                	jmp    e44 <malloc+0x34>
+ e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e38:	89 d3                	mov    %edx,%ebx
+ e3a:	d3 e3                	shl    %cl,%ebx
+ e3c:	39 c3                	cmp    %eax,%ebx
+ e3e:	0f 83 84 00 00 00    	jae    ec8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e44:	83 c1 01             	add    $0x1,%ecx
+ e47:	83 f9 0b             	cmp    $0xb,%ecx
+ e4a:	75 ec                	jne    e38 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ e4c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ e51:	0f 87 c9 00 00 00    	ja     f20 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ e57:	05 17 10 00 00       	add    $0x1017,%eax
+ e5c:	89 c3                	mov    %eax,%ebx
+ e5e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ e61:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ e66:	77 28                	ja     e90 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ e68:	89 d8                	mov    %ebx,%eax
+ e6a:	e8 91 fd ff ff       	call   c00 <getpages>
+ e6f:	85 c0                	test   %eax,%eax
+ e71:	0f 84 a9 00 00 00    	je     f20 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ e77:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ e7e:	83 c0 18             	add    $0x18,%eax
+}
+ e81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e84:	5b                   	pop    %ebx
+ e85:	5e                   	pop    %esi
+ e86:	5f                   	pop    %edi
+ e87:	5d                   	pop    %ebp
+ e88:	c3                   	ret
+ e89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ e90:	89 d8                	mov    %ebx,%eax
+ e92:	83 ec 08             	sub    $0x8,%esp
+ e95:	c1 e0 0c             	shl    $0xc,%eax
+ e98:	6a 00                	push   $0x0
+ e9a:	6a ff                	push   $0xffffffff
+ e9c:	6a 22                	push   $0x22
+ e9e:	6a 03                	push   $0x3
+ ea0:	50                   	push   %eax
+ ea1:	6a 00                	push   $0x0
+ ea3:	e8 53 f7 ff ff       	call   5fb <mmap>
+    if(s == MAP_FAILED)
+ ea8:	83 c4 20             	add    $0x20,%esp
+ eab:	83 f8 ff             	cmp    $0xffffffff,%eax
+ eae:	74 b8                	je     e68 <malloc+0x58>
+      s->shift = MAPRUN;
+ eb0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ eb7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ eba:	eb c2                	jmp    e7e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ ebc:	bb 10 00 00 00       	mov    $0x10,%ebx
+ ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ ec8:	8b 34 cd 80 1b 00 00 	mov    0x1b80(,%ecx,8),%esi
+ ecf:	85 f6                	test   %esi,%esi
+ ed1:	74 57                	je     f2a <malloc+0x11a>
+  classes[shift].nfree--;
+ ed3:	8b 1c cd 84 1b 00 00 	mov    0x1b84(,%ecx,8),%ebx
+  o = s->free;
+ eda:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ edd:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ ee0:	89 14 cd 84 1b 00 00 	mov    %edx,0x1b84(,%ecx,8)
+  s->free = NEXTFREE(o);
+ ee7:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ ee9:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ eed:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ ef0:	85 ff                	test   %edi,%edi
+ ef2:	75 8d                	jne    e81 <malloc+0x71>
+  if(s->prev)
+ ef4:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ ef7:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ ef9:	85 db                	test   %ebx,%ebx
+ efb:	0f 84 b7 00 00 00    	je     fb8 <malloc+0x1a8>
+    s->prev->next = s->next;
+ f01:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ f03:	85 d2                	test   %edx,%edx
+ f05:	0f 84 76 ff ff ff    	je     e81 <malloc+0x71>
+    s->next->prev = s->prev;
+ f0b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ f0e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ f11:	e9 6b ff ff ff       	jmp    e81 <malloc+0x71>
+ f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f1d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ f20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ f23:	31 c0                	xor    %eax,%eax
+}
+ f25:	5b                   	pop    %ebx
+ f26:	5e                   	pop    %esi
+ f27:	5f                   	pop    %edi
+ f28:	5d                   	pop    %ebp
+ f29:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ f2a:	b8 01 00 00 00       	mov    $0x1,%eax
+ f2f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ f32:	e8 c9 fc ff ff       	call   c00 <getpages>
+ f37:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ f3a:	85 c0                	test   %eax,%eax
+ f3c:	89 c2                	mov    %eax,%edx
+ f3e:	74 e0                	je     f20 <malloc+0x110>
+    s->shift = shift;
+ f40:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f43:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ f45:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ f4c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f51:	89 df                	mov    %ebx,%edi
+ f53:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ f55:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ f57:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ f5a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f5d:	83 e8 01             	sub    $0x1,%eax
+ f60:	d3 e0                	shl    %cl,%eax
+ f62:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ f65:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f69:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ f6c:	eb 04                	jmp    f72 <malloc+0x162>
+ f6e:	66 90                	xchg   %ax,%ax
+ f70:	89 c8                	mov    %ecx,%eax
+ f72:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ f75:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f77:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ f7a:	89 c6                	mov    %eax,%esi
+ f7c:	39 da                	cmp    %ebx,%edx
+ f7e:	7f f0                	jg     f70 <malloc+0x160>
+ f80:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ f83:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ f86:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ f89:	8b 04 cd 80 1b 00 00 	mov    0x1b80(,%ecx,8),%eax
+  s->prev = 0;
+ f90:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ f97:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ f99:	85 c0                	test   %eax,%eax
+ f9b:	74 03                	je     fa0 <malloc+0x190>
+    (*l)->prev = s;
+ f9d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ fa0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ fa3:	89 14 cd 80 1b 00 00 	mov    %edx,0x1b80(,%ecx,8)
+    classes[shift].nfree += n;
+ faa:	89 d6                	mov    %edx,%esi
+ fac:	03 1c cd 84 1b 00 00 	add    0x1b84(,%ecx,8),%ebx
+ fb3:	e9 22 ff ff ff       	jmp    eda <malloc+0xca>
+    *l = s->next;
+ fb8:	89 14 cd 80 1b 00 00 	mov    %edx,0x1b80(,%ecx,8)
+ fbf:	e9 3f ff ff ff       	jmp    f03 <malloc+0xf3>
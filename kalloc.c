@@ -1,6 +1,8 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and physically
+// contiguous blocks of 2^order pages from a buddy allocator
+// underneath the per-CPU page caches.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +10,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,14 +18,65 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;  // only on buddy free lists
 };
 
+// Buddy allocator: free[k] lists the free blocks of 2^k pages,
+// each aligned to its size in physical memory. The buddy of
+// the block at frame f is the one at f ^ (1<<k); freeing a
+// block merges it with its buddy whenever that is free too.
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *free[MAXORDER+1];
+  int nblocks[MAXORDER+1];  // blocks on free[k]
+  int nfree;      // pages in free blocks
+  int npages;     // pages given to the allocator at boot
 } kmem;
 
+// For the first frame of each free buddy block, its order
+// with BFREE set; 0 for all other frames.
+#define BFREE 0x80
+static uchar frameorder[MAXPHYS/PGSIZE];
+
+// Per-CPU magazines of free pages. kalloc() and kfree() work on
+// the local magazine, which other CPUs only touch to steal pages
+// when their own magazine and the buddy allocator are both empty,
+// and exchange KMAGBATCH pages at a time with the buddy allocator.
+struct kmag {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} kmags[NCPU];
+
+// Pages zeroed ahead of time by kzerofill() while a CPU is idle,
+// handed out by kalloc_zeroed().
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} kzero;
+
+// Number of page tables mapping each physical page, so that
+// copy-on-write fork can share pages between processes.
+// kalloc() sets it to 1 and kfree() only frees at zero.
+ushort pageref[MAXPHYS/PGSIZE];
+
+// Top of the physical memory the allocator manages: what
+// the BIOS reports, at most MAXPHYS, in whole 4 MB blocks.
+uint physstop;
+
+static void
+detectmem(void)
+{
+  physstop = cmosmemtop();
+  if(physstop < 16*1024*1024)
+    physstop = PHYSTOP;  // no believable answer
+  if(physstop > MAXPHYS)
+    physstop = MAXPHYS;
+  physstop &= ~((PGSIZE << MAXORDER) - 1);
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,7 +85,13 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  struct kmag *m;
+
+  detectmem();
   initlock(&kmem.lock, "kmem");
+  for(m = kmags; m < &kmags[NCPU]; m++)
+    initlock(&m->lock, "kmag");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -48,32 +108,205 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
     kfree(p);
+    kmem.npages++;
+  }
+}
+// Remove block r of the given order from its free list.
+// Caller holds kmem.lock.
+static void
+unlinkblock(struct run *r, int order)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  frameorder[V2P(r)/PGSIZE] = 0;
+  kmem.nblocks[order]--;
+  kmem.nfree -= 1 << order;
+}
+
+// Add block r of the given order to its free list.
+// Caller holds kmem.lock.
+static void
+linkblock(struct run *r, int order)
+{
+  r->prev = 0;
+  r->next = kmem.free[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[order] = r;
+  frameorder[V2P(r)/PGSIZE] = order | BFREE;
+  kmem.nblocks[order]++;
+  kmem.nfree += 1 << order;
+}
+
+// Take a block of 2^order pages, splitting a larger one
+// if need be. Caller holds kmem.lock.
+static struct run*
+buddyalloc(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= MAXORDER && kmem.free[k] == 0; k++)
+    ;
+  if(k > MAXORDER)
+    return 0;
+  r = kmem.free[k];
+  unlinkblock(r, k);
+  // Return the upper halves to the free lists.
+  while(k > order){
+    k--;
+    linkblock((struct run*)((char*)r + (PGSIZE << k)), k);
+  }
+  return r;
+}
+
+// Free a block of 2^order pages, merging it with
+// free buddies. Caller holds kmem.lock.
+static void
+buddyfree(struct run *r, int order)
+{
+  uint f, b;
+
+  f = V2P(r) / PGSIZE;
+  while(order < MAXORDER){
+    b = f ^ (1 << order);
+    if(b >= physstop/PGSIZE || frameorder[b] != (order | BFREE))
+      break;
+    unlinkblock((struct run*)P2V(b * PGSIZE), order);
+    f &= ~(1 << order);
+    order++;
+  }
+  linkblock((struct run*)P2V(f * PGSIZE), order);
 }
+
+// Lock and return this CPU's magazine.
+static struct kmag*
+mymag(void)
+{
+  struct kmag *m;
+
+  pushcli();
+  m = &kmags[cpuid()];
+  acquire(&m->lock);
+  popcli();
+  return m;
+}
+
+// Move up to n pages from list *from to list *to.
+// Returns the number moved.
+static int
+movepages(struct run **from, struct run **to, int n)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && *from; i++){
+    r = *from;
+    *from = r->next;
+    r->next = *to;
+    *to = r;
+  }
+  return i;
+}
+
+// Take half the pages of some other CPU's magazine into m,
+// which the caller must not hold. Returns m, locked.
+static struct kmag*
+steal(struct kmag *m)
+{
+  struct kmag *v;
+  struct run *list;
+  int n;
+
+  list = 0;
+  n = 0;
+  for(v = kmags; v < &kmags[ncpu] && n == 0; v++){
+    if(v == m)
+      continue;
+    acquire(&v->lock);
+    n = movepages(&v->list, &list, (v->n + 1) / 2);
+    v->n -= n;
+    release(&v->lock);
+  }
+  acquire(&m->lock);
+  m->n += movepages(&list, &m->list, n);
+  return m;
+}
+
+// Take a page from the zero pool, or return 0 if it is empty.
+// The page is still allocated (see kzerofill), apart from its
+// first word which held the list link.
+static char*
+kzerotake(void)
+{
+  struct run *r;
+
+  if(kzero.n == 0)
+    return 0;
+  acquire(&kzero.lock);
+  r = kzero.list;
+  if(r){
+    kzero.list = r->next;
+    kzero.n--;
+  }
+  release(&kzero.lock);
+  if(r)
+    r->next = 0;
+  return (char*)r;
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// If the page is shared (see kref), just drop one reference.
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kmag *m;
+  int n;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || v < end || V2P(v) >= physstop)
     panic("kfree");
 
+  if(pageref[V2P(v)/PGSIZE] > 0 &&
+     __sync_sub_and_fetch(&pageref[V2P(v)/PGSIZE], 1) > 0)
+    return;
+
+#ifdef KFREEJUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    // Early boot: no magazines yet.
+    buddyfree(r, 0);
+    return;
+  }
+
+  m = mymag();
+  r->next = m->list;
+  m->list = r;
+  if(++m->n >= KMAGSIZE){
+    acquire(&kmem.lock);
+    for(n = 0; n < KMAGBATCH; n++){
+      r = m->list;
+      m->list = r->next;
+      buddyfree(r, 0);
+    }
     release(&kmem.lock);
+    m->n -= n;
+  }
+  release(&m->lock);
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +316,188 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kmag *m;
+  int n;
 
+  if(!kmem.use_lock){
+    r = buddyalloc(0);
+  } else {
+    m = mymag();
+    if(m->n == 0){
+      acquire(&kmem.lock);
+      for(n = 0; n < KMAGBATCH && (r = buddyalloc(0)) != 0; n++){
+        r->next = m->list;
+        m->list = r;
+      }
+      release(&kmem.lock);
+      m->n += n;
+    }
+    if(m->n == 0){
+      release(&m->lock);
+      m = steal(m);
+    }
+    r = m->list;
+    if(r){
+      m->list = r->next;
+      m->n--;
+    }
+    release(&m->lock);
+  }
+  if(r == 0 && (r = (struct run*)kzerotake()) != 0)
+    return (char*)r;
+  // Free the memory of reaped processes, and try again.
+  if(r == 0 && kmem.use_lock && reclaim(RECLAIMBATCH) > 0)
+    return kalloc();
+  if(r)
+    pageref[V2P(r)/PGSIZE] = 1;
+  return (char*)r;
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size. Returns 0 if no such block is free.
+// Each page has one reference, so the block can be freed
+// whole with kfree_pages() or page by page with kfree().
+char*
+kalloc_pages(int order)
+{
+  struct run *r;
+  int i;
+
+  if(order < 0 || order > MAXORDER)
+    return 0;
+  if(order == 0)
+    return kalloc();
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  r = buddyalloc(order);
   if(kmem.use_lock)
     release(&kmem.lock);
+  // As in kalloc(): free the memory of reaped processes,
+  // which may complete a block, and try again.
+  if(r == 0 && kmem.use_lock && reclaim(RECLAIMBATCH) > 0)
+    return kalloc_pages(order);
+  if(r)
+    for(i = 0; i < (1 << order); i++)
+      pageref[V2P(r)/PGSIZE + i] = 1;
   return (char*)r;
 }
 
+// Free a block from kalloc_pages(order) that
+// has no other references.
+void
+kfree_pages(char *v, int order)
+{
+  int i;
+
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || V2P(v) % (PGSIZE << order) ||
+     v < end || V2P(v) + (PGSIZE << order) > physstop)
+    panic("kfree_pages");
+  for(i = 0; i < (1 << order); i++){
+    if(pageref[V2P(v)/PGSIZE + i] != 1)
+      panic("kfree_pages: shared");
+    pageref[V2P(v)/PGSIZE + i] = 0;
+  }
+#ifdef KFREEJUNK
+  memset(v, 1, PGSIZE << order);
+#endif
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  buddyfree((struct run*)v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Allocate one zero-filled page, from the pool of pages
+// zeroed in idle time if possible.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if((v = kzerotake()) != 0)
+    return v;
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one more page into the pool, if it is not full.
+// Called by the scheduler when it has nothing to run.
+void
+kzerofill(void)
+{
+  struct run *r;
+
+  if(kzero.n >= KZEROPOOL || kfreepages() <= KZEROPOOL)
+    return;
+  if((r = (struct run*)kalloc()) == 0)
+    return;
+  memset(r, 0, PGSIZE);
+  acquire(&kzero.lock);
+  r->next = kzero.list;
+  kzero.list = r;
+  kzero.n++;
+  release(&kzero.lock);
+}
+
+// Add a reference to the allocated page v, which will then
+// take one more kfree() to free.
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= physstop)
+    panic("kref");
+  __sync_fetch_and_add(&pageref[V2P(v)/PGSIZE], 1);
+}
+
+// Number of references to the allocated page v.
+int
+krefcount(char *v)
+{
+  return pageref[V2P(v)/PGSIZE];
+}
+
+// Number of free pages, including those in magazines
+// and the zero pool.
+int
+kfreepages(void)
+{
+  struct kmag *m;
+  int n;
+
+  n = kmem.nfree + kzero.n;
+  for(m = kmags; m < &kmags[ncpu]; m++)
+    n += m->n;
+  return n;
+}
+
+// Number of pages the allocator manages.
+int
+ktotalpages(void)
+{
+  return kmem.npages;
+}
+
+// Print the free blocks of each order. Free memory held in
+// small blocks cannot satisfy large kalloc_pages() requests.
+void
+print_kalloc_stats(void)
+{
+  int k, big;
+
+  acquire(&kmem.lock);
+  cprintf("free blocks by order:");
+  big = -1;
+  for(k = 0; k <= MAXORDER; k++){
+    cprintf(" %d", kmem.nblocks[k]);
+    if(kmem.nblocks[k])
+      big = k;
+  }
+  cprintf("\nlargest free block: order %d; free pages in smaller blocks: %d\n",
+          big, big < 0 ? 0 : kmem.nfree - kmem.nblocks[big] * (1 << big));
+  release(&kmem.lock);
+}
@@ -0,0 +1,135 @@
+//
+// Counting semaphores and events for signaling between
+// processes without moving data through a pipe.
+// Processes refer to them by small integer handles,
+// which fork() passes on to the child like file descriptors.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define KSYNC_SEM 1
+#define KSYNC_EVENT 2
+
+struct ksync {
+  int ref;   // reference count; 0 means free
+  int type;  // KSYNC_SEM or KSYNC_EVENT
+  int count; // semaphore value; for an event, 1 if set
+};
+
+struct {
+  struct spinlock lock;
+  struct ksync ksync[NKSYNC];
+} ksynctable;
+
+void
+ksyncinit(void)
+{
+  initlock(&ksynctable.lock, "ksync");
+}
+
+// Allocate a semaphore with the given initial value.
+struct ksync*
+semalloc(int value)
+{
+  struct ksync *k;
+
+  if(value < 0)
+    return 0;
+  acquire(&ksynctable.lock);
+  for(k = ksynctable.ksync; k < ksynctable.ksync + NKSYNC; k++){
+    if(k->ref == 0){
+      k->ref = 1;
+      k->type = KSYNC_SEM;
+      k->count = value;
+      release(&ksynctable.lock);
+      return k;
+    }
+  }
+  release(&ksynctable.lock);
+  return 0;
+}
+
+// Allocate an event, initially not set.
+struct ksync*
+eventalloc(void)
+{
+  struct ksync *k;
+
+  if((k = semalloc(0)) != 0)
+    k->type = KSYNC_EVENT;
+  return k;
+}
+
+// Increment ref count for k.
+struct ksync*
+ksyncdup(struct ksync *k)
+{
+  acquire(&ksynctable.lock);
+  if(k->ref < 1)
+    panic("ksyncdup");
+  k->ref++;
+  release(&ksynctable.lock);
+  return k;
+}
+
+// Drop a reference to k; the last one frees it.
+void
+ksyncclose(struct ksync *k)
+{
+  acquire(&ksynctable.lock);
+  if(k->ref < 1)
+    panic("ksyncclose");
+  k->ref--;
+  release(&ksynctable.lock);
+}
+
+// Post a semaphore (wake one waiter) or set an event
+// (wake all waiters, and let later waits through).
+void
+ksyncpost(struct ksync *k)
+{
+  acquire(&ksynctable.lock);
+  if(k->type == KSYNC_SEM)
+    k->count++;
+  else
+    k->count = 1;
+  wakeup(k);
+  release(&ksynctable.lock);
+}
+
+// Wait for a semaphore to be positive and decrement it,
+// or for an event to be set.
+// Returns -1 if the process is killed while waiting.
+int
+ksyncwait(struct ksync *k)
+{
+  acquire(&ksynctable.lock);
+  while(k->count == 0){
+    if(myproc()->killed){
+      release(&ksynctable.lock);
+      return -1;
+    }
+    sleep(k, &ksynctable.lock);
+  }
+  if(k->type == KSYNC_SEM)
+    k->count--;
+  release(&ksynctable.lock);
+  return 0;
+}
+
+// Clear an event. Returns -1 if k is a semaphore.
+int
+ksyncreset(struct ksync *k)
+{
+  if(k->type != KSYNC_EVENT)
+    return -1;
+  acquire(&ksynctable.lock);
+  k->count = 0;
+  release(&ksynctable.lock);
+  return 0;
+}
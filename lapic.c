@@ -227,3 +227,18 @@ cmostime(struct rtcdate *r)
   *r = t1;
   r->year += 2000;
 }
+
+// Top of physical memory as the BIOS recorded it in CMOS.
+// Registers 0x30-0x31 count the KB above 1 MB (up to 64 MB),
+// and 0x34-0x35 the 64 KB units above 16 MB.
+uint
+cmosmemtop(void)
+{
+  uint ext, ext16;
+
+  ext = cmos_read(0x30) | cmos_read(0x31) << 8;
+  ext16 = cmos_read(0x34) | cmos_read(0x35) << 8;
+  if(ext16)
+    return 16*1024*1024 + ext16*64*1024;
+  return EXTMEM + ext*1024;
+}
@@ -0,0 +1,2159 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 24 0f 00 00       	push   $0xf24
+  1e:	6a 02                	push   $0x2
+  20:	e8 5b 07 00 00       	call   780 <printf>
+    exit();
+  25:	e8 66 00 00 00       	call   90 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 2c 04 00 00       	call   463 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 4d 00 00 00       	call   90 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 37 0f 00 00       	push   $0xf37
+  4e:	6a 02                	push   $0x2
+  50:	e8 2b 07 00 00       	call   780 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+  60:	a1 e0 13 00 00       	mov    0x13e0,%eax
+  65:	85 c0                	test   %eax,%eax
+  67:	74 17                	je     80 <fork+0x20>
+{
+  69:	55                   	push   %ebp
+  6a:	89 e5                	mov    %esp,%ebp
+  6c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+  6f:	ff d0                	call   *%eax
+  return _fork();
+}
+  71:	c9                   	leave
+  return _fork();
+  72:	e9 84 03 00 00       	jmp    3fb <_fork>
+  77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7e:	66 90                	xchg   %ax,%ax
+  80:	e9 76 03 00 00       	jmp    3fb <_fork>
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <exit>:
+
+int
+exit(void)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+  96:	a1 e0 13 00 00       	mov    0x13e0,%eax
+  9b:	85 c0                	test   %eax,%eax
+  9d:	74 02                	je     a1 <exit+0x11>
+    stdioflush();
+  9f:	ff d0                	call   *%eax
+  _exit();
+  a1:	e8 5d 03 00 00       	call   403 <_exit>
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000b0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+  b0:	55                   	push   %ebp
+  if(stdioflush)
+  b1:	a1 e0 13 00 00       	mov    0x13e0,%eax
+{
+  b6:	89 e5                	mov    %esp,%ebp
+  b8:	56                   	push   %esi
+  b9:	53                   	push   %ebx
+  ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+  c0:	85 c0                	test   %eax,%eax
+  c2:	74 02                	je     c6 <exec+0x16>
+    stdioflush();
+  c4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+  c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+  c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+  cc:	5b                   	pop    %ebx
+  cd:	5e                   	pop    %esi
+  ce:	5d                   	pop    %ebp
+  return _exec(path, argv);
+  cf:	e9 67 03 00 00       	jmp    43b <_exec>
+  d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  df:	90                   	nop
+
+000000e0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	56                   	push   %esi
+  e5:	53                   	push   %ebx
+  e6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+  e9:	a1 e0 13 00 00       	mov    0x13e0,%eax
+{
+  ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+  f7:	85 c0                	test   %eax,%eax
+  f9:	74 02                	je     fd <spawn+0x1d>
+    stdioflush();
+  fb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+  fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 100:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 103:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 106:	83 c4 0c             	add    $0xc,%esp
+ 109:	5b                   	pop    %ebx
+ 10a:	5e                   	pop    %esi
+ 10b:	5f                   	pop    %edi
+ 10c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 10d:	e9 79 04 00 00       	jmp    58b <_spawn>
+ 112:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	53                   	push   %ebx
+ 246:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 249:	a1 e0 13 00 00       	mov    0x13e0,%eax
+{
+ 24e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 251:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 254:	85 c0                	test   %eax,%eax
+ 256:	74 02                	je     25a <gets+0x1a>
+    stdioflush();
+ 258:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 25a:	a1 08 16 00 00       	mov    0x1608,%eax
+ 25f:	85 c0                	test   %eax,%eax
+ 261:	0f 84 99 00 00 00    	je     300 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 267:	31 db                	xor    %ebx,%ebx
+ 269:	eb 21                	jmp    28c <gets+0x4c>
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 270:	8d 50 01             	lea    0x1(%eax),%edx
+ 273:	0f b6 80 00 14 00 00 	movzbl 0x1400(%eax),%eax
+ 27a:	89 15 00 16 00 00    	mov    %edx,0x1600
+    buf[i++] = c;
+ 280:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 284:	3c 0a                	cmp    $0xa,%al
+ 286:	74 60                	je     2e8 <gets+0xa8>
+ 288:	3c 0d                	cmp    $0xd,%al
+ 28a:	74 5c                	je     2e8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 28c:	89 da                	mov    %ebx,%edx
+ 28e:	83 c3 01             	add    $0x1,%ebx
+ 291:	39 fb                	cmp    %edi,%ebx
+ 293:	7d 55                	jge    2ea <gets+0xaa>
+    if(in.r == in.n){
+ 295:	a1 00 16 00 00       	mov    0x1600,%eax
+ 29a:	3b 05 04 16 00 00    	cmp    0x1604,%eax
+ 2a0:	75 ce                	jne    270 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2a2:	83 ec 04             	sub    $0x4,%esp
+ 2a5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 2a8:	c7 05 04 16 00 00 00 	movl   $0x0,0x1604
+ 2af:	00 00 00 
+ 2b2:	c7 05 00 16 00 00 00 	movl   $0x0,0x1600
+ 2b9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2bc:	ff 35 08 16 00 00    	push   0x1608
+ 2c2:	68 00 14 00 00       	push   $0x1400
+ 2c7:	6a 00                	push   $0x0
+ 2c9:	e8 4d 01 00 00       	call   41b <read>
+ 2ce:	83 c4 10             	add    $0x10,%esp
+ 2d1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 2d4:	85 c0                	test   %eax,%eax
+ 2d6:	a3 04 16 00 00       	mov    %eax,0x1604
+ 2db:	7e 56                	jle    333 <gets+0xf3>
+    c = in.buf[in.r++];
+ 2dd:	a1 00 16 00 00       	mov    0x1600,%eax
+ 2e2:	eb 8c                	jmp    270 <gets+0x30>
+ 2e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 2e8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 2ea:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 2ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2f1:	89 f0                	mov    %esi,%eax
+ 2f3:	5b                   	pop    %ebx
+ 2f4:	5e                   	pop    %esi
+ 2f5:	5f                   	pop    %edi
+ 2f6:	5d                   	pop    %ebp
+ 2f7:	c3                   	ret
+ 2f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 300:	83 ec 08             	sub    $0x8,%esp
+ 303:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 306:	50                   	push   %eax
+ 307:	6a 00                	push   $0x0
+ 309:	e8 4d 01 00 00       	call   45b <fstat>
+ 30e:	83 c4 10             	add    $0x10,%esp
+ 311:	89 c2                	mov    %eax,%edx
+ 313:	b8 01 00 00 00       	mov    $0x1,%eax
+ 318:	85 d2                	test   %edx,%edx
+ 31a:	75 0d                	jne    329 <gets+0xe9>
+ 31c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 321:	ba 00 02 00 00       	mov    $0x200,%edx
+ 326:	0f 44 c2             	cmove  %edx,%eax
+ 329:	a3 08 16 00 00       	mov    %eax,0x1608
+ 32e:	e9 34 ff ff ff       	jmp    267 <gets+0x27>
+        in.n = 0;
+ 333:	c7 05 04 16 00 00 00 	movl   $0x0,0x1604
+ 33a:	00 00 00 
+        break;
+ 33d:	eb ab                	jmp    2ea <gets+0xaa>
+ 33f:	90                   	nop
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 f1 00 00 00       	call   443 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 f4 00 00 00       	call   45b <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 ba 00 00 00       	call   42b <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+
+000003fb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 3fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <_exit>:
+RAWSYSCALL(exit)
+ 403:	b8 02 00 00 00       	mov    $0x2,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <wait>:
+SYSCALL(wait)
+ 40b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <pipe>:
+SYSCALL(pipe)
+ 413:	b8 04 00 00 00       	mov    $0x4,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <read>:
+SYSCALL(read)
+ 41b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <write>:
+SYSCALL(write)
+ 423:	b8 10 00 00 00       	mov    $0x10,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <close>:
+SYSCALL(close)
+ 42b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <kill>:
+SYSCALL(kill)
+ 433:	b8 06 00 00 00       	mov    $0x6,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <_exec>:
+RAWSYSCALL(exec)
+ 43b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <open>:
+SYSCALL(open)
+ 443:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mknod>:
+SYSCALL(mknod)
+ 44b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <unlink>:
+SYSCALL(unlink)
+ 453:	b8 12 00 00 00       	mov    $0x12,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <fstat>:
+SYSCALL(fstat)
+ 45b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <link>:
+SYSCALL(link)
+ 463:	b8 13 00 00 00       	mov    $0x13,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mkdir>:
+SYSCALL(mkdir)
+ 46b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <chdir>:
+SYSCALL(chdir)
+ 473:	b8 09 00 00 00       	mov    $0x9,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <dup>:
+SYSCALL(dup)
+ 47b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpid>:
+SYSCALL(getpid)
+ 483:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sbrk>:
+SYSCALL(sbrk)
+ 48b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <sleep>:
+SYSCALL(sleep)
+ 493:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <uptime>:
+SYSCALL(uptime)
+ 49b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 4a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <get_parent_id>:
+SYSCALL(get_parent_id)
+ 4ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <get_children>:
+SYSCALL(get_children)
+ 4b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <set_path>:
+SYSCALL(set_path)
+ 4bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <set_sleep>:
+SYSCALL(set_sleep)
+ 4c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <get_time>:
+SYSCALL(get_time)
+ 4cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <change_process_level>:
+SYSCALL(change_process_level)
+ 4d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 4db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 4e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <print_processes_info>:
+SYSCALL(print_processes_info)
+ 4eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 4f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <barrier_wait>:
+SYSCALL(barrier_wait)
+ 4fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 503:	b8 22 00 00 00       	mov    $0x22,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 50b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 513:	b8 24 00 00 00       	mov    $0x24,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 51b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <sem_create>:
+SYSCALL(sem_create)
+ 523:	b8 26 00 00 00       	mov    $0x26,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <event_create>:
+SYSCALL(event_create)
+ 52b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sync_post>:
+SYSCALL(sync_post)
+ 533:	b8 28 00 00 00       	mov    $0x28,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <sync_wait>:
+SYSCALL(sync_wait)
+ 53b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sync_close>:
+SYSCALL(sync_close)
+ 543:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <event_reset>:
+SYSCALL(event_reset)
+ 54b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 553:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <munmap>:
+SYSCALL(munmap)
+ 563:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <shmget>:
+SYSCALL(shmget)
+ 56b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <shmat>:
+SYSCALL(shmat)
+ 573:	b8 30 00 00 00       	mov    $0x30,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <shmdt>:
+SYSCALL(shmdt)
+ 57b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <shmrm>:
+SYSCALL(shmrm)
+ 583:	b8 32 00 00 00       	mov    $0x32,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <_spawn>:
+RAWSYSCALL(spawn)
+ 58b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <memstat>:
+SYSCALL(memstat)
+ 593:	b8 34 00 00 00       	mov    $0x34,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+ 59b:	66 90                	xchg   %ax,%ax
+ 59d:	66 90                	xchg   %ax,%ax
+ 59f:	90                   	nop
+
+000005a0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 5a6:	a1 48 18 00 00       	mov    0x1848,%eax
+ 5ab:	85 c0                	test   %eax,%eax
+ 5ad:	7e 17                	jle    5c6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 5af:	83 ec 04             	sub    $0x4,%esp
+ 5b2:	50                   	push   %eax
+ 5b3:	68 4c 18 00 00       	push   $0x184c
+ 5b8:	ff 35 40 18 00 00    	push   0x1840
+ 5be:	e8 60 fe ff ff       	call   423 <write>
+ 5c3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 5c6:	c7 05 48 18 00 00 00 	movl   $0x0,0x1848
+ 5cd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 5d0:	c7 05 44 18 00 00 00 	movl   $0x0,0x1844
+ 5d7:	00 00 00 
+}
+ 5da:	c9                   	leave
+ 5db:	c3                   	ret
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5e6:	89 d1                	mov    %edx,%ecx
+{
+ 5e8:	56                   	push   %esi
+ 5e9:	53                   	push   %ebx
+ 5ea:	89 c3                	mov    %eax,%ebx
+ 5ec:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 5ef:	85 d2                	test   %edx,%edx
+ 5f1:	0f 89 b9 00 00 00    	jns    6b0 <printint+0xd0>
+ 5f7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5fb:	0f 84 af 00 00 00    	je     6b0 <printint+0xd0>
+    x = -xx;
+ 601:	f7 d9                	neg    %ecx
+    neg = 1;
+ 603:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 608:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 60b:	31 f6                	xor    %esi,%esi
+ 60d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	89 f3                	mov    %esi,%ebx
+ 616:	f7 f7                	div    %edi
+ 618:	8d 76 01             	lea    0x1(%esi),%esi
+ 61b:	0f b6 92 ac 0f 00 00 	movzbl 0xfac(%edx),%edx
+ 622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 626:	89 ca                	mov    %ecx,%edx
+ 628:	89 c1                	mov    %eax,%ecx
+ 62a:	39 fa                	cmp    %edi,%edx
+ 62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+ 62e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 631:	89 d9                	mov    %ebx,%ecx
+ 633:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 636:	85 c0                	test   %eax,%eax
+ 638:	74 07                	je     641 <printint+0x61>
+    buf[i++] = '-';
+ 63a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 63f:	89 f1                	mov    %esi,%ecx
+ 641:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 644:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 646:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 649:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 64c:	01 f7                	add    %esi,%edi
+ 64e:	eb 09                	jmp    659 <printint+0x79>
+
+  while(--i >= 0)
+ 650:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 653:	39 f7                	cmp    %esi,%edi
+ 655:	74 36                	je     68d <printint+0xad>
+ 657:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 659:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 65c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 65f:	8d 42 01             	lea    0x1(%edx),%eax
+ 662:	89 43 08             	mov    %eax,0x8(%ebx)
+ 665:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 669:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 66e:	74 28                	je     698 <printint+0xb8>
+ 670:	80 f9 0a             	cmp    $0xa,%cl
+ 673:	75 db                	jne    650 <printint+0x70>
+ 675:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 679:	75 d5                	jne    650 <printint+0x70>
+  if(b->n > 0)
+ 67b:	85 c0                	test   %eax,%eax
+ 67d:	7f 19                	jg     698 <printint+0xb8>
+  b->n = 0;
+ 67f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 686:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 689:	39 f7                	cmp    %esi,%edi
+ 68b:	75 ca                	jne    657 <printint+0x77>
+}
+ 68d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 690:	5b                   	pop    %ebx
+ 691:	5e                   	pop    %esi
+ 692:	5f                   	pop    %edi
+ 693:	5d                   	pop    %ebp
+ 694:	c3                   	ret
+ 695:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 698:	83 ec 04             	sub    $0x4,%esp
+ 69b:	50                   	push   %eax
+ 69c:	ff 75 d4             	push   -0x2c(%ebp)
+ 69f:	ff 33                	push   (%ebx)
+ 6a1:	e8 7d fd ff ff       	call   423 <write>
+ 6a6:	83 c4 10             	add    $0x10,%esp
+ 6a9:	eb d4                	jmp    67f <printint+0x9f>
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  neg = 0;
+ 6b0:	31 c0                	xor    %eax,%eax
+ 6b2:	e9 51 ff ff ff       	jmp    608 <printint+0x28>
+ 6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6be:	66 90                	xchg   %ax,%ax
+
+000006c0 <putc>:
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	53                   	push   %ebx
+ 6c4:	89 c3                	mov    %eax,%ebx
+ 6c6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 6c9:	8b 48 08             	mov    0x8(%eax),%ecx
+ 6cc:	8d 41 01             	lea    0x1(%ecx),%eax
+ 6cf:	89 43 08             	mov    %eax,0x8(%ebx)
+ 6d2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6d6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6db:	74 33                	je     710 <putc+0x50>
+ 6dd:	80 fa 0a             	cmp    $0xa,%dl
+ 6e0:	74 0e                	je     6f0 <putc+0x30>
+}
+ 6e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6e5:	c9                   	leave
+ 6e6:	c3                   	ret
+ 6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ee:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6f0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 6f4:	75 ec                	jne    6e2 <putc+0x22>
+  if(b->n > 0)
+ 6f6:	85 c0                	test   %eax,%eax
+ 6f8:	7f 16                	jg     710 <putc+0x50>
+  b->n = 0;
+ 6fa:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 701:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 704:	c9                   	leave
+ 705:	c3                   	ret
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	50                   	push   %eax
+ 714:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 717:	50                   	push   %eax
+ 718:	ff 33                	push   (%ebx)
+ 71a:	e8 04 fd ff ff       	call   423 <write>
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	eb d6                	jmp    6fa <putc+0x3a>
+ 724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+
+00000730 <fflush>:
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 736:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 73a:	74 04                	je     740 <fflush+0x10>
+}
+ 73c:	c9                   	leave
+ 73d:	c3                   	ret
+ 73e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 740:	a1 48 18 00 00       	mov    0x1848,%eax
+ 745:	85 c0                	test   %eax,%eax
+ 747:	7f 17                	jg     760 <fflush+0x30>
+  b->n = 0;
+ 749:	c7 05 48 18 00 00 00 	movl   $0x0,0x1848
+ 750:	00 00 00 
+  out.mode = 0;
+ 753:	c7 05 44 18 00 00 00 	movl   $0x0,0x1844
+ 75a:	00 00 00 
+}
+ 75d:	c9                   	leave
+ 75e:	c3                   	ret
+ 75f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	50                   	push   %eax
+ 764:	68 4c 18 00 00       	push   $0x184c
+ 769:	ff 35 40 18 00 00    	push   0x1840
+ 76f:	e8 af fc ff ff       	call   423 <write>
+ 774:	83 c4 10             	add    $0x10,%esp
+ 777:	eb d0                	jmp    749 <fflush+0x19>
+ 779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	83 ec 3c             	sub    $0x3c,%esp
+ 789:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 78c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 78f:	83 fe 01             	cmp    $0x1,%esi
+ 792:	0f 84 60 01 00 00    	je     8f8 <printf+0x178>
+    b->fd = fd;
+ 798:	89 35 20 16 00 00    	mov    %esi,0x1620
+  for(i = 0; fmt[i]; i++){
+ 79e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 7a1:	bf 20 16 00 00       	mov    $0x1620,%edi
+  for(i = 0; fmt[i]; i++){
+ 7a6:	84 c0                	test   %al,%al
+ 7a8:	74 65                	je     80f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 7aa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ad:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 7b0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 7b2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 7b5:	eb 1f                	jmp    7d6 <printf+0x56>
+ 7b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7be:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 7c0:	83 f8 25             	cmp    $0x25,%eax
+ 7c3:	74 3b                	je     800 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 7c5:	89 f8                	mov    %edi,%eax
+ 7c7:	e8 f4 fe ff ff       	call   6c0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 7cc:	0f b6 03             	movzbl (%ebx),%eax
+ 7cf:	83 c3 01             	add    $0x1,%ebx
+ 7d2:	84 c0                	test   %al,%al
+ 7d4:	74 39                	je     80f <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 7d6:	0f be d0             	movsbl %al,%edx
+ 7d9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 7dc:	85 f6                	test   %esi,%esi
+ 7de:	74 e0                	je     7c0 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 7e0:	83 fe 25             	cmp    $0x25,%esi
+ 7e3:	75 e7                	jne    7cc <printf+0x4c>
+      if(c == 'd'){
+ 7e5:	83 f8 25             	cmp    $0x25,%eax
+ 7e8:	74 57                	je     841 <printf+0xc1>
+ 7ea:	83 e8 63             	sub    $0x63,%eax
+ 7ed:	83 f8 15             	cmp    $0x15,%eax
+ 7f0:	77 36                	ja     828 <printf+0xa8>
+ 7f2:	ff 24 85 54 0f 00 00 	jmp    *0xf54(,%eax,4)
+ 7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 800:	0f b6 03             	movzbl (%ebx),%eax
+ 803:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 806:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 80b:	84 c0                	test   %al,%al
+ 80d:	75 c7                	jne    7d6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 80f:	8b 47 04             	mov    0x4(%edi),%eax
+ 812:	85 c0                	test   %eax,%eax
+ 814:	0f 84 06 01 00 00    	je     920 <printf+0x1a0>
+    bflush(b);
+}
+ 81a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81d:	5b                   	pop    %ebx
+ 81e:	5e                   	pop    %esi
+ 81f:	5f                   	pop    %edi
+ 820:	5d                   	pop    %ebp
+ 821:	c3                   	ret
+ 822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 828:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 82b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 82e:	89 47 08             	mov    %eax,0x8(%edi)
+ 831:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 836:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 83b:	0f 84 77 01 00 00    	je     9b8 <printf+0x238>
+        putc(b, c);
+ 841:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 843:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 845:	e8 76 fe ff ff       	call   6c0 <putc>
+ 84a:	eb 80                	jmp    7cc <printf+0x4c>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 850:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 85b:	8b 16                	mov    (%esi),%edx
+ 85d:	6a 00                	push   $0x0
+        ap++;
+ 85f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 862:	89 f8                	mov    %edi,%eax
+ 864:	e8 77 fd ff ff       	call   5e0 <printint>
+        ap++;
+ 869:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 86c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86f:	31 f6                	xor    %esi,%esi
+ 871:	e9 56 ff ff ff       	jmp    7cc <printf+0x4c>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 880:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 883:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 885:	83 c0 04             	add    $0x4,%eax
+ 888:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 88b:	85 c9                	test   %ecx,%ecx
+ 88d:	0f 84 cd 00 00 00    	je     960 <printf+0x1e0>
+        while(*s != 0){
+ 893:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 896:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 898:	84 d2                	test   %dl,%dl
+ 89a:	0f 84 2c ff ff ff    	je     7cc <printf+0x4c>
+          putc(b, *s);
+ 8a0:	89 f8                	mov    %edi,%eax
+ 8a2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 8a5:	e8 16 fe ff ff       	call   6c0 <putc>
+          s++;
+ 8aa:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 8ad:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 8b1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 8b4:	84 d2                	test   %dl,%dl
+ 8b6:	75 e8                	jne    8a0 <printf+0x120>
+      state = 0;
+ 8b8:	31 f6                	xor    %esi,%esi
+ 8ba:	e9 0d ff ff ff       	jmp    7cc <printf+0x4c>
+ 8bf:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 8c0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 16                	mov    (%esi),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	eb 8e                	jmp    85f <printf+0xdf>
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 8d8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8db:	89 f8                	mov    %edi,%eax
+ 8dd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 8e0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 8e3:	e8 d8 fd ff ff       	call   6c0 <putc>
+        ap++;
+ 8e8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 8eb:	31 f6                	xor    %esi,%esi
+ 8ed:	e9 da fe ff ff       	jmp    7cc <printf+0x4c>
+ 8f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 8f8:	8b 15 44 18 00 00    	mov    0x1844,%edx
+ 8fe:	85 d2                	test   %edx,%edx
+ 900:	74 6e                	je     970 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 902:	0f b6 03             	movzbl (%ebx),%eax
+ 905:	bf 40 18 00 00       	mov    $0x1840,%edi
+ 90a:	84 c0                	test   %al,%al
+ 90c:	0f 85 98 fe ff ff    	jne    7aa <printf+0x2a>
+ 912:	e9 03 ff ff ff       	jmp    81a <printf+0x9a>
+ 917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 920:	8b 47 08             	mov    0x8(%edi),%eax
+ 923:	85 c0                	test   %eax,%eax
+ 925:	7f 19                	jg     940 <printf+0x1c0>
+  b->n = 0;
+ 927:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 92e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 931:	5b                   	pop    %ebx
+ 932:	5e                   	pop    %esi
+ 933:	5f                   	pop    %edi
+ 934:	5d                   	pop    %ebp
+ 935:	c3                   	ret
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	50                   	push   %eax
+ 944:	8d 47 0c             	lea    0xc(%edi),%eax
+ 947:	50                   	push   %eax
+ 948:	ff 37                	push   (%edi)
+ 94a:	e8 d4 fa ff ff       	call   423 <write>
+  b->n = 0;
+ 94f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ 956:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 959:	eb d3                	jmp    92e <printf+0x1ae>
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+ 960:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 965:	b9 4b 0f 00 00       	mov    $0xf4b,%ecx
+ 96a:	e9 31 ff ff ff       	jmp    8a0 <printf+0x120>
+ 96f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 970:	83 ec 08             	sub    $0x8,%esp
+ 973:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ 976:	c7 05 40 18 00 00 01 	movl   $0x1,0x1840
+ 97d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 980:	50                   	push   %eax
+ 981:	6a 01                	push   $0x1
+ 983:	e8 d3 fa ff ff       	call   45b <fstat>
+ 988:	83 c4 10             	add    $0x10,%esp
+ 98b:	85 c0                	test   %eax,%eax
+ 98d:	75 22                	jne    9b1 <printf+0x231>
+ 98f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 994:	b8 02 00 00 00       	mov    $0x2,%eax
+ 999:	0f 45 f0             	cmovne %eax,%esi
+ 99c:	89 35 44 18 00 00    	mov    %esi,0x1844
+      stdioflush = flushout;
+ 9a2:	c7 05 e0 13 00 00 a0 	movl   $0x5a0,0x13e0
+ 9a9:	05 00 00 
+ 9ac:	e9 51 ff ff ff       	jmp    902 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 9b1:	be 02 00 00 00       	mov    $0x2,%esi
+ 9b6:	eb e4                	jmp    99c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ 9b8:	83 ec 04             	sub    $0x4,%esp
+ 9bb:	8d 47 0c             	lea    0xc(%edi),%eax
+ 9be:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 9c1:	68 00 02 00 00       	push   $0x200
+ 9c6:	50                   	push   %eax
+ 9c7:	ff 37                	push   (%edi)
+ 9c9:	e8 55 fa ff ff       	call   423 <write>
+  b->n = 0;
+ 9ce:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9d5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 9d8:	83 c4 10             	add    $0x10,%esp
+ 9db:	e9 61 fe ff ff       	jmp    841 <printf+0xc1>
+
+000009e0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	56                   	push   %esi
+ 9e4:	53                   	push   %ebx
+ 9e5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ 9e7:	a1 60 1a 00 00       	mov    0x1a60,%eax
+ 9ec:	39 d8                	cmp    %ebx,%eax
+ 9ee:	0f 83 e4 00 00 00    	jae    ad8 <freepages+0xf8>
+ 9f4:	85 c0                	test   %eax,%eax
+ 9f6:	0f 84 dc 00 00 00    	je     ad8 <freepages+0xf8>
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a00:	89 c2                	mov    %eax,%edx
+ a02:	8b 00                	mov    (%eax),%eax
+ a04:	85 c0                	test   %eax,%eax
+ a06:	74 04                	je     a0c <freepages+0x2c>
+ a08:	39 d8                	cmp    %ebx,%eax
+ a0a:	72 f4                	jb     a00 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ a0c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ a0f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ a11:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ a13:	85 c0                	test   %eax,%eax
+ a15:	74 15                	je     a2c <freepages+0x4c>
+    p->prev = s;
+ a17:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ a1a:	8b 73 10             	mov    0x10(%ebx),%esi
+ a1d:	89 f1                	mov    %esi,%ecx
+ a1f:	c1 e1 0c             	shl    $0xc,%ecx
+ a22:	01 d9                	add    %ebx,%ecx
+ a24:	39 c8                	cmp    %ecx,%eax
+ a26:	0f 84 d8 00 00 00    	je     b04 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ a2c:	8b 4a 10             	mov    0x10(%edx),%ecx
+ a2f:	89 c8                	mov    %ecx,%eax
+ a31:	c1 e0 0c             	shl    $0xc,%eax
+ a34:	01 d0                	add    %edx,%eax
+ a36:	39 c3                	cmp    %eax,%ebx
+ a38:	74 16                	je     a50 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a3a:	8b 03                	mov    (%ebx),%eax
+ a3c:	85 c0                	test   %eax,%eax
+ a3e:	74 40                	je     a80 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ a40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a43:	5b                   	pop    %ebx
+ a44:	5e                   	pop    %esi
+ a45:	5d                   	pop    %ebp
+ a46:	c3                   	ret
+ a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ a50:	03 4b 10             	add    0x10(%ebx),%ecx
+ a53:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ a56:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ a59:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ a5b:	85 c9                	test   %ecx,%ecx
+ a5d:	0f 84 dd 00 00 00    	je     b40 <freepages+0x160>
+    s->prev->next = s->next;
+ a63:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ a65:	85 c0                	test   %eax,%eax
+ a67:	74 06                	je     a6f <freepages+0x8f>
+    s->next->prev = s->prev;
+ a69:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ a6c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a6f:	8b 02                	mov    (%edx),%eax
+ a71:	89 d3                	mov    %edx,%ebx
+ a73:	85 c0                	test   %eax,%eax
+ a75:	75 c9                	jne    a40 <freepages+0x60>
+ a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7e:	66 90                	xchg   %ax,%ax
+ a80:	8b 43 10             	mov    0x10(%ebx),%eax
+ a83:	83 f8 0f             	cmp    $0xf,%eax
+ a86:	76 b8                	jbe    a40 <freepages+0x60>
+ a88:	83 ec 0c             	sub    $0xc,%esp
+ a8b:	c1 e0 0c             	shl    $0xc,%eax
+ a8e:	6a 00                	push   $0x0
+ a90:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ a93:	e8 f3 f9 ff ff       	call   48b <sbrk>
+ a98:	83 c4 10             	add    $0x10,%esp
+ a9b:	39 c6                	cmp    %eax,%esi
+ a9d:	75 a1                	jne    a40 <freepages+0x60>
+  if(s->prev)
+ a9f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ aa2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ aa4:	85 d2                	test   %edx,%edx
+ aa6:	0f 84 a5 00 00 00    	je     b51 <freepages+0x171>
+    s->prev->next = s->next;
+ aac:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ aae:	85 c0                	test   %eax,%eax
+ ab0:	74 06                	je     ab8 <freepages+0xd8>
+    s->next->prev = s->prev;
+ ab2:	8b 53 04             	mov    0x4(%ebx),%edx
+ ab5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ ab8:	8b 43 10             	mov    0x10(%ebx),%eax
+ abb:	83 ec 0c             	sub    $0xc,%esp
+ abe:	c1 e0 0c             	shl    $0xc,%eax
+ ac1:	f7 d8                	neg    %eax
+ ac3:	50                   	push   %eax
+ ac4:	e8 c2 f9 ff ff       	call   48b <sbrk>
+ ac9:	83 c4 10             	add    $0x10,%esp
+}
+ acc:	e9 6f ff ff ff       	jmp    a40 <freepages+0x60>
+ ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ ad8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ adf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ ae1:	89 1d 60 1a 00 00    	mov    %ebx,0x1a60
+  if(p)
+ ae7:	85 c0                	test   %eax,%eax
+ ae9:	74 95                	je     a80 <freepages+0xa0>
+    p->prev = s;
+ aeb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ aee:	8b 73 10             	mov    0x10(%ebx),%esi
+ af1:	89 f2                	mov    %esi,%edx
+ af3:	c1 e2 0c             	shl    $0xc,%edx
+ af6:	01 da                	add    %ebx,%edx
+ af8:	39 d0                	cmp    %edx,%eax
+ afa:	0f 85 3a ff ff ff    	jne    a3a <freepages+0x5a>
+ b00:	89 c1                	mov    %eax,%ecx
+ b02:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ b04:	8b 41 10             	mov    0x10(%ecx),%eax
+ b07:	01 f0                	add    %esi,%eax
+ b09:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ b0c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ b0f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ b11:	85 f6                	test   %esi,%esi
+ b13:	74 35                	je     b4a <freepages+0x16a>
+    s->prev->next = s->next;
+ b15:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ b17:	85 c0                	test   %eax,%eax
+ b19:	74 06                	je     b21 <freepages+0x141>
+    s->next->prev = s->prev;
+ b1b:	8b 49 04             	mov    0x4(%ecx),%ecx
+ b1e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ b21:	85 d2                	test   %edx,%edx
+ b23:	0f 84 11 ff ff ff    	je     a3a <freepages+0x5a>
+ b29:	8b 4a 10             	mov    0x10(%edx),%ecx
+ b2c:	89 c8                	mov    %ecx,%eax
+ b2e:	c1 e0 0c             	shl    $0xc,%eax
+ b31:	01 d0                	add    %edx,%eax
+ b33:	39 c3                	cmp    %eax,%ebx
+ b35:	0f 85 ff fe ff ff    	jne    a3a <freepages+0x5a>
+ b3b:	e9 10 ff ff ff       	jmp    a50 <freepages+0x70>
+    *l = s->next;
+ b40:	a3 60 1a 00 00       	mov    %eax,0x1a60
+ b45:	e9 1b ff ff ff       	jmp    a65 <freepages+0x85>
+ b4a:	a3 60 1a 00 00       	mov    %eax,0x1a60
+ b4f:	eb c6                	jmp    b17 <freepages+0x137>
+ b51:	a3 60 1a 00 00       	mov    %eax,0x1a60
+ b56:	e9 53 ff ff ff       	jmp    aae <freepages+0xce>
+ b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+
+00000b60 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	56                   	push   %esi
+ b64:	53                   	push   %ebx
+ b65:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ b67:	a1 60 1a 00 00       	mov    0x1a60,%eax
+ b6c:	85 c0                	test   %eax,%eax
+ b6e:	74 5e                	je     bce <getpages+0x6e>
+    if(s->npages < n)
+ b70:	8b 50 10             	mov    0x10(%eax),%edx
+ b73:	39 da                	cmp    %ebx,%edx
+ b75:	72 51                	jb     bc8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ b77:	39 d3                	cmp    %edx,%ebx
+ b79:	72 25                	jb     ba0 <getpages+0x40>
+  if(s->prev)
+ b7b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ b7e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ b80:	85 c9                	test   %ecx,%ecx
+ b82:	0f 84 a8 00 00 00    	je     c30 <getpages+0xd0>
+    s->prev->next = s->next;
+ b88:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ b8a:	85 d2                	test   %edx,%edx
+ b8c:	74 06                	je     b94 <getpages+0x34>
+    s->next->prev = s->prev;
+ b8e:	8b 48 04             	mov    0x4(%eax),%ecx
+ b91:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ b94:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ b97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b9a:	5b                   	pop    %ebx
+ b9b:	5e                   	pop    %esi
+ b9c:	5d                   	pop    %ebp
+ b9d:	c3                   	ret
+ b9e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ ba0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ ba2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ ba4:	c1 e1 0c             	shl    $0xc,%ecx
+ ba7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ ba9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ bac:	8b 70 04             	mov    0x4(%eax),%esi
+ baf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ bb2:	8b 10                	mov    (%eax),%edx
+ bb4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ bb6:	85 f6                	test   %esi,%esi
+ bb8:	74 66                	je     c20 <getpages+0xc0>
+        rest->prev->next = rest;
+ bba:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ bbc:	8b 11                	mov    (%ecx),%edx
+ bbe:	85 d2                	test   %edx,%edx
+ bc0:	75 cf                	jne    b91 <getpages+0x31>
+ bc2:	eb d0                	jmp    b94 <getpages+0x34>
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ bc8:	8b 00                	mov    (%eax),%eax
+ bca:	85 c0                	test   %eax,%eax
+ bcc:	75 a2                	jne    b70 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ bce:	83 ec 0c             	sub    $0xc,%esp
+ bd1:	6a 00                	push   $0x0
+ bd3:	e8 b3 f8 ff ff       	call   48b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bd8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ bdb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ be1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ be3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ be9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bef:	29 d0                	sub    %edx,%eax
+ bf1:	c1 e8 0c             	shr    $0xc,%eax
+ bf4:	39 d8                	cmp    %ebx,%eax
+ bf6:	72 48                	jb     c40 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ bf8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ bfa:	89 d8                	mov    %ebx,%eax
+ bfc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ bff:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c01:	c1 e0 0c             	shl    $0xc,%eax
+ c04:	01 f0                	add    %esi,%eax
+ c06:	50                   	push   %eax
+ c07:	e8 7f f8 ff ff       	call   48b <sbrk>
+ c0c:	83 c4 10             	add    $0x10,%esp
+ c0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c12:	74 2c                	je     c40 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ c14:	01 f0                	add    %esi,%eax
+ c16:	e9 79 ff ff ff       	jmp    b94 <getpages+0x34>
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+        runs = rest;
+ c20:	89 0d 60 1a 00 00    	mov    %ecx,0x1a60
+ c26:	eb 96                	jmp    bbe <getpages+0x5e>
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+    *l = s->next;
+ c30:	89 15 60 1a 00 00    	mov    %edx,0x1a60
+ c36:	e9 4f ff ff ff       	jmp    b8a <getpages+0x2a>
+ c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+    return 0;
+ c40:	31 c0                	xor    %eax,%eax
+ c42:	e9 50 ff ff ff       	jmp    b97 <getpages+0x37>
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	57                   	push   %edi
+ c54:	56                   	push   %esi
+ c55:	53                   	push   %ebx
+ c56:	83 ec 1c             	sub    $0x1c,%esp
+ c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ c5c:	85 c0                	test   %eax,%eax
+ c5e:	0f 84 97 00 00 00    	je     cfb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ c64:	89 c3                	mov    %eax,%ebx
+ c66:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ c6c:	8b 73 14             	mov    0x14(%ebx),%esi
+ c6f:	83 fe 01             	cmp    $0x1,%esi
+ c72:	74 74                	je     ce8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ c74:	85 f6                	test   %esi,%esi
+ c76:	74 5d                	je     cd5 <free+0x85>
+  if(s->free == 0)
+ c78:	8b 53 08             	mov    0x8(%ebx),%edx
+ c7b:	85 d2                	test   %edx,%edx
+ c7d:	0f 84 85 00 00 00    	je     d08 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ c83:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ c85:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ c88:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c8b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ c8e:	8b 04 f5 84 1a 00 00 	mov    0x1a84(,%esi,8),%eax
+  s->inuse--;
+ c95:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ c98:	83 c0 01             	add    $0x1,%eax
+ c9b:	89 04 f5 84 1a 00 00 	mov    %eax,0x1a84(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ ca2:	85 d2                	test   %edx,%edx
+ ca4:	75 55                	jne    cfb <free+0xab>
+ ca6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ cab:	89 f1                	mov    %esi,%ecx
+ cad:	d3 ea                	shr    %cl,%edx
+ caf:	39 c2                	cmp    %eax,%edx
+ cb1:	73 7d                	jae    d30 <free+0xe0>
+  if(s->prev)
+ cb3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ cb6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ cb8:	85 ff                	test   %edi,%edi
+ cba:	0f 84 a0 00 00 00    	je     d60 <free+0x110>
+    s->prev->next = s->next;
+ cc0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ cc2:	85 c9                	test   %ecx,%ecx
+ cc4:	74 06                	je     ccc <free+0x7c>
+    s->next->prev = s->prev;
+ cc6:	8b 7b 04             	mov    0x4(%ebx),%edi
+ cc9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ ccc:	29 d0                	sub    %edx,%eax
+ cce:	89 04 f5 84 1a 00 00 	mov    %eax,0x1a84(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ cd8:	89 d8                	mov    %ebx,%eax
+}
+ cda:	5b                   	pop    %ebx
+ cdb:	5e                   	pop    %esi
+ cdc:	5f                   	pop    %edi
+ cdd:	5d                   	pop    %ebp
+    freepages(s);
+ cde:	e9 fd fc ff ff       	jmp    9e0 <freepages>
+ ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ce7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ ce8:	8b 43 10             	mov    0x10(%ebx),%eax
+ ceb:	83 ec 08             	sub    $0x8,%esp
+ cee:	c1 e0 0c             	shl    $0xc,%eax
+ cf1:	50                   	push   %eax
+ cf2:	53                   	push   %ebx
+ cf3:	e8 6b f8 ff ff       	call   563 <munmap>
+ cf8:	83 c4 10             	add    $0x10,%esp
+}
+ cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cfe:	5b                   	pop    %ebx
+ cff:	5e                   	pop    %esi
+ d00:	5f                   	pop    %edi
+ d01:	5d                   	pop    %ebp
+ d02:	c3                   	ret
+ d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d07:	90                   	nop
+  s->next = *l;
+ d08:	8b 14 f5 80 1a 00 00 	mov    0x1a80(,%esi,8),%edx
+  s->prev = 0;
+ d0f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ d16:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ d18:	85 d2                	test   %edx,%edx
+ d1a:	74 06                	je     d22 <free+0xd2>
+    (*l)->prev = s;
+ d1c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ d1f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ d22:	89 1c f5 80 1a 00 00 	mov    %ebx,0x1a80(,%esi,8)
+}
+ d29:	e9 55 ff ff ff       	jmp    c83 <free+0x33>
+ d2e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ d30:	83 ec 0c             	sub    $0xc,%esp
+ d33:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ d36:	8b 7b 10             	mov    0x10(%ebx),%edi
+ d39:	6a 00                	push   $0x0
+ d3b:	c1 e7 0c             	shl    $0xc,%edi
+ d3e:	01 df                	add    %ebx,%edi
+ d40:	e8 46 f7 ff ff       	call   48b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d45:	83 c4 10             	add    $0x10,%esp
+ d48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ d4b:	39 c7                	cmp    %eax,%edi
+ d4d:	75 ac                	jne    cfb <free+0xab>
+ d4f:	8b 04 f5 84 1a 00 00 	mov    0x1a84(,%esi,8),%eax
+ d56:	e9 58 ff ff ff       	jmp    cb3 <free+0x63>
+ d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d5f:	90                   	nop
+    *l = s->next;
+ d60:	89 0c f5 80 1a 00 00 	mov    %ecx,0x1a80(,%esi,8)
+ d67:	e9 56 ff ff ff       	jmp    cc2 <free+0x72>
+ d6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d70:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ d71:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ d76:	89 e5                	mov    %esp,%ebp
+ d78:	57                   	push   %edi
+ d79:	56                   	push   %esi
+ d7a:	53                   	push   %ebx
+ d7b:	83 ec 1c             	sub    $0x1c,%esp
+ d7e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ d81:	83 f8 10             	cmp    $0x10,%eax
+ d84:	0f 86 92 00 00 00    	jbe    e1c <malloc+0xac>
+ d8a:	ba 01 00 00 00       	mov    $0x1,%edx
+ d8f:	eb 13                	jmp    da4 <malloc+0x34>
+ d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d98:	89 d3                	mov    %edx,%ebx
+ d9a:	d3 e3                	shl    %cl,%ebx
+ d9c:	39 c3                	cmp    %eax,%ebx
+ d9e:	0f 83 84 00 00 00    	jae    e28 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ da4:	83 c1 01             	add    $0x1,%ecx
+ da7:	83 f9 0b             	cmp    $0xb,%ecx
+ daa:	75 ec                	jne    d98 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ dac:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ db1:	0f 87 c9 00 00 00    	ja     e80 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ db7:	05 17 10 00 00       	add    $0x1017,%eax
+ dbc:	89 c3                	mov    %eax,%ebx
+ dbe:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ dc1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ dc6:	77 28                	ja     df0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ dc8:	89 d8                	mov    %ebx,%eax
+ dca:	e8 91 fd ff ff       	call   b60 <getpages>
+ dcf:	85 c0                	test   %eax,%eax
+ dd1:	0f 84 a9 00 00 00    	je     e80 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ dd7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ dde:	83 c0 18             	add    $0x18,%eax
+}
+ de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ de4:	5b                   	pop    %ebx
+ de5:	5e                   	pop    %esi
+ de6:	5f                   	pop    %edi
+ de7:	5d                   	pop    %ebp
+ de8:	c3                   	ret
+ de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ df0:	89 d8                	mov    %ebx,%eax
+ df2:	83 ec 08             	sub    $0x8,%esp
+ df5:	c1 e0 0c             	shl    $0xc,%eax
+ df8:	6a 00                	push   $0x0
+ dfa:	6a ff                	push   $0xffffffff
+ dfc:	6a 22                	push   $0x22
+ dfe:	6a 03                	push   $0x3
+ e00:	50                   	push   %eax
+ e01:	6a 00                	push   $0x0
+ e03:	e8 53 f7 ff ff       	call   55b <mmap>
+    if(s == MAP_FAILED)
+ e08:	83 c4 20             	add    $0x20,%esp
+ e0b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e0e:	74 b8                	je     dc8 <malloc+0x58>
+      s->shift = MAPRUN;
+ e10:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ e17:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ e1a:	eb c2                	jmp    dde <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ e1c:	bb 10 00 00 00       	mov    $0x10,%ebx
+ e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ e28:	8b 34 cd 80 1a 00 00 	mov    0x1a80(,%ecx,8),%esi
+ e2f:	85 f6                	test   %esi,%esi
+ e31:	74 57                	je     e8a <malloc+0x11a>
+  classes[shift].nfree--;
+ e33:	8b 1c cd 84 1a 00 00 	mov    0x1a84(,%ecx,8),%ebx
+  o = s->free;
+ e3a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ e3d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ e40:	89 14 cd 84 1a 00 00 	mov    %edx,0x1a84(,%ecx,8)
+  s->free = NEXTFREE(o);
+ e47:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ e49:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ e4d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ e50:	85 ff                	test   %edi,%edi
+ e52:	75 8d                	jne    de1 <malloc+0x71>
+  if(s->prev)
+ e54:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ e57:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ e59:	85 db                	test   %ebx,%ebx
+ e5b:	0f 84 b7 00 00 00    	je     f18 <malloc+0x1a8>
+    s->prev->next = s->next;
+ e61:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ e63:	85 d2                	test   %edx,%edx
+ e65:	0f 84 76 ff ff ff    	je     de1 <malloc+0x71>
+    s->next->prev = s->prev;
+ e6b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ e6e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ e71:	e9 6b ff ff ff       	jmp    de1 <malloc+0x71>
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ e83:	31 c0                	xor    %eax,%eax
+}
+ e85:	5b                   	pop    %ebx
+ e86:	5e                   	pop    %esi
+ e87:	5f                   	pop    %edi
+ e88:	5d                   	pop    %ebp
+ e89:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ e8a:	b8 01 00 00 00       	mov    $0x1,%eax
+ e8f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ e92:	e8 c9 fc ff ff       	call   b60 <getpages>
+ e97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ e9a:	85 c0                	test   %eax,%eax
+ e9c:	89 c2                	mov    %eax,%edx
+ e9e:	74 e0                	je     e80 <malloc+0x110>
+    s->shift = shift;
+ ea0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ea3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ ea5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ eac:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ eb1:	89 df                	mov    %ebx,%edi
+ eb3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ eb5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ eb7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ eba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ebd:	83 e8 01             	sub    $0x1,%eax
+ ec0:	d3 e0                	shl    %cl,%eax
+ ec2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ ec5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ec9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ ecc:	eb 04                	jmp    ed2 <malloc+0x162>
+ ece:	66 90                	xchg   %ax,%ax
+ ed0:	89 c8                	mov    %ecx,%eax
+ ed2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ ed5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ed7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ eda:	89 c6                	mov    %eax,%esi
+ edc:	39 da                	cmp    %ebx,%edx
+ ede:	7f f0                	jg     ed0 <malloc+0x160>
+ ee0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ ee3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ ee6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ ee9:	8b 04 cd 80 1a 00 00 	mov    0x1a80(,%ecx,8),%eax
+  s->prev = 0;
+ ef0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ ef7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ ef9:	85 c0                	test   %eax,%eax
+ efb:	74 03                	je     f00 <malloc+0x190>
+    (*l)->prev = s;
+ efd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ f00:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ f03:	89 14 cd 80 1a 00 00 	mov    %edx,0x1a80(,%ecx,8)
+    classes[shift].nfree += n;
+ f0a:	89 d6                	mov    %edx,%esi
+ f0c:	03 1c cd 84 1a 00 00 	add    0x1a84(,%ecx,8),%ebx
+ f13:	e9 22 ff ff ff       	jmp    e3a <malloc+0xca>
+    *l = s->next;
+ f18:	89 14 cd 80 1a 00 00 	mov    %edx,0x1a80(,%ecx,8)
+ f1f:	e9 3f ff ff ff       	jmp    e63 <malloc+0xf3>
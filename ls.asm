@@ -0,0 +1,2444 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 2e 03 00 00       	call   370 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 4c 12 00 00       	push   $0x124c
+      4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+      4f:	e8 1c 03 00 00       	call   370 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	56                   	push   %esi
+      64:	53                   	push   %ebx
+      65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      68:	83 ec 0c             	sub    $0xc,%esp
+      6b:	56                   	push   %esi
+      6c:	e8 1f 04 00 00       	call   490 <strlen>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	01 f0                	add    %esi,%eax
+      76:	89 c3                	mov    %eax,%ebx
+      78:	73 0f                	jae    89 <fmtname+0x29>
+      7a:	eb 12                	jmp    8e <fmtname+0x2e>
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      83:	39 f0                	cmp    %esi,%eax
+      85:	72 0a                	jb     91 <fmtname+0x31>
+      87:	89 c3                	mov    %eax,%ebx
+      89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+      8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	53                   	push   %ebx
+      95:	e8 f6 03 00 00       	call   490 <strlen>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	83 f8 0d             	cmp    $0xd,%eax
+      a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	53                   	push   %ebx
+      a6:	e8 e5 03 00 00       	call   490 <strlen>
+      ab:	83 c4 0c             	add    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	53                   	push   %ebx
+      b0:	68 60 17 00 00       	push   $0x1760
+      b5:	e8 f6 05 00 00       	call   6b0 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ba:	89 1c 24             	mov    %ebx,(%esp)
+      bd:	e8 ce 03 00 00       	call   490 <strlen>
+      c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      c5:	bb 60 17 00 00       	mov    $0x1760,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ca:	89 c6                	mov    %eax,%esi
+      cc:	e8 bf 03 00 00       	call   490 <strlen>
+      d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+      d6:	83 c4 0c             	add    $0xc,%esp
+      d9:	29 f2                	sub    %esi,%edx
+      db:	05 60 17 00 00       	add    $0x1760,%eax
+      e0:	52                   	push   %edx
+      e1:	6a 20                	push   $0x20
+      e3:	50                   	push   %eax
+      e4:	e8 d7 03 00 00       	call   4c0 <memset>
+  return buf;
+      e9:	83 c4 10             	add    $0x10,%esp
+}
+      ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ef:	89 d8                	mov    %ebx,%eax
+      f1:	5b                   	pop    %ebx
+      f2:	5e                   	pop    %esi
+      f3:	5d                   	pop    %ebp
+      f4:	c3                   	ret
+      f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+     10f:	6a 00                	push   $0x0
+     111:	57                   	push   %edi
+     112:	e8 0c 06 00 00       	call   723 <open>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+     122:	83 ec 08             	sub    $0x8,%esp
+     125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+     12b:	89 c3                	mov    %eax,%ebx
+     12d:	56                   	push   %esi
+     12e:	50                   	push   %eax
+     12f:	e8 07 06 00 00       	call   73b <fstat>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+     13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+     146:	66 83 f8 01          	cmp    $0x1,%ax
+     14a:	74 64                	je     1b0 <ls+0xb0>
+     14c:	66 83 f8 02          	cmp    $0x2,%ax
+     150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	53                   	push   %ebx
+     156:	e8 b0 05 00 00       	call   70b <close>
+     15b:	83 c4 10             	add    $0x10,%esp
+}
+     15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     161:	5b                   	pop    %ebx
+     162:	5e                   	pop    %esi
+     163:	5f                   	pop    %edi
+     164:	5d                   	pop    %ebp
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     185:	57                   	push   %edi
+     186:	e8 d5 fe ff ff       	call   60 <fmtname>
+     18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     191:	59                   	pop    %ecx
+     192:	5f                   	pop    %edi
+     193:	52                   	push   %edx
+     194:	56                   	push   %esi
+     195:	6a 02                	push   $0x2
+     197:	50                   	push   %eax
+     198:	68 2c 12 00 00       	push   $0x122c
+     19d:	6a 01                	push   $0x1
+     19f:	e8 bc 08 00 00       	call   a60 <printf>
+    break;
+     1a4:	83 c4 20             	add    $0x20,%esp
+     1a7:	eb a9                	jmp    152 <ls+0x52>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	57                   	push   %edi
+     1b4:	e8 d7 02 00 00       	call   490 <strlen>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	83 c0 10             	add    $0x10,%eax
+     1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	57                   	push   %edi
+     1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     1d4:	57                   	push   %edi
+     1d5:	e8 26 02 00 00       	call   400 <strcpy>
+    p = buf+strlen(buf);
+     1da:	89 3c 24             	mov    %edi,(%esp)
+     1dd:	e8 ae 02 00 00       	call   490 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     200:	83 ec 04             	sub    $0x4,%esp
+     203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     209:	6a 10                	push   $0x10
+     20b:	50                   	push   %eax
+     20c:	53                   	push   %ebx
+     20d:	e8 e9 04 00 00       	call   6fb <read>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 f8 10             	cmp    $0x10,%eax
+     218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+     21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     225:	00 
+     226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     231:	6a 0e                	push   $0xe
+     233:	50                   	push   %eax
+     234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     23a:	e8 71 04 00 00       	call   6b0 <memmove>
+      p[DIRSIZ] = 0;
+     23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     249:	58                   	pop    %eax
+     24a:	5a                   	pop    %edx
+     24b:	56                   	push   %esi
+     24c:	57                   	push   %edi
+     24d:	e8 ce 03 00 00       	call   620 <stat>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     285:	57                   	push   %edi
+     286:	e8 d5 fd ff ff       	call   60 <fmtname>
+     28b:	5a                   	pop    %edx
+     28c:	59                   	pop    %ecx
+     28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     293:	51                   	push   %ecx
+     294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     29a:	52                   	push   %edx
+     29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     2a1:	50                   	push   %eax
+     2a2:	68 2c 12 00 00       	push   $0x122c
+     2a7:	6a 01                	push   $0x1
+     2a9:	e8 b2 07 00 00       	call   a60 <printf>
+     2ae:	83 c4 20             	add    $0x20,%esp
+     2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	57                   	push   %edi
+     2c4:	68 04 12 00 00       	push   $0x1204
+     2c9:	6a 02                	push   $0x2
+     2cb:	e8 90 07 00 00       	call   a60 <printf>
+    return;
+     2d0:	83 c4 10             	add    $0x10,%esp
+}
+     2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d6:	5b                   	pop    %ebx
+     2d7:	5e                   	pop    %esi
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 39 12 00 00       	push   $0x1239
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 71 07 00 00       	call   a60 <printf>
+      break;
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	57                   	push   %edi
+     304:	68 18 12 00 00       	push   $0x1218
+     309:	6a 02                	push   $0x2
+     30b:	e8 50 07 00 00       	call   a60 <printf>
+    close(fd);
+     310:	89 1c 24             	mov    %ebx,(%esp)
+     313:	e8 f3 03 00 00       	call   70b <close>
+    return;
+     318:	83 c4 10             	add    $0x10,%esp
+}
+     31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5f                   	pop    %edi
+     321:	5d                   	pop    %ebp
+     322:	c3                   	ret
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	57                   	push   %edi
+     32c:	68 18 12 00 00       	push   $0x1218
+     331:	6a 01                	push   $0x1
+     333:	e8 28 07 00 00       	call   a60 <printf>
+        continue;
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     340:	a1 80 17 00 00       	mov    0x1780,%eax
+     345:	85 c0                	test   %eax,%eax
+     347:	74 17                	je     360 <fork+0x20>
+{
+     349:	55                   	push   %ebp
+     34a:	89 e5                	mov    %esp,%ebp
+     34c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     34f:	ff d0                	call   *%eax
+  return _fork();
+}
+     351:	c9                   	leave
+  return _fork();
+     352:	e9 84 03 00 00       	jmp    6db <_fork>
+     357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35e:	66 90                	xchg   %ax,%ax
+     360:	e9 76 03 00 00       	jmp    6db <_fork>
+     365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <exit>:
+
+int
+exit(void)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     376:	a1 80 17 00 00       	mov    0x1780,%eax
+     37b:	85 c0                	test   %eax,%eax
+     37d:	74 02                	je     381 <exit+0x11>
+    stdioflush();
+     37f:	ff d0                	call   *%eax
+  _exit();
+     381:	e8 5d 03 00 00       	call   6e3 <_exit>
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     390:	55                   	push   %ebp
+  if(stdioflush)
+     391:	a1 80 17 00 00       	mov    0x1780,%eax
+{
+     396:	89 e5                	mov    %esp,%ebp
+     398:	56                   	push   %esi
+     399:	53                   	push   %ebx
+     39a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     39d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     3a0:	85 c0                	test   %eax,%eax
+     3a2:	74 02                	je     3a6 <exec+0x16>
+    stdioflush();
+     3a4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     3a6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     3a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     3ac:	5b                   	pop    %ebx
+     3ad:	5e                   	pop    %esi
+     3ae:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     3af:	e9 67 03 00 00       	jmp    71b <_exec>
+     3b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+
+000003c0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	57                   	push   %edi
+     3c4:	56                   	push   %esi
+     3c5:	53                   	push   %ebx
+     3c6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     3c9:	a1 80 17 00 00       	mov    0x1780,%eax
+{
+     3ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     3d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     3d7:	85 c0                	test   %eax,%eax
+     3d9:	74 02                	je     3dd <spawn+0x1d>
+    stdioflush();
+     3db:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     3dd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     3e0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     3e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     3e6:	83 c4 0c             	add    $0xc,%esp
+     3e9:	5b                   	pop    %ebx
+     3ea:	5e                   	pop    %esi
+     3eb:	5f                   	pop    %edi
+     3ec:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     3ed:	e9 79 04 00 00       	jmp    86b <_spawn>
+     3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     400:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     401:	31 c0                	xor    %eax,%eax
+{
+     403:	89 e5                	mov    %esp,%ebp
+     405:	53                   	push   %ebx
+     406:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     410:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     414:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     417:	83 c0 01             	add    $0x1,%eax
+     41a:	84 d2                	test   %dl,%dl
+     41c:	75 f2                	jne    410 <strcpy+0x10>
+    ;
+  return os;
+}
+     41e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     421:	89 c8                	mov    %ecx,%eax
+     423:	c9                   	leave
+     424:	c3                   	ret
+     425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	8b 55 08             	mov    0x8(%ebp),%edx
+     437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     43a:	0f b6 02             	movzbl (%edx),%eax
+     43d:	84 c0                	test   %al,%al
+     43f:	75 17                	jne    458 <strcmp+0x28>
+     441:	eb 3a                	jmp    47d <strcmp+0x4d>
+     443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     447:	90                   	nop
+     448:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     44c:	83 c2 01             	add    $0x1,%edx
+     44f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     452:	84 c0                	test   %al,%al
+     454:	74 1a                	je     470 <strcmp+0x40>
+    p++, q++;
+     456:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     458:	0f b6 19             	movzbl (%ecx),%ebx
+     45b:	38 c3                	cmp    %al,%bl
+     45d:	74 e9                	je     448 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     45f:	29 d8                	sub    %ebx,%eax
+}
+     461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     464:	c9                   	leave
+     465:	c3                   	ret
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     470:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     474:	31 c0                	xor    %eax,%eax
+     476:	29 d8                	sub    %ebx,%eax
+}
+     478:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     47b:	c9                   	leave
+     47c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     47d:	0f b6 19             	movzbl (%ecx),%ebx
+     480:	31 c0                	xor    %eax,%eax
+     482:	eb db                	jmp    45f <strcmp+0x2f>
+     484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     48f:	90                   	nop
+
+00000490 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     496:	80 3a 00             	cmpb   $0x0,(%edx)
+     499:	74 15                	je     4b0 <strlen+0x20>
+     49b:	31 c0                	xor    %eax,%eax
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+     4a0:	83 c0 01             	add    $0x1,%eax
+     4a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     4a7:	89 c1                	mov    %eax,%ecx
+     4a9:	75 f5                	jne    4a0 <strlen+0x10>
+    ;
+  return n;
+}
+     4ab:	89 c8                	mov    %ecx,%eax
+     4ad:	5d                   	pop    %ebp
+     4ae:	c3                   	ret
+     4af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     4b0:	31 c9                	xor    %ecx,%ecx
+}
+     4b2:	5d                   	pop    %ebp
+     4b3:	89 c8                	mov    %ecx,%eax
+     4b5:	c3                   	ret
+     4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     4c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4cd:	89 d7                	mov    %edx,%edi
+     4cf:	fc                   	cld
+     4d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     4d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     4d5:	89 d0                	mov    %edx,%eax
+     4d7:	c9                   	leave
+     4d8:	c3                   	ret
+     4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4ea:	0f b6 10             	movzbl (%eax),%edx
+     4ed:	84 d2                	test   %dl,%dl
+     4ef:	75 12                	jne    503 <strchr+0x23>
+     4f1:	eb 1d                	jmp    510 <strchr+0x30>
+     4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4f7:	90                   	nop
+     4f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     4fc:	83 c0 01             	add    $0x1,%eax
+     4ff:	84 d2                	test   %dl,%dl
+     501:	74 0d                	je     510 <strchr+0x30>
+    if(*s == c)
+     503:	38 d1                	cmp    %dl,%cl
+     505:	75 f1                	jne    4f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     507:	5d                   	pop    %ebp
+     508:	c3                   	ret
+     509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     510:	31 c0                	xor    %eax,%eax
+}
+     512:	5d                   	pop    %ebp
+     513:	c3                   	ret
+     514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+
+00000520 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	56                   	push   %esi
+     525:	53                   	push   %ebx
+     526:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     529:	a1 80 17 00 00       	mov    0x1780,%eax
+{
+     52e:	8b 75 08             	mov    0x8(%ebp),%esi
+     531:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     534:	85 c0                	test   %eax,%eax
+     536:	74 02                	je     53a <gets+0x1a>
+    stdioflush();
+     538:	ff d0                	call   *%eax
+  if(in.size == 0)
+     53a:	a1 a8 19 00 00       	mov    0x19a8,%eax
+     53f:	85 c0                	test   %eax,%eax
+     541:	0f 84 99 00 00 00    	je     5e0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     547:	31 db                	xor    %ebx,%ebx
+     549:	eb 21                	jmp    56c <gets+0x4c>
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     550:	8d 50 01             	lea    0x1(%eax),%edx
+     553:	0f b6 80 a0 17 00 00 	movzbl 0x17a0(%eax),%eax
+     55a:	89 15 a0 19 00 00    	mov    %edx,0x19a0
+    buf[i++] = c;
+     560:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     564:	3c 0a                	cmp    $0xa,%al
+     566:	74 60                	je     5c8 <gets+0xa8>
+     568:	3c 0d                	cmp    $0xd,%al
+     56a:	74 5c                	je     5c8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     56c:	89 da                	mov    %ebx,%edx
+     56e:	83 c3 01             	add    $0x1,%ebx
+     571:	39 fb                	cmp    %edi,%ebx
+     573:	7d 55                	jge    5ca <gets+0xaa>
+    if(in.r == in.n){
+     575:	a1 a0 19 00 00       	mov    0x19a0,%eax
+     57a:	3b 05 a4 19 00 00    	cmp    0x19a4,%eax
+     580:	75 ce                	jne    550 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     582:	83 ec 04             	sub    $0x4,%esp
+     585:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     588:	c7 05 a4 19 00 00 00 	movl   $0x0,0x19a4
+     58f:	00 00 00 
+     592:	c7 05 a0 19 00 00 00 	movl   $0x0,0x19a0
+     599:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     59c:	ff 35 a8 19 00 00    	push   0x19a8
+     5a2:	68 a0 17 00 00       	push   $0x17a0
+     5a7:	6a 00                	push   $0x0
+     5a9:	e8 4d 01 00 00       	call   6fb <read>
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	a3 a4 19 00 00       	mov    %eax,0x19a4
+     5bb:	7e 56                	jle    613 <gets+0xf3>
+    c = in.buf[in.r++];
+     5bd:	a1 a0 19 00 00       	mov    0x19a0,%eax
+     5c2:	eb 8c                	jmp    550 <gets+0x30>
+     5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     5c8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     5ca:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     5ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5d1:	89 f0                	mov    %esi,%eax
+     5d3:	5b                   	pop    %ebx
+     5d4:	5e                   	pop    %esi
+     5d5:	5f                   	pop    %edi
+     5d6:	5d                   	pop    %ebp
+     5d7:	c3                   	ret
+     5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     5e0:	83 ec 08             	sub    $0x8,%esp
+     5e3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5e6:	50                   	push   %eax
+     5e7:	6a 00                	push   $0x0
+     5e9:	e8 4d 01 00 00       	call   73b <fstat>
+     5ee:	83 c4 10             	add    $0x10,%esp
+     5f1:	89 c2                	mov    %eax,%edx
+     5f3:	b8 01 00 00 00       	mov    $0x1,%eax
+     5f8:	85 d2                	test   %edx,%edx
+     5fa:	75 0d                	jne    609 <gets+0xe9>
+     5fc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     601:	ba 00 02 00 00       	mov    $0x200,%edx
+     606:	0f 44 c2             	cmove  %edx,%eax
+     609:	a3 a8 19 00 00       	mov    %eax,0x19a8
+     60e:	e9 34 ff ff ff       	jmp    547 <gets+0x27>
+        in.n = 0;
+     613:	c7 05 a4 19 00 00 00 	movl   $0x0,0x19a4
+     61a:	00 00 00 
+        break;
+     61d:	eb ab                	jmp    5ca <gets+0xaa>
+     61f:	90                   	nop
+
+00000620 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	56                   	push   %esi
+     624:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     625:	83 ec 08             	sub    $0x8,%esp
+     628:	6a 00                	push   $0x0
+     62a:	ff 75 08             	push   0x8(%ebp)
+     62d:	e8 f1 00 00 00       	call   723 <open>
+  if(fd < 0)
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	78 27                	js     660 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     639:	83 ec 08             	sub    $0x8,%esp
+     63c:	ff 75 0c             	push   0xc(%ebp)
+     63f:	89 c3                	mov    %eax,%ebx
+     641:	50                   	push   %eax
+     642:	e8 f4 00 00 00       	call   73b <fstat>
+  close(fd);
+     647:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     64a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     64c:	e8 ba 00 00 00       	call   70b <close>
+  return r;
+     651:	83 c4 10             	add    $0x10,%esp
+}
+     654:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     657:	89 f0                	mov    %esi,%eax
+     659:	5b                   	pop    %ebx
+     65a:	5e                   	pop    %esi
+     65b:	5d                   	pop    %ebp
+     65c:	c3                   	ret
+     65d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     660:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     665:	eb ed                	jmp    654 <stat+0x34>
+     667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66e:	66 90                	xchg   %ax,%ax
+
+00000670 <atoi>:
+
+int
+atoi(const char *s)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	53                   	push   %ebx
+     674:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     677:	0f be 02             	movsbl (%edx),%eax
+     67a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     67d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     685:	77 1e                	ja     6a5 <atoi+0x35>
+     687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     690:	83 c2 01             	add    $0x1,%edx
+     693:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     696:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     69a:	0f be 02             	movsbl (%edx),%eax
+     69d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     6a0:	80 fb 09             	cmp    $0x9,%bl
+     6a3:	76 eb                	jbe    690 <atoi+0x20>
+  return n;
+}
+     6a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6a8:	89 c8                	mov    %ecx,%eax
+     6aa:	c9                   	leave
+     6ab:	c3                   	ret
+     6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	56                   	push   %esi
+     6b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     6be:	85 c0                	test   %eax,%eax
+     6c0:	7e 13                	jle    6d5 <memmove+0x25>
+     6c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     6c4:	89 d7                	mov    %edx,%edi
+     6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     6d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     6d1:	39 f8                	cmp    %edi,%eax
+     6d3:	75 fb                	jne    6d0 <memmove+0x20>
+  return vdst;
+}
+     6d5:	5e                   	pop    %esi
+     6d6:	89 d0                	mov    %edx,%eax
+     6d8:	5f                   	pop    %edi
+     6d9:	5d                   	pop    %ebp
+     6da:	c3                   	ret
+
+000006db <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     6db:	b8 01 00 00 00       	mov    $0x1,%eax
+     6e0:	cd 40                	int    $0x40
+     6e2:	c3                   	ret
+
+000006e3 <_exit>:
+RAWSYSCALL(exit)
+     6e3:	b8 02 00 00 00       	mov    $0x2,%eax
+     6e8:	cd 40                	int    $0x40
+     6ea:	c3                   	ret
+
+000006eb <wait>:
+SYSCALL(wait)
+     6eb:	b8 03 00 00 00       	mov    $0x3,%eax
+     6f0:	cd 40                	int    $0x40
+     6f2:	c3                   	ret
+
+000006f3 <pipe>:
+SYSCALL(pipe)
+     6f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     6f8:	cd 40                	int    $0x40
+     6fa:	c3                   	ret
+
+000006fb <read>:
+SYSCALL(read)
+     6fb:	b8 05 00 00 00       	mov    $0x5,%eax
+     700:	cd 40                	int    $0x40
+     702:	c3                   	ret
+
+00000703 <write>:
+SYSCALL(write)
+     703:	b8 10 00 00 00       	mov    $0x10,%eax
+     708:	cd 40                	int    $0x40
+     70a:	c3                   	ret
+
+0000070b <close>:
+SYSCALL(close)
+     70b:	b8 15 00 00 00       	mov    $0x15,%eax
+     710:	cd 40                	int    $0x40
+     712:	c3                   	ret
+
+00000713 <kill>:
+SYSCALL(kill)
+     713:	b8 06 00 00 00       	mov    $0x6,%eax
+     718:	cd 40                	int    $0x40
+     71a:	c3                   	ret
+
+0000071b <_exec>:
+RAWSYSCALL(exec)
+     71b:	b8 07 00 00 00       	mov    $0x7,%eax
+     720:	cd 40                	int    $0x40
+     722:	c3                   	ret
+
+00000723 <open>:
+SYSCALL(open)
+     723:	b8 0f 00 00 00       	mov    $0xf,%eax
+     728:	cd 40                	int    $0x40
+     72a:	c3                   	ret
+
+0000072b <mknod>:
+SYSCALL(mknod)
+     72b:	b8 11 00 00 00       	mov    $0x11,%eax
+     730:	cd 40                	int    $0x40
+     732:	c3                   	ret
+
+00000733 <unlink>:
+SYSCALL(unlink)
+     733:	b8 12 00 00 00       	mov    $0x12,%eax
+     738:	cd 40                	int    $0x40
+     73a:	c3                   	ret
+
+0000073b <fstat>:
+SYSCALL(fstat)
+     73b:	b8 08 00 00 00       	mov    $0x8,%eax
+     740:	cd 40                	int    $0x40
+     742:	c3                   	ret
+
+00000743 <link>:
+SYSCALL(link)
+     743:	b8 13 00 00 00       	mov    $0x13,%eax
+     748:	cd 40                	int    $0x40
+     74a:	c3                   	ret
+
+0000074b <mkdir>:
+SYSCALL(mkdir)
+     74b:	b8 14 00 00 00       	mov    $0x14,%eax
+     750:	cd 40                	int    $0x40
+     752:	c3                   	ret
+
+00000753 <chdir>:
+SYSCALL(chdir)
+     753:	b8 09 00 00 00       	mov    $0x9,%eax
+     758:	cd 40                	int    $0x40
+     75a:	c3                   	ret
+
+0000075b <dup>:
+SYSCALL(dup)
+     75b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     760:	cd 40                	int    $0x40
+     762:	c3                   	ret
+
+00000763 <getpid>:
+SYSCALL(getpid)
+     763:	b8 0b 00 00 00       	mov    $0xb,%eax
+     768:	cd 40                	int    $0x40
+     76a:	c3                   	ret
+
+0000076b <sbrk>:
+SYSCALL(sbrk)
+     76b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     770:	cd 40                	int    $0x40
+     772:	c3                   	ret
+
+00000773 <sleep>:
+SYSCALL(sleep)
+     773:	b8 0d 00 00 00       	mov    $0xd,%eax
+     778:	cd 40                	int    $0x40
+     77a:	c3                   	ret
+
+0000077b <uptime>:
+SYSCALL(uptime)
+     77b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     780:	cd 40                	int    $0x40
+     782:	c3                   	ret
+
+00000783 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     783:	b8 16 00 00 00       	mov    $0x16,%eax
+     788:	cd 40                	int    $0x40
+     78a:	c3                   	ret
+
+0000078b <get_parent_id>:
+SYSCALL(get_parent_id)
+     78b:	b8 17 00 00 00       	mov    $0x17,%eax
+     790:	cd 40                	int    $0x40
+     792:	c3                   	ret
+
+00000793 <get_children>:
+SYSCALL(get_children)
+     793:	b8 18 00 00 00       	mov    $0x18,%eax
+     798:	cd 40                	int    $0x40
+     79a:	c3                   	ret
+
+0000079b <set_path>:
+SYSCALL(set_path)
+     79b:	b8 19 00 00 00       	mov    $0x19,%eax
+     7a0:	cd 40                	int    $0x40
+     7a2:	c3                   	ret
+
+000007a3 <set_sleep>:
+SYSCALL(set_sleep)
+     7a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     7a8:	cd 40                	int    $0x40
+     7aa:	c3                   	ret
+
+000007ab <get_time>:
+SYSCALL(get_time)
+     7ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     7b0:	cd 40                	int    $0x40
+     7b2:	c3                   	ret
+
+000007b3 <change_process_level>:
+SYSCALL(change_process_level)
+     7b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     7b8:	cd 40                	int    $0x40
+     7ba:	c3                   	ret
+
+000007bb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     7bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     7c0:	cd 40                	int    $0x40
+     7c2:	c3                   	ret
+
+000007c3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     7c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     7c8:	cd 40                	int    $0x40
+     7ca:	c3                   	ret
+
+000007cb <print_processes_info>:
+SYSCALL(print_processes_info)
+     7cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     7d0:	cd 40                	int    $0x40
+     7d2:	c3                   	ret
+
+000007d3 <barrier_init>:
+
+SYSCALL(barrier_init)
+     7d3:	b8 20 00 00 00       	mov    $0x20,%eax
+     7d8:	cd 40                	int    $0x40
+     7da:	c3                   	ret
+
+000007db <barrier_wait>:
+SYSCALL(barrier_wait)
+     7db:	b8 21 00 00 00       	mov    $0x21,%eax
+     7e0:	cd 40                	int    $0x40
+     7e2:	c3                   	ret
+
+000007e3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     7e3:	b8 22 00 00 00       	mov    $0x22,%eax
+     7e8:	cd 40                	int    $0x40
+     7ea:	c3                   	ret
+
+000007eb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     7eb:	b8 23 00 00 00       	mov    $0x23,%eax
+     7f0:	cd 40                	int    $0x40
+     7f2:	c3                   	ret
+
+000007f3 <set_process_gang>:
+SYSCALL(set_process_gang)
+     7f3:	b8 24 00 00 00       	mov    $0x24,%eax
+     7f8:	cd 40                	int    $0x40
+     7fa:	c3                   	ret
+
+000007fb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     7fb:	b8 25 00 00 00       	mov    $0x25,%eax
+     800:	cd 40                	int    $0x40
+     802:	c3                   	ret
+
+00000803 <sem_create>:
+SYSCALL(sem_create)
+     803:	b8 26 00 00 00       	mov    $0x26,%eax
+     808:	cd 40                	int    $0x40
+     80a:	c3                   	ret
+
+0000080b <event_create>:
+SYSCALL(event_create)
+     80b:	b8 27 00 00 00       	mov    $0x27,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <sync_post>:
+SYSCALL(sync_post)
+     813:	b8 28 00 00 00       	mov    $0x28,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <sync_wait>:
+SYSCALL(sync_wait)
+     81b:	b8 29 00 00 00       	mov    $0x29,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <sync_close>:
+SYSCALL(sync_close)
+     823:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <event_reset>:
+SYSCALL(event_reset)
+     82b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     833:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <mmap>:
+SYSCALL(mmap)
+     83b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <munmap>:
+SYSCALL(munmap)
+     843:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <shmget>:
+SYSCALL(shmget)
+     84b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <shmat>:
+SYSCALL(shmat)
+     853:	b8 30 00 00 00       	mov    $0x30,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <shmdt>:
+SYSCALL(shmdt)
+     85b:	b8 31 00 00 00       	mov    $0x31,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <shmrm>:
+SYSCALL(shmrm)
+     863:	b8 32 00 00 00       	mov    $0x32,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <_spawn>:
+RAWSYSCALL(spawn)
+     86b:	b8 33 00 00 00       	mov    $0x33,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <memstat>:
+SYSCALL(memstat)
+     873:	b8 34 00 00 00       	mov    $0x34,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+     87b:	66 90                	xchg   %ax,%ax
+     87d:	66 90                	xchg   %ax,%ax
+     87f:	90                   	nop
+
+00000880 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     886:	a1 e8 1b 00 00       	mov    0x1be8,%eax
+     88b:	85 c0                	test   %eax,%eax
+     88d:	7e 17                	jle    8a6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     88f:	83 ec 04             	sub    $0x4,%esp
+     892:	50                   	push   %eax
+     893:	68 ec 1b 00 00       	push   $0x1bec
+     898:	ff 35 e0 1b 00 00    	push   0x1be0
+     89e:	e8 60 fe ff ff       	call   703 <write>
+     8a3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     8a6:	c7 05 e8 1b 00 00 00 	movl   $0x0,0x1be8
+     8ad:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     8b0:	c7 05 e4 1b 00 00 00 	movl   $0x0,0x1be4
+     8b7:	00 00 00 
+}
+     8ba:	c9                   	leave
+     8bb:	c3                   	ret
+     8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     8c6:	89 d1                	mov    %edx,%ecx
+{
+     8c8:	56                   	push   %esi
+     8c9:	53                   	push   %ebx
+     8ca:	89 c3                	mov    %eax,%ebx
+     8cc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     8cf:	85 d2                	test   %edx,%edx
+     8d1:	0f 89 b9 00 00 00    	jns    990 <printint+0xd0>
+     8d7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     8db:	0f 84 af 00 00 00    	je     990 <printint+0xd0>
+    x = -xx;
+     8e1:	f7 d9                	neg    %ecx
+    neg = 1;
+     8e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     8e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8eb:	31 f6                	xor    %esi,%esi
+     8ed:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     8f0:	89 c8                	mov    %ecx,%eax
+     8f2:	31 d2                	xor    %edx,%edx
+     8f4:	89 f3                	mov    %esi,%ebx
+     8f6:	f7 f7                	div    %edi
+     8f8:	8d 76 01             	lea    0x1(%esi),%esi
+     8fb:	0f b6 92 b0 12 00 00 	movzbl 0x12b0(%edx),%edx
+     902:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     906:	89 ca                	mov    %ecx,%edx
+     908:	89 c1                	mov    %eax,%ecx
+     90a:	39 fa                	cmp    %edi,%edx
+     90c:	73 e2                	jae    8f0 <printint+0x30>
+  if(neg)
+     90e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     911:	89 d9                	mov    %ebx,%ecx
+     913:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     916:	85 c0                	test   %eax,%eax
+     918:	74 07                	je     921 <printint+0x61>
+    buf[i++] = '-';
+     91a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     91f:	89 f1                	mov    %esi,%ecx
+     921:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     924:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     926:	8d 43 0c             	lea    0xc(%ebx),%eax
+     929:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     92c:	01 f7                	add    %esi,%edi
+     92e:	eb 09                	jmp    939 <printint+0x79>
+
+  while(--i >= 0)
+     930:	8d 47 ff             	lea    -0x1(%edi),%eax
+     933:	39 f7                	cmp    %esi,%edi
+     935:	74 36                	je     96d <printint+0xad>
+     937:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     939:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     93c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     93f:	8d 42 01             	lea    0x1(%edx),%eax
+     942:	89 43 08             	mov    %eax,0x8(%ebx)
+     945:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     949:	3d 00 02 00 00       	cmp    $0x200,%eax
+     94e:	74 28                	je     978 <printint+0xb8>
+     950:	80 f9 0a             	cmp    $0xa,%cl
+     953:	75 db                	jne    930 <printint+0x70>
+     955:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     959:	75 d5                	jne    930 <printint+0x70>
+  if(b->n > 0)
+     95b:	85 c0                	test   %eax,%eax
+     95d:	7f 19                	jg     978 <printint+0xb8>
+  b->n = 0;
+     95f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     966:	8d 47 ff             	lea    -0x1(%edi),%eax
+     969:	39 f7                	cmp    %esi,%edi
+     96b:	75 ca                	jne    937 <printint+0x77>
+}
+     96d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     970:	5b                   	pop    %ebx
+     971:	5e                   	pop    %esi
+     972:	5f                   	pop    %edi
+     973:	5d                   	pop    %ebp
+     974:	c3                   	ret
+     975:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     978:	83 ec 04             	sub    $0x4,%esp
+     97b:	50                   	push   %eax
+     97c:	ff 75 d4             	push   -0x2c(%ebp)
+     97f:	ff 33                	push   (%ebx)
+     981:	e8 7d fd ff ff       	call   703 <write>
+     986:	83 c4 10             	add    $0x10,%esp
+     989:	eb d4                	jmp    95f <printint+0x9f>
+     98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+  neg = 0;
+     990:	31 c0                	xor    %eax,%eax
+     992:	e9 51 ff ff ff       	jmp    8e8 <printint+0x28>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <putc>:
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	53                   	push   %ebx
+     9a4:	89 c3                	mov    %eax,%ebx
+     9a6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     9a9:	8b 48 08             	mov    0x8(%eax),%ecx
+     9ac:	8d 41 01             	lea    0x1(%ecx),%eax
+     9af:	89 43 08             	mov    %eax,0x8(%ebx)
+     9b2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     9b6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9bb:	74 33                	je     9f0 <putc+0x50>
+     9bd:	80 fa 0a             	cmp    $0xa,%dl
+     9c0:	74 0e                	je     9d0 <putc+0x30>
+}
+     9c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9c5:	c9                   	leave
+     9c6:	c3                   	ret
+     9c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ce:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     9d0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     9d4:	75 ec                	jne    9c2 <putc+0x22>
+  if(b->n > 0)
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	7f 16                	jg     9f0 <putc+0x50>
+  b->n = 0;
+     9da:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     9e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e4:	c9                   	leave
+     9e5:	c3                   	ret
+     9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     9f0:	83 ec 04             	sub    $0x4,%esp
+     9f3:	50                   	push   %eax
+     9f4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     9f7:	50                   	push   %eax
+     9f8:	ff 33                	push   (%ebx)
+     9fa:	e8 04 fd ff ff       	call   703 <write>
+     9ff:	83 c4 10             	add    $0x10,%esp
+     a02:	eb d6                	jmp    9da <putc+0x3a>
+     a04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a0f:	90                   	nop
+
+00000a10 <fflush>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     a16:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     a1a:	74 04                	je     a20 <fflush+0x10>
+}
+     a1c:	c9                   	leave
+     a1d:	c3                   	ret
+     a1e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a20:	a1 e8 1b 00 00       	mov    0x1be8,%eax
+     a25:	85 c0                	test   %eax,%eax
+     a27:	7f 17                	jg     a40 <fflush+0x30>
+  b->n = 0;
+     a29:	c7 05 e8 1b 00 00 00 	movl   $0x0,0x1be8
+     a30:	00 00 00 
+  out.mode = 0;
+     a33:	c7 05 e4 1b 00 00 00 	movl   $0x0,0x1be4
+     a3a:	00 00 00 
+}
+     a3d:	c9                   	leave
+     a3e:	c3                   	ret
+     a3f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     a40:	83 ec 04             	sub    $0x4,%esp
+     a43:	50                   	push   %eax
+     a44:	68 ec 1b 00 00       	push   $0x1bec
+     a49:	ff 35 e0 1b 00 00    	push   0x1be0
+     a4f:	e8 af fc ff ff       	call   703 <write>
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	eb d0                	jmp    a29 <fflush+0x19>
+     a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	57                   	push   %edi
+     a64:	56                   	push   %esi
+     a65:	53                   	push   %ebx
+     a66:	83 ec 3c             	sub    $0x3c,%esp
+     a69:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     a6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     a6f:	83 fe 01             	cmp    $0x1,%esi
+     a72:	0f 84 60 01 00 00    	je     bd8 <printf+0x178>
+    b->fd = fd;
+     a78:	89 35 c0 19 00 00    	mov    %esi,0x19c0
+  for(i = 0; fmt[i]; i++){
+     a7e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     a81:	bf c0 19 00 00       	mov    $0x19c0,%edi
+  for(i = 0; fmt[i]; i++){
+     a86:	84 c0                	test   %al,%al
+     a88:	74 65                	je     aef <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     a8a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a8d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     a90:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     a92:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     a95:	eb 1f                	jmp    ab6 <printf+0x56>
+     a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     aa0:	83 f8 25             	cmp    $0x25,%eax
+     aa3:	74 3b                	je     ae0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     aa5:	89 f8                	mov    %edi,%eax
+     aa7:	e8 f4 fe ff ff       	call   9a0 <putc>
+  for(i = 0; fmt[i]; i++){
+     aac:	0f b6 03             	movzbl (%ebx),%eax
+     aaf:	83 c3 01             	add    $0x1,%ebx
+     ab2:	84 c0                	test   %al,%al
+     ab4:	74 39                	je     aef <printf+0x8f>
+    c = fmt[i] & 0xff;
+     ab6:	0f be d0             	movsbl %al,%edx
+     ab9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     abc:	85 f6                	test   %esi,%esi
+     abe:	74 e0                	je     aa0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     ac0:	83 fe 25             	cmp    $0x25,%esi
+     ac3:	75 e7                	jne    aac <printf+0x4c>
+      if(c == 'd'){
+     ac5:	83 f8 25             	cmp    $0x25,%eax
+     ac8:	74 57                	je     b21 <printf+0xc1>
+     aca:	83 e8 63             	sub    $0x63,%eax
+     acd:	83 f8 15             	cmp    $0x15,%eax
+     ad0:	77 36                	ja     b08 <printf+0xa8>
+     ad2:	ff 24 85 58 12 00 00 	jmp    *0x1258(,%eax,4)
+     ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     ae0:	0f b6 03             	movzbl (%ebx),%eax
+     ae3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     ae6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     aeb:	84 c0                	test   %al,%al
+     aed:	75 c7                	jne    ab6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     aef:	8b 47 04             	mov    0x4(%edi),%eax
+     af2:	85 c0                	test   %eax,%eax
+     af4:	0f 84 06 01 00 00    	je     c00 <printf+0x1a0>
+    bflush(b);
+}
+     afa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     afd:	5b                   	pop    %ebx
+     afe:	5e                   	pop    %esi
+     aff:	5f                   	pop    %edi
+     b00:	5d                   	pop    %ebp
+     b01:	c3                   	ret
+     b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     b08:	8b 4f 08             	mov    0x8(%edi),%ecx
+     b0b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b0e:	89 47 08             	mov    %eax,0x8(%edi)
+     b11:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     b16:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b1b:	0f 84 77 01 00 00    	je     c98 <printf+0x238>
+        putc(b, c);
+     b21:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b23:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b25:	e8 76 fe ff ff       	call   9a0 <putc>
+     b2a:	eb 80                	jmp    aac <printf+0x4c>
+     b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     b30:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b33:	83 ec 0c             	sub    $0xc,%esp
+     b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b3b:	8b 16                	mov    (%esi),%edx
+     b3d:	6a 00                	push   $0x0
+        ap++;
+     b3f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     b42:	89 f8                	mov    %edi,%eax
+     b44:	e8 77 fd ff ff       	call   8c0 <printint>
+        ap++;
+     b49:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     b4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b4f:	31 f6                	xor    %esi,%esi
+     b51:	e9 56 ff ff ff       	jmp    aac <printf+0x4c>
+     b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b60:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     b63:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     b65:	83 c0 04             	add    $0x4,%eax
+     b68:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     b6b:	85 c9                	test   %ecx,%ecx
+     b6d:	0f 84 cd 00 00 00    	je     c40 <printf+0x1e0>
+        while(*s != 0){
+     b73:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     b76:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     b78:	84 d2                	test   %dl,%dl
+     b7a:	0f 84 2c ff ff ff    	je     aac <printf+0x4c>
+          putc(b, *s);
+     b80:	89 f8                	mov    %edi,%eax
+     b82:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     b85:	e8 16 fe ff ff       	call   9a0 <putc>
+          s++;
+     b8a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     b8d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     b91:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     b94:	84 d2                	test   %dl,%dl
+     b96:	75 e8                	jne    b80 <printf+0x120>
+      state = 0;
+     b98:	31 f6                	xor    %esi,%esi
+     b9a:	e9 0d ff ff ff       	jmp    aac <printf+0x4c>
+     b9f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     ba0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     ba3:	83 ec 0c             	sub    $0xc,%esp
+     ba6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     bab:	8b 16                	mov    (%esi),%edx
+     bad:	6a 01                	push   $0x1
+     baf:	eb 8e                	jmp    b3f <printf+0xdf>
+     bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     bb8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     bbb:	89 f8                	mov    %edi,%eax
+     bbd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     bc0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     bc3:	e8 d8 fd ff ff       	call   9a0 <putc>
+        ap++;
+     bc8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     bcb:	31 f6                	xor    %esi,%esi
+     bcd:	e9 da fe ff ff       	jmp    aac <printf+0x4c>
+     bd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     bd8:	8b 15 e4 1b 00 00    	mov    0x1be4,%edx
+     bde:	85 d2                	test   %edx,%edx
+     be0:	74 6e                	je     c50 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     be2:	0f b6 03             	movzbl (%ebx),%eax
+     be5:	bf e0 1b 00 00       	mov    $0x1be0,%edi
+     bea:	84 c0                	test   %al,%al
+     bec:	0f 85 98 fe ff ff    	jne    a8a <printf+0x2a>
+     bf2:	e9 03 ff ff ff       	jmp    afa <printf+0x9a>
+     bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfe:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     c00:	8b 47 08             	mov    0x8(%edi),%eax
+     c03:	85 c0                	test   %eax,%eax
+     c05:	7f 19                	jg     c20 <printf+0x1c0>
+  b->n = 0;
+     c07:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     c0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c11:	5b                   	pop    %ebx
+     c12:	5e                   	pop    %esi
+     c13:	5f                   	pop    %edi
+     c14:	5d                   	pop    %ebp
+     c15:	c3                   	ret
+     c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	50                   	push   %eax
+     c24:	8d 47 0c             	lea    0xc(%edi),%eax
+     c27:	50                   	push   %eax
+     c28:	ff 37                	push   (%edi)
+     c2a:	e8 d4 fa ff ff       	call   703 <write>
+  b->n = 0;
+     c2f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     c36:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c39:	eb d3                	jmp    c0e <printf+0x1ae>
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+     c40:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     c45:	b9 4e 12 00 00       	mov    $0x124e,%ecx
+     c4a:	e9 31 ff ff ff       	jmp    b80 <printf+0x120>
+     c4f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c50:	83 ec 08             	sub    $0x8,%esp
+     c53:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     c56:	c7 05 e0 1b 00 00 01 	movl   $0x1,0x1be0
+     c5d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c60:	50                   	push   %eax
+     c61:	6a 01                	push   $0x1
+     c63:	e8 d3 fa ff ff       	call   73b <fstat>
+     c68:	83 c4 10             	add    $0x10,%esp
+     c6b:	85 c0                	test   %eax,%eax
+     c6d:	75 22                	jne    c91 <printf+0x231>
+     c6f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     c74:	b8 02 00 00 00       	mov    $0x2,%eax
+     c79:	0f 45 f0             	cmovne %eax,%esi
+     c7c:	89 35 e4 1b 00 00    	mov    %esi,0x1be4
+      stdioflush = flushout;
+     c82:	c7 05 80 17 00 00 80 	movl   $0x880,0x1780
+     c89:	08 00 00 
+     c8c:	e9 51 ff ff ff       	jmp    be2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     c91:	be 02 00 00 00       	mov    $0x2,%esi
+     c96:	eb e4                	jmp    c7c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     c98:	83 ec 04             	sub    $0x4,%esp
+     c9b:	8d 47 0c             	lea    0xc(%edi),%eax
+     c9e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     ca1:	68 00 02 00 00       	push   $0x200
+     ca6:	50                   	push   %eax
+     ca7:	ff 37                	push   (%edi)
+     ca9:	e8 55 fa ff ff       	call   703 <write>
+  b->n = 0;
+     cae:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     cb5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     cb8:	83 c4 10             	add    $0x10,%esp
+     cbb:	e9 61 fe ff ff       	jmp    b21 <printf+0xc1>
+
+00000cc0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	56                   	push   %esi
+     cc4:	53                   	push   %ebx
+     cc5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     cc7:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     ccc:	39 d8                	cmp    %ebx,%eax
+     cce:	0f 83 e4 00 00 00    	jae    db8 <freepages+0xf8>
+     cd4:	85 c0                	test   %eax,%eax
+     cd6:	0f 84 dc 00 00 00    	je     db8 <freepages+0xf8>
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ce0:	89 c2                	mov    %eax,%edx
+     ce2:	8b 00                	mov    (%eax),%eax
+     ce4:	85 c0                	test   %eax,%eax
+     ce6:	74 04                	je     cec <freepages+0x2c>
+     ce8:	39 d8                	cmp    %ebx,%eax
+     cea:	72 f4                	jb     ce0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     cec:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     cef:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     cf1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     cf3:	85 c0                	test   %eax,%eax
+     cf5:	74 15                	je     d0c <freepages+0x4c>
+    p->prev = s;
+     cf7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     cfa:	8b 73 10             	mov    0x10(%ebx),%esi
+     cfd:	89 f1                	mov    %esi,%ecx
+     cff:	c1 e1 0c             	shl    $0xc,%ecx
+     d02:	01 d9                	add    %ebx,%ecx
+     d04:	39 c8                	cmp    %ecx,%eax
+     d06:	0f 84 d8 00 00 00    	je     de4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     d0c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     d0f:	89 c8                	mov    %ecx,%eax
+     d11:	c1 e0 0c             	shl    $0xc,%eax
+     d14:	01 d0                	add    %edx,%eax
+     d16:	39 c3                	cmp    %eax,%ebx
+     d18:	74 16                	je     d30 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     d1a:	8b 03                	mov    (%ebx),%eax
+     d1c:	85 c0                	test   %eax,%eax
+     d1e:	74 40                	je     d60 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d23:	5b                   	pop    %ebx
+     d24:	5e                   	pop    %esi
+     d25:	5d                   	pop    %ebp
+     d26:	c3                   	ret
+     d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     d30:	03 4b 10             	add    0x10(%ebx),%ecx
+     d33:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     d36:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     d39:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     d3b:	85 c9                	test   %ecx,%ecx
+     d3d:	0f 84 dd 00 00 00    	je     e20 <freepages+0x160>
+    s->prev->next = s->next;
+     d43:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     d45:	85 c0                	test   %eax,%eax
+     d47:	74 06                	je     d4f <freepages+0x8f>
+    s->next->prev = s->prev;
+     d49:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     d4c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     d4f:	8b 02                	mov    (%edx),%eax
+     d51:	89 d3                	mov    %edx,%ebx
+     d53:	85 c0                	test   %eax,%eax
+     d55:	75 c9                	jne    d20 <freepages+0x60>
+     d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5e:	66 90                	xchg   %ax,%ax
+     d60:	8b 43 10             	mov    0x10(%ebx),%eax
+     d63:	83 f8 0f             	cmp    $0xf,%eax
+     d66:	76 b8                	jbe    d20 <freepages+0x60>
+     d68:	83 ec 0c             	sub    $0xc,%esp
+     d6b:	c1 e0 0c             	shl    $0xc,%eax
+     d6e:	6a 00                	push   $0x0
+     d70:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d73:	e8 f3 f9 ff ff       	call   76b <sbrk>
+     d78:	83 c4 10             	add    $0x10,%esp
+     d7b:	39 c6                	cmp    %eax,%esi
+     d7d:	75 a1                	jne    d20 <freepages+0x60>
+  if(s->prev)
+     d7f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     d82:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     d84:	85 d2                	test   %edx,%edx
+     d86:	0f 84 a5 00 00 00    	je     e31 <freepages+0x171>
+    s->prev->next = s->next;
+     d8c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     d8e:	85 c0                	test   %eax,%eax
+     d90:	74 06                	je     d98 <freepages+0xd8>
+    s->next->prev = s->prev;
+     d92:	8b 53 04             	mov    0x4(%ebx),%edx
+     d95:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     d98:	8b 43 10             	mov    0x10(%ebx),%eax
+     d9b:	83 ec 0c             	sub    $0xc,%esp
+     d9e:	c1 e0 0c             	shl    $0xc,%eax
+     da1:	f7 d8                	neg    %eax
+     da3:	50                   	push   %eax
+     da4:	e8 c2 f9 ff ff       	call   76b <sbrk>
+     da9:	83 c4 10             	add    $0x10,%esp
+}
+     dac:	e9 6f ff ff ff       	jmp    d20 <freepages+0x60>
+     db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     db8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     dbf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     dc1:	89 1d 00 1e 00 00    	mov    %ebx,0x1e00
+  if(p)
+     dc7:	85 c0                	test   %eax,%eax
+     dc9:	74 95                	je     d60 <freepages+0xa0>
+    p->prev = s;
+     dcb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     dce:	8b 73 10             	mov    0x10(%ebx),%esi
+     dd1:	89 f2                	mov    %esi,%edx
+     dd3:	c1 e2 0c             	shl    $0xc,%edx
+     dd6:	01 da                	add    %ebx,%edx
+     dd8:	39 d0                	cmp    %edx,%eax
+     dda:	0f 85 3a ff ff ff    	jne    d1a <freepages+0x5a>
+     de0:	89 c1                	mov    %eax,%ecx
+     de2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     de4:	8b 41 10             	mov    0x10(%ecx),%eax
+     de7:	01 f0                	add    %esi,%eax
+     de9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     dec:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     def:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     df1:	85 f6                	test   %esi,%esi
+     df3:	74 35                	je     e2a <freepages+0x16a>
+    s->prev->next = s->next;
+     df5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     df7:	85 c0                	test   %eax,%eax
+     df9:	74 06                	je     e01 <freepages+0x141>
+    s->next->prev = s->prev;
+     dfb:	8b 49 04             	mov    0x4(%ecx),%ecx
+     dfe:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     e01:	85 d2                	test   %edx,%edx
+     e03:	0f 84 11 ff ff ff    	je     d1a <freepages+0x5a>
+     e09:	8b 4a 10             	mov    0x10(%edx),%ecx
+     e0c:	89 c8                	mov    %ecx,%eax
+     e0e:	c1 e0 0c             	shl    $0xc,%eax
+     e11:	01 d0                	add    %edx,%eax
+     e13:	39 c3                	cmp    %eax,%ebx
+     e15:	0f 85 ff fe ff ff    	jne    d1a <freepages+0x5a>
+     e1b:	e9 10 ff ff ff       	jmp    d30 <freepages+0x70>
+    *l = s->next;
+     e20:	a3 00 1e 00 00       	mov    %eax,0x1e00
+     e25:	e9 1b ff ff ff       	jmp    d45 <freepages+0x85>
+     e2a:	a3 00 1e 00 00       	mov    %eax,0x1e00
+     e2f:	eb c6                	jmp    df7 <freepages+0x137>
+     e31:	a3 00 1e 00 00       	mov    %eax,0x1e00
+     e36:	e9 53 ff ff ff       	jmp    d8e <freepages+0xce>
+     e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+
+00000e40 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	56                   	push   %esi
+     e44:	53                   	push   %ebx
+     e45:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     e47:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     e4c:	85 c0                	test   %eax,%eax
+     e4e:	74 5e                	je     eae <getpages+0x6e>
+    if(s->npages < n)
+     e50:	8b 50 10             	mov    0x10(%eax),%edx
+     e53:	39 da                	cmp    %ebx,%edx
+     e55:	72 51                	jb     ea8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     e57:	39 d3                	cmp    %edx,%ebx
+     e59:	72 25                	jb     e80 <getpages+0x40>
+  if(s->prev)
+     e5b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     e5e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     e60:	85 c9                	test   %ecx,%ecx
+     e62:	0f 84 a8 00 00 00    	je     f10 <getpages+0xd0>
+    s->prev->next = s->next;
+     e68:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     e6a:	85 d2                	test   %edx,%edx
+     e6c:	74 06                	je     e74 <getpages+0x34>
+    s->next->prev = s->prev;
+     e6e:	8b 48 04             	mov    0x4(%eax),%ecx
+     e71:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     e74:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     e77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e7a:	5b                   	pop    %ebx
+     e7b:	5e                   	pop    %esi
+     e7c:	5d                   	pop    %ebp
+     e7d:	c3                   	ret
+     e7e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     e80:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     e82:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     e84:	c1 e1 0c             	shl    $0xc,%ecx
+     e87:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     e89:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     e8c:	8b 70 04             	mov    0x4(%eax),%esi
+     e8f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     e92:	8b 10                	mov    (%eax),%edx
+     e94:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     e96:	85 f6                	test   %esi,%esi
+     e98:	74 66                	je     f00 <getpages+0xc0>
+        rest->prev->next = rest;
+     e9a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     e9c:	8b 11                	mov    (%ecx),%edx
+     e9e:	85 d2                	test   %edx,%edx
+     ea0:	75 cf                	jne    e71 <getpages+0x31>
+     ea2:	eb d0                	jmp    e74 <getpages+0x34>
+     ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     ea8:	8b 00                	mov    (%eax),%eax
+     eaa:	85 c0                	test   %eax,%eax
+     eac:	75 a2                	jne    e50 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     eae:	83 ec 0c             	sub    $0xc,%esp
+     eb1:	6a 00                	push   $0x0
+     eb3:	e8 b3 f8 ff ff       	call   76b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     eb8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     ebb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     ec1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     ec3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     ec9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     ecf:	29 d0                	sub    %edx,%eax
+     ed1:	c1 e8 0c             	shr    $0xc,%eax
+     ed4:	39 d8                	cmp    %ebx,%eax
+     ed6:	72 48                	jb     f20 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     ed8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     eda:	89 d8                	mov    %ebx,%eax
+     edc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     edf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     ee1:	c1 e0 0c             	shl    $0xc,%eax
+     ee4:	01 f0                	add    %esi,%eax
+     ee6:	50                   	push   %eax
+     ee7:	e8 7f f8 ff ff       	call   76b <sbrk>
+     eec:	83 c4 10             	add    $0x10,%esp
+     eef:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ef2:	74 2c                	je     f20 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     ef4:	01 f0                	add    %esi,%eax
+     ef6:	e9 79 ff ff ff       	jmp    e74 <getpages+0x34>
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+        runs = rest;
+     f00:	89 0d 00 1e 00 00    	mov    %ecx,0x1e00
+     f06:	eb 96                	jmp    e9e <getpages+0x5e>
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+    *l = s->next;
+     f10:	89 15 00 1e 00 00    	mov    %edx,0x1e00
+     f16:	e9 4f ff ff ff       	jmp    e6a <getpages+0x2a>
+     f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+    return 0;
+     f20:	31 c0                	xor    %eax,%eax
+     f22:	e9 50 ff ff ff       	jmp    e77 <getpages+0x37>
+     f27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 1c             	sub    $0x1c,%esp
+     f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     f3c:	85 c0                	test   %eax,%eax
+     f3e:	0f 84 97 00 00 00    	je     fdb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     f44:	89 c3                	mov    %eax,%ebx
+     f46:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     f4c:	8b 73 14             	mov    0x14(%ebx),%esi
+     f4f:	83 fe 01             	cmp    $0x1,%esi
+     f52:	74 74                	je     fc8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     f54:	85 f6                	test   %esi,%esi
+     f56:	74 5d                	je     fb5 <free+0x85>
+  if(s->free == 0)
+     f58:	8b 53 08             	mov    0x8(%ebx),%edx
+     f5b:	85 d2                	test   %edx,%edx
+     f5d:	0f 84 85 00 00 00    	je     fe8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     f63:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     f65:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     f68:	8b 43 0c             	mov    0xc(%ebx),%eax
+     f6b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     f6e:	8b 04 f5 24 1e 00 00 	mov    0x1e24(,%esi,8),%eax
+  s->inuse--;
+     f75:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     f78:	83 c0 01             	add    $0x1,%eax
+     f7b:	89 04 f5 24 1e 00 00 	mov    %eax,0x1e24(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     f82:	85 d2                	test   %edx,%edx
+     f84:	75 55                	jne    fdb <free+0xab>
+     f86:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     f8b:	89 f1                	mov    %esi,%ecx
+     f8d:	d3 ea                	shr    %cl,%edx
+     f8f:	39 c2                	cmp    %eax,%edx
+     f91:	73 7d                	jae    1010 <free+0xe0>
+  if(s->prev)
+     f93:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     f96:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     f98:	85 ff                	test   %edi,%edi
+     f9a:	0f 84 a0 00 00 00    	je     1040 <free+0x110>
+    s->prev->next = s->next;
+     fa0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     fa2:	85 c9                	test   %ecx,%ecx
+     fa4:	74 06                	je     fac <free+0x7c>
+    s->next->prev = s->prev;
+     fa6:	8b 7b 04             	mov    0x4(%ebx),%edi
+     fa9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     fac:	29 d0                	sub    %edx,%eax
+     fae:	89 04 f5 24 1e 00 00 	mov    %eax,0x1e24(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     fb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     fb8:	89 d8                	mov    %ebx,%eax
+}
+     fba:	5b                   	pop    %ebx
+     fbb:	5e                   	pop    %esi
+     fbc:	5f                   	pop    %edi
+     fbd:	5d                   	pop    %ebp
+    freepages(s);
+     fbe:	e9 fd fc ff ff       	jmp    cc0 <freepages>
+     fc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fc7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     fc8:	8b 43 10             	mov    0x10(%ebx),%eax
+     fcb:	83 ec 08             	sub    $0x8,%esp
+     fce:	c1 e0 0c             	shl    $0xc,%eax
+     fd1:	50                   	push   %eax
+     fd2:	53                   	push   %ebx
+     fd3:	e8 6b f8 ff ff       	call   843 <munmap>
+     fd8:	83 c4 10             	add    $0x10,%esp
+}
+     fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fde:	5b                   	pop    %ebx
+     fdf:	5e                   	pop    %esi
+     fe0:	5f                   	pop    %edi
+     fe1:	5d                   	pop    %ebp
+     fe2:	c3                   	ret
+     fe3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fe7:	90                   	nop
+  s->next = *l;
+     fe8:	8b 14 f5 20 1e 00 00 	mov    0x1e20(,%esi,8),%edx
+  s->prev = 0;
+     fef:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     ff6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     ff8:	85 d2                	test   %edx,%edx
+     ffa:	74 06                	je     1002 <free+0xd2>
+    (*l)->prev = s;
+     ffc:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     fff:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1002:	89 1c f5 20 1e 00 00 	mov    %ebx,0x1e20(,%esi,8)
+}
+    1009:	e9 55 ff ff ff       	jmp    f63 <free+0x33>
+    100e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1010:	83 ec 0c             	sub    $0xc,%esp
+    1013:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1016:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1019:	6a 00                	push   $0x0
+    101b:	c1 e7 0c             	shl    $0xc,%edi
+    101e:	01 df                	add    %ebx,%edi
+    1020:	e8 46 f7 ff ff       	call   76b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1025:	83 c4 10             	add    $0x10,%esp
+    1028:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    102b:	39 c7                	cmp    %eax,%edi
+    102d:	75 ac                	jne    fdb <free+0xab>
+    102f:	8b 04 f5 24 1e 00 00 	mov    0x1e24(,%esi,8),%eax
+    1036:	e9 58 ff ff ff       	jmp    f93 <free+0x63>
+    103b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    103f:	90                   	nop
+    *l = s->next;
+    1040:	89 0c f5 20 1e 00 00 	mov    %ecx,0x1e20(,%esi,8)
+    1047:	e9 56 ff ff ff       	jmp    fa2 <free+0x72>
+    104c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001050 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1050:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1051:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    1056:	89 e5                	mov    %esp,%ebp
+    1058:	57                   	push   %edi
+    1059:	56                   	push   %esi
+    105a:	53                   	push   %ebx
+    105b:	83 ec 1c             	sub    $0x1c,%esp
+    105e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    1061:	83 f8 10             	cmp    $0x10,%eax
+    1064:	0f 86 92 00 00 00    	jbe    10fc <malloc+0xac>
+    106a:	ba 01 00 00 00       	mov    $0x1,%edx
+    106f:	eb 13                	jmp    1084 <malloc+0x34>
+    1071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1078:	89 d3                	mov    %edx,%ebx
+    107a:	d3 e3                	shl    %cl,%ebx
+    107c:	39 c3                	cmp    %eax,%ebx
+    107e:	0f 83 84 00 00 00    	jae    1108 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1084:	83 c1 01             	add    $0x1,%ecx
+    1087:	83 f9 0b             	cmp    $0xb,%ecx
+    108a:	75 ec                	jne    1078 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    108c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    1091:	0f 87 c9 00 00 00    	ja     1160 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    1097:	05 17 10 00 00       	add    $0x1017,%eax
+    109c:	89 c3                	mov    %eax,%ebx
+    109e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    10a1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    10a6:	77 28                	ja     10d0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    10a8:	89 d8                	mov    %ebx,%eax
+    10aa:	e8 91 fd ff ff       	call   e40 <getpages>
+    10af:	85 c0                	test   %eax,%eax
+    10b1:	0f 84 a9 00 00 00    	je     1160 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    10b7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    10be:	83 c0 18             	add    $0x18,%eax
+}
+    10c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10c4:	5b                   	pop    %ebx
+    10c5:	5e                   	pop    %esi
+    10c6:	5f                   	pop    %edi
+    10c7:	5d                   	pop    %ebp
+    10c8:	c3                   	ret
+    10c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    10d0:	89 d8                	mov    %ebx,%eax
+    10d2:	83 ec 08             	sub    $0x8,%esp
+    10d5:	c1 e0 0c             	shl    $0xc,%eax
+    10d8:	6a 00                	push   $0x0
+    10da:	6a ff                	push   $0xffffffff
+    10dc:	6a 22                	push   $0x22
+    10de:	6a 03                	push   $0x3
+    10e0:	50                   	push   %eax
+    10e1:	6a 00                	push   $0x0
+    10e3:	e8 53 f7 ff ff       	call   83b <mmap>
+    if(s == MAP_FAILED)
+    10e8:	83 c4 20             	add    $0x20,%esp
+    10eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10ee:	74 b8                	je     10a8 <malloc+0x58>
+      s->shift = MAPRUN;
+    10f0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    10f7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    10fa:	eb c2                	jmp    10be <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    10fc:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1108:	8b 34 cd 20 1e 00 00 	mov    0x1e20(,%ecx,8),%esi
+    110f:	85 f6                	test   %esi,%esi
+    1111:	74 57                	je     116a <malloc+0x11a>
+  classes[shift].nfree--;
+    1113:	8b 1c cd 24 1e 00 00 	mov    0x1e24(,%ecx,8),%ebx
+  o = s->free;
+    111a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    111d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1120:	89 14 cd 24 1e 00 00 	mov    %edx,0x1e24(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1127:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1129:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    112d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1130:	85 ff                	test   %edi,%edi
+    1132:	75 8d                	jne    10c1 <malloc+0x71>
+  if(s->prev)
+    1134:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1137:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1139:	85 db                	test   %ebx,%ebx
+    113b:	0f 84 b7 00 00 00    	je     11f8 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1141:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1143:	85 d2                	test   %edx,%edx
+    1145:	0f 84 76 ff ff ff    	je     10c1 <malloc+0x71>
+    s->next->prev = s->prev;
+    114b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    114e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1151:	e9 6b ff ff ff       	jmp    10c1 <malloc+0x71>
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    1163:	31 c0                	xor    %eax,%eax
+}
+    1165:	5b                   	pop    %ebx
+    1166:	5e                   	pop    %esi
+    1167:	5f                   	pop    %edi
+    1168:	5d                   	pop    %ebp
+    1169:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    116a:	b8 01 00 00 00       	mov    $0x1,%eax
+    116f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1172:	e8 c9 fc ff ff       	call   e40 <getpages>
+    1177:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    117a:	85 c0                	test   %eax,%eax
+    117c:	89 c2                	mov    %eax,%edx
+    117e:	74 e0                	je     1160 <malloc+0x110>
+    s->shift = shift;
+    1180:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1183:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    1185:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    118c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1191:	89 df                	mov    %ebx,%edi
+    1193:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    1195:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    1197:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    119a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    119d:	83 e8 01             	sub    $0x1,%eax
+    11a0:	d3 e0                	shl    %cl,%eax
+    11a2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    11a5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    11ac:	eb 04                	jmp    11b2 <malloc+0x162>
+    11ae:	66 90                	xchg   %ax,%ax
+    11b0:	89 c8                	mov    %ecx,%eax
+    11b2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    11b5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11b7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    11ba:	89 c6                	mov    %eax,%esi
+    11bc:	39 da                	cmp    %ebx,%edx
+    11be:	7f f0                	jg     11b0 <malloc+0x160>
+    11c0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    11c3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    11c6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    11c9:	8b 04 cd 20 1e 00 00 	mov    0x1e20(,%ecx,8),%eax
+  s->prev = 0;
+    11d0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    11d7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    11d9:	85 c0                	test   %eax,%eax
+    11db:	74 03                	je     11e0 <malloc+0x190>
+    (*l)->prev = s;
+    11dd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    11e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    11e3:	89 14 cd 20 1e 00 00 	mov    %edx,0x1e20(,%ecx,8)
+    classes[shift].nfree += n;
+    11ea:	89 d6                	mov    %edx,%esi
+    11ec:	03 1c cd 24 1e 00 00 	add    0x1e24(,%ecx,8),%ebx
+    11f3:	e9 22 ff ff ff       	jmp    111a <malloc+0xca>
+    *l = s->next;
+    11f8:	89 14 cd 20 1e 00 00 	mov    %edx,0x1e20(,%ecx,8)
+    11ff:	e9 3f ff ff ff       	jmp    1143 <malloc+0xf3>
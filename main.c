@@ -26,13 +26,19 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  slabinit();      // kernel object caches
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  ksyncinit();     // semaphore and event table
+  shminit();       // shared-memory segments
+  pcacheinit();    // file page cache
+  cmdcacheinit();  // resolved command names
   ideinit();       // disk 
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(4*1024*1024), P2V(physstop)); // must come after startothers()
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
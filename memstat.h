@@ -0,0 +1,18 @@
+// Memory statistics returned by memstat(), in pages.
+struct memstat {
+  uint total;     // physical pages the kernel allocates from
+  uint free;      // free pages
+  uint pgtables;  // page directories and page tables
+  uint kstacks;   // kernel stacks
+  uint slab;      // pages of the kernel object caches
+  uint pipes;     // of those, pages of pipes
+  uint pcache;    // file pages cached for private mappings
+  uint swap;      // pages the swap area holds
+  uint swapfree;  // free pages in the swap area
+
+  // The process asked about.
+  uint sz;        // bytes of memory below the mapped regions
+  uint rss;       // resident pages
+  uint shared;    // resident pages also mapped elsewhere
+  uint swapped;   // pages paged out
+};
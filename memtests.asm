@@ -0,0 +1,3866 @@
+
+_memtests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "swap test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "memtests starting\n");
+      11:	68 dd 23 00 00       	push   $0x23dd
+      16:	6a 01                	push   $0x1
+      18:	e8 63 18 00 00       	call   1880 <printf>
+  sbrktest();
+      1d:	e8 3e 00 00 00       	call   60 <sbrktest>
+  mem();
+      22:	e8 79 04 00 00       	call   4a0 <mem>
+  malloctest();
+      27:	e8 44 05 00 00       	call   570 <malloctest>
+  cowtest();
+      2c:	e8 6f 07 00 00       	call   7a0 <cowtest>
+  mmaptest();
+      31:	e8 fa 08 00 00       	call   930 <mmaptest>
+  shmtest();
+      36:	e8 15 0d 00 00       	call   d50 <shmtest>
+  memstattest();
+      3b:	e8 a0 0e 00 00       	call   ee0 <memstattest>
+  swaptest();
+      40:	e8 ab 0f 00 00       	call   ff0 <swaptest>
+  printf(1, "memtests done\n");
+      45:	58                   	pop    %eax
+      46:	5a                   	pop    %edx
+      47:	68 f0 23 00 00       	push   $0x23f0
+      4c:	6a 01                	push   $0x1
+      4e:	e8 2d 18 00 00       	call   1880 <printf>
+  exit();
+      53:	e8 38 11 00 00       	call   1190 <exit>
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <sbrktest>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	57                   	push   %edi
+      64:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+      65:	31 f6                	xor    %esi,%esi
+{
+      67:	53                   	push   %ebx
+      68:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+      6b:	68 24 20 00 00       	push   $0x2024
+      70:	ff 35 e4 2c 00 00    	push   0x2ce4
+      76:	e8 05 18 00 00       	call   1880 <printf>
+  oldbrk = sbrk(0);
+      7b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      82:	e8 04 15 00 00       	call   158b <sbrk>
+      87:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+      8a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      91:	e8 f5 14 00 00       	call   158b <sbrk>
+      96:	83 c4 10             	add    $0x10,%esp
+      99:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+      9b:	eb 05                	jmp    a2 <sbrktest+0x42>
+      9d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+      a0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	6a 01                	push   $0x1
+      a7:	e8 df 14 00 00       	call   158b <sbrk>
+    if(b != a){
+      ac:	83 c4 10             	add    $0x10,%esp
+      af:	39 d8                	cmp    %ebx,%eax
+      b1:	0f 85 9c 02 00 00    	jne    353 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+      b7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+      ba:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+      bd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+      c0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+      c6:	75 d8                	jne    a0 <sbrktest+0x40>
+  pid = fork();
+      c8:	e8 93 10 00 00       	call   1160 <fork>
+      cd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+      cf:	85 c0                	test   %eax,%eax
+      d1:	0f 88 02 03 00 00    	js     3d9 <sbrktest+0x379>
+  c = sbrk(1);
+      d7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+      da:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+      dd:	6a 01                	push   $0x1
+      df:	e8 a7 14 00 00       	call   158b <sbrk>
+  c = sbrk(1);
+      e4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+      eb:	e8 9b 14 00 00       	call   158b <sbrk>
+  if(c != a + 1){
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	39 c3                	cmp    %eax,%ebx
+      f5:	0f 85 3b 03 00 00    	jne    436 <sbrktest+0x3d6>
+  if(pid == 0)
+      fb:	85 f6                	test   %esi,%esi
+      fd:	0f 84 2e 03 00 00    	je     431 <sbrktest+0x3d1>
+  wait();
+     103:	e8 03 14 00 00       	call   150b <wait>
+  a = sbrk(0);
+     108:	83 ec 0c             	sub    $0xc,%esp
+     10b:	6a 00                	push   $0x0
+     10d:	e8 79 14 00 00       	call   158b <sbrk>
+     112:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+     114:	b8 00 00 40 06       	mov    $0x6400000,%eax
+     119:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+     11b:	89 04 24             	mov    %eax,(%esp)
+     11e:	e8 68 14 00 00       	call   158b <sbrk>
+  if (p != a) {
+     123:	83 c4 10             	add    $0x10,%esp
+     126:	39 c3                	cmp    %eax,%ebx
+     128:	0f 85 94 02 00 00    	jne    3c2 <sbrktest+0x362>
+  a = sbrk(0);
+     12e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+     131:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+     138:	6a 00                	push   $0x0
+     13a:	e8 4c 14 00 00       	call   158b <sbrk>
+  c = sbrk(-4096);
+     13f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+     146:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+     148:	e8 3e 14 00 00       	call   158b <sbrk>
+  if(c == (char*)0xffffffff){
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	83 f8 ff             	cmp    $0xffffffff,%eax
+     153:	0f 84 22 03 00 00    	je     47b <sbrktest+0x41b>
+  c = sbrk(0);
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	6a 00                	push   $0x0
+     15e:	e8 28 14 00 00       	call   158b <sbrk>
+  if(c != a - 4096){
+     163:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+     169:	83 c4 10             	add    $0x10,%esp
+     16c:	39 d0                	cmp    %edx,%eax
+     16e:	0f 85 f0 02 00 00    	jne    464 <sbrktest+0x404>
+  a = sbrk(0);
+     174:	83 ec 0c             	sub    $0xc,%esp
+     177:	6a 00                	push   $0x0
+     179:	e8 0d 14 00 00       	call   158b <sbrk>
+  c = sbrk(4096);
+     17e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+     185:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+     187:	e8 ff 13 00 00       	call   158b <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+     18c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+     18f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+     191:	39 c3                	cmp    %eax,%ebx
+     193:	0f 85 b4 02 00 00    	jne    44d <sbrktest+0x3ed>
+     199:	83 ec 0c             	sub    $0xc,%esp
+     19c:	6a 00                	push   $0x0
+     19e:	e8 e8 13 00 00       	call   158b <sbrk>
+     1a3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+     1a9:	83 c4 10             	add    $0x10,%esp
+     1ac:	39 c2                	cmp    %eax,%edx
+     1ae:	0f 85 99 02 00 00    	jne    44d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+     1b4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+     1bb:	0f 84 2f 02 00 00    	je     3f0 <sbrktest+0x390>
+  a = sbrk(0);
+     1c1:	83 ec 0c             	sub    $0xc,%esp
+     1c4:	6a 00                	push   $0x0
+     1c6:	e8 c0 13 00 00       	call   158b <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+     1cb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+     1d2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+     1d4:	e8 b2 13 00 00       	call   158b <sbrk>
+     1d9:	89 c2                	mov    %eax,%edx
+     1db:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     1de:	29 d0                	sub    %edx,%eax
+     1e0:	89 04 24             	mov    %eax,(%esp)
+     1e3:	e8 a3 13 00 00       	call   158b <sbrk>
+  if(c != a){
+     1e8:	83 c4 10             	add    $0x10,%esp
+     1eb:	39 c3                	cmp    %eax,%ebx
+     1ed:	0f 85 b8 01 00 00    	jne    3ab <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+     1f3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+     1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+    ppid = getpid();
+     200:	e8 7e 13 00 00       	call   1583 <getpid>
+     205:	89 c6                	mov    %eax,%esi
+    pid = fork();
+     207:	e8 54 0f 00 00       	call   1160 <fork>
+    if(pid < 0){
+     20c:	85 c0                	test   %eax,%eax
+     20e:	0f 88 5d 01 00 00    	js     371 <sbrktest+0x311>
+    if(pid == 0){
+     214:	0f 84 6f 01 00 00    	je     389 <sbrktest+0x329>
+    wait();
+     21a:	e8 ec 12 00 00       	call   150b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+     21f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+     225:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+     22b:	75 d3                	jne    200 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+     22d:	83 ec 0c             	sub    $0xc,%esp
+     230:	8d 45 b8             	lea    -0x48(%ebp),%eax
+     233:	50                   	push   %eax
+     234:	e8 da 12 00 00       	call   1513 <pipe>
+     239:	83 c4 10             	add    $0x10,%esp
+     23c:	85 c0                	test   %eax,%eax
+     23e:	0f 85 da 01 00 00    	jne    41e <sbrktest+0x3be>
+     244:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+     247:	8d 75 e8             	lea    -0x18(%ebp),%esi
+     24a:	89 df                	mov    %ebx,%edi
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+     250:	e8 0b 0f 00 00       	call   1160 <fork>
+     255:	89 07                	mov    %eax,(%edi)
+     257:	85 c0                	test   %eax,%eax
+     259:	0f 84 91 00 00 00    	je     2f0 <sbrktest+0x290>
+    if(pids[i] != -1)
+     25f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     262:	74 14                	je     278 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+     264:	83 ec 04             	sub    $0x4,%esp
+     267:	8d 45 b7             	lea    -0x49(%ebp),%eax
+     26a:	6a 01                	push   $0x1
+     26c:	50                   	push   %eax
+     26d:	ff 75 b8             	push   -0x48(%ebp)
+     270:	e8 a6 12 00 00       	call   151b <read>
+     275:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     278:	83 c7 04             	add    $0x4,%edi
+     27b:	39 f7                	cmp    %esi,%edi
+     27d:	75 d1                	jne    250 <sbrktest+0x1f0>
+  c = sbrk(4096);
+     27f:	83 ec 0c             	sub    $0xc,%esp
+     282:	68 00 10 00 00       	push   $0x1000
+     287:	e8 ff 12 00 00       	call   158b <sbrk>
+     28c:	83 c4 10             	add    $0x10,%esp
+     28f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+     298:	8b 03                	mov    (%ebx),%eax
+     29a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     29d:	74 11                	je     2b0 <sbrktest+0x250>
+    kill(pids[i]);
+     29f:	83 ec 0c             	sub    $0xc,%esp
+     2a2:	50                   	push   %eax
+     2a3:	e8 8b 12 00 00       	call   1533 <kill>
+    wait();
+     2a8:	e8 5e 12 00 00       	call   150b <wait>
+     2ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     2b0:	83 c3 04             	add    $0x4,%ebx
+     2b3:	39 f3                	cmp    %esi,%ebx
+     2b5:	75 e1                	jne    298 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+     2b7:	83 ff ff             	cmp    $0xffffffff,%edi
+     2ba:	0f 84 47 01 00 00    	je     407 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+     2c0:	83 ec 0c             	sub    $0xc,%esp
+     2c3:	6a 00                	push   $0x0
+     2c5:	e8 c1 12 00 00       	call   158b <sbrk>
+     2ca:	83 c4 10             	add    $0x10,%esp
+     2cd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+     2d0:	72 60                	jb     332 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+     2d2:	83 ec 08             	sub    $0x8,%esp
+     2d5:	68 dd 20 00 00       	push   $0x20dd
+     2da:	ff 35 e4 2c 00 00    	push   0x2ce4
+     2e0:	e8 9b 15 00 00       	call   1880 <printf>
+}
+     2e5:	83 c4 10             	add    $0x10,%esp
+     2e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2eb:	5b                   	pop    %ebx
+     2ec:	5e                   	pop    %esi
+     2ed:	5f                   	pop    %edi
+     2ee:	5d                   	pop    %ebp
+     2ef:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+     2f0:	83 ec 0c             	sub    $0xc,%esp
+     2f3:	6a 00                	push   $0x0
+     2f5:	e8 91 12 00 00       	call   158b <sbrk>
+     2fa:	89 c2                	mov    %eax,%edx
+     2fc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+     301:	29 d0                	sub    %edx,%eax
+     303:	89 04 24             	mov    %eax,(%esp)
+     306:	e8 80 12 00 00       	call   158b <sbrk>
+      write(fds[1], "x", 1);
+     30b:	83 c4 0c             	add    $0xc,%esp
+     30e:	6a 01                	push   $0x1
+     310:	68 c0 20 00 00       	push   $0x20c0
+     315:	ff 75 bc             	push   -0x44(%ebp)
+     318:	e8 06 12 00 00       	call   1523 <write>
+     31d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+     320:	83 ec 0c             	sub    $0xc,%esp
+     323:	68 e8 03 00 00       	push   $0x3e8
+     328:	e8 66 12 00 00       	call   1593 <sleep>
+     32d:	83 c4 10             	add    $0x10,%esp
+     330:	eb ee                	jmp    320 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+     332:	83 ec 0c             	sub    $0xc,%esp
+     335:	6a 00                	push   $0x0
+     337:	e8 4f 12 00 00       	call   158b <sbrk>
+     33c:	89 c2                	mov    %eax,%edx
+     33e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     341:	29 d0                	sub    %edx,%eax
+     343:	89 04 24             	mov    %eax,(%esp)
+     346:	e8 40 12 00 00       	call   158b <sbrk>
+     34b:	83 c4 10             	add    $0x10,%esp
+     34e:	e9 7f ff ff ff       	jmp    2d2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+     353:	83 ec 0c             	sub    $0xc,%esp
+     356:	50                   	push   %eax
+     357:	53                   	push   %ebx
+     358:	56                   	push   %esi
+     359:	68 2f 20 00 00       	push   $0x202f
+     35e:	ff 35 e4 2c 00 00    	push   0x2ce4
+     364:	e8 17 15 00 00       	call   1880 <printf>
+      exit();
+     369:	83 c4 20             	add    $0x20,%esp
+     36c:	e8 1f 0e 00 00       	call   1190 <exit>
+      printf(stdout, "fork failed\n");
+     371:	83 ec 08             	sub    $0x8,%esp
+     374:	68 54 20 00 00       	push   $0x2054
+     379:	ff 35 e4 2c 00 00    	push   0x2ce4
+     37f:	e8 fc 14 00 00       	call   1880 <printf>
+      exit();
+     384:	e8 07 0e 00 00       	call   1190 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+     389:	0f be 03             	movsbl (%ebx),%eax
+     38c:	50                   	push   %eax
+     38d:	53                   	push   %ebx
+     38e:	68 98 20 00 00       	push   $0x2098
+     393:	ff 35 e4 2c 00 00    	push   0x2ce4
+     399:	e8 e2 14 00 00       	call   1880 <printf>
+      kill(ppid);
+     39e:	89 34 24             	mov    %esi,(%esp)
+     3a1:	e8 8d 11 00 00       	call   1533 <kill>
+      exit();
+     3a6:	e8 e5 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+     3ab:	50                   	push   %eax
+     3ac:	53                   	push   %ebx
+     3ad:	68 d0 24 00 00       	push   $0x24d0
+     3b2:	ff 35 e4 2c 00 00    	push   0x2ce4
+     3b8:	e8 c3 14 00 00       	call   1880 <printf>
+    exit();
+     3bd:	e8 ce 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+     3c2:	56                   	push   %esi
+     3c3:	56                   	push   %esi
+     3c4:	68 00 24 00 00       	push   $0x2400
+     3c9:	ff 35 e4 2c 00 00    	push   0x2ce4
+     3cf:	e8 ac 14 00 00       	call   1880 <printf>
+    exit();
+     3d4:	e8 b7 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+     3d9:	50                   	push   %eax
+     3da:	50                   	push   %eax
+     3db:	68 4a 20 00 00       	push   $0x204a
+     3e0:	ff 35 e4 2c 00 00    	push   0x2ce4
+     3e6:	e8 95 14 00 00       	call   1880 <printf>
+    exit();
+     3eb:	e8 a0 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+     3f0:	51                   	push   %ecx
+     3f1:	51                   	push   %ecx
+     3f2:	68 a0 24 00 00       	push   $0x24a0
+     3f7:	ff 35 e4 2c 00 00    	push   0x2ce4
+     3fd:	e8 7e 14 00 00       	call   1880 <printf>
+    exit();
+     402:	e8 89 0d 00 00       	call   1190 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+     407:	50                   	push   %eax
+     408:	50                   	push   %eax
+     409:	68 c2 20 00 00       	push   $0x20c2
+     40e:	ff 35 e4 2c 00 00    	push   0x2ce4
+     414:	e8 67 14 00 00       	call   1880 <printf>
+    exit();
+     419:	e8 72 0d 00 00       	call   1190 <exit>
+    printf(1, "pipe() failed\n");
+     41e:	52                   	push   %edx
+     41f:	52                   	push   %edx
+     420:	68 b1 20 00 00       	push   $0x20b1
+     425:	6a 01                	push   $0x1
+     427:	e8 54 14 00 00       	call   1880 <printf>
+    exit();
+     42c:	e8 5f 0d 00 00       	call   1190 <exit>
+    exit();
+     431:	e8 5a 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+     436:	57                   	push   %edi
+     437:	57                   	push   %edi
+     438:	68 61 20 00 00       	push   $0x2061
+     43d:	ff 35 e4 2c 00 00    	push   0x2ce4
+     443:	e8 38 14 00 00       	call   1880 <printf>
+    exit();
+     448:	e8 43 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+     44d:	56                   	push   %esi
+     44e:	53                   	push   %ebx
+     44f:	68 78 24 00 00       	push   $0x2478
+     454:	ff 35 e4 2c 00 00    	push   0x2ce4
+     45a:	e8 21 14 00 00       	call   1880 <printf>
+    exit();
+     45f:	e8 2c 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+     464:	50                   	push   %eax
+     465:	53                   	push   %ebx
+     466:	68 40 24 00 00       	push   $0x2440
+     46b:	ff 35 e4 2c 00 00    	push   0x2ce4
+     471:	e8 0a 14 00 00       	call   1880 <printf>
+    exit();
+     476:	e8 15 0d 00 00       	call   1190 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+     47b:	53                   	push   %ebx
+     47c:	53                   	push   %ebx
+     47d:	68 7d 20 00 00       	push   $0x207d
+     482:	ff 35 e4 2c 00 00    	push   0x2ce4
+     488:	e8 f3 13 00 00       	call   1880 <printf>
+    exit();
+     48d:	e8 fe 0c 00 00       	call   1190 <exit>
+     492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <mem>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	31 f6                	xor    %esi,%esi
+     4a6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     4a7:	83 ec 08             	sub    $0x8,%esp
+     4aa:	68 eb 20 00 00       	push   $0x20eb
+     4af:	6a 01                	push   $0x1
+     4b1:	e8 ca 13 00 00       	call   1880 <printf>
+  ppid = getpid();
+     4b6:	e8 c8 10 00 00       	call   1583 <getpid>
+     4bb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     4bd:	e8 9e 0c 00 00       	call   1160 <fork>
+     4c2:	83 c4 10             	add    $0x10,%esp
+     4c5:	85 c0                	test   %eax,%eax
+     4c7:	74 0b                	je     4d4 <mem+0x34>
+     4c9:	e9 8a 00 00 00       	jmp    558 <mem+0xb8>
+     4ce:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     4d0:	89 30                	mov    %esi,(%eax)
+     4d2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     4d4:	83 ec 0c             	sub    $0xc,%esp
+     4d7:	68 11 27 00 00       	push   $0x2711
+     4dc:	e8 8f 19 00 00       	call   1e70 <malloc>
+     4e1:	83 c4 10             	add    $0x10,%esp
+     4e4:	85 c0                	test   %eax,%eax
+     4e6:	75 e8                	jne    4d0 <mem+0x30>
+    while(m1){
+     4e8:	85 f6                	test   %esi,%esi
+     4ea:	74 18                	je     504 <mem+0x64>
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     4f0:	89 f0                	mov    %esi,%eax
+      free(m1);
+     4f2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     4f5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     4f7:	50                   	push   %eax
+     4f8:	e8 53 18 00 00       	call   1d50 <free>
+    while(m1){
+     4fd:	83 c4 10             	add    $0x10,%esp
+     500:	85 f6                	test   %esi,%esi
+     502:	75 ec                	jne    4f0 <mem+0x50>
+    m1 = malloc(1024*20);
+     504:	83 ec 0c             	sub    $0xc,%esp
+     507:	68 00 50 00 00       	push   $0x5000
+     50c:	e8 5f 19 00 00       	call   1e70 <malloc>
+    if(m1 == 0){
+     511:	83 c4 10             	add    $0x10,%esp
+     514:	85 c0                	test   %eax,%eax
+     516:	74 20                	je     538 <mem+0x98>
+    free(m1);
+     518:	83 ec 0c             	sub    $0xc,%esp
+     51b:	50                   	push   %eax
+     51c:	e8 2f 18 00 00       	call   1d50 <free>
+    printf(1, "mem ok\n");
+     521:	58                   	pop    %eax
+     522:	5a                   	pop    %edx
+     523:	68 0f 21 00 00       	push   $0x210f
+     528:	6a 01                	push   $0x1
+     52a:	e8 51 13 00 00       	call   1880 <printf>
+    exit();
+     52f:	e8 5c 0c 00 00       	call   1190 <exit>
+     534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     538:	83 ec 08             	sub    $0x8,%esp
+     53b:	68 f5 20 00 00       	push   $0x20f5
+     540:	6a 01                	push   $0x1
+     542:	e8 39 13 00 00       	call   1880 <printf>
+      kill(ppid);
+     547:	89 1c 24             	mov    %ebx,(%esp)
+     54a:	e8 e4 0f 00 00       	call   1533 <kill>
+      exit();
+     54f:	e8 3c 0c 00 00       	call   1190 <exit>
+     554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     558:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     55b:	5b                   	pop    %ebx
+     55c:	5e                   	pop    %esi
+     55d:	5d                   	pop    %ebp
+    wait();
+     55e:	e9 a8 0f 00 00       	jmp    150b <wait>
+     563:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000570 <malloctest>:
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	57                   	push   %edi
+     574:	56                   	push   %esi
+    if((b[i] = malloc(i*37 % 3000 + 1)) == 0){
+     575:	be f1 19 76 05       	mov    $0x57619f1,%esi
+{
+     57a:	53                   	push   %ebx
+  for(i = 0; i < 200; i++){
+     57b:	31 db                	xor    %ebx,%ebx
+{
+     57d:	81 ec 44 03 00 00    	sub    $0x344,%esp
+  printf(1, "malloc test\n");
+     583:	68 17 21 00 00       	push   $0x2117
+     588:	6a 01                	push   $0x1
+     58a:	e8 f1 12 00 00       	call   1880 <printf>
+     58f:	83 c4 10             	add    $0x10,%esp
+     592:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((b[i] = malloc(i*37 % 3000 + 1)) == 0){
+     598:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+     59b:	83 ec 0c             	sub    $0xc,%esp
+     59e:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+     5a1:	89 c8                	mov    %ecx,%eax
+     5a3:	f7 e6                	mul    %esi
+     5a5:	c1 ea 06             	shr    $0x6,%edx
+     5a8:	69 d2 b8 0b 00 00    	imul   $0xbb8,%edx,%edx
+     5ae:	29 d1                	sub    %edx,%ecx
+     5b0:	8d 79 01             	lea    0x1(%ecx),%edi
+     5b3:	57                   	push   %edi
+     5b4:	e8 b7 18 00 00       	call   1e70 <malloc>
+     5b9:	83 c4 10             	add    $0x10,%esp
+     5bc:	89 84 9d c8 fc ff ff 	mov    %eax,-0x338(%ebp,%ebx,4)
+     5c3:	85 c0                	test   %eax,%eax
+     5c5:	0f 84 ab 01 00 00    	je     776 <malloctest+0x206>
+    memset(b[i], i, i*37 % 3000 + 1);
+     5cb:	83 ec 04             	sub    $0x4,%esp
+     5ce:	57                   	push   %edi
+     5cf:	53                   	push   %ebx
+  for(i = 0; i < 200; i++){
+     5d0:	83 c3 01             	add    $0x1,%ebx
+    memset(b[i], i, i*37 % 3000 + 1);
+     5d3:	50                   	push   %eax
+     5d4:	e8 07 0d 00 00       	call   12e0 <memset>
+  for(i = 0; i < 200; i++){
+     5d9:	83 c4 10             	add    $0x10,%esp
+     5dc:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     5e2:	75 b4                	jne    598 <malloctest+0x28>
+     5e4:	8d bd c8 fc ff ff    	lea    -0x338(%ebp),%edi
+     5ea:	8d 75 e8             	lea    -0x18(%ebp),%esi
+     5ed:	89 fb                	mov    %edi,%ebx
+     5ef:	90                   	nop
+    free(b[i]);
+     5f0:	83 ec 0c             	sub    $0xc,%esp
+     5f3:	ff 33                	push   (%ebx)
+  for(i = 0; i < 200; i += 2)
+     5f5:	83 c3 08             	add    $0x8,%ebx
+    free(b[i]);
+     5f8:	e8 53 17 00 00       	call   1d50 <free>
+  for(i = 0; i < 200; i += 2)
+     5fd:	83 c4 10             	add    $0x10,%esp
+     600:	39 f3                	cmp    %esi,%ebx
+     602:	75 ec                	jne    5f0 <malloctest+0x80>
+    b[i] = malloc(i*37 % 3000 + 1);
+     604:	89 bd c4 fc ff ff    	mov    %edi,-0x33c(%ebp)
+  for(i = 0; i < 200; i += 2){
+     60a:	31 db                	xor    %ebx,%ebx
+    b[i] = malloc(i*37 % 3000 + 1);
+     60c:	be f1 19 76 05       	mov    $0x57619f1,%esi
+     611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     618:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+     61b:	83 ec 0c             	sub    $0xc,%esp
+     61e:	8d 0c 83             	lea    (%ebx,%eax,4),%ecx
+     621:	89 c8                	mov    %ecx,%eax
+     623:	f7 e6                	mul    %esi
+     625:	c1 ea 06             	shr    $0x6,%edx
+     628:	69 d2 b8 0b 00 00    	imul   $0xbb8,%edx,%edx
+     62e:	29 d1                	sub    %edx,%ecx
+     630:	8d 79 01             	lea    0x1(%ecx),%edi
+     633:	57                   	push   %edi
+     634:	e8 37 18 00 00       	call   1e70 <malloc>
+    memset(b[i], i, i*37 % 3000 + 1);
+     639:	83 c4 0c             	add    $0xc,%esp
+    b[i] = malloc(i*37 % 3000 + 1);
+     63c:	89 84 9d c8 fc ff ff 	mov    %eax,-0x338(%ebp,%ebx,4)
+    memset(b[i], i, i*37 % 3000 + 1);
+     643:	57                   	push   %edi
+     644:	53                   	push   %ebx
+  for(i = 0; i < 200; i += 2){
+     645:	83 c3 02             	add    $0x2,%ebx
+    memset(b[i], i, i*37 % 3000 + 1);
+     648:	50                   	push   %eax
+     649:	e8 92 0c 00 00       	call   12e0 <memset>
+  for(i = 0; i < 200; i += 2){
+     64e:	83 c4 10             	add    $0x10,%esp
+     651:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     657:	75 bf                	jne    618 <malloctest+0xa8>
+  for(i = 0; i < 200; i++){
+     659:	31 db                	xor    %ebx,%ebx
+     65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+    n = i*37 % 3000 + 1;
+     660:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+      if(b[i][j] != (char)i){
+     663:	8b bc 9d c8 fc ff ff 	mov    -0x338(%ebp,%ebx,4),%edi
+    n = i*37 % 3000 + 1;
+     66a:	8d 34 83             	lea    (%ebx,%eax,4),%esi
+     66d:	b8 f1 19 76 05       	mov    $0x57619f1,%eax
+     672:	f7 e6                	mul    %esi
+     674:	89 f9                	mov    %edi,%ecx
+     676:	c1 ea 06             	shr    $0x6,%edx
+     679:	69 d2 b8 0b 00 00    	imul   $0xbb8,%edx,%edx
+     67f:	29 d6                	sub    %edx,%esi
+     681:	8d 44 37 01          	lea    0x1(%edi,%esi,1),%eax
+     685:	8d 76 00             	lea    0x0(%esi),%esi
+      if(b[i][j] != (char)i){
+     688:	38 19                	cmp    %bl,(%ecx)
+     68a:	0f 85 d1 00 00 00    	jne    761 <malloctest+0x1f1>
+    for(j = 0; j < n; j++){
+     690:	83 c1 01             	add    $0x1,%ecx
+     693:	39 c8                	cmp    %ecx,%eax
+     695:	75 f1                	jne    688 <malloctest+0x118>
+    free(b[i]);
+     697:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 200; i++){
+     69a:	83 c3 01             	add    $0x1,%ebx
+    free(b[i]);
+     69d:	57                   	push   %edi
+     69e:	e8 ad 16 00 00       	call   1d50 <free>
+  for(i = 0; i < 200; i++){
+     6a3:	83 c4 10             	add    $0x10,%esp
+     6a6:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+     6ac:	75 b2                	jne    660 <malloctest+0xf0>
+  top = sbrk(0);
+     6ae:	83 ec 0c             	sub    $0xc,%esp
+     6b1:	8b bd c4 fc ff ff    	mov    -0x33c(%ebp),%edi
+     6b7:	8d 9d c8 fd ff ff    	lea    -0x238(%ebp),%ebx
+     6bd:	6a 00                	push   $0x0
+     6bf:	e8 c7 0e 00 00       	call   158b <sbrk>
+     6c4:	83 c4 10             	add    $0x10,%esp
+     6c7:	89 85 c4 fc ff ff    	mov    %eax,-0x33c(%ebp)
+  for(i = 0; i < 64; i++){
+     6cd:	8d 85 c8 fc ff ff    	lea    -0x338(%ebp),%eax
+  top = sbrk(0);
+     6d3:	89 c6                	mov    %eax,%esi
+     6d5:	8d 76 00             	lea    0x0(%esi),%esi
+    b[i] = malloc(20000);
+     6d8:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 64; i++){
+     6db:	83 c6 04             	add    $0x4,%esi
+    b[i] = malloc(20000);
+     6de:	68 20 4e 00 00       	push   $0x4e20
+     6e3:	e8 88 17 00 00       	call   1e70 <malloc>
+  for(i = 0; i < 64; i++){
+     6e8:	83 c4 10             	add    $0x10,%esp
+    b[i] = malloc(20000);
+     6eb:	89 46 fc             	mov    %eax,-0x4(%esi)
+    b[i][19999] = 1;
+     6ee:	c6 80 1f 4e 00 00 01 	movb   $0x1,0x4e1f(%eax)
+  for(i = 0; i < 64; i++){
+     6f5:	39 f3                	cmp    %esi,%ebx
+     6f7:	75 df                	jne    6d8 <malloctest+0x168>
+     6f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    free(b[i]);
+     700:	83 ec 0c             	sub    $0xc,%esp
+     703:	ff 37                	push   (%edi)
+  for(i = 0; i < 64; i++)
+     705:	83 c7 04             	add    $0x4,%edi
+    free(b[i]);
+     708:	e8 43 16 00 00       	call   1d50 <free>
+  for(i = 0; i < 64; i++)
+     70d:	83 c4 10             	add    $0x10,%esp
+     710:	39 fb                	cmp    %edi,%ebx
+     712:	75 ec                	jne    700 <malloctest+0x190>
+  if(sbrk(0) > top){
+     714:	83 ec 0c             	sub    $0xc,%esp
+     717:	6a 00                	push   $0x0
+     719:	e8 6d 0e 00 00       	call   158b <sbrk>
+     71e:	83 c4 10             	add    $0x10,%esp
+     721:	39 85 c4 fc ff ff    	cmp    %eax,-0x33c(%ebp)
+     727:	72 61                	jb     78a <malloctest+0x21a>
+  b[0] = malloc(200*1024);
+     729:	83 ec 0c             	sub    $0xc,%esp
+     72c:	68 00 20 03 00       	push   $0x32000
+     731:	e8 3a 17 00 00       	call   1e70 <malloc>
+  b[0][0] = b[0][200*1024-1] = 1;
+     736:	c6 80 ff 1f 03 00 01 	movb   $0x1,0x31fff(%eax)
+     73d:	c6 00 01             	movb   $0x1,(%eax)
+  free(b[0]);
+     740:	89 04 24             	mov    %eax,(%esp)
+     743:	e8 08 16 00 00       	call   1d50 <free>
+  printf(1, "malloc test OK\n");
+     748:	58                   	pop    %eax
+     749:	5a                   	pop    %edx
+     74a:	68 5d 21 00 00       	push   $0x215d
+     74f:	6a 01                	push   $0x1
+     751:	e8 2a 11 00 00       	call   1880 <printf>
+}
+     756:	83 c4 10             	add    $0x10,%esp
+     759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     75c:	5b                   	pop    %ebx
+     75d:	5e                   	pop    %esi
+     75e:	5f                   	pop    %edi
+     75f:	5d                   	pop    %ebp
+     760:	c3                   	ret
+        printf(1, "malloc test block %d overwritten\n", i);
+     761:	83 ec 04             	sub    $0x4,%esp
+     764:	53                   	push   %ebx
+     765:	68 f4 24 00 00       	push   $0x24f4
+     76a:	6a 01                	push   $0x1
+     76c:	e8 0f 11 00 00       	call   1880 <printf>
+        exit();
+     771:	e8 1a 0a 00 00       	call   1190 <exit>
+      printf(1, "malloc test malloc failed\n");
+     776:	83 ec 08             	sub    $0x8,%esp
+     779:	68 24 21 00 00       	push   $0x2124
+     77e:	6a 01                	push   $0x1
+     780:	e8 fb 10 00 00       	call   1880 <printf>
+      exit();
+     785:	e8 06 0a 00 00       	call   1190 <exit>
+    printf(1, "malloc test heap not trimmed\n");
+     78a:	51                   	push   %ecx
+     78b:	51                   	push   %ecx
+     78c:	68 3f 21 00 00       	push   $0x213f
+     791:	6a 01                	push   $0x1
+     793:	e8 e8 10 00 00       	call   1880 <printf>
+    exit();
+     798:	e8 f3 09 00 00       	call   1190 <exit>
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <cowtest>:
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "cow test\n");
+     7a9:	68 6d 21 00 00       	push   $0x216d
+     7ae:	6a 01                	push   $0x1
+     7b0:	e8 cb 10 00 00       	call   1880 <printf>
+  p = sbrk(8*4096);
+     7b5:	c7 04 24 00 80 00 00 	movl   $0x8000,(%esp)
+     7bc:	e8 ca 0d 00 00       	call   158b <sbrk>
+  if(p == (char*)-1){
+     7c1:	83 c4 10             	add    $0x10,%esp
+     7c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     7c7:	0f 84 24 01 00 00    	je     8f1 <cowtest+0x151>
+     7cd:	89 c7                	mov    %eax,%edi
+     7cf:	89 c3                	mov    %eax,%ebx
+     7d1:	8d b0 00 80 00 00    	lea    0x8000(%eax),%esi
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+    p[i] = 'a';
+     7e0:	c6 00 61             	movb   $0x61,(%eax)
+  for(i = 0; i < 8*4096; i += 4096)
+     7e3:	05 00 10 00 00       	add    $0x1000,%eax
+     7e8:	39 f0                	cmp    %esi,%eax
+     7ea:	75 f4                	jne    7e0 <cowtest+0x40>
+  if(pipe(fds) != 0){
+     7ec:	83 ec 0c             	sub    $0xc,%esp
+     7ef:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     7f2:	50                   	push   %eax
+     7f3:	e8 1b 0d 00 00       	call   1513 <pipe>
+     7f8:	83 c4 10             	add    $0x10,%esp
+     7fb:	85 c0                	test   %eax,%eax
+     7fd:	0f 85 14 01 00 00    	jne    917 <cowtest+0x177>
+  pid = fork();
+     803:	e8 58 09 00 00       	call   1160 <fork>
+  if(pid < 0){
+     808:	85 c0                	test   %eax,%eax
+     80a:	0f 88 f4 00 00 00    	js     904 <cowtest+0x164>
+  if(pid == 0){
+     810:	89 f8                	mov    %edi,%eax
+     812:	74 7c                	je     890 <cowtest+0xf0>
+     814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    p[i] = 'p';
+     818:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < 8*4096; i += 4096)
+     81b:	05 00 10 00 00       	add    $0x1000,%eax
+     820:	39 f0                	cmp    %esi,%eax
+     822:	75 f4                	jne    818 <cowtest+0x78>
+  write(fds[1], "k", 1);
+     824:	83 ec 04             	sub    $0x4,%esp
+     827:	6a 01                	push   $0x1
+     829:	68 d5 21 00 00       	push   $0x21d5
+     82e:	ff 75 e4             	push   -0x1c(%ebp)
+     831:	e8 ed 0c 00 00       	call   1523 <write>
+  wait();
+     836:	e8 d0 0c 00 00       	call   150b <wait>
+  close(fds[0]);
+     83b:	59                   	pop    %ecx
+     83c:	ff 75 e0             	push   -0x20(%ebp)
+     83f:	e8 e7 0c 00 00       	call   152b <close>
+  close(fds[1]);
+     844:	5f                   	pop    %edi
+     845:	ff 75 e4             	push   -0x1c(%ebp)
+     848:	e8 de 0c 00 00       	call   152b <close>
+     84d:	83 c4 10             	add    $0x10,%esp
+    c = p[i];
+     850:	0f be 03             	movsbl (%ebx),%eax
+    if(c != 'p'){
+     853:	3c 70                	cmp    $0x70,%al
+     855:	0f 85 81 00 00 00    	jne    8dc <cowtest+0x13c>
+  for(i = 0; i < 8*4096; i += 4096){
+     85b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+     861:	39 f3                	cmp    %esi,%ebx
+     863:	75 eb                	jne    850 <cowtest+0xb0>
+  sbrk(-8*4096);
+     865:	83 ec 0c             	sub    $0xc,%esp
+     868:	68 00 80 ff ff       	push   $0xffff8000
+     86d:	e8 19 0d 00 00       	call   158b <sbrk>
+  printf(1, "cow test OK\n");
+     872:	58                   	pop    %eax
+     873:	5a                   	pop    %edx
+     874:	68 d7 21 00 00       	push   $0x21d7
+     879:	6a 01                	push   $0x1
+     87b:	e8 00 10 00 00       	call   1880 <printf>
+}
+     880:	83 c4 10             	add    $0x10,%esp
+     883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     886:	5b                   	pop    %ebx
+     887:	5e                   	pop    %esi
+     888:	5f                   	pop    %edi
+     889:	5d                   	pop    %ebp
+     88a:	c3                   	ret
+     88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+    read(fds[0], p + 4096, 1);
+     890:	83 ec 04             	sub    $0x4,%esp
+     893:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+     899:	6a 01                	push   $0x1
+     89b:	50                   	push   %eax
+     89c:	ff 75 e0             	push   -0x20(%ebp)
+     89f:	e8 77 0c 00 00       	call   151b <read>
+    if(p[4096] != 'k'){
+     8a4:	83 c4 10             	add    $0x10,%esp
+     8a7:	80 bf 00 10 00 00 6b 	cmpb   $0x6b,0x1000(%edi)
+     8ae:	75 18                	jne    8c8 <cowtest+0x128>
+      p[i] = 'c';
+     8b0:	c6 03 63             	movb   $0x63,(%ebx)
+    for(i = 0; i < 8*4096; i += 4096)
+     8b3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+     8b9:	39 f3                	cmp    %esi,%ebx
+     8bb:	75 f3                	jne    8b0 <cowtest+0x110>
+    exit();
+     8bd:	e8 ce 08 00 00       	call   1190 <exit>
+     8c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(1, "cow test child read failed\n");
+     8c8:	83 ec 08             	sub    $0x8,%esp
+     8cb:	68 b9 21 00 00       	push   $0x21b9
+     8d0:	6a 01                	push   $0x1
+     8d2:	e8 a9 0f 00 00       	call   1880 <printf>
+      exit();
+     8d7:	e8 b4 08 00 00       	call   1190 <exit>
+      printf(1, "cow test failed: parent saw %c\n", c);
+     8dc:	83 ec 04             	sub    $0x4,%esp
+     8df:	50                   	push   %eax
+     8e0:	68 18 25 00 00       	push   $0x2518
+     8e5:	6a 01                	push   $0x1
+     8e7:	e8 94 0f 00 00       	call   1880 <printf>
+      exit();
+     8ec:	e8 9f 08 00 00       	call   1190 <exit>
+    printf(1, "cow test sbrk failed\n");
+     8f1:	50                   	push   %eax
+     8f2:	50                   	push   %eax
+     8f3:	68 77 21 00 00       	push   $0x2177
+     8f8:	6a 01                	push   $0x1
+     8fa:	e8 81 0f 00 00       	call   1880 <printf>
+    exit();
+     8ff:	e8 8c 08 00 00       	call   1190 <exit>
+    printf(1, "cow test fork failed\n");
+     904:	50                   	push   %eax
+     905:	50                   	push   %eax
+     906:	68 a3 21 00 00       	push   $0x21a3
+     90b:	6a 01                	push   $0x1
+     90d:	e8 6e 0f 00 00       	call   1880 <printf>
+    exit();
+     912:	e8 79 08 00 00       	call   1190 <exit>
+    printf(1, "cow test pipe failed\n");
+     917:	50                   	push   %eax
+     918:	50                   	push   %eax
+     919:	68 8d 21 00 00       	push   $0x218d
+     91e:	6a 01                	push   $0x1
+     920:	e8 5b 0f 00 00       	call   1880 <printf>
+    exit();
+     925:	e8 66 08 00 00       	call   1190 <exit>
+     92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000930 <mmaptest>:
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	57                   	push   %edi
+     934:	56                   	push   %esi
+     935:	53                   	push   %ebx
+     936:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "mmap test\n");
+     939:	68 e4 21 00 00       	push   $0x21e4
+     93e:	6a 01                	push   $0x1
+     940:	e8 3b 0f 00 00       	call   1880 <printf>
+  if(mmap(0, -1, PROT_READ, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0) != MAP_FAILED){
+     945:	58                   	pop    %eax
+     946:	5a                   	pop    %edx
+     947:	6a 00                	push   $0x0
+     949:	6a ff                	push   $0xffffffff
+     94b:	6a 22                	push   $0x22
+     94d:	6a 01                	push   $0x1
+     94f:	6a ff                	push   $0xffffffff
+     951:	6a 00                	push   $0x0
+     953:	e8 03 0d 00 00       	call   165b <mmap>
+     958:	83 c4 20             	add    $0x20,%esp
+     95b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     95e:	0f 85 10 03 00 00    	jne    c74 <mmaptest+0x344>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+     964:	83 ec 08             	sub    $0x8,%esp
+    buf[i] = 'a' + i % 26;
+     967:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+     96c:	68 02 02 00 00       	push   $0x202
+     971:	68 ef 21 00 00       	push   $0x21ef
+     976:	e8 c8 0b 00 00       	call   1543 <open>
+     97b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 6000; i++)
+     97e:	31 c9                	xor    %ecx,%ecx
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+     980:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 6000; i++)
+     982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    buf[i] = 'a' + i % 26;
+     988:	89 c8                	mov    %ecx,%eax
+     98a:	f7 e6                	mul    %esi
+     98c:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 6000; i++)
+     98e:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+     991:	c1 ea 03             	shr    $0x3,%edx
+     994:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     997:	29 d0                	sub    %edx,%eax
+     999:	83 c0 61             	add    $0x61,%eax
+     99c:	88 81 ff 2c 00 00    	mov    %al,0x2cff(%ecx)
+  for(i = 0; i < 6000; i++)
+     9a2:	81 f9 70 17 00 00    	cmp    $0x1770,%ecx
+     9a8:	75 de                	jne    988 <mmaptest+0x58>
+  if(fd < 0 || write(fd, buf, 6000) != 6000){
+     9aa:	85 db                	test   %ebx,%ebx
+     9ac:	0f 88 af 02 00 00    	js     c61 <mmaptest+0x331>
+     9b2:	83 ec 04             	sub    $0x4,%esp
+     9b5:	68 70 17 00 00       	push   $0x1770
+     9ba:	68 00 2d 00 00       	push   $0x2d00
+     9bf:	53                   	push   %ebx
+     9c0:	e8 5e 0b 00 00       	call   1523 <write>
+     9c5:	83 c4 10             	add    $0x10,%esp
+     9c8:	3d 70 17 00 00       	cmp    $0x1770,%eax
+     9cd:	0f 85 8e 02 00 00    	jne    c61 <mmaptest+0x331>
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+     9d3:	83 ec 08             	sub    $0x8,%esp
+     9d6:	6a 00                	push   $0x0
+     9d8:	53                   	push   %ebx
+     9d9:	6a 01                	push   $0x1
+     9db:	6a 03                	push   $0x3
+     9dd:	68 70 17 00 00       	push   $0x1770
+     9e2:	6a 00                	push   $0x0
+     9e4:	e8 72 0c 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED){
+     9e9:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+     9ec:	89 c7                	mov    %eax,%edi
+  if(p == MAP_FAILED){
+     9ee:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9f1:	0f 84 57 02 00 00    	je     c4e <mmaptest+0x31e>
+    if(p[i] != 'a' + i % 26){
+     9f7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  for(i = 0; i < 6000; i++){
+     9fa:	31 c9                	xor    %ecx,%ecx
+    if(p[i] != 'a' + i % 26){
+     9fc:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+     a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a08:	89 c8                	mov    %ecx,%eax
+     a0a:	0f be 1c 0f          	movsbl (%edi,%ecx,1),%ebx
+     a0e:	f7 e6                	mul    %esi
+     a10:	89 c8                	mov    %ecx,%eax
+     a12:	c1 ea 03             	shr    $0x3,%edx
+     a15:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     a18:	29 d0                	sub    %edx,%eax
+     a1a:	83 c0 61             	add    $0x61,%eax
+     a1d:	39 c3                	cmp    %eax,%ebx
+     a1f:	0f 85 14 02 00 00    	jne    c39 <mmaptest+0x309>
+  for(i = 0; i < 6000; i++){
+     a25:	83 c1 01             	add    $0x1,%ecx
+     a28:	81 f9 70 17 00 00    	cmp    $0x1770,%ecx
+     a2e:	75 d8                	jne    a08 <mmaptest+0xd8>
+  if(p[6000] != 0){
+     a30:	80 bf 70 17 00 00 00 	cmpb   $0x0,0x1770(%edi)
+     a37:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     a3a:	0f 85 f6 02 00 00    	jne    d36 <mmaptest+0x406>
+  if(munmap(p, 6000) != 0){
+     a40:	83 ec 08             	sub    $0x8,%esp
+  p[5000] = 'Z';
+     a43:	c6 87 88 13 00 00 5a 	movb   $0x5a,0x1388(%edi)
+  if(munmap(p, 6000) != 0){
+     a4a:	68 70 17 00 00       	push   $0x1770
+     a4f:	57                   	push   %edi
+     a50:	e8 0e 0c 00 00       	call   1663 <munmap>
+     a55:	83 c4 10             	add    $0x10,%esp
+     a58:	85 c0                	test   %eax,%eax
+     a5a:	0f 85 c3 02 00 00    	jne    d23 <mmaptest+0x3f3>
+  close(fd);
+     a60:	83 ec 0c             	sub    $0xc,%esp
+     a63:	53                   	push   %ebx
+     a64:	e8 c2 0a 00 00       	call   152b <close>
+  fd = open("mmapfile", O_RDONLY);
+     a69:	58                   	pop    %eax
+     a6a:	5a                   	pop    %edx
+     a6b:	6a 00                	push   $0x0
+     a6d:	68 ef 21 00 00       	push   $0x21ef
+     a72:	e8 cc 0a 00 00       	call   1543 <open>
+  if(read(fd, buf, 6001) != 6000 || buf[5000] != 'Z'){
+     a77:	83 c4 0c             	add    $0xc,%esp
+     a7a:	68 71 17 00 00       	push   $0x1771
+  fd = open("mmapfile", O_RDONLY);
+     a7f:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, 6001) != 6000 || buf[5000] != 'Z'){
+     a81:	68 00 2d 00 00       	push   $0x2d00
+     a86:	50                   	push   %eax
+     a87:	e8 8f 0a 00 00       	call   151b <read>
+     a8c:	83 c4 10             	add    $0x10,%esp
+     a8f:	3d 70 17 00 00       	cmp    $0x1770,%eax
+     a94:	0f 85 76 02 00 00    	jne    d10 <mmaptest+0x3e0>
+     a9a:	80 3d 88 40 00 00 5a 	cmpb   $0x5a,0x4088
+     aa1:	0f 85 69 02 00 00    	jne    d10 <mmaptest+0x3e0>
+  close(fd);
+     aa7:	83 ec 0c             	sub    $0xc,%esp
+     aaa:	53                   	push   %ebx
+     aab:	e8 7b 0a 00 00       	call   152b <close>
+  fd = open("mmapfile", O_RDWR);
+     ab0:	58                   	pop    %eax
+     ab1:	5a                   	pop    %edx
+     ab2:	6a 02                	push   $0x2
+     ab4:	68 ef 21 00 00       	push   $0x21ef
+     ab9:	e8 85 0a 00 00       	call   1543 <open>
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+     abe:	59                   	pop    %ecx
+     abf:	5e                   	pop    %esi
+     ac0:	6a 00                	push   $0x0
+     ac2:	50                   	push   %eax
+  fd = open("mmapfile", O_RDWR);
+     ac3:	89 c3                	mov    %eax,%ebx
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+     ac5:	6a 02                	push   $0x2
+     ac7:	6a 03                	push   $0x3
+     ac9:	68 70 17 00 00       	push   $0x1770
+     ace:	6a 00                	push   $0x0
+     ad0:	e8 86 0b 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED || p[5000] != 'Z'){
+     ad5:	83 c4 20             	add    $0x20,%esp
+     ad8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     adb:	0f 84 1c 02 00 00    	je     cfd <mmaptest+0x3cd>
+     ae1:	80 b8 88 13 00 00 5a 	cmpb   $0x5a,0x1388(%eax)
+     ae8:	0f 85 0f 02 00 00    	jne    cfd <mmaptest+0x3cd>
+  munmap(p, 6000);
+     aee:	83 ec 08             	sub    $0x8,%esp
+  p[5000] = 'Y';
+     af1:	c6 80 88 13 00 00 59 	movb   $0x59,0x1388(%eax)
+  munmap(p, 6000);
+     af8:	68 70 17 00 00       	push   $0x1770
+     afd:	50                   	push   %eax
+     afe:	e8 60 0b 00 00       	call   1663 <munmap>
+  p = mmap(0, 6000, PROT_READ, MAP_PRIVATE, fd, 0);
+     b03:	5e                   	pop    %esi
+     b04:	5f                   	pop    %edi
+     b05:	6a 00                	push   $0x0
+     b07:	53                   	push   %ebx
+     b08:	6a 02                	push   $0x2
+     b0a:	6a 01                	push   $0x1
+     b0c:	68 70 17 00 00       	push   $0x1770
+     b11:	6a 00                	push   $0x0
+     b13:	e8 43 0b 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED || p[5000] != 'Z'){
+     b18:	83 c4 20             	add    $0x20,%esp
+     b1b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b1e:	0f 84 c6 01 00 00    	je     cea <mmaptest+0x3ba>
+     b24:	80 b8 88 13 00 00 5a 	cmpb   $0x5a,0x1388(%eax)
+     b2b:	0f 85 b9 01 00 00    	jne    cea <mmaptest+0x3ba>
+  munmap(p, 6000);
+     b31:	83 ec 08             	sub    $0x8,%esp
+     b34:	68 70 17 00 00       	push   $0x1770
+     b39:	50                   	push   %eax
+     b3a:	e8 24 0b 00 00       	call   1663 <munmap>
+  write(fd, buf, 6000);
+     b3f:	83 c4 0c             	add    $0xc,%esp
+  buf[5000] = 'W';
+     b42:	c6 05 88 40 00 00 57 	movb   $0x57,0x4088
+  write(fd, buf, 6000);
+     b49:	68 70 17 00 00       	push   $0x1770
+     b4e:	68 00 2d 00 00       	push   $0x2d00
+     b53:	53                   	push   %ebx
+     b54:	e8 ca 09 00 00       	call   1523 <write>
+  p = mmap(0, 6000, PROT_READ, MAP_PRIVATE, fd, 0);
+     b59:	58                   	pop    %eax
+     b5a:	5a                   	pop    %edx
+     b5b:	6a 00                	push   $0x0
+     b5d:	53                   	push   %ebx
+     b5e:	6a 02                	push   $0x2
+     b60:	6a 01                	push   $0x1
+     b62:	68 70 17 00 00       	push   $0x1770
+     b67:	6a 00                	push   $0x0
+     b69:	e8 ed 0a 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED || p[5000] != 'W'){
+     b6e:	83 c4 20             	add    $0x20,%esp
+     b71:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b74:	0f 84 5d 01 00 00    	je     cd7 <mmaptest+0x3a7>
+     b7a:	80 b8 88 13 00 00 57 	cmpb   $0x57,0x1388(%eax)
+     b81:	0f 85 50 01 00 00    	jne    cd7 <mmaptest+0x3a7>
+  munmap(p, 6000);
+     b87:	83 ec 08             	sub    $0x8,%esp
+     b8a:	68 70 17 00 00       	push   $0x1770
+     b8f:	50                   	push   %eax
+     b90:	e8 ce 0a 00 00       	call   1663 <munmap>
+  close(fd);
+     b95:	89 1c 24             	mov    %ebx,(%esp)
+     b98:	e8 8e 09 00 00       	call   152b <close>
+  unlink("mmapfile");
+     b9d:	c7 04 24 ef 21 00 00 	movl   $0x21ef,(%esp)
+     ba4:	e8 aa 09 00 00       	call   1553 <unlink>
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	6a 00                	push   $0x0
+     bad:	6a ff                	push   $0xffffffff
+     baf:	6a 21                	push   $0x21
+     bb1:	6a 03                	push   $0x3
+     bb3:	68 00 30 00 00       	push   $0x3000
+     bb8:	6a 00                	push   $0x0
+     bba:	e8 9c 0a 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED || p[4096] != 0){
+     bbf:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+     bc2:	89 c3                	mov    %eax,%ebx
+  if(p == MAP_FAILED || p[4096] != 0){
+     bc4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     bc7:	0f 84 f7 00 00 00    	je     cc4 <mmaptest+0x394>
+     bcd:	80 b8 00 10 00 00 00 	cmpb   $0x0,0x1000(%eax)
+     bd4:	0f 85 ea 00 00 00    	jne    cc4 <mmaptest+0x394>
+  pid = fork();
+     bda:	e8 81 05 00 00       	call   1160 <fork>
+  if(pid == 0){
+     bdf:	85 c0                	test   %eax,%eax
+     be1:	0f 84 d1 00 00 00    	je     cb8 <mmaptest+0x388>
+  wait();
+     be7:	e8 1f 09 00 00       	call   150b <wait>
+  if(p[4096] != 'c'){
+     bec:	80 bb 00 10 00 00 63 	cmpb   $0x63,0x1000(%ebx)
+     bf3:	0f 85 ac 00 00 00    	jne    ca5 <mmaptest+0x375>
+  munmap(p, 3*4096);
+     bf9:	83 ec 08             	sub    $0x8,%esp
+     bfc:	68 00 30 00 00       	push   $0x3000
+     c01:	53                   	push   %ebx
+     c02:	e8 5c 0a 00 00       	call   1663 <munmap>
+  ppid = getpid();
+     c07:	e8 77 09 00 00       	call   1583 <getpid>
+     c0c:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     c0e:	e8 4d 05 00 00       	call   1160 <fork>
+  if(pid == 0){
+     c13:	83 c4 10             	add    $0x10,%esp
+     c16:	85 c0                	test   %eax,%eax
+     c18:	74 6d                	je     c87 <mmaptest+0x357>
+  wait();
+     c1a:	e8 ec 08 00 00       	call   150b <wait>
+  printf(1, "mmap test OK\n");
+     c1f:	83 ec 08             	sub    $0x8,%esp
+     c22:	68 98 22 00 00       	push   $0x2298
+     c27:	6a 01                	push   $0x1
+     c29:	e8 52 0c 00 00       	call   1880 <printf>
+}
+     c2e:	83 c4 10             	add    $0x10,%esp
+     c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c34:	5b                   	pop    %ebx
+     c35:	5e                   	pop    %esi
+     c36:	5f                   	pop    %edi
+     c37:	5d                   	pop    %ebp
+     c38:	c3                   	ret
+      printf(1, "mmap test wrong data at %d\n", i);
+     c39:	83 ec 04             	sub    $0x4,%esp
+     c3c:	51                   	push   %ecx
+     c3d:	68 28 22 00 00       	push   $0x2228
+     c42:	6a 01                	push   $0x1
+     c44:	e8 37 0c 00 00       	call   1880 <printf>
+      exit();
+     c49:	e8 42 05 00 00       	call   1190 <exit>
+    printf(1, "mmap test mmap failed\n");
+     c4e:	56                   	push   %esi
+     c4f:	56                   	push   %esi
+     c50:	68 11 22 00 00       	push   $0x2211
+     c55:	6a 01                	push   $0x1
+     c57:	e8 24 0c 00 00       	call   1880 <printf>
+    exit();
+     c5c:	e8 2f 05 00 00       	call   1190 <exit>
+    printf(1, "mmap test create failed\n");
+     c61:	57                   	push   %edi
+     c62:	57                   	push   %edi
+     c63:	68 f8 21 00 00       	push   $0x21f8
+     c68:	6a 01                	push   $0x1
+     c6a:	e8 11 0c 00 00       	call   1880 <printf>
+    exit();
+     c6f:	e8 1c 05 00 00       	call   1190 <exit>
+    printf(1, "mmap test mapped a length that rounds to 0\n");
+     c74:	50                   	push   %eax
+     c75:	50                   	push   %eax
+     c76:	68 38 25 00 00       	push   $0x2538
+     c7b:	6a 01                	push   $0x1
+     c7d:	e8 fe 0b 00 00       	call   1880 <printf>
+    exit();
+     c82:	e8 09 05 00 00       	call   1190 <exit>
+    p[0] = 1;
+     c87:	c6 03 01             	movb   $0x1,(%ebx)
+    printf(1, "mmap test unmapped page still mapped\n");
+     c8a:	50                   	push   %eax
+     c8b:	50                   	push   %eax
+     c8c:	68 24 26 00 00       	push   $0x2624
+     c91:	6a 01                	push   $0x1
+     c93:	e8 e8 0b 00 00       	call   1880 <printf>
+    kill(ppid);
+     c98:	89 34 24             	mov    %esi,(%esp)
+     c9b:	e8 93 08 00 00       	call   1533 <kill>
+    exit();
+     ca0:	e8 eb 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test shared page not shared\n");
+     ca5:	52                   	push   %edx
+     ca6:	52                   	push   %edx
+     ca7:	68 00 26 00 00       	push   $0x2600
+     cac:	6a 01                	push   $0x1
+     cae:	e8 cd 0b 00 00       	call   1880 <printf>
+    exit();
+     cb3:	e8 d8 04 00 00       	call   1190 <exit>
+    p[4096] = 'c';
+     cb8:	c6 83 00 10 00 00 63 	movb   $0x63,0x1000(%ebx)
+    exit();
+     cbf:	e8 cc 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test anonymous mmap failed\n");
+     cc4:	51                   	push   %ecx
+     cc5:	51                   	push   %ecx
+     cc6:	68 dc 25 00 00       	push   $0x25dc
+     ccb:	6a 01                	push   $0x1
+     ccd:	e8 ae 0b 00 00       	call   1880 <printf>
+    exit();
+     cd2:	e8 b9 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test private mapping missed a write\n");
+     cd7:	57                   	push   %edi
+     cd8:	57                   	push   %edi
+     cd9:	68 b0 25 00 00       	push   $0x25b0
+     cde:	6a 01                	push   $0x1
+     ce0:	e8 9b 0b 00 00       	call   1880 <printf>
+    exit();
+     ce5:	e8 a6 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test private write reached the file\n");
+     cea:	51                   	push   %ecx
+     ceb:	51                   	push   %ecx
+     cec:	68 84 25 00 00       	push   $0x2584
+     cf1:	6a 01                	push   $0x1
+     cf3:	e8 88 0b 00 00       	call   1880 <printf>
+    exit();
+     cf8:	e8 93 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test private mmap failed\n");
+     cfd:	50                   	push   %eax
+     cfe:	50                   	push   %eax
+     cff:	68 64 25 00 00       	push   $0x2564
+     d04:	6a 01                	push   $0x1
+     d06:	e8 75 0b 00 00       	call   1880 <printf>
+    exit();
+     d0b:	e8 80 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test write-back failed\n");
+     d10:	57                   	push   %edi
+     d11:	57                   	push   %edi
+     d12:	68 7b 22 00 00       	push   $0x227b
+     d17:	6a 01                	push   $0x1
+     d19:	e8 62 0b 00 00       	call   1880 <printf>
+    exit();
+     d1e:	e8 6d 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test munmap failed\n");
+     d23:	51                   	push   %ecx
+     d24:	51                   	push   %ecx
+     d25:	68 62 22 00 00       	push   $0x2262
+     d2a:	6a 01                	push   $0x1
+     d2c:	e8 4f 0b 00 00       	call   1880 <printf>
+    exit();
+     d31:	e8 5a 04 00 00       	call   1190 <exit>
+    printf(1, "mmap test page tail not zero\n");
+     d36:	53                   	push   %ebx
+     d37:	53                   	push   %ebx
+     d38:	68 44 22 00 00       	push   $0x2244
+     d3d:	6a 01                	push   $0x1
+     d3f:	e8 3c 0b 00 00       	call   1880 <printf>
+    exit();
+     d44:	e8 47 04 00 00       	call   1190 <exit>
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <shmtest>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+  printf(1, "shm test\n");
+     d55:	83 ec 08             	sub    $0x8,%esp
+     d58:	68 a6 22 00 00       	push   $0x22a6
+     d5d:	6a 01                	push   $0x1
+     d5f:	e8 1c 0b 00 00       	call   1880 <printf>
+  id = shmget(1234, 2*4096);
+     d64:	5e                   	pop    %esi
+     d65:	58                   	pop    %eax
+     d66:	68 00 20 00 00       	push   $0x2000
+     d6b:	68 d2 04 00 00       	push   $0x4d2
+     d70:	e8 f6 08 00 00       	call   166b <shmget>
+  if(id < 0 || shmget(1234, 4096) != id){
+     d75:	83 c4 10             	add    $0x10,%esp
+     d78:	85 c0                	test   %eax,%eax
+     d7a:	0f 88 0d 01 00 00    	js     e8d <shmtest+0x13d>
+     d80:	83 ec 08             	sub    $0x8,%esp
+     d83:	89 c3                	mov    %eax,%ebx
+     d85:	68 00 10 00 00       	push   $0x1000
+     d8a:	68 d2 04 00 00       	push   $0x4d2
+     d8f:	e8 d7 08 00 00       	call   166b <shmget>
+     d94:	83 c4 10             	add    $0x10,%esp
+     d97:	89 c6                	mov    %eax,%esi
+     d99:	39 d8                	cmp    %ebx,%eax
+     d9b:	0f 85 ec 00 00 00    	jne    e8d <shmtest+0x13d>
+  p = shmat(id);
+     da1:	83 ec 0c             	sub    $0xc,%esp
+     da4:	50                   	push   %eax
+     da5:	e8 c9 08 00 00       	call   1673 <shmat>
+  if(p == (char*)-1 || p[4096] != 0){
+     daa:	83 c4 10             	add    $0x10,%esp
+  p = shmat(id);
+     dad:	89 c3                	mov    %eax,%ebx
+  if(p == (char*)-1 || p[4096] != 0){
+     daf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     db2:	0f 84 e8 00 00 00    	je     ea0 <shmtest+0x150>
+     db8:	80 b8 00 10 00 00 00 	cmpb   $0x0,0x1000(%eax)
+     dbf:	0f 85 db 00 00 00    	jne    ea0 <shmtest+0x150>
+  p[0] = 'p';
+     dc5:	c6 00 70             	movb   $0x70,(%eax)
+  pid = fork();
+     dc8:	e8 93 03 00 00       	call   1160 <fork>
+  if(pid == 0){
+     dcd:	85 c0                	test   %eax,%eax
+     dcf:	74 67                	je     e38 <shmtest+0xe8>
+  wait();
+     dd1:	e8 35 07 00 00       	call   150b <wait>
+  if(p[4096] != 'c'){
+     dd6:	80 bb 00 10 00 00 63 	cmpb   $0x63,0x1000(%ebx)
+     ddd:	0f 85 e3 00 00 00    	jne    ec6 <shmtest+0x176>
+  if(shmrm(id) != 0 || p[4096] != 'c' || shmdt(p) != 0){
+     de3:	83 ec 0c             	sub    $0xc,%esp
+     de6:	56                   	push   %esi
+     de7:	e8 97 08 00 00       	call   1683 <shmrm>
+     dec:	83 c4 10             	add    $0x10,%esp
+     def:	85 c0                	test   %eax,%eax
+     df1:	0f 85 bc 00 00 00    	jne    eb3 <shmtest+0x163>
+     df7:	80 bb 00 10 00 00 63 	cmpb   $0x63,0x1000(%ebx)
+     dfe:	0f 85 af 00 00 00    	jne    eb3 <shmtest+0x163>
+     e04:	83 ec 0c             	sub    $0xc,%esp
+     e07:	53                   	push   %ebx
+     e08:	e8 6e 08 00 00       	call   167b <shmdt>
+     e0d:	83 c4 10             	add    $0x10,%esp
+     e10:	85 c0                	test   %eax,%eax
+     e12:	0f 85 9b 00 00 00    	jne    eb3 <shmtest+0x163>
+  printf(1, "shm test OK\n");
+     e18:	83 ec 08             	sub    $0x8,%esp
+     e1b:	68 2f 23 00 00       	push   $0x232f
+     e20:	6a 01                	push   $0x1
+     e22:	e8 59 0a 00 00       	call   1880 <printf>
+}
+     e27:	83 c4 10             	add    $0x10,%esp
+     e2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e2d:	5b                   	pop    %ebx
+     e2e:	5e                   	pop    %esi
+     e2f:	5d                   	pop    %ebp
+     e30:	c3                   	ret
+     e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    char *q = shmat(shmget(1234, 2*4096));
+     e38:	83 ec 08             	sub    $0x8,%esp
+     e3b:	68 00 20 00 00       	push   $0x2000
+     e40:	68 d2 04 00 00       	push   $0x4d2
+     e45:	e8 21 08 00 00       	call   166b <shmget>
+     e4a:	89 04 24             	mov    %eax,(%esp)
+     e4d:	e8 21 08 00 00       	call   1673 <shmat>
+    if(q == (char*)-1 || q[0] != 'p'){
+     e52:	83 c4 10             	add    $0x10,%esp
+     e55:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e58:	74 05                	je     e5f <shmtest+0x10f>
+     e5a:	80 38 70             	cmpb   $0x70,(%eax)
+     e5d:	74 19                	je     e78 <shmtest+0x128>
+      printf(1, "shm test child saw no data\n");
+     e5f:	83 ec 08             	sub    $0x8,%esp
+     e62:	68 df 22 00 00       	push   $0x22df
+     e67:	6a 01                	push   $0x1
+     e69:	e8 12 0a 00 00       	call   1880 <printf>
+      exit();
+     e6e:	e8 1d 03 00 00       	call   1190 <exit>
+     e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e77:	90                   	nop
+    shmdt(q);
+     e78:	83 ec 0c             	sub    $0xc,%esp
+    q[4096] = 'c';
+     e7b:	c6 80 00 10 00 00 63 	movb   $0x63,0x1000(%eax)
+    shmdt(q);
+     e82:	50                   	push   %eax
+     e83:	e8 f3 07 00 00       	call   167b <shmdt>
+    exit();
+     e88:	e8 03 03 00 00       	call   1190 <exit>
+    printf(1, "shm test shmget failed\n");
+     e8d:	53                   	push   %ebx
+     e8e:	53                   	push   %ebx
+     e8f:	68 b0 22 00 00       	push   $0x22b0
+     e94:	6a 01                	push   $0x1
+     e96:	e8 e5 09 00 00       	call   1880 <printf>
+    exit();
+     e9b:	e8 f0 02 00 00       	call   1190 <exit>
+    printf(1, "shm test shmat failed\n");
+     ea0:	51                   	push   %ecx
+     ea1:	51                   	push   %ecx
+     ea2:	68 c8 22 00 00       	push   $0x22c8
+     ea7:	6a 01                	push   $0x1
+     ea9:	e8 d2 09 00 00       	call   1880 <printf>
+    exit();
+     eae:	e8 dd 02 00 00       	call   1190 <exit>
+    printf(1, "shm test shmrm failed\n");
+     eb3:	50                   	push   %eax
+     eb4:	50                   	push   %eax
+     eb5:	68 18 23 00 00       	push   $0x2318
+     eba:	6a 01                	push   $0x1
+     ebc:	e8 bf 09 00 00       	call   1880 <printf>
+    exit();
+     ec1:	e8 ca 02 00 00       	call   1190 <exit>
+    printf(1, "shm test parent saw no data\n");
+     ec6:	52                   	push   %edx
+     ec7:	52                   	push   %edx
+     ec8:	68 fb 22 00 00       	push   $0x22fb
+     ecd:	6a 01                	push   $0x1
+     ecf:	e8 ac 09 00 00       	call   1880 <printf>
+    exit();
+     ed4:	e8 b7 02 00 00       	call   1190 <exit>
+     ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ee0 <memstattest>:
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	53                   	push   %ebx
+     ee4:	83 ec 7c             	sub    $0x7c,%esp
+  printf(1, "memstat test\n");
+     ee7:	68 3c 23 00 00       	push   $0x233c
+     eec:	6a 01                	push   $0x1
+     eee:	e8 8d 09 00 00       	call   1880 <printf>
+  if(memstat(0, &before) < 0 || before.rss == 0 || before.free > before.total){
+     ef3:	58                   	pop    %eax
+     ef4:	8d 45 90             	lea    -0x70(%ebp),%eax
+     ef7:	5a                   	pop    %edx
+     ef8:	50                   	push   %eax
+     ef9:	6a 00                	push   $0x0
+     efb:	e8 93 07 00 00       	call   1693 <memstat>
+     f00:	83 c4 10             	add    $0x10,%esp
+     f03:	85 c0                	test   %eax,%eax
+     f05:	0f 88 9d 00 00 00    	js     fa8 <memstattest+0xc8>
+     f0b:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     f0e:	85 c0                	test   %eax,%eax
+     f10:	0f 84 92 00 00 00    	je     fa8 <memstattest+0xc8>
+     f16:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     f19:	39 45 90             	cmp    %eax,-0x70(%ebp)
+     f1c:	0f 82 86 00 00 00    	jb     fa8 <memstattest+0xc8>
+  a = sbrk(10*4096);
+     f22:	83 ec 0c             	sub    $0xc,%esp
+     f25:	68 00 a0 00 00       	push   $0xa000
+     f2a:	e8 5c 06 00 00       	call   158b <sbrk>
+  for(i = 0; i < 10; i++)
+     f2f:	83 c4 10             	add    $0x10,%esp
+     f32:	8d 90 00 a0 00 00    	lea    0xa000(%eax),%edx
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+    a[i*4096] = 1;
+     f40:	c6 00 01             	movb   $0x1,(%eax)
+  for(i = 0; i < 10; i++)
+     f43:	05 00 10 00 00       	add    $0x1000,%eax
+     f48:	39 d0                	cmp    %edx,%eax
+     f4a:	75 f4                	jne    f40 <memstattest+0x60>
+  if(memstat(getpid(), &after) < 0 || after.rss < before.rss + 10){
+     f4c:	e8 32 06 00 00       	call   1583 <getpid>
+     f51:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+     f54:	83 ec 08             	sub    $0x8,%esp
+     f57:	53                   	push   %ebx
+     f58:	50                   	push   %eax
+     f59:	e8 35 07 00 00       	call   1693 <memstat>
+     f5e:	83 c4 10             	add    $0x10,%esp
+     f61:	85 c0                	test   %eax,%eax
+     f63:	78 57                	js     fbc <memstattest+0xdc>
+     f65:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     f68:	83 c0 0a             	add    $0xa,%eax
+     f6b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     f6e:	72 4c                	jb     fbc <memstattest+0xdc>
+  sbrk(-10*4096);
+     f70:	83 ec 0c             	sub    $0xc,%esp
+     f73:	68 00 60 ff ff       	push   $0xffff6000
+     f78:	e8 0e 06 00 00       	call   158b <sbrk>
+  if(memstat(1000000, &after) >= 0){
+     f7d:	5a                   	pop    %edx
+     f7e:	59                   	pop    %ecx
+     f7f:	53                   	push   %ebx
+     f80:	68 40 42 0f 00       	push   $0xf4240
+     f85:	e8 09 07 00 00       	call   1693 <memstat>
+     f8a:	83 c4 10             	add    $0x10,%esp
+     f8d:	85 c0                	test   %eax,%eax
+     f8f:	79 3e                	jns    fcf <memstattest+0xef>
+  printf(1, "memstat test OK\n");
+     f91:	83 ec 08             	sub    $0x8,%esp
+     f94:	68 64 23 00 00       	push   $0x2364
+     f99:	6a 01                	push   $0x1
+     f9b:	e8 e0 08 00 00       	call   1880 <printf>
+}
+     fa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fa3:	83 c4 10             	add    $0x10,%esp
+     fa6:	c9                   	leave
+     fa7:	c3                   	ret
+    printf(1, "memstat test bad numbers\n");
+     fa8:	83 ec 08             	sub    $0x8,%esp
+     fab:	68 4a 23 00 00       	push   $0x234a
+     fb0:	6a 01                	push   $0x1
+     fb2:	e8 c9 08 00 00       	call   1880 <printf>
+    exit();
+     fb7:	e8 d4 01 00 00       	call   1190 <exit>
+    printf(1, "memstat test resident pages not counted\n");
+     fbc:	53                   	push   %ebx
+     fbd:	53                   	push   %ebx
+     fbe:	68 4c 26 00 00       	push   $0x264c
+     fc3:	6a 01                	push   $0x1
+     fc5:	e8 b6 08 00 00       	call   1880 <printf>
+    exit();
+     fca:	e8 c1 01 00 00       	call   1190 <exit>
+    printf(1, "memstat test found a missing process\n");
+     fcf:	50                   	push   %eax
+     fd0:	50                   	push   %eax
+     fd1:	68 78 26 00 00       	push   $0x2678
+     fd6:	6a 01                	push   $0x1
+     fd8:	e8 a3 08 00 00       	call   1880 <printf>
+    exit();
+     fdd:	e8 ae 01 00 00       	call   1190 <exit>
+     fe2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <swaptest>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	81 ec 94 00 00 00    	sub    $0x94,%esp
+  printf(1, "swap test\n");
+     ffc:	68 75 23 00 00       	push   $0x2375
+    1001:	6a 01                	push   $0x1
+    1003:	e8 78 08 00 00       	call   1880 <printf>
+  if(memstat(0, &before) < 0 || before.swapfree < 64){
+    1008:	58                   	pop    %eax
+    1009:	8d 45 80             	lea    -0x80(%ebp),%eax
+    100c:	5a                   	pop    %edx
+    100d:	50                   	push   %eax
+    100e:	6a 00                	push   $0x0
+    1010:	e8 7e 06 00 00       	call   1693 <memstat>
+    1015:	83 c4 10             	add    $0x10,%esp
+    1018:	85 c0                	test   %eax,%eax
+    101a:	78 08                	js     1024 <swaptest+0x34>
+    101c:	8b 7d a0             	mov    -0x60(%ebp),%edi
+    101f:	83 ff 3f             	cmp    $0x3f,%edi
+    1022:	77 1c                	ja     1040 <swaptest+0x50>
+    printf(1, "swap test: no swap area, skipped\n");
+    1024:	83 ec 08             	sub    $0x8,%esp
+    1027:	68 a0 26 00 00       	push   $0x26a0
+    102c:	6a 01                	push   $0x1
+    102e:	e8 4d 08 00 00       	call   1880 <printf>
+    1033:	83 c4 10             	add    $0x10,%esp
+}
+    1036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1039:	5b                   	pop    %ebx
+    103a:	5e                   	pop    %esi
+    103b:	5f                   	pop    %edi
+    103c:	5d                   	pop    %ebp
+    103d:	c3                   	ret
+    103e:	66 90                	xchg   %ax,%ax
+  n = before.free + before.swapfree / 2;
+    1040:	d1 ef                	shr    %edi
+    1042:	03 7d 84             	add    -0x7c(%ebp),%edi
+  p = mmap(0, n*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    1045:	83 ec 08             	sub    $0x8,%esp
+    1048:	89 fe                	mov    %edi,%esi
+    104a:	6a 00                	push   $0x0
+    104c:	c1 e6 0c             	shl    $0xc,%esi
+    104f:	6a ff                	push   $0xffffffff
+    1051:	6a 22                	push   $0x22
+    1053:	6a 03                	push   $0x3
+    1055:	56                   	push   %esi
+    1056:	6a 00                	push   $0x0
+    1058:	e8 fe 05 00 00       	call   165b <mmap>
+  if(p == MAP_FAILED){
+    105d:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, n*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    1060:	89 c2                	mov    %eax,%edx
+  if(p == MAP_FAILED){
+    1062:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1065:	0f 84 cb 00 00 00    	je     1136 <swaptest+0x146>
+  for(i = 0; i < n; i++)
+    106b:	31 c0                	xor    %eax,%eax
+    106d:	85 ff                	test   %edi,%edi
+    106f:	7e 16                	jle    1087 <swaptest+0x97>
+    1071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    *(int*)(p + i*4096) = i;
+    1078:	89 c1                	mov    %eax,%ecx
+    107a:	c1 e1 0c             	shl    $0xc,%ecx
+    107d:	89 04 0a             	mov    %eax,(%edx,%ecx,1)
+  for(i = 0; i < n; i++)
+    1080:	83 c0 01             	add    $0x1,%eax
+    1083:	39 c7                	cmp    %eax,%edi
+    1085:	75 f1                	jne    1078 <swaptest+0x88>
+  if(memstat(0, &after) < 0 || after.swapped == 0){
+    1087:	83 ec 08             	sub    $0x8,%esp
+    108a:	8d 5d b4             	lea    -0x4c(%ebp),%ebx
+    108d:	89 95 74 ff ff ff    	mov    %edx,-0x8c(%ebp)
+    1093:	53                   	push   %ebx
+    1094:	6a 00                	push   $0x0
+    1096:	e8 f8 05 00 00       	call   1693 <memstat>
+    109b:	83 c4 10             	add    $0x10,%esp
+    109e:	85 c0                	test   %eax,%eax
+    10a0:	0f 88 a3 00 00 00    	js     1149 <swaptest+0x159>
+    10a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    10a9:	85 c0                	test   %eax,%eax
+    10ab:	0f 84 98 00 00 00    	je     1149 <swaptest+0x159>
+  for(i = 0; i < n; i++){
+    10b1:	31 c0                	xor    %eax,%eax
+    10b3:	85 ff                	test   %edi,%edi
+    10b5:	8b 95 74 ff ff ff    	mov    -0x8c(%ebp),%edx
+    10bb:	7e 14                	jle    10d1 <swaptest+0xe1>
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*(int*)(p + i*4096) != i){
+    10c0:	89 c1                	mov    %eax,%ecx
+    10c2:	c1 e1 0c             	shl    $0xc,%ecx
+    10c5:	39 04 0a             	cmp    %eax,(%edx,%ecx,1)
+    10c8:	75 44                	jne    110e <swaptest+0x11e>
+  for(i = 0; i < n; i++){
+    10ca:	83 c0 01             	add    $0x1,%eax
+    10cd:	39 c7                	cmp    %eax,%edi
+    10cf:	75 ef                	jne    10c0 <swaptest+0xd0>
+  munmap(p, n*4096);
+    10d1:	83 ec 08             	sub    $0x8,%esp
+    10d4:	56                   	push   %esi
+    10d5:	52                   	push   %edx
+    10d6:	e8 88 05 00 00       	call   1663 <munmap>
+  if(memstat(0, &after) < 0 || after.swapfree < before.swapfree){
+    10db:	5a                   	pop    %edx
+    10dc:	59                   	pop    %ecx
+    10dd:	53                   	push   %ebx
+    10de:	6a 00                	push   $0x0
+    10e0:	e8 ae 05 00 00       	call   1693 <memstat>
+    10e5:	83 c4 10             	add    $0x10,%esp
+    10e8:	85 c0                	test   %eax,%eax
+    10ea:	78 37                	js     1123 <swaptest+0x133>
+    10ec:	8b 45 a0             	mov    -0x60(%ebp),%eax
+    10ef:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+    10f2:	72 2f                	jb     1123 <swaptest+0x133>
+  printf(1, "swap test OK\n");
+    10f4:	83 ec 08             	sub    $0x8,%esp
+    10f7:	68 cf 23 00 00       	push   $0x23cf
+    10fc:	6a 01                	push   $0x1
+    10fe:	e8 7d 07 00 00       	call   1880 <printf>
+    1103:	83 c4 10             	add    $0x10,%esp
+}
+    1106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1109:	5b                   	pop    %ebx
+    110a:	5e                   	pop    %esi
+    110b:	5f                   	pop    %edi
+    110c:	5d                   	pop    %ebp
+    110d:	c3                   	ret
+      printf(1, "swap test page %d lost its contents\n", i);
+    110e:	83 ec 04             	sub    $0x4,%esp
+    1111:	50                   	push   %eax
+    1112:	68 c4 26 00 00       	push   $0x26c4
+    1117:	6a 01                	push   $0x1
+    1119:	e8 62 07 00 00       	call   1880 <printf>
+      exit();
+    111e:	e8 6d 00 00 00       	call   1190 <exit>
+    printf(1, "swap test slots not freed\n");
+    1123:	50                   	push   %eax
+    1124:	50                   	push   %eax
+    1125:	68 b4 23 00 00       	push   $0x23b4
+    112a:	6a 01                	push   $0x1
+    112c:	e8 4f 07 00 00       	call   1880 <printf>
+    exit();
+    1131:	e8 5a 00 00 00       	call   1190 <exit>
+    printf(1, "swap test mmap failed\n");
+    1136:	50                   	push   %eax
+    1137:	50                   	push   %eax
+    1138:	68 80 23 00 00       	push   $0x2380
+    113d:	6a 01                	push   $0x1
+    113f:	e8 3c 07 00 00       	call   1880 <printf>
+    exit();
+    1144:	e8 47 00 00 00       	call   1190 <exit>
+    printf(1, "swap test nothing paged out\n");
+    1149:	53                   	push   %ebx
+    114a:	53                   	push   %ebx
+    114b:	68 97 23 00 00       	push   $0x2397
+    1150:	6a 01                	push   $0x1
+    1152:	e8 29 07 00 00       	call   1880 <printf>
+    exit();
+    1157:	e8 34 00 00 00       	call   1190 <exit>
+    115c:	66 90                	xchg   %ax,%ax
+    115e:	66 90                	xchg   %ax,%ax
+
+00001160 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+    1160:	a1 00 4d 00 00       	mov    0x4d00,%eax
+    1165:	85 c0                	test   %eax,%eax
+    1167:	74 17                	je     1180 <fork+0x20>
+{
+    1169:	55                   	push   %ebp
+    116a:	89 e5                	mov    %esp,%ebp
+    116c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+    116f:	ff d0                	call   *%eax
+  return _fork();
+}
+    1171:	c9                   	leave
+  return _fork();
+    1172:	e9 84 03 00 00       	jmp    14fb <_fork>
+    1177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117e:	66 90                	xchg   %ax,%ax
+    1180:	e9 76 03 00 00       	jmp    14fb <_fork>
+    1185:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001190 <exit>:
+
+int
+exit(void)
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+    1196:	a1 00 4d 00 00       	mov    0x4d00,%eax
+    119b:	85 c0                	test   %eax,%eax
+    119d:	74 02                	je     11a1 <exit+0x11>
+    stdioflush();
+    119f:	ff d0                	call   *%eax
+  _exit();
+    11a1:	e8 5d 03 00 00       	call   1503 <_exit>
+    11a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000011b0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    11b0:	55                   	push   %ebp
+  if(stdioflush)
+    11b1:	a1 00 4d 00 00       	mov    0x4d00,%eax
+{
+    11b6:	89 e5                	mov    %esp,%ebp
+    11b8:	56                   	push   %esi
+    11b9:	53                   	push   %ebx
+    11ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	74 02                	je     11c6 <exec+0x16>
+    stdioflush();
+    11c4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    11c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    11c9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    11cc:	5b                   	pop    %ebx
+    11cd:	5e                   	pop    %esi
+    11ce:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    11cf:	e9 67 03 00 00       	jmp    153b <_exec>
+    11d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11df:	90                   	nop
+
+000011e0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+    11e5:	53                   	push   %ebx
+    11e6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+    11e9:	a1 00 4d 00 00       	mov    0x4d00,%eax
+{
+    11ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    11f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+    11f4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+    11f7:	85 c0                	test   %eax,%eax
+    11f9:	74 02                	je     11fd <spawn+0x1d>
+    stdioflush();
+    11fb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+    11fd:	89 7d 10             	mov    %edi,0x10(%ebp)
+    1200:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1203:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1206:	83 c4 0c             	add    $0xc,%esp
+    1209:	5b                   	pop    %ebx
+    120a:	5e                   	pop    %esi
+    120b:	5f                   	pop    %edi
+    120c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+    120d:	e9 79 04 00 00       	jmp    168b <_spawn>
+    1212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+    1220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1221:	31 c0                	xor    %eax,%eax
+{
+    1223:	89 e5                	mov    %esp,%ebp
+    1225:	53                   	push   %ebx
+    1226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    122c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1237:	83 c0 01             	add    $0x1,%eax
+    123a:	84 d2                	test   %dl,%dl
+    123c:	75 f2                	jne    1230 <strcpy+0x10>
+    ;
+  return os;
+}
+    123e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1241:	89 c8                	mov    %ecx,%eax
+    1243:	c9                   	leave
+    1244:	c3                   	ret
+    1245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1250:	55                   	push   %ebp
+    1251:	89 e5                	mov    %esp,%ebp
+    1253:	53                   	push   %ebx
+    1254:	8b 55 08             	mov    0x8(%ebp),%edx
+    1257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    125a:	0f b6 02             	movzbl (%edx),%eax
+    125d:	84 c0                	test   %al,%al
+    125f:	75 17                	jne    1278 <strcmp+0x28>
+    1261:	eb 3a                	jmp    129d <strcmp+0x4d>
+    1263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1267:	90                   	nop
+    1268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    126c:	83 c2 01             	add    $0x1,%edx
+    126f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1272:	84 c0                	test   %al,%al
+    1274:	74 1a                	je     1290 <strcmp+0x40>
+    p++, q++;
+    1276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1278:	0f b6 19             	movzbl (%ecx),%ebx
+    127b:	38 c3                	cmp    %al,%bl
+    127d:	74 e9                	je     1268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    127f:	29 d8                	sub    %ebx,%eax
+}
+    1281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1284:	c9                   	leave
+    1285:	c3                   	ret
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1294:	31 c0                	xor    %eax,%eax
+    1296:	29 d8                	sub    %ebx,%eax
+}
+    1298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    129b:	c9                   	leave
+    129c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    129d:	0f b6 19             	movzbl (%ecx),%ebx
+    12a0:	31 c0                	xor    %eax,%eax
+    12a2:	eb db                	jmp    127f <strcmp+0x2f>
+    12a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12af:	90                   	nop
+
+000012b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    12b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    12b9:	74 15                	je     12d0 <strlen+0x20>
+    12bb:	31 c0                	xor    %eax,%eax
+    12bd:	8d 76 00             	lea    0x0(%esi),%esi
+    12c0:	83 c0 01             	add    $0x1,%eax
+    12c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    12c7:	89 c1                	mov    %eax,%ecx
+    12c9:	75 f5                	jne    12c0 <strlen+0x10>
+    ;
+  return n;
+}
+    12cb:	89 c8                	mov    %ecx,%eax
+    12cd:	5d                   	pop    %ebp
+    12ce:	c3                   	ret
+    12cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    12d0:	31 c9                	xor    %ecx,%ecx
+}
+    12d2:	5d                   	pop    %ebp
+    12d3:	89 c8                	mov    %ecx,%eax
+    12d5:	c3                   	ret
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000012e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    12e0:	55                   	push   %ebp
+    12e1:	89 e5                	mov    %esp,%ebp
+    12e3:	57                   	push   %edi
+    12e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    12e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    12ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12ed:	89 d7                	mov    %edx,%edi
+    12ef:	fc                   	cld
+    12f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    12f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    12f5:	89 d0                	mov    %edx,%eax
+    12f7:	c9                   	leave
+    12f8:	c3                   	ret
+    12f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	8b 45 08             	mov    0x8(%ebp),%eax
+    1306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    130a:	0f b6 10             	movzbl (%eax),%edx
+    130d:	84 d2                	test   %dl,%dl
+    130f:	75 12                	jne    1323 <strchr+0x23>
+    1311:	eb 1d                	jmp    1330 <strchr+0x30>
+    1313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1317:	90                   	nop
+    1318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    131c:	83 c0 01             	add    $0x1,%eax
+    131f:	84 d2                	test   %dl,%dl
+    1321:	74 0d                	je     1330 <strchr+0x30>
+    if(*s == c)
+    1323:	38 d1                	cmp    %dl,%cl
+    1325:	75 f1                	jne    1318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1327:	5d                   	pop    %ebp
+    1328:	c3                   	ret
+    1329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1330:	31 c0                	xor    %eax,%eax
+}
+    1332:	5d                   	pop    %ebp
+    1333:	c3                   	ret
+    1334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    133b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    133f:	90                   	nop
+
+00001340 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+    1340:	55                   	push   %ebp
+    1341:	89 e5                	mov    %esp,%ebp
+    1343:	57                   	push   %edi
+    1344:	56                   	push   %esi
+    1345:	53                   	push   %ebx
+    1346:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+    1349:	a1 00 4d 00 00       	mov    0x4d00,%eax
+{
+    134e:	8b 75 08             	mov    0x8(%ebp),%esi
+    1351:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+    1354:	85 c0                	test   %eax,%eax
+    1356:	74 02                	je     135a <gets+0x1a>
+    stdioflush();
+    1358:	ff d0                	call   *%eax
+  if(in.size == 0)
+    135a:	a1 28 4f 00 00       	mov    0x4f28,%eax
+    135f:	85 c0                	test   %eax,%eax
+    1361:	0f 84 99 00 00 00    	je     1400 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    1367:	31 db                	xor    %ebx,%ebx
+    1369:	eb 21                	jmp    138c <gets+0x4c>
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+    1370:	8d 50 01             	lea    0x1(%eax),%edx
+    1373:	0f b6 80 20 4d 00 00 	movzbl 0x4d20(%eax),%eax
+    137a:	89 15 20 4f 00 00    	mov    %edx,0x4f20
+    buf[i++] = c;
+    1380:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1384:	3c 0a                	cmp    $0xa,%al
+    1386:	74 60                	je     13e8 <gets+0xa8>
+    1388:	3c 0d                	cmp    $0xd,%al
+    138a:	74 5c                	je     13e8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+    138c:	89 da                	mov    %ebx,%edx
+    138e:	83 c3 01             	add    $0x1,%ebx
+    1391:	39 fb                	cmp    %edi,%ebx
+    1393:	7d 55                	jge    13ea <gets+0xaa>
+    if(in.r == in.n){
+    1395:	a1 20 4f 00 00       	mov    0x4f20,%eax
+    139a:	3b 05 24 4f 00 00    	cmp    0x4f24,%eax
+    13a0:	75 ce                	jne    1370 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    13a2:	83 ec 04             	sub    $0x4,%esp
+    13a5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+    13a8:	c7 05 24 4f 00 00 00 	movl   $0x0,0x4f24
+    13af:	00 00 00 
+    13b2:	c7 05 20 4f 00 00 00 	movl   $0x0,0x4f20
+    13b9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    13bc:	ff 35 28 4f 00 00    	push   0x4f28
+    13c2:	68 20 4d 00 00       	push   $0x4d20
+    13c7:	6a 00                	push   $0x0
+    13c9:	e8 4d 01 00 00       	call   151b <read>
+    13ce:	83 c4 10             	add    $0x10,%esp
+    13d1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    13d4:	85 c0                	test   %eax,%eax
+    13d6:	a3 24 4f 00 00       	mov    %eax,0x4f24
+    13db:	7e 56                	jle    1433 <gets+0xf3>
+    c = in.buf[in.r++];
+    13dd:	a1 20 4f 00 00       	mov    0x4f20,%eax
+    13e2:	eb 8c                	jmp    1370 <gets+0x30>
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+    13e8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+    13ea:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+    13ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f1:	89 f0                	mov    %esi,%eax
+    13f3:	5b                   	pop    %ebx
+    13f4:	5e                   	pop    %esi
+    13f5:	5f                   	pop    %edi
+    13f6:	5d                   	pop    %ebp
+    13f7:	c3                   	ret
+    13f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ff:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    1400:	83 ec 08             	sub    $0x8,%esp
+    1403:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    1406:	50                   	push   %eax
+    1407:	6a 00                	push   $0x0
+    1409:	e8 4d 01 00 00       	call   155b <fstat>
+    140e:	83 c4 10             	add    $0x10,%esp
+    1411:	89 c2                	mov    %eax,%edx
+    1413:	b8 01 00 00 00       	mov    $0x1,%eax
+    1418:	85 d2                	test   %edx,%edx
+    141a:	75 0d                	jne    1429 <gets+0xe9>
+    141c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    1421:	ba 00 02 00 00       	mov    $0x200,%edx
+    1426:	0f 44 c2             	cmove  %edx,%eax
+    1429:	a3 28 4f 00 00       	mov    %eax,0x4f28
+    142e:	e9 34 ff ff ff       	jmp    1367 <gets+0x27>
+        in.n = 0;
+    1433:	c7 05 24 4f 00 00 00 	movl   $0x0,0x4f24
+    143a:	00 00 00 
+        break;
+    143d:	eb ab                	jmp    13ea <gets+0xaa>
+    143f:	90                   	nop
+
+00001440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1445:	83 ec 08             	sub    $0x8,%esp
+    1448:	6a 00                	push   $0x0
+    144a:	ff 75 08             	push   0x8(%ebp)
+    144d:	e8 f1 00 00 00       	call   1543 <open>
+  if(fd < 0)
+    1452:	83 c4 10             	add    $0x10,%esp
+    1455:	85 c0                	test   %eax,%eax
+    1457:	78 27                	js     1480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1459:	83 ec 08             	sub    $0x8,%esp
+    145c:	ff 75 0c             	push   0xc(%ebp)
+    145f:	89 c3                	mov    %eax,%ebx
+    1461:	50                   	push   %eax
+    1462:	e8 f4 00 00 00       	call   155b <fstat>
+  close(fd);
+    1467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    146a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    146c:	e8 ba 00 00 00       	call   152b <close>
+  return r;
+    1471:	83 c4 10             	add    $0x10,%esp
+}
+    1474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1477:	89 f0                	mov    %esi,%eax
+    1479:	5b                   	pop    %ebx
+    147a:	5e                   	pop    %esi
+    147b:	5d                   	pop    %ebp
+    147c:	c3                   	ret
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1485:	eb ed                	jmp    1474 <stat+0x34>
+    1487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148e:	66 90                	xchg   %ax,%ax
+
+00001490 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1490:	55                   	push   %ebp
+    1491:	89 e5                	mov    %esp,%ebp
+    1493:	53                   	push   %ebx
+    1494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1497:	0f be 02             	movsbl (%edx),%eax
+    149a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    149d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    14a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    14a5:	77 1e                	ja     14c5 <atoi+0x35>
+    14a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    14b0:	83 c2 01             	add    $0x1,%edx
+    14b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    14b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    14ba:	0f be 02             	movsbl (%edx),%eax
+    14bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    14c0:	80 fb 09             	cmp    $0x9,%bl
+    14c3:	76 eb                	jbe    14b0 <atoi+0x20>
+  return n;
+}
+    14c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14c8:	89 c8                	mov    %ecx,%eax
+    14ca:	c9                   	leave
+    14cb:	c3                   	ret
+    14cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000014d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    14d0:	55                   	push   %ebp
+    14d1:	89 e5                	mov    %esp,%ebp
+    14d3:	57                   	push   %edi
+    14d4:	56                   	push   %esi
+    14d5:	8b 45 10             	mov    0x10(%ebp),%eax
+    14d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    14de:	85 c0                	test   %eax,%eax
+    14e0:	7e 13                	jle    14f5 <memmove+0x25>
+    14e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    14e4:	89 d7                	mov    %edx,%edi
+    14e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    14f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    14f1:	39 f8                	cmp    %edi,%eax
+    14f3:	75 fb                	jne    14f0 <memmove+0x20>
+  return vdst;
+}
+    14f5:	5e                   	pop    %esi
+    14f6:	89 d0                	mov    %edx,%eax
+    14f8:	5f                   	pop    %edi
+    14f9:	5d                   	pop    %ebp
+    14fa:	c3                   	ret
+
+000014fb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    14fb:	b8 01 00 00 00       	mov    $0x1,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <_exit>:
+RAWSYSCALL(exit)
+    1503:	b8 02 00 00 00       	mov    $0x2,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <wait>:
+SYSCALL(wait)
+    150b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <pipe>:
+SYSCALL(pipe)
+    1513:	b8 04 00 00 00       	mov    $0x4,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <read>:
+SYSCALL(read)
+    151b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <write>:
+SYSCALL(write)
+    1523:	b8 10 00 00 00       	mov    $0x10,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <close>:
+SYSCALL(close)
+    152b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <kill>:
+SYSCALL(kill)
+    1533:	b8 06 00 00 00       	mov    $0x6,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <_exec>:
+RAWSYSCALL(exec)
+    153b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <open>:
+SYSCALL(open)
+    1543:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <mknod>:
+SYSCALL(mknod)
+    154b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <unlink>:
+SYSCALL(unlink)
+    1553:	b8 12 00 00 00       	mov    $0x12,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <fstat>:
+SYSCALL(fstat)
+    155b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <link>:
+SYSCALL(link)
+    1563:	b8 13 00 00 00       	mov    $0x13,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+
+0000156b <mkdir>:
+SYSCALL(mkdir)
+    156b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1570:	cd 40                	int    $0x40
+    1572:	c3                   	ret
+
+00001573 <chdir>:
+SYSCALL(chdir)
+    1573:	b8 09 00 00 00       	mov    $0x9,%eax
+    1578:	cd 40                	int    $0x40
+    157a:	c3                   	ret
+
+0000157b <dup>:
+SYSCALL(dup)
+    157b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <getpid>:
+SYSCALL(getpid)
+    1583:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <sbrk>:
+SYSCALL(sbrk)
+    158b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <sleep>:
+SYSCALL(sleep)
+    1593:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <uptime>:
+SYSCALL(uptime)
+    159b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+    15a3:	b8 16 00 00 00       	mov    $0x16,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <get_parent_id>:
+SYSCALL(get_parent_id)
+    15ab:	b8 17 00 00 00       	mov    $0x17,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+
+000015b3 <get_children>:
+SYSCALL(get_children)
+    15b3:	b8 18 00 00 00       	mov    $0x18,%eax
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <set_path>:
+SYSCALL(set_path)
+    15bb:	b8 19 00 00 00       	mov    $0x19,%eax
+    15c0:	cd 40                	int    $0x40
+    15c2:	c3                   	ret
+
+000015c3 <set_sleep>:
+SYSCALL(set_sleep)
+    15c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    15c8:	cd 40                	int    $0x40
+    15ca:	c3                   	ret
+
+000015cb <get_time>:
+SYSCALL(get_time)
+    15cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    15d0:	cd 40                	int    $0x40
+    15d2:	c3                   	ret
+
+000015d3 <change_process_level>:
+SYSCALL(change_process_level)
+    15d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15d8:	cd 40                	int    $0x40
+    15da:	c3                   	ret
+
+000015db <set_process_ticket>:
+SYSCALL(set_process_ticket)
+    15db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15e0:	cd 40                	int    $0x40
+    15e2:	c3                   	ret
+
+000015e3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+    15e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15e8:	cd 40                	int    $0x40
+    15ea:	c3                   	ret
+
+000015eb <print_processes_info>:
+SYSCALL(print_processes_info)
+    15eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15f0:	cd 40                	int    $0x40
+    15f2:	c3                   	ret
+
+000015f3 <barrier_init>:
+
+SYSCALL(barrier_init)
+    15f3:	b8 20 00 00 00       	mov    $0x20,%eax
+    15f8:	cd 40                	int    $0x40
+    15fa:	c3                   	ret
+
+000015fb <barrier_wait>:
+SYSCALL(barrier_wait)
+    15fb:	b8 21 00 00 00       	mov    $0x21,%eax
+    1600:	cd 40                	int    $0x40
+    1602:	c3                   	ret
+
+00001603 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+    1603:	b8 22 00 00 00       	mov    $0x22,%eax
+    1608:	cd 40                	int    $0x40
+    160a:	c3                   	ret
+
+0000160b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+    160b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1610:	cd 40                	int    $0x40
+    1612:	c3                   	ret
+
+00001613 <set_process_gang>:
+SYSCALL(set_process_gang)
+    1613:	b8 24 00 00 00       	mov    $0x24,%eax
+    1618:	cd 40                	int    $0x40
+    161a:	c3                   	ret
+
+0000161b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+    161b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1620:	cd 40                	int    $0x40
+    1622:	c3                   	ret
+
+00001623 <sem_create>:
+SYSCALL(sem_create)
+    1623:	b8 26 00 00 00       	mov    $0x26,%eax
+    1628:	cd 40                	int    $0x40
+    162a:	c3                   	ret
+
+0000162b <event_create>:
+SYSCALL(event_create)
+    162b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1630:	cd 40                	int    $0x40
+    1632:	c3                   	ret
+
+00001633 <sync_post>:
+SYSCALL(sync_post)
+    1633:	b8 28 00 00 00       	mov    $0x28,%eax
+    1638:	cd 40                	int    $0x40
+    163a:	c3                   	ret
+
+0000163b <sync_wait>:
+SYSCALL(sync_wait)
+    163b:	b8 29 00 00 00       	mov    $0x29,%eax
+    1640:	cd 40                	int    $0x40
+    1642:	c3                   	ret
+
+00001643 <sync_close>:
+SYSCALL(sync_close)
+    1643:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1648:	cd 40                	int    $0x40
+    164a:	c3                   	ret
+
+0000164b <event_reset>:
+SYSCALL(event_reset)
+    164b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1650:	cd 40                	int    $0x40
+    1652:	c3                   	ret
+
+00001653 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+    1653:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1658:	cd 40                	int    $0x40
+    165a:	c3                   	ret
+
+0000165b <mmap>:
+SYSCALL(mmap)
+    165b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1660:	cd 40                	int    $0x40
+    1662:	c3                   	ret
+
+00001663 <munmap>:
+SYSCALL(munmap)
+    1663:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    1668:	cd 40                	int    $0x40
+    166a:	c3                   	ret
+
+0000166b <shmget>:
+SYSCALL(shmget)
+    166b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1670:	cd 40                	int    $0x40
+    1672:	c3                   	ret
+
+00001673 <shmat>:
+SYSCALL(shmat)
+    1673:	b8 30 00 00 00       	mov    $0x30,%eax
+    1678:	cd 40                	int    $0x40
+    167a:	c3                   	ret
+
+0000167b <shmdt>:
+SYSCALL(shmdt)
+    167b:	b8 31 00 00 00       	mov    $0x31,%eax
+    1680:	cd 40                	int    $0x40
+    1682:	c3                   	ret
+
+00001683 <shmrm>:
+SYSCALL(shmrm)
+    1683:	b8 32 00 00 00       	mov    $0x32,%eax
+    1688:	cd 40                	int    $0x40
+    168a:	c3                   	ret
+
+0000168b <_spawn>:
+RAWSYSCALL(spawn)
+    168b:	b8 33 00 00 00       	mov    $0x33,%eax
+    1690:	cd 40                	int    $0x40
+    1692:	c3                   	ret
+
+00001693 <memstat>:
+SYSCALL(memstat)
+    1693:	b8 34 00 00 00       	mov    $0x34,%eax
+    1698:	cd 40                	int    $0x40
+    169a:	c3                   	ret
+    169b:	66 90                	xchg   %ax,%ax
+    169d:	66 90                	xchg   %ax,%ax
+    169f:	90                   	nop
+
+000016a0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+    16a6:	a1 68 51 00 00       	mov    0x5168,%eax
+    16ab:	85 c0                	test   %eax,%eax
+    16ad:	7e 17                	jle    16c6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+    16af:	83 ec 04             	sub    $0x4,%esp
+    16b2:	50                   	push   %eax
+    16b3:	68 6c 51 00 00       	push   $0x516c
+    16b8:	ff 35 60 51 00 00    	push   0x5160
+    16be:	e8 60 fe ff ff       	call   1523 <write>
+    16c3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    16c6:	c7 05 68 51 00 00 00 	movl   $0x0,0x5168
+    16cd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+    16d0:	c7 05 64 51 00 00 00 	movl   $0x0,0x5164
+    16d7:	00 00 00 
+}
+    16da:	c9                   	leave
+    16db:	c3                   	ret
+    16dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000016e0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    16e6:	89 d1                	mov    %edx,%ecx
+{
+    16e8:	56                   	push   %esi
+    16e9:	53                   	push   %ebx
+    16ea:	89 c3                	mov    %eax,%ebx
+    16ec:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+    16ef:	85 d2                	test   %edx,%edx
+    16f1:	0f 89 b9 00 00 00    	jns    17b0 <printint+0xd0>
+    16f7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    16fb:	0f 84 af 00 00 00    	je     17b0 <printint+0xd0>
+    x = -xx;
+    1701:	f7 d9                	neg    %ecx
+    neg = 1;
+    1703:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1708:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    170b:	31 f6                	xor    %esi,%esi
+    170d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1710:	89 c8                	mov    %ecx,%eax
+    1712:	31 d2                	xor    %edx,%edx
+    1714:	89 f3                	mov    %esi,%ebx
+    1716:	f7 f7                	div    %edi
+    1718:	8d 76 01             	lea    0x1(%esi),%esi
+    171b:	0f b6 92 48 27 00 00 	movzbl 0x2748(%edx),%edx
+    1722:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1726:	89 ca                	mov    %ecx,%edx
+    1728:	89 c1                	mov    %eax,%ecx
+    172a:	39 fa                	cmp    %edi,%edx
+    172c:	73 e2                	jae    1710 <printint+0x30>
+  if(neg)
+    172e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1731:	89 d9                	mov    %ebx,%ecx
+    1733:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1736:	85 c0                	test   %eax,%eax
+    1738:	74 07                	je     1741 <printint+0x61>
+    buf[i++] = '-';
+    173a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    173f:	89 f1                	mov    %esi,%ecx
+    1741:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    1744:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+    1746:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1749:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    174c:	01 f7                	add    %esi,%edi
+    174e:	eb 09                	jmp    1759 <printint+0x79>
+
+  while(--i >= 0)
+    1750:	8d 47 ff             	lea    -0x1(%edi),%eax
+    1753:	39 f7                	cmp    %esi,%edi
+    1755:	74 36                	je     178d <printint+0xad>
+    1757:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+    1759:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+    175c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+    175f:	8d 42 01             	lea    0x1(%edx),%eax
+    1762:	89 43 08             	mov    %eax,0x8(%ebx)
+    1765:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    1769:	3d 00 02 00 00       	cmp    $0x200,%eax
+    176e:	74 28                	je     1798 <printint+0xb8>
+    1770:	80 f9 0a             	cmp    $0xa,%cl
+    1773:	75 db                	jne    1750 <printint+0x70>
+    1775:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    1779:	75 d5                	jne    1750 <printint+0x70>
+  if(b->n > 0)
+    177b:	85 c0                	test   %eax,%eax
+    177d:	7f 19                	jg     1798 <printint+0xb8>
+  b->n = 0;
+    177f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+    1786:	8d 47 ff             	lea    -0x1(%edi),%eax
+    1789:	39 f7                	cmp    %esi,%edi
+    178b:	75 ca                	jne    1757 <printint+0x77>
+}
+    178d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1790:	5b                   	pop    %ebx
+    1791:	5e                   	pop    %esi
+    1792:	5f                   	pop    %edi
+    1793:	5d                   	pop    %ebp
+    1794:	c3                   	ret
+    1795:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    1798:	83 ec 04             	sub    $0x4,%esp
+    179b:	50                   	push   %eax
+    179c:	ff 75 d4             	push   -0x2c(%ebp)
+    179f:	ff 33                	push   (%ebx)
+    17a1:	e8 7d fd ff ff       	call   1523 <write>
+    17a6:	83 c4 10             	add    $0x10,%esp
+    17a9:	eb d4                	jmp    177f <printint+0x9f>
+    17ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17af:	90                   	nop
+  neg = 0;
+    17b0:	31 c0                	xor    %eax,%eax
+    17b2:	e9 51 ff ff ff       	jmp    1708 <printint+0x28>
+    17b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17be:	66 90                	xchg   %ax,%ax
+
+000017c0 <putc>:
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	53                   	push   %ebx
+    17c4:	89 c3                	mov    %eax,%ebx
+    17c6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+    17c9:	8b 48 08             	mov    0x8(%eax),%ecx
+    17cc:	8d 41 01             	lea    0x1(%ecx),%eax
+    17cf:	89 43 08             	mov    %eax,0x8(%ebx)
+    17d2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    17d6:	3d 00 02 00 00       	cmp    $0x200,%eax
+    17db:	74 33                	je     1810 <putc+0x50>
+    17dd:	80 fa 0a             	cmp    $0xa,%dl
+    17e0:	74 0e                	je     17f0 <putc+0x30>
+}
+    17e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17e5:	c9                   	leave
+    17e6:	c3                   	ret
+    17e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ee:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    17f0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    17f4:	75 ec                	jne    17e2 <putc+0x22>
+  if(b->n > 0)
+    17f6:	85 c0                	test   %eax,%eax
+    17f8:	7f 16                	jg     1810 <putc+0x50>
+  b->n = 0;
+    17fa:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    1801:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1804:	c9                   	leave
+    1805:	c3                   	ret
+    1806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    1810:	83 ec 04             	sub    $0x4,%esp
+    1813:	50                   	push   %eax
+    1814:	8d 43 0c             	lea    0xc(%ebx),%eax
+    1817:	50                   	push   %eax
+    1818:	ff 33                	push   (%ebx)
+    181a:	e8 04 fd ff ff       	call   1523 <write>
+    181f:	83 c4 10             	add    $0x10,%esp
+    1822:	eb d6                	jmp    17fa <putc+0x3a>
+    1824:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+
+00001830 <fflush>:
+{
+    1830:	55                   	push   %ebp
+    1831:	89 e5                	mov    %esp,%ebp
+    1833:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+    1836:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    183a:	74 04                	je     1840 <fflush+0x10>
+}
+    183c:	c9                   	leave
+    183d:	c3                   	ret
+    183e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    1840:	a1 68 51 00 00       	mov    0x5168,%eax
+    1845:	85 c0                	test   %eax,%eax
+    1847:	7f 17                	jg     1860 <fflush+0x30>
+  b->n = 0;
+    1849:	c7 05 68 51 00 00 00 	movl   $0x0,0x5168
+    1850:	00 00 00 
+  out.mode = 0;
+    1853:	c7 05 64 51 00 00 00 	movl   $0x0,0x5164
+    185a:	00 00 00 
+}
+    185d:	c9                   	leave
+    185e:	c3                   	ret
+    185f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+    1860:	83 ec 04             	sub    $0x4,%esp
+    1863:	50                   	push   %eax
+    1864:	68 6c 51 00 00       	push   $0x516c
+    1869:	ff 35 60 51 00 00    	push   0x5160
+    186f:	e8 af fc ff ff       	call   1523 <write>
+    1874:	83 c4 10             	add    $0x10,%esp
+    1877:	eb d0                	jmp    1849 <fflush+0x19>
+    1879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001880 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	57                   	push   %edi
+    1884:	56                   	push   %esi
+    1885:	53                   	push   %ebx
+    1886:	83 ec 3c             	sub    $0x3c,%esp
+    1889:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    188c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+    188f:	83 fe 01             	cmp    $0x1,%esi
+    1892:	0f 84 60 01 00 00    	je     19f8 <printf+0x178>
+    b->fd = fd;
+    1898:	89 35 40 4f 00 00    	mov    %esi,0x4f40
+  for(i = 0; fmt[i]; i++){
+    189e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+    18a1:	bf 40 4f 00 00       	mov    $0x4f40,%edi
+  for(i = 0; fmt[i]; i++){
+    18a6:	84 c0                	test   %al,%al
+    18a8:	74 65                	je     190f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+    18aa:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    18ad:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+    18b0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    18b2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+    18b5:	eb 1f                	jmp    18d6 <printf+0x56>
+    18b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18be:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    18c0:	83 f8 25             	cmp    $0x25,%eax
+    18c3:	74 3b                	je     1900 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+    18c5:	89 f8                	mov    %edi,%eax
+    18c7:	e8 f4 fe ff ff       	call   17c0 <putc>
+  for(i = 0; fmt[i]; i++){
+    18cc:	0f b6 03             	movzbl (%ebx),%eax
+    18cf:	83 c3 01             	add    $0x1,%ebx
+    18d2:	84 c0                	test   %al,%al
+    18d4:	74 39                	je     190f <printf+0x8f>
+    c = fmt[i] & 0xff;
+    18d6:	0f be d0             	movsbl %al,%edx
+    18d9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    18dc:	85 f6                	test   %esi,%esi
+    18de:	74 e0                	je     18c0 <printf+0x40>
+      }
+    } else if(state == '%'){
+    18e0:	83 fe 25             	cmp    $0x25,%esi
+    18e3:	75 e7                	jne    18cc <printf+0x4c>
+      if(c == 'd'){
+    18e5:	83 f8 25             	cmp    $0x25,%eax
+    18e8:	74 57                	je     1941 <printf+0xc1>
+    18ea:	83 e8 63             	sub    $0x63,%eax
+    18ed:	83 f8 15             	cmp    $0x15,%eax
+    18f0:	77 36                	ja     1928 <printf+0xa8>
+    18f2:	ff 24 85 f0 26 00 00 	jmp    *0x26f0(,%eax,4)
+    18f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+    1900:	0f b6 03             	movzbl (%ebx),%eax
+    1903:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1906:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    190b:	84 c0                	test   %al,%al
+    190d:	75 c7                	jne    18d6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+    190f:	8b 47 04             	mov    0x4(%edi),%eax
+    1912:	85 c0                	test   %eax,%eax
+    1914:	0f 84 06 01 00 00    	je     1a20 <printf+0x1a0>
+    bflush(b);
+}
+    191a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    191d:	5b                   	pop    %ebx
+    191e:	5e                   	pop    %esi
+    191f:	5f                   	pop    %edi
+    1920:	5d                   	pop    %ebp
+    1921:	c3                   	ret
+    1922:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+    1928:	8b 4f 08             	mov    0x8(%edi),%ecx
+    192b:	8d 41 01             	lea    0x1(%ecx),%eax
+    192e:	89 47 08             	mov    %eax,0x8(%edi)
+    1931:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    1936:	3d 00 02 00 00       	cmp    $0x200,%eax
+    193b:	0f 84 77 01 00 00    	je     1ab8 <printf+0x238>
+        putc(b, c);
+    1941:	89 f8                	mov    %edi,%eax
+      state = 0;
+    1943:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+    1945:	e8 76 fe ff ff       	call   17c0 <putc>
+    194a:	eb 80                	jmp    18cc <printf+0x4c>
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+    1950:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1953:	83 ec 0c             	sub    $0xc,%esp
+    1956:	b9 10 00 00 00       	mov    $0x10,%ecx
+    195b:	8b 16                	mov    (%esi),%edx
+    195d:	6a 00                	push   $0x0
+        ap++;
+    195f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+    1962:	89 f8                	mov    %edi,%eax
+    1964:	e8 77 fd ff ff       	call   16e0 <printint>
+        ap++;
+    1969:	89 75 c0             	mov    %esi,-0x40(%ebp)
+    196c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    196f:	31 f6                	xor    %esi,%esi
+    1971:	e9 56 ff ff ff       	jmp    18cc <printf+0x4c>
+    1976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    197d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1980:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1983:	8b 08                	mov    (%eax),%ecx
+        ap++;
+    1985:	83 c0 04             	add    $0x4,%eax
+    1988:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+    198b:	85 c9                	test   %ecx,%ecx
+    198d:	0f 84 cd 00 00 00    	je     1a60 <printf+0x1e0>
+        while(*s != 0){
+    1993:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+    1996:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+    1998:	84 d2                	test   %dl,%dl
+    199a:	0f 84 2c ff ff ff    	je     18cc <printf+0x4c>
+          putc(b, *s);
+    19a0:	89 f8                	mov    %edi,%eax
+    19a2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+    19a5:	e8 16 fe ff ff       	call   17c0 <putc>
+          s++;
+    19aa:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+    19ad:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+    19b1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+    19b4:	84 d2                	test   %dl,%dl
+    19b6:	75 e8                	jne    19a0 <printf+0x120>
+      state = 0;
+    19b8:	31 f6                	xor    %esi,%esi
+    19ba:	e9 0d ff ff ff       	jmp    18cc <printf+0x4c>
+    19bf:	90                   	nop
+        printint(b, *ap, 10, 1);
+    19c0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    19c3:	83 ec 0c             	sub    $0xc,%esp
+    19c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    19cb:	8b 16                	mov    (%esi),%edx
+    19cd:	6a 01                	push   $0x1
+    19cf:	eb 8e                	jmp    195f <printf+0xdf>
+    19d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+    19d8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    19db:	89 f8                	mov    %edi,%eax
+    19dd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    19e0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+    19e3:	e8 d8 fd ff ff       	call   17c0 <putc>
+        ap++;
+    19e8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+    19eb:	31 f6                	xor    %esi,%esi
+    19ed:	e9 da fe ff ff       	jmp    18cc <printf+0x4c>
+    19f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+    19f8:	8b 15 64 51 00 00    	mov    0x5164,%edx
+    19fe:	85 d2                	test   %edx,%edx
+    1a00:	74 6e                	je     1a70 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+    1a02:	0f b6 03             	movzbl (%ebx),%eax
+    1a05:	bf 60 51 00 00       	mov    $0x5160,%edi
+    1a0a:	84 c0                	test   %al,%al
+    1a0c:	0f 85 98 fe ff ff    	jne    18aa <printf+0x2a>
+    1a12:	e9 03 ff ff ff       	jmp    191a <printf+0x9a>
+    1a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a1e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    1a20:	8b 47 08             	mov    0x8(%edi),%eax
+    1a23:	85 c0                	test   %eax,%eax
+    1a25:	7f 19                	jg     1a40 <printf+0x1c0>
+  b->n = 0;
+    1a27:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a31:	5b                   	pop    %ebx
+    1a32:	5e                   	pop    %esi
+    1a33:	5f                   	pop    %edi
+    1a34:	5d                   	pop    %ebp
+    1a35:	c3                   	ret
+    1a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    1a40:	83 ec 04             	sub    $0x4,%esp
+    1a43:	50                   	push   %eax
+    1a44:	8d 47 0c             	lea    0xc(%edi),%eax
+    1a47:	50                   	push   %eax
+    1a48:	ff 37                	push   (%edi)
+    1a4a:	e8 d4 fa ff ff       	call   1523 <write>
+  b->n = 0;
+    1a4f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+    1a56:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    1a59:	eb d3                	jmp    1a2e <printf+0x1ae>
+    1a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a5f:	90                   	nop
+    1a60:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    1a65:	b9 e9 26 00 00       	mov    $0x26e9,%ecx
+    1a6a:	e9 31 ff ff ff       	jmp    19a0 <printf+0x120>
+    1a6f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1a70:	83 ec 08             	sub    $0x8,%esp
+    1a73:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+    1a76:	c7 05 60 51 00 00 01 	movl   $0x1,0x5160
+    1a7d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1a80:	50                   	push   %eax
+    1a81:	6a 01                	push   $0x1
+    1a83:	e8 d3 fa ff ff       	call   155b <fstat>
+    1a88:	83 c4 10             	add    $0x10,%esp
+    1a8b:	85 c0                	test   %eax,%eax
+    1a8d:	75 22                	jne    1ab1 <printf+0x231>
+    1a8f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    1a94:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a99:	0f 45 f0             	cmovne %eax,%esi
+    1a9c:	89 35 64 51 00 00    	mov    %esi,0x5164
+      stdioflush = flushout;
+    1aa2:	c7 05 00 4d 00 00 a0 	movl   $0x16a0,0x4d00
+    1aa9:	16 00 00 
+    1aac:	e9 51 ff ff ff       	jmp    1a02 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1ab1:	be 02 00 00 00       	mov    $0x2,%esi
+    1ab6:	eb e4                	jmp    1a9c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+    1ab8:	83 ec 04             	sub    $0x4,%esp
+    1abb:	8d 47 0c             	lea    0xc(%edi),%eax
+    1abe:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1ac1:	68 00 02 00 00       	push   $0x200
+    1ac6:	50                   	push   %eax
+    1ac7:	ff 37                	push   (%edi)
+    1ac9:	e8 55 fa ff ff       	call   1523 <write>
+  b->n = 0;
+    1ace:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1ad5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    1ad8:	83 c4 10             	add    $0x10,%esp
+    1adb:	e9 61 fe ff ff       	jmp    1941 <printf+0xc1>
+
+00001ae0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	56                   	push   %esi
+    1ae4:	53                   	push   %ebx
+    1ae5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+    1ae7:	a1 80 53 00 00       	mov    0x5380,%eax
+    1aec:	39 d8                	cmp    %ebx,%eax
+    1aee:	0f 83 e4 00 00 00    	jae    1bd8 <freepages+0xf8>
+    1af4:	85 c0                	test   %eax,%eax
+    1af6:	0f 84 dc 00 00 00    	je     1bd8 <freepages+0xf8>
+    1afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b00:	89 c2                	mov    %eax,%edx
+    1b02:	8b 00                	mov    (%eax),%eax
+    1b04:	85 c0                	test   %eax,%eax
+    1b06:	74 04                	je     1b0c <freepages+0x2c>
+    1b08:	39 d8                	cmp    %ebx,%eax
+    1b0a:	72 f4                	jb     1b00 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+    1b0c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+    1b0f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+    1b11:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+    1b13:	85 c0                	test   %eax,%eax
+    1b15:	74 15                	je     1b2c <freepages+0x4c>
+    p->prev = s;
+    1b17:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+    1b1a:	8b 73 10             	mov    0x10(%ebx),%esi
+    1b1d:	89 f1                	mov    %esi,%ecx
+    1b1f:	c1 e1 0c             	shl    $0xc,%ecx
+    1b22:	01 d9                	add    %ebx,%ecx
+    1b24:	39 c8                	cmp    %ecx,%eax
+    1b26:	0f 84 d8 00 00 00    	je     1c04 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+    1b2c:	8b 4a 10             	mov    0x10(%edx),%ecx
+    1b2f:	89 c8                	mov    %ecx,%eax
+    1b31:	c1 e0 0c             	shl    $0xc,%eax
+    1b34:	01 d0                	add    %edx,%eax
+    1b36:	39 c3                	cmp    %eax,%ebx
+    1b38:	74 16                	je     1b50 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    1b3a:	8b 03                	mov    (%ebx),%eax
+    1b3c:	85 c0                	test   %eax,%eax
+    1b3e:	74 40                	je     1b80 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+    1b40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1b43:	5b                   	pop    %ebx
+    1b44:	5e                   	pop    %esi
+    1b45:	5d                   	pop    %ebp
+    1b46:	c3                   	ret
+    1b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b4e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+    1b50:	03 4b 10             	add    0x10(%ebx),%ecx
+    1b53:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+    1b56:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+    1b59:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    1b5b:	85 c9                	test   %ecx,%ecx
+    1b5d:	0f 84 dd 00 00 00    	je     1c40 <freepages+0x160>
+    s->prev->next = s->next;
+    1b63:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+    1b65:	85 c0                	test   %eax,%eax
+    1b67:	74 06                	je     1b6f <freepages+0x8f>
+    s->next->prev = s->prev;
+    1b69:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    1b6c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    1b6f:	8b 02                	mov    (%edx),%eax
+    1b71:	89 d3                	mov    %edx,%ebx
+    1b73:	85 c0                	test   %eax,%eax
+    1b75:	75 c9                	jne    1b40 <freepages+0x60>
+    1b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b7e:	66 90                	xchg   %ax,%ax
+    1b80:	8b 43 10             	mov    0x10(%ebx),%eax
+    1b83:	83 f8 0f             	cmp    $0xf,%eax
+    1b86:	76 b8                	jbe    1b40 <freepages+0x60>
+    1b88:	83 ec 0c             	sub    $0xc,%esp
+    1b8b:	c1 e0 0c             	shl    $0xc,%eax
+    1b8e:	6a 00                	push   $0x0
+    1b90:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1b93:	e8 f3 f9 ff ff       	call   158b <sbrk>
+    1b98:	83 c4 10             	add    $0x10,%esp
+    1b9b:	39 c6                	cmp    %eax,%esi
+    1b9d:	75 a1                	jne    1b40 <freepages+0x60>
+  if(s->prev)
+    1b9f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+    1ba2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    1ba4:	85 d2                	test   %edx,%edx
+    1ba6:	0f 84 a5 00 00 00    	je     1c51 <freepages+0x171>
+    s->prev->next = s->next;
+    1bac:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+    1bae:	85 c0                	test   %eax,%eax
+    1bb0:	74 06                	je     1bb8 <freepages+0xd8>
+    s->next->prev = s->prev;
+    1bb2:	8b 53 04             	mov    0x4(%ebx),%edx
+    1bb5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+    1bb8:	8b 43 10             	mov    0x10(%ebx),%eax
+    1bbb:	83 ec 0c             	sub    $0xc,%esp
+    1bbe:	c1 e0 0c             	shl    $0xc,%eax
+    1bc1:	f7 d8                	neg    %eax
+    1bc3:	50                   	push   %eax
+    1bc4:	e8 c2 f9 ff ff       	call   158b <sbrk>
+    1bc9:	83 c4 10             	add    $0x10,%esp
+}
+    1bcc:	e9 6f ff ff ff       	jmp    1b40 <freepages+0x60>
+    1bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+    1bd8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+    1bdf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+    1be1:	89 1d 80 53 00 00    	mov    %ebx,0x5380
+  if(p)
+    1be7:	85 c0                	test   %eax,%eax
+    1be9:	74 95                	je     1b80 <freepages+0xa0>
+    p->prev = s;
+    1beb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+    1bee:	8b 73 10             	mov    0x10(%ebx),%esi
+    1bf1:	89 f2                	mov    %esi,%edx
+    1bf3:	c1 e2 0c             	shl    $0xc,%edx
+    1bf6:	01 da                	add    %ebx,%edx
+    1bf8:	39 d0                	cmp    %edx,%eax
+    1bfa:	0f 85 3a ff ff ff    	jne    1b3a <freepages+0x5a>
+    1c00:	89 c1                	mov    %eax,%ecx
+    1c02:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+    1c04:	8b 41 10             	mov    0x10(%ecx),%eax
+    1c07:	01 f0                	add    %esi,%eax
+    1c09:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+    1c0c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+    1c0f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+    1c11:	85 f6                	test   %esi,%esi
+    1c13:	74 35                	je     1c4a <freepages+0x16a>
+    s->prev->next = s->next;
+    1c15:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+    1c17:	85 c0                	test   %eax,%eax
+    1c19:	74 06                	je     1c21 <freepages+0x141>
+    s->next->prev = s->prev;
+    1c1b:	8b 49 04             	mov    0x4(%ecx),%ecx
+    1c1e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+    1c21:	85 d2                	test   %edx,%edx
+    1c23:	0f 84 11 ff ff ff    	je     1b3a <freepages+0x5a>
+    1c29:	8b 4a 10             	mov    0x10(%edx),%ecx
+    1c2c:	89 c8                	mov    %ecx,%eax
+    1c2e:	c1 e0 0c             	shl    $0xc,%eax
+    1c31:	01 d0                	add    %edx,%eax
+    1c33:	39 c3                	cmp    %eax,%ebx
+    1c35:	0f 85 ff fe ff ff    	jne    1b3a <freepages+0x5a>
+    1c3b:	e9 10 ff ff ff       	jmp    1b50 <freepages+0x70>
+    *l = s->next;
+    1c40:	a3 80 53 00 00       	mov    %eax,0x5380
+    1c45:	e9 1b ff ff ff       	jmp    1b65 <freepages+0x85>
+    1c4a:	a3 80 53 00 00       	mov    %eax,0x5380
+    1c4f:	eb c6                	jmp    1c17 <freepages+0x137>
+    1c51:	a3 80 53 00 00       	mov    %eax,0x5380
+    1c56:	e9 53 ff ff ff       	jmp    1bae <freepages+0xce>
+    1c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c5f:	90                   	nop
+
+00001c60 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	56                   	push   %esi
+    1c64:	53                   	push   %ebx
+    1c65:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+    1c67:	a1 80 53 00 00       	mov    0x5380,%eax
+    1c6c:	85 c0                	test   %eax,%eax
+    1c6e:	74 5e                	je     1cce <getpages+0x6e>
+    if(s->npages < n)
+    1c70:	8b 50 10             	mov    0x10(%eax),%edx
+    1c73:	39 da                	cmp    %ebx,%edx
+    1c75:	72 51                	jb     1cc8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+    1c77:	39 d3                	cmp    %edx,%ebx
+    1c79:	72 25                	jb     1ca0 <getpages+0x40>
+  if(s->prev)
+    1c7b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+    1c7e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+    1c80:	85 c9                	test   %ecx,%ecx
+    1c82:	0f 84 a8 00 00 00    	je     1d30 <getpages+0xd0>
+    s->prev->next = s->next;
+    1c88:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+    1c8a:	85 d2                	test   %edx,%edx
+    1c8c:	74 06                	je     1c94 <getpages+0x34>
+    s->next->prev = s->prev;
+    1c8e:	8b 48 04             	mov    0x4(%eax),%ecx
+    1c91:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+    1c94:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+    1c97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c9a:	5b                   	pop    %ebx
+    1c9b:	5e                   	pop    %esi
+    1c9c:	5d                   	pop    %ebp
+    1c9d:	c3                   	ret
+    1c9e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1ca0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+    1ca2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1ca4:	c1 e1 0c             	shl    $0xc,%ecx
+    1ca7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+    1ca9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+    1cac:	8b 70 04             	mov    0x4(%eax),%esi
+    1caf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+    1cb2:	8b 10                	mov    (%eax),%edx
+    1cb4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+    1cb6:	85 f6                	test   %esi,%esi
+    1cb8:	74 66                	je     1d20 <getpages+0xc0>
+        rest->prev->next = rest;
+    1cba:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+    1cbc:	8b 11                	mov    (%ecx),%edx
+    1cbe:	85 d2                	test   %edx,%edx
+    1cc0:	75 cf                	jne    1c91 <getpages+0x31>
+    1cc2:	eb d0                	jmp    1c94 <getpages+0x34>
+    1cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+    1cc8:	8b 00                	mov    (%eax),%eax
+    1cca:	85 c0                	test   %eax,%eax
+    1ccc:	75 a2                	jne    1c70 <getpages+0x10>
+  brk = (uint)sbrk(0);
+    1cce:	83 ec 0c             	sub    $0xc,%esp
+    1cd1:	6a 00                	push   $0x0
+    1cd3:	e8 b3 f8 ff ff       	call   158b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1cd8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+    1cdb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+    1ce1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1ce3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+    1ce9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1cef:	29 d0                	sub    %edx,%eax
+    1cf1:	c1 e8 0c             	shr    $0xc,%eax
+    1cf4:	39 d8                	cmp    %ebx,%eax
+    1cf6:	72 48                	jb     1d40 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+    1cf8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    1cfa:	89 d8                	mov    %ebx,%eax
+    1cfc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+    1cff:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    1d01:	c1 e0 0c             	shl    $0xc,%eax
+    1d04:	01 f0                	add    %esi,%eax
+    1d06:	50                   	push   %eax
+    1d07:	e8 7f f8 ff ff       	call   158b <sbrk>
+    1d0c:	83 c4 10             	add    $0x10,%esp
+    1d0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d12:	74 2c                	je     1d40 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+    1d14:	01 f0                	add    %esi,%eax
+    1d16:	e9 79 ff ff ff       	jmp    1c94 <getpages+0x34>
+    1d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d1f:	90                   	nop
+        runs = rest;
+    1d20:	89 0d 80 53 00 00    	mov    %ecx,0x5380
+    1d26:	eb 96                	jmp    1cbe <getpages+0x5e>
+    1d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2f:	90                   	nop
+    *l = s->next;
+    1d30:	89 15 80 53 00 00    	mov    %edx,0x5380
+    1d36:	e9 4f ff ff ff       	jmp    1c8a <getpages+0x2a>
+    1d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d3f:	90                   	nop
+    return 0;
+    1d40:	31 c0                	xor    %eax,%eax
+    1d42:	e9 50 ff ff ff       	jmp    1c97 <getpages+0x37>
+    1d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d4e:	66 90                	xchg   %ax,%ax
+
+00001d50 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	57                   	push   %edi
+    1d54:	56                   	push   %esi
+    1d55:	53                   	push   %ebx
+    1d56:	83 ec 1c             	sub    $0x1c,%esp
+    1d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+    1d5c:	85 c0                	test   %eax,%eax
+    1d5e:	0f 84 97 00 00 00    	je     1dfb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+    1d64:	89 c3                	mov    %eax,%ebx
+    1d66:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+    1d6c:	8b 73 14             	mov    0x14(%ebx),%esi
+    1d6f:	83 fe 01             	cmp    $0x1,%esi
+    1d72:	74 74                	je     1de8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    1d74:	85 f6                	test   %esi,%esi
+    1d76:	74 5d                	je     1dd5 <free+0x85>
+  if(s->free == 0)
+    1d78:	8b 53 08             	mov    0x8(%ebx),%edx
+    1d7b:	85 d2                	test   %edx,%edx
+    1d7d:	0f 84 85 00 00 00    	je     1e08 <free+0xb8>
+  NEXTFREE(o) = s->free;
+    1d83:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+    1d85:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+    1d88:	8b 43 0c             	mov    0xc(%ebx),%eax
+    1d8b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+    1d8e:	8b 04 f5 a4 53 00 00 	mov    0x53a4(,%esi,8),%eax
+  s->inuse--;
+    1d95:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+    1d98:	83 c0 01             	add    $0x1,%eax
+    1d9b:	89 04 f5 a4 53 00 00 	mov    %eax,0x53a4(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1da2:	85 d2                	test   %edx,%edx
+    1da4:	75 55                	jne    1dfb <free+0xab>
+    1da6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+    1dab:	89 f1                	mov    %esi,%ecx
+    1dad:	d3 ea                	shr    %cl,%edx
+    1daf:	39 c2                	cmp    %eax,%edx
+    1db1:	73 7d                	jae    1e30 <free+0xe0>
+  if(s->prev)
+    1db3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+    1db6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+    1db8:	85 ff                	test   %edi,%edi
+    1dba:	0f 84 a0 00 00 00    	je     1e60 <free+0x110>
+    s->prev->next = s->next;
+    1dc0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    1dc2:	85 c9                	test   %ecx,%ecx
+    1dc4:	74 06                	je     1dcc <free+0x7c>
+    s->next->prev = s->prev;
+    1dc6:	8b 7b 04             	mov    0x4(%ebx),%edi
+    1dc9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    1dcc:	29 d0                	sub    %edx,%eax
+    1dce:	89 04 f5 a4 53 00 00 	mov    %eax,0x53a4(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    1dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    1dd8:	89 d8                	mov    %ebx,%eax
+}
+    1dda:	5b                   	pop    %ebx
+    1ddb:	5e                   	pop    %esi
+    1ddc:	5f                   	pop    %edi
+    1ddd:	5d                   	pop    %ebp
+    freepages(s);
+    1dde:	e9 fd fc ff ff       	jmp    1ae0 <freepages>
+    1de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1de7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    1de8:	8b 43 10             	mov    0x10(%ebx),%eax
+    1deb:	83 ec 08             	sub    $0x8,%esp
+    1dee:	c1 e0 0c             	shl    $0xc,%eax
+    1df1:	50                   	push   %eax
+    1df2:	53                   	push   %ebx
+    1df3:	e8 6b f8 ff ff       	call   1663 <munmap>
+    1df8:	83 c4 10             	add    $0x10,%esp
+}
+    1dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1dfe:	5b                   	pop    %ebx
+    1dff:	5e                   	pop    %esi
+    1e00:	5f                   	pop    %edi
+    1e01:	5d                   	pop    %ebp
+    1e02:	c3                   	ret
+    1e03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e07:	90                   	nop
+  s->next = *l;
+    1e08:	8b 14 f5 a0 53 00 00 	mov    0x53a0(,%esi,8),%edx
+  s->prev = 0;
+    1e0f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    1e16:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    1e18:	85 d2                	test   %edx,%edx
+    1e1a:	74 06                	je     1e22 <free+0xd2>
+    (*l)->prev = s;
+    1e1c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    1e1f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1e22:	89 1c f5 a0 53 00 00 	mov    %ebx,0x53a0(,%esi,8)
+}
+    1e29:	e9 55 ff ff ff       	jmp    1d83 <free+0x33>
+    1e2e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1e30:	83 ec 0c             	sub    $0xc,%esp
+    1e33:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1e36:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1e39:	6a 00                	push   $0x0
+    1e3b:	c1 e7 0c             	shl    $0xc,%edi
+    1e3e:	01 df                	add    %ebx,%edi
+    1e40:	e8 46 f7 ff ff       	call   158b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1e45:	83 c4 10             	add    $0x10,%esp
+    1e48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1e4b:	39 c7                	cmp    %eax,%edi
+    1e4d:	75 ac                	jne    1dfb <free+0xab>
+    1e4f:	8b 04 f5 a4 53 00 00 	mov    0x53a4(,%esi,8),%eax
+    1e56:	e9 58 ff ff ff       	jmp    1db3 <free+0x63>
+    1e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e5f:	90                   	nop
+    *l = s->next;
+    1e60:	89 0c f5 a0 53 00 00 	mov    %ecx,0x53a0(,%esi,8)
+    1e67:	e9 56 ff ff ff       	jmp    1dc2 <free+0x72>
+    1e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e70:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1e71:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    1e76:	89 e5                	mov    %esp,%ebp
+    1e78:	57                   	push   %edi
+    1e79:	56                   	push   %esi
+    1e7a:	53                   	push   %ebx
+    1e7b:	83 ec 1c             	sub    $0x1c,%esp
+    1e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    1e81:	83 f8 10             	cmp    $0x10,%eax
+    1e84:	0f 86 92 00 00 00    	jbe    1f1c <malloc+0xac>
+    1e8a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e8f:	eb 13                	jmp    1ea4 <malloc+0x34>
+    1e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e98:	89 d3                	mov    %edx,%ebx
+    1e9a:	d3 e3                	shl    %cl,%ebx
+    1e9c:	39 c3                	cmp    %eax,%ebx
+    1e9e:	0f 83 84 00 00 00    	jae    1f28 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1ea4:	83 c1 01             	add    $0x1,%ecx
+    1ea7:	83 f9 0b             	cmp    $0xb,%ecx
+    1eaa:	75 ec                	jne    1e98 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    1eac:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    1eb1:	0f 87 c9 00 00 00    	ja     1f80 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    1eb7:	05 17 10 00 00       	add    $0x1017,%eax
+    1ebc:	89 c3                	mov    %eax,%ebx
+    1ebe:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    1ec1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    1ec6:	77 28                	ja     1ef0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    1ec8:	89 d8                	mov    %ebx,%eax
+    1eca:	e8 91 fd ff ff       	call   1c60 <getpages>
+    1ecf:	85 c0                	test   %eax,%eax
+    1ed1:	0f 84 a9 00 00 00    	je     1f80 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    1ed7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    1ede:	83 c0 18             	add    $0x18,%eax
+}
+    1ee1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ee4:	5b                   	pop    %ebx
+    1ee5:	5e                   	pop    %esi
+    1ee6:	5f                   	pop    %edi
+    1ee7:	5d                   	pop    %ebp
+    1ee8:	c3                   	ret
+    1ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    1ef0:	89 d8                	mov    %ebx,%eax
+    1ef2:	83 ec 08             	sub    $0x8,%esp
+    1ef5:	c1 e0 0c             	shl    $0xc,%eax
+    1ef8:	6a 00                	push   $0x0
+    1efa:	6a ff                	push   $0xffffffff
+    1efc:	6a 22                	push   $0x22
+    1efe:	6a 03                	push   $0x3
+    1f00:	50                   	push   %eax
+    1f01:	6a 00                	push   $0x0
+    1f03:	e8 53 f7 ff ff       	call   165b <mmap>
+    if(s == MAP_FAILED)
+    1f08:	83 c4 20             	add    $0x20,%esp
+    1f0b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1f0e:	74 b8                	je     1ec8 <malloc+0x58>
+      s->shift = MAPRUN;
+    1f10:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    1f17:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    1f1a:	eb c2                	jmp    1ede <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    1f1c:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1f28:	8b 34 cd a0 53 00 00 	mov    0x53a0(,%ecx,8),%esi
+    1f2f:	85 f6                	test   %esi,%esi
+    1f31:	74 57                	je     1f8a <malloc+0x11a>
+  classes[shift].nfree--;
+    1f33:	8b 1c cd a4 53 00 00 	mov    0x53a4(,%ecx,8),%ebx
+  o = s->free;
+    1f3a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    1f3d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1f40:	89 14 cd a4 53 00 00 	mov    %edx,0x53a4(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1f47:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1f49:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    1f4d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1f50:	85 ff                	test   %edi,%edi
+    1f52:	75 8d                	jne    1ee1 <malloc+0x71>
+  if(s->prev)
+    1f54:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1f57:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1f59:	85 db                	test   %ebx,%ebx
+    1f5b:	0f 84 b7 00 00 00    	je     2018 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1f61:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1f63:	85 d2                	test   %edx,%edx
+    1f65:	0f 84 76 ff ff ff    	je     1ee1 <malloc+0x71>
+    s->next->prev = s->prev;
+    1f6b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    1f6e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1f71:	e9 6b ff ff ff       	jmp    1ee1 <malloc+0x71>
+    1f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f7d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    1f83:	31 c0                	xor    %eax,%eax
+}
+    1f85:	5b                   	pop    %ebx
+    1f86:	5e                   	pop    %esi
+    1f87:	5f                   	pop    %edi
+    1f88:	5d                   	pop    %ebp
+    1f89:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    1f8a:	b8 01 00 00 00       	mov    $0x1,%eax
+    1f8f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1f92:	e8 c9 fc ff ff       	call   1c60 <getpages>
+    1f97:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1f9a:	85 c0                	test   %eax,%eax
+    1f9c:	89 c2                	mov    %eax,%edx
+    1f9e:	74 e0                	je     1f80 <malloc+0x110>
+    s->shift = shift;
+    1fa0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1fa3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    1fa5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    1fac:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1fb1:	89 df                	mov    %ebx,%edi
+    1fb3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    1fb5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    1fb7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1fba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1fbd:	83 e8 01             	sub    $0x1,%eax
+    1fc0:	d3 e0                	shl    %cl,%eax
+    1fc2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1fc5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1fc9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1fcc:	eb 04                	jmp    1fd2 <malloc+0x162>
+    1fce:	66 90                	xchg   %ax,%ax
+    1fd0:	89 c8                	mov    %ecx,%eax
+    1fd2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1fd5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1fd7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    1fda:	89 c6                	mov    %eax,%esi
+    1fdc:	39 da                	cmp    %ebx,%edx
+    1fde:	7f f0                	jg     1fd0 <malloc+0x160>
+    1fe0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1fe3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1fe6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1fe9:	8b 04 cd a0 53 00 00 	mov    0x53a0(,%ecx,8),%eax
+  s->prev = 0;
+    1ff0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1ff7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1ff9:	85 c0                	test   %eax,%eax
+    1ffb:	74 03                	je     2000 <malloc+0x190>
+    (*l)->prev = s;
+    1ffd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    2000:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    2003:	89 14 cd a0 53 00 00 	mov    %edx,0x53a0(,%ecx,8)
+    classes[shift].nfree += n;
+    200a:	89 d6                	mov    %edx,%esi
+    200c:	03 1c cd a4 53 00 00 	add    0x53a4(,%ecx,8),%ebx
+    2013:	e9 22 ff ff ff       	jmp    1f3a <malloc+0xca>
+    *l = s->next;
+    2018:	89 14 cd a0 53 00 00 	mov    %edx,0x53a0(,%ecx,8)
+    201f:	e9 3f ff ff ff       	jmp    1f63 <malloc+0xf3>
@@ -0,0 +1,520 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "memlayout.h"
+#include "mman.h"
+#include "memstat.h"
+
+// Tests of memory management, kept apart from usertests,
+// which must stay small enough for mkfs to store.
+
+char buf[8192];
+int stdout = 1;
+
+void
+sbrktest(void)
+{
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+  oldbrk = sbrk(0);
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+  int i;
+  for(i = 0; i < 5000; i++){
+    b = sbrk(1);
+    if(b != a){
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    a = b + 1;
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+  c = sbrk(1);
+  if(c != a + 1){
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    exit();
+  wait();
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+  amt = (BIG) - (uint)a;
+  p = sbrk(amt);
+  if (p != a) {
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+
+  // can one de-allocate?
+  a = sbrk(0);
+  c = sbrk(-4096);
+  if(c == (char*)0xffffffff){
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+  if(c != a - 4096){
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+  c = sbrk(4096);
+  if(c != a || sbrk(0) != a + 4096){
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+  c = sbrk(-(sbrk(0) - oldbrk));
+  if(c != a){
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    ppid = getpid();
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait();
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+      write(fds[1], "x", 1);
+      // sit around until killed
+      for(;;) sleep(1000);
+    }
+    if(pids[i] != -1)
+      read(fds[0], &scratch, 1);
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    if(pids[i] == -1)
+      continue;
+    kill(pids[i]);
+    wait();
+  }
+  if(c == (char*)0xffffffff){
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+}
+
+void
+mem(void)
+{
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+  ppid = getpid();
+  if((pid = fork()) == 0){
+    m1 = 0;
+    while((m2 = malloc(10001)) != 0){
+      *(char**)m2 = m1;
+      m1 = m2;
+    }
+    while(m1){
+      m2 = *(char**)m1;
+      free(m1);
+      m1 = m2;
+    }
+    m1 = malloc(1024*20);
+    if(m1 == 0){
+      printf(1, "couldn't allocate mem?!!\n");
+      kill(ppid);
+      exit();
+    }
+    free(m1);
+    printf(1, "mem ok\n");
+    exit();
+  } else {
+    wait();
+  }
+}
+
+// malloc keeps blocks of all sizes apart and gives
+// freed heap pages back to the kernel.
+void
+malloctest(void)
+{
+  char *b[200], *top;
+  int i, j, n;
+
+  printf(1, "malloc test\n");
+  for(i = 0; i < 200; i++){
+    if((b[i] = malloc(i*37 % 3000 + 1)) == 0){
+      printf(1, "malloc test malloc failed\n");
+      exit();
+    }
+    memset(b[i], i, i*37 % 3000 + 1);
+  }
+  for(i = 0; i < 200; i += 2)
+    free(b[i]);
+  for(i = 0; i < 200; i += 2){
+    b[i] = malloc(i*37 % 3000 + 1);
+    memset(b[i], i, i*37 % 3000 + 1);
+  }
+  for(i = 0; i < 200; i++){
+    n = i*37 % 3000 + 1;
+    for(j = 0; j < n; j++){
+      if(b[i][j] != (char)i){
+        printf(1, "malloc test block %d overwritten\n", i);
+        exit();
+      }
+    }
+    free(b[i]);
+  }
+
+  top = sbrk(0);
+  for(i = 0; i < 64; i++){
+    b[i] = malloc(20000);
+    b[i][19999] = 1;
+  }
+  for(i = 0; i < 64; i++)
+    free(b[i]);
+  if(sbrk(0) > top){
+    printf(1, "malloc test heap not trimmed\n");
+    exit();
+  }
+
+  // Big enough for mmap().
+  b[0] = malloc(200*1024);
+  b[0][0] = b[0][200*1024-1] = 1;
+  free(b[0]);
+  printf(1, "malloc test OK\n");
+}
+
+// fork shares pages copy-on-write; writes on either side
+// must stay private to the writer.
+void
+cowtest(void)
+{
+  char *p;
+  int i, pid, fds[2];
+  char c;
+
+  printf(1, "cow test\n");
+  p = sbrk(8*4096);
+  if(p == (char*)-1){
+    printf(1, "cow test sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < 8*4096; i += 4096)
+    p[i] = 'a';
+  if(pipe(fds) != 0){
+    printf(1, "cow test pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "cow test fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // the kernel writing into a shared page must copy it too
+    read(fds[0], p + 4096, 1);
+    if(p[4096] != 'k'){
+      printf(1, "cow test child read failed\n");
+      exit();
+    }
+    for(i = 0; i < 8*4096; i += 4096)
+      p[i] = 'c';
+    exit();
+  }
+  for(i = 0; i < 8*4096; i += 4096)
+    p[i] = 'p';
+  write(fds[1], "k", 1);
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  for(i = 0; i < 8*4096; i += 4096){
+    c = p[i];
+    if(c != 'p'){
+      printf(1, "cow test failed: parent saw %c\n", c);
+      exit();
+    }
+  }
+  sbrk(-8*4096);
+  printf(1, "cow test OK\n");
+}
+
+// mmap of a file sees its contents; a shared writable
+// mapping reaches the file after munmap; anonymous
+// mappings are zero and shared ones survive fork.
+void
+mmaptest(void)
+{
+  char *p;
+  int fd, i, pid, ppid;
+
+  printf(1, "mmap test\n");
+  if(mmap(0, -1, PROT_READ, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0) != MAP_FAILED){
+    printf(1, "mmap test mapped a length that rounds to 0\n");
+    exit();
+  }
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  for(i = 0; i < 6000; i++)
+    buf[i] = 'a' + i % 26;
+  if(fd < 0 || write(fd, buf, 6000) != 6000){
+    printf(1, "mmap test create failed\n");
+    exit();
+  }
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap test mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < 6000; i++){
+    if(p[i] != 'a' + i % 26){
+      printf(1, "mmap test wrong data at %d\n", i);
+      exit();
+    }
+  }
+  if(p[6000] != 0){
+    printf(1, "mmap test page tail not zero\n");
+    exit();
+  }
+  p[5000] = 'Z';
+  if(munmap(p, 6000) != 0){
+    printf(1, "mmap test munmap failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("mmapfile", O_RDONLY);
+  if(read(fd, buf, 6001) != 6000 || buf[5000] != 'Z'){
+    printf(1, "mmap test write-back failed\n");
+    exit();
+  }
+  close(fd);
+
+  // Private mappings share cached pages, which must neither
+  // take a mapping's writes nor outlive writes to the file.
+  fd = open("mmapfile", O_RDWR);
+  p = mmap(0, 6000, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || p[5000] != 'Z'){
+    printf(1, "mmap test private mmap failed\n");
+    exit();
+  }
+  p[5000] = 'Y';
+  munmap(p, 6000);
+  p = mmap(0, 6000, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || p[5000] != 'Z'){
+    printf(1, "mmap test private write reached the file\n");
+    exit();
+  }
+  munmap(p, 6000);
+  buf[5000] = 'W';
+  write(fd, buf, 6000);
+  p = mmap(0, 6000, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || p[5000] != 'W'){
+    printf(1, "mmap test private mapping missed a write\n");
+    exit();
+  }
+  munmap(p, 6000);
+  close(fd);
+  unlink("mmapfile");
+
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED || p[4096] != 0){
+    printf(1, "mmap test anonymous mmap failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    p[4096] = 'c';
+    exit();
+  }
+  wait();
+  if(p[4096] != 'c'){
+    printf(1, "mmap test shared page not shared\n");
+    exit();
+  }
+  munmap(p, 3*4096);
+  ppid = getpid();
+  pid = fork();
+  if(pid == 0){
+    p[0] = 1;
+    printf(1, "mmap test unmapped page still mapped\n");
+    kill(ppid);
+    exit();
+  }
+  wait();
+  printf(1, "mmap test OK\n");
+}
+
+// A shared-memory segment attached by two processes
+// carries data both ways and outlives shmrm while attached.
+void
+shmtest(void)
+{
+  int id, pid;
+  char *p;
+
+  printf(1, "shm test\n");
+  id = shmget(1234, 2*4096);
+  if(id < 0 || shmget(1234, 4096) != id){
+    printf(1, "shm test shmget failed\n");
+    exit();
+  }
+  p = shmat(id);
+  if(p == (char*)-1 || p[4096] != 0){
+    printf(1, "shm test shmat failed\n");
+    exit();
+  }
+  p[0] = 'p';
+  pid = fork();
+  if(pid == 0){
+    char *q = shmat(shmget(1234, 2*4096));
+    if(q == (char*)-1 || q[0] != 'p'){
+      printf(1, "shm test child saw no data\n");
+      exit();
+    }
+    q[4096] = 'c';
+    shmdt(q);
+    exit();
+  }
+  wait();
+  if(p[4096] != 'c'){
+    printf(1, "shm test parent saw no data\n");
+    exit();
+  }
+  if(shmrm(id) != 0 || p[4096] != 'c' || shmdt(p) != 0){
+    printf(1, "shm test shmrm failed\n");
+    exit();
+  }
+  printf(1, "shm test OK\n");
+}
+
+// memstat counts the pages a process touches.
+void
+memstattest(void)
+{
+  struct memstat before, after;
+  char *a;
+  int i;
+
+  printf(1, "memstat test\n");
+  if(memstat(0, &before) < 0 || before.rss == 0 || before.free > before.total){
+    printf(1, "memstat test bad numbers\n");
+    exit();
+  }
+  a = sbrk(10*4096);
+  for(i = 0; i < 10; i++)
+    a[i*4096] = 1;
+  if(memstat(getpid(), &after) < 0 || after.rss < before.rss + 10){
+    printf(1, "memstat test resident pages not counted\n");
+    exit();
+  }
+  sbrk(-10*4096);
+  if(memstat(1000000, &after) >= 0){
+    printf(1, "memstat test found a missing process\n");
+    exit();
+  }
+  printf(1, "memstat test OK\n");
+}
+
+// Touching more pages than memory holds pages some out to the
+// swap area; they must come back with what was written there.
+void
+swaptest(void)
+{
+  struct memstat before, after;
+  char *p;
+  int i, n;
+
+  printf(1, "swap test\n");
+  if(memstat(0, &before) < 0 || before.swapfree < 64){
+    printf(1, "swap test: no swap area, skipped\n");
+    return;
+  }
+  // A mapped region, not the heap, so that no page
+  // goes into a 4 MB page, which is never paged out.
+  n = before.free + before.swapfree / 2;
+  p = mmap(0, n*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED){
+    printf(1, "swap test mmap failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    *(int*)(p + i*4096) = i;
+  if(memstat(0, &after) < 0 || after.swapped == 0){
+    printf(1, "swap test nothing paged out\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(*(int*)(p + i*4096) != i){
+      printf(1, "swap test page %d lost its contents\n", i);
+      exit();
+    }
+  }
+  munmap(p, n*4096);
+  if(memstat(0, &after) < 0 || after.swapfree < before.swapfree){
+    printf(1, "swap test slots not freed\n");
+    exit();
+  }
+  printf(1, "swap test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "memtests starting\n");
+  sbrktest();
+  mem();
+  malloctest();
+  cowtest();
+  mmaptest();
+  shmtest();
+  memstattest();
+  swaptest();
+  printf(1, "memtests done\n");
+  exit();
+}
@@ -0,0 +1,406 @@
+//
+// Mapped regions of user memory: mmap() and munmap().
+// Each process has NVMA regions (struct vma in proc.h) placed
+// down from KERNBASE, above the heap. Pages are filled on first
+// touch, from the file or with zeros, by vmafault(), which
+// pagefault() in vm.c calls for addresses inside a region.
+//
+// exec() maps the program's segments as private file regions
+// below the heap (see vmaload), so a program's text and data
+// are read in only as they are touched.
+//
+// Private regions become copy-on-write across fork like the
+// heap. Shared regions are populated in full at fork, so that
+// parent and child then map the same pages; dirty pages of a
+// shared file mapping are written back to the file at munmap,
+// exec and exit.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "fs.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
+#include "mman.h"
+
+// Return the region of p that contains va, or 0.
+struct vma*
+findvma(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Lowest address of the regions above the heap of p,
+// which the heap must not grow past.
+uint
+vmabase(struct proc *p)
+{
+  struct vma *v;
+  uint base;
+
+  base = KERNBASE;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && v->start >= p->sz && v->start < base)
+      base = v->start;
+  return base;
+}
+
+// End of the user memory of p that contains addr: the heap
+// or a region. Returns 0 if addr is not user memory.
+uint
+uvmlimit(struct proc *p, uint addr)
+{
+  struct vma *v;
+
+  if(addr < p->sz)
+    return p->sz;
+  if((v = findvma(p, addr)) != 0)
+    return v->end;
+  return 0;
+}
+
+// Does some region of p overlap [start, end)?
+int
+vmaoverlap(struct proc *p, uint start, uint end)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end && start < v->end && end > v->start)
+      return 1;
+  return 0;
+}
+
+// Is [addr, addr+len) free for a new region of p?
+static int
+vmafree(struct proc *p, uint addr, uint len)
+{
+  if(addr < PGROUNDUP(p->sz) || addr + len > KERNBASE || addr + len < addr)
+    return 0;
+  return !vmaoverlap(p, addr, addr + len);
+}
+
+static struct vma*
+allocvma(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end == 0)
+      return v;
+  return 0;
+}
+
+// Take another reference to v's file, for a copy of v.
+static void
+dupvma(struct vma *v)
+{
+  if(v->ip == 0)
+    return;
+  idup(v->ip);
+  if(v->text)
+    __sync_fetch_and_add(&v->ip->ntext, 1);
+}
+
+// Drop v's reference to its file and free the slot.
+static void
+releasevma(struct vma *v)
+{
+  if(v->ip){
+    if(v->text)
+      __sync_fetch_and_sub(&v->ip->ntext, 1);
+    begin_op();
+    iput(v->ip);
+    end_op();
+  }
+  memset(v, 0, sizeof(*v));
+}
+
+// Map len bytes of f from offset off (or zeros, for MAP_ANONYMOUS)
+// into p, at addr if that is free and otherwise just below the
+// lowest region. Returns the address, or -1.
+uint
+vmamap(struct proc *p, uint addr, uint len, int prot, int flags,
+       struct file *f, uint off)
+{
+  struct vma *v;
+  int share;
+
+  share = flags & (MAP_SHARED|MAP_PRIVATE);
+  // Round first: a len near 2^32 rounds up to 0.
+  len = PGROUNDUP(len);
+  if(len == 0 || len > KERNBASE || off % PGSIZE || (prot & PROT_READ) == 0 ||
+     (share != MAP_SHARED && share != MAP_PRIVATE))
+    return -1;
+  if((flags & MAP_ANONYMOUS) == 0){
+    if(f == 0 || f->type != FD_INODE || !f->readable)
+      return -1;
+    if(share == MAP_SHARED && (prot & PROT_WRITE) &&
+       (!f->writable || f->ip->ntext > 0))
+      return -1;
+    ilockshared(f->ip);
+    if(f->ip->type != T_FILE){
+      iunlockshared(f->ip);
+      return -1;
+    }
+    iunlockshared(f->ip);
+  }
+
+  if(addr == 0 || addr % PGSIZE || !vmafree(p, addr, len)){
+    addr = vmabase(p) - len;
+    if(!vmafree(p, addr, len))
+      return -1;
+  }
+  if((v = allocvma(p)) == 0)
+    return -1;
+  v->start = addr;
+  v->end = addr + len;
+  v->prot = prot;
+  v->flags = flags;
+  v->off = off;
+  if((flags & MAP_ANONYMOUS) == 0){
+    v->ip = idup(f->ip);
+    v->filesz = len;
+  }
+  return addr;
+}
+
+// Number of free region slots of p.
+int
+vmaslots(struct proc *p)
+{
+  struct vma *v;
+  int n;
+
+  n = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end == 0)
+      n++;
+  return n;
+}
+
+// Map [start, end) of p, a program segment below p->sz, to the
+// first filesz bytes of ip from offset off, followed by zeros.
+// Unlike mmap(), off need not be page-aligned. Since the pages
+// are read from ip as they are touched, ip cannot be written
+// while the region exists (see filewrite). Returns 0, or -1
+// if no slot is free.
+int
+vmaload(struct proc *p, uint start, uint end, int prot,
+        struct inode *ip, uint off, uint filesz)
+{
+  struct vma *v;
+
+  if((v = allocvma(p)) == 0)
+    return -1;
+  v->start = start;
+  v->end = end;
+  v->prot = prot;
+  v->flags = MAP_PRIVATE;
+  v->ip = idup(ip);
+  v->off = off;
+  v->filesz = filesz;
+  v->text = 1;
+  __sync_fetch_and_add(&ip->ntext, 1);
+  return 0;
+}
+
+// Fill the page at va in region v of p: read it from the
+// file, or zero it. A private region maps the file's page from
+// the page cache (see pcache.c), copy-on-write if writable.
+// Returns 0 on success, -1 if out of memory.
+int
+vmafault(struct proc *p, struct vma *v, uint va)
+{
+  char *mem;
+  uint a, n, perm;
+
+  a = PGROUNDDOWN(va);
+  perm = PTE_U | ((v->prot & PROT_WRITE) ? PTE_W : 0);
+  n = 0;
+  if(v->ip && a - v->start < v->filesz){
+    n = v->filesz - (a - v->start);
+    if(n > PGSIZE)
+      n = PGSIZE;
+  }
+  if(n > 0 && (v->flags & MAP_PRIVATE)){
+    ilockshared(v->ip);
+    mem = pcacheget(v->ip, v->off + (a - v->start), n);
+    iunlockshared(v->ip);
+    if(mem == 0)
+      return -1;
+    if(perm & PTE_W)
+      perm = (perm & ~PTE_W) | PTE_COW;
+  } else {
+    if((mem = kallocswap(1)) == 0)
+      return -1;
+    // A page past the end of the file stays zero.
+    if(n > 0){
+      ilockshared(v->ip);
+      readi(v->ip, mem, v->off + (a - v->start), n);
+      iunlockshared(v->ip);
+    }
+  }
+  if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Write the dirty pages of v in [start, end) back to its
+// file, within the file's current size.
+static void
+writeback(struct proc *p, struct vma *v, uint start, uint end)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  uint a, off, i, n;
+  pte_t *pte;
+  char *mem;
+
+  for(a = start; a < end; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_D)) != (PTE_P|PTE_D))
+      continue;
+    mem = P2V(PTE_ADDR(*pte));
+    off = v->off + (a - v->start);
+    // As in filewrite, a few blocks per transaction.
+    for(i = 0; i < PGSIZE; i += n){
+      n = PGSIZE - i;
+      if(n > max)
+        n = max;
+      begin_op();
+      ilock(v->ip);
+      if(off + i >= v->ip->size)
+        n = 0;
+      else if(off + i + n > v->ip->size)
+        n = v->ip->size - (off + i);
+      if(n > 0)
+        writei(v->ip, mem + i, off + i, n);
+      iunlock(v->ip);
+      end_op();
+      if(n == 0)
+        break;
+    }
+  }
+}
+
+// Unmap [start, end), which lies within v, shrinking v
+// or freeing it.
+static void
+unmaprange(struct proc *p, struct vma *v, uint start, uint end)
+{
+  uint d;
+
+  if(v->ip && (v->flags & MAP_SHARED) && (v->prot & PROT_WRITE))
+    writeback(p, v, start, end);
+  deallocuvm(p->pgdir, end, start);
+  if(start == v->start && end == v->end){
+    releasevma(v);
+  } else if(start == v->start){
+    d = end - v->start;
+    v->start = end;
+    v->off += d;
+    v->filesz = v->filesz > d ? v->filesz - d : 0;
+  } else {
+    v->end = start;
+  }
+}
+
+// Unmap [addr, addr+len) from p, which may cover any part
+// of any regions. Returns 0, or -1 if addr is not aligned
+// or a region would have to be split with no slot free.
+int
+vmaunmap(struct proc *p, uint addr, uint len)
+{
+  struct vma *v, *nv;
+  uint start, end, d;
+
+  start = addr;
+  end = PGROUNDUP(addr + len);
+  if(start % PGSIZE || len == 0 || end < start || end > KERNBASE)
+    return -1;
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->end == 0 || v->end <= start || v->start >= end)
+      continue;
+    if(start > v->start && end < v->end){
+      // A hole in the middle: move the part above it
+      // to a region of its own.
+      if((nv = allocvma(p)) == 0)
+        return -1;
+      *nv = *v;
+      d = end - v->start;
+      nv->start = end;
+      nv->off += d;
+      nv->filesz = v->filesz > d ? v->filesz - d : 0;
+      dupvma(nv);
+      v->end = end;
+    }
+    unmaprange(p, v, start > v->start ? start : v->start,
+               end < v->end ? end : v->end);
+  }
+  if(p == myproc())
+    switchuvm(p);
+  return 0;
+}
+
+// Unmap all of p's regions, as exit and exec do.
+void
+vmaclear(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->end)
+      unmaprange(p, v, v->start, v->end);
+}
+
+// Give the new process np the regions of p, sharing their
+// pages. The program's segments lie below p->sz, where
+// copyuvm() has already shared them.
+// Returns 0, or -1 with np left without regions.
+int
+vmafork(struct proc *np, struct proc *p)
+{
+  struct vma *v, *nv;
+  uint a;
+  pte_t *pte;
+
+  for(v = p->vma, nv = np->vma; v < &p->vma[NVMA]; v++, nv++){
+    if(v->end == 0)
+      continue;
+    if(v->flags & MAP_SHARED){
+      // Both processes must end up with the same pages.
+      for(a = v->start; a < v->end; a += PGSIZE){
+        pte = walkpgdir(p->pgdir, (char*)a, 0);
+        if((pte == 0 || (*pte & PTE_P) == 0) && vmafault(p, v, a) < 0)
+          goto bad;
+      }
+    }
+    *nv = *v;
+    dupvma(nv);
+    if(v->start < p->sz)
+      continue;
+    if(shareuvm(np->pgdir, p->pgdir, v->start, v->end, v->flags & MAP_SHARED) < 0)
+      goto bad;
+  }
+  return 0;
+
+bad:
+  // The pages go with np->pgdir.
+  for(nv = np->vma; nv < &np->vma[NVMA]; nv++)
+    if(nv->end)
+      releasevma(nv);
+  return -1;
+}
@@ -3,11 +3,28 @@
 #define NCPU 1                    // maximum number of CPUs
 #define NOFILE 16                 // open files per process
 #define NFILE 100                 // open files per system
+#define NKCACHE 16                // slab caches, kmalloc size classes included
+#define NVMA 16                   // mapped regions per process
+#define NSHM 16                   // shared-memory segments per system
+#define NPCACHE 128               // file pages cached for private mappings
+#define NOKSYNC 8                 // open semaphores and events per process
+#define NKSYNC 64                 // semaphores and events per system
 #define NINODE 50                 // maximum number of active i-nodes
 #define NDEV 10                   // maximum major device number
 #define ROOTDEV 1                 // device number of file system root disk
 #define MAXARG 32                 // max exec arguments
+#define PATHLEN 128               // bytes of a process's command search path
+#define NCMDCACHE 32              // commands whose path search is cached
 #define MAXOPBLOCKS 10            // max # of blocks any FS op writes
 #define LOGSIZE (MAXOPBLOCKS * 3) // max data blocks in on-disk log
 #define NBUF (MAXOPBLOCKS * 3)    // size of disk block cache
 #define FSSIZE 1000               // size of file system in blocks
+#define SWAPBLOCKS 8192           // size of swap area after the file system, in blocks
+#define SWAPRESERVE 64            // free pages user memory leaves to the kernel when swap is on
+#define GANGSLICE 10              // ticks a gang keeps preference on the CPUs
+#define SLEEPSPIN 1000            // max spins on a sleeplock whose holder is running
+#define MAXORDER 10               // largest buddy block is 2^MAXORDER pages
+#define KMAGSIZE 64               // free pages a CPU caches before draining
+#define KMAGBATCH 32              // pages moved between a CPU and the global list
+#define KZEROPOOL 64              // pages kept zeroed by the idle scheduler
+#define RECLAIMBATCH 4            // reaped processes freed per reclaim() pass
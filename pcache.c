@@ -0,0 +1,157 @@
+//
+// Cache of pages read from files for private mappings, chiefly
+// the text and data of programs (see execinto). Every process
+// running the same program maps the same read-only pages,
+// copy-on-write where the mapping is writable, instead of
+// reading its own copies from the disk.
+//
+// An entry is the page holding n bytes of a file from offset
+// off, zero-filled past them, and holds one reference to it.
+// Writing or truncating the file drops its entries; processes
+// that mapped them keep the old contents, as they would have
+// with a copy.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+struct pcentry {
+  uint dev;
+  uint inum;
+  uint off;
+  uint n;
+  char *page;   // 0 if the entry is free
+  uint used;    // pcache.clock when last looked up
+};
+
+struct {
+  struct spinlock lock;
+  struct pcentry e[NPCACHE];
+  int n;        // entries in use
+  uint clock;
+  uint hits;
+  uint misses;
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Return the entry for the page, or 0.
+// Caller holds pcache.lock.
+static struct pcentry*
+pclookup(struct inode *ip, uint off, uint n)
+{
+  struct pcentry *e;
+
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++)
+    if(e->page && e->inum == ip->inum && e->dev == ip->dev &&
+       e->off == off && e->n == n)
+      return e;
+  return 0;
+}
+
+// Return a free entry, evicting the least recently used one
+// if there is none. Caller holds pcache.lock.
+static struct pcentry*
+pcvictim(void)
+{
+  struct pcentry *e, *lru;
+
+  lru = 0;
+  for(e = pcache.e; e < &pcache.e[NPCACHE]; e++){
+    if(e->page == 0)
+      return e;
+    if(lru == 0 || pcache.clock - e->used > pcache.clock - lru->used)
+      lru = e;
+  }
+  kfree(lru->page);
+  lru->page = 0;
+  pcache.n--;
+  return lru;
+}
+
+// Return a referenced page holding n bytes of ip from offset
+// off, followed by zeros, reading it on a miss. The caller
+// must not write to it. Caller holds ip's lock, shared or not.
+// Returns 0 if out of memory.
+char*
+pcacheget(struct inode *ip, uint off, uint n)
+{
+  struct pcentry *e;
+  char *mem;
+
+  acquire(&pcache.lock);
+  if((e = pclookup(ip, off, n)) != 0){
+    e->used = ++pcache.clock;
+    pcache.hits++;
+    kref(e->page);
+    release(&pcache.lock);
+    return e->page;
+  }
+  pcache.misses++;
+  release(&pcache.lock);
+
+  if((mem = kallocswap(1)) == 0)
+    return 0;
+  readi(ip, mem, off, n);
+
+  acquire(&pcache.lock);
+  if((e = pclookup(ip, off, n)) != 0){
+    // Another process sharing ip's lock read it too.
+    kfree(mem);
+    mem = e->page;
+  } else {
+    e = pcvictim();
+    e->dev = ip->dev;
+    e->inum = ip->inum;
+    e->off = off;
+    e->n = n;
+    e->page = mem;
+    pcache.n++;
+  }
+  e->used = ++pcache.clock;
+  kref(mem);
+  release(&pcache.lock);
+  return mem;
+}
+
+// Drop the cached pages of ip, which is about to change.
+// Caller holds ip's lock exclusively.
+void
+pcacheinval(struct inode *ip)
+{
+  struct pcentry *e;
+
+  acquire(&pcache.lock);
+  for(e = pcache.e; pcache.n > 0 && e < &pcache.e[NPCACHE]; e++){
+    if(e->page && e->inum == ip->inum && e->dev == ip->dev){
+      kfree(e->page);
+      e->page = 0;
+      pcache.n--;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Pages held by the cache.
+int
+pcachepages(void)
+{
+  return pcache.n;
+}
+
+void
+print_pcache_stats(void)
+{
+  cprintf("file page cache: %d pages, %d hits, %d misses\n",
+          pcache.n, pcache.hits, pcache.misses);
+}
@@ -2,14 +2,64 @@
 #include "stat.h"
 #include "user.h"
 
+// printf() collects its output in a buffer and writes it with
+// one system call rather than one per character. Output to fd 1
+// stays buffered across calls: up to the end of a line when fd 1
+// is the console, and until the buffer fills otherwise. fflush()
+// writes it out, as exit, fork, exec and gets do (see ulib.c),
+// and forgets which of the two fd 1 is: a program that points
+// fd 1 elsewhere calls fflush(1) first, and the next printf
+// looks again.
+
+#define OBUFSIZE 512
+
+#define LINEBUF 1   // write at each newline
+#define FULLBUF 2   // write when full
+
+struct obuf {
+  int fd;
+  int mode;   // 0: write at the end of each printf
+  int n;
+  char buf[OBUFSIZE];
+};
+
+static struct obuf out;     // fd 1
+static struct obuf other;   // any other fd
+
+extern void (*stdioflush)(void);
+
+static void
+bflush(struct obuf *b)
+{
+  if(b->n > 0)
+    write(b->fd, b->buf, b->n);
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+  bflush(&out);
+  out.mode = 0;
+}
+
+void
+fflush(int fd)
+{
+  if(fd == 1)
+    flushout();
+}
+
 static void
-putc(int fd, char c)
+putc(struct obuf *b, char c)
 {
-  write(fd, &c, 1);
+  b->buf[b->n++] = c;
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    bflush(b);
 }
 
 static void
-printint(int fd, int xx, int base, int sgn)
+printint(struct obuf *b, int xx, int base, int sgn)
 {
   static char digits[] = "0123456789ABCDEF";
   char buf[16];
@@ -32,17 +82,31 @@ printint(int fd, int xx, int base, int sgn)
     buf[i++] = '-';
 
   while(--i >= 0)
-    putc(fd, buf[i]);
+    putc(b, buf[i]);
 }
 
 // Print to the given fd. Only understands %d, %x, %p, %s.
 void
 printf(int fd, const char *fmt, ...)
 {
+  struct obuf *b;
+  struct stat st;
   char *s;
   int c, i, state;
   uint *ap;
 
+  if(fd == 1){
+    b = &out;
+    if(b->mode == 0){
+      b->fd = 1;
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+      stdioflush = flushout;
+    }
+  } else {
+    b = &other;
+    b->fd = fd;
+  }
+
   state = 0;
   ap = (uint*)(void*)&fmt + 1;
   for(i = 0; fmt[i]; i++){
@@ -51,14 +115,14 @@ printf(int fd, const char *fmt, ...)
       if(c == '%'){
         state = '%';
       } else {
-        putc(fd, c);
+        putc(b, c);
       }
     } else if(state == '%'){
       if(c == 'd'){
-        printint(fd, *ap, 10, 1);
+        printint(b, *ap, 10, 1);
         ap++;
       } else if(c == 'x' || c == 'p'){
-        printint(fd, *ap, 16, 0);
+        printint(b, *ap, 16, 0);
         ap++;
       } else if(c == 's'){
         s = (char*)*ap;
@@ -66,20 +130,22 @@ printf(int fd, const char *fmt, ...)
         if(s == 0)
           s = "(null)";
         while(*s != 0){
-          putc(fd, *s);
+          putc(b, *s);
           s++;
         }
       } else if(c == 'c'){
-        putc(fd, *ap);
+        putc(b, *ap);
         ap++;
       } else if(c == '%'){
-        putc(fd, c);
+        putc(b, c);
       } else {
         // Unknown % sequence.  Print it to draw attention.
-        putc(fd, '%');
-        putc(fd, c);
+        putc(b, '%');
+        putc(b, c);
       }
       state = 0;
     }
   }
+  if(b->mode == 0)
+    bflush(b);
 }
@@ -6,6 +6,8 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "spawn.h"
+#include "memstat.h"
 #include "date.h"
 
 struct
@@ -16,6 +18,35 @@ struct
 
 static struct proc *initproc;
 
+// Memory of processes reaped by wait(), freed later by
+// reclaim(): when a CPU is idle or kalloc() runs out, so
+// that wait() need not walk a large address space. Each
+// entry lives in the process's old kernel stack.
+struct deadproc
+{
+  struct deadproc *next;
+  pde_t *pgdir;
+};
+
+struct
+{
+  struct spinlock lock;
+  struct deadproc *list;
+  int n;
+} reclaimq;
+
+// Gang scheduling: once a CPU dispatches a member of a gang,
+// the other CPUs prefer that gang's runnable members for
+// GANGSLICE ticks, so the gang's members run side by side
+// instead of waiting (e.g. at a barrier) for one another.
+// Protected by ptable.lock.
+struct
+{
+  int enabled;
+  int active; // gang being dispatched, or 0
+  uint start; // tick at which active was chosen
+} gang;
+
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
@@ -25,6 +56,46 @@ static void wakeup1(void *chan);
 void pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  initlock(&reclaimq.lock, "reclaimq");
+}
+
+// Queue the kernel stack and page table of a reaped process
+// for reclaim().
+static void deferfree(char *kstack, pde_t *pgdir)
+{
+  struct deadproc *d;
+
+  d = (struct deadproc *)kstack;
+  d->pgdir = pgdir;
+  acquire(&reclaimq.lock);
+  d->next = reclaimq.list;
+  reclaimq.list = d;
+  reclaimq.n++;
+  release(&reclaimq.lock);
+}
+
+// Free the memory of up to n reaped processes.
+// Returns how many were freed.
+int reclaim(int n)
+{
+  struct deadproc *d;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    acquire(&reclaimq.lock);
+    if ((d = reclaimq.list) != 0)
+    {
+      reclaimq.list = d->next;
+      reclaimq.n--;
+    }
+    release(&reclaimq.lock);
+    if (d == 0)
+      break;
+    freevm(d->pgdir);
+    kfree((char *)d);
+  }
+  return i;
 }
 
 // Must be called with interrupts disabled
@@ -98,6 +169,13 @@ found:
   p->ticket = 10;
   p->cycleNum = 1;
   p->remaining_priority = 10;
+  p->base_level = -1;
+  p->sleeplocks = 0;
+  p->gang = 0;
+  p->path[0] = 0;
+  p->pathid = 0;
+  p->upreempted = 0;
+  p->prefaulted = 0;
   p->state = EMBRYO;
   p->pid = nextpid++;
 
@@ -175,8 +253,13 @@ int growproc(int n)
   sz = curproc->sz;
   if (n > 0)
   {
-    if ((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Heap pages are allocated and zeroed on first touch (see
+    // pagefault in vm.c). Only refuse growth that memory
+    // and swap free right now could never back.
+    if (sz + n < sz || sz + n > vmabase(curproc) ||
+        PGROUNDUP((uint)n) / PGSIZE > kfreepages() + swapfreepages())
       return -1;
+    sz += n;
   }
   else if (n < 0)
   {
@@ -211,6 +294,15 @@ int fork(void)
     np->state = UNUSED;
     return -1;
   }
+  if (vmafork(np, curproc) < 0)
+  {
+    freevm(np->pgdir);
+    np->pgdir = 0;
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
   np->sz = curproc->sz;
   np->parent = curproc;
   *np->tf = *curproc->tf;
@@ -221,7 +313,13 @@ int fork(void)
   for (i = 0; i < NOFILE; i++)
     if (curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
+  for (i = 0; i < NOKSYNC; i++)
+    if (curproc->oksync[i])
+      np->oksync[i] = ksyncdup(curproc->oksync[i]);
   np->cwd = idup(curproc->cwd);
+  np->gang = curproc->gang;
+  safestrcpy(np->path, curproc->path, PATHLEN);
+  np->pathid = curproc->pathid;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -236,6 +334,98 @@ int fork(void)
   return pid;
 }
 
+// Start the program at path in a new child process, with
+// argument strings argv, as fork() and exec() would but
+// without copying the parent's memory. The child gets the
+// parent's open files, changed by the n file actions act.
+// Returns the child's pid, or -1.
+int spawn(char *path, char **argv, struct spawn_action *act, int n)
+{
+  int i, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+  struct spawn_action *a;
+  struct file *f;
+
+  if ((np = allocproc()) == 0)
+    return -1;
+  *np->tf = *curproc->tf;
+  np->pgdir = 0;
+  if (execinto(np, path, argv) < 0)
+  {
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  np->parent = curproc;
+
+  for (i = 0; i < NOFILE; i++)
+    if (curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  for (a = act; a < &act[n]; a++)
+  {
+    if (a->fd < 0 || a->fd >= NOFILE)
+      goto bad;
+    switch (a->op)
+    {
+    case SPAWN_CLOSE:
+      f = 0;
+      break;
+    case SPAWN_DUP2:
+      if (np->ofile[a->fd] == 0 || a->newfd < 0 || a->newfd >= NOFILE)
+        goto bad;
+      f = filedup(np->ofile[a->fd]);
+      break;
+    case SPAWN_OPEN:
+      if ((f = fileopen(a->path, a->mode)) == 0)
+        goto bad;
+      break;
+    default:
+      goto bad;
+    }
+    i = a->op == SPAWN_DUP2 ? a->newfd : a->fd;
+    if (np->ofile[i])
+      fileclose(np->ofile[i]);
+    np->ofile[i] = f;
+  }
+
+  for (i = 0; i < NOKSYNC; i++)
+    if (curproc->oksync[i])
+      np->oksync[i] = ksyncdup(curproc->oksync[i]);
+  np->cwd = idup(curproc->cwd);
+  np->gang = curproc->gang;
+  safestrcpy(np->path, curproc->path, PATHLEN);
+  np->pathid = curproc->pathid;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->state = RUNNABLE;
+
+  release(&ptable.lock);
+
+  return pid;
+
+bad:
+  for (i = 0; i < NOFILE; i++)
+  {
+    if (np->ofile[i])
+    {
+      fileclose(np->ofile[i]);
+      np->ofile[i] = 0;
+    }
+  }
+  vmaclear(np);
+  freevm(np->pgdir);
+  np->pgdir = 0;
+  kfree(np->kstack);
+  np->kstack = 0;
+  np->state = UNUSED;
+  return -1;
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -248,6 +438,9 @@ void exit(void)
   if (curproc == initproc)
     panic("init exiting");
 
+  // Unmap mapped regions, writing shared file mappings back.
+  vmaclear(curproc);
+
   // Close all open files.
   for (fd = 0; fd < NOFILE; fd++)
   {
@@ -257,6 +450,14 @@ void exit(void)
       curproc->ofile[fd] = 0;
     }
   }
+  for (fd = 0; fd < NOKSYNC; fd++)
+  {
+    if (curproc->oksync[fd])
+    {
+      ksyncclose(curproc->oksync[fd]);
+      curproc->oksync[fd] = 0;
+    }
+  }
 
   begin_op();
   iput(curproc->cwd);
@@ -307,9 +508,9 @@ int wait(void)
       {
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
+        deferfree(p->kstack, p->pgdir);
         p->kstack = 0;
-        freevm(p->pgdir);
+        p->pgdir = 0;
         p->pid = 0;
         p->parent = 0;
         p->name[0] = 0;
@@ -379,6 +580,14 @@ void run_p(struct cpu *c, struct proc *p)
   if (p->state != RUNNABLE)
     return;
 
+  if (gang.enabled && p->gang && gang.active != p->gang)
+  {
+    gang.active = p->gang;
+    acquire(&tickslock);
+    gang.start = ticks;
+    release(&tickslock);
+  }
+
   // p->cycleNum++;
   // Switch to chosen process.  It is the process's job
   // to release ptable.lock and then reacquire it
@@ -492,6 +701,43 @@ void run_first_level_processes()
   }
 }
 
+// Run a runnable member of the active gang, if any.
+// Returns 1 if a process was run.
+int run_gang_processes()
+{
+  struct proc *p;
+  struct cpu *c = mycpu();
+  int alive = 0;
+  uint now;
+
+  if (gang.active == 0)
+    return 0;
+  acquire(&tickslock);
+  now = ticks;
+  release(&tickslock);
+  if (now - gang.start >= GANGSLICE)
+  {
+    // Let the levels pick again.
+    gang.active = 0;
+    return 0;
+  }
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  {
+    if (p->gang != gang.active)
+      continue;
+    if (p->state == RUNNABLE)
+    {
+      run_p(c, p);
+      return 1;
+    }
+    if (p->state == RUNNING || p->state == SLEEPING)
+      alive = 1;
+  }
+  if (!alive)
+    gang.active = 0;
+  return 0;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -513,6 +759,11 @@ void scheduler(void)
     // Loop over process table looking for process to run.
     int ran = 0;
     acquire(&ptable.lock);
+    if (gang.enabled && run_gang_processes())
+    {
+      release(&ptable.lock);
+      continue;
+    }
     for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
     {
       if (p->level == 0 && p->state == RUNNABLE)
@@ -541,10 +792,15 @@ void scheduler(void)
     {
       if (p->level == 2 && p->state == RUNNABLE)
       {
+        ran = 1;
         run_third_level_processes();
       }
     }
     release(&ptable.lock);
+    // Nothing to run: free what exited processes left, and
+    // prepare zeroed pages for later kalloc_zeroed().
+    if(!ran && reclaim(RECLAIMBATCH) == 0)
+      kzerofill();
   }
 }
 
@@ -598,6 +854,7 @@ void forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -664,6 +921,68 @@ void wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Fill in *ms with the memory statistics of the system and of
+// process pid, or of the current process if pid is 0.
+// Returns -1 if there is no such process.
+int memstat(int pid, struct memstat *ms)
+{
+  struct memstat m;
+  struct proc *p, *found;
+
+  memset(&m, 0, sizeof(m));
+  vmmemstat(&m);
+  if (pid == 0)
+    pid = myproc()->pid;
+  found = 0;
+  acquire(&ptable.lock);
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  {
+    if (p->kstack)
+      m.kstacks++;
+    if (p->pid == pid && p->state != UNUSED && p->state != EMBRYO)
+      found = p;
+  }
+  if (found && found->pgdir)
+  {
+    m.sz = found->sz;
+    uvmresident(found->pgdir, &m);
+  }
+  release(&ptable.lock);
+  acquire(&reclaimq.lock);
+  m.kstacks += reclaimq.n;  // not yet reclaimed
+  release(&reclaimq.lock);
+  if (found == 0)
+    return -1;
+  // Not under ptable.lock: ms is user memory, which may fault.
+  *ms = m;
+  return 0;
+}
+
+// Return the first process from slot *hand on, wrapping
+// around, whose user pages may be paged out now, and set *hand
+// to its slot; or 0 if there is none. See swap.c.
+struct proc *swapproc(int *hand)
+{
+  struct proc *p, *curproc = myproc();
+  int i;
+
+  acquire(&ptable.lock);
+  for (i = 0; i < NPROC; i++)
+  {
+    p = &ptable.proc[(*hand + i) % NPROC];
+    if (p->pgdir == 0)
+      continue;
+    if (p == curproc ? !p->prefaulted : p->state == RUNNABLE && p->upreempted)
+    {
+      *hand = p - ptable.proc;
+      release(&ptable.lock);
+      return p;
+    }
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -733,10 +1052,51 @@ void change_process_level(int pid, int level)
   {
     if (p->pid == pid)
     {
-      p->level = level;
+      if (p->base_level >= 0)
+      {
+        // Running at an inherited level; keep the better one
+        // until restore_process_level().
+        p->base_level = level;
+        if (level < p->level)
+          p->level = level;
+      }
+      else
+        p->level = level;
     }
   }
 }
+
+// Priority inheritance for sleeplocks: a process holding a
+// sleeplock that a process of a better (lower) level waits for
+// runs at the waiter's level until it has released all its
+// sleeplocks, so the scheduler cannot starve it behind the
+// waiter's level. Returns 1 if p's level was raised.
+int inherit_process_level(struct proc *p, int level)
+{
+  int raised = 0;
+
+  acquire(&ptable.lock);
+  if (level < p->level)
+  {
+    if (p->base_level < 0)
+      p->base_level = p->level;
+    p->level = level;
+    raised = 1;
+  }
+  release(&ptable.lock);
+  return raised;
+}
+
+void restore_process_level(struct proc *p)
+{
+  acquire(&ptable.lock);
+  if (p->base_level >= 0)
+  {
+    p->level = p->base_level;
+    p->base_level = -1;
+  }
+  release(&ptable.lock);
+}
 void set_process_ticket(int pid, int ticket)
 {
   struct proc *p;
@@ -759,6 +1119,24 @@ void set_process_remaining_priority(int pid, int priority)
     }
   }
 }
+void set_process_gang(int pid, int gang)
+{
+  struct proc *p;
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  {
+    if (p->pid == pid)
+    {
+      p->gang = gang;
+    }
+  }
+}
+void set_gang_scheduling(int enabled)
+{
+  acquire(&ptable.lock);
+  gang.enabled = enabled;
+  gang.active = 0;
+  release(&ptable.lock);
+}
 
 void reverse(char* str, int len) 
 { 
@@ -44,6 +44,20 @@ enum procstate
   ZOMBIE
 };
 
+// A region of user memory outside the heap, mapped by mmap().
+// Its pages are filled on first touch by vmafault().
+struct vma
+{
+  uint start;                 // first address, page-aligned
+  uint end;                   // one past the last address; 0 if unused
+  int prot;                   // PROT_READ, PROT_WRITE
+  int flags;                  // MAP_SHARED or MAP_PRIVATE, MAP_ANONYMOUS
+  struct inode *ip;           // backing file, or 0
+  uint off;                   // file offset of start
+  uint filesz;                // bytes backed by the file; the rest reads as 0
+  int text;                   // program segment mapped by exec; see vmaload
+};
+
 // Per-process state
 struct proc
 {
@@ -58,7 +72,13 @@ struct proc
   void *chan;                 // If non-zero, sleeping on chan
   int killed;                 // If non-zero, have been killed
   struct file *ofile[NOFILE]; // Open files
+  struct ksync *oksync[NOKSYNC]; // Open semaphores and events
+  struct vma vma[NVMA];       // Mapped regions
   struct inode *cwd;          // Current directory
+  char path[PATHLEN];         // Command search path, directories separated by ':'
+  uint pathid;                // Identifies path; see findcmd in exec.c
+  int upreempted;             // Preempted in user space; see swap.c
+  int prefaulted;             // System call prefaulted user memory; see swap.c
   char name[16];              // Process name (debugging)
 
   // properties added for scheduling
@@ -68,6 +88,9 @@ struct proc
   int arrTime;
   double cycleNum;
   int remaining_priority;
+  int base_level;             // level to restore after inheriting one, or -1
+  int sleeplocks;             // number of sleeplocks held
+  int gang;                   // gang scheduling group, or 0
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -75,11 +98,16 @@ struct proc
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+// with mapped regions (see struct vma) placed down from KERNBASE.
 
 void change_process_level(int pid, int level);
 void set_process_ticket(int pid, int ticket);
 void set_process_remaining_priority(int pid, int priority);
+void set_process_gang(int pid, int gang);
+void set_gang_scheduling(int enabled);
 void print_processes_info();
+int inherit_process_level(struct proc *p, int level);
+void restore_process_level(struct proc *p);
 
 void barrier_init(int barrier_count);
 void barrier_wait();
@@ -0,0 +1,2179 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 2f 04 00 00       	call   473 <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 58 0f 00 00       	push   $0xf58
+  53:	6a 02                	push   $0x2
+  55:	e8 46 07 00 00       	call   7a0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 4e 00 00 00       	call   b0 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 44 0f 00 00       	push   $0xf44
+  69:	6a 02                	push   $0x2
+  6b:	e8 30 07 00 00       	call   7a0 <printf>
+    exit();
+  70:	e8 3b 00 00 00       	call   b0 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+  80:	a1 00 14 00 00       	mov    0x1400,%eax
+  85:	85 c0                	test   %eax,%eax
+  87:	74 17                	je     a0 <fork+0x20>
+{
+  89:	55                   	push   %ebp
+  8a:	89 e5                	mov    %esp,%ebp
+  8c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+  8f:	ff d0                	call   *%eax
+  return _fork();
+}
+  91:	c9                   	leave
+  return _fork();
+  92:	e9 84 03 00 00       	jmp    41b <_fork>
+  97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9e:	66 90                	xchg   %ax,%ax
+  a0:	e9 76 03 00 00       	jmp    41b <_fork>
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <exit>:
+
+int
+exit(void)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+  b6:	a1 00 14 00 00       	mov    0x1400,%eax
+  bb:	85 c0                	test   %eax,%eax
+  bd:	74 02                	je     c1 <exit+0x11>
+    stdioflush();
+  bf:	ff d0                	call   *%eax
+  _exit();
+  c1:	e8 5d 03 00 00       	call   423 <_exit>
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000d0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+  d0:	55                   	push   %ebp
+  if(stdioflush)
+  d1:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+  d6:	89 e5                	mov    %esp,%ebp
+  d8:	56                   	push   %esi
+  d9:	53                   	push   %ebx
+  da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+  e0:	85 c0                	test   %eax,%eax
+  e2:	74 02                	je     e6 <exec+0x16>
+    stdioflush();
+  e4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+  e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+  e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+  ec:	5b                   	pop    %ebx
+  ed:	5e                   	pop    %esi
+  ee:	5d                   	pop    %ebp
+  return _exec(path, argv);
+  ef:	e9 67 03 00 00       	jmp    45b <_exec>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+ 109:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+ 10e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 111:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 114:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 117:	85 c0                	test   %eax,%eax
+ 119:	74 02                	je     11d <spawn+0x1d>
+    stdioflush();
+ 11b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 11d:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 120:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 126:	83 c4 0c             	add    $0xc,%esp
+ 129:	5b                   	pop    %ebx
+ 12a:	5e                   	pop    %esi
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 12d:	e9 79 04 00 00       	jmp    5ab <_spawn>
+ 132:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 141:	31 c0                	xor    %eax,%eax
+{
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	53                   	push   %ebx
+ 146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 157:	83 c0 01             	add    $0x1,%eax
+ 15a:	84 d2                	test   %dl,%dl
+ 15c:	75 f2                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+ 15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 161:	89 c8                	mov    %ecx,%eax
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+ 165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+ 177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 17a:	0f b6 02             	movzbl (%edx),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 17                	jne    198 <strcmp+0x28>
+ 181:	eb 3a                	jmp    1bd <strcmp+0x4d>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 18c:	83 c2 01             	add    $0x1,%edx
+ 18f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 192:	84 c0                	test   %al,%al
+ 194:	74 1a                	je     1b0 <strcmp+0x40>
+    p++, q++;
+ 196:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 198:	0f b6 19             	movzbl (%ecx),%ebx
+ 19b:	38 c3                	cmp    %al,%bl
+ 19d:	74 e9                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 19f:	29 d8                	sub    %ebx,%eax
+}
+ 1a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a4:	c9                   	leave
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1b4:	31 c0                	xor    %eax,%eax
+ 1b6:	29 d8                	sub    %ebx,%eax
+}
+ 1b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1c0:	31 c0                	xor    %eax,%eax
+ 1c2:	eb db                	jmp    19f <strcmp+0x2f>
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1d9:	74 15                	je     1f0 <strlen+0x20>
+ 1db:	31 c0                	xor    %eax,%eax
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e7:	89 c1                	mov    %eax,%ecx
+ 1e9:	75 f5                	jne    1e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1eb:	89 c8                	mov    %ecx,%eax
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+ 1ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1f0:	31 c9                	xor    %ecx,%ecx
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	89 c8                	mov    %ecx,%eax
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 207:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	89 d7                	mov    %edx,%edi
+ 20f:	fc                   	cld
+ 210:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 212:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 215:	89 d0                	mov    %edx,%eax
+ 217:	c9                   	leave
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 22a:	0f b6 10             	movzbl (%eax),%edx
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	75 12                	jne    243 <strchr+0x23>
+ 231:	eb 1d                	jmp    250 <strchr+0x30>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	84 d2                	test   %dl,%dl
+ 241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+ 243:	38 d1                	cmp    %dl,%cl
+ 245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 250:	31 c0                	xor    %eax,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+ 265:	53                   	push   %ebx
+ 266:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 269:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+ 26e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 271:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 274:	85 c0                	test   %eax,%eax
+ 276:	74 02                	je     27a <gets+0x1a>
+    stdioflush();
+ 278:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 27a:	a1 28 16 00 00       	mov    0x1628,%eax
+ 27f:	85 c0                	test   %eax,%eax
+ 281:	0f 84 99 00 00 00    	je     320 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 287:	31 db                	xor    %ebx,%ebx
+ 289:	eb 21                	jmp    2ac <gets+0x4c>
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 290:	8d 50 01             	lea    0x1(%eax),%edx
+ 293:	0f b6 80 20 14 00 00 	movzbl 0x1420(%eax),%eax
+ 29a:	89 15 20 16 00 00    	mov    %edx,0x1620
+    buf[i++] = c;
+ 2a0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2a4:	3c 0a                	cmp    $0xa,%al
+ 2a6:	74 60                	je     308 <gets+0xa8>
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 5c                	je     308 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 2ac:	89 da                	mov    %ebx,%edx
+ 2ae:	83 c3 01             	add    $0x1,%ebx
+ 2b1:	39 fb                	cmp    %edi,%ebx
+ 2b3:	7d 55                	jge    30a <gets+0xaa>
+    if(in.r == in.n){
+ 2b5:	a1 20 16 00 00       	mov    0x1620,%eax
+ 2ba:	3b 05 24 16 00 00    	cmp    0x1624,%eax
+ 2c0:	75 ce                	jne    290 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2c2:	83 ec 04             	sub    $0x4,%esp
+ 2c5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 2c8:	c7 05 24 16 00 00 00 	movl   $0x0,0x1624
+ 2cf:	00 00 00 
+ 2d2:	c7 05 20 16 00 00 00 	movl   $0x0,0x1620
+ 2d9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 2dc:	ff 35 28 16 00 00    	push   0x1628
+ 2e2:	68 20 14 00 00       	push   $0x1420
+ 2e7:	6a 00                	push   $0x0
+ 2e9:	e8 4d 01 00 00       	call   43b <read>
+ 2ee:	83 c4 10             	add    $0x10,%esp
+ 2f1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 2f4:	85 c0                	test   %eax,%eax
+ 2f6:	a3 24 16 00 00       	mov    %eax,0x1624
+ 2fb:	7e 56                	jle    353 <gets+0xf3>
+    c = in.buf[in.r++];
+ 2fd:	a1 20 16 00 00       	mov    0x1620,%eax
+ 302:	eb 8c                	jmp    290 <gets+0x30>
+ 304:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 308:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 30a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 30e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 311:	89 f0                	mov    %esi,%eax
+ 313:	5b                   	pop    %ebx
+ 314:	5e                   	pop    %esi
+ 315:	5f                   	pop    %edi
+ 316:	5d                   	pop    %ebp
+ 317:	c3                   	ret
+ 318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 320:	83 ec 08             	sub    $0x8,%esp
+ 323:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 326:	50                   	push   %eax
+ 327:	6a 00                	push   $0x0
+ 329:	e8 4d 01 00 00       	call   47b <fstat>
+ 32e:	83 c4 10             	add    $0x10,%esp
+ 331:	89 c2                	mov    %eax,%edx
+ 333:	b8 01 00 00 00       	mov    $0x1,%eax
+ 338:	85 d2                	test   %edx,%edx
+ 33a:	75 0d                	jne    349 <gets+0xe9>
+ 33c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 341:	ba 00 02 00 00       	mov    $0x200,%edx
+ 346:	0f 44 c2             	cmove  %edx,%eax
+ 349:	a3 28 16 00 00       	mov    %eax,0x1628
+ 34e:	e9 34 ff ff ff       	jmp    287 <gets+0x27>
+        in.n = 0;
+ 353:	c7 05 24 16 00 00 00 	movl   $0x0,0x1624
+ 35a:	00 00 00 
+        break;
+ 35d:	eb ab                	jmp    30a <gets+0xaa>
+ 35f:	90                   	nop
+
+00000360 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 365:	83 ec 08             	sub    $0x8,%esp
+ 368:	6a 00                	push   $0x0
+ 36a:	ff 75 08             	push   0x8(%ebp)
+ 36d:	e8 f1 00 00 00       	call   463 <open>
+  if(fd < 0)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	78 27                	js     3a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 379:	83 ec 08             	sub    $0x8,%esp
+ 37c:	ff 75 0c             	push   0xc(%ebp)
+ 37f:	89 c3                	mov    %eax,%ebx
+ 381:	50                   	push   %eax
+ 382:	e8 f4 00 00 00       	call   47b <fstat>
+  close(fd);
+ 387:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 38a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 38c:	e8 ba 00 00 00       	call   44b <close>
+  return r;
+ 391:	83 c4 10             	add    $0x10,%esp
+}
+ 394:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 397:	89 f0                	mov    %esi,%eax
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3a5:	eb ed                	jmp    394 <stat+0x34>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3b7:	0f be 02             	movsbl (%edx),%eax
+ 3ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3c5:	77 1e                	ja     3e5 <atoi+0x35>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3d0:	83 c2 01             	add    $0x1,%edx
+ 3d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3da:	0f be 02             	movsbl (%edx),%eax
+ 3dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3e0:	80 fb 09             	cmp    $0x9,%bl
+ 3e3:	76 eb                	jbe    3d0 <atoi+0x20>
+  return n;
+}
+ 3e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e8:	89 c8                	mov    %ecx,%eax
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3fe:	85 c0                	test   %eax,%eax
+ 400:	7e 13                	jle    415 <memmove+0x25>
+ 402:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 404:	89 d7                	mov    %edx,%edi
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 410:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 411:	39 f8                	cmp    %edi,%eax
+ 413:	75 fb                	jne    410 <memmove+0x20>
+  return vdst;
+}
+ 415:	5e                   	pop    %esi
+ 416:	89 d0                	mov    %edx,%eax
+ 418:	5f                   	pop    %edi
+ 419:	5d                   	pop    %ebp
+ 41a:	c3                   	ret
+
+0000041b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 41b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <_exit>:
+RAWSYSCALL(exit)
+ 423:	b8 02 00 00 00       	mov    $0x2,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <wait>:
+SYSCALL(wait)
+ 42b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <pipe>:
+SYSCALL(pipe)
+ 433:	b8 04 00 00 00       	mov    $0x4,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <read>:
+SYSCALL(read)
+ 43b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <write>:
+SYSCALL(write)
+ 443:	b8 10 00 00 00       	mov    $0x10,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <close>:
+SYSCALL(close)
+ 44b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <kill>:
+SYSCALL(kill)
+ 453:	b8 06 00 00 00       	mov    $0x6,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <_exec>:
+RAWSYSCALL(exec)
+ 45b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <open>:
+SYSCALL(open)
+ 463:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mknod>:
+SYSCALL(mknod)
+ 46b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <unlink>:
+SYSCALL(unlink)
+ 473:	b8 12 00 00 00       	mov    $0x12,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <fstat>:
+SYSCALL(fstat)
+ 47b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <link>:
+SYSCALL(link)
+ 483:	b8 13 00 00 00       	mov    $0x13,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mkdir>:
+SYSCALL(mkdir)
+ 48b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <chdir>:
+SYSCALL(chdir)
+ 493:	b8 09 00 00 00       	mov    $0x9,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <dup>:
+SYSCALL(dup)
+ 49b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getpid>:
+SYSCALL(getpid)
+ 4a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <sbrk>:
+SYSCALL(sbrk)
+ 4ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <sleep>:
+SYSCALL(sleep)
+ 4b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <uptime>:
+SYSCALL(uptime)
+ 4bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 4c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <get_parent_id>:
+SYSCALL(get_parent_id)
+ 4cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <get_children>:
+SYSCALL(get_children)
+ 4d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <set_path>:
+SYSCALL(set_path)
+ 4db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <set_sleep>:
+SYSCALL(set_sleep)
+ 4e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <get_time>:
+SYSCALL(get_time)
+ 4eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <change_process_level>:
+SYSCALL(change_process_level)
+ 4f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 4fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 503:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <print_processes_info>:
+SYSCALL(print_processes_info)
+ 50b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 513:	b8 20 00 00 00       	mov    $0x20,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <barrier_wait>:
+SYSCALL(barrier_wait)
+ 51b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 523:	b8 22 00 00 00       	mov    $0x22,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 52b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 533:	b8 24 00 00 00       	mov    $0x24,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 53b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <sem_create>:
+SYSCALL(sem_create)
+ 543:	b8 26 00 00 00       	mov    $0x26,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <event_create>:
+SYSCALL(event_create)
+ 54b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sync_post>:
+SYSCALL(sync_post)
+ 553:	b8 28 00 00 00       	mov    $0x28,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <sync_wait>:
+SYSCALL(sync_wait)
+ 55b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <sync_close>:
+SYSCALL(sync_close)
+ 563:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <event_reset>:
+SYSCALL(event_reset)
+ 56b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 573:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mmap>:
+SYSCALL(mmap)
+ 57b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <munmap>:
+SYSCALL(munmap)
+ 583:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <shmget>:
+SYSCALL(shmget)
+ 58b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <shmat>:
+SYSCALL(shmat)
+ 593:	b8 30 00 00 00       	mov    $0x30,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <shmdt>:
+SYSCALL(shmdt)
+ 59b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <shmrm>:
+SYSCALL(shmrm)
+ 5a3:	b8 32 00 00 00       	mov    $0x32,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <_spawn>:
+RAWSYSCALL(spawn)
+ 5ab:	b8 33 00 00 00       	mov    $0x33,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <memstat>:
+SYSCALL(memstat)
+ 5b3:	b8 34 00 00 00       	mov    $0x34,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 5c6:	a1 68 18 00 00       	mov    0x1868,%eax
+ 5cb:	85 c0                	test   %eax,%eax
+ 5cd:	7e 17                	jle    5e6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 5cf:	83 ec 04             	sub    $0x4,%esp
+ 5d2:	50                   	push   %eax
+ 5d3:	68 6c 18 00 00       	push   $0x186c
+ 5d8:	ff 35 60 18 00 00    	push   0x1860
+ 5de:	e8 60 fe ff ff       	call   443 <write>
+ 5e3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 5e6:	c7 05 68 18 00 00 00 	movl   $0x0,0x1868
+ 5ed:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 5f0:	c7 05 64 18 00 00 00 	movl   $0x0,0x1864
+ 5f7:	00 00 00 
+}
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 606:	89 d1                	mov    %edx,%ecx
+{
+ 608:	56                   	push   %esi
+ 609:	53                   	push   %ebx
+ 60a:	89 c3                	mov    %eax,%ebx
+ 60c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 60f:	85 d2                	test   %edx,%edx
+ 611:	0f 89 b9 00 00 00    	jns    6d0 <printint+0xd0>
+ 617:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 61b:	0f 84 af 00 00 00    	je     6d0 <printint+0xd0>
+    x = -xx;
+ 621:	f7 d9                	neg    %ecx
+    neg = 1;
+ 623:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 628:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 62b:	31 f6                	xor    %esi,%esi
+ 62d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 630:	89 c8                	mov    %ecx,%eax
+ 632:	31 d2                	xor    %edx,%edx
+ 634:	89 f3                	mov    %esi,%ebx
+ 636:	f7 f7                	div    %edi
+ 638:	8d 76 01             	lea    0x1(%esi),%esi
+ 63b:	0f b6 92 d0 0f 00 00 	movzbl 0xfd0(%edx),%edx
+ 642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 646:	89 ca                	mov    %ecx,%edx
+ 648:	89 c1                	mov    %eax,%ecx
+ 64a:	39 fa                	cmp    %edi,%edx
+ 64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+ 64e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 651:	89 d9                	mov    %ebx,%ecx
+ 653:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 656:	85 c0                	test   %eax,%eax
+ 658:	74 07                	je     661 <printint+0x61>
+    buf[i++] = '-';
+ 65a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 65f:	89 f1                	mov    %esi,%ecx
+ 661:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 664:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 666:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 669:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 66c:	01 f7                	add    %esi,%edi
+ 66e:	eb 09                	jmp    679 <printint+0x79>
+
+  while(--i >= 0)
+ 670:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 673:	39 f7                	cmp    %esi,%edi
+ 675:	74 36                	je     6ad <printint+0xad>
+ 677:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 679:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 67c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 67f:	8d 42 01             	lea    0x1(%edx),%eax
+ 682:	89 43 08             	mov    %eax,0x8(%ebx)
+ 685:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 689:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 68e:	74 28                	je     6b8 <printint+0xb8>
+ 690:	80 f9 0a             	cmp    $0xa,%cl
+ 693:	75 db                	jne    670 <printint+0x70>
+ 695:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 699:	75 d5                	jne    670 <printint+0x70>
+  if(b->n > 0)
+ 69b:	85 c0                	test   %eax,%eax
+ 69d:	7f 19                	jg     6b8 <printint+0xb8>
+  b->n = 0;
+ 69f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 6a6:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 6a9:	39 f7                	cmp    %esi,%edi
+ 6ab:	75 ca                	jne    677 <printint+0x77>
+}
+ 6ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b0:	5b                   	pop    %ebx
+ 6b1:	5e                   	pop    %esi
+ 6b2:	5f                   	pop    %edi
+ 6b3:	5d                   	pop    %ebp
+ 6b4:	c3                   	ret
+ 6b5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 6b8:	83 ec 04             	sub    $0x4,%esp
+ 6bb:	50                   	push   %eax
+ 6bc:	ff 75 d4             	push   -0x2c(%ebp)
+ 6bf:	ff 33                	push   (%ebx)
+ 6c1:	e8 7d fd ff ff       	call   443 <write>
+ 6c6:	83 c4 10             	add    $0x10,%esp
+ 6c9:	eb d4                	jmp    69f <printint+0x9f>
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+  neg = 0;
+ 6d0:	31 c0                	xor    %eax,%eax
+ 6d2:	e9 51 ff ff ff       	jmp    628 <printint+0x28>
+ 6d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <putc>:
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	53                   	push   %ebx
+ 6e4:	89 c3                	mov    %eax,%ebx
+ 6e6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 6e9:	8b 48 08             	mov    0x8(%eax),%ecx
+ 6ec:	8d 41 01             	lea    0x1(%ecx),%eax
+ 6ef:	89 43 08             	mov    %eax,0x8(%ebx)
+ 6f2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6f6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6fb:	74 33                	je     730 <putc+0x50>
+ 6fd:	80 fa 0a             	cmp    $0xa,%dl
+ 700:	74 0e                	je     710 <putc+0x30>
+}
+ 702:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 705:	c9                   	leave
+ 706:	c3                   	ret
+ 707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 710:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 714:	75 ec                	jne    702 <putc+0x22>
+  if(b->n > 0)
+ 716:	85 c0                	test   %eax,%eax
+ 718:	7f 16                	jg     730 <putc+0x50>
+  b->n = 0;
+ 71a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 721:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 724:	c9                   	leave
+ 725:	c3                   	ret
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	50                   	push   %eax
+ 734:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 737:	50                   	push   %eax
+ 738:	ff 33                	push   (%ebx)
+ 73a:	e8 04 fd ff ff       	call   443 <write>
+ 73f:	83 c4 10             	add    $0x10,%esp
+ 742:	eb d6                	jmp    71a <putc+0x3a>
+ 744:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+
+00000750 <fflush>:
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 756:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 75a:	74 04                	je     760 <fflush+0x10>
+}
+ 75c:	c9                   	leave
+ 75d:	c3                   	ret
+ 75e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 760:	a1 68 18 00 00       	mov    0x1868,%eax
+ 765:	85 c0                	test   %eax,%eax
+ 767:	7f 17                	jg     780 <fflush+0x30>
+  b->n = 0;
+ 769:	c7 05 68 18 00 00 00 	movl   $0x0,0x1868
+ 770:	00 00 00 
+  out.mode = 0;
+ 773:	c7 05 64 18 00 00 00 	movl   $0x0,0x1864
+ 77a:	00 00 00 
+}
+ 77d:	c9                   	leave
+ 77e:	c3                   	ret
+ 77f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	50                   	push   %eax
+ 784:	68 6c 18 00 00       	push   $0x186c
+ 789:	ff 35 60 18 00 00    	push   0x1860
+ 78f:	e8 af fc ff ff       	call   443 <write>
+ 794:	83 c4 10             	add    $0x10,%esp
+ 797:	eb d0                	jmp    769 <fflush+0x19>
+ 799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 3c             	sub    $0x3c,%esp
+ 7a9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 7af:	83 fe 01             	cmp    $0x1,%esi
+ 7b2:	0f 84 60 01 00 00    	je     918 <printf+0x178>
+    b->fd = fd;
+ 7b8:	89 35 40 16 00 00    	mov    %esi,0x1640
+  for(i = 0; fmt[i]; i++){
+ 7be:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 7c1:	bf 40 16 00 00       	mov    $0x1640,%edi
+  for(i = 0; fmt[i]; i++){
+ 7c6:	84 c0                	test   %al,%al
+ 7c8:	74 65                	je     82f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 7ca:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 7d0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 7d2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 7d5:	eb 1f                	jmp    7f6 <printf+0x56>
+ 7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7de:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 3b                	je     820 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 7e5:	89 f8                	mov    %edi,%eax
+ 7e7:	e8 f4 fe ff ff       	call   6e0 <putc>
+  for(i = 0; fmt[i]; i++){
+ 7ec:	0f b6 03             	movzbl (%ebx),%eax
+ 7ef:	83 c3 01             	add    $0x1,%ebx
+ 7f2:	84 c0                	test   %al,%al
+ 7f4:	74 39                	je     82f <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 7f6:	0f be d0             	movsbl %al,%edx
+ 7f9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 7fc:	85 f6                	test   %esi,%esi
+ 7fe:	74 e0                	je     7e0 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 800:	83 fe 25             	cmp    $0x25,%esi
+ 803:	75 e7                	jne    7ec <printf+0x4c>
+      if(c == 'd'){
+ 805:	83 f8 25             	cmp    $0x25,%eax
+ 808:	74 57                	je     861 <printf+0xc1>
+ 80a:	83 e8 63             	sub    $0x63,%eax
+ 80d:	83 f8 15             	cmp    $0x15,%eax
+ 810:	77 36                	ja     848 <printf+0xa8>
+ 812:	ff 24 85 78 0f 00 00 	jmp    *0xf78(,%eax,4)
+ 819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 820:	0f b6 03             	movzbl (%ebx),%eax
+ 823:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 826:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 82b:	84 c0                	test   %al,%al
+ 82d:	75 c7                	jne    7f6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 82f:	8b 47 04             	mov    0x4(%edi),%eax
+ 832:	85 c0                	test   %eax,%eax
+ 834:	0f 84 06 01 00 00    	je     940 <printf+0x1a0>
+    bflush(b);
+}
+ 83a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83d:	5b                   	pop    %ebx
+ 83e:	5e                   	pop    %esi
+ 83f:	5f                   	pop    %edi
+ 840:	5d                   	pop    %ebp
+ 841:	c3                   	ret
+ 842:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 848:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 84b:	8d 41 01             	lea    0x1(%ecx),%eax
+ 84e:	89 47 08             	mov    %eax,0x8(%edi)
+ 851:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 856:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 85b:	0f 84 77 01 00 00    	je     9d8 <printf+0x238>
+        putc(b, c);
+ 861:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 863:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 865:	e8 76 fe ff ff       	call   6e0 <putc>
+ 86a:	eb 80                	jmp    7ec <printf+0x4c>
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 870:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 16                	mov    (%esi),%edx
+ 87d:	6a 00                	push   $0x0
+        ap++;
+ 87f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 882:	89 f8                	mov    %edi,%eax
+ 884:	e8 77 fd ff ff       	call   600 <printint>
+        ap++;
+ 889:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 f6                	xor    %esi,%esi
+ 891:	e9 56 ff ff ff       	jmp    7ec <printf+0x4c>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 8a3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 8ab:	85 c9                	test   %ecx,%ecx
+ 8ad:	0f 84 cd 00 00 00    	je     980 <printf+0x1e0>
+        while(*s != 0){
+ 8b3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 8b6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 8b8:	84 d2                	test   %dl,%dl
+ 8ba:	0f 84 2c ff ff ff    	je     7ec <printf+0x4c>
+          putc(b, *s);
+ 8c0:	89 f8                	mov    %edi,%eax
+ 8c2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 8c5:	e8 16 fe ff ff       	call   6e0 <putc>
+          s++;
+ 8ca:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 8cd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 8d1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 8d4:	84 d2                	test   %dl,%dl
+ 8d6:	75 e8                	jne    8c0 <printf+0x120>
+      state = 0;
+ 8d8:	31 f6                	xor    %esi,%esi
+ 8da:	e9 0d ff ff ff       	jmp    7ec <printf+0x4c>
+ 8df:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 8e0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8eb:	8b 16                	mov    (%esi),%edx
+ 8ed:	6a 01                	push   $0x1
+ 8ef:	eb 8e                	jmp    87f <printf+0xdf>
+ 8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 8f8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8fb:	89 f8                	mov    %edi,%eax
+ 8fd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 900:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 903:	e8 d8 fd ff ff       	call   6e0 <putc>
+        ap++;
+ 908:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 90b:	31 f6                	xor    %esi,%esi
+ 90d:	e9 da fe ff ff       	jmp    7ec <printf+0x4c>
+ 912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 918:	8b 15 64 18 00 00    	mov    0x1864,%edx
+ 91e:	85 d2                	test   %edx,%edx
+ 920:	74 6e                	je     990 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 922:	0f b6 03             	movzbl (%ebx),%eax
+ 925:	bf 60 18 00 00       	mov    $0x1860,%edi
+ 92a:	84 c0                	test   %al,%al
+ 92c:	0f 85 98 fe ff ff    	jne    7ca <printf+0x2a>
+ 932:	e9 03 ff ff ff       	jmp    83a <printf+0x9a>
+ 937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 940:	8b 47 08             	mov    0x8(%edi),%eax
+ 943:	85 c0                	test   %eax,%eax
+ 945:	7f 19                	jg     960 <printf+0x1c0>
+  b->n = 0;
+ 947:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 94e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 951:	5b                   	pop    %ebx
+ 952:	5e                   	pop    %esi
+ 953:	5f                   	pop    %edi
+ 954:	5d                   	pop    %ebp
+ 955:	c3                   	ret
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	50                   	push   %eax
+ 964:	8d 47 0c             	lea    0xc(%edi),%eax
+ 967:	50                   	push   %eax
+ 968:	ff 37                	push   (%edi)
+ 96a:	e8 d4 fa ff ff       	call   443 <write>
+  b->n = 0;
+ 96f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ 976:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 979:	eb d3                	jmp    94e <printf+0x1ae>
+ 97b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+ 980:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 985:	b9 71 0f 00 00       	mov    $0xf71,%ecx
+ 98a:	e9 31 ff ff ff       	jmp    8c0 <printf+0x120>
+ 98f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 990:	83 ec 08             	sub    $0x8,%esp
+ 993:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ 996:	c7 05 60 18 00 00 01 	movl   $0x1,0x1860
+ 99d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 9a0:	50                   	push   %eax
+ 9a1:	6a 01                	push   $0x1
+ 9a3:	e8 d3 fa ff ff       	call   47b <fstat>
+ 9a8:	83 c4 10             	add    $0x10,%esp
+ 9ab:	85 c0                	test   %eax,%eax
+ 9ad:	75 22                	jne    9d1 <printf+0x231>
+ 9af:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 9b4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9b9:	0f 45 f0             	cmovne %eax,%esi
+ 9bc:	89 35 64 18 00 00    	mov    %esi,0x1864
+      stdioflush = flushout;
+ 9c2:	c7 05 00 14 00 00 c0 	movl   $0x5c0,0x1400
+ 9c9:	05 00 00 
+ 9cc:	e9 51 ff ff ff       	jmp    922 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 9d1:	be 02 00 00 00       	mov    $0x2,%esi
+ 9d6:	eb e4                	jmp    9bc <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ 9d8:	83 ec 04             	sub    $0x4,%esp
+ 9db:	8d 47 0c             	lea    0xc(%edi),%eax
+ 9de:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 9e1:	68 00 02 00 00       	push   $0x200
+ 9e6:	50                   	push   %eax
+ 9e7:	ff 37                	push   (%edi)
+ 9e9:	e8 55 fa ff ff       	call   443 <write>
+  b->n = 0;
+ 9ee:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9f5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 9f8:	83 c4 10             	add    $0x10,%esp
+ 9fb:	e9 61 fe ff ff       	jmp    861 <printf+0xc1>
+
+00000a00 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	56                   	push   %esi
+ a04:	53                   	push   %ebx
+ a05:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ a07:	a1 80 1a 00 00       	mov    0x1a80,%eax
+ a0c:	39 d8                	cmp    %ebx,%eax
+ a0e:	0f 83 e4 00 00 00    	jae    af8 <freepages+0xf8>
+ a14:	85 c0                	test   %eax,%eax
+ a16:	0f 84 dc 00 00 00    	je     af8 <freepages+0xf8>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a20:	89 c2                	mov    %eax,%edx
+ a22:	8b 00                	mov    (%eax),%eax
+ a24:	85 c0                	test   %eax,%eax
+ a26:	74 04                	je     a2c <freepages+0x2c>
+ a28:	39 d8                	cmp    %ebx,%eax
+ a2a:	72 f4                	jb     a20 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ a2c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ a2f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ a31:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ a33:	85 c0                	test   %eax,%eax
+ a35:	74 15                	je     a4c <freepages+0x4c>
+    p->prev = s;
+ a37:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ a3a:	8b 73 10             	mov    0x10(%ebx),%esi
+ a3d:	89 f1                	mov    %esi,%ecx
+ a3f:	c1 e1 0c             	shl    $0xc,%ecx
+ a42:	01 d9                	add    %ebx,%ecx
+ a44:	39 c8                	cmp    %ecx,%eax
+ a46:	0f 84 d8 00 00 00    	je     b24 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ a4c:	8b 4a 10             	mov    0x10(%edx),%ecx
+ a4f:	89 c8                	mov    %ecx,%eax
+ a51:	c1 e0 0c             	shl    $0xc,%eax
+ a54:	01 d0                	add    %edx,%eax
+ a56:	39 c3                	cmp    %eax,%ebx
+ a58:	74 16                	je     a70 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a5a:	8b 03                	mov    (%ebx),%eax
+ a5c:	85 c0                	test   %eax,%eax
+ a5e:	74 40                	je     aa0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ a60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a63:	5b                   	pop    %ebx
+ a64:	5e                   	pop    %esi
+ a65:	5d                   	pop    %ebp
+ a66:	c3                   	ret
+ a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ a70:	03 4b 10             	add    0x10(%ebx),%ecx
+ a73:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ a76:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ a79:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ a7b:	85 c9                	test   %ecx,%ecx
+ a7d:	0f 84 dd 00 00 00    	je     b60 <freepages+0x160>
+    s->prev->next = s->next;
+ a83:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ a85:	85 c0                	test   %eax,%eax
+ a87:	74 06                	je     a8f <freepages+0x8f>
+    s->next->prev = s->prev;
+ a89:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ a8c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a8f:	8b 02                	mov    (%edx),%eax
+ a91:	89 d3                	mov    %edx,%ebx
+ a93:	85 c0                	test   %eax,%eax
+ a95:	75 c9                	jne    a60 <freepages+0x60>
+ a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9e:	66 90                	xchg   %ax,%ax
+ aa0:	8b 43 10             	mov    0x10(%ebx),%eax
+ aa3:	83 f8 0f             	cmp    $0xf,%eax
+ aa6:	76 b8                	jbe    a60 <freepages+0x60>
+ aa8:	83 ec 0c             	sub    $0xc,%esp
+ aab:	c1 e0 0c             	shl    $0xc,%eax
+ aae:	6a 00                	push   $0x0
+ ab0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ ab3:	e8 f3 f9 ff ff       	call   4ab <sbrk>
+ ab8:	83 c4 10             	add    $0x10,%esp
+ abb:	39 c6                	cmp    %eax,%esi
+ abd:	75 a1                	jne    a60 <freepages+0x60>
+  if(s->prev)
+ abf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ ac2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ ac4:	85 d2                	test   %edx,%edx
+ ac6:	0f 84 a5 00 00 00    	je     b71 <freepages+0x171>
+    s->prev->next = s->next;
+ acc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ ace:	85 c0                	test   %eax,%eax
+ ad0:	74 06                	je     ad8 <freepages+0xd8>
+    s->next->prev = s->prev;
+ ad2:	8b 53 04             	mov    0x4(%ebx),%edx
+ ad5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ ad8:	8b 43 10             	mov    0x10(%ebx),%eax
+ adb:	83 ec 0c             	sub    $0xc,%esp
+ ade:	c1 e0 0c             	shl    $0xc,%eax
+ ae1:	f7 d8                	neg    %eax
+ ae3:	50                   	push   %eax
+ ae4:	e8 c2 f9 ff ff       	call   4ab <sbrk>
+ ae9:	83 c4 10             	add    $0x10,%esp
+}
+ aec:	e9 6f ff ff ff       	jmp    a60 <freepages+0x60>
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ af8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ aff:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ b01:	89 1d 80 1a 00 00    	mov    %ebx,0x1a80
+  if(p)
+ b07:	85 c0                	test   %eax,%eax
+ b09:	74 95                	je     aa0 <freepages+0xa0>
+    p->prev = s;
+ b0b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ b0e:	8b 73 10             	mov    0x10(%ebx),%esi
+ b11:	89 f2                	mov    %esi,%edx
+ b13:	c1 e2 0c             	shl    $0xc,%edx
+ b16:	01 da                	add    %ebx,%edx
+ b18:	39 d0                	cmp    %edx,%eax
+ b1a:	0f 85 3a ff ff ff    	jne    a5a <freepages+0x5a>
+ b20:	89 c1                	mov    %eax,%ecx
+ b22:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ b24:	8b 41 10             	mov    0x10(%ecx),%eax
+ b27:	01 f0                	add    %esi,%eax
+ b29:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ b2c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ b2f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ b31:	85 f6                	test   %esi,%esi
+ b33:	74 35                	je     b6a <freepages+0x16a>
+    s->prev->next = s->next;
+ b35:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ b37:	85 c0                	test   %eax,%eax
+ b39:	74 06                	je     b41 <freepages+0x141>
+    s->next->prev = s->prev;
+ b3b:	8b 49 04             	mov    0x4(%ecx),%ecx
+ b3e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ b41:	85 d2                	test   %edx,%edx
+ b43:	0f 84 11 ff ff ff    	je     a5a <freepages+0x5a>
+ b49:	8b 4a 10             	mov    0x10(%edx),%ecx
+ b4c:	89 c8                	mov    %ecx,%eax
+ b4e:	c1 e0 0c             	shl    $0xc,%eax
+ b51:	01 d0                	add    %edx,%eax
+ b53:	39 c3                	cmp    %eax,%ebx
+ b55:	0f 85 ff fe ff ff    	jne    a5a <freepages+0x5a>
+ b5b:	e9 10 ff ff ff       	jmp    a70 <freepages+0x70>
+    *l = s->next;
+ b60:	a3 80 1a 00 00       	mov    %eax,0x1a80
+ b65:	e9 1b ff ff ff       	jmp    a85 <freepages+0x85>
+ b6a:	a3 80 1a 00 00       	mov    %eax,0x1a80
+ b6f:	eb c6                	jmp    b37 <freepages+0x137>
+ b71:	a3 80 1a 00 00       	mov    %eax,0x1a80
+ b76:	e9 53 ff ff ff       	jmp    ace <freepages+0xce>
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+
+00000b80 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	56                   	push   %esi
+ b84:	53                   	push   %ebx
+ b85:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ b87:	a1 80 1a 00 00       	mov    0x1a80,%eax
+ b8c:	85 c0                	test   %eax,%eax
+ b8e:	74 5e                	je     bee <getpages+0x6e>
+    if(s->npages < n)
+ b90:	8b 50 10             	mov    0x10(%eax),%edx
+ b93:	39 da                	cmp    %ebx,%edx
+ b95:	72 51                	jb     be8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ b97:	39 d3                	cmp    %edx,%ebx
+ b99:	72 25                	jb     bc0 <getpages+0x40>
+  if(s->prev)
+ b9b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ b9e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ ba0:	85 c9                	test   %ecx,%ecx
+ ba2:	0f 84 a8 00 00 00    	je     c50 <getpages+0xd0>
+    s->prev->next = s->next;
+ ba8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ baa:	85 d2                	test   %edx,%edx
+ bac:	74 06                	je     bb4 <getpages+0x34>
+    s->next->prev = s->prev;
+ bae:	8b 48 04             	mov    0x4(%eax),%ecx
+ bb1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ bb4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ bb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bba:	5b                   	pop    %ebx
+ bbb:	5e                   	pop    %esi
+ bbc:	5d                   	pop    %ebp
+ bbd:	c3                   	ret
+ bbe:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ bc0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ bc2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ bc4:	c1 e1 0c             	shl    $0xc,%ecx
+ bc7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ bc9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ bcc:	8b 70 04             	mov    0x4(%eax),%esi
+ bcf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ bd2:	8b 10                	mov    (%eax),%edx
+ bd4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ bd6:	85 f6                	test   %esi,%esi
+ bd8:	74 66                	je     c40 <getpages+0xc0>
+        rest->prev->next = rest;
+ bda:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ bdc:	8b 11                	mov    (%ecx),%edx
+ bde:	85 d2                	test   %edx,%edx
+ be0:	75 cf                	jne    bb1 <getpages+0x31>
+ be2:	eb d0                	jmp    bb4 <getpages+0x34>
+ be4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ be8:	8b 00                	mov    (%eax),%eax
+ bea:	85 c0                	test   %eax,%eax
+ bec:	75 a2                	jne    b90 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ bee:	83 ec 0c             	sub    $0xc,%esp
+ bf1:	6a 00                	push   $0x0
+ bf3:	e8 b3 f8 ff ff       	call   4ab <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bf8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ bfb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ c01:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c03:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ c09:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c0f:	29 d0                	sub    %edx,%eax
+ c11:	c1 e8 0c             	shr    $0xc,%eax
+ c14:	39 d8                	cmp    %ebx,%eax
+ c16:	72 48                	jb     c60 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ c18:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c1a:	89 d8                	mov    %ebx,%eax
+ c1c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c1f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ c21:	c1 e0 0c             	shl    $0xc,%eax
+ c24:	01 f0                	add    %esi,%eax
+ c26:	50                   	push   %eax
+ c27:	e8 7f f8 ff ff       	call   4ab <sbrk>
+ c2c:	83 c4 10             	add    $0x10,%esp
+ c2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c32:	74 2c                	je     c60 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ c34:	01 f0                	add    %esi,%eax
+ c36:	e9 79 ff ff ff       	jmp    bb4 <getpages+0x34>
+ c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+        runs = rest;
+ c40:	89 0d 80 1a 00 00    	mov    %ecx,0x1a80
+ c46:	eb 96                	jmp    bde <getpages+0x5e>
+ c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+    *l = s->next;
+ c50:	89 15 80 1a 00 00    	mov    %edx,0x1a80
+ c56:	e9 4f ff ff ff       	jmp    baa <getpages+0x2a>
+ c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+    return 0;
+ c60:	31 c0                	xor    %eax,%eax
+ c62:	e9 50 ff ff ff       	jmp    bb7 <getpages+0x37>
+ c67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6e:	66 90                	xchg   %ax,%ax
+
+00000c70 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	57                   	push   %edi
+ c74:	56                   	push   %esi
+ c75:	53                   	push   %ebx
+ c76:	83 ec 1c             	sub    $0x1c,%esp
+ c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ c7c:	85 c0                	test   %eax,%eax
+ c7e:	0f 84 97 00 00 00    	je     d1b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ c84:	89 c3                	mov    %eax,%ebx
+ c86:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ c8c:	8b 73 14             	mov    0x14(%ebx),%esi
+ c8f:	83 fe 01             	cmp    $0x1,%esi
+ c92:	74 74                	je     d08 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ c94:	85 f6                	test   %esi,%esi
+ c96:	74 5d                	je     cf5 <free+0x85>
+  if(s->free == 0)
+ c98:	8b 53 08             	mov    0x8(%ebx),%edx
+ c9b:	85 d2                	test   %edx,%edx
+ c9d:	0f 84 85 00 00 00    	je     d28 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ ca3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ ca5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ ca8:	8b 43 0c             	mov    0xc(%ebx),%eax
+ cab:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ cae:	8b 04 f5 a4 1a 00 00 	mov    0x1aa4(,%esi,8),%eax
+  s->inuse--;
+ cb5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ cb8:	83 c0 01             	add    $0x1,%eax
+ cbb:	89 04 f5 a4 1a 00 00 	mov    %eax,0x1aa4(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ cc2:	85 d2                	test   %edx,%edx
+ cc4:	75 55                	jne    d1b <free+0xab>
+ cc6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ ccb:	89 f1                	mov    %esi,%ecx
+ ccd:	d3 ea                	shr    %cl,%edx
+ ccf:	39 c2                	cmp    %eax,%edx
+ cd1:	73 7d                	jae    d50 <free+0xe0>
+  if(s->prev)
+ cd3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ cd6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ cd8:	85 ff                	test   %edi,%edi
+ cda:	0f 84 a0 00 00 00    	je     d80 <free+0x110>
+    s->prev->next = s->next;
+ ce0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ ce2:	85 c9                	test   %ecx,%ecx
+ ce4:	74 06                	je     cec <free+0x7c>
+    s->next->prev = s->prev;
+ ce6:	8b 7b 04             	mov    0x4(%ebx),%edi
+ ce9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ cec:	29 d0                	sub    %edx,%eax
+ cee:	89 04 f5 a4 1a 00 00 	mov    %eax,0x1aa4(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ cf8:	89 d8                	mov    %ebx,%eax
+}
+ cfa:	5b                   	pop    %ebx
+ cfb:	5e                   	pop    %esi
+ cfc:	5f                   	pop    %edi
+ cfd:	5d                   	pop    %ebp
+    freepages(s);
+ cfe:	e9 fd fc ff ff       	jmp    a00 <freepages>
+ d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d07:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ d08:	8b 43 10             	mov    0x10(%ebx),%eax
+ d0b:	83 ec 08             	sub    $0x8,%esp
+ d0e:	c1 e0 0c             	shl    $0xc,%eax
+ d11:	50                   	push   %eax
+ d12:	53                   	push   %ebx
+ d13:	e8 6b f8 ff ff       	call   583 <munmap>
+ d18:	83 c4 10             	add    $0x10,%esp
+}
+ d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d1e:	5b                   	pop    %ebx
+ d1f:	5e                   	pop    %esi
+ d20:	5f                   	pop    %edi
+ d21:	5d                   	pop    %ebp
+ d22:	c3                   	ret
+ d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d27:	90                   	nop
+  s->next = *l;
+ d28:	8b 14 f5 a0 1a 00 00 	mov    0x1aa0(,%esi,8),%edx
+  s->prev = 0;
+ d2f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ d36:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ d38:	85 d2                	test   %edx,%edx
+ d3a:	74 06                	je     d42 <free+0xd2>
+    (*l)->prev = s;
+ d3c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ d3f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ d42:	89 1c f5 a0 1a 00 00 	mov    %ebx,0x1aa0(,%esi,8)
+}
+ d49:	e9 55 ff ff ff       	jmp    ca3 <free+0x33>
+ d4e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ d50:	83 ec 0c             	sub    $0xc,%esp
+ d53:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ d56:	8b 7b 10             	mov    0x10(%ebx),%edi
+ d59:	6a 00                	push   $0x0
+ d5b:	c1 e7 0c             	shl    $0xc,%edi
+ d5e:	01 df                	add    %ebx,%edi
+ d60:	e8 46 f7 ff ff       	call   4ab <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d65:	83 c4 10             	add    $0x10,%esp
+ d68:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ d6b:	39 c7                	cmp    %eax,%edi
+ d6d:	75 ac                	jne    d1b <free+0xab>
+ d6f:	8b 04 f5 a4 1a 00 00 	mov    0x1aa4(,%esi,8),%eax
+ d76:	e9 58 ff ff ff       	jmp    cd3 <free+0x63>
+ d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d7f:	90                   	nop
+    *l = s->next;
+ d80:	89 0c f5 a0 1a 00 00 	mov    %ecx,0x1aa0(,%esi,8)
+ d87:	e9 56 ff ff ff       	jmp    ce2 <free+0x72>
+ d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d90 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d90:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ d91:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ d96:	89 e5                	mov    %esp,%ebp
+ d98:	57                   	push   %edi
+ d99:	56                   	push   %esi
+ d9a:	53                   	push   %ebx
+ d9b:	83 ec 1c             	sub    $0x1c,%esp
+ d9e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ da1:	83 f8 10             	cmp    $0x10,%eax
+ da4:	0f 86 92 00 00 00    	jbe    e3c <malloc+0xac>
+ daa:	ba 01 00 00 00       	mov    $0x1,%edx
+ daf:	eb 13                	jmp    dc4 <malloc+0x34>
+ db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ db8:	89 d3                	mov    %edx,%ebx
+ dba:	d3 e3                	shl    %cl,%ebx
+ dbc:	39 c3                	cmp    %eax,%ebx
+ dbe:	0f 83 84 00 00 00    	jae    e48 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ dc4:	83 c1 01             	add    $0x1,%ecx
+ dc7:	83 f9 0b             	cmp    $0xb,%ecx
+ dca:	75 ec                	jne    db8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ dcc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ dd1:	0f 87 c9 00 00 00    	ja     ea0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ dd7:	05 17 10 00 00       	add    $0x1017,%eax
+ ddc:	89 c3                	mov    %eax,%ebx
+ dde:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ de1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ de6:	77 28                	ja     e10 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ de8:	89 d8                	mov    %ebx,%eax
+ dea:	e8 91 fd ff ff       	call   b80 <getpages>
+ def:	85 c0                	test   %eax,%eax
+ df1:	0f 84 a9 00 00 00    	je     ea0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ df7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ dfe:	83 c0 18             	add    $0x18,%eax
+}
+ e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e04:	5b                   	pop    %ebx
+ e05:	5e                   	pop    %esi
+ e06:	5f                   	pop    %edi
+ e07:	5d                   	pop    %ebp
+ e08:	c3                   	ret
+ e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ e10:	89 d8                	mov    %ebx,%eax
+ e12:	83 ec 08             	sub    $0x8,%esp
+ e15:	c1 e0 0c             	shl    $0xc,%eax
+ e18:	6a 00                	push   $0x0
+ e1a:	6a ff                	push   $0xffffffff
+ e1c:	6a 22                	push   $0x22
+ e1e:	6a 03                	push   $0x3
+ e20:	50                   	push   %eax
+ e21:	6a 00                	push   $0x0
+ e23:	e8 53 f7 ff ff       	call   57b <mmap>
+    if(s == MAP_FAILED)
+ e28:	83 c4 20             	add    $0x20,%esp
+ e2b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e2e:	74 b8                	je     de8 <malloc+0x58>
+      s->shift = MAPRUN;
+ e30:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ e37:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ e3a:	eb c2                	jmp    dfe <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ e3c:	bb 10 00 00 00       	mov    $0x10,%ebx
+ e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ e48:	8b 34 cd a0 1a 00 00 	mov    0x1aa0(,%ecx,8),%esi
+ e4f:	85 f6                	test   %esi,%esi
+ e51:	74 57                	je     eaa <malloc+0x11a>
+  classes[shift].nfree--;
+ e53:	8b 1c cd a4 1a 00 00 	mov    0x1aa4(,%ecx,8),%ebx
+  o = s->free;
+ e5a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ e5d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ e60:	89 14 cd a4 1a 00 00 	mov    %edx,0x1aa4(,%ecx,8)
+  s->free = NEXTFREE(o);
+ e67:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ e69:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ e6d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ e70:	85 ff                	test   %edi,%edi
+ e72:	75 8d                	jne    e01 <malloc+0x71>
+  if(s->prev)
+ e74:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ e77:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ e79:	85 db                	test   %ebx,%ebx
+ e7b:	0f 84 b7 00 00 00    	je     f38 <malloc+0x1a8>
+    s->prev->next = s->next;
+ e81:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ e83:	85 d2                	test   %edx,%edx
+ e85:	0f 84 76 ff ff ff    	je     e01 <malloc+0x71>
+    s->next->prev = s->prev;
+ e8b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ e8e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ e91:	e9 6b ff ff ff       	jmp    e01 <malloc+0x71>
+ e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ ea3:	31 c0                	xor    %eax,%eax
+}
+ ea5:	5b                   	pop    %ebx
+ ea6:	5e                   	pop    %esi
+ ea7:	5f                   	pop    %edi
+ ea8:	5d                   	pop    %ebp
+ ea9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ eaa:	b8 01 00 00 00       	mov    $0x1,%eax
+ eaf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ eb2:	e8 c9 fc ff ff       	call   b80 <getpages>
+ eb7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ eba:	85 c0                	test   %eax,%eax
+ ebc:	89 c2                	mov    %eax,%edx
+ ebe:	74 e0                	je     ea0 <malloc+0x110>
+    s->shift = shift;
+ ec0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ec3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ ec5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ ecc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ed1:	89 df                	mov    %ebx,%edi
+ ed3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ ed5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ ed7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ eda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ edd:	83 e8 01             	sub    $0x1,%eax
+ ee0:	d3 e0                	shl    %cl,%eax
+ ee2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ ee5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ee9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ eec:	eb 04                	jmp    ef2 <malloc+0x162>
+ eee:	66 90                	xchg   %ax,%ax
+ ef0:	89 c8                	mov    %ecx,%eax
+ ef2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ ef5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ef7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ efa:	89 c6                	mov    %eax,%esi
+ efc:	39 da                	cmp    %ebx,%edx
+ efe:	7f f0                	jg     ef0 <malloc+0x160>
+ f00:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ f03:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ f06:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ f09:	8b 04 cd a0 1a 00 00 	mov    0x1aa0(,%ecx,8),%eax
+  s->prev = 0;
+ f10:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ f17:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ f19:	85 c0                	test   %eax,%eax
+ f1b:	74 03                	je     f20 <malloc+0x190>
+    (*l)->prev = s;
+ f1d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ f20:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ f23:	89 14 cd a0 1a 00 00 	mov    %edx,0x1aa0(,%ecx,8)
+    classes[shift].nfree += n;
+ f2a:	89 d6                	mov    %edx,%esi
+ f2c:	03 1c cd a4 1a 00 00 	add    0x1aa4(,%ecx,8),%ebx
+ f33:	e9 22 ff ff ff       	jmp    e5a <malloc+0xca>
+    *l = s->next;
+ f38:	89 14 cd a0 1a 00 00 	mov    %edx,0x1aa0(,%ecx,8)
+ f3f:	e9 3f ff ff ff       	jmp    e83 <malloc+0xf3>
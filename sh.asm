@@ -0,0 +1,4292 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    return -1;
+  return 0;
+}
+
+int main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  int fd;
+  struct cmd *cmd;
+
+  // Ensure that three file descriptors are open.
+  while ((fd = open("console", O_RDWR)) >= 0)
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  {
+    if (fd >= 3)
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 74 01 00 00    	jg     195 <main+0x195>
+  while ((fd = open("console", O_RDWR)) >= 0)
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 72 20 00 00       	push   $0x2072
+      2b:	e8 a3 14 00 00       	call   14d3 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 b4 1f 00 00       	push   $0x1fb4
+      48:	6a 02                	push   $0x2
+      4a:	e8 c1 17 00 00       	call   1810 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 e0 29 00 00       	push   $0x29e0
+      5b:	e8 10 12 00 00       	call   1270 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 e0 29 00 00       	push   $0x29e0
+      69:	e8 62 12 00 00       	call   12d0 <gets>
+  if (buf[0] == 0) // EOF
+      6e:	0f b6 05 e0 29 00 00 	movzbl 0x29e0,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 10 01 00 00    	je     190 <main+0x190>
+  }
+
+  // Read and run input commands.
+  while (getcmd(buf, sizeof(buf)) >= 0)
+  {
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ')
+      80:	3c 63                	cmp    $0x63,%al
+      82:	74 44                	je     c8 <main+0xc8>
+      buf[strlen(buf) - 1] = 0; // chop \n
+      if (chdir(buf + 3) < 0)
+        printf(2, "cannot cd %s\n", buf + 3);
+      continue;
+    }
+    if (buf[0] == 'p' && buf[1] == 'a' && buf[2] == 't' && buf[3] == 'h' &&
+      84:	3c 70                	cmp    $0x70,%al
+      86:	75 0d                	jne    95 <main+0x95>
+      88:	80 3d e1 29 00 00 61 	cmpb   $0x61,0x29e1
+      8f:	0f 84 8b 00 00 00    	je     120 <main+0x120>
+      buf[strlen(buf) - 1] = 0; // chop \n
+      if (set_path(buf + 5) < 0)
+        printf(2, "path too long\n");
+      continue;
+    }
+    if ((cmd = parsecmd(buf)) == 0)
+      95:	83 ec 0c             	sub    $0xc,%esp
+      98:	68 e0 29 00 00       	push   $0x29e0
+      9d:	e8 7e 0f 00 00       	call   1020 <parsecmd>
+      a2:	83 c4 10             	add    $0x10,%esp
+      a5:	89 c3                	mov    %eax,%ebx
+      a7:	85 c0                	test   %eax,%eax
+      a9:	74 95                	je     40 <main+0x40>
+      continue;
+    runwait(cmd);
+      ab:	83 ec 0c             	sub    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	e8 1c 06 00 00       	call   6d0 <runwait>
+    freecmd(cmd);
+      b4:	89 1c 24             	mov    %ebx,(%esp)
+      b7:	e8 84 01 00 00       	call   240 <freecmd>
+      bc:	83 c4 10             	add    $0x10,%esp
+      bf:	e9 7c ff ff ff       	jmp    40 <main+0x40>
+      c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if (buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' ')
+      c8:	80 3d e1 29 00 00 64 	cmpb   $0x64,0x29e1
+      cf:	75 c4                	jne    95 <main+0x95>
+      d1:	80 3d e2 29 00 00 20 	cmpb   $0x20,0x29e2
+      d8:	75 bb                	jne    95 <main+0x95>
+      buf[strlen(buf) - 1] = 0; // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 e0 29 00 00       	push   $0x29e0
+      e2:	e8 59 11 00 00       	call   1240 <strlen>
+      if (chdir(buf + 3) < 0)
+      e7:	c7 04 24 e3 29 00 00 	movl   $0x29e3,(%esp)
+      buf[strlen(buf) - 1] = 0; // chop \n
+      ee:	c6 80 df 29 00 00 00 	movb   $0x0,0x29df(%eax)
+      if (chdir(buf + 3) < 0)
+      f5:	e8 09 14 00 00       	call   1503 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 3b ff ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf + 3);
+     105:	53                   	push   %ebx
+     106:	68 e3 29 00 00       	push   $0x29e3
+     10b:	68 7a 20 00 00       	push   $0x207a
+     110:	6a 02                	push   $0x2
+     112:	e8 f9 16 00 00       	call   1810 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 21 ff ff ff       	jmp    40 <main+0x40>
+     11f:	90                   	nop
+    if (buf[0] == 'p' && buf[1] == 'a' && buf[2] == 't' && buf[3] == 'h' &&
+     120:	80 3d e2 29 00 00 74 	cmpb   $0x74,0x29e2
+     127:	0f 85 68 ff ff ff    	jne    95 <main+0x95>
+     12d:	80 3d e3 29 00 00 68 	cmpb   $0x68,0x29e3
+     134:	0f 85 5b ff ff ff    	jne    95 <main+0x95>
+     13a:	80 3d e4 29 00 00 20 	cmpb   $0x20,0x29e4
+     141:	0f 85 4e ff ff ff    	jne    95 <main+0x95>
+      buf[strlen(buf) - 1] = 0; // chop \n
+     147:	83 ec 0c             	sub    $0xc,%esp
+     14a:	68 e0 29 00 00       	push   $0x29e0
+     14f:	e8 ec 10 00 00       	call   1240 <strlen>
+      if (set_path(buf + 5) < 0)
+     154:	c7 04 24 e5 29 00 00 	movl   $0x29e5,(%esp)
+      buf[strlen(buf) - 1] = 0; // chop \n
+     15b:	c6 80 df 29 00 00 00 	movb   $0x0,0x29df(%eax)
+      if (set_path(buf + 5) < 0)
+     162:	e8 e4 13 00 00       	call   154b <set_path>
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	85 c0                	test   %eax,%eax
+     16c:	0f 89 ce fe ff ff    	jns    40 <main+0x40>
+        printf(2, "path too long\n");
+     172:	51                   	push   %ecx
+     173:	51                   	push   %ecx
+     174:	68 88 20 00 00       	push   $0x2088
+     179:	6a 02                	push   $0x2
+     17b:	e8 90 16 00 00       	call   1810 <printf>
+     180:	83 c4 10             	add    $0x10,%esp
+     183:	e9 b8 fe ff ff       	jmp    40 <main+0x40>
+     188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+  }
+  exit();
+     190:	e8 8b 0f 00 00       	call   1120 <exit>
+      close(fd);
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	50                   	push   %eax
+     199:	e8 1d 13 00 00       	call   14bb <close>
+      break;
+     19e:	83 c4 10             	add    $0x10,%esp
+     1a1:	e9 9a fe ff ff       	jmp    40 <main+0x40>
+     1a6:	66 90                	xchg   %ax,%ax
+     1a8:	66 90                	xchg   %ax,%ax
+     1aa:	66 90                	xchg   %ax,%ax
+     1ac:	66 90                	xchg   %ax,%ax
+     1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <spawnable>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	83 ec 04             	sub    $0x4,%esp
+     1b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  switch (cmd->type)
+     1ba:	8b 13                	mov    (%ebx),%edx
+     1bc:	83 fa 02             	cmp    $0x2,%edx
+     1bf:	74 17                	je     1d8 <spawnable+0x28>
+     1c1:	83 fa 03             	cmp    $0x3,%edx
+     1c4:	74 2a                	je     1f0 <spawnable+0x40>
+    return spawnable(pcmd->left) && spawnable(pcmd->right);
+     1c6:	31 c0                	xor    %eax,%eax
+  switch (cmd->type)
+     1c8:	83 fa 01             	cmp    $0x1,%edx
+     1cb:	74 13                	je     1e0 <spawnable+0x30>
+}
+     1cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1d0:	c9                   	leave
+     1d1:	c3                   	ret
+     1d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return spawnable(((struct redircmd *)cmd)->cmd);
+     1d8:	8b 5b 04             	mov    0x4(%ebx),%ebx
+     1db:	eb dd                	jmp    1ba <spawnable+0xa>
+     1dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return ((struct execcmd *)cmd)->argv[0] != 0;
+     1e0:	8b 53 04             	mov    0x4(%ebx),%edx
+     1e3:	31 c0                	xor    %eax,%eax
+}
+     1e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1e8:	c9                   	leave
+    return ((struct execcmd *)cmd)->argv[0] != 0;
+     1e9:	85 d2                	test   %edx,%edx
+     1eb:	0f 95 c0             	setne  %al
+}
+     1ee:	c3                   	ret
+     1ef:	90                   	nop
+    return spawnable(pcmd->left) && spawnable(pcmd->right);
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	ff 73 04             	push   0x4(%ebx)
+     1f6:	e8 b5 ff ff ff       	call   1b0 <spawnable>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	85 c0                	test   %eax,%eax
+     200:	74 cb                	je     1cd <spawnable+0x1d>
+     202:	83 ec 0c             	sub    $0xc,%esp
+     205:	ff 73 08             	push   0x8(%ebx)
+     208:	e8 a3 ff ff ff       	call   1b0 <spawnable>
+     20d:	83 c4 10             	add    $0x10,%esp
+}
+     210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     213:	c9                   	leave
+    return spawnable(pcmd->left) && spawnable(pcmd->right);
+     214:	85 c0                	test   %eax,%eax
+     216:	0f 95 c0             	setne  %al
+     219:	0f b6 c0             	movzbl %al,%eax
+}
+     21c:	c3                   	ret
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <setaction>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	8b 45 08             	mov    0x8(%ebp),%eax
+  a->op = op;
+     226:	8b 55 0c             	mov    0xc(%ebp),%edx
+     229:	89 10                	mov    %edx,(%eax)
+  a->fd = fd;
+     22b:	8b 55 10             	mov    0x10(%ebp),%edx
+     22e:	89 50 04             	mov    %edx,0x4(%eax)
+  a->newfd = newfd;
+     231:	8b 55 14             	mov    0x14(%ebp),%edx
+     234:	89 50 08             	mov    %edx,0x8(%eax)
+}
+     237:	5d                   	pop    %ebp
+     238:	c3                   	ret
+     239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <freecmd>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	53                   	push   %ebx
+     244:	83 ec 04             	sub    $0x4,%esp
+     247:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (cmd == 0)
+     24a:	85 db                	test   %ebx,%ebx
+     24c:	74 62                	je     2b0 <freecmd+0x70>
+  switch (cmd->type)
+     24e:	8b 03                	mov    (%ebx),%eax
+     250:	83 f8 04             	cmp    $0x4,%eax
+     253:	74 0c                	je     261 <freecmd+0x21>
+     255:	7f 31                	jg     288 <freecmd+0x48>
+     257:	83 f8 02             	cmp    $0x2,%eax
+     25a:	74 31                	je     28d <freecmd+0x4d>
+     25c:	83 f8 03             	cmp    $0x3,%eax
+     25f:	75 17                	jne    278 <freecmd+0x38>
+    freecmd(((struct listcmd *)cmd)->left);
+     261:	83 ec 0c             	sub    $0xc,%esp
+     264:	ff 73 04             	push   0x4(%ebx)
+     267:	e8 d4 ff ff ff       	call   240 <freecmd>
+    freecmd(((struct listcmd *)cmd)->right);
+     26c:	58                   	pop    %eax
+     26d:	ff 73 08             	push   0x8(%ebx)
+     270:	e8 cb ff ff ff       	call   240 <freecmd>
+    break;
+     275:	83 c4 10             	add    $0x10,%esp
+  free(cmd);
+     278:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     27b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     27e:	c9                   	leave
+  free(cmd);
+     27f:	e9 5c 1a 00 00       	jmp    1ce0 <free>
+     284:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch (cmd->type)
+     288:	83 f8 05             	cmp    $0x5,%eax
+     28b:	75 eb                	jne    278 <freecmd+0x38>
+    freecmd(((struct backcmd *)cmd)->cmd);
+     28d:	83 ec 0c             	sub    $0xc,%esp
+     290:	ff 73 04             	push   0x4(%ebx)
+     293:	e8 a8 ff ff ff       	call   240 <freecmd>
+  free(cmd);
+     298:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     29b:	83 c4 10             	add    $0x10,%esp
+}
+     29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a1:	c9                   	leave
+  free(cmd);
+     2a2:	e9 39 1a 00 00       	jmp    1ce0 <free>
+     2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ae:	66 90                	xchg   %ax,%ax
+}
+     2b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+     2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <getcmd>:
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	56                   	push   %esi
+     2c4:	53                   	push   %ebx
+     2c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 b4 1f 00 00       	push   $0x1fb4
+     2d3:	6a 02                	push   $0x2
+     2d5:	e8 36 15 00 00       	call   1810 <printf>
+  memset(buf, 0, nbuf);
+     2da:	83 c4 0c             	add    $0xc,%esp
+     2dd:	56                   	push   %esi
+     2de:	6a 00                	push   $0x0
+     2e0:	53                   	push   %ebx
+     2e1:	e8 8a 0f 00 00       	call   1270 <memset>
+  gets(buf, nbuf);
+     2e6:	58                   	pop    %eax
+     2e7:	5a                   	pop    %edx
+     2e8:	56                   	push   %esi
+     2e9:	53                   	push   %ebx
+     2ea:	e8 e1 0f 00 00       	call   12d0 <gets>
+  if (buf[0] == 0) // EOF
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     2f5:	19 c0                	sbb    %eax,%eax
+}
+     2f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2fa:	5b                   	pop    %ebx
+     2fb:	5e                   	pop    %esi
+     2fc:	5d                   	pop    %ebp
+     2fd:	c3                   	ret
+     2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <panic>:
+}
+
+void panic(char *s)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     306:	ff 75 08             	push   0x8(%ebp)
+     309:	68 6e 20 00 00       	push   $0x206e
+     30e:	6a 02                	push   $0x2
+     310:	e8 fb 14 00 00       	call   1810 <printf>
+  exit();
+     315:	e8 06 0e 00 00       	call   1120 <exit>
+     31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000320 <launch>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	57                   	push   %edi
+     324:	56                   	push   %esi
+     325:	53                   	push   %ebx
+     326:	83 ec 2c             	sub    $0x2c,%esp
+     329:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     32c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     32f:	8b 75 08             	mov    0x8(%ebp),%esi
+     332:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+     335:	8d 04 87             	lea    (%edi,%eax,4),%eax
+  switch (cmd->type)
+     338:	8b 16                	mov    (%esi),%edx
+     33a:	83 fa 02             	cmp    $0x2,%edx
+     33d:	0f 84 f5 00 00 00    	je     438 <launch+0x118>
+     343:	83 fa 03             	cmp    $0x3,%edx
+     346:	0f 85 d4 00 00 00    	jne    420 <launch+0x100>
+    if (n + 4 > SPAWN_MAXACT)
+     34c:	83 fb 0c             	cmp    $0xc,%ebx
+     34f:	0f 8f 72 01 00 00    	jg     4c7 <launch+0x1a7>
+    if (pipe(p) < 0)
+     355:	83 ec 0c             	sub    $0xc,%esp
+     358:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     35b:	50                   	push   %eax
+     35c:	e8 42 11 00 00       	call   14a3 <pipe>
+     361:	83 c4 10             	add    $0x10,%esp
+     364:	85 c0                	test   %eax,%eax
+     366:	0f 88 68 01 00 00    	js     4d4 <launch+0x1b4>
+    setaction(&act[n], SPAWN_DUP2, p[1], 1);
+     36c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  a->fd = fd;
+     36f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    k = launch(pcmd->left, act, n + 3);
+     372:	83 ec 04             	sub    $0x4,%esp
+     375:	83 c3 03             	add    $0x3,%ebx
+    setaction(&act[n], SPAWN_DUP2, p[1], 1);
+     378:	c1 e0 02             	shl    $0x2,%eax
+     37b:	8d 14 07             	lea    (%edi,%eax,1),%edx
+  a->fd = fd;
+     37e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    setaction(&act[n + 1], SPAWN_CLOSE, p[0], 0);
+     381:	8d 4c 07 14          	lea    0x14(%edi,%eax,1),%ecx
+    setaction(&act[n + 2], SPAWN_CLOSE, p[1], 0);
+     385:	8d 44 07 28          	lea    0x28(%edi,%eax,1),%eax
+  a->op = op;
+     389:	c7 02 02 00 00 00    	movl   $0x2,(%edx)
+  a->newfd = newfd;
+     38f:	c7 42 08 01 00 00 00 	movl   $0x1,0x8(%edx)
+     396:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  a->fd = fd;
+     399:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  a->op = op;
+     39c:	c7 01 01 00 00 00    	movl   $0x1,(%ecx)
+  a->fd = fd;
+     3a2:	89 51 04             	mov    %edx,0x4(%ecx)
+  a->newfd = newfd;
+     3a5:	c7 41 08 00 00 00 00 	movl   $0x0,0x8(%ecx)
+  a->fd = fd;
+     3ac:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  a->op = op;
+     3af:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  a->fd = fd;
+     3b5:	89 48 04             	mov    %ecx,0x4(%eax)
+  a->newfd = newfd;
+     3b8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    k = launch(pcmd->left, act, n + 3);
+     3bf:	53                   	push   %ebx
+     3c0:	57                   	push   %edi
+     3c1:	ff 76 04             	push   0x4(%esi)
+     3c4:	e8 57 ff ff ff       	call   320 <launch>
+  a->op = op;
+     3c9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    k += launch(pcmd->right, act, n + 3);
+     3cc:	83 c4 0c             	add    $0xc,%esp
+    k = launch(pcmd->left, act, n + 3);
+     3cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  a->fd = fd;
+     3d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  a->op = op;
+     3d5:	c7 02 02 00 00 00    	movl   $0x2,(%edx)
+  a->fd = fd;
+     3db:	89 42 04             	mov    %eax,0x4(%edx)
+  a->newfd = newfd;
+     3de:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+    k += launch(pcmd->right, act, n + 3);
+     3e5:	53                   	push   %ebx
+     3e6:	57                   	push   %edi
+     3e7:	ff 76 08             	push   0x8(%esi)
+     3ea:	e8 31 ff ff ff       	call   320 <launch>
+     3ef:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     3f2:	01 c2                	add    %eax,%edx
+     3f4:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    close(p[0]);
+     3f7:	58                   	pop    %eax
+     3f8:	ff 75 e0             	push   -0x20(%ebp)
+     3fb:	e8 bb 10 00 00       	call   14bb <close>
+    close(p[1]);
+     400:	5a                   	pop    %edx
+     401:	ff 75 e4             	push   -0x1c(%ebp)
+     404:	e8 b2 10 00 00       	call   14bb <close>
+    return k;
+     409:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     40c:	83 c4 10             	add    $0x10,%esp
+}
+     40f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     412:	89 d0                	mov    %edx,%eax
+     414:	5b                   	pop    %ebx
+     415:	5e                   	pop    %esi
+     416:	5f                   	pop    %edi
+     417:	5d                   	pop    %ebp
+     418:	c3                   	ret
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch (cmd->type)
+     420:	83 fa 01             	cmp    $0x1,%edx
+     423:	74 4b                	je     470 <launch+0x150>
+    panic("launch");
+     425:	83 ec 0c             	sub    $0xc,%esp
+     428:	68 b7 1f 00 00       	push   $0x1fb7
+     42d:	e8 ce fe ff ff       	call   300 <panic>
+     432:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (n + 2 > SPAWN_MAXACT)
+     438:	83 fb 0e             	cmp    $0xe,%ebx
+     43b:	0f 8f 86 00 00 00    	jg     4c7 <launch+0x1a7>
+    setaction(&act[n], SPAWN_OPEN, rcmd->fd, 0);
+     441:	8b 56 14             	mov    0x14(%esi),%edx
+  a->op = op;
+     444:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+    return launch(rcmd->cmd, act, n + 1);
+     44a:	83 c3 01             	add    $0x1,%ebx
+     44d:	83 c0 14             	add    $0x14,%eax
+  a->newfd = newfd;
+     450:	c7 40 f4 00 00 00 00 	movl   $0x0,-0xc(%eax)
+  a->fd = fd;
+     457:	89 50 f0             	mov    %edx,-0x10(%eax)
+    act[n].path = rcmd->file;
+     45a:	8b 56 08             	mov    0x8(%esi),%edx
+     45d:	89 50 f8             	mov    %edx,-0x8(%eax)
+    act[n].mode = rcmd->mode;
+     460:	8b 56 10             	mov    0x10(%esi),%edx
+     463:	89 50 fc             	mov    %edx,-0x4(%eax)
+    return launch(rcmd->cmd, act, n + 1);
+     466:	8b 76 04             	mov    0x4(%esi),%esi
+     469:	e9 ca fe ff ff       	jmp    338 <launch+0x18>
+     46e:	66 90                	xchg   %ax,%ax
+    setaction(&act[n], SPAWN_END, 0, 0);
+     470:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+    if (spawn(ecmd->argv[0], ecmd->argv, act) < 0)
+     473:	83 ec 04             	sub    $0x4,%esp
+     476:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    setaction(&act[n], SPAWN_END, 0, 0);
+     479:	8d 04 87             	lea    (%edi,%eax,4),%eax
+  a->op = op;
+     47c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  a->fd = fd;
+     482:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  a->newfd = newfd;
+     489:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+    if (spawn(ecmd->argv[0], ecmd->argv, act) < 0)
+     490:	8d 46 04             	lea    0x4(%esi),%eax
+     493:	57                   	push   %edi
+     494:	50                   	push   %eax
+     495:	ff 76 04             	push   0x4(%esi)
+     498:	e8 d3 0c 00 00       	call   1170 <spawn>
+     49d:	83 c4 10             	add    $0x10,%esp
+     4a0:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     4a3:	85 c0                	test   %eax,%eax
+     4a5:	0f 89 64 ff ff ff    	jns    40f <launch+0xef>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     4ab:	83 ec 04             	sub    $0x4,%esp
+     4ae:	ff 76 04             	push   0x4(%esi)
+     4b1:	68 be 1f 00 00       	push   $0x1fbe
+     4b6:	6a 02                	push   $0x2
+     4b8:	e8 53 13 00 00       	call   1810 <printf>
+      return 0;
+     4bd:	83 c4 10             	add    $0x10,%esp
+     4c0:	31 d2                	xor    %edx,%edx
+     4c2:	e9 48 ff ff ff       	jmp    40f <launch+0xef>
+      panic("too many redirections");
+     4c7:	83 ec 0c             	sub    $0xc,%esp
+     4ca:	68 ce 1f 00 00       	push   $0x1fce
+     4cf:	e8 2c fe ff ff       	call   300 <panic>
+      panic("pipe");
+     4d4:	83 ec 0c             	sub    $0xc,%esp
+     4d7:	68 e4 1f 00 00       	push   $0x1fe4
+     4dc:	e8 1f fe ff ff       	call   300 <panic>
+     4e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ef:	90                   	nop
+
+000004f0 <runwait.part.0>:
+void runwait(struct cmd *cmd)
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	53                   	push   %ebx
+    for (n = launch(cmd, act, 0); n > 0; n--)
+     4f4:	8d 95 b8 fe ff ff    	lea    -0x148(%ebp),%edx
+void runwait(struct cmd *cmd)
+     4fa:	81 ec 48 01 00 00    	sub    $0x148,%esp
+    for (n = launch(cmd, act, 0); n > 0; n--)
+     500:	6a 00                	push   $0x0
+     502:	52                   	push   %edx
+     503:	50                   	push   %eax
+     504:	e8 17 fe ff ff       	call   320 <launch>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	85 c0                	test   %eax,%eax
+     50e:	7e 12                	jle    522 <runwait.part.0+0x32>
+     510:	89 c3                	mov    %eax,%ebx
+     512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      wait();
+     518:	e8 7e 0f 00 00       	call   149b <wait>
+    for (n = launch(cmd, act, 0); n > 0; n--)
+     51d:	83 eb 01             	sub    $0x1,%ebx
+     520:	75 f6                	jne    518 <runwait.part.0+0x28>
+}
+     522:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     525:	c9                   	leave
+     526:	c3                   	ret
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+
+00000530 <fork1>:
+}
+
+int fork1(void)
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+     536:	e8 b5 0b 00 00       	call   10f0 <fork>
+  if (pid == -1)
+     53b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     53e:	74 02                	je     542 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+     540:	c9                   	leave
+     541:	c3                   	ret
+    panic("fork");
+     542:	83 ec 0c             	sub    $0xc,%esp
+     545:	68 e9 1f 00 00       	push   $0x1fe9
+     54a:	e8 b1 fd ff ff       	call   300 <panic>
+     54f:	90                   	nop
+
+00000550 <runcmd>:
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	53                   	push   %ebx
+     554:	83 ec 14             	sub    $0x14,%esp
+     557:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (cmd == 0)
+     55a:	85 db                	test   %ebx,%ebx
+     55c:	74 42                	je     5a0 <runcmd+0x50>
+  switch (cmd->type)
+     55e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     561:	0f 87 de 00 00 00    	ja     645 <runcmd+0xf5>
+     567:	8b 03                	mov    (%ebx),%eax
+     569:	ff 24 85 98 20 00 00 	jmp    *0x2098(,%eax,4)
+    if (ecmd->argv[0] == 0)
+     570:	8b 43 04             	mov    0x4(%ebx),%eax
+     573:	85 c0                	test   %eax,%eax
+     575:	74 29                	je     5a0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     577:	8d 53 04             	lea    0x4(%ebx),%edx
+     57a:	51                   	push   %ecx
+     57b:	51                   	push   %ecx
+     57c:	52                   	push   %edx
+     57d:	50                   	push   %eax
+     57e:	e8 bd 0b 00 00       	call   1140 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     583:	83 c4 0c             	add    $0xc,%esp
+     586:	ff 73 04             	push   0x4(%ebx)
+     589:	68 be 1f 00 00       	push   $0x1fbe
+     58e:	6a 02                	push   $0x2
+     590:	e8 7b 12 00 00       	call   1810 <printf>
+    break;
+     595:	83 c4 10             	add    $0x10,%esp
+     598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59f:	90                   	nop
+    exit();
+     5a0:	e8 7b 0b 00 00       	call   1120 <exit>
+    if (fork1() == 0)
+     5a5:	e8 86 ff ff ff       	call   530 <fork1>
+     5aa:	85 c0                	test   %eax,%eax
+     5ac:	75 f2                	jne    5a0 <runcmd+0x50>
+     5ae:	e9 87 00 00 00       	jmp    63a <runcmd+0xea>
+    if (pipe(p) < 0)
+     5b3:	83 ec 0c             	sub    $0xc,%esp
+     5b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     5b9:	50                   	push   %eax
+     5ba:	e8 e4 0e 00 00       	call   14a3 <pipe>
+     5bf:	83 c4 10             	add    $0x10,%esp
+     5c2:	85 c0                	test   %eax,%eax
+     5c4:	0f 88 9d 00 00 00    	js     667 <runcmd+0x117>
+    if (fork1() == 0)
+     5ca:	e8 61 ff ff ff       	call   530 <fork1>
+     5cf:	85 c0                	test   %eax,%eax
+     5d1:	0f 84 9d 00 00 00    	je     674 <runcmd+0x124>
+    if (fork1() == 0)
+     5d7:	e8 54 ff ff ff       	call   530 <fork1>
+     5dc:	85 c0                	test   %eax,%eax
+     5de:	0f 84 be 00 00 00    	je     6a2 <runcmd+0x152>
+    close(p[0]);
+     5e4:	83 ec 0c             	sub    $0xc,%esp
+     5e7:	ff 75 f0             	push   -0x10(%ebp)
+     5ea:	e8 cc 0e 00 00       	call   14bb <close>
+    close(p[1]);
+     5ef:	58                   	pop    %eax
+     5f0:	ff 75 f4             	push   -0xc(%ebp)
+     5f3:	e8 c3 0e 00 00       	call   14bb <close>
+    wait();
+     5f8:	e8 9e 0e 00 00       	call   149b <wait>
+    wait();
+     5fd:	e8 99 0e 00 00       	call   149b <wait>
+    break;
+     602:	83 c4 10             	add    $0x10,%esp
+     605:	eb 99                	jmp    5a0 <runcmd+0x50>
+    runwait(lcmd->left);
+     607:	83 ec 0c             	sub    $0xc,%esp
+     60a:	ff 73 04             	push   0x4(%ebx)
+     60d:	e8 be 00 00 00       	call   6d0 <runwait>
+    runcmd(lcmd->right);
+     612:	59                   	pop    %ecx
+     613:	ff 73 08             	push   0x8(%ebx)
+     616:	e8 35 ff ff ff       	call   550 <runcmd>
+    close(rcmd->fd);
+     61b:	83 ec 0c             	sub    $0xc,%esp
+     61e:	ff 73 14             	push   0x14(%ebx)
+     621:	e8 95 0e 00 00       	call   14bb <close>
+    if (open(rcmd->file, rcmd->mode) < 0)
+     626:	58                   	pop    %eax
+     627:	5a                   	pop    %edx
+     628:	ff 73 10             	push   0x10(%ebx)
+     62b:	ff 73 08             	push   0x8(%ebx)
+     62e:	e8 a0 0e 00 00       	call   14d3 <open>
+     633:	83 c4 10             	add    $0x10,%esp
+     636:	85 c0                	test   %eax,%eax
+     638:	78 18                	js     652 <runcmd+0x102>
+      runcmd(bcmd->cmd);
+     63a:	83 ec 0c             	sub    $0xc,%esp
+     63d:	ff 73 04             	push   0x4(%ebx)
+     640:	e8 0b ff ff ff       	call   550 <runcmd>
+    panic("runcmd");
+     645:	83 ec 0c             	sub    $0xc,%esp
+     648:	68 ee 1f 00 00       	push   $0x1fee
+     64d:	e8 ae fc ff ff       	call   300 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     652:	50                   	push   %eax
+     653:	ff 73 08             	push   0x8(%ebx)
+     656:	68 f5 1f 00 00       	push   $0x1ff5
+     65b:	6a 02                	push   $0x2
+     65d:	e8 ae 11 00 00       	call   1810 <printf>
+      exit();
+     662:	e8 b9 0a 00 00       	call   1120 <exit>
+      panic("pipe");
+     667:	83 ec 0c             	sub    $0xc,%esp
+     66a:	68 e4 1f 00 00       	push   $0x1fe4
+     66f:	e8 8c fc ff ff       	call   300 <panic>
+      close(1);
+     674:	83 ec 0c             	sub    $0xc,%esp
+     677:	6a 01                	push   $0x1
+     679:	e8 3d 0e 00 00       	call   14bb <close>
+      dup(p[1]);
+     67e:	58                   	pop    %eax
+     67f:	ff 75 f4             	push   -0xc(%ebp)
+     682:	e8 84 0e 00 00       	call   150b <dup>
+      close(p[0]);
+     687:	58                   	pop    %eax
+     688:	ff 75 f0             	push   -0x10(%ebp)
+     68b:	e8 2b 0e 00 00       	call   14bb <close>
+      close(p[1]);
+     690:	58                   	pop    %eax
+     691:	ff 75 f4             	push   -0xc(%ebp)
+     694:	e8 22 0e 00 00       	call   14bb <close>
+      runcmd(pcmd->left);
+     699:	5a                   	pop    %edx
+     69a:	ff 73 04             	push   0x4(%ebx)
+     69d:	e8 ae fe ff ff       	call   550 <runcmd>
+      close(0);
+     6a2:	83 ec 0c             	sub    $0xc,%esp
+     6a5:	6a 00                	push   $0x0
+     6a7:	e8 0f 0e 00 00       	call   14bb <close>
+      dup(p[0]);
+     6ac:	5a                   	pop    %edx
+     6ad:	ff 75 f0             	push   -0x10(%ebp)
+     6b0:	e8 56 0e 00 00       	call   150b <dup>
+      close(p[0]);
+     6b5:	59                   	pop    %ecx
+     6b6:	ff 75 f0             	push   -0x10(%ebp)
+     6b9:	e8 fd 0d 00 00       	call   14bb <close>
+      close(p[1]);
+     6be:	58                   	pop    %eax
+     6bf:	ff 75 f4             	push   -0xc(%ebp)
+     6c2:	e8 f4 0d 00 00       	call   14bb <close>
+      runcmd(pcmd->right);
+     6c7:	58                   	pop    %eax
+     6c8:	ff 73 08             	push   0x8(%ebx)
+     6cb:	e8 80 fe ff ff       	call   550 <runcmd>
+
+000006d0 <runwait>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	83 ec 04             	sub    $0x4,%esp
+     6d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (cmd != 0 && spawnable(cmd))
+     6da:	85 db                	test   %ebx,%ebx
+     6dc:	74 10                	je     6ee <runwait+0x1e>
+     6de:	83 ec 0c             	sub    $0xc,%esp
+     6e1:	53                   	push   %ebx
+     6e2:	e8 c9 fa ff ff       	call   1b0 <spawnable>
+     6e7:	83 c4 10             	add    $0x10,%esp
+     6ea:	85 c0                	test   %eax,%eax
+     6ec:	75 1a                	jne    708 <runwait+0x38>
+  pid = fork();
+     6ee:	e8 fd 09 00 00       	call   10f0 <fork>
+  if (pid == -1)
+     6f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6f6:	74 1b                	je     713 <runwait+0x43>
+  if (fork1() == 0)
+     6f8:	85 c0                	test   %eax,%eax
+     6fa:	74 24                	je     720 <runwait+0x50>
+}
+     6fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6ff:	c9                   	leave
+  wait();
+     700:	e9 96 0d 00 00       	jmp    149b <wait>
+     705:	8d 76 00             	lea    0x0(%esi),%esi
+     708:	89 d8                	mov    %ebx,%eax
+}
+     70a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     70d:	c9                   	leave
+     70e:	e9 dd fd ff ff       	jmp    4f0 <runwait.part.0>
+    panic("fork");
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	68 e9 1f 00 00       	push   $0x1fe9
+     71b:	e8 e0 fb ff ff       	call   300 <panic>
+    runcmd(cmd);
+     720:	83 ec 0c             	sub    $0xc,%esp
+     723:	53                   	push   %ebx
+     724:	e8 27 fe ff ff       	call   550 <runcmd>
+     729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd *
+execcmd(void)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	53                   	push   %ebx
+     734:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     737:	6a 54                	push   $0x54
+     739:	e8 c2 16 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     73e:	83 c4 0c             	add    $0xc,%esp
+     741:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     743:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     745:	6a 00                	push   $0x0
+     747:	50                   	push   %eax
+     748:	e8 23 0b 00 00       	call   1270 <memset>
+  cmd->type = EXEC;
+     74d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd *)cmd;
+}
+     753:	89 d8                	mov    %ebx,%eax
+     755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     758:	c9                   	leave
+     759:	c3                   	ret
+     75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000760 <redircmd>:
+
+struct cmd *
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	53                   	push   %ebx
+     764:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     767:	6a 18                	push   $0x18
+     769:	e8 92 16 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     76e:	83 c4 0c             	add    $0xc,%esp
+     771:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     773:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     775:	6a 00                	push   $0x0
+     777:	50                   	push   %eax
+     778:	e8 f3 0a 00 00       	call   1270 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     77d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     780:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     786:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     789:	8b 45 0c             	mov    0xc(%ebp),%eax
+     78c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     78f:	8b 45 10             	mov    0x10(%ebp),%eax
+     792:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     795:	8b 45 14             	mov    0x14(%ebp),%eax
+     798:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     79b:	8b 45 18             	mov    0x18(%ebp),%eax
+     79e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd *)cmd;
+}
+     7a1:	89 d8                	mov    %ebx,%eax
+     7a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a6:	c9                   	leave
+     7a7:	c3                   	ret
+     7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7af:	90                   	nop
+
+000007b0 <pipecmd>:
+
+struct cmd *
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	53                   	push   %ebx
+     7b4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     7b7:	6a 0c                	push   $0xc
+     7b9:	e8 42 16 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7be:	83 c4 0c             	add    $0xc,%esp
+     7c1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     7c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     7c5:	6a 00                	push   $0x0
+     7c7:	50                   	push   %eax
+     7c8:	e8 a3 0a 00 00       	call   1270 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     7cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     7d0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     7d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     7d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd *)cmd;
+}
+     7df:	89 d8                	mov    %ebx,%eax
+     7e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7e4:	c9                   	leave
+     7e5:	c3                   	ret
+     7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007f0 <listcmd>:
+
+struct cmd *
+listcmd(struct cmd *left, struct cmd *right)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	53                   	push   %ebx
+     7f4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     7f7:	6a 0c                	push   $0xc
+     7f9:	e8 02 16 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7fe:	83 c4 0c             	add    $0xc,%esp
+     801:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     803:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     805:	6a 00                	push   $0x0
+     807:	50                   	push   %eax
+     808:	e8 63 0a 00 00       	call   1270 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     80d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     810:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     816:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     819:	8b 45 0c             	mov    0xc(%ebp),%eax
+     81c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd *)cmd;
+}
+     81f:	89 d8                	mov    %ebx,%eax
+     821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     824:	c9                   	leave
+     825:	c3                   	ret
+     826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <backcmd>:
+
+struct cmd *
+backcmd(struct cmd *subcmd)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	53                   	push   %ebx
+     834:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     837:	6a 08                	push   $0x8
+     839:	e8 c2 15 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     83e:	83 c4 0c             	add    $0xc,%esp
+     841:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     843:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     845:	6a 00                	push   $0x0
+     847:	50                   	push   %eax
+     848:	e8 23 0a 00 00       	call   1270 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     84d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     850:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     856:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd *)cmd;
+}
+     859:	89 d8                	mov    %ebx,%eax
+     85b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     85e:	c9                   	leave
+     85f:	c3                   	ret
+
+00000860 <gettoken>:
+
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int gettoken(char **ps, char *es, char **q, char **eq)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	57                   	push   %edi
+     864:	56                   	push   %esi
+     865:	53                   	push   %ebx
+     866:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     869:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     86c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     86f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     872:	8b 38                	mov    (%eax),%edi
+  while (s < es && strchr(whitespace, *s))
+     874:	39 df                	cmp    %ebx,%edi
+     876:	72 0f                	jb     887 <gettoken+0x27>
+     878:	eb 25                	jmp    89f <gettoken+0x3f>
+     87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     880:	83 c7 01             	add    $0x1,%edi
+  while (s < es && strchr(whitespace, *s))
+     883:	39 fb                	cmp    %edi,%ebx
+     885:	74 18                	je     89f <gettoken+0x3f>
+     887:	0f be 07             	movsbl (%edi),%eax
+     88a:	83 ec 08             	sub    $0x8,%esp
+     88d:	50                   	push   %eax
+     88e:	68 a8 29 00 00       	push   $0x29a8
+     893:	e8 f8 09 00 00       	call   1290 <strchr>
+     898:	83 c4 10             	add    $0x10,%esp
+     89b:	85 c0                	test   %eax,%eax
+     89d:	75 e1                	jne    880 <gettoken+0x20>
+  if (q)
+     89f:	85 f6                	test   %esi,%esi
+     8a1:	74 02                	je     8a5 <gettoken+0x45>
+    *q = s;
+     8a3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     8a5:	0f b6 07             	movzbl (%edi),%eax
+  switch (*s)
+     8a8:	3c 3c                	cmp    $0x3c,%al
+     8aa:	0f 8f d0 00 00 00    	jg     980 <gettoken+0x120>
+     8b0:	3c 3a                	cmp    $0x3a,%al
+     8b2:	0f 8f bc 00 00 00    	jg     974 <gettoken+0x114>
+     8b8:	84 c0                	test   %al,%al
+     8ba:	75 44                	jne    900 <gettoken+0xa0>
+     8bc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if (eq)
+     8be:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     8c1:	85 c9                	test   %ecx,%ecx
+     8c3:	74 05                	je     8ca <gettoken+0x6a>
+    *eq = s;
+     8c5:	8b 45 14             	mov    0x14(%ebp),%eax
+     8c8:	89 38                	mov    %edi,(%eax)
+
+  while (s < es && strchr(whitespace, *s))
+     8ca:	39 df                	cmp    %ebx,%edi
+     8cc:	72 09                	jb     8d7 <gettoken+0x77>
+     8ce:	eb 1f                	jmp    8ef <gettoken+0x8f>
+    s++;
+     8d0:	83 c7 01             	add    $0x1,%edi
+  while (s < es && strchr(whitespace, *s))
+     8d3:	39 fb                	cmp    %edi,%ebx
+     8d5:	74 18                	je     8ef <gettoken+0x8f>
+     8d7:	0f be 07             	movsbl (%edi),%eax
+     8da:	83 ec 08             	sub    $0x8,%esp
+     8dd:	50                   	push   %eax
+     8de:	68 a8 29 00 00       	push   $0x29a8
+     8e3:	e8 a8 09 00 00       	call   1290 <strchr>
+     8e8:	83 c4 10             	add    $0x10,%esp
+     8eb:	85 c0                	test   %eax,%eax
+     8ed:	75 e1                	jne    8d0 <gettoken+0x70>
+  *ps = s;
+     8ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     8f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f7:	89 f0                	mov    %esi,%eax
+     8f9:	5b                   	pop    %ebx
+     8fa:	5e                   	pop    %esi
+     8fb:	5f                   	pop    %edi
+     8fc:	5d                   	pop    %ebp
+     8fd:	c3                   	ret
+     8fe:	66 90                	xchg   %ax,%ax
+  switch (*s)
+     900:	79 66                	jns    968 <gettoken+0x108>
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     902:	39 df                	cmp    %ebx,%edi
+     904:	72 39                	jb     93f <gettoken+0xdf>
+  if (eq)
+     906:	8b 55 14             	mov    0x14(%ebp),%edx
+     909:	85 d2                	test   %edx,%edx
+     90b:	0f 84 b3 00 00 00    	je     9c4 <gettoken+0x164>
+    *eq = s;
+     911:	8b 45 14             	mov    0x14(%ebp),%eax
+     914:	89 38                	mov    %edi,(%eax)
+  while (s < es && strchr(whitespace, *s))
+     916:	e9 a9 00 00 00       	jmp    9c4 <gettoken+0x164>
+     91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     91f:	90                   	nop
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     920:	0f be 07             	movsbl (%edi),%eax
+     923:	83 ec 08             	sub    $0x8,%esp
+     926:	50                   	push   %eax
+     927:	68 a0 29 00 00       	push   $0x29a0
+     92c:	e8 5f 09 00 00       	call   1290 <strchr>
+     931:	83 c4 10             	add    $0x10,%esp
+     934:	85 c0                	test   %eax,%eax
+     936:	75 1f                	jne    957 <gettoken+0xf7>
+      s++;
+     938:	83 c7 01             	add    $0x1,%edi
+    while (s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     93b:	39 fb                	cmp    %edi,%ebx
+     93d:	74 77                	je     9b6 <gettoken+0x156>
+     93f:	0f be 07             	movsbl (%edi),%eax
+     942:	83 ec 08             	sub    $0x8,%esp
+     945:	50                   	push   %eax
+     946:	68 a8 29 00 00       	push   $0x29a8
+     94b:	e8 40 09 00 00       	call   1290 <strchr>
+     950:	83 c4 10             	add    $0x10,%esp
+     953:	85 c0                	test   %eax,%eax
+     955:	74 c9                	je     920 <gettoken+0xc0>
+    ret = 'a';
+     957:	be 61 00 00 00       	mov    $0x61,%esi
+     95c:	e9 5d ff ff ff       	jmp    8be <gettoken+0x5e>
+     961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch (*s)
+     968:	3c 26                	cmp    $0x26,%al
+     96a:	74 08                	je     974 <gettoken+0x114>
+     96c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     96f:	80 f9 01             	cmp    $0x1,%cl
+     972:	77 8e                	ja     902 <gettoken+0xa2>
+  ret = *s;
+     974:	0f be f0             	movsbl %al,%esi
+    s++;
+     977:	83 c7 01             	add    $0x1,%edi
+    break;
+     97a:	e9 3f ff ff ff       	jmp    8be <gettoken+0x5e>
+     97f:	90                   	nop
+  switch (*s)
+     980:	3c 3e                	cmp    $0x3e,%al
+     982:	75 1c                	jne    9a0 <gettoken+0x140>
+    if (*s == '>')
+     984:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     988:	74 1f                	je     9a9 <gettoken+0x149>
+    s++;
+     98a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     98d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     992:	e9 27 ff ff ff       	jmp    8be <gettoken+0x5e>
+     997:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99e:	66 90                	xchg   %ax,%ax
+  switch (*s)
+     9a0:	3c 7c                	cmp    $0x7c,%al
+     9a2:	74 d0                	je     974 <gettoken+0x114>
+     9a4:	e9 59 ff ff ff       	jmp    902 <gettoken+0xa2>
+      s++;
+     9a9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     9ac:	be 2b 00 00 00       	mov    $0x2b,%esi
+     9b1:	e9 08 ff ff ff       	jmp    8be <gettoken+0x5e>
+  if (eq)
+     9b6:	8b 45 14             	mov    0x14(%ebp),%eax
+     9b9:	85 c0                	test   %eax,%eax
+     9bb:	74 05                	je     9c2 <gettoken+0x162>
+    *eq = s;
+     9bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     9c0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     9c2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     9c4:	be 61 00 00 00       	mov    $0x61,%esi
+     9c9:	e9 21 ff ff ff       	jmp    8ef <gettoken+0x8f>
+     9ce:	66 90                	xchg   %ax,%ax
+
+000009d0 <peek>:
+
+int peek(char **ps, char *es, char *toks)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	57                   	push   %edi
+     9d4:	56                   	push   %esi
+     9d5:	53                   	push   %ebx
+     9d6:	83 ec 0c             	sub    $0xc,%esp
+     9d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     9dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     9df:	8b 1f                	mov    (%edi),%ebx
+  while (s < es && strchr(whitespace, *s))
+     9e1:	39 f3                	cmp    %esi,%ebx
+     9e3:	72 12                	jb     9f7 <peek+0x27>
+     9e5:	eb 28                	jmp    a0f <peek+0x3f>
+     9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ee:	66 90                	xchg   %ax,%ax
+    s++;
+     9f0:	83 c3 01             	add    $0x1,%ebx
+  while (s < es && strchr(whitespace, *s))
+     9f3:	39 de                	cmp    %ebx,%esi
+     9f5:	74 18                	je     a0f <peek+0x3f>
+     9f7:	0f be 03             	movsbl (%ebx),%eax
+     9fa:	83 ec 08             	sub    $0x8,%esp
+     9fd:	50                   	push   %eax
+     9fe:	68 a8 29 00 00       	push   $0x29a8
+     a03:	e8 88 08 00 00       	call   1290 <strchr>
+     a08:	83 c4 10             	add    $0x10,%esp
+     a0b:	85 c0                	test   %eax,%eax
+     a0d:	75 e1                	jne    9f0 <peek+0x20>
+  *ps = s;
+     a0f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     a11:	0f be 03             	movsbl (%ebx),%eax
+     a14:	31 d2                	xor    %edx,%edx
+     a16:	84 c0                	test   %al,%al
+     a18:	75 0e                	jne    a28 <peek+0x58>
+}
+     a1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a1d:	89 d0                	mov    %edx,%eax
+     a1f:	5b                   	pop    %ebx
+     a20:	5e                   	pop    %esi
+     a21:	5f                   	pop    %edi
+     a22:	5d                   	pop    %ebp
+     a23:	c3                   	ret
+     a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     a28:	83 ec 08             	sub    $0x8,%esp
+     a2b:	50                   	push   %eax
+     a2c:	ff 75 10             	push   0x10(%ebp)
+     a2f:	e8 5c 08 00 00       	call   1290 <strchr>
+     a34:	83 c4 10             	add    $0x10,%esp
+     a37:	31 d2                	xor    %edx,%edx
+     a39:	85 c0                	test   %eax,%eax
+     a3b:	0f 95 c2             	setne  %dl
+}
+     a3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a41:	5b                   	pop    %ebx
+     a42:	89 d0                	mov    %edx,%eax
+     a44:	5e                   	pop    %esi
+     a45:	5f                   	pop    %edi
+     a46:	5d                   	pop    %ebp
+     a47:	c3                   	ret
+     a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+
+00000a50 <syntax>:
+// parsecmd() returns 0.
+int parseerror;
+
+void syntax(char *s)
+{
+  if (!parseerror)
+     a50:	a1 c0 29 00 00       	mov    0x29c0,%eax
+     a55:	85 c0                	test   %eax,%eax
+     a57:	74 0f                	je     a68 <syntax+0x18>
+    printf(2, "%s\n", s);
+  parseerror = 1;
+     a59:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+     a60:	00 00 00 
+     a63:	c3                   	ret
+     a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+{
+     a68:	55                   	push   %ebp
+     a69:	89 e5                	mov    %esp,%ebp
+     a6b:	83 ec 0c             	sub    $0xc,%esp
+    printf(2, "%s\n", s);
+     a6e:	ff 75 08             	push   0x8(%ebp)
+     a71:	68 6e 20 00 00       	push   $0x206e
+     a76:	6a 02                	push   $0x2
+     a78:	e8 93 0d 00 00       	call   1810 <printf>
+     a7d:	83 c4 10             	add    $0x10,%esp
+  parseerror = 1;
+     a80:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+     a87:	00 00 00 
+}
+     a8a:	c9                   	leave
+     a8b:	c3                   	ret
+     a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a90 <parseredirs>:
+  return cmd;
+}
+
+struct cmd *
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+     a96:	83 ec 2c             	sub    $0x2c,%esp
+     a99:	8b 75 0c             	mov    0xc(%ebp),%esi
+     a9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while (peek(ps, es, "<>"))
+     a9f:	90                   	nop
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	68 22 20 00 00       	push   $0x2022
+     aa8:	53                   	push   %ebx
+     aa9:	56                   	push   %esi
+     aaa:	e8 21 ff ff ff       	call   9d0 <peek>
+     aaf:	83 c4 10             	add    $0x10,%esp
+     ab2:	85 c0                	test   %eax,%eax
+     ab4:	0f 84 09 01 00 00    	je     bc3 <parseredirs+0x133>
+  {
+    tok = gettoken(ps, es, 0, 0);
+     aba:	6a 00                	push   $0x0
+     abc:	6a 00                	push   $0x0
+     abe:	53                   	push   %ebx
+     abf:	56                   	push   %esi
+     ac0:	e8 9b fd ff ff       	call   860 <gettoken>
+     ac5:	89 c7                	mov    %eax,%edi
+    if (gettoken(ps, es, &q, &eq) != 'a')
+     ac7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     aca:	50                   	push   %eax
+     acb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ace:	50                   	push   %eax
+     acf:	53                   	push   %ebx
+     ad0:	56                   	push   %esi
+     ad1:	e8 8a fd ff ff       	call   860 <gettoken>
+     ad6:	83 c4 20             	add    $0x20,%esp
+     ad9:	83 f8 61             	cmp    $0x61,%eax
+     adc:	0f 85 ce 00 00 00    	jne    bb0 <parseredirs+0x120>
+    {
+      syntax("missing file for redirection");
+      break;
+    }
+    switch (tok)
+     ae2:	83 ff 3c             	cmp    $0x3c,%edi
+     ae5:	74 69                	je     b50 <parseredirs+0xc0>
+     ae7:	83 ff 3e             	cmp    $0x3e,%edi
+     aea:	74 05                	je     af1 <parseredirs+0x61>
+     aec:	83 ff 2b             	cmp    $0x2b,%edi
+     aef:	75 af                	jne    aa0 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+      break;
+    case '+': // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     af1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     af4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     af7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY | O_CREATE, 1);
+     afa:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     afd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     b00:	6a 18                	push   $0x18
+     b02:	e8 f9 12 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b07:	83 c4 0c             	add    $0xc,%esp
+     b0a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     b0c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     b0e:	6a 00                	push   $0x0
+     b10:	50                   	push   %eax
+     b11:	e8 5a 07 00 00       	call   1270 <memset>
+  cmd->type = REDIR;
+     b16:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     b1c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     b1f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     b22:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     b25:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     b28:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     b2b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     b2e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     b35:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     b38:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     b3f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     b42:	e9 59 ff ff ff       	jmp    aa0 <parseredirs+0x10>
+     b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     b50:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     b53:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     b56:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     b59:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     b5c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     b5f:	6a 18                	push   $0x18
+     b61:	e8 9a 12 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b66:	83 c4 0c             	add    $0xc,%esp
+     b69:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     b6b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     b6d:	6a 00                	push   $0x0
+     b6f:	50                   	push   %eax
+     b70:	e8 fb 06 00 00       	call   1270 <memset>
+  cmd->cmd = subcmd;
+     b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     b78:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     b7b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     b7e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     b81:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     b87:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     b8a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     b8d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     b90:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     b93:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     b9a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     ba1:	e9 fa fe ff ff       	jmp    aa0 <parseredirs+0x10>
+     ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bad:	8d 76 00             	lea    0x0(%esi),%esi
+  if (!parseerror)
+     bb0:	a1 c0 29 00 00       	mov    0x29c0,%eax
+     bb5:	85 c0                	test   %eax,%eax
+     bb7:	74 15                	je     bce <parseredirs+0x13e>
+  parseerror = 1;
+     bb9:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+     bc0:	00 00 00 
+    }
+  }
+  return cmd;
+}
+     bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bc9:	5b                   	pop    %ebx
+     bca:	5e                   	pop    %esi
+     bcb:	5f                   	pop    %edi
+     bcc:	5d                   	pop    %ebp
+     bcd:	c3                   	ret
+    printf(2, "%s\n", s);
+     bce:	83 ec 04             	sub    $0x4,%esp
+     bd1:	68 05 20 00 00       	push   $0x2005
+     bd6:	68 6e 20 00 00       	push   $0x206e
+     bdb:	6a 02                	push   $0x2
+     bdd:	e8 2e 0c 00 00       	call   1810 <printf>
+     be2:	83 c4 10             	add    $0x10,%esp
+     be5:	eb d2                	jmp    bb9 <parseredirs+0x129>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <parseexec>:
+  return cmd;
+}
+
+struct cmd *
+parseexec(char **ps, char *es)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	57                   	push   %edi
+     bf4:	56                   	push   %esi
+     bf5:	53                   	push   %ebx
+     bf6:	83 ec 30             	sub    $0x30,%esp
+     bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     bfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if (peek(ps, es, "("))
+     bff:	68 25 20 00 00       	push   $0x2025
+     c04:	56                   	push   %esi
+     c05:	53                   	push   %ebx
+     c06:	e8 c5 fd ff ff       	call   9d0 <peek>
+     c0b:	83 c4 10             	add    $0x10,%esp
+     c0e:	85 c0                	test   %eax,%eax
+     c10:	0f 85 ca 00 00 00    	jne    ce0 <parseexec+0xf0>
+  cmd = malloc(sizeof(*cmd));
+     c16:	83 ec 0c             	sub    $0xc,%esp
+     c19:	89 c7                	mov    %eax,%edi
+     c1b:	6a 54                	push   $0x54
+     c1d:	e8 de 11 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     c22:	83 c4 0c             	add    $0xc,%esp
+     c25:	6a 54                	push   $0x54
+     c27:	6a 00                	push   $0x0
+     c29:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c2c:	50                   	push   %eax
+     c2d:	e8 3e 06 00 00       	call   1270 <memset>
+  cmd->type = EXEC;
+     c32:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd *)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     c35:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     c38:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     c3e:	56                   	push   %esi
+     c3f:	53                   	push   %ebx
+     c40:	50                   	push   %eax
+     c41:	e8 4a fe ff ff       	call   a90 <parseredirs>
+  while (!peek(ps, es, "|)&;"))
+     c46:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     c49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     c4c:	eb 29                	jmp    c77 <parseexec+0x87>
+     c4e:	66 90                	xchg   %ax,%ax
+    if (argc + 1 >= MAXARGS)
+    {
+      syntax("too many args");
+      break;
+    }
+    cmd->argv[argc] = q;
+     c50:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c53:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    cmd->eargv[argc] = eq;
+    argc++;
+    ret = parseredirs(ret, ps, es);
+     c56:	83 ec 04             	sub    $0x4,%esp
+    cmd->argv[argc] = q;
+     c59:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     c5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c60:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     c64:	83 c7 01             	add    $0x1,%edi
+    ret = parseredirs(ret, ps, es);
+     c67:	56                   	push   %esi
+     c68:	53                   	push   %ebx
+     c69:	ff 75 d4             	push   -0x2c(%ebp)
+     c6c:	e8 1f fe ff ff       	call   a90 <parseredirs>
+     c71:	83 c4 10             	add    $0x10,%esp
+     c74:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while (!peek(ps, es, "|)&;"))
+     c77:	83 ec 04             	sub    $0x4,%esp
+     c7a:	68 3c 20 00 00       	push   $0x203c
+     c7f:	56                   	push   %esi
+     c80:	53                   	push   %ebx
+     c81:	e8 4a fd ff ff       	call   9d0 <peek>
+     c86:	83 c4 10             	add    $0x10,%esp
+     c89:	85 c0                	test   %eax,%eax
+     c8b:	75 33                	jne    cc0 <parseexec+0xd0>
+    if ((tok = gettoken(ps, es, &q, &eq)) == 0)
+     c8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     c90:	50                   	push   %eax
+     c91:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c94:	50                   	push   %eax
+     c95:	56                   	push   %esi
+     c96:	53                   	push   %ebx
+     c97:	e8 c4 fb ff ff       	call   860 <gettoken>
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	85 c0                	test   %eax,%eax
+     ca1:	74 1d                	je     cc0 <parseexec+0xd0>
+    if (tok != 'a')
+     ca3:	83 f8 61             	cmp    $0x61,%eax
+     ca6:	75 70                	jne    d18 <parseexec+0x128>
+    if (argc + 1 >= MAXARGS)
+     ca8:	83 ff 09             	cmp    $0x9,%edi
+     cab:	75 a3                	jne    c50 <parseexec+0x60>
+  if (!parseerror)
+     cad:	a1 c0 29 00 00       	mov    0x29c0,%eax
+     cb2:	85 c0                	test   %eax,%eax
+     cb4:	74 42                	je     cf8 <parseexec+0x108>
+  parseerror = 1;
+     cb6:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+     cbd:	00 00 00 
+  }
+  cmd->argv[argc] = 0;
+     cc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     cc3:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     cca:	00 
+  cmd->eargv[argc] = 0;
+     ccb:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     cd2:	00 
+  return ret;
+}
+     cd3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     cd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd9:	5b                   	pop    %ebx
+     cda:	5e                   	pop    %esi
+     cdb:	5f                   	pop    %edi
+     cdc:	5d                   	pop    %ebp
+     cdd:	c3                   	ret
+     cde:	66 90                	xchg   %ax,%ax
+    return parseblock(ps, es);
+     ce0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     ce3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ce9:	5b                   	pop    %ebx
+     cea:	5e                   	pop    %esi
+     ceb:	5f                   	pop    %edi
+     cec:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     ced:	e9 be 01 00 00       	jmp    eb0 <parseblock>
+     cf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	68 2e 20 00 00       	push   $0x202e
+     d00:	68 6e 20 00 00       	push   $0x206e
+     d05:	6a 02                	push   $0x2
+     d07:	e8 04 0b 00 00       	call   1810 <printf>
+     d0c:	83 c4 10             	add    $0x10,%esp
+     d0f:	eb a5                	jmp    cb6 <parseexec+0xc6>
+     d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if (!parseerror)
+     d18:	8b 15 c0 29 00 00    	mov    0x29c0,%edx
+     d1e:	85 d2                	test   %edx,%edx
+     d20:	75 94                	jne    cb6 <parseexec+0xc6>
+    printf(2, "%s\n", s);
+     d22:	83 ec 04             	sub    $0x4,%esp
+     d25:	68 27 20 00 00       	push   $0x2027
+     d2a:	68 6e 20 00 00       	push   $0x206e
+     d2f:	6a 02                	push   $0x2
+     d31:	e8 da 0a 00 00       	call   1810 <printf>
+     d36:	83 c4 10             	add    $0x10,%esp
+  parseerror = 1;
+     d39:	e9 78 ff ff ff       	jmp    cb6 <parseexec+0xc6>
+     d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <parsepipe>:
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	53                   	push   %ebx
+     d46:	83 ec 14             	sub    $0x14,%esp
+     d49:	8b 75 08             	mov    0x8(%ebp),%esi
+     d4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     d4f:	57                   	push   %edi
+     d50:	56                   	push   %esi
+     d51:	e8 9a fe ff ff       	call   bf0 <parseexec>
+  if (peek(ps, es, "|"))
+     d56:	83 c4 0c             	add    $0xc,%esp
+     d59:	68 41 20 00 00       	push   $0x2041
+  cmd = parseexec(ps, es);
+     d5e:	89 c3                	mov    %eax,%ebx
+  if (peek(ps, es, "|"))
+     d60:	57                   	push   %edi
+     d61:	56                   	push   %esi
+     d62:	e8 69 fc ff ff       	call   9d0 <peek>
+     d67:	83 c4 10             	add    $0x10,%esp
+     d6a:	85 c0                	test   %eax,%eax
+     d6c:	75 12                	jne    d80 <parsepipe+0x40>
+}
+     d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d71:	89 d8                	mov    %ebx,%eax
+     d73:	5b                   	pop    %ebx
+     d74:	5e                   	pop    %esi
+     d75:	5f                   	pop    %edi
+     d76:	5d                   	pop    %ebp
+     d77:	c3                   	ret
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     d80:	6a 00                	push   $0x0
+     d82:	6a 00                	push   $0x0
+     d84:	57                   	push   %edi
+     d85:	56                   	push   %esi
+     d86:	e8 d5 fa ff ff       	call   860 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     d8b:	58                   	pop    %eax
+     d8c:	5a                   	pop    %edx
+     d8d:	57                   	push   %edi
+     d8e:	56                   	push   %esi
+     d8f:	e8 ac ff ff ff       	call   d40 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     d94:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     d9b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     d9d:	e8 5e 10 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     da2:	83 c4 0c             	add    $0xc,%esp
+     da5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     da7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     da9:	6a 00                	push   $0x0
+     dab:	50                   	push   %eax
+     dac:	e8 bf 04 00 00       	call   1270 <memset>
+  cmd->left = left;
+     db1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     db4:	83 c4 10             	add    $0x10,%esp
+     db7:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     db9:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     dbf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     dc1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     dc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dc7:	5b                   	pop    %ebx
+     dc8:	5e                   	pop    %esi
+     dc9:	5f                   	pop    %edi
+     dca:	5d                   	pop    %ebp
+     dcb:	c3                   	ret
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <parseline>:
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	57                   	push   %edi
+     dd4:	56                   	push   %esi
+     dd5:	53                   	push   %ebx
+     dd6:	83 ec 24             	sub    $0x24,%esp
+     dd9:	8b 75 08             	mov    0x8(%ebp),%esi
+     ddc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     ddf:	57                   	push   %edi
+     de0:	56                   	push   %esi
+     de1:	e8 5a ff ff ff       	call   d40 <parsepipe>
+  while (peek(ps, es, "&"))
+     de6:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     de9:	89 c3                	mov    %eax,%ebx
+  while (peek(ps, es, "&"))
+     deb:	eb 3b                	jmp    e28 <parseline+0x58>
+     ded:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     df0:	6a 00                	push   $0x0
+     df2:	6a 00                	push   $0x0
+     df4:	57                   	push   %edi
+     df5:	56                   	push   %esi
+     df6:	e8 65 fa ff ff       	call   860 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     dfb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     e02:	e8 f9 0f 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     e07:	83 c4 0c             	add    $0xc,%esp
+     e0a:	6a 08                	push   $0x8
+     e0c:	6a 00                	push   $0x0
+     e0e:	50                   	push   %eax
+     e0f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     e12:	e8 59 04 00 00       	call   1270 <memset>
+  cmd->type = BACK;
+     e17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     e1a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     e1d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     e23:	89 5a 04             	mov    %ebx,0x4(%edx)
+     e26:	89 d3                	mov    %edx,%ebx
+  while (peek(ps, es, "&"))
+     e28:	83 ec 04             	sub    $0x4,%esp
+     e2b:	68 43 20 00 00       	push   $0x2043
+     e30:	57                   	push   %edi
+     e31:	56                   	push   %esi
+     e32:	e8 99 fb ff ff       	call   9d0 <peek>
+     e37:	83 c4 10             	add    $0x10,%esp
+     e3a:	85 c0                	test   %eax,%eax
+     e3c:	75 b2                	jne    df0 <parseline+0x20>
+  if (peek(ps, es, ";"))
+     e3e:	83 ec 04             	sub    $0x4,%esp
+     e41:	68 3f 20 00 00       	push   $0x203f
+     e46:	57                   	push   %edi
+     e47:	56                   	push   %esi
+     e48:	e8 83 fb ff ff       	call   9d0 <peek>
+     e4d:	83 c4 10             	add    $0x10,%esp
+     e50:	85 c0                	test   %eax,%eax
+     e52:	75 0c                	jne    e60 <parseline+0x90>
+}
+     e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e57:	89 d8                	mov    %ebx,%eax
+     e59:	5b                   	pop    %ebx
+     e5a:	5e                   	pop    %esi
+     e5b:	5f                   	pop    %edi
+     e5c:	5d                   	pop    %ebp
+     e5d:	c3                   	ret
+     e5e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     e60:	6a 00                	push   $0x0
+     e62:	6a 00                	push   $0x0
+     e64:	57                   	push   %edi
+     e65:	56                   	push   %esi
+     e66:	e8 f5 f9 ff ff       	call   860 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     e6b:	58                   	pop    %eax
+     e6c:	5a                   	pop    %edx
+     e6d:	57                   	push   %edi
+     e6e:	56                   	push   %esi
+     e6f:	e8 5c ff ff ff       	call   dd0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     e74:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     e7b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     e7d:	e8 7e 0f 00 00       	call   1e00 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     e82:	83 c4 0c             	add    $0xc,%esp
+     e85:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     e87:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     e89:	6a 00                	push   $0x0
+     e8b:	50                   	push   %eax
+     e8c:	e8 df 03 00 00       	call   1270 <memset>
+  cmd->left = left;
+     e91:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     e94:	83 c4 10             	add    $0x10,%esp
+     e97:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     e99:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     e9f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     ea1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     ea4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ea7:	5b                   	pop    %ebx
+     ea8:	5e                   	pop    %esi
+     ea9:	5f                   	pop    %edi
+     eaa:	5d                   	pop    %ebp
+     eab:	c3                   	ret
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000eb0 <parseblock>:
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	83 ec 10             	sub    $0x10,%esp
+     eb9:	8b 75 08             	mov    0x8(%ebp),%esi
+     ebc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if (!peek(ps, es, "("))
+     ebf:	68 25 20 00 00       	push   $0x2025
+     ec4:	57                   	push   %edi
+     ec5:	56                   	push   %esi
+     ec6:	e8 05 fb ff ff       	call   9d0 <peek>
+     ecb:	83 c4 10             	add    $0x10,%esp
+     ece:	85 c0                	test   %eax,%eax
+     ed0:	0f 84 93 00 00 00    	je     f69 <parseblock+0xb9>
+  gettoken(ps, es, 0, 0);
+     ed6:	6a 00                	push   $0x0
+     ed8:	6a 00                	push   $0x0
+     eda:	57                   	push   %edi
+     edb:	56                   	push   %esi
+     edc:	e8 7f f9 ff ff       	call   860 <gettoken>
+  cmd = parseline(ps, es);
+     ee1:	5a                   	pop    %edx
+     ee2:	59                   	pop    %ecx
+     ee3:	57                   	push   %edi
+     ee4:	56                   	push   %esi
+     ee5:	e8 e6 fe ff ff       	call   dd0 <parseline>
+  if (!peek(ps, es, ")"))
+     eea:	83 c4 0c             	add    $0xc,%esp
+     eed:	68 61 20 00 00       	push   $0x2061
+  cmd = parseline(ps, es);
+     ef2:	89 c3                	mov    %eax,%ebx
+  if (!peek(ps, es, ")"))
+     ef4:	57                   	push   %edi
+     ef5:	56                   	push   %esi
+     ef6:	e8 d5 fa ff ff       	call   9d0 <peek>
+     efb:	83 c4 10             	add    $0x10,%esp
+     efe:	85 c0                	test   %eax,%eax
+     f00:	74 2e                	je     f30 <parseblock+0x80>
+  gettoken(ps, es, 0, 0);
+     f02:	6a 00                	push   $0x0
+     f04:	6a 00                	push   $0x0
+     f06:	57                   	push   %edi
+     f07:	56                   	push   %esi
+     f08:	e8 53 f9 ff ff       	call   860 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     f0d:	83 c4 0c             	add    $0xc,%esp
+     f10:	57                   	push   %edi
+     f11:	56                   	push   %esi
+     f12:	53                   	push   %ebx
+     f13:	e8 78 fb ff ff       	call   a90 <parseredirs>
+  return cmd;
+     f18:	83 c4 10             	add    $0x10,%esp
+}
+     f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  cmd = parseredirs(cmd, ps, es);
+     f1e:	89 c3                	mov    %eax,%ebx
+}
+     f20:	89 d8                	mov    %ebx,%eax
+     f22:	5b                   	pop    %ebx
+     f23:	5e                   	pop    %esi
+     f24:	5f                   	pop    %edi
+     f25:	5d                   	pop    %ebp
+     f26:	c3                   	ret
+     f27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2e:	66 90                	xchg   %ax,%ax
+  if (!parseerror)
+     f30:	a1 c0 29 00 00       	mov    0x29c0,%eax
+     f35:	85 c0                	test   %eax,%eax
+     f37:	74 17                	je     f50 <parseblock+0xa0>
+  parseerror = 1;
+     f39:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+     f40:	00 00 00 
+}
+     f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f46:	89 d8                	mov    %ebx,%eax
+     f48:	5b                   	pop    %ebx
+     f49:	5e                   	pop    %esi
+     f4a:	5f                   	pop    %edi
+     f4b:	5d                   	pop    %ebp
+     f4c:	c3                   	ret
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     f50:	83 ec 04             	sub    $0x4,%esp
+     f53:	68 50 20 00 00       	push   $0x2050
+     f58:	68 6e 20 00 00       	push   $0x206e
+     f5d:	6a 02                	push   $0x2
+     f5f:	e8 ac 08 00 00       	call   1810 <printf>
+     f64:	83 c4 10             	add    $0x10,%esp
+     f67:	eb d0                	jmp    f39 <parseblock+0x89>
+    panic("parseblock");
+     f69:	83 ec 0c             	sub    $0xc,%esp
+     f6c:	68 45 20 00 00       	push   $0x2045
+     f71:	e8 8a f3 ff ff       	call   300 <panic>
+     f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f80 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd *
+nulterminate(struct cmd *cmd)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	83 ec 04             	sub    $0x4,%esp
+     f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if (cmd == 0)
+     f8a:	85 db                	test   %ebx,%ebx
+     f8c:	0f 84 7e 00 00 00    	je     1010 <nulterminate+0x90>
+    return 0;
+
+  switch (cmd->type)
+     f92:	83 3b 05             	cmpl   $0x5,(%ebx)
+     f95:	77 20                	ja     fb7 <nulterminate+0x37>
+     f97:	8b 03                	mov    (%ebx),%eax
+     f99:	ff 24 85 b0 20 00 00 	jmp    *0x20b0(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd *)cmd;
+    nulterminate(lcmd->left);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	ff 73 04             	push   0x4(%ebx)
+     fa6:	e8 d5 ff ff ff       	call   f80 <nulterminate>
+    nulterminate(lcmd->right);
+     fab:	58                   	pop    %eax
+     fac:	ff 73 08             	push   0x8(%ebx)
+     faf:	e8 cc ff ff ff       	call   f80 <nulterminate>
+    break;
+     fb4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     fb7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd *)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     fb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fbc:	c9                   	leave
+     fbd:	c3                   	ret
+     fbe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	ff 73 04             	push   0x4(%ebx)
+     fc6:	e8 b5 ff ff ff       	call   f80 <nulterminate>
+    break;
+     fcb:	83 c4 10             	add    $0x10,%esp
+     fce:	eb e7                	jmp    fb7 <nulterminate+0x37>
+    for (i = 0; ecmd->argv[i]; i++)
+     fd0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     fd3:	8d 43 08             	lea    0x8(%ebx),%eax
+     fd6:	85 c9                	test   %ecx,%ecx
+     fd8:	74 dd                	je     fb7 <nulterminate+0x37>
+     fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     fe0:	8b 50 24             	mov    0x24(%eax),%edx
+    for (i = 0; ecmd->argv[i]; i++)
+     fe3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     fe6:	c6 02 00             	movb   $0x0,(%edx)
+    for (i = 0; ecmd->argv[i]; i++)
+     fe9:	8b 50 fc             	mov    -0x4(%eax),%edx
+     fec:	85 d2                	test   %edx,%edx
+     fee:	75 f0                	jne    fe0 <nulterminate+0x60>
+     ff0:	eb c5                	jmp    fb7 <nulterminate+0x37>
+     ff2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     ff8:	83 ec 0c             	sub    $0xc,%esp
+     ffb:	ff 73 04             	push   0x4(%ebx)
+     ffe:	e8 7d ff ff ff       	call   f80 <nulterminate>
+    *rcmd->efile = 0;
+    1003:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+    1006:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    1009:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    100c:	eb a9                	jmp    fb7 <nulterminate+0x37>
+    100e:	66 90                	xchg   %ax,%ax
+    return 0;
+    1010:	31 c0                	xor    %eax,%eax
+    1012:	eb a5                	jmp    fb9 <nulterminate+0x39>
+    1014:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <parsecmd>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+    1026:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+    1029:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  parseerror = 0;
+    102c:	c7 05 c0 29 00 00 00 	movl   $0x0,0x29c0
+    1033:	00 00 00 
+  es = s + strlen(s);
+    1036:	53                   	push   %ebx
+    1037:	e8 04 02 00 00       	call   1240 <strlen>
+  cmd = parseline(&s, es);
+    103c:	5e                   	pop    %esi
+    103d:	5f                   	pop    %edi
+    103e:	8d 7d 08             	lea    0x8(%ebp),%edi
+  es = s + strlen(s);
+    1041:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+    1043:	53                   	push   %ebx
+    1044:	57                   	push   %edi
+    1045:	e8 86 fd ff ff       	call   dd0 <parseline>
+  peek(&s, es, "");
+    104a:	83 c4 0c             	add    $0xc,%esp
+    104d:	68 cd 1f 00 00       	push   $0x1fcd
+  cmd = parseline(&s, es);
+    1052:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    1054:	53                   	push   %ebx
+    1055:	57                   	push   %edi
+    1056:	e8 75 f9 ff ff       	call   9d0 <peek>
+  if (s != es && !parseerror)
+    105b:	8b 45 08             	mov    0x8(%ebp),%eax
+    105e:	83 c4 10             	add    $0x10,%esp
+    1061:	39 d8                	cmp    %ebx,%eax
+    1063:	74 4b                	je     10b0 <parsecmd+0x90>
+    1065:	8b 0d c0 29 00 00    	mov    0x29c0,%ecx
+    106b:	85 c9                	test   %ecx,%ecx
+    106d:	75 27                	jne    1096 <parsecmd+0x76>
+    printf(2, "leftovers: %s\n", s);
+    106f:	83 ec 04             	sub    $0x4,%esp
+    1072:	50                   	push   %eax
+    1073:	68 63 20 00 00       	push   $0x2063
+    1078:	6a 02                	push   $0x2
+    107a:	e8 91 07 00 00       	call   1810 <printf>
+  if (!parseerror)
+    107f:	8b 15 c0 29 00 00    	mov    0x29c0,%edx
+    1085:	83 c4 10             	add    $0x10,%esp
+    1088:	85 d2                	test   %edx,%edx
+    108a:	74 44                	je     10d0 <parsecmd+0xb0>
+  parseerror = 1;
+    108c:	c7 05 c0 29 00 00 01 	movl   $0x1,0x29c0
+    1093:	00 00 00 
+    freecmd(cmd);
+    1096:	83 ec 0c             	sub    $0xc,%esp
+    1099:	56                   	push   %esi
+    return 0;
+    109a:	31 f6                	xor    %esi,%esi
+    freecmd(cmd);
+    109c:	e8 9f f1 ff ff       	call   240 <freecmd>
+    return 0;
+    10a1:	83 c4 10             	add    $0x10,%esp
+}
+    10a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10a7:	89 f0                	mov    %esi,%eax
+    10a9:	5b                   	pop    %ebx
+    10aa:	5e                   	pop    %esi
+    10ab:	5f                   	pop    %edi
+    10ac:	5d                   	pop    %ebp
+    10ad:	c3                   	ret
+    10ae:	66 90                	xchg   %ax,%ax
+  if (parseerror)
+    10b0:	a1 c0 29 00 00       	mov    0x29c0,%eax
+    10b5:	85 c0                	test   %eax,%eax
+    10b7:	75 dd                	jne    1096 <parsecmd+0x76>
+  nulterminate(cmd);
+    10b9:	83 ec 0c             	sub    $0xc,%esp
+    10bc:	56                   	push   %esi
+    10bd:	e8 be fe ff ff       	call   f80 <nulterminate>
+  return cmd;
+    10c2:	83 c4 10             	add    $0x10,%esp
+}
+    10c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10c8:	89 f0                	mov    %esi,%eax
+    10ca:	5b                   	pop    %ebx
+    10cb:	5e                   	pop    %esi
+    10cc:	5f                   	pop    %edi
+    10cd:	5d                   	pop    %ebp
+    10ce:	c3                   	ret
+    10cf:	90                   	nop
+    printf(2, "%s\n", s);
+    10d0:	83 ec 04             	sub    $0x4,%esp
+    10d3:	68 27 20 00 00       	push   $0x2027
+    10d8:	68 6e 20 00 00       	push   $0x206e
+    10dd:	6a 02                	push   $0x2
+    10df:	e8 2c 07 00 00       	call   1810 <printf>
+    10e4:	83 c4 10             	add    $0x10,%esp
+    10e7:	eb a3                	jmp    108c <parsecmd+0x6c>
+    10e9:	66 90                	xchg   %ax,%ax
+    10eb:	66 90                	xchg   %ax,%ax
+    10ed:	66 90                	xchg   %ax,%ax
+    10ef:	90                   	nop
+
+000010f0 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+    10f0:	a1 60 2a 00 00       	mov    0x2a60,%eax
+    10f5:	85 c0                	test   %eax,%eax
+    10f7:	74 17                	je     1110 <fork+0x20>
+{
+    10f9:	55                   	push   %ebp
+    10fa:	89 e5                	mov    %esp,%ebp
+    10fc:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+    10ff:	ff d0                	call   *%eax
+  return _fork();
+}
+    1101:	c9                   	leave
+  return _fork();
+    1102:	e9 84 03 00 00       	jmp    148b <_fork>
+    1107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110e:	66 90                	xchg   %ax,%ax
+    1110:	e9 76 03 00 00       	jmp    148b <_fork>
+    1115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001120 <exit>:
+
+int
+exit(void)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+    1126:	a1 60 2a 00 00       	mov    0x2a60,%eax
+    112b:	85 c0                	test   %eax,%eax
+    112d:	74 02                	je     1131 <exit+0x11>
+    stdioflush();
+    112f:	ff d0                	call   *%eax
+  _exit();
+    1131:	e8 5d 03 00 00       	call   1493 <_exit>
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001140 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    1140:	55                   	push   %ebp
+  if(stdioflush)
+    1141:	a1 60 2a 00 00       	mov    0x2a60,%eax
+{
+    1146:	89 e5                	mov    %esp,%ebp
+    1148:	56                   	push   %esi
+    1149:	53                   	push   %ebx
+    114a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    114d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+    1150:	85 c0                	test   %eax,%eax
+    1152:	74 02                	je     1156 <exec+0x16>
+    stdioflush();
+    1154:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    1156:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1159:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    115c:	5b                   	pop    %ebx
+    115d:	5e                   	pop    %esi
+    115e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    115f:	e9 67 03 00 00       	jmp    14cb <_exec>
+    1164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    116b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+
+00001170 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+    1170:	55                   	push   %ebp
+    1171:	89 e5                	mov    %esp,%ebp
+    1173:	57                   	push   %edi
+    1174:	56                   	push   %esi
+    1175:	53                   	push   %ebx
+    1176:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+    1179:	a1 60 2a 00 00       	mov    0x2a60,%eax
+{
+    117e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1181:	8b 75 0c             	mov    0xc(%ebp),%esi
+    1184:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+    1187:	85 c0                	test   %eax,%eax
+    1189:	74 02                	je     118d <spawn+0x1d>
+    stdioflush();
+    118b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+    118d:	89 7d 10             	mov    %edi,0x10(%ebp)
+    1190:	89 75 0c             	mov    %esi,0xc(%ebp)
+    1193:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    1196:	83 c4 0c             	add    $0xc,%esp
+    1199:	5b                   	pop    %ebx
+    119a:	5e                   	pop    %esi
+    119b:	5f                   	pop    %edi
+    119c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+    119d:	e9 79 04 00 00       	jmp    161b <_spawn>
+    11a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+    11b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    11b1:	31 c0                	xor    %eax,%eax
+{
+    11b3:	89 e5                	mov    %esp,%ebp
+    11b5:	53                   	push   %ebx
+    11b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    11b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    11bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    11c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    11c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    11c7:	83 c0 01             	add    $0x1,%eax
+    11ca:	84 d2                	test   %dl,%dl
+    11cc:	75 f2                	jne    11c0 <strcpy+0x10>
+    ;
+  return os;
+}
+    11ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11d1:	89 c8                	mov    %ecx,%eax
+    11d3:	c9                   	leave
+    11d4:	c3                   	ret
+    11d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	53                   	push   %ebx
+    11e4:	8b 55 08             	mov    0x8(%ebp),%edx
+    11e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    11ea:	0f b6 02             	movzbl (%edx),%eax
+    11ed:	84 c0                	test   %al,%al
+    11ef:	75 17                	jne    1208 <strcmp+0x28>
+    11f1:	eb 3a                	jmp    122d <strcmp+0x4d>
+    11f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11f7:	90                   	nop
+    11f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    11fc:	83 c2 01             	add    $0x1,%edx
+    11ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1202:	84 c0                	test   %al,%al
+    1204:	74 1a                	je     1220 <strcmp+0x40>
+    p++, q++;
+    1206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1208:	0f b6 19             	movzbl (%ecx),%ebx
+    120b:	38 c3                	cmp    %al,%bl
+    120d:	74 e9                	je     11f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    120f:	29 d8                	sub    %ebx,%eax
+}
+    1211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1214:	c9                   	leave
+    1215:	c3                   	ret
+    1216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1224:	31 c0                	xor    %eax,%eax
+    1226:	29 d8                	sub    %ebx,%eax
+}
+    1228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    122b:	c9                   	leave
+    122c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    122d:	0f b6 19             	movzbl (%ecx),%ebx
+    1230:	31 c0                	xor    %eax,%eax
+    1232:	eb db                	jmp    120f <strcmp+0x2f>
+    1234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+
+00001240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1246:	80 3a 00             	cmpb   $0x0,(%edx)
+    1249:	74 15                	je     1260 <strlen+0x20>
+    124b:	31 c0                	xor    %eax,%eax
+    124d:	8d 76 00             	lea    0x0(%esi),%esi
+    1250:	83 c0 01             	add    $0x1,%eax
+    1253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1257:	89 c1                	mov    %eax,%ecx
+    1259:	75 f5                	jne    1250 <strlen+0x10>
+    ;
+  return n;
+}
+    125b:	89 c8                	mov    %ecx,%eax
+    125d:	5d                   	pop    %ebp
+    125e:	c3                   	ret
+    125f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1260:	31 c9                	xor    %ecx,%ecx
+}
+    1262:	5d                   	pop    %ebp
+    1263:	89 c8                	mov    %ecx,%eax
+    1265:	c3                   	ret
+    1266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    126d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+    1273:	57                   	push   %edi
+    1274:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    127a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    127d:	89 d7                	mov    %edx,%edi
+    127f:	fc                   	cld
+    1280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1285:	89 d0                	mov    %edx,%eax
+    1287:	c9                   	leave
+    1288:	c3                   	ret
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	8b 45 08             	mov    0x8(%ebp),%eax
+    1296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    129a:	0f b6 10             	movzbl (%eax),%edx
+    129d:	84 d2                	test   %dl,%dl
+    129f:	75 12                	jne    12b3 <strchr+0x23>
+    12a1:	eb 1d                	jmp    12c0 <strchr+0x30>
+    12a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12a7:	90                   	nop
+    12a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    12ac:	83 c0 01             	add    $0x1,%eax
+    12af:	84 d2                	test   %dl,%dl
+    12b1:	74 0d                	je     12c0 <strchr+0x30>
+    if(*s == c)
+    12b3:	38 d1                	cmp    %dl,%cl
+    12b5:	75 f1                	jne    12a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    12b7:	5d                   	pop    %ebp
+    12b8:	c3                   	ret
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    12c0:	31 c0                	xor    %eax,%eax
+}
+    12c2:	5d                   	pop    %ebp
+    12c3:	c3                   	ret
+    12c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+
+000012d0 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+    12d9:	a1 60 2a 00 00       	mov    0x2a60,%eax
+{
+    12de:	8b 75 08             	mov    0x8(%ebp),%esi
+    12e1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+    12e4:	85 c0                	test   %eax,%eax
+    12e6:	74 02                	je     12ea <gets+0x1a>
+    stdioflush();
+    12e8:	ff d0                	call   *%eax
+  if(in.size == 0)
+    12ea:	a1 88 2c 00 00       	mov    0x2c88,%eax
+    12ef:	85 c0                	test   %eax,%eax
+    12f1:	0f 84 99 00 00 00    	je     1390 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    12f7:	31 db                	xor    %ebx,%ebx
+    12f9:	eb 21                	jmp    131c <gets+0x4c>
+    12fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+    1300:	8d 50 01             	lea    0x1(%eax),%edx
+    1303:	0f b6 80 80 2a 00 00 	movzbl 0x2a80(%eax),%eax
+    130a:	89 15 80 2c 00 00    	mov    %edx,0x2c80
+    buf[i++] = c;
+    1310:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    1314:	3c 0a                	cmp    $0xa,%al
+    1316:	74 60                	je     1378 <gets+0xa8>
+    1318:	3c 0d                	cmp    $0xd,%al
+    131a:	74 5c                	je     1378 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+    131c:	89 da                	mov    %ebx,%edx
+    131e:	83 c3 01             	add    $0x1,%ebx
+    1321:	39 fb                	cmp    %edi,%ebx
+    1323:	7d 55                	jge    137a <gets+0xaa>
+    if(in.r == in.n){
+    1325:	a1 80 2c 00 00       	mov    0x2c80,%eax
+    132a:	3b 05 84 2c 00 00    	cmp    0x2c84,%eax
+    1330:	75 ce                	jne    1300 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    1332:	83 ec 04             	sub    $0x4,%esp
+    1335:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+    1338:	c7 05 84 2c 00 00 00 	movl   $0x0,0x2c84
+    133f:	00 00 00 
+    1342:	c7 05 80 2c 00 00 00 	movl   $0x0,0x2c80
+    1349:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    134c:	ff 35 88 2c 00 00    	push   0x2c88
+    1352:	68 80 2a 00 00       	push   $0x2a80
+    1357:	6a 00                	push   $0x0
+    1359:	e8 4d 01 00 00       	call   14ab <read>
+    135e:	83 c4 10             	add    $0x10,%esp
+    1361:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    1364:	85 c0                	test   %eax,%eax
+    1366:	a3 84 2c 00 00       	mov    %eax,0x2c84
+    136b:	7e 56                	jle    13c3 <gets+0xf3>
+    c = in.buf[in.r++];
+    136d:	a1 80 2c 00 00       	mov    0x2c80,%eax
+    1372:	eb 8c                	jmp    1300 <gets+0x30>
+    1374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+    1378:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+    137a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+    137e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1381:	89 f0                	mov    %esi,%eax
+    1383:	5b                   	pop    %ebx
+    1384:	5e                   	pop    %esi
+    1385:	5f                   	pop    %edi
+    1386:	5d                   	pop    %ebp
+    1387:	c3                   	ret
+    1388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    1390:	83 ec 08             	sub    $0x8,%esp
+    1393:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    1396:	50                   	push   %eax
+    1397:	6a 00                	push   $0x0
+    1399:	e8 4d 01 00 00       	call   14eb <fstat>
+    139e:	83 c4 10             	add    $0x10,%esp
+    13a1:	89 c2                	mov    %eax,%edx
+    13a3:	b8 01 00 00 00       	mov    $0x1,%eax
+    13a8:	85 d2                	test   %edx,%edx
+    13aa:	75 0d                	jne    13b9 <gets+0xe9>
+    13ac:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    13b1:	ba 00 02 00 00       	mov    $0x200,%edx
+    13b6:	0f 44 c2             	cmove  %edx,%eax
+    13b9:	a3 88 2c 00 00       	mov    %eax,0x2c88
+    13be:	e9 34 ff ff ff       	jmp    12f7 <gets+0x27>
+        in.n = 0;
+    13c3:	c7 05 84 2c 00 00 00 	movl   $0x0,0x2c84
+    13ca:	00 00 00 
+        break;
+    13cd:	eb ab                	jmp    137a <gets+0xaa>
+    13cf:	90                   	nop
+
+000013d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	56                   	push   %esi
+    13d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    13d5:	83 ec 08             	sub    $0x8,%esp
+    13d8:	6a 00                	push   $0x0
+    13da:	ff 75 08             	push   0x8(%ebp)
+    13dd:	e8 f1 00 00 00       	call   14d3 <open>
+  if(fd < 0)
+    13e2:	83 c4 10             	add    $0x10,%esp
+    13e5:	85 c0                	test   %eax,%eax
+    13e7:	78 27                	js     1410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    13e9:	83 ec 08             	sub    $0x8,%esp
+    13ec:	ff 75 0c             	push   0xc(%ebp)
+    13ef:	89 c3                	mov    %eax,%ebx
+    13f1:	50                   	push   %eax
+    13f2:	e8 f4 00 00 00       	call   14eb <fstat>
+  close(fd);
+    13f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    13fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+    13fc:	e8 ba 00 00 00       	call   14bb <close>
+  return r;
+    1401:	83 c4 10             	add    $0x10,%esp
+}
+    1404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1407:	89 f0                	mov    %esi,%eax
+    1409:	5b                   	pop    %ebx
+    140a:	5e                   	pop    %esi
+    140b:	5d                   	pop    %ebp
+    140c:	c3                   	ret
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1415:	eb ed                	jmp    1404 <stat+0x34>
+    1417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141e:	66 90                	xchg   %ax,%ax
+
+00001420 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	53                   	push   %ebx
+    1424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1427:	0f be 02             	movsbl (%edx),%eax
+    142a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    142d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1435:	77 1e                	ja     1455 <atoi+0x35>
+    1437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1440:	83 c2 01             	add    $0x1,%edx
+    1443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    144a:	0f be 02             	movsbl (%edx),%eax
+    144d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1450:	80 fb 09             	cmp    $0x9,%bl
+    1453:	76 eb                	jbe    1440 <atoi+0x20>
+  return n;
+}
+    1455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1458:	89 c8                	mov    %ecx,%eax
+    145a:	c9                   	leave
+    145b:	c3                   	ret
+    145c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	57                   	push   %edi
+    1464:	56                   	push   %esi
+    1465:	8b 45 10             	mov    0x10(%ebp),%eax
+    1468:	8b 55 08             	mov    0x8(%ebp),%edx
+    146b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    146e:	85 c0                	test   %eax,%eax
+    1470:	7e 13                	jle    1485 <memmove+0x25>
+    1472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1474:	89 d7                	mov    %edx,%edi
+    1476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1481:	39 f8                	cmp    %edi,%eax
+    1483:	75 fb                	jne    1480 <memmove+0x20>
+  return vdst;
+}
+    1485:	5e                   	pop    %esi
+    1486:	89 d0                	mov    %edx,%eax
+    1488:	5f                   	pop    %edi
+    1489:	5d                   	pop    %ebp
+    148a:	c3                   	ret
+
+0000148b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    148b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1490:	cd 40                	int    $0x40
+    1492:	c3                   	ret
+
+00001493 <_exit>:
+RAWSYSCALL(exit)
+    1493:	b8 02 00 00 00       	mov    $0x2,%eax
+    1498:	cd 40                	int    $0x40
+    149a:	c3                   	ret
+
+0000149b <wait>:
+SYSCALL(wait)
+    149b:	b8 03 00 00 00       	mov    $0x3,%eax
+    14a0:	cd 40                	int    $0x40
+    14a2:	c3                   	ret
+
+000014a3 <pipe>:
+SYSCALL(pipe)
+    14a3:	b8 04 00 00 00       	mov    $0x4,%eax
+    14a8:	cd 40                	int    $0x40
+    14aa:	c3                   	ret
+
+000014ab <read>:
+SYSCALL(read)
+    14ab:	b8 05 00 00 00       	mov    $0x5,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <write>:
+SYSCALL(write)
+    14b3:	b8 10 00 00 00       	mov    $0x10,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <close>:
+SYSCALL(close)
+    14bb:	b8 15 00 00 00       	mov    $0x15,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <kill>:
+SYSCALL(kill)
+    14c3:	b8 06 00 00 00       	mov    $0x6,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <_exec>:
+RAWSYSCALL(exec)
+    14cb:	b8 07 00 00 00       	mov    $0x7,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <open>:
+SYSCALL(open)
+    14d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <mknod>:
+SYSCALL(mknod)
+    14db:	b8 11 00 00 00       	mov    $0x11,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <unlink>:
+SYSCALL(unlink)
+    14e3:	b8 12 00 00 00       	mov    $0x12,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <fstat>:
+SYSCALL(fstat)
+    14eb:	b8 08 00 00 00       	mov    $0x8,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <link>:
+SYSCALL(link)
+    14f3:	b8 13 00 00 00       	mov    $0x13,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <mkdir>:
+SYSCALL(mkdir)
+    14fb:	b8 14 00 00 00       	mov    $0x14,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <chdir>:
+SYSCALL(chdir)
+    1503:	b8 09 00 00 00       	mov    $0x9,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <dup>:
+SYSCALL(dup)
+    150b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <getpid>:
+SYSCALL(getpid)
+    1513:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <sbrk>:
+SYSCALL(sbrk)
+    151b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <sleep>:
+SYSCALL(sleep)
+    1523:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <uptime>:
+SYSCALL(uptime)
+    152b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+    1533:	b8 16 00 00 00       	mov    $0x16,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <get_parent_id>:
+SYSCALL(get_parent_id)
+    153b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <get_children>:
+SYSCALL(get_children)
+    1543:	b8 18 00 00 00       	mov    $0x18,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <set_path>:
+SYSCALL(set_path)
+    154b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <set_sleep>:
+SYSCALL(set_sleep)
+    1553:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <get_time>:
+SYSCALL(get_time)
+    155b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <change_process_level>:
+SYSCALL(change_process_level)
+    1563:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+
+0000156b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+    156b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1570:	cd 40                	int    $0x40
+    1572:	c3                   	ret
+
+00001573 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+    1573:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1578:	cd 40                	int    $0x40
+    157a:	c3                   	ret
+
+0000157b <print_processes_info>:
+SYSCALL(print_processes_info)
+    157b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <barrier_init>:
+
+SYSCALL(barrier_init)
+    1583:	b8 20 00 00 00       	mov    $0x20,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <barrier_wait>:
+SYSCALL(barrier_wait)
+    158b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+    1593:	b8 22 00 00 00       	mov    $0x22,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+    159b:	b8 23 00 00 00       	mov    $0x23,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <set_process_gang>:
+SYSCALL(set_process_gang)
+    15a3:	b8 24 00 00 00       	mov    $0x24,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+    15ab:	b8 25 00 00 00       	mov    $0x25,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+
+000015b3 <sem_create>:
+SYSCALL(sem_create)
+    15b3:	b8 26 00 00 00       	mov    $0x26,%eax
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <event_create>:
+SYSCALL(event_create)
+    15bb:	b8 27 00 00 00       	mov    $0x27,%eax
+    15c0:	cd 40                	int    $0x40
+    15c2:	c3                   	ret
+
+000015c3 <sync_post>:
+SYSCALL(sync_post)
+    15c3:	b8 28 00 00 00       	mov    $0x28,%eax
+    15c8:	cd 40                	int    $0x40
+    15ca:	c3                   	ret
+
+000015cb <sync_wait>:
+SYSCALL(sync_wait)
+    15cb:	b8 29 00 00 00       	mov    $0x29,%eax
+    15d0:	cd 40                	int    $0x40
+    15d2:	c3                   	ret
+
+000015d3 <sync_close>:
+SYSCALL(sync_close)
+    15d3:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    15d8:	cd 40                	int    $0x40
+    15da:	c3                   	ret
+
+000015db <event_reset>:
+SYSCALL(event_reset)
+    15db:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    15e0:	cd 40                	int    $0x40
+    15e2:	c3                   	ret
+
+000015e3 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+    15e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    15e8:	cd 40                	int    $0x40
+    15ea:	c3                   	ret
+
+000015eb <mmap>:
+SYSCALL(mmap)
+    15eb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    15f0:	cd 40                	int    $0x40
+    15f2:	c3                   	ret
+
+000015f3 <munmap>:
+SYSCALL(munmap)
+    15f3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    15f8:	cd 40                	int    $0x40
+    15fa:	c3                   	ret
+
+000015fb <shmget>:
+SYSCALL(shmget)
+    15fb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    1600:	cd 40                	int    $0x40
+    1602:	c3                   	ret
+
+00001603 <shmat>:
+SYSCALL(shmat)
+    1603:	b8 30 00 00 00       	mov    $0x30,%eax
+    1608:	cd 40                	int    $0x40
+    160a:	c3                   	ret
+
+0000160b <shmdt>:
+SYSCALL(shmdt)
+    160b:	b8 31 00 00 00       	mov    $0x31,%eax
+    1610:	cd 40                	int    $0x40
+    1612:	c3                   	ret
+
+00001613 <shmrm>:
+SYSCALL(shmrm)
+    1613:	b8 32 00 00 00       	mov    $0x32,%eax
+    1618:	cd 40                	int    $0x40
+    161a:	c3                   	ret
+
+0000161b <_spawn>:
+RAWSYSCALL(spawn)
+    161b:	b8 33 00 00 00       	mov    $0x33,%eax
+    1620:	cd 40                	int    $0x40
+    1622:	c3                   	ret
+
+00001623 <memstat>:
+SYSCALL(memstat)
+    1623:	b8 34 00 00 00       	mov    $0x34,%eax
+    1628:	cd 40                	int    $0x40
+    162a:	c3                   	ret
+    162b:	66 90                	xchg   %ax,%ax
+    162d:	66 90                	xchg   %ax,%ax
+    162f:	90                   	nop
+
+00001630 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+    1630:	55                   	push   %ebp
+    1631:	89 e5                	mov    %esp,%ebp
+    1633:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+    1636:	a1 c8 2e 00 00       	mov    0x2ec8,%eax
+    163b:	85 c0                	test   %eax,%eax
+    163d:	7e 17                	jle    1656 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+    163f:	83 ec 04             	sub    $0x4,%esp
+    1642:	50                   	push   %eax
+    1643:	68 cc 2e 00 00       	push   $0x2ecc
+    1648:	ff 35 c0 2e 00 00    	push   0x2ec0
+    164e:	e8 60 fe ff ff       	call   14b3 <write>
+    1653:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    1656:	c7 05 c8 2e 00 00 00 	movl   $0x0,0x2ec8
+    165d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+    1660:	c7 05 c4 2e 00 00 00 	movl   $0x0,0x2ec4
+    1667:	00 00 00 
+}
+    166a:	c9                   	leave
+    166b:	c3                   	ret
+    166c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001670 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+    1670:	55                   	push   %ebp
+    1671:	89 e5                	mov    %esp,%ebp
+    1673:	57                   	push   %edi
+    1674:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1676:	89 d1                	mov    %edx,%ecx
+{
+    1678:	56                   	push   %esi
+    1679:	53                   	push   %ebx
+    167a:	89 c3                	mov    %eax,%ebx
+    167c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+    167f:	85 d2                	test   %edx,%edx
+    1681:	0f 89 b9 00 00 00    	jns    1740 <printint+0xd0>
+    1687:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    168b:	0f 84 af 00 00 00    	je     1740 <printint+0xd0>
+    x = -xx;
+    1691:	f7 d9                	neg    %ecx
+    neg = 1;
+    1693:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1698:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    169b:	31 f6                	xor    %esi,%esi
+    169d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    16a0:	89 c8                	mov    %ecx,%eax
+    16a2:	31 d2                	xor    %edx,%edx
+    16a4:	89 f3                	mov    %esi,%ebx
+    16a6:	f7 f7                	div    %edi
+    16a8:	8d 76 01             	lea    0x1(%esi),%esi
+    16ab:	0f b6 92 28 21 00 00 	movzbl 0x2128(%edx),%edx
+    16b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    16b6:	89 ca                	mov    %ecx,%edx
+    16b8:	89 c1                	mov    %eax,%ecx
+    16ba:	39 fa                	cmp    %edi,%edx
+    16bc:	73 e2                	jae    16a0 <printint+0x30>
+  if(neg)
+    16be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    16c1:	89 d9                	mov    %ebx,%ecx
+    16c3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16c6:	85 c0                	test   %eax,%eax
+    16c8:	74 07                	je     16d1 <printint+0x61>
+    buf[i++] = '-';
+    16ca:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    16cf:	89 f1                	mov    %esi,%ecx
+    16d1:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    16d4:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+    16d6:	8d 43 0c             	lea    0xc(%ebx),%eax
+    16d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    16dc:	01 f7                	add    %esi,%edi
+    16de:	eb 09                	jmp    16e9 <printint+0x79>
+
+  while(--i >= 0)
+    16e0:	8d 47 ff             	lea    -0x1(%edi),%eax
+    16e3:	39 f7                	cmp    %esi,%edi
+    16e5:	74 36                	je     171d <printint+0xad>
+    16e7:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+    16e9:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+    16ec:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+    16ef:	8d 42 01             	lea    0x1(%edx),%eax
+    16f2:	89 43 08             	mov    %eax,0x8(%ebx)
+    16f5:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    16f9:	3d 00 02 00 00       	cmp    $0x200,%eax
+    16fe:	74 28                	je     1728 <printint+0xb8>
+    1700:	80 f9 0a             	cmp    $0xa,%cl
+    1703:	75 db                	jne    16e0 <printint+0x70>
+    1705:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    1709:	75 d5                	jne    16e0 <printint+0x70>
+  if(b->n > 0)
+    170b:	85 c0                	test   %eax,%eax
+    170d:	7f 19                	jg     1728 <printint+0xb8>
+  b->n = 0;
+    170f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+    1716:	8d 47 ff             	lea    -0x1(%edi),%eax
+    1719:	39 f7                	cmp    %esi,%edi
+    171b:	75 ca                	jne    16e7 <printint+0x77>
+}
+    171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1720:	5b                   	pop    %ebx
+    1721:	5e                   	pop    %esi
+    1722:	5f                   	pop    %edi
+    1723:	5d                   	pop    %ebp
+    1724:	c3                   	ret
+    1725:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    1728:	83 ec 04             	sub    $0x4,%esp
+    172b:	50                   	push   %eax
+    172c:	ff 75 d4             	push   -0x2c(%ebp)
+    172f:	ff 33                	push   (%ebx)
+    1731:	e8 7d fd ff ff       	call   14b3 <write>
+    1736:	83 c4 10             	add    $0x10,%esp
+    1739:	eb d4                	jmp    170f <printint+0x9f>
+    173b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    173f:	90                   	nop
+  neg = 0;
+    1740:	31 c0                	xor    %eax,%eax
+    1742:	e9 51 ff ff ff       	jmp    1698 <printint+0x28>
+    1747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174e:	66 90                	xchg   %ax,%ax
+
+00001750 <putc>:
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	53                   	push   %ebx
+    1754:	89 c3                	mov    %eax,%ebx
+    1756:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+    1759:	8b 48 08             	mov    0x8(%eax),%ecx
+    175c:	8d 41 01             	lea    0x1(%ecx),%eax
+    175f:	89 43 08             	mov    %eax,0x8(%ebx)
+    1762:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    1766:	3d 00 02 00 00       	cmp    $0x200,%eax
+    176b:	74 33                	je     17a0 <putc+0x50>
+    176d:	80 fa 0a             	cmp    $0xa,%dl
+    1770:	74 0e                	je     1780 <putc+0x30>
+}
+    1772:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1775:	c9                   	leave
+    1776:	c3                   	ret
+    1777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    177e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    1780:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    1784:	75 ec                	jne    1772 <putc+0x22>
+  if(b->n > 0)
+    1786:	85 c0                	test   %eax,%eax
+    1788:	7f 16                	jg     17a0 <putc+0x50>
+  b->n = 0;
+    178a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    1791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1794:	c9                   	leave
+    1795:	c3                   	ret
+    1796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    179d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    17a0:	83 ec 04             	sub    $0x4,%esp
+    17a3:	50                   	push   %eax
+    17a4:	8d 43 0c             	lea    0xc(%ebx),%eax
+    17a7:	50                   	push   %eax
+    17a8:	ff 33                	push   (%ebx)
+    17aa:	e8 04 fd ff ff       	call   14b3 <write>
+    17af:	83 c4 10             	add    $0x10,%esp
+    17b2:	eb d6                	jmp    178a <putc+0x3a>
+    17b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17bf:	90                   	nop
+
+000017c0 <fflush>:
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+    17c6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    17ca:	74 04                	je     17d0 <fflush+0x10>
+}
+    17cc:	c9                   	leave
+    17cd:	c3                   	ret
+    17ce:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    17d0:	a1 c8 2e 00 00       	mov    0x2ec8,%eax
+    17d5:	85 c0                	test   %eax,%eax
+    17d7:	7f 17                	jg     17f0 <fflush+0x30>
+  b->n = 0;
+    17d9:	c7 05 c8 2e 00 00 00 	movl   $0x0,0x2ec8
+    17e0:	00 00 00 
+  out.mode = 0;
+    17e3:	c7 05 c4 2e 00 00 00 	movl   $0x0,0x2ec4
+    17ea:	00 00 00 
+}
+    17ed:	c9                   	leave
+    17ee:	c3                   	ret
+    17ef:	90                   	nop
+    write(b->fd, b->buf, b->n);
+    17f0:	83 ec 04             	sub    $0x4,%esp
+    17f3:	50                   	push   %eax
+    17f4:	68 cc 2e 00 00       	push   $0x2ecc
+    17f9:	ff 35 c0 2e 00 00    	push   0x2ec0
+    17ff:	e8 af fc ff ff       	call   14b3 <write>
+    1804:	83 c4 10             	add    $0x10,%esp
+    1807:	eb d0                	jmp    17d9 <fflush+0x19>
+    1809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001810 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1810:	55                   	push   %ebp
+    1811:	89 e5                	mov    %esp,%ebp
+    1813:	57                   	push   %edi
+    1814:	56                   	push   %esi
+    1815:	53                   	push   %ebx
+    1816:	83 ec 3c             	sub    $0x3c,%esp
+    1819:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    181c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+    181f:	83 fe 01             	cmp    $0x1,%esi
+    1822:	0f 84 60 01 00 00    	je     1988 <printf+0x178>
+    b->fd = fd;
+    1828:	89 35 a0 2c 00 00    	mov    %esi,0x2ca0
+  for(i = 0; fmt[i]; i++){
+    182e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+    1831:	bf a0 2c 00 00       	mov    $0x2ca0,%edi
+  for(i = 0; fmt[i]; i++){
+    1836:	84 c0                	test   %al,%al
+    1838:	74 65                	je     189f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+    183a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    183d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+    1840:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    1842:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+    1845:	eb 1f                	jmp    1866 <printf+0x56>
+    1847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    1850:	83 f8 25             	cmp    $0x25,%eax
+    1853:	74 3b                	je     1890 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+    1855:	89 f8                	mov    %edi,%eax
+    1857:	e8 f4 fe ff ff       	call   1750 <putc>
+  for(i = 0; fmt[i]; i++){
+    185c:	0f b6 03             	movzbl (%ebx),%eax
+    185f:	83 c3 01             	add    $0x1,%ebx
+    1862:	84 c0                	test   %al,%al
+    1864:	74 39                	je     189f <printf+0x8f>
+    c = fmt[i] & 0xff;
+    1866:	0f be d0             	movsbl %al,%edx
+    1869:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    186c:	85 f6                	test   %esi,%esi
+    186e:	74 e0                	je     1850 <printf+0x40>
+      }
+    } else if(state == '%'){
+    1870:	83 fe 25             	cmp    $0x25,%esi
+    1873:	75 e7                	jne    185c <printf+0x4c>
+      if(c == 'd'){
+    1875:	83 f8 25             	cmp    $0x25,%eax
+    1878:	74 57                	je     18d1 <printf+0xc1>
+    187a:	83 e8 63             	sub    $0x63,%eax
+    187d:	83 f8 15             	cmp    $0x15,%eax
+    1880:	77 36                	ja     18b8 <printf+0xa8>
+    1882:	ff 24 85 d0 20 00 00 	jmp    *0x20d0(,%eax,4)
+    1889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+    1890:	0f b6 03             	movzbl (%ebx),%eax
+    1893:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    1896:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    189b:	84 c0                	test   %al,%al
+    189d:	75 c7                	jne    1866 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+    189f:	8b 47 04             	mov    0x4(%edi),%eax
+    18a2:	85 c0                	test   %eax,%eax
+    18a4:	0f 84 06 01 00 00    	je     19b0 <printf+0x1a0>
+    bflush(b);
+}
+    18aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18ad:	5b                   	pop    %ebx
+    18ae:	5e                   	pop    %esi
+    18af:	5f                   	pop    %edi
+    18b0:	5d                   	pop    %ebp
+    18b1:	c3                   	ret
+    18b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+    18b8:	8b 4f 08             	mov    0x8(%edi),%ecx
+    18bb:	8d 41 01             	lea    0x1(%ecx),%eax
+    18be:	89 47 08             	mov    %eax,0x8(%edi)
+    18c1:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    18c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+    18cb:	0f 84 77 01 00 00    	je     1a48 <printf+0x238>
+        putc(b, c);
+    18d1:	89 f8                	mov    %edi,%eax
+      state = 0;
+    18d3:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+    18d5:	e8 76 fe ff ff       	call   1750 <putc>
+    18da:	eb 80                	jmp    185c <printf+0x4c>
+    18dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+    18e0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    18e3:	83 ec 0c             	sub    $0xc,%esp
+    18e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    18eb:	8b 16                	mov    (%esi),%edx
+    18ed:	6a 00                	push   $0x0
+        ap++;
+    18ef:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+    18f2:	89 f8                	mov    %edi,%eax
+    18f4:	e8 77 fd ff ff       	call   1670 <printint>
+        ap++;
+    18f9:	89 75 c0             	mov    %esi,-0x40(%ebp)
+    18fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    18ff:	31 f6                	xor    %esi,%esi
+    1901:	e9 56 ff ff ff       	jmp    185c <printf+0x4c>
+    1906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    190d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1910:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    1913:	8b 08                	mov    (%eax),%ecx
+        ap++;
+    1915:	83 c0 04             	add    $0x4,%eax
+    1918:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+    191b:	85 c9                	test   %ecx,%ecx
+    191d:	0f 84 cd 00 00 00    	je     19f0 <printf+0x1e0>
+        while(*s != 0){
+    1923:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+    1926:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+    1928:	84 d2                	test   %dl,%dl
+    192a:	0f 84 2c ff ff ff    	je     185c <printf+0x4c>
+          putc(b, *s);
+    1930:	89 f8                	mov    %edi,%eax
+    1932:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+    1935:	e8 16 fe ff ff       	call   1750 <putc>
+          s++;
+    193a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+    193d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+    1941:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+    1944:	84 d2                	test   %dl,%dl
+    1946:	75 e8                	jne    1930 <printf+0x120>
+      state = 0;
+    1948:	31 f6                	xor    %esi,%esi
+    194a:	e9 0d ff ff ff       	jmp    185c <printf+0x4c>
+    194f:	90                   	nop
+        printint(b, *ap, 10, 1);
+    1950:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1953:	83 ec 0c             	sub    $0xc,%esp
+    1956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    195b:	8b 16                	mov    (%esi),%edx
+    195d:	6a 01                	push   $0x1
+    195f:	eb 8e                	jmp    18ef <printf+0xdf>
+    1961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+    1968:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    196b:	89 f8                	mov    %edi,%eax
+    196d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    1970:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+    1973:	e8 d8 fd ff ff       	call   1750 <putc>
+        ap++;
+    1978:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+    197b:	31 f6                	xor    %esi,%esi
+    197d:	e9 da fe ff ff       	jmp    185c <printf+0x4c>
+    1982:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+    1988:	8b 15 c4 2e 00 00    	mov    0x2ec4,%edx
+    198e:	85 d2                	test   %edx,%edx
+    1990:	74 6e                	je     1a00 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+    1992:	0f b6 03             	movzbl (%ebx),%eax
+    1995:	bf c0 2e 00 00       	mov    $0x2ec0,%edi
+    199a:	84 c0                	test   %al,%al
+    199c:	0f 85 98 fe ff ff    	jne    183a <printf+0x2a>
+    19a2:	e9 03 ff ff ff       	jmp    18aa <printf+0x9a>
+    19a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ae:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    19b0:	8b 47 08             	mov    0x8(%edi),%eax
+    19b3:	85 c0                	test   %eax,%eax
+    19b5:	7f 19                	jg     19d0 <printf+0x1c0>
+  b->n = 0;
+    19b7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    19be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19c1:	5b                   	pop    %ebx
+    19c2:	5e                   	pop    %esi
+    19c3:	5f                   	pop    %edi
+    19c4:	5d                   	pop    %ebp
+    19c5:	c3                   	ret
+    19c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    19d0:	83 ec 04             	sub    $0x4,%esp
+    19d3:	50                   	push   %eax
+    19d4:	8d 47 0c             	lea    0xc(%edi),%eax
+    19d7:	50                   	push   %eax
+    19d8:	ff 37                	push   (%edi)
+    19da:	e8 d4 fa ff ff       	call   14b3 <write>
+  b->n = 0;
+    19df:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+    19e6:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    19e9:	eb d3                	jmp    19be <printf+0x1ae>
+    19eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ef:	90                   	nop
+    19f0:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    19f5:	b9 c8 20 00 00       	mov    $0x20c8,%ecx
+    19fa:	e9 31 ff ff ff       	jmp    1930 <printf+0x120>
+    19ff:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1a00:	83 ec 08             	sub    $0x8,%esp
+    1a03:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+    1a06:	c7 05 c0 2e 00 00 01 	movl   $0x1,0x2ec0
+    1a0d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1a10:	50                   	push   %eax
+    1a11:	6a 01                	push   $0x1
+    1a13:	e8 d3 fa ff ff       	call   14eb <fstat>
+    1a18:	83 c4 10             	add    $0x10,%esp
+    1a1b:	85 c0                	test   %eax,%eax
+    1a1d:	75 22                	jne    1a41 <printf+0x231>
+    1a1f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    1a24:	b8 02 00 00 00       	mov    $0x2,%eax
+    1a29:	0f 45 f0             	cmovne %eax,%esi
+    1a2c:	89 35 c4 2e 00 00    	mov    %esi,0x2ec4
+      stdioflush = flushout;
+    1a32:	c7 05 60 2a 00 00 30 	movl   $0x1630,0x2a60
+    1a39:	16 00 00 
+    1a3c:	e9 51 ff ff ff       	jmp    1992 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    1a41:	be 02 00 00 00       	mov    $0x2,%esi
+    1a46:	eb e4                	jmp    1a2c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+    1a48:	83 ec 04             	sub    $0x4,%esp
+    1a4b:	8d 47 0c             	lea    0xc(%edi),%eax
+    1a4e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1a51:	68 00 02 00 00       	push   $0x200
+    1a56:	50                   	push   %eax
+    1a57:	ff 37                	push   (%edi)
+    1a59:	e8 55 fa ff ff       	call   14b3 <write>
+  b->n = 0;
+    1a5e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    1a65:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    1a68:	83 c4 10             	add    $0x10,%esp
+    1a6b:	e9 61 fe ff ff       	jmp    18d1 <printf+0xc1>
+
+00001a70 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+    1a70:	55                   	push   %ebp
+    1a71:	89 e5                	mov    %esp,%ebp
+    1a73:	56                   	push   %esi
+    1a74:	53                   	push   %ebx
+    1a75:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+    1a77:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    1a7c:	39 d8                	cmp    %ebx,%eax
+    1a7e:	0f 83 e4 00 00 00    	jae    1b68 <freepages+0xf8>
+    1a84:	85 c0                	test   %eax,%eax
+    1a86:	0f 84 dc 00 00 00    	je     1b68 <freepages+0xf8>
+    1a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a90:	89 c2                	mov    %eax,%edx
+    1a92:	8b 00                	mov    (%eax),%eax
+    1a94:	85 c0                	test   %eax,%eax
+    1a96:	74 04                	je     1a9c <freepages+0x2c>
+    1a98:	39 d8                	cmp    %ebx,%eax
+    1a9a:	72 f4                	jb     1a90 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+    1a9c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+    1a9f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+    1aa1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+    1aa3:	85 c0                	test   %eax,%eax
+    1aa5:	74 15                	je     1abc <freepages+0x4c>
+    p->prev = s;
+    1aa7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+    1aaa:	8b 73 10             	mov    0x10(%ebx),%esi
+    1aad:	89 f1                	mov    %esi,%ecx
+    1aaf:	c1 e1 0c             	shl    $0xc,%ecx
+    1ab2:	01 d9                	add    %ebx,%ecx
+    1ab4:	39 c8                	cmp    %ecx,%eax
+    1ab6:	0f 84 d8 00 00 00    	je     1b94 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+    1abc:	8b 4a 10             	mov    0x10(%edx),%ecx
+    1abf:	89 c8                	mov    %ecx,%eax
+    1ac1:	c1 e0 0c             	shl    $0xc,%eax
+    1ac4:	01 d0                	add    %edx,%eax
+    1ac6:	39 c3                	cmp    %eax,%ebx
+    1ac8:	74 16                	je     1ae0 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    1aca:	8b 03                	mov    (%ebx),%eax
+    1acc:	85 c0                	test   %eax,%eax
+    1ace:	74 40                	je     1b10 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+    1ad0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ad3:	5b                   	pop    %ebx
+    1ad4:	5e                   	pop    %esi
+    1ad5:	5d                   	pop    %ebp
+    1ad6:	c3                   	ret
+    1ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ade:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+    1ae0:	03 4b 10             	add    0x10(%ebx),%ecx
+    1ae3:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+    1ae6:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+    1ae9:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    1aeb:	85 c9                	test   %ecx,%ecx
+    1aed:	0f 84 dd 00 00 00    	je     1bd0 <freepages+0x160>
+    s->prev->next = s->next;
+    1af3:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+    1af5:	85 c0                	test   %eax,%eax
+    1af7:	74 06                	je     1aff <freepages+0x8f>
+    s->next->prev = s->prev;
+    1af9:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    1afc:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    1aff:	8b 02                	mov    (%edx),%eax
+    1b01:	89 d3                	mov    %edx,%ebx
+    1b03:	85 c0                	test   %eax,%eax
+    1b05:	75 c9                	jne    1ad0 <freepages+0x60>
+    1b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b0e:	66 90                	xchg   %ax,%ax
+    1b10:	8b 43 10             	mov    0x10(%ebx),%eax
+    1b13:	83 f8 0f             	cmp    $0xf,%eax
+    1b16:	76 b8                	jbe    1ad0 <freepages+0x60>
+    1b18:	83 ec 0c             	sub    $0xc,%esp
+    1b1b:	c1 e0 0c             	shl    $0xc,%eax
+    1b1e:	6a 00                	push   $0x0
+    1b20:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1b23:	e8 f3 f9 ff ff       	call   151b <sbrk>
+    1b28:	83 c4 10             	add    $0x10,%esp
+    1b2b:	39 c6                	cmp    %eax,%esi
+    1b2d:	75 a1                	jne    1ad0 <freepages+0x60>
+  if(s->prev)
+    1b2f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+    1b32:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    1b34:	85 d2                	test   %edx,%edx
+    1b36:	0f 84 a5 00 00 00    	je     1be1 <freepages+0x171>
+    s->prev->next = s->next;
+    1b3c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+    1b3e:	85 c0                	test   %eax,%eax
+    1b40:	74 06                	je     1b48 <freepages+0xd8>
+    s->next->prev = s->prev;
+    1b42:	8b 53 04             	mov    0x4(%ebx),%edx
+    1b45:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+    1b48:	8b 43 10             	mov    0x10(%ebx),%eax
+    1b4b:	83 ec 0c             	sub    $0xc,%esp
+    1b4e:	c1 e0 0c             	shl    $0xc,%eax
+    1b51:	f7 d8                	neg    %eax
+    1b53:	50                   	push   %eax
+    1b54:	e8 c2 f9 ff ff       	call   151b <sbrk>
+    1b59:	83 c4 10             	add    $0x10,%esp
+}
+    1b5c:	e9 6f ff ff ff       	jmp    1ad0 <freepages+0x60>
+    1b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+    1b68:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+    1b6f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+    1b71:	89 1d e0 30 00 00    	mov    %ebx,0x30e0
+  if(p)
+    1b77:	85 c0                	test   %eax,%eax
+    1b79:	74 95                	je     1b10 <freepages+0xa0>
+    p->prev = s;
+    1b7b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+    1b7e:	8b 73 10             	mov    0x10(%ebx),%esi
+    1b81:	89 f2                	mov    %esi,%edx
+    1b83:	c1 e2 0c             	shl    $0xc,%edx
+    1b86:	01 da                	add    %ebx,%edx
+    1b88:	39 d0                	cmp    %edx,%eax
+    1b8a:	0f 85 3a ff ff ff    	jne    1aca <freepages+0x5a>
+    1b90:	89 c1                	mov    %eax,%ecx
+    1b92:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+    1b94:	8b 41 10             	mov    0x10(%ecx),%eax
+    1b97:	01 f0                	add    %esi,%eax
+    1b99:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+    1b9c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+    1b9f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+    1ba1:	85 f6                	test   %esi,%esi
+    1ba3:	74 35                	je     1bda <freepages+0x16a>
+    s->prev->next = s->next;
+    1ba5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+    1ba7:	85 c0                	test   %eax,%eax
+    1ba9:	74 06                	je     1bb1 <freepages+0x141>
+    s->next->prev = s->prev;
+    1bab:	8b 49 04             	mov    0x4(%ecx),%ecx
+    1bae:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+    1bb1:	85 d2                	test   %edx,%edx
+    1bb3:	0f 84 11 ff ff ff    	je     1aca <freepages+0x5a>
+    1bb9:	8b 4a 10             	mov    0x10(%edx),%ecx
+    1bbc:	89 c8                	mov    %ecx,%eax
+    1bbe:	c1 e0 0c             	shl    $0xc,%eax
+    1bc1:	01 d0                	add    %edx,%eax
+    1bc3:	39 c3                	cmp    %eax,%ebx
+    1bc5:	0f 85 ff fe ff ff    	jne    1aca <freepages+0x5a>
+    1bcb:	e9 10 ff ff ff       	jmp    1ae0 <freepages+0x70>
+    *l = s->next;
+    1bd0:	a3 e0 30 00 00       	mov    %eax,0x30e0
+    1bd5:	e9 1b ff ff ff       	jmp    1af5 <freepages+0x85>
+    1bda:	a3 e0 30 00 00       	mov    %eax,0x30e0
+    1bdf:	eb c6                	jmp    1ba7 <freepages+0x137>
+    1be1:	a3 e0 30 00 00       	mov    %eax,0x30e0
+    1be6:	e9 53 ff ff ff       	jmp    1b3e <freepages+0xce>
+    1beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1bef:	90                   	nop
+
+00001bf0 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+    1bf0:	55                   	push   %ebp
+    1bf1:	89 e5                	mov    %esp,%ebp
+    1bf3:	56                   	push   %esi
+    1bf4:	53                   	push   %ebx
+    1bf5:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+    1bf7:	a1 e0 30 00 00       	mov    0x30e0,%eax
+    1bfc:	85 c0                	test   %eax,%eax
+    1bfe:	74 5e                	je     1c5e <getpages+0x6e>
+    if(s->npages < n)
+    1c00:	8b 50 10             	mov    0x10(%eax),%edx
+    1c03:	39 da                	cmp    %ebx,%edx
+    1c05:	72 51                	jb     1c58 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+    1c07:	39 d3                	cmp    %edx,%ebx
+    1c09:	72 25                	jb     1c30 <getpages+0x40>
+  if(s->prev)
+    1c0b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+    1c0e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+    1c10:	85 c9                	test   %ecx,%ecx
+    1c12:	0f 84 a8 00 00 00    	je     1cc0 <getpages+0xd0>
+    s->prev->next = s->next;
+    1c18:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+    1c1a:	85 d2                	test   %edx,%edx
+    1c1c:	74 06                	je     1c24 <getpages+0x34>
+    s->next->prev = s->prev;
+    1c1e:	8b 48 04             	mov    0x4(%eax),%ecx
+    1c21:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+    1c24:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+    1c27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c2a:	5b                   	pop    %ebx
+    1c2b:	5e                   	pop    %esi
+    1c2c:	5d                   	pop    %ebp
+    1c2d:	c3                   	ret
+    1c2e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1c30:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+    1c32:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1c34:	c1 e1 0c             	shl    $0xc,%ecx
+    1c37:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+    1c39:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+    1c3c:	8b 70 04             	mov    0x4(%eax),%esi
+    1c3f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+    1c42:	8b 10                	mov    (%eax),%edx
+    1c44:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+    1c46:	85 f6                	test   %esi,%esi
+    1c48:	74 66                	je     1cb0 <getpages+0xc0>
+        rest->prev->next = rest;
+    1c4a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+    1c4c:	8b 11                	mov    (%ecx),%edx
+    1c4e:	85 d2                	test   %edx,%edx
+    1c50:	75 cf                	jne    1c21 <getpages+0x31>
+    1c52:	eb d0                	jmp    1c24 <getpages+0x34>
+    1c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+    1c58:	8b 00                	mov    (%eax),%eax
+    1c5a:	85 c0                	test   %eax,%eax
+    1c5c:	75 a2                	jne    1c00 <getpages+0x10>
+  brk = (uint)sbrk(0);
+    1c5e:	83 ec 0c             	sub    $0xc,%esp
+    1c61:	6a 00                	push   $0x0
+    1c63:	e8 b3 f8 ff ff       	call   151b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1c68:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+    1c6b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+    1c71:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1c73:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+    1c79:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1c7f:	29 d0                	sub    %edx,%eax
+    1c81:	c1 e8 0c             	shr    $0xc,%eax
+    1c84:	39 d8                	cmp    %ebx,%eax
+    1c86:	72 48                	jb     1cd0 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+    1c88:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    1c8a:	89 d8                	mov    %ebx,%eax
+    1c8c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+    1c8f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    1c91:	c1 e0 0c             	shl    $0xc,%eax
+    1c94:	01 f0                	add    %esi,%eax
+    1c96:	50                   	push   %eax
+    1c97:	e8 7f f8 ff ff       	call   151b <sbrk>
+    1c9c:	83 c4 10             	add    $0x10,%esp
+    1c9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ca2:	74 2c                	je     1cd0 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+    1ca4:	01 f0                	add    %esi,%eax
+    1ca6:	e9 79 ff ff ff       	jmp    1c24 <getpages+0x34>
+    1cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1caf:	90                   	nop
+        runs = rest;
+    1cb0:	89 0d e0 30 00 00    	mov    %ecx,0x30e0
+    1cb6:	eb 96                	jmp    1c4e <getpages+0x5e>
+    1cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cbf:	90                   	nop
+    *l = s->next;
+    1cc0:	89 15 e0 30 00 00    	mov    %edx,0x30e0
+    1cc6:	e9 4f ff ff ff       	jmp    1c1a <getpages+0x2a>
+    1ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1ccf:	90                   	nop
+    return 0;
+    1cd0:	31 c0                	xor    %eax,%eax
+    1cd2:	e9 50 ff ff ff       	jmp    1c27 <getpages+0x37>
+    1cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cde:	66 90                	xchg   %ax,%ax
+
+00001ce0 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	57                   	push   %edi
+    1ce4:	56                   	push   %esi
+    1ce5:	53                   	push   %ebx
+    1ce6:	83 ec 1c             	sub    $0x1c,%esp
+    1ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+    1cec:	85 c0                	test   %eax,%eax
+    1cee:	0f 84 97 00 00 00    	je     1d8b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+    1cf4:	89 c3                	mov    %eax,%ebx
+    1cf6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+    1cfc:	8b 73 14             	mov    0x14(%ebx),%esi
+    1cff:	83 fe 01             	cmp    $0x1,%esi
+    1d02:	74 74                	je     1d78 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    1d04:	85 f6                	test   %esi,%esi
+    1d06:	74 5d                	je     1d65 <free+0x85>
+  if(s->free == 0)
+    1d08:	8b 53 08             	mov    0x8(%ebx),%edx
+    1d0b:	85 d2                	test   %edx,%edx
+    1d0d:	0f 84 85 00 00 00    	je     1d98 <free+0xb8>
+  NEXTFREE(o) = s->free;
+    1d13:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+    1d15:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+    1d18:	8b 43 0c             	mov    0xc(%ebx),%eax
+    1d1b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+    1d1e:	8b 04 f5 04 31 00 00 	mov    0x3104(,%esi,8),%eax
+  s->inuse--;
+    1d25:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+    1d28:	83 c0 01             	add    $0x1,%eax
+    1d2b:	89 04 f5 04 31 00 00 	mov    %eax,0x3104(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1d32:	85 d2                	test   %edx,%edx
+    1d34:	75 55                	jne    1d8b <free+0xab>
+    1d36:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+    1d3b:	89 f1                	mov    %esi,%ecx
+    1d3d:	d3 ea                	shr    %cl,%edx
+    1d3f:	39 c2                	cmp    %eax,%edx
+    1d41:	73 7d                	jae    1dc0 <free+0xe0>
+  if(s->prev)
+    1d43:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+    1d46:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+    1d48:	85 ff                	test   %edi,%edi
+    1d4a:	0f 84 a0 00 00 00    	je     1df0 <free+0x110>
+    s->prev->next = s->next;
+    1d50:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    1d52:	85 c9                	test   %ecx,%ecx
+    1d54:	74 06                	je     1d5c <free+0x7c>
+    s->next->prev = s->prev;
+    1d56:	8b 7b 04             	mov    0x4(%ebx),%edi
+    1d59:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    1d5c:	29 d0                	sub    %edx,%eax
+    1d5e:	89 04 f5 04 31 00 00 	mov    %eax,0x3104(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    1d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    1d68:	89 d8                	mov    %ebx,%eax
+}
+    1d6a:	5b                   	pop    %ebx
+    1d6b:	5e                   	pop    %esi
+    1d6c:	5f                   	pop    %edi
+    1d6d:	5d                   	pop    %ebp
+    freepages(s);
+    1d6e:	e9 fd fc ff ff       	jmp    1a70 <freepages>
+    1d73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d77:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    1d78:	8b 43 10             	mov    0x10(%ebx),%eax
+    1d7b:	83 ec 08             	sub    $0x8,%esp
+    1d7e:	c1 e0 0c             	shl    $0xc,%eax
+    1d81:	50                   	push   %eax
+    1d82:	53                   	push   %ebx
+    1d83:	e8 6b f8 ff ff       	call   15f3 <munmap>
+    1d88:	83 c4 10             	add    $0x10,%esp
+}
+    1d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d8e:	5b                   	pop    %ebx
+    1d8f:	5e                   	pop    %esi
+    1d90:	5f                   	pop    %edi
+    1d91:	5d                   	pop    %ebp
+    1d92:	c3                   	ret
+    1d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d97:	90                   	nop
+  s->next = *l;
+    1d98:	8b 14 f5 00 31 00 00 	mov    0x3100(,%esi,8),%edx
+  s->prev = 0;
+    1d9f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    1da6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    1da8:	85 d2                	test   %edx,%edx
+    1daa:	74 06                	je     1db2 <free+0xd2>
+    (*l)->prev = s;
+    1dac:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    1daf:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1db2:	89 1c f5 00 31 00 00 	mov    %ebx,0x3100(,%esi,8)
+}
+    1db9:	e9 55 ff ff ff       	jmp    1d13 <free+0x33>
+    1dbe:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1dc0:	83 ec 0c             	sub    $0xc,%esp
+    1dc3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1dc6:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1dc9:	6a 00                	push   $0x0
+    1dcb:	c1 e7 0c             	shl    $0xc,%edi
+    1dce:	01 df                	add    %ebx,%edi
+    1dd0:	e8 46 f7 ff ff       	call   151b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1dd5:	83 c4 10             	add    $0x10,%esp
+    1dd8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1ddb:	39 c7                	cmp    %eax,%edi
+    1ddd:	75 ac                	jne    1d8b <free+0xab>
+    1ddf:	8b 04 f5 04 31 00 00 	mov    0x3104(,%esi,8),%eax
+    1de6:	e9 58 ff ff ff       	jmp    1d43 <free+0x63>
+    1deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1def:	90                   	nop
+    *l = s->next;
+    1df0:	89 0c f5 00 31 00 00 	mov    %ecx,0x3100(,%esi,8)
+    1df7:	e9 56 ff ff ff       	jmp    1d52 <free+0x72>
+    1dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e00 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e00:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1e01:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    1e06:	89 e5                	mov    %esp,%ebp
+    1e08:	57                   	push   %edi
+    1e09:	56                   	push   %esi
+    1e0a:	53                   	push   %ebx
+    1e0b:	83 ec 1c             	sub    $0x1c,%esp
+    1e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    1e11:	83 f8 10             	cmp    $0x10,%eax
+    1e14:	0f 86 92 00 00 00    	jbe    1eac <malloc+0xac>
+    1e1a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e1f:	eb 13                	jmp    1e34 <malloc+0x34>
+    1e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e28:	89 d3                	mov    %edx,%ebx
+    1e2a:	d3 e3                	shl    %cl,%ebx
+    1e2c:	39 c3                	cmp    %eax,%ebx
+    1e2e:	0f 83 84 00 00 00    	jae    1eb8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1e34:	83 c1 01             	add    $0x1,%ecx
+    1e37:	83 f9 0b             	cmp    $0xb,%ecx
+    1e3a:	75 ec                	jne    1e28 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    1e3c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    1e41:	0f 87 c9 00 00 00    	ja     1f10 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    1e47:	05 17 10 00 00       	add    $0x1017,%eax
+    1e4c:	89 c3                	mov    %eax,%ebx
+    1e4e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    1e51:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    1e56:	77 28                	ja     1e80 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    1e58:	89 d8                	mov    %ebx,%eax
+    1e5a:	e8 91 fd ff ff       	call   1bf0 <getpages>
+    1e5f:	85 c0                	test   %eax,%eax
+    1e61:	0f 84 a9 00 00 00    	je     1f10 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    1e67:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    1e6e:	83 c0 18             	add    $0x18,%eax
+}
+    1e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e74:	5b                   	pop    %ebx
+    1e75:	5e                   	pop    %esi
+    1e76:	5f                   	pop    %edi
+    1e77:	5d                   	pop    %ebp
+    1e78:	c3                   	ret
+    1e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    1e80:	89 d8                	mov    %ebx,%eax
+    1e82:	83 ec 08             	sub    $0x8,%esp
+    1e85:	c1 e0 0c             	shl    $0xc,%eax
+    1e88:	6a 00                	push   $0x0
+    1e8a:	6a ff                	push   $0xffffffff
+    1e8c:	6a 22                	push   $0x22
+    1e8e:	6a 03                	push   $0x3
+    1e90:	50                   	push   %eax
+    1e91:	6a 00                	push   $0x0
+    1e93:	e8 53 f7 ff ff       	call   15eb <mmap>
+    if(s == MAP_FAILED)
+    1e98:	83 c4 20             	add    $0x20,%esp
+    1e9b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1e9e:	74 b8                	je     1e58 <malloc+0x58>
+      s->shift = MAPRUN;
+    1ea0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    1ea7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    1eaa:	eb c2                	jmp    1e6e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    1eac:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1eb8:	8b 34 cd 00 31 00 00 	mov    0x3100(,%ecx,8),%esi
+    1ebf:	85 f6                	test   %esi,%esi
+    1ec1:	74 57                	je     1f1a <malloc+0x11a>
+  classes[shift].nfree--;
+    1ec3:	8b 1c cd 04 31 00 00 	mov    0x3104(,%ecx,8),%ebx
+  o = s->free;
+    1eca:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    1ecd:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1ed0:	89 14 cd 04 31 00 00 	mov    %edx,0x3104(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1ed7:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1ed9:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    1edd:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1ee0:	85 ff                	test   %edi,%edi
+    1ee2:	75 8d                	jne    1e71 <malloc+0x71>
+  if(s->prev)
+    1ee4:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1ee7:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1ee9:	85 db                	test   %ebx,%ebx
+    1eeb:	0f 84 b7 00 00 00    	je     1fa8 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1ef1:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1ef3:	85 d2                	test   %edx,%edx
+    1ef5:	0f 84 76 ff ff ff    	je     1e71 <malloc+0x71>
+    s->next->prev = s->prev;
+    1efb:	8b 4e 04             	mov    0x4(%esi),%ecx
+    1efe:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1f01:	e9 6b ff ff ff       	jmp    1e71 <malloc+0x71>
+    1f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f0d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    1f13:	31 c0                	xor    %eax,%eax
+}
+    1f15:	5b                   	pop    %ebx
+    1f16:	5e                   	pop    %esi
+    1f17:	5f                   	pop    %edi
+    1f18:	5d                   	pop    %ebp
+    1f19:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    1f1a:	b8 01 00 00 00       	mov    $0x1,%eax
+    1f1f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1f22:	e8 c9 fc ff ff       	call   1bf0 <getpages>
+    1f27:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    1f2a:	85 c0                	test   %eax,%eax
+    1f2c:	89 c2                	mov    %eax,%edx
+    1f2e:	74 e0                	je     1f10 <malloc+0x110>
+    s->shift = shift;
+    1f30:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1f33:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    1f35:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    1f3c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1f41:	89 df                	mov    %ebx,%edi
+    1f43:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    1f45:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    1f47:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    1f4a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1f4d:	83 e8 01             	sub    $0x1,%eax
+    1f50:	d3 e0                	shl    %cl,%eax
+    1f52:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1f55:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1f59:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1f5c:	eb 04                	jmp    1f62 <malloc+0x162>
+    1f5e:	66 90                	xchg   %ax,%ax
+    1f60:	89 c8                	mov    %ecx,%eax
+    1f62:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1f65:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1f67:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    1f6a:	89 c6                	mov    %eax,%esi
+    1f6c:	39 da                	cmp    %ebx,%edx
+    1f6e:	7f f0                	jg     1f60 <malloc+0x160>
+    1f70:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1f73:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1f76:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1f79:	8b 04 cd 00 31 00 00 	mov    0x3100(,%ecx,8),%eax
+  s->prev = 0;
+    1f80:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1f87:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1f89:	85 c0                	test   %eax,%eax
+    1f8b:	74 03                	je     1f90 <malloc+0x190>
+    (*l)->prev = s;
+    1f8d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1f90:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1f93:	89 14 cd 00 31 00 00 	mov    %edx,0x3100(,%ecx,8)
+    classes[shift].nfree += n;
+    1f9a:	89 d6                	mov    %edx,%esi
+    1f9c:	03 1c cd 04 31 00 00 	add    0x3104(,%ecx,8),%ebx
+    1fa3:	e9 22 ff ff ff       	jmp    1eca <malloc+0xca>
+    *l = s->next;
+    1fa8:	89 14 cd 00 31 00 00 	mov    %edx,0x3100(,%ecx,8)
+    1faf:	e9 3f ff ff ff       	jmp    1ef3 <malloc+0xf3>
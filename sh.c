@@ -3,6 +3,7 @@
 #include "types.h"
 #include "user.h"
 #include "fcntl.h"
+#include "spawn.h"
 // #include <string.h>
 // #include <stdlib.h>
 
@@ -60,6 +61,7 @@ struct backcmd
 int fork1(void); // Fork but panics on failure.
 void panic(char *);
 struct cmd *parsecmd(char *);
+void runwait(struct cmd *);
 
 // Execute cmd.  Never returns.
 void runcmd(struct cmd *cmd)
@@ -103,9 +105,7 @@ void runcmd(struct cmd *cmd)
 
   case LIST:
     lcmd = (struct listcmd *)cmd;
-    if (fork1() == 0)
-      runcmd(lcmd->left);
-    wait();
+    runwait(lcmd->left);
     runcmd(lcmd->right);
     break;
 
@@ -144,6 +144,130 @@ void runcmd(struct cmd *cmd)
   exit();
 }
 
+// Can cmd run without a copy of the shell, through spawn()?
+int spawnable(struct cmd *cmd)
+{
+  struct pipecmd *pcmd;
+
+  switch (cmd->type)
+  {
+  case EXEC:
+    return ((struct execcmd *)cmd)->argv[0] != 0;
+  case REDIR:
+    return spawnable(((struct redircmd *)cmd)->cmd);
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+    return spawnable(pcmd->left) && spawnable(pcmd->right);
+  }
+  return 0;
+}
+
+void setaction(struct spawn_action *a, int op, int fd, int newfd)
+{
+  a->op = op;
+  a->fd = fd;
+  a->newfd = newfd;
+}
+
+// Spawn the processes of a spawnable cmd, each with the n file
+// actions act[] first, in the order runcmd() would apply them.
+// Returns the number of processes started.
+int launch(struct cmd *cmd, struct spawn_action *act, int n)
+{
+  int p[2], k;
+  struct execcmd *ecmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  switch (cmd->type)
+  {
+  default:
+    panic("launch");
+
+  case EXEC:
+    ecmd = (struct execcmd *)cmd;
+    setaction(&act[n], SPAWN_END, 0, 0);
+    if (spawn(ecmd->argv[0], ecmd->argv, act) < 0)
+    {
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+      return 0;
+    }
+    return 1;
+
+  case REDIR:
+    rcmd = (struct redircmd *)cmd;
+    if (n + 2 > SPAWN_MAXACT)
+      panic("too many redirections");
+    setaction(&act[n], SPAWN_OPEN, rcmd->fd, 0);
+    act[n].path = rcmd->file;
+    act[n].mode = rcmd->mode;
+    return launch(rcmd->cmd, act, n + 1);
+
+  case PIPE:
+    pcmd = (struct pipecmd *)cmd;
+    if (n + 4 > SPAWN_MAXACT)
+      panic("too many redirections");
+    if (pipe(p) < 0)
+      panic("pipe");
+    // spawn() has read the actions by the time it returns,
+    // so both sides can use the same slots.
+    setaction(&act[n], SPAWN_DUP2, p[1], 1);
+    setaction(&act[n + 1], SPAWN_CLOSE, p[0], 0);
+    setaction(&act[n + 2], SPAWN_CLOSE, p[1], 0);
+    k = launch(pcmd->left, act, n + 3);
+    setaction(&act[n], SPAWN_DUP2, p[0], 0);
+    k += launch(pcmd->right, act, n + 3);
+    close(p[0]);
+    close(p[1]);
+    return k;
+  }
+  return 0;
+}
+
+// Run cmd and wait for it to finish, spawning its
+// processes if possible and otherwise forking a copy
+// of the shell to run it.
+void runwait(struct cmd *cmd)
+{
+  struct spawn_action act[SPAWN_MAXACT];
+  int n;
+
+  if (cmd != 0 && spawnable(cmd))
+  {
+    for (n = launch(cmd, act, 0); n > 0; n--)
+      wait();
+    return;
+  }
+  if (fork1() == 0)
+    runcmd(cmd);
+  wait();
+}
+
+// Free the nodes of cmd; its strings live in the input buffer.
+void freecmd(struct cmd *cmd)
+{
+  if (cmd == 0)
+    return;
+  switch (cmd->type)
+  {
+  case REDIR:
+    freecmd(((struct redircmd *)cmd)->cmd);
+    break;
+  case PIPE:
+    freecmd(((struct pipecmd *)cmd)->left);
+    freecmd(((struct pipecmd *)cmd)->right);
+    break;
+  case LIST:
+    freecmd(((struct listcmd *)cmd)->left);
+    freecmd(((struct listcmd *)cmd)->right);
+    break;
+  case BACK:
+    freecmd(((struct backcmd *)cmd)->cmd);
+    break;
+  }
+  free(cmd);
+}
+
 int getcmd(char *buf, int nbuf)
 {
   printf(2, "$ ");
@@ -158,6 +282,7 @@ int main(void)
 {
   static char buf[100];
   int fd;
+  struct cmd *cmd;
 
   // Ensure that three file descriptors are open.
   while ((fd = open("console", O_RDWR)) >= 0)
@@ -180,9 +305,19 @@ int main(void)
         printf(2, "cannot cd %s\n", buf + 3);
       continue;
     }
-    if (fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+    if (buf[0] == 'p' && buf[1] == 'a' && buf[2] == 't' && buf[3] == 'h' &&
+        buf[4] == ' ')
+    {
+      // So is set_path, for the commands to inherit it.
+      buf[strlen(buf) - 1] = 0; // chop \n
+      if (set_path(buf + 5) < 0)
+        printf(2, "path too long\n");
+      continue;
+    }
+    if ((cmd = parsecmd(buf)) == 0)
+      continue;
+    runwait(cmd);
+    freecmd(cmd);
   }
   exit();
 }
@@ -338,19 +473,37 @@ struct cmd *parsepipe(char **, char *);
 struct cmd *parseexec(char **, char *);
 struct cmd *nulterminate(struct cmd *);
 
+// The shell parses commands itself now that it spawns them,
+// so a syntax error must not exit: it sets parseerror, and
+// parsecmd() returns 0.
+int parseerror;
+
+void syntax(char *s)
+{
+  if (!parseerror)
+    printf(2, "%s\n", s);
+  parseerror = 1;
+}
+
 struct cmd *
 parsecmd(char *s)
 {
   char *es;
   struct cmd *cmd;
 
+  parseerror = 0;
   es = s + strlen(s);
   cmd = parseline(&s, es);
   peek(&s, es, "");
-  if (s != es)
+  if (s != es && !parseerror)
   {
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    syntax("syntax");
+  }
+  if (parseerror)
+  {
+    freecmd(cmd);
+    return 0;
   }
   nulterminate(cmd);
   return cmd;
@@ -399,7 +552,10 @@ parseredirs(struct cmd *cmd, char **ps, char *es)
   {
     tok = gettoken(ps, es, 0, 0);
     if (gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    {
+      syntax("missing file for redirection");
+      break;
+    }
     switch (tok)
     {
     case '<':
@@ -426,7 +582,10 @@ parseblock(char **ps, char *es)
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
   if (!peek(ps, es, ")"))
-    panic("syntax - missing )");
+  {
+    syntax("syntax - missing )");
+    return cmd;
+  }
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -453,12 +612,18 @@ parseexec(char **ps, char *es)
     if ((tok = gettoken(ps, es, &q, &eq)) == 0)
       break;
     if (tok != 'a')
-      panic("syntax");
+    {
+      syntax("syntax");
+      break;
+    }
+    if (argc + 1 >= MAXARGS)
+    {
+      syntax("too many args");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if (argc >= MAXARGS)
-      panic("too many args");
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
@@ -0,0 +1,151 @@
+//
+// Shared-memory segments: pages that several processes map
+// at once, so they can exchange data without copying it
+// through a pipe. shmget() finds or creates a segment by key,
+// shmat() maps it as a shared region (see mmap.c), shmdt()
+// unmaps it, and shmrm() removes the segment.
+//
+// The segment holds one reference to each of its pages and
+// every mapping another, so a removed segment's pages live on
+// until the last process detaches, exits or execs.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "mman.h"
+
+struct shm {
+  int key;      // 0: private, never found by shmget
+  int npages;   // 0 if the slot is free
+  char **pages;
+};
+
+struct {
+  struct spinlock lock;
+  struct shm shm[NSHM];
+} shmtable;
+
+void
+shminit(void)
+{
+  initlock(&shmtable.lock, "shm");
+}
+
+// Drop the segment's page references and free its slot.
+// Caller holds shmtable.lock.
+static void
+shmfree(struct shm *s)
+{
+  int i;
+
+  for(i = 0; i < s->npages && s->pages[i]; i++)
+    kfree(s->pages[i]);
+  kmfree(s->pages);
+  s->key = 0;
+  s->npages = 0;
+  s->pages = 0;
+}
+
+// Return the id of the segment with the given key, creating
+// one of size bytes if there is none. Returns -1 if the
+// existing segment is smaller than size or out of memory.
+int
+shmget(int key, uint size)
+{
+  struct shm *s, *free;
+  int i, n;
+
+  n = PGROUNDUP(size) / PGSIZE;
+  if(n == 0 || n > PGSIZE / sizeof(char*))
+    return -1;
+  acquire(&shmtable.lock);
+  free = 0;
+  for(s = shmtable.shm; s < &shmtable.shm[NSHM]; s++){
+    if(s->npages && key && s->key == key){
+      release(&shmtable.lock);
+      return n <= s->npages ? s - shmtable.shm : -1;
+    }
+    if(s->npages == 0 && free == 0)
+      free = s;
+  }
+  if((s = free) == 0 || (s->pages = kmalloc(n * sizeof(char*))) == 0){
+    release(&shmtable.lock);
+    return -1;
+  }
+  memset(s->pages, 0, n * sizeof(char*));
+  s->key = key;
+  s->npages = n;
+  for(i = 0; i < n; i++){
+    if((s->pages[i] = kalloc_zeroed()) == 0){
+      shmfree(s);
+      release(&shmtable.lock);
+      return -1;
+    }
+  }
+  release(&shmtable.lock);
+  return s - shmtable.shm;
+}
+
+// Map segment id into p. Returns the address, or -1.
+uint
+shmat(struct proc *p, int id)
+{
+  struct shm *s;
+  uint addr;
+  int i;
+
+  if(id < 0 || id >= NSHM)
+    return -1;
+  acquire(&shmtable.lock);
+  s = &shmtable.shm[id];
+  if(s->npages == 0 ||
+     (addr = vmamap(p, 0, s->npages * PGSIZE, PROT_READ|PROT_WRITE,
+                    MAP_SHARED|MAP_ANONYMOUS, 0, 0)) == -1){
+    release(&shmtable.lock);
+    return -1;
+  }
+  for(i = 0; i < s->npages; i++){
+    if(mappages(p->pgdir, (char*)addr + i*PGSIZE, PGSIZE,
+                V2P(s->pages[i]), PTE_W|PTE_U) < 0){
+      release(&shmtable.lock);
+      vmaunmap(p, addr, s->npages * PGSIZE);
+      return -1;
+    }
+    kref(s->pages[i]);
+  }
+  release(&shmtable.lock);
+  return addr;
+}
+
+// Unmap the segment that p attached at addr.
+int
+shmdt(struct proc *p, uint addr)
+{
+  struct vma *v;
+
+  if((v = findvma(p, addr)) == 0 || v->start != addr)
+    return -1;
+  return vmaunmap(p, v->start, v->end - v->start);
+}
+
+// Remove segment id. Processes that have it attached
+// keep its pages until they detach.
+int
+shmrm(int id)
+{
+  if(id < 0 || id >= NSHM)
+    return -1;
+  acquire(&shmtable.lock);
+  if(shmtable.shm[id].npages == 0){
+    release(&shmtable.lock);
+    return -1;
+  }
+  shmfree(&shmtable.shm[id]);
+  release(&shmtable.lock);
+  return 0;
+}
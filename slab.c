@@ -0,0 +1,258 @@
+//
+// Slab allocator for kernel objects smaller than a page.
+// Each cache hands out objects of one size, carved from
+// pages obtained with kalloc(). A page (a slab) starts with
+// a struct slab header, so kmfree() finds the cache of any
+// object by rounding its address down to the page.
+//
+// A cache with a constructor keeps its free objects in the
+// constructed state: the constructor runs once per object
+// when its slab is created, not on every allocation.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+struct slab {
+  struct slab *next;
+  struct kmem_cache *cache;
+  char *free;       // first free object
+  int inuse;        // objects handed out
+};
+
+struct kmem_cache {
+  char *name;
+  uint size;        // bytes per object slot
+  uint link;        // offset of the free-list link in a free slot
+  int perslab;      // objects per slab
+  void (*ctor)(void*);
+  struct spinlock lock;
+  struct slab *partial;  // slabs with free objects
+  struct slab *full;     // slabs with none
+  int nslabs;
+  int nfree;        // free objects over all slabs
+};
+
+// Smallest and largest kmalloc() size classes, as powers of two.
+#define KMMINSHIFT 4
+#define KMMAXSHIFT 11
+
+struct {
+  struct spinlock lock;
+  struct kmem_cache cache[NKCACHE];
+  int n;
+} kcaches;
+
+static struct kmem_cache *kmcache[KMMAXSHIFT + 1];
+
+#define NEXTFREE(c, o) (*(char**)((o) + (c)->link))
+
+void
+slabinit(void)
+{
+  static char names[KMMAXSHIFT + 1][12] = {
+    [4] "kmalloc-16", [5] "kmalloc-32", [6] "kmalloc-64",
+    [7] "kmalloc-128", [8] "kmalloc-256", [9] "kmalloc-512",
+    [10] "kmalloc-1024", [11] "kmalloc-2048",
+  };
+  int i;
+
+  initlock(&kcaches.lock, "kcaches");
+  for(i = KMMINSHIFT; i <= KMMAXSHIFT; i++)
+    kmcache[i] = kmem_cache_create(names[i], 1 << i, 0);
+}
+
+// Create a cache of objects of the given size. ctor, if not 0,
+// initializes each object once, when its slab is allocated.
+// Returns 0 if the cache table is full or size is too large.
+struct kmem_cache*
+kmem_cache_create(char *name, uint size, void (*ctor)(void*))
+{
+  struct kmem_cache *c;
+
+  size = (size + 3) & ~3;
+  acquire(&kcaches.lock);
+  if(kcaches.n == NKCACHE){
+    release(&kcaches.lock);
+    return 0;
+  }
+  c = &kcaches.cache[kcaches.n++];
+  release(&kcaches.lock);
+
+  c->name = name;
+  c->ctor = ctor;
+  // A constructed object must survive being on the free list,
+  // so give it a separate link word after the object.
+  c->link = ctor ? size : 0;
+  c->size = ctor ? size + sizeof(char*) : size;
+  c->perslab = (PGSIZE - sizeof(struct slab)) / c->size;
+  if(c->perslab < 1)
+    panic("kmem_cache_create");
+  initlock(&c->lock, name);
+  return c;
+}
+
+// Allocate and construct a new slab for c.
+static struct slab*
+newslab(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *o;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  o = (char*)(s + 1) + (c->perslab - 1) * c->size;
+  for(i = 0; i < c->perslab; i++, o -= c->size){
+    if(c->ctor)
+      c->ctor(o);
+    NEXTFREE(c, o) = s->free;
+    s->free = o;
+  }
+  return s;
+}
+
+// Allocate an object from c. Returns 0 if out of memory.
+void*
+kmem_cache_alloc(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *o;
+
+  acquire(&c->lock);
+  if(c->partial == 0){
+    release(&c->lock);
+    if((s = newslab(c)) == 0)
+      return 0;
+    acquire(&c->lock);
+    s->next = c->partial;
+    c->partial = s;
+    c->nslabs++;
+    c->nfree += c->perslab;
+  }
+  s = c->partial;
+  o = s->free;
+  s->free = NEXTFREE(c, o);
+  s->inuse++;
+  c->nfree--;
+  if(s->free == 0){
+    c->partial = s->next;
+    s->next = c->full;
+    c->full = s;
+  }
+  release(&c->lock);
+  return o;
+}
+
+// Remove s from the list at *l.
+static void
+unlinkslab(struct slab **l, struct slab *s)
+{
+  for(; *l; l = &(*l)->next){
+    if(*l == s){
+      *l = s->next;
+      return;
+    }
+  }
+  panic("unlinkslab");
+}
+
+// Return object o to c. A constructed object must be
+// back in its constructed state.
+void
+kmem_cache_free(struct kmem_cache *c, void *o)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)o);
+  if(s->cache != c)
+    panic("kmem_cache_free");
+
+  acquire(&c->lock);
+  if(s->free == 0){
+    unlinkslab(&c->full, s);
+    s->next = c->partial;
+    c->partial = s;
+  }
+  NEXTFREE(c, (char*)o) = s->free;
+  s->free = o;
+  s->inuse--;
+  c->nfree++;
+  // Give an empty slab back, unless it is the cache's only
+  // spare room, to avoid freeing and reconstructing a slab
+  // when one object is allocated and freed repeatedly.
+  if(s->inuse == 0 && c->nfree > c->perslab){
+    unlinkslab(&c->partial, s);
+    c->nslabs--;
+    c->nfree -= c->perslab;
+  } else
+    s = 0;
+  release(&c->lock);
+  if(s)
+    kfree((char*)s);
+}
+
+// Allocate n bytes from the smallest size class that fits.
+// Larger requests up to a page get a whole page.
+// Returns 0 if out of memory or n is more than a page.
+void*
+kmalloc(uint n)
+{
+  int i;
+
+  if(n > PGSIZE)
+    return 0;
+  for(i = KMMINSHIFT; i <= KMMAXSHIFT; i++)
+    if(n <= (1 << i))
+      return kmem_cache_alloc(kmcache[i]);
+  return kalloc();
+}
+
+// Free memory returned by kmalloc().
+void
+kmfree(void *v)
+{
+  struct slab *s;
+
+  // Slab objects follow the slab header, so only
+  // whole pages are page-aligned.
+  if((uint)v % PGSIZE == 0){
+    kfree(v);
+    return;
+  }
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  kmem_cache_free(s->cache, v);
+}
+
+// Pages held by cache c, or by all caches if c is 0.
+int
+kmem_cache_pages(struct kmem_cache *c)
+{
+  int n;
+
+  if(c)
+    return c->nslabs;
+  n = 0;
+  for(c = kcaches.cache; c < &kcaches.cache[kcaches.n]; c++)
+    n += c->nslabs;
+  return n;
+}
+
+void
+print_slab_stats(void)
+{
+  struct kmem_cache *c;
+
+  for(c = kcaches.cache; c < &kcaches.cache[kcaches.n]; c++){
+    if(c->nslabs == 0)
+      continue;
+    cprintf("%s: size %d, slabs %d, in use %d, free %d\n", c->name,
+            c->size, c->nslabs, c->nslabs * c->perslab - c->nfree, c->nfree);
+  }
+}
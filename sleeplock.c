@@ -10,24 +10,105 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 
+// How contended sleeplocks were acquired; see print_lock_stats.
+struct {
+  uint spinwins;   // got the lock by spinning, without sleeping
+  uint spinlosses; // spun, but had to sleep after all
+  uint sleeps;     // slept without spinning (holder not running)
+  uint inversions; // holder ran at a worse level than a waiter
+} sleepstats;
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
   lk->locked = 0;
+  lk->readers = 0;
+  lk->writers = 0;
   lk->pid = 0;
+  lk->proc = 0;
+  lk->reader = 0;
+}
+
+// Is the exclusive holder of lk running on another CPU?
+// Racy, but only used to decide whether to spin.
+static int
+holderrunning(struct sleeplock *lk)
+{
+  struct proc *p = lk->proc;
+
+  return lk->locked && p != 0 && p != myproc() && p->state == RUNNING;
+}
+
+// Drop a hold on a sleeplock by p, restoring p's level once
+// it holds none. Called with the sleeplock's spinlock held.
+static void
+dropheld(struct proc *p)
+{
+  if(p && --p->sleeplocks == 0 && p->base_level >= 0)
+    restore_process_level(p);
+}
+
+// Spin while the holder of lk runs on another CPU, since it
+// will likely release the lock before two trips through the
+// scheduler (sleep, then wakeup) would finish.
+// Called and returns with lk->lk held; returns 1 if the
+// lock became free (for the caller's purposes) while spinning.
+static int
+spinsleep(struct sleeplock *lk, int shared)
+{
+  int i;
+
+  for(i = 0; i < SLEEPSPIN && holderrunning(lk); i++){
+    release(&lk->lk);
+    acquire(&lk->lk);
+  }
+  if(shared)
+    return !lk->locked && !lk->writers;
+  return !lk->locked && !lk->readers;
+}
+
+static void
+countwait(int spun, int slept)
+{
+  if(spun && !slept)
+    __sync_fetch_and_add(&sleepstats.spinwins, 1);
+  else if(spun)
+    __sync_fetch_and_add(&sleepstats.spinlosses, 1);
+  else if(slept)
+    __sync_fetch_and_add(&sleepstats.sleeps, 1);
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  struct proc *p;
+  int spun, slept;
+
   acquire(&lk->lk);
-  while (lk->locked) {
+  lk->writers++;
+  spun = slept = 0;
+  while (lk->locked || lk->readers) {
+    if(holderrunning(lk)){
+      spun = 1;
+      if(spinsleep(lk, 0))
+        continue;
+    }
+    slept = 1;
+    // Of several shared holders only the latest is known;
+    // once it releases, the others run at their own level.
+    p = lk->locked ? lk->proc : lk->reader;
+    if(p && inherit_process_level(p, myproc()->level))
+      __sync_fetch_and_add(&sleepstats.inversions, 1);
     sleep(lk, &lk->lk);
   }
+  countwait(spun, slept);
+  lk->writers--;
   lk->locked = 1;
   lk->pid = myproc()->pid;
+  lk->proc = myproc();
+  lk->proc->sleeplocks++;
   release(&lk->lk);
 }
 
@@ -35,12 +116,58 @@ void
 releasesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
+  dropheld(lk->proc);
   lk->locked = 0;
   lk->pid = 0;
+  lk->proc = 0;
   wakeup(lk);
   release(&lk->lk);
 }
 
+// Shared (read) mode: any number of processes may hold the
+// lock at once, as long as nobody holds it exclusively.
+// Waiting exclusive acquirers keep new readers out so that
+// a stream of readers cannot starve a writer.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  int spun, slept;
+
+  acquire(&lk->lk);
+  spun = slept = 0;
+  while (lk->locked || lk->writers) {
+    if(holderrunning(lk)){
+      spun = 1;
+      if(spinsleep(lk, 1))
+        continue;
+    }
+    slept = 1;
+    if(lk->proc && inherit_process_level(lk->proc, myproc()->level))
+      __sync_fetch_and_add(&sleepstats.inversions, 1);
+    sleep(lk, &lk->lk);
+  }
+  countwait(spun, slept);
+  lk->readers++;
+  lk->reader = myproc();
+  lk->reader->sleeplocks++;
+  release(&lk->lk);
+}
+
+void
+releasesleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->readers < 1)
+    panic("releasesleepshared");
+  lk->readers--;
+  dropheld(myproc());
+  if(lk->reader == myproc())
+    lk->reader = 0;
+  if(lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
 int
 holdingsleep(struct sleeplock *lk)
 {
@@ -52,5 +179,10 @@ holdingsleep(struct sleeplock *lk)
   return r;
 }
 
-
-
+void
+print_lock_stats(void)
+{
+  cprintf("sleeplock waits: spin won %d, spin lost %d, slept %d\n",
+          sleepstats.spinwins, sleepstats.spinlosses, sleepstats.sleeps);
+  cprintf("sleeplock priority inversions: %d\n", sleepstats.inversions);
+}
@@ -1,10 +1,14 @@
 // Long-term locks for processes
 struct sleeplock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held exclusively?
+  int readers;       // Number of shared holders
+  int writers;       // Exclusive acquirers waiting; blocks new readers
+  struct proc *reader; // Latest shared holder, while it holds; see acquiresleep
   struct spinlock lk; // spinlock protecting this sleep lock
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *proc; // Process holding lock exclusively, for spinning
 };
 
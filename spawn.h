@@ -0,0 +1,16 @@
+// File actions for spawn(), applied in order to the child's
+// copy of the parent's open files before it starts.
+#define SPAWN_END   0   // end of the list
+#define SPAWN_CLOSE 1   // close fd
+#define SPAWN_DUP2  2   // make newfd refer to the file at fd
+#define SPAWN_OPEN  3   // open path with mode as fd
+
+#define SPAWN_MAXACT 16 // most actions per spawn()
+
+struct spawn_action {
+  int op;
+  int fd;
+  int newfd;
+  char *path;
+  int mode;
+};
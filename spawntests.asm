@@ -0,0 +1,2652 @@
+
+_spawntests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "text busy test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "spawntests starting\n");
+      11:	68 be 15 00 00       	push   $0x15be
+      16:	6a 01                	push   $0x1
+      18:	e8 93 0c 00 00       	call   cb0 <printf>
+  spawntest();
+      1d:	e8 1e 00 00 00       	call   40 <spawntest>
+  pathtest();
+      22:	e8 49 01 00 00       	call   170 <pathtest>
+  textbusytest();
+      27:	e8 b4 02 00 00       	call   2e0 <textbusytest>
+  printf(1, "spawntests done\n");
+      2c:	58                   	pop    %eax
+      2d:	5a                   	pop    %edx
+      2e:	68 d3 15 00 00       	push   $0x15d3
+      33:	6a 01                	push   $0x1
+      35:	e8 76 0c 00 00       	call   cb0 <printf>
+  exit();
+      3a:	e8 81 05 00 00       	call   5c0 <exit>
+      3f:	90                   	nop
+
+00000040 <spawntest>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	56                   	push   %esi
+      44:	53                   	push   %ebx
+      45:	83 ec 38             	sub    $0x38,%esp
+  printf(1, "spawn test\n");
+      48:	68 54 14 00 00       	push   $0x1454
+      4d:	6a 01                	push   $0x1
+      4f:	e8 5c 0c 00 00       	call   cb0 <printf>
+  if(spawn("echo", echoargv, act) < 0){
+      54:	83 c4 0c             	add    $0xc,%esp
+      57:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  act[0].op = SPAWN_OPEN;
+      5a:	c7 45 d0 03 00 00 00 	movl   $0x3,-0x30(%ebp)
+  act[0].fd = 1;
+      61:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  act[0].path = "spawnout";
+      68:	c7 45 dc 60 14 00 00 	movl   $0x1460,-0x24(%ebp)
+  act[0].mode = O_CREATE|O_WRONLY;
+      6f:	c7 45 e0 01 02 00 00 	movl   $0x201,-0x20(%ebp)
+  act[1].op = SPAWN_END;
+      76:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if(spawn("echo", echoargv, act) < 0){
+      7d:	50                   	push   %eax
+      7e:	68 d4 1b 00 00       	push   $0x1bd4
+      83:	68 0a 15 00 00       	push   $0x150a
+      88:	e8 83 05 00 00       	call   610 <spawn>
+      8d:	83 c4 10             	add    $0x10,%esp
+      90:	85 c0                	test   %eax,%eax
+      92:	0f 88 99 00 00 00    	js     131 <spawntest+0xf1>
+  wait();
+      98:	e8 9e 08 00 00       	call   93b <wait>
+  fd = open("spawnout", O_RDONLY);
+      9d:	83 ec 08             	sub    $0x8,%esp
+      a0:	6a 00                	push   $0x0
+      a2:	68 60 14 00 00       	push   $0x1460
+      a7:	e8 c7 08 00 00       	call   973 <open>
+  n = read(fd, buf, sizeof(buf) - 1);
+      ac:	83 c4 0c             	add    $0xc,%esp
+      af:	68 ff 01 00 00       	push   $0x1ff
+  fd = open("spawnout", O_RDONLY);
+      b4:	89 c6                	mov    %eax,%esi
+  n = read(fd, buf, sizeof(buf) - 1);
+      b6:	68 00 1c 00 00       	push   $0x1c00
+      bb:	50                   	push   %eax
+      bc:	e8 8a 08 00 00       	call   94b <read>
+  close(fd);
+      c1:	89 34 24             	mov    %esi,(%esp)
+  n = read(fd, buf, sizeof(buf) - 1);
+      c4:	89 c3                	mov    %eax,%ebx
+  close(fd);
+      c6:	e8 90 08 00 00       	call   95b <close>
+  unlink("spawnout");
+      cb:	c7 04 24 60 14 00 00 	movl   $0x1460,(%esp)
+      d2:	e8 ac 08 00 00       	call   983 <unlink>
+  buf[n < 0 ? 0 : n] = 0;
+      d7:	31 c0                	xor    %eax,%eax
+      d9:	85 db                	test   %ebx,%ebx
+      db:	0f 48 d8             	cmovs  %eax,%ebx
+      de:	c6 83 00 1c 00 00 00 	movb   $0x0,0x1c00(%ebx)
+  if(strcmp(buf, "ALL TESTS PASSED\n") != 0){
+      e5:	59                   	pop    %ecx
+      e6:	5b                   	pop    %ebx
+      e7:	68 82 14 00 00       	push   $0x1482
+      ec:	68 00 1c 00 00       	push   $0x1c00
+      f1:	e8 8a 05 00 00       	call   680 <strcmp>
+      f6:	83 c4 10             	add    $0x10,%esp
+      f9:	85 c0                	test   %eax,%eax
+      fb:	75 5a                	jne    157 <spawntest+0x117>
+  if(spawn("nosuchprogram", echoargv, 0) >= 0){
+      fd:	83 ec 04             	sub    $0x4,%esp
+     100:	6a 00                	push   $0x0
+     102:	68 d4 1b 00 00       	push   $0x1bd4
+     107:	68 ad 14 00 00       	push   $0x14ad
+     10c:	e8 ff 04 00 00       	call   610 <spawn>
+     111:	83 c4 10             	add    $0x10,%esp
+     114:	85 c0                	test   %eax,%eax
+     116:	79 2c                	jns    144 <spawntest+0x104>
+  printf(1, "spawn test OK\n");
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	68 bb 14 00 00       	push   $0x14bb
+     120:	6a 01                	push   $0x1
+     122:	e8 89 0b 00 00       	call   cb0 <printf>
+}
+     127:	83 c4 10             	add    $0x10,%esp
+     12a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     12d:	5b                   	pop    %ebx
+     12e:	5e                   	pop    %esi
+     12f:	5d                   	pop    %ebp
+     130:	c3                   	ret
+    printf(1, "spawn test spawn failed\n");
+     131:	56                   	push   %esi
+     132:	56                   	push   %esi
+     133:	68 69 14 00 00       	push   $0x1469
+     138:	6a 01                	push   $0x1
+     13a:	e8 71 0b 00 00       	call   cb0 <printf>
+    exit();
+     13f:	e8 7c 04 00 00       	call   5c0 <exit>
+    printf(1, "spawn test spawned a missing program\n");
+     144:	50                   	push   %eax
+     145:	50                   	push   %eax
+     146:	68 f8 15 00 00       	push   $0x15f8
+     14b:	6a 01                	push   $0x1
+     14d:	e8 5e 0b 00 00       	call   cb0 <printf>
+    exit();
+     152:	e8 69 04 00 00       	call   5c0 <exit>
+    printf(1, "spawn test wrong output\n");
+     157:	52                   	push   %edx
+     158:	52                   	push   %edx
+     159:	68 94 14 00 00       	push   $0x1494
+     15e:	6a 01                	push   $0x1
+     160:	e8 4b 0b 00 00       	call   cb0 <printf>
+    exit();
+     165:	e8 56 04 00 00       	call   5c0 <exit>
+     16a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000170 <pathtest>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	56                   	push   %esi
+     174:	53                   	push   %ebx
+     175:	83 ec 38             	sub    $0x38,%esp
+  printf(1, "path test\n");
+     178:	68 ca 14 00 00       	push   $0x14ca
+     17d:	6a 01                	push   $0x1
+     17f:	e8 2c 0b 00 00       	call   cb0 <printf>
+  quiet[0].op = SPAWN_CLOSE;
+     184:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  quiet[0].fd = 1;
+     18b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  quiet[1].op = SPAWN_END;
+     192:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if(mkdir("pathdir") < 0 || set_path("/nosuchdir:/pathdir") < 0){
+     199:	c7 04 24 f9 14 00 00 	movl   $0x14f9,(%esp)
+     1a0:	e8 f6 07 00 00       	call   99b <mkdir>
+     1a5:	83 c4 10             	add    $0x10,%esp
+     1a8:	85 c0                	test   %eax,%eax
+     1aa:	0f 88 ee 00 00 00    	js     29e <pathtest+0x12e>
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	68 ed 14 00 00       	push   $0x14ed
+     1b8:	e8 2e 08 00 00       	call   9eb <set_path>
+     1bd:	83 c4 10             	add    $0x10,%esp
+     1c0:	85 c0                	test   %eax,%eax
+     1c2:	0f 88 d6 00 00 00    	js     29e <pathtest+0x12e>
+  if(spawn("pecho", echoargv, quiet) >= 0){
+     1c8:	83 ec 04             	sub    $0x4,%esp
+     1cb:	8d 75 d0             	lea    -0x30(%ebp),%esi
+     1ce:	56                   	push   %esi
+     1cf:	68 d4 1b 00 00       	push   $0x1bd4
+     1d4:	68 09 15 00 00       	push   $0x1509
+     1d9:	e8 32 04 00 00       	call   610 <spawn>
+     1de:	83 c4 10             	add    $0x10,%esp
+     1e1:	85 c0                	test   %eax,%eax
+     1e3:	0f 89 db 00 00 00    	jns    2c4 <pathtest+0x154>
+  if(link("echo", "pathdir/pecho") < 0 ||
+     1e9:	83 ec 08             	sub    $0x8,%esp
+     1ec:	68 01 15 00 00       	push   $0x1501
+     1f1:	68 0a 15 00 00       	push   $0x150a
+     1f6:	e8 98 07 00 00       	call   993 <link>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	85 c0                	test   %eax,%eax
+     200:	0f 88 84 00 00 00    	js     28a <pathtest+0x11a>
+     (pid = spawn("pecho", echoargv, quiet)) < 0 || wait() != pid){
+     206:	83 ec 04             	sub    $0x4,%esp
+     209:	56                   	push   %esi
+     20a:	68 d4 1b 00 00       	push   $0x1bd4
+     20f:	68 09 15 00 00       	push   $0x1509
+     214:	e8 f7 03 00 00       	call   610 <spawn>
+  if(link("echo", "pathdir/pecho") < 0 ||
+     219:	83 c4 10             	add    $0x10,%esp
+     (pid = spawn("pecho", echoargv, quiet)) < 0 || wait() != pid){
+     21c:	89 c3                	mov    %eax,%ebx
+  if(link("echo", "pathdir/pecho") < 0 ||
+     21e:	85 c0                	test   %eax,%eax
+     220:	78 68                	js     28a <pathtest+0x11a>
+     (pid = spawn("pecho", echoargv, quiet)) < 0 || wait() != pid){
+     222:	e8 14 07 00 00       	call   93b <wait>
+     227:	39 d8                	cmp    %ebx,%eax
+     229:	75 5f                	jne    28a <pathtest+0x11a>
+  if(unlink("pathdir/pecho") < 0 || spawn("pecho", echoargv, quiet) >= 0){
+     22b:	83 ec 0c             	sub    $0xc,%esp
+     22e:	68 01 15 00 00       	push   $0x1501
+     233:	e8 4b 07 00 00       	call   983 <unlink>
+     238:	83 c4 10             	add    $0x10,%esp
+     23b:	85 c0                	test   %eax,%eax
+     23d:	78 72                	js     2b1 <pathtest+0x141>
+     23f:	83 ec 04             	sub    $0x4,%esp
+     242:	56                   	push   %esi
+     243:	68 d4 1b 00 00       	push   $0x1bd4
+     248:	68 09 15 00 00       	push   $0x1509
+     24d:	e8 be 03 00 00       	call   610 <spawn>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	79 58                	jns    2b1 <pathtest+0x141>
+  set_path("");
+     259:	83 ec 0c             	sub    $0xc,%esp
+     25c:	68 93 14 00 00       	push   $0x1493
+     261:	e8 85 07 00 00       	call   9eb <set_path>
+  unlink("pathdir");
+     266:	c7 04 24 f9 14 00 00 	movl   $0x14f9,(%esp)
+     26d:	e8 11 07 00 00       	call   983 <unlink>
+  printf(1, "path test OK\n");
+     272:	58                   	pop    %eax
+     273:	5a                   	pop    %edx
+     274:	68 0f 15 00 00       	push   $0x150f
+     279:	6a 01                	push   $0x1
+     27b:	e8 30 0a 00 00       	call   cb0 <printf>
+}
+     280:	83 c4 10             	add    $0x10,%esp
+     283:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     286:	5b                   	pop    %ebx
+     287:	5e                   	pop    %esi
+     288:	5d                   	pop    %ebp
+     289:	c3                   	ret
+    printf(1, "path test missed a new command\n");
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 44 16 00 00       	push   $0x1644
+     292:	6a 01                	push   $0x1
+     294:	e8 17 0a 00 00       	call   cb0 <printf>
+    exit();
+     299:	e8 22 03 00 00       	call   5c0 <exit>
+    printf(1, "path test setup failed\n");
+     29e:	56                   	push   %esi
+     29f:	56                   	push   %esi
+     2a0:	68 d5 14 00 00       	push   $0x14d5
+     2a5:	6a 01                	push   $0x1
+     2a7:	e8 04 0a 00 00       	call   cb0 <printf>
+    exit();
+     2ac:	e8 0f 03 00 00       	call   5c0 <exit>
+    printf(1, "path test found a removed command\n");
+     2b1:	51                   	push   %ecx
+     2b2:	51                   	push   %ecx
+     2b3:	68 64 16 00 00       	push   $0x1664
+     2b8:	6a 01                	push   $0x1
+     2ba:	e8 f1 09 00 00       	call   cb0 <printf>
+    exit();
+     2bf:	e8 fc 02 00 00       	call   5c0 <exit>
+    printf(1, "path test found a missing command\n");
+     2c4:	53                   	push   %ebx
+     2c5:	53                   	push   %ebx
+     2c6:	68 20 16 00 00       	push   $0x1620
+     2cb:	6a 01                	push   $0x1
+     2cd:	e8 de 09 00 00       	call   cb0 <printf>
+    exit();
+     2d2:	e8 e9 02 00 00       	call   5c0 <exit>
+     2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <textbusytest>:
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	57                   	push   %edi
+     2e4:	56                   	push   %esi
+     2e5:	53                   	push   %ebx
+     2e6:	83 ec 34             	sub    $0x34,%esp
+  char *argv[] = { "txtbusy", 0 };
+     2e9:	c7 45 d0 1d 15 00 00 	movl   $0x151d,-0x30(%ebp)
+     2f0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  printf(1, "text busy test\n");
+     2f7:	68 25 15 00 00       	push   $0x1525
+     2fc:	6a 01                	push   $0x1
+     2fe:	e8 ad 09 00 00       	call   cb0 <printf>
+  if((in = open("cat", O_RDONLY)) < 0 ||
+     303:	58                   	pop    %eax
+     304:	5a                   	pop    %edx
+     305:	6a 00                	push   $0x0
+     307:	68 35 15 00 00       	push   $0x1535
+     30c:	e8 62 06 00 00       	call   973 <open>
+     311:	83 c4 10             	add    $0x10,%esp
+     314:	85 c0                	test   %eax,%eax
+     316:	0f 88 9e 01 00 00    	js     4ba <textbusytest+0x1da>
+     (fd = open("txtbusy", O_CREATE|O_WRONLY)) < 0){
+     31c:	83 ec 08             	sub    $0x8,%esp
+     31f:	89 c6                	mov    %eax,%esi
+     321:	68 01 02 00 00       	push   $0x201
+     326:	68 1d 15 00 00       	push   $0x151d
+     32b:	e8 43 06 00 00       	call   973 <open>
+  if((in = open("cat", O_RDONLY)) < 0 ||
+     330:	83 c4 10             	add    $0x10,%esp
+     (fd = open("txtbusy", O_CREATE|O_WRONLY)) < 0){
+     333:	89 c7                	mov    %eax,%edi
+  if((in = open("cat", O_RDONLY)) < 0 ||
+     335:	85 c0                	test   %eax,%eax
+     337:	79 21                	jns    35a <textbusytest+0x7a>
+     339:	e9 7c 01 00 00       	jmp    4ba <textbusytest+0x1da>
+     33e:	66 90                	xchg   %ax,%ax
+    if(write(fd, buf, n) != n){
+     340:	83 ec 04             	sub    $0x4,%esp
+     343:	53                   	push   %ebx
+     344:	68 00 1c 00 00       	push   $0x1c00
+     349:	57                   	push   %edi
+     34a:	e8 04 06 00 00       	call   953 <write>
+     34f:	83 c4 10             	add    $0x10,%esp
+     352:	39 d8                	cmp    %ebx,%eax
+     354:	0f 85 60 01 00 00    	jne    4ba <textbusytest+0x1da>
+  while((n = read(in, buf, sizeof(buf))) > 0)
+     35a:	83 ec 04             	sub    $0x4,%esp
+     35d:	68 00 02 00 00       	push   $0x200
+     362:	68 00 1c 00 00       	push   $0x1c00
+     367:	56                   	push   %esi
+     368:	e8 de 05 00 00       	call   94b <read>
+     36d:	83 c4 10             	add    $0x10,%esp
+     370:	89 c3                	mov    %eax,%ebx
+     372:	85 c0                	test   %eax,%eax
+     374:	7f ca                	jg     340 <textbusytest+0x60>
+  close(in);
+     376:	83 ec 0c             	sub    $0xc,%esp
+     379:	56                   	push   %esi
+     37a:	e8 dc 05 00 00       	call   95b <close>
+  close(fd);
+     37f:	89 3c 24             	mov    %edi,(%esp)
+     382:	e8 d4 05 00 00       	call   95b <close>
+  if(pipe(to) < 0 || pipe(from) < 0){
+     387:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     38a:	89 04 24             	mov    %eax,(%esp)
+     38d:	e8 b1 05 00 00       	call   943 <pipe>
+     392:	83 c4 10             	add    $0x10,%esp
+     395:	85 c0                	test   %eax,%eax
+     397:	0f 88 df 01 00 00    	js     57c <textbusytest+0x29c>
+     39d:	83 ec 0c             	sub    $0xc,%esp
+     3a0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     3a3:	50                   	push   %eax
+     3a4:	e8 9a 05 00 00       	call   943 <pipe>
+     3a9:	83 c4 10             	add    $0x10,%esp
+     3ac:	85 c0                	test   %eax,%eax
+     3ae:	0f 88 c8 01 00 00    	js     57c <textbusytest+0x29c>
+  if((pid = fork()) < 0){
+     3b4:	e8 d7 01 00 00       	call   590 <fork>
+     3b9:	85 c0                	test   %eax,%eax
+     3bb:	0f 88 a8 01 00 00    	js     569 <textbusytest+0x289>
+  if(pid == 0){
+     3c1:	0f 84 1b 01 00 00    	je     4e2 <textbusytest+0x202>
+  close(to[0]);
+     3c7:	83 ec 0c             	sub    $0xc,%esp
+     3ca:	ff 75 d8             	push   -0x28(%ebp)
+     3cd:	e8 89 05 00 00       	call   95b <close>
+  close(from[1]);
+     3d2:	58                   	pop    %eax
+     3d3:	ff 75 e4             	push   -0x1c(%ebp)
+     3d6:	e8 80 05 00 00       	call   95b <close>
+  if(write(to[1], "x", 1) != 1 || read(from[0], &c, 1) != 1 || c != 'x'){
+     3db:	83 c4 0c             	add    $0xc,%esp
+     3de:	6a 01                	push   $0x1
+     3e0:	68 8d 15 00 00       	push   $0x158d
+     3e5:	ff 75 dc             	push   -0x24(%ebp)
+     3e8:	e8 66 05 00 00       	call   953 <write>
+     3ed:	83 c4 10             	add    $0x10,%esp
+     3f0:	83 f8 01             	cmp    $0x1,%eax
+     3f3:	0f 85 d5 00 00 00    	jne    4ce <textbusytest+0x1ee>
+     3f9:	83 ec 04             	sub    $0x4,%esp
+     3fc:	8d 45 cf             	lea    -0x31(%ebp),%eax
+     3ff:	6a 01                	push   $0x1
+     401:	50                   	push   %eax
+     402:	ff 75 e0             	push   -0x20(%ebp)
+     405:	e8 41 05 00 00       	call   94b <read>
+     40a:	83 c4 10             	add    $0x10,%esp
+     40d:	83 f8 01             	cmp    $0x1,%eax
+     410:	0f 85 b8 00 00 00    	jne    4ce <textbusytest+0x1ee>
+     416:	80 7d cf 78          	cmpb   $0x78,-0x31(%ebp)
+     41a:	0f 85 ae 00 00 00    	jne    4ce <textbusytest+0x1ee>
+  fd = open("txtbusy", O_WRONLY);
+     420:	83 ec 08             	sub    $0x8,%esp
+     423:	6a 01                	push   $0x1
+     425:	68 1d 15 00 00       	push   $0x151d
+     42a:	e8 44 05 00 00       	call   973 <open>
+  if(fd < 0 || write(fd, "x", 1) >= 0){
+     42f:	83 c4 10             	add    $0x10,%esp
+  fd = open("txtbusy", O_WRONLY);
+     432:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || write(fd, "x", 1) >= 0){
+     434:	85 c0                	test   %eax,%eax
+     436:	0f 88 1a 01 00 00    	js     556 <textbusytest+0x276>
+     43c:	83 ec 04             	sub    $0x4,%esp
+     43f:	6a 01                	push   $0x1
+     441:	68 8d 15 00 00       	push   $0x158d
+     446:	50                   	push   %eax
+     447:	e8 07 05 00 00       	call   953 <write>
+     44c:	83 c4 10             	add    $0x10,%esp
+     44f:	85 c0                	test   %eax,%eax
+     451:	0f 89 ff 00 00 00    	jns    556 <textbusytest+0x276>
+  close(to[1]);
+     457:	83 ec 0c             	sub    $0xc,%esp
+     45a:	ff 75 dc             	push   -0x24(%ebp)
+     45d:	e8 f9 04 00 00       	call   95b <close>
+  close(from[0]);
+     462:	5e                   	pop    %esi
+     463:	ff 75 e0             	push   -0x20(%ebp)
+     466:	e8 f0 04 00 00       	call   95b <close>
+  wait();
+     46b:	e8 cb 04 00 00       	call   93b <wait>
+  if(write(fd, "x", 1) != 1){
+     470:	83 c4 0c             	add    $0xc,%esp
+     473:	6a 01                	push   $0x1
+     475:	68 8d 15 00 00       	push   $0x158d
+     47a:	53                   	push   %ebx
+     47b:	e8 d3 04 00 00       	call   953 <write>
+     480:	83 c4 10             	add    $0x10,%esp
+     483:	83 f8 01             	cmp    $0x1,%eax
+     486:	0f 85 b7 00 00 00    	jne    543 <textbusytest+0x263>
+  close(fd);
+     48c:	83 ec 0c             	sub    $0xc,%esp
+     48f:	53                   	push   %ebx
+     490:	e8 c6 04 00 00       	call   95b <close>
+  unlink("txtbusy");
+     495:	c7 04 24 1d 15 00 00 	movl   $0x151d,(%esp)
+     49c:	e8 e2 04 00 00       	call   983 <unlink>
+  printf(1, "text busy test OK\n");
+     4a1:	58                   	pop    %eax
+     4a2:	5a                   	pop    %edx
+     4a3:	68 ab 15 00 00       	push   $0x15ab
+     4a8:	6a 01                	push   $0x1
+     4aa:	e8 01 08 00 00       	call   cb0 <printf>
+}
+     4af:	83 c4 10             	add    $0x10,%esp
+     4b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4b5:	5b                   	pop    %ebx
+     4b6:	5e                   	pop    %esi
+     4b7:	5f                   	pop    %edi
+     4b8:	5d                   	pop    %ebp
+     4b9:	c3                   	ret
+    printf(1, "text busy test copy failed\n");
+     4ba:	83 ec 08             	sub    $0x8,%esp
+     4bd:	68 39 15 00 00       	push   $0x1539
+     4c2:	6a 01                	push   $0x1
+     4c4:	e8 e7 07 00 00       	call   cb0 <printf>
+    exit();
+     4c9:	e8 f2 00 00 00       	call   5c0 <exit>
+    printf(1, "text busy test exec failed\n");
+     4ce:	83 ec 08             	sub    $0x8,%esp
+     4d1:	68 8f 15 00 00       	push   $0x158f
+     4d6:	6a 01                	push   $0x1
+     4d8:	e8 d3 07 00 00       	call   cb0 <printf>
+    exit();
+     4dd:	e8 de 00 00 00       	call   5c0 <exit>
+    close(0);
+     4e2:	83 ec 0c             	sub    $0xc,%esp
+     4e5:	6a 00                	push   $0x0
+     4e7:	e8 6f 04 00 00       	call   95b <close>
+    dup(to[0]);
+     4ec:	58                   	pop    %eax
+     4ed:	ff 75 d8             	push   -0x28(%ebp)
+     4f0:	e8 b6 04 00 00       	call   9ab <dup>
+    close(1);
+     4f5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     4fc:	e8 5a 04 00 00       	call   95b <close>
+    dup(from[1]);
+     501:	58                   	pop    %eax
+     502:	ff 75 e4             	push   -0x1c(%ebp)
+     505:	e8 a1 04 00 00       	call   9ab <dup>
+    close(to[0]);
+     50a:	58                   	pop    %eax
+     50b:	ff 75 d8             	push   -0x28(%ebp)
+     50e:	e8 48 04 00 00       	call   95b <close>
+    close(to[1]);
+     513:	58                   	pop    %eax
+     514:	ff 75 dc             	push   -0x24(%ebp)
+     517:	e8 3f 04 00 00       	call   95b <close>
+    close(from[0]);
+     51c:	5a                   	pop    %edx
+     51d:	ff 75 e0             	push   -0x20(%ebp)
+     520:	e8 36 04 00 00       	call   95b <close>
+    close(from[1]);
+     525:	59                   	pop    %ecx
+     526:	ff 75 e4             	push   -0x1c(%ebp)
+     529:	e8 2d 04 00 00       	call   95b <close>
+    exec("txtbusy", argv);
+     52e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     531:	5b                   	pop    %ebx
+     532:	5e                   	pop    %esi
+     533:	50                   	push   %eax
+     534:	68 1d 15 00 00       	push   $0x151d
+     539:	e8 a2 00 00 00       	call   5e0 <exec>
+    exit();
+     53e:	e8 7d 00 00 00       	call   5c0 <exit>
+    printf(1, "text busy test cannot write after exit\n");
+     543:	51                   	push   %ecx
+     544:	51                   	push   %ecx
+     545:	68 b0 16 00 00       	push   $0x16b0
+     54a:	6a 01                	push   $0x1
+     54c:	e8 5f 07 00 00       	call   cb0 <printf>
+    exit();
+     551:	e8 6a 00 00 00       	call   5c0 <exit>
+    printf(1, "text busy test wrote a running program\n");
+     556:	57                   	push   %edi
+     557:	57                   	push   %edi
+     558:	68 88 16 00 00       	push   $0x1688
+     55d:	6a 01                	push   $0x1
+     55f:	e8 4c 07 00 00       	call   cb0 <printf>
+    exit();
+     564:	e8 57 00 00 00       	call   5c0 <exit>
+    printf(1, "text busy test fork failed\n");
+     569:	57                   	push   %edi
+     56a:	57                   	push   %edi
+     56b:	68 71 15 00 00       	push   $0x1571
+     570:	6a 01                	push   $0x1
+     572:	e8 39 07 00 00       	call   cb0 <printf>
+    exit();
+     577:	e8 44 00 00 00       	call   5c0 <exit>
+    printf(1, "text busy test pipe failed\n");
+     57c:	50                   	push   %eax
+     57d:	50                   	push   %eax
+     57e:	68 55 15 00 00       	push   $0x1555
+     583:	6a 01                	push   $0x1
+     585:	e8 26 07 00 00       	call   cb0 <printf>
+    exit();
+     58a:	e8 31 00 00 00       	call   5c0 <exit>
+     58f:	90                   	nop
+
+00000590 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     590:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     595:	85 c0                	test   %eax,%eax
+     597:	74 17                	je     5b0 <fork+0x20>
+{
+     599:	55                   	push   %ebp
+     59a:	89 e5                	mov    %esp,%ebp
+     59c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     59f:	ff d0                	call   *%eax
+  return _fork();
+}
+     5a1:	c9                   	leave
+  return _fork();
+     5a2:	e9 84 03 00 00       	jmp    92b <_fork>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+     5b0:	e9 76 03 00 00       	jmp    92b <_fork>
+     5b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <exit>:
+
+int
+exit(void)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     5c6:	a1 00 1e 00 00       	mov    0x1e00,%eax
+     5cb:	85 c0                	test   %eax,%eax
+     5cd:	74 02                	je     5d1 <exit+0x11>
+    stdioflush();
+     5cf:	ff d0                	call   *%eax
+  _exit();
+     5d1:	e8 5d 03 00 00       	call   933 <_exit>
+     5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     5e0:	55                   	push   %ebp
+  if(stdioflush)
+     5e1:	a1 00 1e 00 00       	mov    0x1e00,%eax
+{
+     5e6:	89 e5                	mov    %esp,%ebp
+     5e8:	56                   	push   %esi
+     5e9:	53                   	push   %ebx
+     5ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     5f0:	85 c0                	test   %eax,%eax
+     5f2:	74 02                	je     5f6 <exec+0x16>
+    stdioflush();
+     5f4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     5f6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     5f9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     5fc:	5b                   	pop    %ebx
+     5fd:	5e                   	pop    %esi
+     5fe:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     5ff:	e9 67 03 00 00       	jmp    96b <_exec>
+     604:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     60f:	90                   	nop
+
+00000610 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+     615:	53                   	push   %ebx
+     616:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     619:	a1 00 1e 00 00       	mov    0x1e00,%eax
+{
+     61e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     621:	8b 75 0c             	mov    0xc(%ebp),%esi
+     624:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     627:	85 c0                	test   %eax,%eax
+     629:	74 02                	je     62d <spawn+0x1d>
+    stdioflush();
+     62b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     62d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     630:	89 75 0c             	mov    %esi,0xc(%ebp)
+     633:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     636:	83 c4 0c             	add    $0xc,%esp
+     639:	5b                   	pop    %ebx
+     63a:	5e                   	pop    %esi
+     63b:	5f                   	pop    %edi
+     63c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     63d:	e9 79 04 00 00       	jmp    abb <_spawn>
+     642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     650:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     651:	31 c0                	xor    %eax,%eax
+{
+     653:	89 e5                	mov    %esp,%ebp
+     655:	53                   	push   %ebx
+     656:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     660:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     664:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     667:	83 c0 01             	add    $0x1,%eax
+     66a:	84 d2                	test   %dl,%dl
+     66c:	75 f2                	jne    660 <strcpy+0x10>
+    ;
+  return os;
+}
+     66e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     671:	89 c8                	mov    %ecx,%eax
+     673:	c9                   	leave
+     674:	c3                   	ret
+     675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	53                   	push   %ebx
+     684:	8b 55 08             	mov    0x8(%ebp),%edx
+     687:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     68a:	0f b6 02             	movzbl (%edx),%eax
+     68d:	84 c0                	test   %al,%al
+     68f:	75 17                	jne    6a8 <strcmp+0x28>
+     691:	eb 3a                	jmp    6cd <strcmp+0x4d>
+     693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     697:	90                   	nop
+     698:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     69c:	83 c2 01             	add    $0x1,%edx
+     69f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6a2:	84 c0                	test   %al,%al
+     6a4:	74 1a                	je     6c0 <strcmp+0x40>
+    p++, q++;
+     6a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6a8:	0f b6 19             	movzbl (%ecx),%ebx
+     6ab:	38 c3                	cmp    %al,%bl
+     6ad:	74 e9                	je     698 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6af:	29 d8                	sub    %ebx,%eax
+}
+     6b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6b4:	c9                   	leave
+     6b5:	c3                   	ret
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6c4:	31 c0                	xor    %eax,%eax
+     6c6:	29 d8                	sub    %ebx,%eax
+}
+     6c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6cb:	c9                   	leave
+     6cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6cd:	0f b6 19             	movzbl (%ecx),%ebx
+     6d0:	31 c0                	xor    %eax,%eax
+     6d2:	eb db                	jmp    6af <strcmp+0x2f>
+     6d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+
+000006e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     6e6:	80 3a 00             	cmpb   $0x0,(%edx)
+     6e9:	74 15                	je     700 <strlen+0x20>
+     6eb:	31 c0                	xor    %eax,%eax
+     6ed:	8d 76 00             	lea    0x0(%esi),%esi
+     6f0:	83 c0 01             	add    $0x1,%eax
+     6f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6f7:	89 c1                	mov    %eax,%ecx
+     6f9:	75 f5                	jne    6f0 <strlen+0x10>
+    ;
+  return n;
+}
+     6fb:	89 c8                	mov    %ecx,%eax
+     6fd:	5d                   	pop    %ebp
+     6fe:	c3                   	ret
+     6ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+     700:	31 c9                	xor    %ecx,%ecx
+}
+     702:	5d                   	pop    %ebp
+     703:	89 c8                	mov    %ecx,%eax
+     705:	c3                   	ret
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     717:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     71a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     71d:	89 d7                	mov    %edx,%edi
+     71f:	fc                   	cld
+     720:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     722:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     725:	89 d0                	mov    %edx,%eax
+     727:	c9                   	leave
+     728:	c3                   	ret
+     729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     73a:	0f b6 10             	movzbl (%eax),%edx
+     73d:	84 d2                	test   %dl,%dl
+     73f:	75 12                	jne    753 <strchr+0x23>
+     741:	eb 1d                	jmp    760 <strchr+0x30>
+     743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     747:	90                   	nop
+     748:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     74c:	83 c0 01             	add    $0x1,%eax
+     74f:	84 d2                	test   %dl,%dl
+     751:	74 0d                	je     760 <strchr+0x30>
+    if(*s == c)
+     753:	38 d1                	cmp    %dl,%cl
+     755:	75 f1                	jne    748 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     757:	5d                   	pop    %ebp
+     758:	c3                   	ret
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     760:	31 c0                	xor    %eax,%eax
+}
+     762:	5d                   	pop    %ebp
+     763:	c3                   	ret
+     764:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     76f:	90                   	nop
+
+00000770 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	57                   	push   %edi
+     774:	56                   	push   %esi
+     775:	53                   	push   %ebx
+     776:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     779:	a1 00 1e 00 00       	mov    0x1e00,%eax
+{
+     77e:	8b 75 08             	mov    0x8(%ebp),%esi
+     781:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     784:	85 c0                	test   %eax,%eax
+     786:	74 02                	je     78a <gets+0x1a>
+    stdioflush();
+     788:	ff d0                	call   *%eax
+  if(in.size == 0)
+     78a:	a1 28 20 00 00       	mov    0x2028,%eax
+     78f:	85 c0                	test   %eax,%eax
+     791:	0f 84 99 00 00 00    	je     830 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     797:	31 db                	xor    %ebx,%ebx
+     799:	eb 21                	jmp    7bc <gets+0x4c>
+     79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     7a0:	8d 50 01             	lea    0x1(%eax),%edx
+     7a3:	0f b6 80 20 1e 00 00 	movzbl 0x1e20(%eax),%eax
+     7aa:	89 15 20 20 00 00    	mov    %edx,0x2020
+    buf[i++] = c;
+     7b0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7b4:	3c 0a                	cmp    $0xa,%al
+     7b6:	74 60                	je     818 <gets+0xa8>
+     7b8:	3c 0d                	cmp    $0xd,%al
+     7ba:	74 5c                	je     818 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     7bc:	89 da                	mov    %ebx,%edx
+     7be:	83 c3 01             	add    $0x1,%ebx
+     7c1:	39 fb                	cmp    %edi,%ebx
+     7c3:	7d 55                	jge    81a <gets+0xaa>
+    if(in.r == in.n){
+     7c5:	a1 20 20 00 00       	mov    0x2020,%eax
+     7ca:	3b 05 24 20 00 00    	cmp    0x2024,%eax
+     7d0:	75 ce                	jne    7a0 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     7d2:	83 ec 04             	sub    $0x4,%esp
+     7d5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     7d8:	c7 05 24 20 00 00 00 	movl   $0x0,0x2024
+     7df:	00 00 00 
+     7e2:	c7 05 20 20 00 00 00 	movl   $0x0,0x2020
+     7e9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     7ec:	ff 35 28 20 00 00    	push   0x2028
+     7f2:	68 20 1e 00 00       	push   $0x1e20
+     7f7:	6a 00                	push   $0x0
+     7f9:	e8 4d 01 00 00       	call   94b <read>
+     7fe:	83 c4 10             	add    $0x10,%esp
+     801:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     804:	85 c0                	test   %eax,%eax
+     806:	a3 24 20 00 00       	mov    %eax,0x2024
+     80b:	7e 56                	jle    863 <gets+0xf3>
+    c = in.buf[in.r++];
+     80d:	a1 20 20 00 00       	mov    0x2020,%eax
+     812:	eb 8c                	jmp    7a0 <gets+0x30>
+     814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     818:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     81a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     81e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     821:	89 f0                	mov    %esi,%eax
+     823:	5b                   	pop    %ebx
+     824:	5e                   	pop    %esi
+     825:	5f                   	pop    %edi
+     826:	5d                   	pop    %ebp
+     827:	c3                   	ret
+     828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     830:	83 ec 08             	sub    $0x8,%esp
+     833:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     836:	50                   	push   %eax
+     837:	6a 00                	push   $0x0
+     839:	e8 4d 01 00 00       	call   98b <fstat>
+     83e:	83 c4 10             	add    $0x10,%esp
+     841:	89 c2                	mov    %eax,%edx
+     843:	b8 01 00 00 00       	mov    $0x1,%eax
+     848:	85 d2                	test   %edx,%edx
+     84a:	75 0d                	jne    859 <gets+0xe9>
+     84c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     851:	ba 00 02 00 00       	mov    $0x200,%edx
+     856:	0f 44 c2             	cmove  %edx,%eax
+     859:	a3 28 20 00 00       	mov    %eax,0x2028
+     85e:	e9 34 ff ff ff       	jmp    797 <gets+0x27>
+        in.n = 0;
+     863:	c7 05 24 20 00 00 00 	movl   $0x0,0x2024
+     86a:	00 00 00 
+        break;
+     86d:	eb ab                	jmp    81a <gets+0xaa>
+     86f:	90                   	nop
+
+00000870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	56                   	push   %esi
+     874:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     875:	83 ec 08             	sub    $0x8,%esp
+     878:	6a 00                	push   $0x0
+     87a:	ff 75 08             	push   0x8(%ebp)
+     87d:	e8 f1 00 00 00       	call   973 <open>
+  if(fd < 0)
+     882:	83 c4 10             	add    $0x10,%esp
+     885:	85 c0                	test   %eax,%eax
+     887:	78 27                	js     8b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     889:	83 ec 08             	sub    $0x8,%esp
+     88c:	ff 75 0c             	push   0xc(%ebp)
+     88f:	89 c3                	mov    %eax,%ebx
+     891:	50                   	push   %eax
+     892:	e8 f4 00 00 00       	call   98b <fstat>
+  close(fd);
+     897:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     89a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     89c:	e8 ba 00 00 00       	call   95b <close>
+  return r;
+     8a1:	83 c4 10             	add    $0x10,%esp
+}
+     8a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8a7:	89 f0                	mov    %esi,%eax
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5d                   	pop    %ebp
+     8ac:	c3                   	ret
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     8b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8b5:	eb ed                	jmp    8a4 <stat+0x34>
+     8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	53                   	push   %ebx
+     8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     8c7:	0f be 02             	movsbl (%edx),%eax
+     8ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     8cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8d5:	77 1e                	ja     8f5 <atoi+0x35>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8e0:	83 c2 01             	add    $0x1,%edx
+     8e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8ea:	0f be 02             	movsbl (%edx),%eax
+     8ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8f0:	80 fb 09             	cmp    $0x9,%bl
+     8f3:	76 eb                	jbe    8e0 <atoi+0x20>
+  return n;
+}
+     8f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f8:	89 c8                	mov    %ecx,%eax
+     8fa:	c9                   	leave
+     8fb:	c3                   	ret
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	8b 45 10             	mov    0x10(%ebp),%eax
+     908:	8b 55 08             	mov    0x8(%ebp),%edx
+     90b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     90e:	85 c0                	test   %eax,%eax
+     910:	7e 13                	jle    925 <memmove+0x25>
+     912:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     914:	89 d7                	mov    %edx,%edi
+     916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     920:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     921:	39 f8                	cmp    %edi,%eax
+     923:	75 fb                	jne    920 <memmove+0x20>
+  return vdst;
+}
+     925:	5e                   	pop    %esi
+     926:	89 d0                	mov    %edx,%eax
+     928:	5f                   	pop    %edi
+     929:	5d                   	pop    %ebp
+     92a:	c3                   	ret
+
+0000092b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     92b:	b8 01 00 00 00       	mov    $0x1,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <_exit>:
+RAWSYSCALL(exit)
+     933:	b8 02 00 00 00       	mov    $0x2,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <wait>:
+SYSCALL(wait)
+     93b:	b8 03 00 00 00       	mov    $0x3,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <pipe>:
+SYSCALL(pipe)
+     943:	b8 04 00 00 00       	mov    $0x4,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <read>:
+SYSCALL(read)
+     94b:	b8 05 00 00 00       	mov    $0x5,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <write>:
+SYSCALL(write)
+     953:	b8 10 00 00 00       	mov    $0x10,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <close>:
+SYSCALL(close)
+     95b:	b8 15 00 00 00       	mov    $0x15,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <kill>:
+SYSCALL(kill)
+     963:	b8 06 00 00 00       	mov    $0x6,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <_exec>:
+RAWSYSCALL(exec)
+     96b:	b8 07 00 00 00       	mov    $0x7,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <open>:
+SYSCALL(open)
+     973:	b8 0f 00 00 00       	mov    $0xf,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <mknod>:
+SYSCALL(mknod)
+     97b:	b8 11 00 00 00       	mov    $0x11,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <unlink>:
+SYSCALL(unlink)
+     983:	b8 12 00 00 00       	mov    $0x12,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <fstat>:
+SYSCALL(fstat)
+     98b:	b8 08 00 00 00       	mov    $0x8,%eax
+     990:	cd 40                	int    $0x40
+     992:	c3                   	ret
+
+00000993 <link>:
+SYSCALL(link)
+     993:	b8 13 00 00 00       	mov    $0x13,%eax
+     998:	cd 40                	int    $0x40
+     99a:	c3                   	ret
+
+0000099b <mkdir>:
+SYSCALL(mkdir)
+     99b:	b8 14 00 00 00       	mov    $0x14,%eax
+     9a0:	cd 40                	int    $0x40
+     9a2:	c3                   	ret
+
+000009a3 <chdir>:
+SYSCALL(chdir)
+     9a3:	b8 09 00 00 00       	mov    $0x9,%eax
+     9a8:	cd 40                	int    $0x40
+     9aa:	c3                   	ret
+
+000009ab <dup>:
+SYSCALL(dup)
+     9ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9b0:	cd 40                	int    $0x40
+     9b2:	c3                   	ret
+
+000009b3 <getpid>:
+SYSCALL(getpid)
+     9b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9b8:	cd 40                	int    $0x40
+     9ba:	c3                   	ret
+
+000009bb <sbrk>:
+SYSCALL(sbrk)
+     9bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     9c0:	cd 40                	int    $0x40
+     9c2:	c3                   	ret
+
+000009c3 <sleep>:
+SYSCALL(sleep)
+     9c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     9c8:	cd 40                	int    $0x40
+     9ca:	c3                   	ret
+
+000009cb <uptime>:
+SYSCALL(uptime)
+     9cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     9d3:	b8 16 00 00 00       	mov    $0x16,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <get_parent_id>:
+SYSCALL(get_parent_id)
+     9db:	b8 17 00 00 00       	mov    $0x17,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <get_children>:
+SYSCALL(get_children)
+     9e3:	b8 18 00 00 00       	mov    $0x18,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <set_path>:
+SYSCALL(set_path)
+     9eb:	b8 19 00 00 00       	mov    $0x19,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <set_sleep>:
+SYSCALL(set_sleep)
+     9f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <get_time>:
+SYSCALL(get_time)
+     9fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <change_process_level>:
+SYSCALL(change_process_level)
+     a03:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     a0b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     a13:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <print_processes_info>:
+SYSCALL(print_processes_info)
+     a1b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <barrier_init>:
+
+SYSCALL(barrier_init)
+     a23:	b8 20 00 00 00       	mov    $0x20,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <barrier_wait>:
+SYSCALL(barrier_wait)
+     a2b:	b8 21 00 00 00       	mov    $0x21,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     a33:	b8 22 00 00 00       	mov    $0x22,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     a3b:	b8 23 00 00 00       	mov    $0x23,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <set_process_gang>:
+SYSCALL(set_process_gang)
+     a43:	b8 24 00 00 00       	mov    $0x24,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     a4b:	b8 25 00 00 00       	mov    $0x25,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <sem_create>:
+SYSCALL(sem_create)
+     a53:	b8 26 00 00 00       	mov    $0x26,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <event_create>:
+SYSCALL(event_create)
+     a5b:	b8 27 00 00 00       	mov    $0x27,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <sync_post>:
+SYSCALL(sync_post)
+     a63:	b8 28 00 00 00       	mov    $0x28,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <sync_wait>:
+SYSCALL(sync_wait)
+     a6b:	b8 29 00 00 00       	mov    $0x29,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <sync_close>:
+SYSCALL(sync_close)
+     a73:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <event_reset>:
+SYSCALL(event_reset)
+     a7b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     a83:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <mmap>:
+SYSCALL(mmap)
+     a8b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <munmap>:
+SYSCALL(munmap)
+     a93:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <shmget>:
+SYSCALL(shmget)
+     a9b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <shmat>:
+SYSCALL(shmat)
+     aa3:	b8 30 00 00 00       	mov    $0x30,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <shmdt>:
+SYSCALL(shmdt)
+     aab:	b8 31 00 00 00       	mov    $0x31,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <shmrm>:
+SYSCALL(shmrm)
+     ab3:	b8 32 00 00 00       	mov    $0x32,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <_spawn>:
+RAWSYSCALL(spawn)
+     abb:	b8 33 00 00 00       	mov    $0x33,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <memstat>:
+SYSCALL(memstat)
+     ac3:	b8 34 00 00 00       	mov    $0x34,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+     acb:	66 90                	xchg   %ax,%ax
+     acd:	66 90                	xchg   %ax,%ax
+     acf:	90                   	nop
+
+00000ad0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     ad6:	a1 68 22 00 00       	mov    0x2268,%eax
+     adb:	85 c0                	test   %eax,%eax
+     add:	7e 17                	jle    af6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     adf:	83 ec 04             	sub    $0x4,%esp
+     ae2:	50                   	push   %eax
+     ae3:	68 6c 22 00 00       	push   $0x226c
+     ae8:	ff 35 60 22 00 00    	push   0x2260
+     aee:	e8 60 fe ff ff       	call   953 <write>
+     af3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     af6:	c7 05 68 22 00 00 00 	movl   $0x0,0x2268
+     afd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     b00:	c7 05 64 22 00 00 00 	movl   $0x0,0x2264
+     b07:	00 00 00 
+}
+     b0a:	c9                   	leave
+     b0b:	c3                   	ret
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b10 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	57                   	push   %edi
+     b14:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     b16:	89 d1                	mov    %edx,%ecx
+{
+     b18:	56                   	push   %esi
+     b19:	53                   	push   %ebx
+     b1a:	89 c3                	mov    %eax,%ebx
+     b1c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     b1f:	85 d2                	test   %edx,%edx
+     b21:	0f 89 b9 00 00 00    	jns    be0 <printint+0xd0>
+     b27:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     b2b:	0f 84 af 00 00 00    	je     be0 <printint+0xd0>
+    x = -xx;
+     b31:	f7 d9                	neg    %ecx
+    neg = 1;
+     b33:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b38:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b3b:	31 f6                	xor    %esi,%esi
+     b3d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     b40:	89 c8                	mov    %ecx,%eax
+     b42:	31 d2                	xor    %edx,%edx
+     b44:	89 f3                	mov    %esi,%ebx
+     b46:	f7 f7                	div    %edi
+     b48:	8d 76 01             	lea    0x1(%esi),%esi
+     b4b:	0f b6 92 38 17 00 00 	movzbl 0x1738(%edx),%edx
+     b52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     b56:	89 ca                	mov    %ecx,%edx
+     b58:	89 c1                	mov    %eax,%ecx
+     b5a:	39 fa                	cmp    %edi,%edx
+     b5c:	73 e2                	jae    b40 <printint+0x30>
+  if(neg)
+     b5e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     b61:	89 d9                	mov    %ebx,%ecx
+     b63:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b66:	85 c0                	test   %eax,%eax
+     b68:	74 07                	je     b71 <printint+0x61>
+    buf[i++] = '-';
+     b6a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     b6f:	89 f1                	mov    %esi,%ecx
+     b71:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     b74:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     b76:	8d 43 0c             	lea    0xc(%ebx),%eax
+     b79:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b7c:	01 f7                	add    %esi,%edi
+     b7e:	eb 09                	jmp    b89 <printint+0x79>
+
+  while(--i >= 0)
+     b80:	8d 47 ff             	lea    -0x1(%edi),%eax
+     b83:	39 f7                	cmp    %esi,%edi
+     b85:	74 36                	je     bbd <printint+0xad>
+     b87:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     b89:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     b8c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     b8f:	8d 42 01             	lea    0x1(%edx),%eax
+     b92:	89 43 08             	mov    %eax,0x8(%ebx)
+     b95:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     b99:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b9e:	74 28                	je     bc8 <printint+0xb8>
+     ba0:	80 f9 0a             	cmp    $0xa,%cl
+     ba3:	75 db                	jne    b80 <printint+0x70>
+     ba5:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     ba9:	75 d5                	jne    b80 <printint+0x70>
+  if(b->n > 0)
+     bab:	85 c0                	test   %eax,%eax
+     bad:	7f 19                	jg     bc8 <printint+0xb8>
+  b->n = 0;
+     baf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     bb6:	8d 47 ff             	lea    -0x1(%edi),%eax
+     bb9:	39 f7                	cmp    %esi,%edi
+     bbb:	75 ca                	jne    b87 <printint+0x77>
+}
+     bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bc0:	5b                   	pop    %ebx
+     bc1:	5e                   	pop    %esi
+     bc2:	5f                   	pop    %edi
+     bc3:	5d                   	pop    %ebp
+     bc4:	c3                   	ret
+     bc5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     bc8:	83 ec 04             	sub    $0x4,%esp
+     bcb:	50                   	push   %eax
+     bcc:	ff 75 d4             	push   -0x2c(%ebp)
+     bcf:	ff 33                	push   (%ebx)
+     bd1:	e8 7d fd ff ff       	call   953 <write>
+     bd6:	83 c4 10             	add    $0x10,%esp
+     bd9:	eb d4                	jmp    baf <printint+0x9f>
+     bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bdf:	90                   	nop
+  neg = 0;
+     be0:	31 c0                	xor    %eax,%eax
+     be2:	e9 51 ff ff ff       	jmp    b38 <printint+0x28>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+
+00000bf0 <putc>:
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	53                   	push   %ebx
+     bf4:	89 c3                	mov    %eax,%ebx
+     bf6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     bf9:	8b 48 08             	mov    0x8(%eax),%ecx
+     bfc:	8d 41 01             	lea    0x1(%ecx),%eax
+     bff:	89 43 08             	mov    %eax,0x8(%ebx)
+     c02:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     c06:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c0b:	74 33                	je     c40 <putc+0x50>
+     c0d:	80 fa 0a             	cmp    $0xa,%dl
+     c10:	74 0e                	je     c20 <putc+0x30>
+}
+     c12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c15:	c9                   	leave
+     c16:	c3                   	ret
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     c20:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     c24:	75 ec                	jne    c12 <putc+0x22>
+  if(b->n > 0)
+     c26:	85 c0                	test   %eax,%eax
+     c28:	7f 16                	jg     c40 <putc+0x50>
+  b->n = 0;
+     c2a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c34:	c9                   	leave
+     c35:	c3                   	ret
+     c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     c40:	83 ec 04             	sub    $0x4,%esp
+     c43:	50                   	push   %eax
+     c44:	8d 43 0c             	lea    0xc(%ebx),%eax
+     c47:	50                   	push   %eax
+     c48:	ff 33                	push   (%ebx)
+     c4a:	e8 04 fd ff ff       	call   953 <write>
+     c4f:	83 c4 10             	add    $0x10,%esp
+     c52:	eb d6                	jmp    c2a <putc+0x3a>
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <fflush>:
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     c66:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     c6a:	74 04                	je     c70 <fflush+0x10>
+}
+     c6c:	c9                   	leave
+     c6d:	c3                   	ret
+     c6e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     c70:	a1 68 22 00 00       	mov    0x2268,%eax
+     c75:	85 c0                	test   %eax,%eax
+     c77:	7f 17                	jg     c90 <fflush+0x30>
+  b->n = 0;
+     c79:	c7 05 68 22 00 00 00 	movl   $0x0,0x2268
+     c80:	00 00 00 
+  out.mode = 0;
+     c83:	c7 05 64 22 00 00 00 	movl   $0x0,0x2264
+     c8a:	00 00 00 
+}
+     c8d:	c9                   	leave
+     c8e:	c3                   	ret
+     c8f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     c90:	83 ec 04             	sub    $0x4,%esp
+     c93:	50                   	push   %eax
+     c94:	68 6c 22 00 00       	push   $0x226c
+     c99:	ff 35 60 22 00 00    	push   0x2260
+     c9f:	e8 af fc ff ff       	call   953 <write>
+     ca4:	83 c4 10             	add    $0x10,%esp
+     ca7:	eb d0                	jmp    c79 <fflush+0x19>
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 3c             	sub    $0x3c,%esp
+     cb9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     cbf:	83 fe 01             	cmp    $0x1,%esi
+     cc2:	0f 84 60 01 00 00    	je     e28 <printf+0x178>
+    b->fd = fd;
+     cc8:	89 35 40 20 00 00    	mov    %esi,0x2040
+  for(i = 0; fmt[i]; i++){
+     cce:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     cd1:	bf 40 20 00 00       	mov    $0x2040,%edi
+  for(i = 0; fmt[i]; i++){
+     cd6:	84 c0                	test   %al,%al
+     cd8:	74 65                	je     d3f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     cda:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cdd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     ce0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     ce2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     ce5:	eb 1f                	jmp    d06 <printf+0x56>
+     ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cee:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     cf0:	83 f8 25             	cmp    $0x25,%eax
+     cf3:	74 3b                	je     d30 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     cf5:	89 f8                	mov    %edi,%eax
+     cf7:	e8 f4 fe ff ff       	call   bf0 <putc>
+  for(i = 0; fmt[i]; i++){
+     cfc:	0f b6 03             	movzbl (%ebx),%eax
+     cff:	83 c3 01             	add    $0x1,%ebx
+     d02:	84 c0                	test   %al,%al
+     d04:	74 39                	je     d3f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     d06:	0f be d0             	movsbl %al,%edx
+     d09:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     d0c:	85 f6                	test   %esi,%esi
+     d0e:	74 e0                	je     cf0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     d10:	83 fe 25             	cmp    $0x25,%esi
+     d13:	75 e7                	jne    cfc <printf+0x4c>
+      if(c == 'd'){
+     d15:	83 f8 25             	cmp    $0x25,%eax
+     d18:	74 57                	je     d71 <printf+0xc1>
+     d1a:	83 e8 63             	sub    $0x63,%eax
+     d1d:	83 f8 15             	cmp    $0x15,%eax
+     d20:	77 36                	ja     d58 <printf+0xa8>
+     d22:	ff 24 85 e0 16 00 00 	jmp    *0x16e0(,%eax,4)
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     d30:	0f b6 03             	movzbl (%ebx),%eax
+     d33:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     d36:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     d3b:	84 c0                	test   %al,%al
+     d3d:	75 c7                	jne    d06 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     d3f:	8b 47 04             	mov    0x4(%edi),%eax
+     d42:	85 c0                	test   %eax,%eax
+     d44:	0f 84 06 01 00 00    	je     e50 <printf+0x1a0>
+    bflush(b);
+}
+     d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d4d:	5b                   	pop    %ebx
+     d4e:	5e                   	pop    %esi
+     d4f:	5f                   	pop    %edi
+     d50:	5d                   	pop    %ebp
+     d51:	c3                   	ret
+     d52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     d58:	8b 4f 08             	mov    0x8(%edi),%ecx
+     d5b:	8d 41 01             	lea    0x1(%ecx),%eax
+     d5e:	89 47 08             	mov    %eax,0x8(%edi)
+     d61:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     d66:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d6b:	0f 84 77 01 00 00    	je     ee8 <printf+0x238>
+        putc(b, c);
+     d71:	89 f8                	mov    %edi,%eax
+      state = 0;
+     d73:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     d75:	e8 76 fe ff ff       	call   bf0 <putc>
+     d7a:	eb 80                	jmp    cfc <printf+0x4c>
+     d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     d80:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     d83:	83 ec 0c             	sub    $0xc,%esp
+     d86:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d8b:	8b 16                	mov    (%esi),%edx
+     d8d:	6a 00                	push   $0x0
+        ap++;
+     d8f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     d92:	89 f8                	mov    %edi,%eax
+     d94:	e8 77 fd ff ff       	call   b10 <printint>
+        ap++;
+     d99:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     d9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d9f:	31 f6                	xor    %esi,%esi
+     da1:	e9 56 ff ff ff       	jmp    cfc <printf+0x4c>
+     da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     db0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     db3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     db5:	83 c0 04             	add    $0x4,%eax
+     db8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     dbb:	85 c9                	test   %ecx,%ecx
+     dbd:	0f 84 cd 00 00 00    	je     e90 <printf+0x1e0>
+        while(*s != 0){
+     dc3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     dc6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     dc8:	84 d2                	test   %dl,%dl
+     dca:	0f 84 2c ff ff ff    	je     cfc <printf+0x4c>
+          putc(b, *s);
+     dd0:	89 f8                	mov    %edi,%eax
+     dd2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     dd5:	e8 16 fe ff ff       	call   bf0 <putc>
+          s++;
+     dda:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     ddd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     de1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     de4:	84 d2                	test   %dl,%dl
+     de6:	75 e8                	jne    dd0 <printf+0x120>
+      state = 0;
+     de8:	31 f6                	xor    %esi,%esi
+     dea:	e9 0d ff ff ff       	jmp    cfc <printf+0x4c>
+     def:	90                   	nop
+        printint(b, *ap, 10, 1);
+     df0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     df3:	83 ec 0c             	sub    $0xc,%esp
+     df6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     dfb:	8b 16                	mov    (%esi),%edx
+     dfd:	6a 01                	push   $0x1
+     dff:	eb 8e                	jmp    d8f <printf+0xdf>
+     e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     e08:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e0b:	89 f8                	mov    %edi,%eax
+     e0d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     e10:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     e13:	e8 d8 fd ff ff       	call   bf0 <putc>
+        ap++;
+     e18:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     e1b:	31 f6                	xor    %esi,%esi
+     e1d:	e9 da fe ff ff       	jmp    cfc <printf+0x4c>
+     e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     e28:	8b 15 64 22 00 00    	mov    0x2264,%edx
+     e2e:	85 d2                	test   %edx,%edx
+     e30:	74 6e                	je     ea0 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     e32:	0f b6 03             	movzbl (%ebx),%eax
+     e35:	bf 60 22 00 00       	mov    $0x2260,%edi
+     e3a:	84 c0                	test   %al,%al
+     e3c:	0f 85 98 fe ff ff    	jne    cda <printf+0x2a>
+     e42:	e9 03 ff ff ff       	jmp    d4a <printf+0x9a>
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     e50:	8b 47 08             	mov    0x8(%edi),%eax
+     e53:	85 c0                	test   %eax,%eax
+     e55:	7f 19                	jg     e70 <printf+0x1c0>
+  b->n = 0;
+     e57:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     e5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e61:	5b                   	pop    %ebx
+     e62:	5e                   	pop    %esi
+     e63:	5f                   	pop    %edi
+     e64:	5d                   	pop    %ebp
+     e65:	c3                   	ret
+     e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     e70:	83 ec 04             	sub    $0x4,%esp
+     e73:	50                   	push   %eax
+     e74:	8d 47 0c             	lea    0xc(%edi),%eax
+     e77:	50                   	push   %eax
+     e78:	ff 37                	push   (%edi)
+     e7a:	e8 d4 fa ff ff       	call   953 <write>
+  b->n = 0;
+     e7f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     e86:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     e89:	eb d3                	jmp    e5e <printf+0x1ae>
+     e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+     e90:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     e95:	b9 d8 16 00 00       	mov    $0x16d8,%ecx
+     e9a:	e9 31 ff ff ff       	jmp    dd0 <printf+0x120>
+     e9f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ea0:	83 ec 08             	sub    $0x8,%esp
+     ea3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     ea6:	c7 05 60 22 00 00 01 	movl   $0x1,0x2260
+     ead:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     eb0:	50                   	push   %eax
+     eb1:	6a 01                	push   $0x1
+     eb3:	e8 d3 fa ff ff       	call   98b <fstat>
+     eb8:	83 c4 10             	add    $0x10,%esp
+     ebb:	85 c0                	test   %eax,%eax
+     ebd:	75 22                	jne    ee1 <printf+0x231>
+     ebf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     ec4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ec9:	0f 45 f0             	cmovne %eax,%esi
+     ecc:	89 35 64 22 00 00    	mov    %esi,0x2264
+      stdioflush = flushout;
+     ed2:	c7 05 00 1e 00 00 d0 	movl   $0xad0,0x1e00
+     ed9:	0a 00 00 
+     edc:	e9 51 ff ff ff       	jmp    e32 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ee1:	be 02 00 00 00       	mov    $0x2,%esi
+     ee6:	eb e4                	jmp    ecc <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     ee8:	83 ec 04             	sub    $0x4,%esp
+     eeb:	8d 47 0c             	lea    0xc(%edi),%eax
+     eee:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     ef1:	68 00 02 00 00       	push   $0x200
+     ef6:	50                   	push   %eax
+     ef7:	ff 37                	push   (%edi)
+     ef9:	e8 55 fa ff ff       	call   953 <write>
+  b->n = 0;
+     efe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     f05:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     f08:	83 c4 10             	add    $0x10,%esp
+     f0b:	e9 61 fe ff ff       	jmp    d71 <printf+0xc1>
+
+00000f10 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     f10:	55                   	push   %ebp
+     f11:	89 e5                	mov    %esp,%ebp
+     f13:	56                   	push   %esi
+     f14:	53                   	push   %ebx
+     f15:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     f17:	a1 80 24 00 00       	mov    0x2480,%eax
+     f1c:	39 d8                	cmp    %ebx,%eax
+     f1e:	0f 83 e4 00 00 00    	jae    1008 <freepages+0xf8>
+     f24:	85 c0                	test   %eax,%eax
+     f26:	0f 84 dc 00 00 00    	je     1008 <freepages+0xf8>
+     f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f30:	89 c2                	mov    %eax,%edx
+     f32:	8b 00                	mov    (%eax),%eax
+     f34:	85 c0                	test   %eax,%eax
+     f36:	74 04                	je     f3c <freepages+0x2c>
+     f38:	39 d8                	cmp    %ebx,%eax
+     f3a:	72 f4                	jb     f30 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     f3c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     f3f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     f41:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     f43:	85 c0                	test   %eax,%eax
+     f45:	74 15                	je     f5c <freepages+0x4c>
+    p->prev = s;
+     f47:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     f4a:	8b 73 10             	mov    0x10(%ebx),%esi
+     f4d:	89 f1                	mov    %esi,%ecx
+     f4f:	c1 e1 0c             	shl    $0xc,%ecx
+     f52:	01 d9                	add    %ebx,%ecx
+     f54:	39 c8                	cmp    %ecx,%eax
+     f56:	0f 84 d8 00 00 00    	je     1034 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     f5c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     f5f:	89 c8                	mov    %ecx,%eax
+     f61:	c1 e0 0c             	shl    $0xc,%eax
+     f64:	01 d0                	add    %edx,%eax
+     f66:	39 c3                	cmp    %eax,%ebx
+     f68:	74 16                	je     f80 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     f6a:	8b 03                	mov    (%ebx),%eax
+     f6c:	85 c0                	test   %eax,%eax
+     f6e:	74 40                	je     fb0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     f70:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f73:	5b                   	pop    %ebx
+     f74:	5e                   	pop    %esi
+     f75:	5d                   	pop    %ebp
+     f76:	c3                   	ret
+     f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     f80:	03 4b 10             	add    0x10(%ebx),%ecx
+     f83:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     f86:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     f89:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     f8b:	85 c9                	test   %ecx,%ecx
+     f8d:	0f 84 dd 00 00 00    	je     1070 <freepages+0x160>
+    s->prev->next = s->next;
+     f93:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     f95:	85 c0                	test   %eax,%eax
+     f97:	74 06                	je     f9f <freepages+0x8f>
+    s->next->prev = s->prev;
+     f99:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     f9c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     f9f:	8b 02                	mov    (%edx),%eax
+     fa1:	89 d3                	mov    %edx,%ebx
+     fa3:	85 c0                	test   %eax,%eax
+     fa5:	75 c9                	jne    f70 <freepages+0x60>
+     fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fae:	66 90                	xchg   %ax,%ax
+     fb0:	8b 43 10             	mov    0x10(%ebx),%eax
+     fb3:	83 f8 0f             	cmp    $0xf,%eax
+     fb6:	76 b8                	jbe    f70 <freepages+0x60>
+     fb8:	83 ec 0c             	sub    $0xc,%esp
+     fbb:	c1 e0 0c             	shl    $0xc,%eax
+     fbe:	6a 00                	push   $0x0
+     fc0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     fc3:	e8 f3 f9 ff ff       	call   9bb <sbrk>
+     fc8:	83 c4 10             	add    $0x10,%esp
+     fcb:	39 c6                	cmp    %eax,%esi
+     fcd:	75 a1                	jne    f70 <freepages+0x60>
+  if(s->prev)
+     fcf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     fd2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     fd4:	85 d2                	test   %edx,%edx
+     fd6:	0f 84 a5 00 00 00    	je     1081 <freepages+0x171>
+    s->prev->next = s->next;
+     fdc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     fde:	85 c0                	test   %eax,%eax
+     fe0:	74 06                	je     fe8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     fe2:	8b 53 04             	mov    0x4(%ebx),%edx
+     fe5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     fe8:	8b 43 10             	mov    0x10(%ebx),%eax
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	c1 e0 0c             	shl    $0xc,%eax
+     ff1:	f7 d8                	neg    %eax
+     ff3:	50                   	push   %eax
+     ff4:	e8 c2 f9 ff ff       	call   9bb <sbrk>
+     ff9:	83 c4 10             	add    $0x10,%esp
+}
+     ffc:	e9 6f ff ff ff       	jmp    f70 <freepages+0x60>
+    1001:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+    1008:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+    100f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+    1011:	89 1d 80 24 00 00    	mov    %ebx,0x2480
+  if(p)
+    1017:	85 c0                	test   %eax,%eax
+    1019:	74 95                	je     fb0 <freepages+0xa0>
+    p->prev = s;
+    101b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+    101e:	8b 73 10             	mov    0x10(%ebx),%esi
+    1021:	89 f2                	mov    %esi,%edx
+    1023:	c1 e2 0c             	shl    $0xc,%edx
+    1026:	01 da                	add    %ebx,%edx
+    1028:	39 d0                	cmp    %edx,%eax
+    102a:	0f 85 3a ff ff ff    	jne    f6a <freepages+0x5a>
+    1030:	89 c1                	mov    %eax,%ecx
+    1032:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+    1034:	8b 41 10             	mov    0x10(%ecx),%eax
+    1037:	01 f0                	add    %esi,%eax
+    1039:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+    103c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+    103f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+    1041:	85 f6                	test   %esi,%esi
+    1043:	74 35                	je     107a <freepages+0x16a>
+    s->prev->next = s->next;
+    1045:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+    1047:	85 c0                	test   %eax,%eax
+    1049:	74 06                	je     1051 <freepages+0x141>
+    s->next->prev = s->prev;
+    104b:	8b 49 04             	mov    0x4(%ecx),%ecx
+    104e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+    1051:	85 d2                	test   %edx,%edx
+    1053:	0f 84 11 ff ff ff    	je     f6a <freepages+0x5a>
+    1059:	8b 4a 10             	mov    0x10(%edx),%ecx
+    105c:	89 c8                	mov    %ecx,%eax
+    105e:	c1 e0 0c             	shl    $0xc,%eax
+    1061:	01 d0                	add    %edx,%eax
+    1063:	39 c3                	cmp    %eax,%ebx
+    1065:	0f 85 ff fe ff ff    	jne    f6a <freepages+0x5a>
+    106b:	e9 10 ff ff ff       	jmp    f80 <freepages+0x70>
+    *l = s->next;
+    1070:	a3 80 24 00 00       	mov    %eax,0x2480
+    1075:	e9 1b ff ff ff       	jmp    f95 <freepages+0x85>
+    107a:	a3 80 24 00 00       	mov    %eax,0x2480
+    107f:	eb c6                	jmp    1047 <freepages+0x137>
+    1081:	a3 80 24 00 00       	mov    %eax,0x2480
+    1086:	e9 53 ff ff ff       	jmp    fde <freepages+0xce>
+    108b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    108f:	90                   	nop
+
+00001090 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	56                   	push   %esi
+    1094:	53                   	push   %ebx
+    1095:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+    1097:	a1 80 24 00 00       	mov    0x2480,%eax
+    109c:	85 c0                	test   %eax,%eax
+    109e:	74 5e                	je     10fe <getpages+0x6e>
+    if(s->npages < n)
+    10a0:	8b 50 10             	mov    0x10(%eax),%edx
+    10a3:	39 da                	cmp    %ebx,%edx
+    10a5:	72 51                	jb     10f8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+    10a7:	39 d3                	cmp    %edx,%ebx
+    10a9:	72 25                	jb     10d0 <getpages+0x40>
+  if(s->prev)
+    10ab:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+    10ae:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+    10b0:	85 c9                	test   %ecx,%ecx
+    10b2:	0f 84 a8 00 00 00    	je     1160 <getpages+0xd0>
+    s->prev->next = s->next;
+    10b8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+    10ba:	85 d2                	test   %edx,%edx
+    10bc:	74 06                	je     10c4 <getpages+0x34>
+    s->next->prev = s->prev;
+    10be:	8b 48 04             	mov    0x4(%eax),%ecx
+    10c1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+    10c4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+    10c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10ca:	5b                   	pop    %ebx
+    10cb:	5e                   	pop    %esi
+    10cc:	5d                   	pop    %ebp
+    10cd:	c3                   	ret
+    10ce:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    10d0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+    10d2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    10d4:	c1 e1 0c             	shl    $0xc,%ecx
+    10d7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+    10d9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+    10dc:	8b 70 04             	mov    0x4(%eax),%esi
+    10df:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+    10e2:	8b 10                	mov    (%eax),%edx
+    10e4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+    10e6:	85 f6                	test   %esi,%esi
+    10e8:	74 66                	je     1150 <getpages+0xc0>
+        rest->prev->next = rest;
+    10ea:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+    10ec:	8b 11                	mov    (%ecx),%edx
+    10ee:	85 d2                	test   %edx,%edx
+    10f0:	75 cf                	jne    10c1 <getpages+0x31>
+    10f2:	eb d0                	jmp    10c4 <getpages+0x34>
+    10f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+    10f8:	8b 00                	mov    (%eax),%eax
+    10fa:	85 c0                	test   %eax,%eax
+    10fc:	75 a2                	jne    10a0 <getpages+0x10>
+  brk = (uint)sbrk(0);
+    10fe:	83 ec 0c             	sub    $0xc,%esp
+    1101:	6a 00                	push   $0x0
+    1103:	e8 b3 f8 ff ff       	call   9bb <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1108:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+    110b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+    1111:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    1113:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+    1119:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    111f:	29 d0                	sub    %edx,%eax
+    1121:	c1 e8 0c             	shr    $0xc,%eax
+    1124:	39 d8                	cmp    %ebx,%eax
+    1126:	72 48                	jb     1170 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+    1128:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    112a:	89 d8                	mov    %ebx,%eax
+    112c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+    112f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    1131:	c1 e0 0c             	shl    $0xc,%eax
+    1134:	01 f0                	add    %esi,%eax
+    1136:	50                   	push   %eax
+    1137:	e8 7f f8 ff ff       	call   9bb <sbrk>
+    113c:	83 c4 10             	add    $0x10,%esp
+    113f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1142:	74 2c                	je     1170 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+    1144:	01 f0                	add    %esi,%eax
+    1146:	e9 79 ff ff ff       	jmp    10c4 <getpages+0x34>
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+        runs = rest;
+    1150:	89 0d 80 24 00 00    	mov    %ecx,0x2480
+    1156:	eb 96                	jmp    10ee <getpages+0x5e>
+    1158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115f:	90                   	nop
+    *l = s->next;
+    1160:	89 15 80 24 00 00    	mov    %edx,0x2480
+    1166:	e9 4f ff ff ff       	jmp    10ba <getpages+0x2a>
+    116b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    116f:	90                   	nop
+    return 0;
+    1170:	31 c0                	xor    %eax,%eax
+    1172:	e9 50 ff ff ff       	jmp    10c7 <getpages+0x37>
+    1177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117e:	66 90                	xchg   %ax,%ax
+
+00001180 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+    1185:	53                   	push   %ebx
+    1186:	83 ec 1c             	sub    $0x1c,%esp
+    1189:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+    118c:	85 c0                	test   %eax,%eax
+    118e:	0f 84 97 00 00 00    	je     122b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+    1194:	89 c3                	mov    %eax,%ebx
+    1196:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+    119c:	8b 73 14             	mov    0x14(%ebx),%esi
+    119f:	83 fe 01             	cmp    $0x1,%esi
+    11a2:	74 74                	je     1218 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    11a4:	85 f6                	test   %esi,%esi
+    11a6:	74 5d                	je     1205 <free+0x85>
+  if(s->free == 0)
+    11a8:	8b 53 08             	mov    0x8(%ebx),%edx
+    11ab:	85 d2                	test   %edx,%edx
+    11ad:	0f 84 85 00 00 00    	je     1238 <free+0xb8>
+  NEXTFREE(o) = s->free;
+    11b3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+    11b5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+    11b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+    11bb:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+    11be:	8b 04 f5 a4 24 00 00 	mov    0x24a4(,%esi,8),%eax
+  s->inuse--;
+    11c5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+    11c8:	83 c0 01             	add    $0x1,%eax
+    11cb:	89 04 f5 a4 24 00 00 	mov    %eax,0x24a4(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    11d2:	85 d2                	test   %edx,%edx
+    11d4:	75 55                	jne    122b <free+0xab>
+    11d6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+    11db:	89 f1                	mov    %esi,%ecx
+    11dd:	d3 ea                	shr    %cl,%edx
+    11df:	39 c2                	cmp    %eax,%edx
+    11e1:	73 7d                	jae    1260 <free+0xe0>
+  if(s->prev)
+    11e3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+    11e6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+    11e8:	85 ff                	test   %edi,%edi
+    11ea:	0f 84 a0 00 00 00    	je     1290 <free+0x110>
+    s->prev->next = s->next;
+    11f0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    11f2:	85 c9                	test   %ecx,%ecx
+    11f4:	74 06                	je     11fc <free+0x7c>
+    s->next->prev = s->prev;
+    11f6:	8b 7b 04             	mov    0x4(%ebx),%edi
+    11f9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    11fc:	29 d0                	sub    %edx,%eax
+    11fe:	89 04 f5 a4 24 00 00 	mov    %eax,0x24a4(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    1205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    1208:	89 d8                	mov    %ebx,%eax
+}
+    120a:	5b                   	pop    %ebx
+    120b:	5e                   	pop    %esi
+    120c:	5f                   	pop    %edi
+    120d:	5d                   	pop    %ebp
+    freepages(s);
+    120e:	e9 fd fc ff ff       	jmp    f10 <freepages>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    1218:	8b 43 10             	mov    0x10(%ebx),%eax
+    121b:	83 ec 08             	sub    $0x8,%esp
+    121e:	c1 e0 0c             	shl    $0xc,%eax
+    1221:	50                   	push   %eax
+    1222:	53                   	push   %ebx
+    1223:	e8 6b f8 ff ff       	call   a93 <munmap>
+    1228:	83 c4 10             	add    $0x10,%esp
+}
+    122b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    122e:	5b                   	pop    %ebx
+    122f:	5e                   	pop    %esi
+    1230:	5f                   	pop    %edi
+    1231:	5d                   	pop    %ebp
+    1232:	c3                   	ret
+    1233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1237:	90                   	nop
+  s->next = *l;
+    1238:	8b 14 f5 a0 24 00 00 	mov    0x24a0(,%esi,8),%edx
+  s->prev = 0;
+    123f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    1246:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    1248:	85 d2                	test   %edx,%edx
+    124a:	74 06                	je     1252 <free+0xd2>
+    (*l)->prev = s;
+    124c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    124f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1252:	89 1c f5 a0 24 00 00 	mov    %ebx,0x24a0(,%esi,8)
+}
+    1259:	e9 55 ff ff ff       	jmp    11b3 <free+0x33>
+    125e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1260:	83 ec 0c             	sub    $0xc,%esp
+    1263:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1266:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1269:	6a 00                	push   $0x0
+    126b:	c1 e7 0c             	shl    $0xc,%edi
+    126e:	01 df                	add    %ebx,%edi
+    1270:	e8 46 f7 ff ff       	call   9bb <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1275:	83 c4 10             	add    $0x10,%esp
+    1278:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    127b:	39 c7                	cmp    %eax,%edi
+    127d:	75 ac                	jne    122b <free+0xab>
+    127f:	8b 04 f5 a4 24 00 00 	mov    0x24a4(,%esi,8),%eax
+    1286:	e9 58 ff ff ff       	jmp    11e3 <free+0x63>
+    128b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+    *l = s->next;
+    1290:	89 0c f5 a0 24 00 00 	mov    %ecx,0x24a0(,%esi,8)
+    1297:	e9 56 ff ff ff       	jmp    11f2 <free+0x72>
+    129c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012a0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12a0:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    12a1:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    12a6:	89 e5                	mov    %esp,%ebp
+    12a8:	57                   	push   %edi
+    12a9:	56                   	push   %esi
+    12aa:	53                   	push   %ebx
+    12ab:	83 ec 1c             	sub    $0x1c,%esp
+    12ae:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    12b1:	83 f8 10             	cmp    $0x10,%eax
+    12b4:	0f 86 92 00 00 00    	jbe    134c <malloc+0xac>
+    12ba:	ba 01 00 00 00       	mov    $0x1,%edx
+    12bf:	eb 13                	jmp    12d4 <malloc+0x34>
+    12c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12c8:	89 d3                	mov    %edx,%ebx
+    12ca:	d3 e3                	shl    %cl,%ebx
+    12cc:	39 c3                	cmp    %eax,%ebx
+    12ce:	0f 83 84 00 00 00    	jae    1358 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    12d4:	83 c1 01             	add    $0x1,%ecx
+    12d7:	83 f9 0b             	cmp    $0xb,%ecx
+    12da:	75 ec                	jne    12c8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    12dc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    12e1:	0f 87 c9 00 00 00    	ja     13b0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    12e7:	05 17 10 00 00       	add    $0x1017,%eax
+    12ec:	89 c3                	mov    %eax,%ebx
+    12ee:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    12f1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    12f6:	77 28                	ja     1320 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    12f8:	89 d8                	mov    %ebx,%eax
+    12fa:	e8 91 fd ff ff       	call   1090 <getpages>
+    12ff:	85 c0                	test   %eax,%eax
+    1301:	0f 84 a9 00 00 00    	je     13b0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    1307:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    130e:	83 c0 18             	add    $0x18,%eax
+}
+    1311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1314:	5b                   	pop    %ebx
+    1315:	5e                   	pop    %esi
+    1316:	5f                   	pop    %edi
+    1317:	5d                   	pop    %ebp
+    1318:	c3                   	ret
+    1319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    1320:	89 d8                	mov    %ebx,%eax
+    1322:	83 ec 08             	sub    $0x8,%esp
+    1325:	c1 e0 0c             	shl    $0xc,%eax
+    1328:	6a 00                	push   $0x0
+    132a:	6a ff                	push   $0xffffffff
+    132c:	6a 22                	push   $0x22
+    132e:	6a 03                	push   $0x3
+    1330:	50                   	push   %eax
+    1331:	6a 00                	push   $0x0
+    1333:	e8 53 f7 ff ff       	call   a8b <mmap>
+    if(s == MAP_FAILED)
+    1338:	83 c4 20             	add    $0x20,%esp
+    133b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    133e:	74 b8                	je     12f8 <malloc+0x58>
+      s->shift = MAPRUN;
+    1340:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    1347:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    134a:	eb c2                	jmp    130e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    134c:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1358:	8b 34 cd a0 24 00 00 	mov    0x24a0(,%ecx,8),%esi
+    135f:	85 f6                	test   %esi,%esi
+    1361:	74 57                	je     13ba <malloc+0x11a>
+  classes[shift].nfree--;
+    1363:	8b 1c cd a4 24 00 00 	mov    0x24a4(,%ecx,8),%ebx
+  o = s->free;
+    136a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    136d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1370:	89 14 cd a4 24 00 00 	mov    %edx,0x24a4(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1377:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1379:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    137d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1380:	85 ff                	test   %edi,%edi
+    1382:	75 8d                	jne    1311 <malloc+0x71>
+  if(s->prev)
+    1384:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1387:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1389:	85 db                	test   %ebx,%ebx
+    138b:	0f 84 b7 00 00 00    	je     1448 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1391:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1393:	85 d2                	test   %edx,%edx
+    1395:	0f 84 76 ff ff ff    	je     1311 <malloc+0x71>
+    s->next->prev = s->prev;
+    139b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    139e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    13a1:	e9 6b ff ff ff       	jmp    1311 <malloc+0x71>
+    13a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ad:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    13b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    13b3:	31 c0                	xor    %eax,%eax
+}
+    13b5:	5b                   	pop    %ebx
+    13b6:	5e                   	pop    %esi
+    13b7:	5f                   	pop    %edi
+    13b8:	5d                   	pop    %ebp
+    13b9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    13ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    13bf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    13c2:	e8 c9 fc ff ff       	call   1090 <getpages>
+    13c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    13ca:	85 c0                	test   %eax,%eax
+    13cc:	89 c2                	mov    %eax,%edx
+    13ce:	74 e0                	je     13b0 <malloc+0x110>
+    s->shift = shift;
+    13d0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    13d3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    13d5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    13dc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    13e1:	89 df                	mov    %ebx,%edi
+    13e3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    13e5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    13e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    13ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    13ed:	83 e8 01             	sub    $0x1,%eax
+    13f0:	d3 e0                	shl    %cl,%eax
+    13f2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    13f5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    13f9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    13fc:	eb 04                	jmp    1402 <malloc+0x162>
+    13fe:	66 90                	xchg   %ax,%ax
+    1400:	89 c8                	mov    %ecx,%eax
+    1402:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1405:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1407:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    140a:	89 c6                	mov    %eax,%esi
+    140c:	39 da                	cmp    %ebx,%edx
+    140e:	7f f0                	jg     1400 <malloc+0x160>
+    1410:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1413:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1416:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1419:	8b 04 cd a0 24 00 00 	mov    0x24a0(,%ecx,8),%eax
+  s->prev = 0;
+    1420:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1427:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1429:	85 c0                	test   %eax,%eax
+    142b:	74 03                	je     1430 <malloc+0x190>
+    (*l)->prev = s;
+    142d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1430:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1433:	89 14 cd a0 24 00 00 	mov    %edx,0x24a0(,%ecx,8)
+    classes[shift].nfree += n;
+    143a:	89 d6                	mov    %edx,%esi
+    143c:	03 1c cd a4 24 00 00 	add    0x24a4(,%ecx,8),%ebx
+    1443:	e9 22 ff ff ff       	jmp    136a <malloc+0xca>
+    *l = s->next;
+    1448:	89 14 cd a0 24 00 00 	mov    %edx,0x24a0(,%ecx,8)
+    144f:	e9 3f ff ff ff       	jmp    1393 <malloc+0xf3>
@@ -0,0 +1,160 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "spawn.h"
+
+// Tests of spawn, exec and the command search path, kept
+// apart from usertests, which must stay small enough for mkfs
+// to store.
+
+char buf[512];
+char *echoargv[] = { "echo", "ALL", "TESTS", "PASSED", 0 };
+
+// spawn runs a program with its output redirected.
+void
+spawntest(void)
+{
+  struct spawn_action act[2];
+  int fd, n;
+
+  printf(1, "spawn test\n");
+  act[0].op = SPAWN_OPEN;
+  act[0].fd = 1;
+  act[0].path = "spawnout";
+  act[0].mode = O_CREATE|O_WRONLY;
+  act[1].op = SPAWN_END;
+  if(spawn("echo", echoargv, act) < 0){
+    printf(1, "spawn test spawn failed\n");
+    exit();
+  }
+  wait();
+  fd = open("spawnout", O_RDONLY);
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  unlink("spawnout");
+  buf[n < 0 ? 0 : n] = 0;
+  if(strcmp(buf, "ALL TESTS PASSED\n") != 0){
+    printf(1, "spawn test wrong output\n");
+    exit();
+  }
+  if(spawn("nosuchprogram", echoargv, 0) >= 0){
+    printf(1, "spawn test spawned a missing program\n");
+    exit();
+  }
+  printf(1, "spawn test OK\n");
+}
+
+// Bare command names are searched for in the path set with
+// set_path, and directory changes are seen at once.
+void
+pathtest(void)
+{
+  struct spawn_action quiet[2];
+  int pid;
+
+  printf(1, "path test\n");
+  quiet[0].op = SPAWN_CLOSE;
+  quiet[0].fd = 1;
+  quiet[1].op = SPAWN_END;
+  if(mkdir("pathdir") < 0 || set_path("/nosuchdir:/pathdir") < 0){
+    printf(1, "path test setup failed\n");
+    exit();
+  }
+  if(spawn("pecho", echoargv, quiet) >= 0){
+    printf(1, "path test found a missing command\n");
+    exit();
+  }
+  if(link("echo", "pathdir/pecho") < 0 ||
+     (pid = spawn("pecho", echoargv, quiet)) < 0 || wait() != pid){
+    printf(1, "path test missed a new command\n");
+    exit();
+  }
+  if(unlink("pathdir/pecho") < 0 || spawn("pecho", echoargv, quiet) >= 0){
+    printf(1, "path test found a removed command\n");
+    exit();
+  }
+  set_path("");
+  unlink("pathdir");
+  printf(1, "path test OK\n");
+}
+
+// A program's file cannot be written while it runs, since
+// exec reads its pages from the file as they are touched.
+void
+textbusytest(void)
+{
+  char *argv[] = { "txtbusy", 0 };
+  int fd, in, n, pid, to[2], from[2];
+  char c;
+
+  printf(1, "text busy test\n");
+  // A copy of cat, which waits for input while the test
+  // writes to its file.
+  if((in = open("cat", O_RDONLY)) < 0 ||
+     (fd = open("txtbusy", O_CREATE|O_WRONLY)) < 0){
+    printf(1, "text busy test copy failed\n");
+    exit();
+  }
+  while((n = read(in, buf, sizeof(buf))) > 0)
+    if(write(fd, buf, n) != n){
+      printf(1, "text busy test copy failed\n");
+      exit();
+    }
+  close(in);
+  close(fd);
+
+  if(pipe(to) < 0 || pipe(from) < 0){
+    printf(1, "text busy test pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(1, "text busy test fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(0);
+    dup(to[0]);
+    close(1);
+    dup(from[1]);
+    close(to[0]);
+    close(to[1]);
+    close(from[0]);
+    close(from[1]);
+    exec("txtbusy", argv);
+    exit();
+  }
+  close(to[0]);
+  close(from[1]);
+  // Once cat echoes a byte, it is running from txtbusy.
+  if(write(to[1], "x", 1) != 1 || read(from[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "text busy test exec failed\n");
+    exit();
+  }
+  fd = open("txtbusy", O_WRONLY);
+  if(fd < 0 || write(fd, "x", 1) >= 0){
+    printf(1, "text busy test wrote a running program\n");
+    exit();
+  }
+  close(to[1]);
+  close(from[0]);
+  wait();
+  if(write(fd, "x", 1) != 1){
+    printf(1, "text busy test cannot write after exit\n");
+    exit();
+  }
+  close(fd);
+  unlink("txtbusy");
+  printf(1, "text busy test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "spawntests starting\n");
+  spawntest();
+  pathtest();
+  textbusytest();
+  printf(1, "spawntests done\n");
+  exit();
+}
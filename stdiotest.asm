@@ -0,0 +1,2492 @@
+
+_stdiotest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "stdio input test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "stdiotest starting\n");
+      11:	68 27 13 00 00       	push   $0x1327
+      16:	6a 01                	push   $0x1
+      18:	e8 a3 0a 00 00       	call   ac0 <printf>
+  outputtest();
+      1d:	e8 1e 00 00 00       	call   40 <outputtest>
+  inputtest();
+      22:	e8 89 01 00 00       	call   1b0 <inputtest>
+  printf(1, "stdiotest done\n");
+      27:	58                   	pop    %eax
+      28:	5a                   	pop    %edx
+      29:	68 3b 13 00 00       	push   $0x133b
+      2e:	6a 01                	push   $0x1
+      30:	e8 8b 0a 00 00       	call   ac0 <printf>
+  exit();
+      35:	e8 96 03 00 00       	call   3d0 <exit>
+      3a:	66 90                	xchg   %ax,%ax
+      3c:	66 90                	xchg   %ax,%ax
+      3e:	66 90                	xchg   %ax,%ax
+
+00000040 <outputtest>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	57                   	push   %edi
+      44:	56                   	push   %esi
+      45:	53                   	push   %ebx
+      46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "stdio output test\n");
+      49:	68 64 12 00 00       	push   $0x1264
+      4e:	6a 01                	push   $0x1
+      50:	e8 6b 0a 00 00       	call   ac0 <printf>
+  unlink("stdiofile");
+      55:	c7 04 24 77 12 00 00 	movl   $0x1277,(%esp)
+      5c:	e8 32 07 00 00       	call   793 <unlink>
+  pid = fork();
+      61:	e8 3a 03 00 00       	call   3a0 <fork>
+  if(pid < 0){
+      66:	83 c4 10             	add    $0x10,%esp
+      69:	85 c0                	test   %eax,%eax
+      6b:	0f 88 f8 00 00 00    	js     169 <outputtest+0x129>
+  if(pid == 0){
+      71:	75 5d                	jne    d0 <outputtest+0x90>
+    close(1);
+      73:	83 ec 0c             	sub    $0xc,%esp
+      76:	6a 01                	push   $0x1
+      78:	e8 ee 06 00 00       	call   76b <close>
+    if(open("stdiofile", O_CREATE|O_RDWR) != 1)
+      7d:	5e                   	pop    %esi
+      7e:	5f                   	pop    %edi
+      7f:	68 02 02 00 00       	push   $0x202
+      84:	68 77 12 00 00       	push   $0x1277
+      89:	e8 f5 06 00 00       	call   783 <open>
+      8e:	83 c4 10             	add    $0x10,%esp
+      91:	83 f8 01             	cmp    $0x1,%eax
+      94:	0f 85 08 01 00 00    	jne    1a2 <outputtest+0x162>
+    printf(1, "a");
+      9a:	83 ec 08             	sub    $0x8,%esp
+      9d:	68 81 12 00 00       	push   $0x1281
+      a2:	6a 01                	push   $0x1
+      a4:	e8 17 0a 00 00       	call   ac0 <printf>
+    if(fork() == 0){
+      a9:	e8 f2 02 00 00       	call   3a0 <fork>
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	0f 85 97 00 00 00    	jne    150 <outputtest+0x110>
+      printf(1, "b");
+      b9:	83 ec 08             	sub    $0x8,%esp
+      bc:	68 83 12 00 00       	push   $0x1283
+      c1:	6a 01                	push   $0x1
+      c3:	e8 f8 09 00 00       	call   ac0 <printf>
+      exit();
+      c8:	e8 03 03 00 00       	call   3d0 <exit>
+      cd:	8d 76 00             	lea    0x0(%esi),%esi
+  wait();
+      d0:	e8 76 06 00 00       	call   74b <wait>
+  fd = open("stdiofile", O_RDONLY);
+      d5:	83 ec 08             	sub    $0x8,%esp
+      d8:	6a 00                	push   $0x0
+      da:	68 77 12 00 00       	push   $0x1277
+      df:	e8 9f 06 00 00       	call   783 <open>
+  if(fd < 0){
+      e4:	83 c4 10             	add    $0x10,%esp
+  fd = open("stdiofile", O_RDONLY);
+      e7:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+      e9:	85 c0                	test   %eax,%eax
+      eb:	0f 88 8b 00 00 00    	js     17c <outputtest+0x13c>
+  n = read(fd, buf, sizeof(buf) - 1);
+      f1:	83 ec 04             	sub    $0x4,%esp
+      f4:	8d 75 e0             	lea    -0x20(%ebp),%esi
+      f7:	6a 07                	push   $0x7
+      f9:	56                   	push   %esi
+      fa:	50                   	push   %eax
+      fb:	e8 5b 06 00 00       	call   75b <read>
+  close(fd);
+     100:	89 3c 24             	mov    %edi,(%esp)
+  n = read(fd, buf, sizeof(buf) - 1);
+     103:	89 c3                	mov    %eax,%ebx
+  close(fd);
+     105:	e8 61 06 00 00       	call   76b <close>
+  unlink("stdiofile");
+     10a:	c7 04 24 77 12 00 00 	movl   $0x1277,(%esp)
+     111:	e8 7d 06 00 00       	call   793 <unlink>
+  buf[n < 0 ? 0 : n] = 0;
+     116:	31 c0                	xor    %eax,%eax
+     118:	85 db                	test   %ebx,%ebx
+     11a:	0f 48 d8             	cmovs  %eax,%ebx
+     11d:	c6 44 1d e0 00       	movb   $0x0,-0x20(%ebp,%ebx,1)
+  if(strcmp(buf, "abc") != 0){
+     122:	5a                   	pop    %edx
+     123:	59                   	pop    %ecx
+     124:	68 85 12 00 00       	push   $0x1285
+     129:	56                   	push   %esi
+     12a:	e8 61 03 00 00       	call   490 <strcmp>
+     12f:	83 c4 10             	add    $0x10,%esp
+     132:	85 c0                	test   %eax,%eax
+     134:	75 59                	jne    18f <outputtest+0x14f>
+  printf(1, "stdio output test OK\n");
+     136:	83 ec 08             	sub    $0x8,%esp
+     139:	68 a5 12 00 00       	push   $0x12a5
+     13e:	6a 01                	push   $0x1
+     140:	e8 7b 09 00 00       	call   ac0 <printf>
+}
+     145:	83 c4 10             	add    $0x10,%esp
+     148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     14b:	5b                   	pop    %ebx
+     14c:	5e                   	pop    %esi
+     14d:	5f                   	pop    %edi
+     14e:	5d                   	pop    %ebp
+     14f:	c3                   	ret
+    wait();
+     150:	e8 f6 05 00 00       	call   74b <wait>
+    printf(1, "c");
+     155:	83 ec 08             	sub    $0x8,%esp
+     158:	68 87 12 00 00       	push   $0x1287
+     15d:	6a 01                	push   $0x1
+     15f:	e8 5c 09 00 00       	call   ac0 <printf>
+    exit();
+     164:	e8 67 02 00 00       	call   3d0 <exit>
+    printf(1, "stdio output test fork failed\n");
+     169:	50                   	push   %eax
+     16a:	50                   	push   %eax
+     16b:	68 4c 13 00 00       	push   $0x134c
+     170:	6a 01                	push   $0x1
+     172:	e8 49 09 00 00       	call   ac0 <printf>
+    exit();
+     177:	e8 54 02 00 00       	call   3d0 <exit>
+    printf(1, "stdio output test open failed\n");
+     17c:	53                   	push   %ebx
+     17d:	53                   	push   %ebx
+     17e:	68 6c 13 00 00       	push   $0x136c
+     183:	6a 01                	push   $0x1
+     185:	e8 36 09 00 00       	call   ac0 <printf>
+    exit();
+     18a:	e8 41 02 00 00       	call   3d0 <exit>
+    printf(1, "stdio output test wrote %s\n", buf);
+     18f:	50                   	push   %eax
+     190:	56                   	push   %esi
+     191:	68 89 12 00 00       	push   $0x1289
+     196:	6a 01                	push   $0x1
+     198:	e8 23 09 00 00       	call   ac0 <printf>
+    exit();
+     19d:	e8 2e 02 00 00       	call   3d0 <exit>
+      exit();
+     1a2:	e8 29 02 00 00       	call   3d0 <exit>
+     1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <inputtest>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	56                   	push   %esi
+     1b4:	53                   	push   %ebx
+     1b5:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "stdio input test\n");
+     1b8:	68 bb 12 00 00       	push   $0x12bb
+     1bd:	6a 01                	push   $0x1
+     1bf:	e8 fc 08 00 00       	call   ac0 <printf>
+  fd = open("stdiofile", O_CREATE|O_RDWR);
+     1c4:	58                   	pop    %eax
+     1c5:	5a                   	pop    %edx
+     1c6:	68 02 02 00 00       	push   $0x202
+     1cb:	68 77 12 00 00       	push   $0x1277
+     1d0:	e8 ae 05 00 00       	call   783 <open>
+  if(fd < 0 || write(fd, "one\ntwo\n", 8) != 8){
+     1d5:	83 c4 10             	add    $0x10,%esp
+     1d8:	85 c0                	test   %eax,%eax
+     1da:	0f 88 65 01 00 00    	js     345 <inputtest+0x195>
+     1e0:	83 ec 04             	sub    $0x4,%esp
+     1e3:	89 c3                	mov    %eax,%ebx
+     1e5:	6a 08                	push   $0x8
+     1e7:	68 cd 12 00 00       	push   $0x12cd
+     1ec:	50                   	push   %eax
+     1ed:	e8 71 05 00 00       	call   763 <write>
+     1f2:	83 c4 10             	add    $0x10,%esp
+     1f5:	83 f8 08             	cmp    $0x8,%eax
+     1f8:	0f 85 47 01 00 00    	jne    345 <inputtest+0x195>
+  close(fd);
+     1fe:	83 ec 0c             	sub    $0xc,%esp
+     201:	53                   	push   %ebx
+     202:	e8 64 05 00 00       	call   76b <close>
+  if(pipe(fds) != 0){
+     207:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     20a:	89 04 24             	mov    %eax,(%esp)
+     20d:	e8 41 05 00 00       	call   753 <pipe>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	85 c0                	test   %eax,%eax
+     217:	0f 85 3b 01 00 00    	jne    358 <inputtest+0x1a8>
+  pid = fork();
+     21d:	e8 7e 01 00 00       	call   3a0 <fork>
+  if(pid < 0){
+     222:	85 c0                	test   %eax,%eax
+     224:	0f 88 41 01 00 00    	js     36b <inputtest+0x1bb>
+  if(pid == 0){
+     22a:	75 7c                	jne    2a8 <inputtest+0xf8>
+    close(fds[0]);
+     22c:	83 ec 0c             	sub    $0xc,%esp
+     22f:	ff 75 e0             	push   -0x20(%ebp)
+     232:	e8 34 05 00 00       	call   76b <close>
+    close(0);
+     237:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     23e:	e8 28 05 00 00       	call   76b <close>
+    if(open("stdiofile", O_RDONLY) != 0)
+     243:	58                   	pop    %eax
+     244:	5a                   	pop    %edx
+     245:	6a 00                	push   $0x0
+     247:	68 77 12 00 00       	push   $0x1277
+     24c:	e8 32 05 00 00       	call   783 <open>
+     251:	83 c4 10             	add    $0x10,%esp
+     254:	85 c0                	test   %eax,%eax
+     256:	75 47                	jne    29f <inputtest+0xef>
+    gets(buf, sizeof(buf));
+     258:	83 ec 08             	sub    $0x8,%esp
+     25b:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+     25e:	6a 10                	push   $0x10
+     260:	53                   	push   %ebx
+     261:	e8 1a 03 00 00       	call   580 <gets>
+    if(strcmp(buf, "one\n") != 0)
+     266:	5e                   	pop    %esi
+     267:	58                   	pop    %eax
+     268:	68 46 13 00 00       	push   $0x1346
+     26d:	53                   	push   %ebx
+     26e:	e8 1d 02 00 00       	call   490 <strcmp>
+     273:	83 c4 10             	add    $0x10,%esp
+     276:	85 c0                	test   %eax,%eax
+     278:	75 25                	jne    29f <inputtest+0xef>
+    if(fork() == 0){
+     27a:	e8 21 01 00 00       	call   3a0 <fork>
+     27f:	85 c0                	test   %eax,%eax
+     281:	0f 85 99 00 00 00    	jne    320 <inputtest+0x170>
+      n = read(0, buf, sizeof(buf));
+     287:	83 ec 04             	sub    $0x4,%esp
+     28a:	6a 10                	push   $0x10
+     28c:	53                   	push   %ebx
+     28d:	6a 00                	push   $0x0
+     28f:	e8 c7 04 00 00       	call   75b <read>
+      if(n > 0)
+     294:	83 c4 10             	add    $0x10,%esp
+     297:	85 c0                	test   %eax,%eax
+     299:	0f 8f 91 00 00 00    	jg     330 <inputtest+0x180>
+    exit();
+     29f:	e8 2c 01 00 00       	call   3d0 <exit>
+     2a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  close(fds[1]);
+     2a8:	83 ec 0c             	sub    $0xc,%esp
+     2ab:	ff 75 e4             	push   -0x1c(%ebp)
+  n = read(fds[0], buf, sizeof(buf) - 1);
+     2ae:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  close(fds[1]);
+     2b1:	e8 b5 04 00 00       	call   76b <close>
+  n = read(fds[0], buf, sizeof(buf) - 1);
+     2b6:	83 c4 0c             	add    $0xc,%esp
+     2b9:	6a 0f                	push   $0xf
+     2bb:	56                   	push   %esi
+     2bc:	ff 75 e0             	push   -0x20(%ebp)
+     2bf:	e8 97 04 00 00       	call   75b <read>
+  close(fds[0]);
+     2c4:	5a                   	pop    %edx
+     2c5:	ff 75 e0             	push   -0x20(%ebp)
+  n = read(fds[0], buf, sizeof(buf) - 1);
+     2c8:	89 c3                	mov    %eax,%ebx
+  close(fds[0]);
+     2ca:	e8 9c 04 00 00       	call   76b <close>
+  wait();
+     2cf:	e8 77 04 00 00       	call   74b <wait>
+  unlink("stdiofile");
+     2d4:	c7 04 24 77 12 00 00 	movl   $0x1277,(%esp)
+     2db:	e8 b3 04 00 00       	call   793 <unlink>
+  buf[n < 0 ? 0 : n] = 0;
+     2e0:	31 c0                	xor    %eax,%eax
+     2e2:	85 db                	test   %ebx,%ebx
+     2e4:	0f 48 d8             	cmovs  %eax,%ebx
+     2e7:	c6 44 1d e8 00       	movb   $0x0,-0x18(%ebp,%ebx,1)
+  if(strcmp(buf, "two\n") != 0){
+     2ec:	59                   	pop    %ecx
+     2ed:	5b                   	pop    %ebx
+     2ee:	68 d1 12 00 00       	push   $0x12d1
+     2f3:	56                   	push   %esi
+     2f4:	e8 97 01 00 00       	call   490 <strcmp>
+     2f9:	83 c4 10             	add    $0x10,%esp
+     2fc:	85 c0                	test   %eax,%eax
+     2fe:	75 7e                	jne    37e <inputtest+0x1ce>
+  printf(1, "stdio input test OK\n");
+     300:	83 ec 08             	sub    $0x8,%esp
+     303:	68 12 13 00 00       	push   $0x1312
+     308:	6a 01                	push   $0x1
+     30a:	e8 b1 07 00 00       	call   ac0 <printf>
+}
+     30f:	83 c4 10             	add    $0x10,%esp
+     312:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     315:	5b                   	pop    %ebx
+     316:	5e                   	pop    %esi
+     317:	5d                   	pop    %ebp
+     318:	c3                   	ret
+     319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+     320:	e8 26 04 00 00       	call   74b <wait>
+    exit();
+     325:	e8 a6 00 00 00       	call   3d0 <exit>
+     32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        write(fds[1], buf, n);
+     330:	83 ec 04             	sub    $0x4,%esp
+     333:	50                   	push   %eax
+     334:	53                   	push   %ebx
+     335:	ff 75 e4             	push   -0x1c(%ebp)
+     338:	e8 26 04 00 00       	call   763 <write>
+     33d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     340:	e8 8b 00 00 00       	call   3d0 <exit>
+    printf(1, "stdio input test create failed\n");
+     345:	56                   	push   %esi
+     346:	56                   	push   %esi
+     347:	68 8c 13 00 00       	push   $0x138c
+     34c:	6a 01                	push   $0x1
+     34e:	e8 6d 07 00 00       	call   ac0 <printf>
+    exit();
+     353:	e8 78 00 00 00       	call   3d0 <exit>
+    printf(1, "stdio input test pipe failed\n");
+     358:	53                   	push   %ebx
+     359:	53                   	push   %ebx
+     35a:	68 d6 12 00 00       	push   $0x12d6
+     35f:	6a 01                	push   $0x1
+     361:	e8 5a 07 00 00       	call   ac0 <printf>
+    exit();
+     366:	e8 65 00 00 00       	call   3d0 <exit>
+    printf(1, "stdio input test fork failed\n");
+     36b:	51                   	push   %ecx
+     36c:	51                   	push   %ecx
+     36d:	68 f4 12 00 00       	push   $0x12f4
+     372:	6a 01                	push   $0x1
+     374:	e8 47 07 00 00       	call   ac0 <printf>
+    exit();
+     379:	e8 52 00 00 00       	call   3d0 <exit>
+    printf(1, "stdio input test child read %s\n", buf);
+     37e:	50                   	push   %eax
+     37f:	56                   	push   %esi
+     380:	68 ac 13 00 00       	push   $0x13ac
+     385:	6a 01                	push   $0x1
+     387:	e8 34 07 00 00       	call   ac0 <printf>
+    exit();
+     38c:	e8 3f 00 00 00       	call   3d0 <exit>
+     391:	66 90                	xchg   %ax,%ax
+     393:	66 90                	xchg   %ax,%ax
+     395:	66 90                	xchg   %ax,%ax
+     397:	66 90                	xchg   %ax,%ax
+     399:	66 90                	xchg   %ax,%ax
+     39b:	66 90                	xchg   %ax,%ax
+     39d:	66 90                	xchg   %ax,%ax
+     39f:	90                   	nop
+
+000003a0 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     3a0:	a1 a0 18 00 00       	mov    0x18a0,%eax
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	74 17                	je     3c0 <fork+0x20>
+{
+     3a9:	55                   	push   %ebp
+     3aa:	89 e5                	mov    %esp,%ebp
+     3ac:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     3af:	ff d0                	call   *%eax
+  return _fork();
+}
+     3b1:	c9                   	leave
+  return _fork();
+     3b2:	e9 84 03 00 00       	jmp    73b <_fork>
+     3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3be:	66 90                	xchg   %ax,%ax
+     3c0:	e9 76 03 00 00       	jmp    73b <_fork>
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <exit>:
+
+int
+exit(void)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     3d6:	a1 a0 18 00 00       	mov    0x18a0,%eax
+     3db:	85 c0                	test   %eax,%eax
+     3dd:	74 02                	je     3e1 <exit+0x11>
+    stdioflush();
+     3df:	ff d0                	call   *%eax
+  _exit();
+     3e1:	e8 5d 03 00 00       	call   743 <_exit>
+     3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     3f0:	55                   	push   %ebp
+  if(stdioflush)
+     3f1:	a1 a0 18 00 00       	mov    0x18a0,%eax
+{
+     3f6:	89 e5                	mov    %esp,%ebp
+     3f8:	56                   	push   %esi
+     3f9:	53                   	push   %ebx
+     3fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     400:	85 c0                	test   %eax,%eax
+     402:	74 02                	je     406 <exec+0x16>
+    stdioflush();
+     404:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     406:	89 75 0c             	mov    %esi,0xc(%ebp)
+     409:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     40c:	5b                   	pop    %ebx
+     40d:	5e                   	pop    %esi
+     40e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     40f:	e9 67 03 00 00       	jmp    77b <_exec>
+     414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+
+00000420 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	57                   	push   %edi
+     424:	56                   	push   %esi
+     425:	53                   	push   %ebx
+     426:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     429:	a1 a0 18 00 00       	mov    0x18a0,%eax
+{
+     42e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     431:	8b 75 0c             	mov    0xc(%ebp),%esi
+     434:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     437:	85 c0                	test   %eax,%eax
+     439:	74 02                	je     43d <spawn+0x1d>
+    stdioflush();
+     43b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     43d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     440:	89 75 0c             	mov    %esi,0xc(%ebp)
+     443:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     446:	83 c4 0c             	add    $0xc,%esp
+     449:	5b                   	pop    %ebx
+     44a:	5e                   	pop    %esi
+     44b:	5f                   	pop    %edi
+     44c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     44d:	e9 79 04 00 00       	jmp    8cb <_spawn>
+     452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     460:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     461:	31 c0                	xor    %eax,%eax
+{
+     463:	89 e5                	mov    %esp,%ebp
+     465:	53                   	push   %ebx
+     466:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     469:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     470:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     474:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     477:	83 c0 01             	add    $0x1,%eax
+     47a:	84 d2                	test   %dl,%dl
+     47c:	75 f2                	jne    470 <strcpy+0x10>
+    ;
+  return os;
+}
+     47e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     481:	89 c8                	mov    %ecx,%eax
+     483:	c9                   	leave
+     484:	c3                   	ret
+     485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	53                   	push   %ebx
+     494:	8b 55 08             	mov    0x8(%ebp),%edx
+     497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     49a:	0f b6 02             	movzbl (%edx),%eax
+     49d:	84 c0                	test   %al,%al
+     49f:	75 17                	jne    4b8 <strcmp+0x28>
+     4a1:	eb 3a                	jmp    4dd <strcmp+0x4d>
+     4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4a7:	90                   	nop
+     4a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     4ac:	83 c2 01             	add    $0x1,%edx
+     4af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     4b2:	84 c0                	test   %al,%al
+     4b4:	74 1a                	je     4d0 <strcmp+0x40>
+    p++, q++;
+     4b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     4b8:	0f b6 19             	movzbl (%ecx),%ebx
+     4bb:	38 c3                	cmp    %al,%bl
+     4bd:	74 e9                	je     4a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     4bf:	29 d8                	sub    %ebx,%eax
+}
+     4c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4c4:	c9                   	leave
+     4c5:	c3                   	ret
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     4d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     4d4:	31 c0                	xor    %eax,%eax
+     4d6:	29 d8                	sub    %ebx,%eax
+}
+     4d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4db:	c9                   	leave
+     4dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     4dd:	0f b6 19             	movzbl (%ecx),%ebx
+     4e0:	31 c0                	xor    %eax,%eax
+     4e2:	eb db                	jmp    4bf <strcmp+0x2f>
+     4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4ef:	90                   	nop
+
+000004f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     4f6:	80 3a 00             	cmpb   $0x0,(%edx)
+     4f9:	74 15                	je     510 <strlen+0x20>
+     4fb:	31 c0                	xor    %eax,%eax
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+     500:	83 c0 01             	add    $0x1,%eax
+     503:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     507:	89 c1                	mov    %eax,%ecx
+     509:	75 f5                	jne    500 <strlen+0x10>
+    ;
+  return n;
+}
+     50b:	89 c8                	mov    %ecx,%eax
+     50d:	5d                   	pop    %ebp
+     50e:	c3                   	ret
+     50f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     510:	31 c9                	xor    %ecx,%ecx
+}
+     512:	5d                   	pop    %ebp
+     513:	89 c8                	mov    %ecx,%eax
+     515:	c3                   	ret
+     516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	57                   	push   %edi
+     524:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     527:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     52a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     52d:	89 d7                	mov    %edx,%edi
+     52f:	fc                   	cld
+     530:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     532:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     535:	89 d0                	mov    %edx,%eax
+     537:	c9                   	leave
+     538:	c3                   	ret
+     539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	8b 45 08             	mov    0x8(%ebp),%eax
+     546:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     54a:	0f b6 10             	movzbl (%eax),%edx
+     54d:	84 d2                	test   %dl,%dl
+     54f:	75 12                	jne    563 <strchr+0x23>
+     551:	eb 1d                	jmp    570 <strchr+0x30>
+     553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     557:	90                   	nop
+     558:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     55c:	83 c0 01             	add    $0x1,%eax
+     55f:	84 d2                	test   %dl,%dl
+     561:	74 0d                	je     570 <strchr+0x30>
+    if(*s == c)
+     563:	38 d1                	cmp    %dl,%cl
+     565:	75 f1                	jne    558 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     567:	5d                   	pop    %ebp
+     568:	c3                   	ret
+     569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     570:	31 c0                	xor    %eax,%eax
+}
+     572:	5d                   	pop    %ebp
+     573:	c3                   	ret
+     574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+
+00000580 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+     583:	57                   	push   %edi
+     584:	56                   	push   %esi
+     585:	53                   	push   %ebx
+     586:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     589:	a1 a0 18 00 00       	mov    0x18a0,%eax
+{
+     58e:	8b 75 08             	mov    0x8(%ebp),%esi
+     591:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     594:	85 c0                	test   %eax,%eax
+     596:	74 02                	je     59a <gets+0x1a>
+    stdioflush();
+     598:	ff d0                	call   *%eax
+  if(in.size == 0)
+     59a:	a1 c8 1a 00 00       	mov    0x1ac8,%eax
+     59f:	85 c0                	test   %eax,%eax
+     5a1:	0f 84 99 00 00 00    	je     640 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     5a7:	31 db                	xor    %ebx,%ebx
+     5a9:	eb 21                	jmp    5cc <gets+0x4c>
+     5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5af:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     5b0:	8d 50 01             	lea    0x1(%eax),%edx
+     5b3:	0f b6 80 c0 18 00 00 	movzbl 0x18c0(%eax),%eax
+     5ba:	89 15 c0 1a 00 00    	mov    %edx,0x1ac0
+    buf[i++] = c;
+     5c0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     5c4:	3c 0a                	cmp    $0xa,%al
+     5c6:	74 60                	je     628 <gets+0xa8>
+     5c8:	3c 0d                	cmp    $0xd,%al
+     5ca:	74 5c                	je     628 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     5cc:	89 da                	mov    %ebx,%edx
+     5ce:	83 c3 01             	add    $0x1,%ebx
+     5d1:	39 fb                	cmp    %edi,%ebx
+     5d3:	7d 55                	jge    62a <gets+0xaa>
+    if(in.r == in.n){
+     5d5:	a1 c0 1a 00 00       	mov    0x1ac0,%eax
+     5da:	3b 05 c4 1a 00 00    	cmp    0x1ac4,%eax
+     5e0:	75 ce                	jne    5b0 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     5e2:	83 ec 04             	sub    $0x4,%esp
+     5e5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     5e8:	c7 05 c4 1a 00 00 00 	movl   $0x0,0x1ac4
+     5ef:	00 00 00 
+     5f2:	c7 05 c0 1a 00 00 00 	movl   $0x0,0x1ac0
+     5f9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     5fc:	ff 35 c8 1a 00 00    	push   0x1ac8
+     602:	68 c0 18 00 00       	push   $0x18c0
+     607:	6a 00                	push   $0x0
+     609:	e8 4d 01 00 00       	call   75b <read>
+     60e:	83 c4 10             	add    $0x10,%esp
+     611:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     614:	85 c0                	test   %eax,%eax
+     616:	a3 c4 1a 00 00       	mov    %eax,0x1ac4
+     61b:	7e 56                	jle    673 <gets+0xf3>
+    c = in.buf[in.r++];
+     61d:	a1 c0 1a 00 00       	mov    0x1ac0,%eax
+     622:	eb 8c                	jmp    5b0 <gets+0x30>
+     624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     628:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     62a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     62e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     631:	89 f0                	mov    %esi,%eax
+     633:	5b                   	pop    %ebx
+     634:	5e                   	pop    %esi
+     635:	5f                   	pop    %edi
+     636:	5d                   	pop    %ebp
+     637:	c3                   	ret
+     638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     640:	83 ec 08             	sub    $0x8,%esp
+     643:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     646:	50                   	push   %eax
+     647:	6a 00                	push   $0x0
+     649:	e8 4d 01 00 00       	call   79b <fstat>
+     64e:	83 c4 10             	add    $0x10,%esp
+     651:	89 c2                	mov    %eax,%edx
+     653:	b8 01 00 00 00       	mov    $0x1,%eax
+     658:	85 d2                	test   %edx,%edx
+     65a:	75 0d                	jne    669 <gets+0xe9>
+     65c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     661:	ba 00 02 00 00       	mov    $0x200,%edx
+     666:	0f 44 c2             	cmove  %edx,%eax
+     669:	a3 c8 1a 00 00       	mov    %eax,0x1ac8
+     66e:	e9 34 ff ff ff       	jmp    5a7 <gets+0x27>
+        in.n = 0;
+     673:	c7 05 c4 1a 00 00 00 	movl   $0x0,0x1ac4
+     67a:	00 00 00 
+        break;
+     67d:	eb ab                	jmp    62a <gets+0xaa>
+     67f:	90                   	nop
+
+00000680 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	6a 00                	push   $0x0
+     68a:	ff 75 08             	push   0x8(%ebp)
+     68d:	e8 f1 00 00 00       	call   783 <open>
+  if(fd < 0)
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	85 c0                	test   %eax,%eax
+     697:	78 27                	js     6c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     699:	83 ec 08             	sub    $0x8,%esp
+     69c:	ff 75 0c             	push   0xc(%ebp)
+     69f:	89 c3                	mov    %eax,%ebx
+     6a1:	50                   	push   %eax
+     6a2:	e8 f4 00 00 00       	call   79b <fstat>
+  close(fd);
+     6a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     6aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     6ac:	e8 ba 00 00 00       	call   76b <close>
+  return r;
+     6b1:	83 c4 10             	add    $0x10,%esp
+}
+     6b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6b7:	89 f0                	mov    %esi,%eax
+     6b9:	5b                   	pop    %ebx
+     6ba:	5e                   	pop    %esi
+     6bb:	5d                   	pop    %ebp
+     6bc:	c3                   	ret
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     6c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6c5:	eb ed                	jmp    6b4 <stat+0x34>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     6d7:	0f be 02             	movsbl (%edx),%eax
+     6da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     6dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     6e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     6e5:	77 1e                	ja     705 <atoi+0x35>
+     6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     6f0:	83 c2 01             	add    $0x1,%edx
+     6f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     6f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     6fa:	0f be 02             	movsbl (%edx),%eax
+     6fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     700:	80 fb 09             	cmp    $0x9,%bl
+     703:	76 eb                	jbe    6f0 <atoi+0x20>
+  return n;
+}
+     705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     708:	89 c8                	mov    %ecx,%eax
+     70a:	c9                   	leave
+     70b:	c3                   	ret
+     70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	56                   	push   %esi
+     715:	8b 45 10             	mov    0x10(%ebp),%eax
+     718:	8b 55 08             	mov    0x8(%ebp),%edx
+     71b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     71e:	85 c0                	test   %eax,%eax
+     720:	7e 13                	jle    735 <memmove+0x25>
+     722:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     724:	89 d7                	mov    %edx,%edi
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     730:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     731:	39 f8                	cmp    %edi,%eax
+     733:	75 fb                	jne    730 <memmove+0x20>
+  return vdst;
+}
+     735:	5e                   	pop    %esi
+     736:	89 d0                	mov    %edx,%eax
+     738:	5f                   	pop    %edi
+     739:	5d                   	pop    %ebp
+     73a:	c3                   	ret
+
+0000073b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     73b:	b8 01 00 00 00       	mov    $0x1,%eax
+     740:	cd 40                	int    $0x40
+     742:	c3                   	ret
+
+00000743 <_exit>:
+RAWSYSCALL(exit)
+     743:	b8 02 00 00 00       	mov    $0x2,%eax
+     748:	cd 40                	int    $0x40
+     74a:	c3                   	ret
+
+0000074b <wait>:
+SYSCALL(wait)
+     74b:	b8 03 00 00 00       	mov    $0x3,%eax
+     750:	cd 40                	int    $0x40
+     752:	c3                   	ret
+
+00000753 <pipe>:
+SYSCALL(pipe)
+     753:	b8 04 00 00 00       	mov    $0x4,%eax
+     758:	cd 40                	int    $0x40
+     75a:	c3                   	ret
+
+0000075b <read>:
+SYSCALL(read)
+     75b:	b8 05 00 00 00       	mov    $0x5,%eax
+     760:	cd 40                	int    $0x40
+     762:	c3                   	ret
+
+00000763 <write>:
+SYSCALL(write)
+     763:	b8 10 00 00 00       	mov    $0x10,%eax
+     768:	cd 40                	int    $0x40
+     76a:	c3                   	ret
+
+0000076b <close>:
+SYSCALL(close)
+     76b:	b8 15 00 00 00       	mov    $0x15,%eax
+     770:	cd 40                	int    $0x40
+     772:	c3                   	ret
+
+00000773 <kill>:
+SYSCALL(kill)
+     773:	b8 06 00 00 00       	mov    $0x6,%eax
+     778:	cd 40                	int    $0x40
+     77a:	c3                   	ret
+
+0000077b <_exec>:
+RAWSYSCALL(exec)
+     77b:	b8 07 00 00 00       	mov    $0x7,%eax
+     780:	cd 40                	int    $0x40
+     782:	c3                   	ret
+
+00000783 <open>:
+SYSCALL(open)
+     783:	b8 0f 00 00 00       	mov    $0xf,%eax
+     788:	cd 40                	int    $0x40
+     78a:	c3                   	ret
+
+0000078b <mknod>:
+SYSCALL(mknod)
+     78b:	b8 11 00 00 00       	mov    $0x11,%eax
+     790:	cd 40                	int    $0x40
+     792:	c3                   	ret
+
+00000793 <unlink>:
+SYSCALL(unlink)
+     793:	b8 12 00 00 00       	mov    $0x12,%eax
+     798:	cd 40                	int    $0x40
+     79a:	c3                   	ret
+
+0000079b <fstat>:
+SYSCALL(fstat)
+     79b:	b8 08 00 00 00       	mov    $0x8,%eax
+     7a0:	cd 40                	int    $0x40
+     7a2:	c3                   	ret
+
+000007a3 <link>:
+SYSCALL(link)
+     7a3:	b8 13 00 00 00       	mov    $0x13,%eax
+     7a8:	cd 40                	int    $0x40
+     7aa:	c3                   	ret
+
+000007ab <mkdir>:
+SYSCALL(mkdir)
+     7ab:	b8 14 00 00 00       	mov    $0x14,%eax
+     7b0:	cd 40                	int    $0x40
+     7b2:	c3                   	ret
+
+000007b3 <chdir>:
+SYSCALL(chdir)
+     7b3:	b8 09 00 00 00       	mov    $0x9,%eax
+     7b8:	cd 40                	int    $0x40
+     7ba:	c3                   	ret
+
+000007bb <dup>:
+SYSCALL(dup)
+     7bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7c0:	cd 40                	int    $0x40
+     7c2:	c3                   	ret
+
+000007c3 <getpid>:
+SYSCALL(getpid)
+     7c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7c8:	cd 40                	int    $0x40
+     7ca:	c3                   	ret
+
+000007cb <sbrk>:
+SYSCALL(sbrk)
+     7cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7d0:	cd 40                	int    $0x40
+     7d2:	c3                   	ret
+
+000007d3 <sleep>:
+SYSCALL(sleep)
+     7d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7d8:	cd 40                	int    $0x40
+     7da:	c3                   	ret
+
+000007db <uptime>:
+SYSCALL(uptime)
+     7db:	b8 0e 00 00 00       	mov    $0xe,%eax
+     7e0:	cd 40                	int    $0x40
+     7e2:	c3                   	ret
+
+000007e3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     7e3:	b8 16 00 00 00       	mov    $0x16,%eax
+     7e8:	cd 40                	int    $0x40
+     7ea:	c3                   	ret
+
+000007eb <get_parent_id>:
+SYSCALL(get_parent_id)
+     7eb:	b8 17 00 00 00       	mov    $0x17,%eax
+     7f0:	cd 40                	int    $0x40
+     7f2:	c3                   	ret
+
+000007f3 <get_children>:
+SYSCALL(get_children)
+     7f3:	b8 18 00 00 00       	mov    $0x18,%eax
+     7f8:	cd 40                	int    $0x40
+     7fa:	c3                   	ret
+
+000007fb <set_path>:
+SYSCALL(set_path)
+     7fb:	b8 19 00 00 00       	mov    $0x19,%eax
+     800:	cd 40                	int    $0x40
+     802:	c3                   	ret
+
+00000803 <set_sleep>:
+SYSCALL(set_sleep)
+     803:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     808:	cd 40                	int    $0x40
+     80a:	c3                   	ret
+
+0000080b <get_time>:
+SYSCALL(get_time)
+     80b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <change_process_level>:
+SYSCALL(change_process_level)
+     813:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     81b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     823:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <print_processes_info>:
+SYSCALL(print_processes_info)
+     82b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <barrier_init>:
+
+SYSCALL(barrier_init)
+     833:	b8 20 00 00 00       	mov    $0x20,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <barrier_wait>:
+SYSCALL(barrier_wait)
+     83b:	b8 21 00 00 00       	mov    $0x21,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     843:	b8 22 00 00 00       	mov    $0x22,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     84b:	b8 23 00 00 00       	mov    $0x23,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <set_process_gang>:
+SYSCALL(set_process_gang)
+     853:	b8 24 00 00 00       	mov    $0x24,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     85b:	b8 25 00 00 00       	mov    $0x25,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <sem_create>:
+SYSCALL(sem_create)
+     863:	b8 26 00 00 00       	mov    $0x26,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <event_create>:
+SYSCALL(event_create)
+     86b:	b8 27 00 00 00       	mov    $0x27,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <sync_post>:
+SYSCALL(sync_post)
+     873:	b8 28 00 00 00       	mov    $0x28,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+
+0000087b <sync_wait>:
+SYSCALL(sync_wait)
+     87b:	b8 29 00 00 00       	mov    $0x29,%eax
+     880:	cd 40                	int    $0x40
+     882:	c3                   	ret
+
+00000883 <sync_close>:
+SYSCALL(sync_close)
+     883:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     888:	cd 40                	int    $0x40
+     88a:	c3                   	ret
+
+0000088b <event_reset>:
+SYSCALL(event_reset)
+     88b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     893:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <mmap>:
+SYSCALL(mmap)
+     89b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <munmap>:
+SYSCALL(munmap)
+     8a3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+
+000008ab <shmget>:
+SYSCALL(shmget)
+     8ab:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <shmat>:
+SYSCALL(shmat)
+     8b3:	b8 30 00 00 00       	mov    $0x30,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <shmdt>:
+SYSCALL(shmdt)
+     8bb:	b8 31 00 00 00       	mov    $0x31,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <shmrm>:
+SYSCALL(shmrm)
+     8c3:	b8 32 00 00 00       	mov    $0x32,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <_spawn>:
+RAWSYSCALL(spawn)
+     8cb:	b8 33 00 00 00       	mov    $0x33,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <memstat>:
+SYSCALL(memstat)
+     8d3:	b8 34 00 00 00       	mov    $0x34,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+     8db:	66 90                	xchg   %ax,%ax
+     8dd:	66 90                	xchg   %ax,%ax
+     8df:	90                   	nop
+
+000008e0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     8e6:	a1 08 1d 00 00       	mov    0x1d08,%eax
+     8eb:	85 c0                	test   %eax,%eax
+     8ed:	7e 17                	jle    906 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     8ef:	83 ec 04             	sub    $0x4,%esp
+     8f2:	50                   	push   %eax
+     8f3:	68 0c 1d 00 00       	push   $0x1d0c
+     8f8:	ff 35 00 1d 00 00    	push   0x1d00
+     8fe:	e8 60 fe ff ff       	call   763 <write>
+     903:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     906:	c7 05 08 1d 00 00 00 	movl   $0x0,0x1d08
+     90d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     910:	c7 05 04 1d 00 00 00 	movl   $0x0,0x1d04
+     917:	00 00 00 
+}
+     91a:	c9                   	leave
+     91b:	c3                   	ret
+     91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	57                   	push   %edi
+     924:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     926:	89 d1                	mov    %edx,%ecx
+{
+     928:	56                   	push   %esi
+     929:	53                   	push   %ebx
+     92a:	89 c3                	mov    %eax,%ebx
+     92c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     92f:	85 d2                	test   %edx,%edx
+     931:	0f 89 b9 00 00 00    	jns    9f0 <printint+0xd0>
+     937:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     93b:	0f 84 af 00 00 00    	je     9f0 <printint+0xd0>
+    x = -xx;
+     941:	f7 d9                	neg    %ecx
+    neg = 1;
+     943:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     948:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     94b:	31 f6                	xor    %esi,%esi
+     94d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     950:	89 c8                	mov    %ecx,%eax
+     952:	31 d2                	xor    %edx,%edx
+     954:	89 f3                	mov    %esi,%ebx
+     956:	f7 f7                	div    %edi
+     958:	8d 76 01             	lea    0x1(%esi),%esi
+     95b:	0f b6 92 2c 14 00 00 	movzbl 0x142c(%edx),%edx
+     962:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     966:	89 ca                	mov    %ecx,%edx
+     968:	89 c1                	mov    %eax,%ecx
+     96a:	39 fa                	cmp    %edi,%edx
+     96c:	73 e2                	jae    950 <printint+0x30>
+  if(neg)
+     96e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     971:	89 d9                	mov    %ebx,%ecx
+     973:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     976:	85 c0                	test   %eax,%eax
+     978:	74 07                	je     981 <printint+0x61>
+    buf[i++] = '-';
+     97a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     97f:	89 f1                	mov    %esi,%ecx
+     981:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     984:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     986:	8d 43 0c             	lea    0xc(%ebx),%eax
+     989:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     98c:	01 f7                	add    %esi,%edi
+     98e:	eb 09                	jmp    999 <printint+0x79>
+
+  while(--i >= 0)
+     990:	8d 47 ff             	lea    -0x1(%edi),%eax
+     993:	39 f7                	cmp    %esi,%edi
+     995:	74 36                	je     9cd <printint+0xad>
+     997:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     999:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     99c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     99f:	8d 42 01             	lea    0x1(%edx),%eax
+     9a2:	89 43 08             	mov    %eax,0x8(%ebx)
+     9a5:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     9a9:	3d 00 02 00 00       	cmp    $0x200,%eax
+     9ae:	74 28                	je     9d8 <printint+0xb8>
+     9b0:	80 f9 0a             	cmp    $0xa,%cl
+     9b3:	75 db                	jne    990 <printint+0x70>
+     9b5:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     9b9:	75 d5                	jne    990 <printint+0x70>
+  if(b->n > 0)
+     9bb:	85 c0                	test   %eax,%eax
+     9bd:	7f 19                	jg     9d8 <printint+0xb8>
+  b->n = 0;
+     9bf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     9c6:	8d 47 ff             	lea    -0x1(%edi),%eax
+     9c9:	39 f7                	cmp    %esi,%edi
+     9cb:	75 ca                	jne    997 <printint+0x77>
+}
+     9cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d0:	5b                   	pop    %ebx
+     9d1:	5e                   	pop    %esi
+     9d2:	5f                   	pop    %edi
+     9d3:	5d                   	pop    %ebp
+     9d4:	c3                   	ret
+     9d5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     9d8:	83 ec 04             	sub    $0x4,%esp
+     9db:	50                   	push   %eax
+     9dc:	ff 75 d4             	push   -0x2c(%ebp)
+     9df:	ff 33                	push   (%ebx)
+     9e1:	e8 7d fd ff ff       	call   763 <write>
+     9e6:	83 c4 10             	add    $0x10,%esp
+     9e9:	eb d4                	jmp    9bf <printint+0x9f>
+     9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9ef:	90                   	nop
+  neg = 0;
+     9f0:	31 c0                	xor    %eax,%eax
+     9f2:	e9 51 ff ff ff       	jmp    948 <printint+0x28>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+
+00000a00 <putc>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	53                   	push   %ebx
+     a04:	89 c3                	mov    %eax,%ebx
+     a06:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     a09:	8b 48 08             	mov    0x8(%eax),%ecx
+     a0c:	8d 41 01             	lea    0x1(%ecx),%eax
+     a0f:	89 43 08             	mov    %eax,0x8(%ebx)
+     a12:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     a16:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a1b:	74 33                	je     a50 <putc+0x50>
+     a1d:	80 fa 0a             	cmp    $0xa,%dl
+     a20:	74 0e                	je     a30 <putc+0x30>
+}
+     a22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a25:	c9                   	leave
+     a26:	c3                   	ret
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     a30:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     a34:	75 ec                	jne    a22 <putc+0x22>
+  if(b->n > 0)
+     a36:	85 c0                	test   %eax,%eax
+     a38:	7f 16                	jg     a50 <putc+0x50>
+  b->n = 0;
+     a3a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     a41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a44:	c9                   	leave
+     a45:	c3                   	ret
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	50                   	push   %eax
+     a54:	8d 43 0c             	lea    0xc(%ebx),%eax
+     a57:	50                   	push   %eax
+     a58:	ff 33                	push   (%ebx)
+     a5a:	e8 04 fd ff ff       	call   763 <write>
+     a5f:	83 c4 10             	add    $0x10,%esp
+     a62:	eb d6                	jmp    a3a <putc+0x3a>
+     a64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a6f:	90                   	nop
+
+00000a70 <fflush>:
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     a76:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     a7a:	74 04                	je     a80 <fflush+0x10>
+}
+     a7c:	c9                   	leave
+     a7d:	c3                   	ret
+     a7e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a80:	a1 08 1d 00 00       	mov    0x1d08,%eax
+     a85:	85 c0                	test   %eax,%eax
+     a87:	7f 17                	jg     aa0 <fflush+0x30>
+  b->n = 0;
+     a89:	c7 05 08 1d 00 00 00 	movl   $0x0,0x1d08
+     a90:	00 00 00 
+  out.mode = 0;
+     a93:	c7 05 04 1d 00 00 00 	movl   $0x0,0x1d04
+     a9a:	00 00 00 
+}
+     a9d:	c9                   	leave
+     a9e:	c3                   	ret
+     a9f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	50                   	push   %eax
+     aa4:	68 0c 1d 00 00       	push   $0x1d0c
+     aa9:	ff 35 00 1d 00 00    	push   0x1d00
+     aaf:	e8 af fc ff ff       	call   763 <write>
+     ab4:	83 c4 10             	add    $0x10,%esp
+     ab7:	eb d0                	jmp    a89 <fflush+0x19>
+     ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	56                   	push   %esi
+     ac5:	53                   	push   %ebx
+     ac6:	83 ec 3c             	sub    $0x3c,%esp
+     ac9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     acc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     acf:	83 fe 01             	cmp    $0x1,%esi
+     ad2:	0f 84 60 01 00 00    	je     c38 <printf+0x178>
+    b->fd = fd;
+     ad8:	89 35 e0 1a 00 00    	mov    %esi,0x1ae0
+  for(i = 0; fmt[i]; i++){
+     ade:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     ae1:	bf e0 1a 00 00       	mov    $0x1ae0,%edi
+  for(i = 0; fmt[i]; i++){
+     ae6:	84 c0                	test   %al,%al
+     ae8:	74 65                	je     b4f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     aea:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     aed:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     af0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     af2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     af5:	eb 1f                	jmp    b16 <printf+0x56>
+     af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afe:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     b00:	83 f8 25             	cmp    $0x25,%eax
+     b03:	74 3b                	je     b40 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     b05:	89 f8                	mov    %edi,%eax
+     b07:	e8 f4 fe ff ff       	call   a00 <putc>
+  for(i = 0; fmt[i]; i++){
+     b0c:	0f b6 03             	movzbl (%ebx),%eax
+     b0f:	83 c3 01             	add    $0x1,%ebx
+     b12:	84 c0                	test   %al,%al
+     b14:	74 39                	je     b4f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     b16:	0f be d0             	movsbl %al,%edx
+     b19:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     b1c:	85 f6                	test   %esi,%esi
+     b1e:	74 e0                	je     b00 <printf+0x40>
+      }
+    } else if(state == '%'){
+     b20:	83 fe 25             	cmp    $0x25,%esi
+     b23:	75 e7                	jne    b0c <printf+0x4c>
+      if(c == 'd'){
+     b25:	83 f8 25             	cmp    $0x25,%eax
+     b28:	74 57                	je     b81 <printf+0xc1>
+     b2a:	83 e8 63             	sub    $0x63,%eax
+     b2d:	83 f8 15             	cmp    $0x15,%eax
+     b30:	77 36                	ja     b68 <printf+0xa8>
+     b32:	ff 24 85 d4 13 00 00 	jmp    *0x13d4(,%eax,4)
+     b39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     b40:	0f b6 03             	movzbl (%ebx),%eax
+     b43:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     b46:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     b4b:	84 c0                	test   %al,%al
+     b4d:	75 c7                	jne    b16 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     b4f:	8b 47 04             	mov    0x4(%edi),%eax
+     b52:	85 c0                	test   %eax,%eax
+     b54:	0f 84 06 01 00 00    	je     c60 <printf+0x1a0>
+    bflush(b);
+}
+     b5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b5d:	5b                   	pop    %ebx
+     b5e:	5e                   	pop    %esi
+     b5f:	5f                   	pop    %edi
+     b60:	5d                   	pop    %ebp
+     b61:	c3                   	ret
+     b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     b68:	8b 4f 08             	mov    0x8(%edi),%ecx
+     b6b:	8d 41 01             	lea    0x1(%ecx),%eax
+     b6e:	89 47 08             	mov    %eax,0x8(%edi)
+     b71:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     b76:	3d 00 02 00 00       	cmp    $0x200,%eax
+     b7b:	0f 84 77 01 00 00    	je     cf8 <printf+0x238>
+        putc(b, c);
+     b81:	89 f8                	mov    %edi,%eax
+      state = 0;
+     b83:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     b85:	e8 76 fe ff ff       	call   a00 <putc>
+     b8a:	eb 80                	jmp    b0c <printf+0x4c>
+     b8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     b90:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     b93:	83 ec 0c             	sub    $0xc,%esp
+     b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     b9b:	8b 16                	mov    (%esi),%edx
+     b9d:	6a 00                	push   $0x0
+        ap++;
+     b9f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     ba2:	89 f8                	mov    %edi,%eax
+     ba4:	e8 77 fd ff ff       	call   920 <printint>
+        ap++;
+     ba9:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     baf:	31 f6                	xor    %esi,%esi
+     bb1:	e9 56 ff ff ff       	jmp    b0c <printf+0x4c>
+     bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     bc0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     bc3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     bc5:	83 c0 04             	add    $0x4,%eax
+     bc8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     bcb:	85 c9                	test   %ecx,%ecx
+     bcd:	0f 84 cd 00 00 00    	je     ca0 <printf+0x1e0>
+        while(*s != 0){
+     bd3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     bd6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     bd8:	84 d2                	test   %dl,%dl
+     bda:	0f 84 2c ff ff ff    	je     b0c <printf+0x4c>
+          putc(b, *s);
+     be0:	89 f8                	mov    %edi,%eax
+     be2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     be5:	e8 16 fe ff ff       	call   a00 <putc>
+          s++;
+     bea:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     bed:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     bf1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     bf4:	84 d2                	test   %dl,%dl
+     bf6:	75 e8                	jne    be0 <printf+0x120>
+      state = 0;
+     bf8:	31 f6                	xor    %esi,%esi
+     bfa:	e9 0d ff ff ff       	jmp    b0c <printf+0x4c>
+     bff:	90                   	nop
+        printint(b, *ap, 10, 1);
+     c00:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c03:	83 ec 0c             	sub    $0xc,%esp
+     c06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c0b:	8b 16                	mov    (%esi),%edx
+     c0d:	6a 01                	push   $0x1
+     c0f:	eb 8e                	jmp    b9f <printf+0xdf>
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     c18:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     c1b:	89 f8                	mov    %edi,%eax
+     c1d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     c20:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     c23:	e8 d8 fd ff ff       	call   a00 <putc>
+        ap++;
+     c28:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     c2b:	31 f6                	xor    %esi,%esi
+     c2d:	e9 da fe ff ff       	jmp    b0c <printf+0x4c>
+     c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     c38:	8b 15 04 1d 00 00    	mov    0x1d04,%edx
+     c3e:	85 d2                	test   %edx,%edx
+     c40:	74 6e                	je     cb0 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     c42:	0f b6 03             	movzbl (%ebx),%eax
+     c45:	bf 00 1d 00 00       	mov    $0x1d00,%edi
+     c4a:	84 c0                	test   %al,%al
+     c4c:	0f 85 98 fe ff ff    	jne    aea <printf+0x2a>
+     c52:	e9 03 ff ff ff       	jmp    b5a <printf+0x9a>
+     c57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     c60:	8b 47 08             	mov    0x8(%edi),%eax
+     c63:	85 c0                	test   %eax,%eax
+     c65:	7f 19                	jg     c80 <printf+0x1c0>
+  b->n = 0;
+     c67:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     c6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c71:	5b                   	pop    %ebx
+     c72:	5e                   	pop    %esi
+     c73:	5f                   	pop    %edi
+     c74:	5d                   	pop    %ebp
+     c75:	c3                   	ret
+     c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     c80:	83 ec 04             	sub    $0x4,%esp
+     c83:	50                   	push   %eax
+     c84:	8d 47 0c             	lea    0xc(%edi),%eax
+     c87:	50                   	push   %eax
+     c88:	ff 37                	push   (%edi)
+     c8a:	e8 d4 fa ff ff       	call   763 <write>
+  b->n = 0;
+     c8f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     c96:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     c99:	eb d3                	jmp    c6e <printf+0x1ae>
+     c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c9f:	90                   	nop
+     ca0:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     ca5:	b9 cc 13 00 00       	mov    $0x13cc,%ecx
+     caa:	e9 31 ff ff ff       	jmp    be0 <printf+0x120>
+     caf:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     cb0:	83 ec 08             	sub    $0x8,%esp
+     cb3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     cb6:	c7 05 00 1d 00 00 01 	movl   $0x1,0x1d00
+     cbd:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     cc0:	50                   	push   %eax
+     cc1:	6a 01                	push   $0x1
+     cc3:	e8 d3 fa ff ff       	call   79b <fstat>
+     cc8:	83 c4 10             	add    $0x10,%esp
+     ccb:	85 c0                	test   %eax,%eax
+     ccd:	75 22                	jne    cf1 <printf+0x231>
+     ccf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     cd4:	b8 02 00 00 00       	mov    $0x2,%eax
+     cd9:	0f 45 f0             	cmovne %eax,%esi
+     cdc:	89 35 04 1d 00 00    	mov    %esi,0x1d04
+      stdioflush = flushout;
+     ce2:	c7 05 a0 18 00 00 e0 	movl   $0x8e0,0x18a0
+     ce9:	08 00 00 
+     cec:	e9 51 ff ff ff       	jmp    c42 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     cf1:	be 02 00 00 00       	mov    $0x2,%esi
+     cf6:	eb e4                	jmp    cdc <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	8d 47 0c             	lea    0xc(%edi),%eax
+     cfe:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     d01:	68 00 02 00 00       	push   $0x200
+     d06:	50                   	push   %eax
+     d07:	ff 37                	push   (%edi)
+     d09:	e8 55 fa ff ff       	call   763 <write>
+  b->n = 0;
+     d0e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     d15:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     d18:	83 c4 10             	add    $0x10,%esp
+     d1b:	e9 61 fe ff ff       	jmp    b81 <printf+0xc1>
+
+00000d20 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	56                   	push   %esi
+     d24:	53                   	push   %ebx
+     d25:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     d27:	a1 20 1f 00 00       	mov    0x1f20,%eax
+     d2c:	39 d8                	cmp    %ebx,%eax
+     d2e:	0f 83 e4 00 00 00    	jae    e18 <freepages+0xf8>
+     d34:	85 c0                	test   %eax,%eax
+     d36:	0f 84 dc 00 00 00    	je     e18 <freepages+0xf8>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d40:	89 c2                	mov    %eax,%edx
+     d42:	8b 00                	mov    (%eax),%eax
+     d44:	85 c0                	test   %eax,%eax
+     d46:	74 04                	je     d4c <freepages+0x2c>
+     d48:	39 d8                	cmp    %ebx,%eax
+     d4a:	72 f4                	jb     d40 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     d4c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     d4f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     d51:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     d53:	85 c0                	test   %eax,%eax
+     d55:	74 15                	je     d6c <freepages+0x4c>
+    p->prev = s;
+     d57:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     d5a:	8b 73 10             	mov    0x10(%ebx),%esi
+     d5d:	89 f1                	mov    %esi,%ecx
+     d5f:	c1 e1 0c             	shl    $0xc,%ecx
+     d62:	01 d9                	add    %ebx,%ecx
+     d64:	39 c8                	cmp    %ecx,%eax
+     d66:	0f 84 d8 00 00 00    	je     e44 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     d6c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     d6f:	89 c8                	mov    %ecx,%eax
+     d71:	c1 e0 0c             	shl    $0xc,%eax
+     d74:	01 d0                	add    %edx,%eax
+     d76:	39 c3                	cmp    %eax,%ebx
+     d78:	74 16                	je     d90 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     d7a:	8b 03                	mov    (%ebx),%eax
+     d7c:	85 c0                	test   %eax,%eax
+     d7e:	74 40                	je     dc0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     d80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d83:	5b                   	pop    %ebx
+     d84:	5e                   	pop    %esi
+     d85:	5d                   	pop    %ebp
+     d86:	c3                   	ret
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     d90:	03 4b 10             	add    0x10(%ebx),%ecx
+     d93:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     d96:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     d99:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     d9b:	85 c9                	test   %ecx,%ecx
+     d9d:	0f 84 dd 00 00 00    	je     e80 <freepages+0x160>
+    s->prev->next = s->next;
+     da3:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     da5:	85 c0                	test   %eax,%eax
+     da7:	74 06                	je     daf <freepages+0x8f>
+    s->next->prev = s->prev;
+     da9:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     dac:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     daf:	8b 02                	mov    (%edx),%eax
+     db1:	89 d3                	mov    %edx,%ebx
+     db3:	85 c0                	test   %eax,%eax
+     db5:	75 c9                	jne    d80 <freepages+0x60>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+     dc0:	8b 43 10             	mov    0x10(%ebx),%eax
+     dc3:	83 f8 0f             	cmp    $0xf,%eax
+     dc6:	76 b8                	jbe    d80 <freepages+0x60>
+     dc8:	83 ec 0c             	sub    $0xc,%esp
+     dcb:	c1 e0 0c             	shl    $0xc,%eax
+     dce:	6a 00                	push   $0x0
+     dd0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     dd3:	e8 f3 f9 ff ff       	call   7cb <sbrk>
+     dd8:	83 c4 10             	add    $0x10,%esp
+     ddb:	39 c6                	cmp    %eax,%esi
+     ddd:	75 a1                	jne    d80 <freepages+0x60>
+  if(s->prev)
+     ddf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     de2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     de4:	85 d2                	test   %edx,%edx
+     de6:	0f 84 a5 00 00 00    	je     e91 <freepages+0x171>
+    s->prev->next = s->next;
+     dec:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     dee:	85 c0                	test   %eax,%eax
+     df0:	74 06                	je     df8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     df2:	8b 53 04             	mov    0x4(%ebx),%edx
+     df5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     df8:	8b 43 10             	mov    0x10(%ebx),%eax
+     dfb:	83 ec 0c             	sub    $0xc,%esp
+     dfe:	c1 e0 0c             	shl    $0xc,%eax
+     e01:	f7 d8                	neg    %eax
+     e03:	50                   	push   %eax
+     e04:	e8 c2 f9 ff ff       	call   7cb <sbrk>
+     e09:	83 c4 10             	add    $0x10,%esp
+}
+     e0c:	e9 6f ff ff ff       	jmp    d80 <freepages+0x60>
+     e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     e18:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     e1f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     e21:	89 1d 20 1f 00 00    	mov    %ebx,0x1f20
+  if(p)
+     e27:	85 c0                	test   %eax,%eax
+     e29:	74 95                	je     dc0 <freepages+0xa0>
+    p->prev = s;
+     e2b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     e2e:	8b 73 10             	mov    0x10(%ebx),%esi
+     e31:	89 f2                	mov    %esi,%edx
+     e33:	c1 e2 0c             	shl    $0xc,%edx
+     e36:	01 da                	add    %ebx,%edx
+     e38:	39 d0                	cmp    %edx,%eax
+     e3a:	0f 85 3a ff ff ff    	jne    d7a <freepages+0x5a>
+     e40:	89 c1                	mov    %eax,%ecx
+     e42:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     e44:	8b 41 10             	mov    0x10(%ecx),%eax
+     e47:	01 f0                	add    %esi,%eax
+     e49:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     e4c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     e4f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     e51:	85 f6                	test   %esi,%esi
+     e53:	74 35                	je     e8a <freepages+0x16a>
+    s->prev->next = s->next;
+     e55:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     e57:	85 c0                	test   %eax,%eax
+     e59:	74 06                	je     e61 <freepages+0x141>
+    s->next->prev = s->prev;
+     e5b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     e5e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     e61:	85 d2                	test   %edx,%edx
+     e63:	0f 84 11 ff ff ff    	je     d7a <freepages+0x5a>
+     e69:	8b 4a 10             	mov    0x10(%edx),%ecx
+     e6c:	89 c8                	mov    %ecx,%eax
+     e6e:	c1 e0 0c             	shl    $0xc,%eax
+     e71:	01 d0                	add    %edx,%eax
+     e73:	39 c3                	cmp    %eax,%ebx
+     e75:	0f 85 ff fe ff ff    	jne    d7a <freepages+0x5a>
+     e7b:	e9 10 ff ff ff       	jmp    d90 <freepages+0x70>
+    *l = s->next;
+     e80:	a3 20 1f 00 00       	mov    %eax,0x1f20
+     e85:	e9 1b ff ff ff       	jmp    da5 <freepages+0x85>
+     e8a:	a3 20 1f 00 00       	mov    %eax,0x1f20
+     e8f:	eb c6                	jmp    e57 <freepages+0x137>
+     e91:	a3 20 1f 00 00       	mov    %eax,0x1f20
+     e96:	e9 53 ff ff ff       	jmp    dee <freepages+0xce>
+     e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+
+00000ea0 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	56                   	push   %esi
+     ea4:	53                   	push   %ebx
+     ea5:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     ea7:	a1 20 1f 00 00       	mov    0x1f20,%eax
+     eac:	85 c0                	test   %eax,%eax
+     eae:	74 5e                	je     f0e <getpages+0x6e>
+    if(s->npages < n)
+     eb0:	8b 50 10             	mov    0x10(%eax),%edx
+     eb3:	39 da                	cmp    %ebx,%edx
+     eb5:	72 51                	jb     f08 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     eb7:	39 d3                	cmp    %edx,%ebx
+     eb9:	72 25                	jb     ee0 <getpages+0x40>
+  if(s->prev)
+     ebb:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     ebe:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     ec0:	85 c9                	test   %ecx,%ecx
+     ec2:	0f 84 a8 00 00 00    	je     f70 <getpages+0xd0>
+    s->prev->next = s->next;
+     ec8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     eca:	85 d2                	test   %edx,%edx
+     ecc:	74 06                	je     ed4 <getpages+0x34>
+    s->next->prev = s->prev;
+     ece:	8b 48 04             	mov    0x4(%eax),%ecx
+     ed1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     ed4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     ed7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eda:	5b                   	pop    %ebx
+     edb:	5e                   	pop    %esi
+     edc:	5d                   	pop    %ebp
+     edd:	c3                   	ret
+     ede:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     ee0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     ee2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     ee4:	c1 e1 0c             	shl    $0xc,%ecx
+     ee7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     ee9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     eec:	8b 70 04             	mov    0x4(%eax),%esi
+     eef:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     ef2:	8b 10                	mov    (%eax),%edx
+     ef4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     ef6:	85 f6                	test   %esi,%esi
+     ef8:	74 66                	je     f60 <getpages+0xc0>
+        rest->prev->next = rest;
+     efa:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     efc:	8b 11                	mov    (%ecx),%edx
+     efe:	85 d2                	test   %edx,%edx
+     f00:	75 cf                	jne    ed1 <getpages+0x31>
+     f02:	eb d0                	jmp    ed4 <getpages+0x34>
+     f04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     f08:	8b 00                	mov    (%eax),%eax
+     f0a:	85 c0                	test   %eax,%eax
+     f0c:	75 a2                	jne    eb0 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     f0e:	83 ec 0c             	sub    $0xc,%esp
+     f11:	6a 00                	push   $0x0
+     f13:	e8 b3 f8 ff ff       	call   7cb <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     f18:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     f1b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     f21:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     f23:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     f29:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     f2f:	29 d0                	sub    %edx,%eax
+     f31:	c1 e8 0c             	shr    $0xc,%eax
+     f34:	39 d8                	cmp    %ebx,%eax
+     f36:	72 48                	jb     f80 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     f38:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     f3a:	89 d8                	mov    %ebx,%eax
+     f3c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     f3f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     f41:	c1 e0 0c             	shl    $0xc,%eax
+     f44:	01 f0                	add    %esi,%eax
+     f46:	50                   	push   %eax
+     f47:	e8 7f f8 ff ff       	call   7cb <sbrk>
+     f4c:	83 c4 10             	add    $0x10,%esp
+     f4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f52:	74 2c                	je     f80 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     f54:	01 f0                	add    %esi,%eax
+     f56:	e9 79 ff ff ff       	jmp    ed4 <getpages+0x34>
+     f5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f5f:	90                   	nop
+        runs = rest;
+     f60:	89 0d 20 1f 00 00    	mov    %ecx,0x1f20
+     f66:	eb 96                	jmp    efe <getpages+0x5e>
+     f68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+    *l = s->next;
+     f70:	89 15 20 1f 00 00    	mov    %edx,0x1f20
+     f76:	e9 4f ff ff ff       	jmp    eca <getpages+0x2a>
+     f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+    return 0;
+     f80:	31 c0                	xor    %eax,%eax
+     f82:	e9 50 ff ff ff       	jmp    ed7 <getpages+0x37>
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+
+00000f90 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	57                   	push   %edi
+     f94:	56                   	push   %esi
+     f95:	53                   	push   %ebx
+     f96:	83 ec 1c             	sub    $0x1c,%esp
+     f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     f9c:	85 c0                	test   %eax,%eax
+     f9e:	0f 84 97 00 00 00    	je     103b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     fa4:	89 c3                	mov    %eax,%ebx
+     fa6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     fac:	8b 73 14             	mov    0x14(%ebx),%esi
+     faf:	83 fe 01             	cmp    $0x1,%esi
+     fb2:	74 74                	je     1028 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     fb4:	85 f6                	test   %esi,%esi
+     fb6:	74 5d                	je     1015 <free+0x85>
+  if(s->free == 0)
+     fb8:	8b 53 08             	mov    0x8(%ebx),%edx
+     fbb:	85 d2                	test   %edx,%edx
+     fbd:	0f 84 85 00 00 00    	je     1048 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     fc3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     fc5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     fc8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     fcb:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     fce:	8b 04 f5 44 1f 00 00 	mov    0x1f44(,%esi,8),%eax
+  s->inuse--;
+     fd5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     fd8:	83 c0 01             	add    $0x1,%eax
+     fdb:	89 04 f5 44 1f 00 00 	mov    %eax,0x1f44(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     fe2:	85 d2                	test   %edx,%edx
+     fe4:	75 55                	jne    103b <free+0xab>
+     fe6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     feb:	89 f1                	mov    %esi,%ecx
+     fed:	d3 ea                	shr    %cl,%edx
+     fef:	39 c2                	cmp    %eax,%edx
+     ff1:	73 7d                	jae    1070 <free+0xe0>
+  if(s->prev)
+     ff3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     ff6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     ff8:	85 ff                	test   %edi,%edi
+     ffa:	0f 84 a0 00 00 00    	je     10a0 <free+0x110>
+    s->prev->next = s->next;
+    1000:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    1002:	85 c9                	test   %ecx,%ecx
+    1004:	74 06                	je     100c <free+0x7c>
+    s->next->prev = s->prev;
+    1006:	8b 7b 04             	mov    0x4(%ebx),%edi
+    1009:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    100c:	29 d0                	sub    %edx,%eax
+    100e:	89 04 f5 44 1f 00 00 	mov    %eax,0x1f44(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    1015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    1018:	89 d8                	mov    %ebx,%eax
+}
+    101a:	5b                   	pop    %ebx
+    101b:	5e                   	pop    %esi
+    101c:	5f                   	pop    %edi
+    101d:	5d                   	pop    %ebp
+    freepages(s);
+    101e:	e9 fd fc ff ff       	jmp    d20 <freepages>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    1028:	8b 43 10             	mov    0x10(%ebx),%eax
+    102b:	83 ec 08             	sub    $0x8,%esp
+    102e:	c1 e0 0c             	shl    $0xc,%eax
+    1031:	50                   	push   %eax
+    1032:	53                   	push   %ebx
+    1033:	e8 6b f8 ff ff       	call   8a3 <munmap>
+    1038:	83 c4 10             	add    $0x10,%esp
+}
+    103b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    103e:	5b                   	pop    %ebx
+    103f:	5e                   	pop    %esi
+    1040:	5f                   	pop    %edi
+    1041:	5d                   	pop    %ebp
+    1042:	c3                   	ret
+    1043:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1047:	90                   	nop
+  s->next = *l;
+    1048:	8b 14 f5 40 1f 00 00 	mov    0x1f40(,%esi,8),%edx
+  s->prev = 0;
+    104f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    1056:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    1058:	85 d2                	test   %edx,%edx
+    105a:	74 06                	je     1062 <free+0xd2>
+    (*l)->prev = s;
+    105c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    105f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    1062:	89 1c f5 40 1f 00 00 	mov    %ebx,0x1f40(,%esi,8)
+}
+    1069:	e9 55 ff ff ff       	jmp    fc3 <free+0x33>
+    106e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1070:	83 ec 0c             	sub    $0xc,%esp
+    1073:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1076:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1079:	6a 00                	push   $0x0
+    107b:	c1 e7 0c             	shl    $0xc,%edi
+    107e:	01 df                	add    %ebx,%edi
+    1080:	e8 46 f7 ff ff       	call   7cb <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1085:	83 c4 10             	add    $0x10,%esp
+    1088:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    108b:	39 c7                	cmp    %eax,%edi
+    108d:	75 ac                	jne    103b <free+0xab>
+    108f:	8b 04 f5 44 1f 00 00 	mov    0x1f44(,%esi,8),%eax
+    1096:	e9 58 ff ff ff       	jmp    ff3 <free+0x63>
+    109b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    109f:	90                   	nop
+    *l = s->next;
+    10a0:	89 0c f5 40 1f 00 00 	mov    %ecx,0x1f40(,%esi,8)
+    10a7:	e9 56 ff ff ff       	jmp    1002 <free+0x72>
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    10b0:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    10b1:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    10b6:	89 e5                	mov    %esp,%ebp
+    10b8:	57                   	push   %edi
+    10b9:	56                   	push   %esi
+    10ba:	53                   	push   %ebx
+    10bb:	83 ec 1c             	sub    $0x1c,%esp
+    10be:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    10c1:	83 f8 10             	cmp    $0x10,%eax
+    10c4:	0f 86 92 00 00 00    	jbe    115c <malloc+0xac>
+    10ca:	ba 01 00 00 00       	mov    $0x1,%edx
+    10cf:	eb 13                	jmp    10e4 <malloc+0x34>
+    10d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10d8:	89 d3                	mov    %edx,%ebx
+    10da:	d3 e3                	shl    %cl,%ebx
+    10dc:	39 c3                	cmp    %eax,%ebx
+    10de:	0f 83 84 00 00 00    	jae    1168 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    10e4:	83 c1 01             	add    $0x1,%ecx
+    10e7:	83 f9 0b             	cmp    $0xb,%ecx
+    10ea:	75 ec                	jne    10d8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    10ec:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    10f1:	0f 87 c9 00 00 00    	ja     11c0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    10f7:	05 17 10 00 00       	add    $0x1017,%eax
+    10fc:	89 c3                	mov    %eax,%ebx
+    10fe:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    1101:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    1106:	77 28                	ja     1130 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    1108:	89 d8                	mov    %ebx,%eax
+    110a:	e8 91 fd ff ff       	call   ea0 <getpages>
+    110f:	85 c0                	test   %eax,%eax
+    1111:	0f 84 a9 00 00 00    	je     11c0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    1117:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    111e:	83 c0 18             	add    $0x18,%eax
+}
+    1121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1124:	5b                   	pop    %ebx
+    1125:	5e                   	pop    %esi
+    1126:	5f                   	pop    %edi
+    1127:	5d                   	pop    %ebp
+    1128:	c3                   	ret
+    1129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    1130:	89 d8                	mov    %ebx,%eax
+    1132:	83 ec 08             	sub    $0x8,%esp
+    1135:	c1 e0 0c             	shl    $0xc,%eax
+    1138:	6a 00                	push   $0x0
+    113a:	6a ff                	push   $0xffffffff
+    113c:	6a 22                	push   $0x22
+    113e:	6a 03                	push   $0x3
+    1140:	50                   	push   %eax
+    1141:	6a 00                	push   $0x0
+    1143:	e8 53 f7 ff ff       	call   89b <mmap>
+    if(s == MAP_FAILED)
+    1148:	83 c4 20             	add    $0x20,%esp
+    114b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    114e:	74 b8                	je     1108 <malloc+0x58>
+      s->shift = MAPRUN;
+    1150:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    1157:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    115a:	eb c2                	jmp    111e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    115c:	bb 10 00 00 00       	mov    $0x10,%ebx
+    1161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    1168:	8b 34 cd 40 1f 00 00 	mov    0x1f40(,%ecx,8),%esi
+    116f:	85 f6                	test   %esi,%esi
+    1171:	74 57                	je     11ca <malloc+0x11a>
+  classes[shift].nfree--;
+    1173:	8b 1c cd 44 1f 00 00 	mov    0x1f44(,%ecx,8),%ebx
+  o = s->free;
+    117a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    117d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1180:	89 14 cd 44 1f 00 00 	mov    %edx,0x1f44(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1187:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1189:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    118d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1190:	85 ff                	test   %edi,%edi
+    1192:	75 8d                	jne    1121 <malloc+0x71>
+  if(s->prev)
+    1194:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1197:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1199:	85 db                	test   %ebx,%ebx
+    119b:	0f 84 b7 00 00 00    	je     1258 <malloc+0x1a8>
+    s->prev->next = s->next;
+    11a1:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    11a3:	85 d2                	test   %edx,%edx
+    11a5:	0f 84 76 ff ff ff    	je     1121 <malloc+0x71>
+    s->next->prev = s->prev;
+    11ab:	8b 4e 04             	mov    0x4(%esi),%ecx
+    11ae:	89 4a 04             	mov    %ecx,0x4(%edx)
+    11b1:	e9 6b ff ff ff       	jmp    1121 <malloc+0x71>
+    11b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11bd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    11c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    11c3:	31 c0                	xor    %eax,%eax
+}
+    11c5:	5b                   	pop    %ebx
+    11c6:	5e                   	pop    %esi
+    11c7:	5f                   	pop    %edi
+    11c8:	5d                   	pop    %ebp
+    11c9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    11ca:	b8 01 00 00 00       	mov    $0x1,%eax
+    11cf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    11d2:	e8 c9 fc ff ff       	call   ea0 <getpages>
+    11d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    11da:	85 c0                	test   %eax,%eax
+    11dc:	89 c2                	mov    %eax,%edx
+    11de:	74 e0                	je     11c0 <malloc+0x110>
+    s->shift = shift;
+    11e0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11e3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    11e5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    11ec:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    11f1:	89 df                	mov    %ebx,%edi
+    11f3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    11f5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    11f7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    11fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    11fd:	83 e8 01             	sub    $0x1,%eax
+    1200:	d3 e0                	shl    %cl,%eax
+    1202:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1205:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1209:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    120c:	eb 04                	jmp    1212 <malloc+0x162>
+    120e:	66 90                	xchg   %ax,%ax
+    1210:	89 c8                	mov    %ecx,%eax
+    1212:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1215:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1217:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    121a:	89 c6                	mov    %eax,%esi
+    121c:	39 da                	cmp    %ebx,%edx
+    121e:	7f f0                	jg     1210 <malloc+0x160>
+    1220:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1223:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1226:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1229:	8b 04 cd 40 1f 00 00 	mov    0x1f40(,%ecx,8),%eax
+  s->prev = 0;
+    1230:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1237:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1239:	85 c0                	test   %eax,%eax
+    123b:	74 03                	je     1240 <malloc+0x190>
+    (*l)->prev = s;
+    123d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1240:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1243:	89 14 cd 40 1f 00 00 	mov    %edx,0x1f40(,%ecx,8)
+    classes[shift].nfree += n;
+    124a:	89 d6                	mov    %edx,%esi
+    124c:	03 1c cd 44 1f 00 00 	add    0x1f44(,%ecx,8),%ebx
+    1253:	e9 22 ff ff ff       	jmp    117a <malloc+0xca>
+    *l = s->next;
+    1258:	89 14 cd 40 1f 00 00 	mov    %edx,0x1f40(,%ecx,8)
+    125f:	e9 3f ff ff ff       	jmp    11a3 <malloc+0xf3>
@@ -0,0 +1,117 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Tests of the buffering in printf and gets, kept apart
+// from usertests, which must stay small enough for mkfs
+// to store.
+
+// Output that printf holds in its buffer is written once,
+// before fork and at exit.
+void
+outputtest(void)
+{
+  char buf[8];
+  int fd, n, pid;
+
+  printf(1, "stdio output test\n");
+  unlink("stdiofile");
+  pid = fork();
+  if(pid < 0){
+    printf(1, "stdio output test fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(1);
+    if(open("stdiofile", O_CREATE|O_RDWR) != 1)
+      exit();
+    printf(1, "a");
+    if(fork() == 0){
+      printf(1, "b");
+      exit();
+    }
+    wait();
+    printf(1, "c");
+    exit();
+  }
+  wait();
+  fd = open("stdiofile", O_RDONLY);
+  if(fd < 0){
+    printf(1, "stdio output test open failed\n");
+    exit();
+  }
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  unlink("stdiofile");
+  buf[n < 0 ? 0 : n] = 0;
+  if(strcmp(buf, "abc") != 0){
+    printf(1, "stdio output test wrote %s\n", buf);
+    exit();
+  }
+  printf(1, "stdio output test OK\n");
+}
+
+// gets from a file takes only its line, leaving the
+// rest for a child that reads the same fd 0.
+void
+inputtest(void)
+{
+  char buf[16];
+  int fd, n, pid, fds[2];
+
+  printf(1, "stdio input test\n");
+  fd = open("stdiofile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "one\ntwo\n", 8) != 8){
+    printf(1, "stdio input test create failed\n");
+    exit();
+  }
+  close(fd);
+  if(pipe(fds) != 0){
+    printf(1, "stdio input test pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "stdio input test fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    close(0);
+    if(open("stdiofile", O_RDONLY) != 0)
+      exit();
+    gets(buf, sizeof(buf));
+    if(strcmp(buf, "one\n") != 0)
+      exit();
+    if(fork() == 0){
+      n = read(0, buf, sizeof(buf));
+      if(n > 0)
+        write(fds[1], buf, n);
+      exit();
+    }
+    wait();
+    exit();
+  }
+  close(fds[1]);
+  n = read(fds[0], buf, sizeof(buf) - 1);
+  close(fds[0]);
+  wait();
+  unlink("stdiofile");
+  buf[n < 0 ? 0 : n] = 0;
+  if(strcmp(buf, "two\n") != 0){
+    printf(1, "stdio input test child read %s\n", buf);
+    exit();
+  }
+  printf(1, "stdio input test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "stdiotest starting\n");
+  outputtest();
+  inputtest();
+  printf(1, "stdiotest done\n");
+  exit();
+}
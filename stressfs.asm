@@ -0,0 +1,2243 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 e4 0f 00 00       	push   $0xfe4
+  44:	6a 01                	push   $0x1
+  46:	e8 f5 07 00 00       	call   840 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 45 02 00 00       	call   2a0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 bd 00 00 00       	call   120 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 f7 0f 00 00       	push   $0xff7
+  78:	6a 01                	push   $0x1
+  7a:	e8 c1 07 00 00       	call   840 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 66 04 00 00       	call   503 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 2c 04 00 00       	call   4e3 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 23 04 00 00       	call   4eb <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 01 10 00 00       	push   $0x1001
+  cf:	6a 01                	push   $0x1
+  d1:	e8 6a 07 00 00       	call   840 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 18 04 00 00       	call   503 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 dc 03 00 00       	call   4db <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 db 03 00 00       	call   4eb <close>
+
+  wait();
+ 110:	e8 b6 03 00 00       	call   4cb <wait>
+
+  exit();
+ 115:	e8 36 00 00 00       	call   150 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+ 120:	a1 a0 14 00 00       	mov    0x14a0,%eax
+ 125:	85 c0                	test   %eax,%eax
+ 127:	74 17                	je     140 <fork+0x20>
+{
+ 129:	55                   	push   %ebp
+ 12a:	89 e5                	mov    %esp,%ebp
+ 12c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+ 12f:	ff d0                	call   *%eax
+  return _fork();
+}
+ 131:	c9                   	leave
+  return _fork();
+ 132:	e9 84 03 00 00       	jmp    4bb <_fork>
+ 137:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13e:	66 90                	xchg   %ax,%ax
+ 140:	e9 76 03 00 00       	jmp    4bb <_fork>
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <exit>:
+
+int
+exit(void)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+ 156:	a1 a0 14 00 00       	mov    0x14a0,%eax
+ 15b:	85 c0                	test   %eax,%eax
+ 15d:	74 02                	je     161 <exit+0x11>
+    stdioflush();
+ 15f:	ff d0                	call   *%eax
+  _exit();
+ 161:	e8 5d 03 00 00       	call   4c3 <_exit>
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+ 170:	55                   	push   %ebp
+  if(stdioflush)
+ 171:	a1 a0 14 00 00       	mov    0x14a0,%eax
+{
+ 176:	89 e5                	mov    %esp,%ebp
+ 178:	56                   	push   %esi
+ 179:	53                   	push   %ebx
+ 17a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 17d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+ 180:	85 c0                	test   %eax,%eax
+ 182:	74 02                	je     186 <exec+0x16>
+    stdioflush();
+ 184:	ff d0                	call   *%eax
+  return _exec(path, argv);
+ 186:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 189:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 18c:	5b                   	pop    %ebx
+ 18d:	5e                   	pop    %esi
+ 18e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+ 18f:	e9 67 03 00 00       	jmp    4fb <_exec>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+ 1a9:	a1 a0 14 00 00       	mov    0x14a0,%eax
+{
+ 1ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 1b4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+ 1b7:	85 c0                	test   %eax,%eax
+ 1b9:	74 02                	je     1bd <spawn+0x1d>
+    stdioflush();
+ 1bb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+ 1bd:	89 7d 10             	mov    %edi,0x10(%ebp)
+ 1c0:	89 75 0c             	mov    %esi,0xc(%ebp)
+ 1c3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1c6:	83 c4 0c             	add    $0xc,%esp
+ 1c9:	5b                   	pop    %ebx
+ 1ca:	5e                   	pop    %esi
+ 1cb:	5f                   	pop    %edi
+ 1cc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+ 1cd:	e9 79 04 00 00       	jmp    64b <_spawn>
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1e1:	31 c0                	xor    %eax,%eax
+{
+ 1e3:	89 e5                	mov    %esp,%ebp
+ 1e5:	53                   	push   %ebx
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1f7:	83 c0 01             	add    $0x1,%eax
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	75 f2                	jne    1f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 201:	89 c8                	mov    %ecx,%eax
+ 203:	c9                   	leave
+ 204:	c3                   	ret
+ 205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+ 217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 21a:	0f b6 02             	movzbl (%edx),%eax
+ 21d:	84 c0                	test   %al,%al
+ 21f:	75 17                	jne    238 <strcmp+0x28>
+ 221:	eb 3a                	jmp    25d <strcmp+0x4d>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 22c:	83 c2 01             	add    $0x1,%edx
+ 22f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 232:	84 c0                	test   %al,%al
+ 234:	74 1a                	je     250 <strcmp+0x40>
+    p++, q++;
+ 236:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 238:	0f b6 19             	movzbl (%ecx),%ebx
+ 23b:	38 c3                	cmp    %al,%bl
+ 23d:	74 e9                	je     228 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 23f:	29 d8                	sub    %ebx,%eax
+}
+ 241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 244:	c9                   	leave
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 250:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 254:	31 c0                	xor    %eax,%eax
+ 256:	29 d8                	sub    %ebx,%eax
+}
+ 258:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 25d:	0f b6 19             	movzbl (%ecx),%ebx
+ 260:	31 c0                	xor    %eax,%eax
+ 262:	eb db                	jmp    23f <strcmp+0x2f>
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 276:	80 3a 00             	cmpb   $0x0,(%edx)
+ 279:	74 15                	je     290 <strlen+0x20>
+ 27b:	31 c0                	xor    %eax,%eax
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 287:	89 c1                	mov    %eax,%ecx
+ 289:	75 f5                	jne    280 <strlen+0x10>
+    ;
+  return n;
+}
+ 28b:	89 c8                	mov    %ecx,%eax
+ 28d:	5d                   	pop    %ebp
+ 28e:	c3                   	ret
+ 28f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 290:	31 c9                	xor    %ecx,%ecx
+}
+ 292:	5d                   	pop    %ebp
+ 293:	89 c8                	mov    %ecx,%eax
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ad:	89 d7                	mov    %edx,%edi
+ 2af:	fc                   	cld
+ 2b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2b5:	89 d0                	mov    %edx,%eax
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ca:	0f b6 10             	movzbl (%eax),%edx
+ 2cd:	84 d2                	test   %dl,%dl
+ 2cf:	75 12                	jne    2e3 <strchr+0x23>
+ 2d1:	eb 1d                	jmp    2f0 <strchr+0x30>
+ 2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d7:	90                   	nop
+ 2d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2dc:	83 c0 01             	add    $0x1,%eax
+ 2df:	84 d2                	test   %dl,%dl
+ 2e1:	74 0d                	je     2f0 <strchr+0x30>
+    if(*s == c)
+ 2e3:	38 d1                	cmp    %dl,%cl
+ 2e5:	75 f1                	jne    2d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2e7:	5d                   	pop    %ebp
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2f0:	31 c0                	xor    %eax,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	53                   	push   %ebx
+ 306:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 309:	a1 a0 14 00 00       	mov    0x14a0,%eax
+{
+ 30e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 311:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 314:	85 c0                	test   %eax,%eax
+ 316:	74 02                	je     31a <gets+0x1a>
+    stdioflush();
+ 318:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 31a:	a1 c8 16 00 00       	mov    0x16c8,%eax
+ 31f:	85 c0                	test   %eax,%eax
+ 321:	0f 84 99 00 00 00    	je     3c0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 327:	31 db                	xor    %ebx,%ebx
+ 329:	eb 21                	jmp    34c <gets+0x4c>
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 330:	8d 50 01             	lea    0x1(%eax),%edx
+ 333:	0f b6 80 c0 14 00 00 	movzbl 0x14c0(%eax),%eax
+ 33a:	89 15 c0 16 00 00    	mov    %edx,0x16c0
+    buf[i++] = c;
+ 340:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 344:	3c 0a                	cmp    $0xa,%al
+ 346:	74 60                	je     3a8 <gets+0xa8>
+ 348:	3c 0d                	cmp    $0xd,%al
+ 34a:	74 5c                	je     3a8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 34c:	89 da                	mov    %ebx,%edx
+ 34e:	83 c3 01             	add    $0x1,%ebx
+ 351:	39 fb                	cmp    %edi,%ebx
+ 353:	7d 55                	jge    3aa <gets+0xaa>
+    if(in.r == in.n){
+ 355:	a1 c0 16 00 00       	mov    0x16c0,%eax
+ 35a:	3b 05 c4 16 00 00    	cmp    0x16c4,%eax
+ 360:	75 ce                	jne    330 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 362:	83 ec 04             	sub    $0x4,%esp
+ 365:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 368:	c7 05 c4 16 00 00 00 	movl   $0x0,0x16c4
+ 36f:	00 00 00 
+ 372:	c7 05 c0 16 00 00 00 	movl   $0x0,0x16c0
+ 379:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 37c:	ff 35 c8 16 00 00    	push   0x16c8
+ 382:	68 c0 14 00 00       	push   $0x14c0
+ 387:	6a 00                	push   $0x0
+ 389:	e8 4d 01 00 00       	call   4db <read>
+ 38e:	83 c4 10             	add    $0x10,%esp
+ 391:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 394:	85 c0                	test   %eax,%eax
+ 396:	a3 c4 16 00 00       	mov    %eax,0x16c4
+ 39b:	7e 56                	jle    3f3 <gets+0xf3>
+    c = in.buf[in.r++];
+ 39d:	a1 c0 16 00 00       	mov    0x16c0,%eax
+ 3a2:	eb 8c                	jmp    330 <gets+0x30>
+ 3a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 3a8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 3aa:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 3ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3b1:	89 f0                	mov    %esi,%eax
+ 3b3:	5b                   	pop    %ebx
+ 3b4:	5e                   	pop    %esi
+ 3b5:	5f                   	pop    %edi
+ 3b6:	5d                   	pop    %ebp
+ 3b7:	c3                   	ret
+ 3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 3c0:	83 ec 08             	sub    $0x8,%esp
+ 3c3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 3c6:	50                   	push   %eax
+ 3c7:	6a 00                	push   $0x0
+ 3c9:	e8 4d 01 00 00       	call   51b <fstat>
+ 3ce:	83 c4 10             	add    $0x10,%esp
+ 3d1:	89 c2                	mov    %eax,%edx
+ 3d3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d8:	85 d2                	test   %edx,%edx
+ 3da:	75 0d                	jne    3e9 <gets+0xe9>
+ 3dc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 3e1:	ba 00 02 00 00       	mov    $0x200,%edx
+ 3e6:	0f 44 c2             	cmove  %edx,%eax
+ 3e9:	a3 c8 16 00 00       	mov    %eax,0x16c8
+ 3ee:	e9 34 ff ff ff       	jmp    327 <gets+0x27>
+        in.n = 0;
+ 3f3:	c7 05 c4 16 00 00 00 	movl   $0x0,0x16c4
+ 3fa:	00 00 00 
+        break;
+ 3fd:	eb ab                	jmp    3aa <gets+0xaa>
+ 3ff:	90                   	nop
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <_exit>:
+RAWSYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <_exec>:
+RAWSYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <get_parent_id>:
+SYSCALL(get_parent_id)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <get_children>:
+SYSCALL(get_children)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <set_path>:
+SYSCALL(set_path)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <set_sleep>:
+SYSCALL(set_sleep)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <get_time>:
+SYSCALL(get_time)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <change_process_level>:
+SYSCALL(change_process_level)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <print_processes_info>:
+SYSCALL(print_processes_info)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 5b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <barrier_wait>:
+SYSCALL(barrier_wait)
+ 5bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 5c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 5cb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 5d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 5db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <sem_create>:
+SYSCALL(sem_create)
+ 5e3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <event_create>:
+SYSCALL(event_create)
+ 5eb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sync_post>:
+SYSCALL(sync_post)
+ 5f3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sync_wait>:
+SYSCALL(sync_wait)
+ 5fb:	b8 29 00 00 00       	mov    $0x29,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <sync_close>:
+SYSCALL(sync_close)
+ 603:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <event_reset>:
+SYSCALL(event_reset)
+ 60b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 613:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mmap>:
+SYSCALL(mmap)
+ 61b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <munmap>:
+SYSCALL(munmap)
+ 623:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <shmget>:
+SYSCALL(shmget)
+ 62b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <shmat>:
+SYSCALL(shmat)
+ 633:	b8 30 00 00 00       	mov    $0x30,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <shmdt>:
+SYSCALL(shmdt)
+ 63b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <shmrm>:
+SYSCALL(shmrm)
+ 643:	b8 32 00 00 00       	mov    $0x32,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <_spawn>:
+RAWSYSCALL(spawn)
+ 64b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <memstat>:
+SYSCALL(memstat)
+ 653:	b8 34 00 00 00       	mov    $0x34,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+ 65b:	66 90                	xchg   %ax,%ax
+ 65d:	66 90                	xchg   %ax,%ax
+ 65f:	90                   	nop
+
+00000660 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 666:	a1 08 19 00 00       	mov    0x1908,%eax
+ 66b:	85 c0                	test   %eax,%eax
+ 66d:	7e 17                	jle    686 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 66f:	83 ec 04             	sub    $0x4,%esp
+ 672:	50                   	push   %eax
+ 673:	68 0c 19 00 00       	push   $0x190c
+ 678:	ff 35 00 19 00 00    	push   0x1900
+ 67e:	e8 60 fe ff ff       	call   4e3 <write>
+ 683:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 686:	c7 05 08 19 00 00 00 	movl   $0x0,0x1908
+ 68d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 690:	c7 05 04 19 00 00 00 	movl   $0x0,0x1904
+ 697:	00 00 00 
+}
+ 69a:	c9                   	leave
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6a6:	89 d1                	mov    %edx,%ecx
+{
+ 6a8:	56                   	push   %esi
+ 6a9:	53                   	push   %ebx
+ 6aa:	89 c3                	mov    %eax,%ebx
+ 6ac:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 6af:	85 d2                	test   %edx,%edx
+ 6b1:	0f 89 b9 00 00 00    	jns    770 <printint+0xd0>
+ 6b7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6bb:	0f 84 af 00 00 00    	je     770 <printint+0xd0>
+    x = -xx;
+ 6c1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6c8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 6cb:	31 f6                	xor    %esi,%esi
+ 6cd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6d0:	89 c8                	mov    %ecx,%eax
+ 6d2:	31 d2                	xor    %edx,%edx
+ 6d4:	89 f3                	mov    %esi,%ebx
+ 6d6:	f7 f7                	div    %edi
+ 6d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6db:	0f b6 92 68 10 00 00 	movzbl 0x1068(%edx),%edx
+ 6e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6e6:	89 ca                	mov    %ecx,%edx
+ 6e8:	89 c1                	mov    %eax,%ecx
+ 6ea:	39 fa                	cmp    %edi,%edx
+ 6ec:	73 e2                	jae    6d0 <printint+0x30>
+  if(neg)
+ 6ee:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 6f1:	89 d9                	mov    %ebx,%ecx
+ 6f3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f6:	85 c0                	test   %eax,%eax
+ 6f8:	74 07                	je     701 <printint+0x61>
+    buf[i++] = '-';
+ 6fa:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ff:	89 f1                	mov    %esi,%ecx
+ 701:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 704:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 706:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 709:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 70c:	01 f7                	add    %esi,%edi
+ 70e:	eb 09                	jmp    719 <printint+0x79>
+
+  while(--i >= 0)
+ 710:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 713:	39 f7                	cmp    %esi,%edi
+ 715:	74 36                	je     74d <printint+0xad>
+ 717:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 719:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 71c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 71f:	8d 42 01             	lea    0x1(%edx),%eax
+ 722:	89 43 08             	mov    %eax,0x8(%ebx)
+ 725:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 729:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 72e:	74 28                	je     758 <printint+0xb8>
+ 730:	80 f9 0a             	cmp    $0xa,%cl
+ 733:	75 db                	jne    710 <printint+0x70>
+ 735:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 739:	75 d5                	jne    710 <printint+0x70>
+  if(b->n > 0)
+ 73b:	85 c0                	test   %eax,%eax
+ 73d:	7f 19                	jg     758 <printint+0xb8>
+  b->n = 0;
+ 73f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 746:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 749:	39 f7                	cmp    %esi,%edi
+ 74b:	75 ca                	jne    717 <printint+0x77>
+}
+ 74d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 750:	5b                   	pop    %ebx
+ 751:	5e                   	pop    %esi
+ 752:	5f                   	pop    %edi
+ 753:	5d                   	pop    %ebp
+ 754:	c3                   	ret
+ 755:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 758:	83 ec 04             	sub    $0x4,%esp
+ 75b:	50                   	push   %eax
+ 75c:	ff 75 d4             	push   -0x2c(%ebp)
+ 75f:	ff 33                	push   (%ebx)
+ 761:	e8 7d fd ff ff       	call   4e3 <write>
+ 766:	83 c4 10             	add    $0x10,%esp
+ 769:	eb d4                	jmp    73f <printint+0x9f>
+ 76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  neg = 0;
+ 770:	31 c0                	xor    %eax,%eax
+ 772:	e9 51 ff ff ff       	jmp    6c8 <printint+0x28>
+ 777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77e:	66 90                	xchg   %ax,%ax
+
+00000780 <putc>:
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	53                   	push   %ebx
+ 784:	89 c3                	mov    %eax,%ebx
+ 786:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 789:	8b 48 08             	mov    0x8(%eax),%ecx
+ 78c:	8d 41 01             	lea    0x1(%ecx),%eax
+ 78f:	89 43 08             	mov    %eax,0x8(%ebx)
+ 792:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 796:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 79b:	74 33                	je     7d0 <putc+0x50>
+ 79d:	80 fa 0a             	cmp    $0xa,%dl
+ 7a0:	74 0e                	je     7b0 <putc+0x30>
+}
+ 7a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a5:	c9                   	leave
+ 7a6:	c3                   	ret
+ 7a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ae:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 7b0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 7b4:	75 ec                	jne    7a2 <putc+0x22>
+  if(b->n > 0)
+ 7b6:	85 c0                	test   %eax,%eax
+ 7b8:	7f 16                	jg     7d0 <putc+0x50>
+  b->n = 0;
+ 7ba:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 7c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7c4:	c9                   	leave
+ 7c5:	c3                   	ret
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	50                   	push   %eax
+ 7d4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 7d7:	50                   	push   %eax
+ 7d8:	ff 33                	push   (%ebx)
+ 7da:	e8 04 fd ff ff       	call   4e3 <write>
+ 7df:	83 c4 10             	add    $0x10,%esp
+ 7e2:	eb d6                	jmp    7ba <putc+0x3a>
+ 7e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+
+000007f0 <fflush>:
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 7f6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 7fa:	74 04                	je     800 <fflush+0x10>
+}
+ 7fc:	c9                   	leave
+ 7fd:	c3                   	ret
+ 7fe:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 800:	a1 08 19 00 00       	mov    0x1908,%eax
+ 805:	85 c0                	test   %eax,%eax
+ 807:	7f 17                	jg     820 <fflush+0x30>
+  b->n = 0;
+ 809:	c7 05 08 19 00 00 00 	movl   $0x0,0x1908
+ 810:	00 00 00 
+  out.mode = 0;
+ 813:	c7 05 04 19 00 00 00 	movl   $0x0,0x1904
+ 81a:	00 00 00 
+}
+ 81d:	c9                   	leave
+ 81e:	c3                   	ret
+ 81f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	50                   	push   %eax
+ 824:	68 0c 19 00 00       	push   $0x190c
+ 829:	ff 35 00 19 00 00    	push   0x1900
+ 82f:	e8 af fc ff ff       	call   4e3 <write>
+ 834:	83 c4 10             	add    $0x10,%esp
+ 837:	eb d0                	jmp    809 <fflush+0x19>
+ 839:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 3c             	sub    $0x3c,%esp
+ 849:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 84c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 84f:	83 fe 01             	cmp    $0x1,%esi
+ 852:	0f 84 60 01 00 00    	je     9b8 <printf+0x178>
+    b->fd = fd;
+ 858:	89 35 e0 16 00 00    	mov    %esi,0x16e0
+  for(i = 0; fmt[i]; i++){
+ 85e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 861:	bf e0 16 00 00       	mov    $0x16e0,%edi
+  for(i = 0; fmt[i]; i++){
+ 866:	84 c0                	test   %al,%al
+ 868:	74 65                	je     8cf <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 86a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 86d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 870:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 872:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 875:	eb 1f                	jmp    896 <printf+0x56>
+ 877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 880:	83 f8 25             	cmp    $0x25,%eax
+ 883:	74 3b                	je     8c0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 885:	89 f8                	mov    %edi,%eax
+ 887:	e8 f4 fe ff ff       	call   780 <putc>
+  for(i = 0; fmt[i]; i++){
+ 88c:	0f b6 03             	movzbl (%ebx),%eax
+ 88f:	83 c3 01             	add    $0x1,%ebx
+ 892:	84 c0                	test   %al,%al
+ 894:	74 39                	je     8cf <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 896:	0f be d0             	movsbl %al,%edx
+ 899:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 89c:	85 f6                	test   %esi,%esi
+ 89e:	74 e0                	je     880 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 8a0:	83 fe 25             	cmp    $0x25,%esi
+ 8a3:	75 e7                	jne    88c <printf+0x4c>
+      if(c == 'd'){
+ 8a5:	83 f8 25             	cmp    $0x25,%eax
+ 8a8:	74 57                	je     901 <printf+0xc1>
+ 8aa:	83 e8 63             	sub    $0x63,%eax
+ 8ad:	83 f8 15             	cmp    $0x15,%eax
+ 8b0:	77 36                	ja     8e8 <printf+0xa8>
+ 8b2:	ff 24 85 10 10 00 00 	jmp    *0x1010(,%eax,4)
+ 8b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 8c0:	0f b6 03             	movzbl (%ebx),%eax
+ 8c3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 8c6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 8cb:	84 c0                	test   %al,%al
+ 8cd:	75 c7                	jne    896 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 8cf:	8b 47 04             	mov    0x4(%edi),%eax
+ 8d2:	85 c0                	test   %eax,%eax
+ 8d4:	0f 84 06 01 00 00    	je     9e0 <printf+0x1a0>
+    bflush(b);
+}
+ 8da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8dd:	5b                   	pop    %ebx
+ 8de:	5e                   	pop    %esi
+ 8df:	5f                   	pop    %edi
+ 8e0:	5d                   	pop    %ebp
+ 8e1:	c3                   	ret
+ 8e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 8e8:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 8eb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 8ee:	89 47 08             	mov    %eax,0x8(%edi)
+ 8f1:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 8f6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 8fb:	0f 84 77 01 00 00    	je     a78 <printf+0x238>
+        putc(b, c);
+ 901:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 903:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 905:	e8 76 fe ff ff       	call   780 <putc>
+ 90a:	eb 80                	jmp    88c <printf+0x4c>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 910:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 91b:	8b 16                	mov    (%esi),%edx
+ 91d:	6a 00                	push   $0x0
+        ap++;
+ 91f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 922:	89 f8                	mov    %edi,%eax
+ 924:	e8 77 fd ff ff       	call   6a0 <printint>
+        ap++;
+ 929:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 92c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92f:	31 f6                	xor    %esi,%esi
+ 931:	e9 56 ff ff ff       	jmp    88c <printf+0x4c>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 940:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 943:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 94b:	85 c9                	test   %ecx,%ecx
+ 94d:	0f 84 cd 00 00 00    	je     a20 <printf+0x1e0>
+        while(*s != 0){
+ 953:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 956:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 958:	84 d2                	test   %dl,%dl
+ 95a:	0f 84 2c ff ff ff    	je     88c <printf+0x4c>
+          putc(b, *s);
+ 960:	89 f8                	mov    %edi,%eax
+ 962:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 965:	e8 16 fe ff ff       	call   780 <putc>
+          s++;
+ 96a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 96d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 971:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 974:	84 d2                	test   %dl,%dl
+ 976:	75 e8                	jne    960 <printf+0x120>
+      state = 0;
+ 978:	31 f6                	xor    %esi,%esi
+ 97a:	e9 0d ff ff ff       	jmp    88c <printf+0x4c>
+ 97f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 980:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 16                	mov    (%esi),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	eb 8e                	jmp    91f <printf+0xdf>
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 998:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 99b:	89 f8                	mov    %edi,%eax
+ 99d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 9a0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 9a3:	e8 d8 fd ff ff       	call   780 <putc>
+        ap++;
+ 9a8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 9ab:	31 f6                	xor    %esi,%esi
+ 9ad:	e9 da fe ff ff       	jmp    88c <printf+0x4c>
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 9b8:	8b 15 04 19 00 00    	mov    0x1904,%edx
+ 9be:	85 d2                	test   %edx,%edx
+ 9c0:	74 6e                	je     a30 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 9c2:	0f b6 03             	movzbl (%ebx),%eax
+ 9c5:	bf 00 19 00 00       	mov    $0x1900,%edi
+ 9ca:	84 c0                	test   %al,%al
+ 9cc:	0f 85 98 fe ff ff    	jne    86a <printf+0x2a>
+ 9d2:	e9 03 ff ff ff       	jmp    8da <printf+0x9a>
+ 9d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9de:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 9e0:	8b 47 08             	mov    0x8(%edi),%eax
+ 9e3:	85 c0                	test   %eax,%eax
+ 9e5:	7f 19                	jg     a00 <printf+0x1c0>
+  b->n = 0;
+ 9e7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f1:	5b                   	pop    %ebx
+ 9f2:	5e                   	pop    %esi
+ 9f3:	5f                   	pop    %edi
+ 9f4:	5d                   	pop    %ebp
+ 9f5:	c3                   	ret
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	50                   	push   %eax
+ a04:	8d 47 0c             	lea    0xc(%edi),%eax
+ a07:	50                   	push   %eax
+ a08:	ff 37                	push   (%edi)
+ a0a:	e8 d4 fa ff ff       	call   4e3 <write>
+  b->n = 0;
+ a0f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ a16:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ a19:	eb d3                	jmp    9ee <printf+0x1ae>
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+ a20:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ a25:	b9 07 10 00 00       	mov    $0x1007,%ecx
+ a2a:	e9 31 ff ff ff       	jmp    960 <printf+0x120>
+ a2f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a30:	83 ec 08             	sub    $0x8,%esp
+ a33:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ a36:	c7 05 00 19 00 00 01 	movl   $0x1,0x1900
+ a3d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a40:	50                   	push   %eax
+ a41:	6a 01                	push   $0x1
+ a43:	e8 d3 fa ff ff       	call   51b <fstat>
+ a48:	83 c4 10             	add    $0x10,%esp
+ a4b:	85 c0                	test   %eax,%eax
+ a4d:	75 22                	jne    a71 <printf+0x231>
+ a4f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ a54:	b8 02 00 00 00       	mov    $0x2,%eax
+ a59:	0f 45 f0             	cmovne %eax,%esi
+ a5c:	89 35 04 19 00 00    	mov    %esi,0x1904
+      stdioflush = flushout;
+ a62:	c7 05 a0 14 00 00 60 	movl   $0x660,0x14a0
+ a69:	06 00 00 
+ a6c:	e9 51 ff ff ff       	jmp    9c2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ a71:	be 02 00 00 00       	mov    $0x2,%esi
+ a76:	eb e4                	jmp    a5c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ a78:	83 ec 04             	sub    $0x4,%esp
+ a7b:	8d 47 0c             	lea    0xc(%edi),%eax
+ a7e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ a81:	68 00 02 00 00       	push   $0x200
+ a86:	50                   	push   %eax
+ a87:	ff 37                	push   (%edi)
+ a89:	e8 55 fa ff ff       	call   4e3 <write>
+  b->n = 0;
+ a8e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ a95:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ a98:	83 c4 10             	add    $0x10,%esp
+ a9b:	e9 61 fe ff ff       	jmp    901 <printf+0xc1>
+
+00000aa0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	56                   	push   %esi
+ aa4:	53                   	push   %ebx
+ aa5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ aa7:	a1 20 1b 00 00       	mov    0x1b20,%eax
+ aac:	39 d8                	cmp    %ebx,%eax
+ aae:	0f 83 e4 00 00 00    	jae    b98 <freepages+0xf8>
+ ab4:	85 c0                	test   %eax,%eax
+ ab6:	0f 84 dc 00 00 00    	je     b98 <freepages+0xf8>
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ac0:	89 c2                	mov    %eax,%edx
+ ac2:	8b 00                	mov    (%eax),%eax
+ ac4:	85 c0                	test   %eax,%eax
+ ac6:	74 04                	je     acc <freepages+0x2c>
+ ac8:	39 d8                	cmp    %ebx,%eax
+ aca:	72 f4                	jb     ac0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ acc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ acf:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ ad1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ ad3:	85 c0                	test   %eax,%eax
+ ad5:	74 15                	je     aec <freepages+0x4c>
+    p->prev = s;
+ ad7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ ada:	8b 73 10             	mov    0x10(%ebx),%esi
+ add:	89 f1                	mov    %esi,%ecx
+ adf:	c1 e1 0c             	shl    $0xc,%ecx
+ ae2:	01 d9                	add    %ebx,%ecx
+ ae4:	39 c8                	cmp    %ecx,%eax
+ ae6:	0f 84 d8 00 00 00    	je     bc4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ aec:	8b 4a 10             	mov    0x10(%edx),%ecx
+ aef:	89 c8                	mov    %ecx,%eax
+ af1:	c1 e0 0c             	shl    $0xc,%eax
+ af4:	01 d0                	add    %edx,%eax
+ af6:	39 c3                	cmp    %eax,%ebx
+ af8:	74 16                	je     b10 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ afa:	8b 03                	mov    (%ebx),%eax
+ afc:	85 c0                	test   %eax,%eax
+ afe:	74 40                	je     b40 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ b00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b03:	5b                   	pop    %ebx
+ b04:	5e                   	pop    %esi
+ b05:	5d                   	pop    %ebp
+ b06:	c3                   	ret
+ b07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ b10:	03 4b 10             	add    0x10(%ebx),%ecx
+ b13:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ b16:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ b19:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ b1b:	85 c9                	test   %ecx,%ecx
+ b1d:	0f 84 dd 00 00 00    	je     c00 <freepages+0x160>
+    s->prev->next = s->next;
+ b23:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ b25:	85 c0                	test   %eax,%eax
+ b27:	74 06                	je     b2f <freepages+0x8f>
+    s->next->prev = s->prev;
+ b29:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ b2c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ b2f:	8b 02                	mov    (%edx),%eax
+ b31:	89 d3                	mov    %edx,%ebx
+ b33:	85 c0                	test   %eax,%eax
+ b35:	75 c9                	jne    b00 <freepages+0x60>
+ b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3e:	66 90                	xchg   %ax,%ax
+ b40:	8b 43 10             	mov    0x10(%ebx),%eax
+ b43:	83 f8 0f             	cmp    $0xf,%eax
+ b46:	76 b8                	jbe    b00 <freepages+0x60>
+ b48:	83 ec 0c             	sub    $0xc,%esp
+ b4b:	c1 e0 0c             	shl    $0xc,%eax
+ b4e:	6a 00                	push   $0x0
+ b50:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ b53:	e8 f3 f9 ff ff       	call   54b <sbrk>
+ b58:	83 c4 10             	add    $0x10,%esp
+ b5b:	39 c6                	cmp    %eax,%esi
+ b5d:	75 a1                	jne    b00 <freepages+0x60>
+  if(s->prev)
+ b5f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ b62:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ b64:	85 d2                	test   %edx,%edx
+ b66:	0f 84 a5 00 00 00    	je     c11 <freepages+0x171>
+    s->prev->next = s->next;
+ b6c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ b6e:	85 c0                	test   %eax,%eax
+ b70:	74 06                	je     b78 <freepages+0xd8>
+    s->next->prev = s->prev;
+ b72:	8b 53 04             	mov    0x4(%ebx),%edx
+ b75:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ b78:	8b 43 10             	mov    0x10(%ebx),%eax
+ b7b:	83 ec 0c             	sub    $0xc,%esp
+ b7e:	c1 e0 0c             	shl    $0xc,%eax
+ b81:	f7 d8                	neg    %eax
+ b83:	50                   	push   %eax
+ b84:	e8 c2 f9 ff ff       	call   54b <sbrk>
+ b89:	83 c4 10             	add    $0x10,%esp
+}
+ b8c:	e9 6f ff ff ff       	jmp    b00 <freepages+0x60>
+ b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ b98:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ b9f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ ba1:	89 1d 20 1b 00 00    	mov    %ebx,0x1b20
+  if(p)
+ ba7:	85 c0                	test   %eax,%eax
+ ba9:	74 95                	je     b40 <freepages+0xa0>
+    p->prev = s;
+ bab:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ bae:	8b 73 10             	mov    0x10(%ebx),%esi
+ bb1:	89 f2                	mov    %esi,%edx
+ bb3:	c1 e2 0c             	shl    $0xc,%edx
+ bb6:	01 da                	add    %ebx,%edx
+ bb8:	39 d0                	cmp    %edx,%eax
+ bba:	0f 85 3a ff ff ff    	jne    afa <freepages+0x5a>
+ bc0:	89 c1                	mov    %eax,%ecx
+ bc2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ bc4:	8b 41 10             	mov    0x10(%ecx),%eax
+ bc7:	01 f0                	add    %esi,%eax
+ bc9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ bcc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ bcf:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ bd1:	85 f6                	test   %esi,%esi
+ bd3:	74 35                	je     c0a <freepages+0x16a>
+    s->prev->next = s->next;
+ bd5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ bd7:	85 c0                	test   %eax,%eax
+ bd9:	74 06                	je     be1 <freepages+0x141>
+    s->next->prev = s->prev;
+ bdb:	8b 49 04             	mov    0x4(%ecx),%ecx
+ bde:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ be1:	85 d2                	test   %edx,%edx
+ be3:	0f 84 11 ff ff ff    	je     afa <freepages+0x5a>
+ be9:	8b 4a 10             	mov    0x10(%edx),%ecx
+ bec:	89 c8                	mov    %ecx,%eax
+ bee:	c1 e0 0c             	shl    $0xc,%eax
+ bf1:	01 d0                	add    %edx,%eax
+ bf3:	39 c3                	cmp    %eax,%ebx
+ bf5:	0f 85 ff fe ff ff    	jne    afa <freepages+0x5a>
+ bfb:	e9 10 ff ff ff       	jmp    b10 <freepages+0x70>
+    *l = s->next;
+ c00:	a3 20 1b 00 00       	mov    %eax,0x1b20
+ c05:	e9 1b ff ff ff       	jmp    b25 <freepages+0x85>
+ c0a:	a3 20 1b 00 00       	mov    %eax,0x1b20
+ c0f:	eb c6                	jmp    bd7 <freepages+0x137>
+ c11:	a3 20 1b 00 00       	mov    %eax,0x1b20
+ c16:	e9 53 ff ff ff       	jmp    b6e <freepages+0xce>
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+
+00000c20 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	56                   	push   %esi
+ c24:	53                   	push   %ebx
+ c25:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ c27:	a1 20 1b 00 00       	mov    0x1b20,%eax
+ c2c:	85 c0                	test   %eax,%eax
+ c2e:	74 5e                	je     c8e <getpages+0x6e>
+    if(s->npages < n)
+ c30:	8b 50 10             	mov    0x10(%eax),%edx
+ c33:	39 da                	cmp    %ebx,%edx
+ c35:	72 51                	jb     c88 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ c37:	39 d3                	cmp    %edx,%ebx
+ c39:	72 25                	jb     c60 <getpages+0x40>
+  if(s->prev)
+ c3b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ c3e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ c40:	85 c9                	test   %ecx,%ecx
+ c42:	0f 84 a8 00 00 00    	je     cf0 <getpages+0xd0>
+    s->prev->next = s->next;
+ c48:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ c4a:	85 d2                	test   %edx,%edx
+ c4c:	74 06                	je     c54 <getpages+0x34>
+    s->next->prev = s->prev;
+ c4e:	8b 48 04             	mov    0x4(%eax),%ecx
+ c51:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ c54:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c5a:	5b                   	pop    %ebx
+ c5b:	5e                   	pop    %esi
+ c5c:	5d                   	pop    %ebp
+ c5d:	c3                   	ret
+ c5e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c60:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ c62:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ c64:	c1 e1 0c             	shl    $0xc,%ecx
+ c67:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ c69:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ c6c:	8b 70 04             	mov    0x4(%eax),%esi
+ c6f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ c72:	8b 10                	mov    (%eax),%edx
+ c74:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ c76:	85 f6                	test   %esi,%esi
+ c78:	74 66                	je     ce0 <getpages+0xc0>
+        rest->prev->next = rest;
+ c7a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ c7c:	8b 11                	mov    (%ecx),%edx
+ c7e:	85 d2                	test   %edx,%edx
+ c80:	75 cf                	jne    c51 <getpages+0x31>
+ c82:	eb d0                	jmp    c54 <getpages+0x34>
+ c84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ c88:	8b 00                	mov    (%eax),%eax
+ c8a:	85 c0                	test   %eax,%eax
+ c8c:	75 a2                	jne    c30 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ c8e:	83 ec 0c             	sub    $0xc,%esp
+ c91:	6a 00                	push   $0x0
+ c93:	e8 b3 f8 ff ff       	call   54b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ c98:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ c9b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ ca1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ ca3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ ca9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ caf:	29 d0                	sub    %edx,%eax
+ cb1:	c1 e8 0c             	shr    $0xc,%eax
+ cb4:	39 d8                	cmp    %ebx,%eax
+ cb6:	72 48                	jb     d00 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ cb8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ cba:	89 d8                	mov    %ebx,%eax
+ cbc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ cbf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ cc1:	c1 e0 0c             	shl    $0xc,%eax
+ cc4:	01 f0                	add    %esi,%eax
+ cc6:	50                   	push   %eax
+ cc7:	e8 7f f8 ff ff       	call   54b <sbrk>
+ ccc:	83 c4 10             	add    $0x10,%esp
+ ccf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cd2:	74 2c                	je     d00 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ cd4:	01 f0                	add    %esi,%eax
+ cd6:	e9 79 ff ff ff       	jmp    c54 <getpages+0x34>
+ cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cdf:	90                   	nop
+        runs = rest;
+ ce0:	89 0d 20 1b 00 00    	mov    %ecx,0x1b20
+ ce6:	eb 96                	jmp    c7e <getpages+0x5e>
+ ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+    *l = s->next;
+ cf0:	89 15 20 1b 00 00    	mov    %edx,0x1b20
+ cf6:	e9 4f ff ff ff       	jmp    c4a <getpages+0x2a>
+ cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+    return 0;
+ d00:	31 c0                	xor    %eax,%eax
+ d02:	e9 50 ff ff ff       	jmp    c57 <getpages+0x37>
+ d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0e:	66 90                	xchg   %ax,%ax
+
+00000d10 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 1c             	sub    $0x1c,%esp
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ d1c:	85 c0                	test   %eax,%eax
+ d1e:	0f 84 97 00 00 00    	je     dbb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ d24:	89 c3                	mov    %eax,%ebx
+ d26:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ d2c:	8b 73 14             	mov    0x14(%ebx),%esi
+ d2f:	83 fe 01             	cmp    $0x1,%esi
+ d32:	74 74                	je     da8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ d34:	85 f6                	test   %esi,%esi
+ d36:	74 5d                	je     d95 <free+0x85>
+  if(s->free == 0)
+ d38:	8b 53 08             	mov    0x8(%ebx),%edx
+ d3b:	85 d2                	test   %edx,%edx
+ d3d:	0f 84 85 00 00 00    	je     dc8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ d43:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ d45:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ d48:	8b 43 0c             	mov    0xc(%ebx),%eax
+ d4b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ d4e:	8b 04 f5 44 1b 00 00 	mov    0x1b44(,%esi,8),%eax
+  s->inuse--;
+ d55:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ d58:	83 c0 01             	add    $0x1,%eax
+ d5b:	89 04 f5 44 1b 00 00 	mov    %eax,0x1b44(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d62:	85 d2                	test   %edx,%edx
+ d64:	75 55                	jne    dbb <free+0xab>
+ d66:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ d6b:	89 f1                	mov    %esi,%ecx
+ d6d:	d3 ea                	shr    %cl,%edx
+ d6f:	39 c2                	cmp    %eax,%edx
+ d71:	73 7d                	jae    df0 <free+0xe0>
+  if(s->prev)
+ d73:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ d76:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ d78:	85 ff                	test   %edi,%edi
+ d7a:	0f 84 a0 00 00 00    	je     e20 <free+0x110>
+    s->prev->next = s->next;
+ d80:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ d82:	85 c9                	test   %ecx,%ecx
+ d84:	74 06                	je     d8c <free+0x7c>
+    s->next->prev = s->prev;
+ d86:	8b 7b 04             	mov    0x4(%ebx),%edi
+ d89:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ d8c:	29 d0                	sub    %edx,%eax
+ d8e:	89 04 f5 44 1b 00 00 	mov    %eax,0x1b44(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ d98:	89 d8                	mov    %ebx,%eax
+}
+ d9a:	5b                   	pop    %ebx
+ d9b:	5e                   	pop    %esi
+ d9c:	5f                   	pop    %edi
+ d9d:	5d                   	pop    %ebp
+    freepages(s);
+ d9e:	e9 fd fc ff ff       	jmp    aa0 <freepages>
+ da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ da7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ da8:	8b 43 10             	mov    0x10(%ebx),%eax
+ dab:	83 ec 08             	sub    $0x8,%esp
+ dae:	c1 e0 0c             	shl    $0xc,%eax
+ db1:	50                   	push   %eax
+ db2:	53                   	push   %ebx
+ db3:	e8 6b f8 ff ff       	call   623 <munmap>
+ db8:	83 c4 10             	add    $0x10,%esp
+}
+ dbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ dbe:	5b                   	pop    %ebx
+ dbf:	5e                   	pop    %esi
+ dc0:	5f                   	pop    %edi
+ dc1:	5d                   	pop    %ebp
+ dc2:	c3                   	ret
+ dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dc7:	90                   	nop
+  s->next = *l;
+ dc8:	8b 14 f5 40 1b 00 00 	mov    0x1b40(,%esi,8),%edx
+  s->prev = 0;
+ dcf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ dd6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ dd8:	85 d2                	test   %edx,%edx
+ dda:	74 06                	je     de2 <free+0xd2>
+    (*l)->prev = s;
+ ddc:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ ddf:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ de2:	89 1c f5 40 1b 00 00 	mov    %ebx,0x1b40(,%esi,8)
+}
+ de9:	e9 55 ff ff ff       	jmp    d43 <free+0x33>
+ dee:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ df6:	8b 7b 10             	mov    0x10(%ebx),%edi
+ df9:	6a 00                	push   $0x0
+ dfb:	c1 e7 0c             	shl    $0xc,%edi
+ dfe:	01 df                	add    %ebx,%edi
+ e00:	e8 46 f7 ff ff       	call   54b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ e05:	83 c4 10             	add    $0x10,%esp
+ e08:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ e0b:	39 c7                	cmp    %eax,%edi
+ e0d:	75 ac                	jne    dbb <free+0xab>
+ e0f:	8b 04 f5 44 1b 00 00 	mov    0x1b44(,%esi,8),%eax
+ e16:	e9 58 ff ff ff       	jmp    d73 <free+0x63>
+ e1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+    *l = s->next;
+ e20:	89 0c f5 40 1b 00 00 	mov    %ecx,0x1b40(,%esi,8)
+ e27:	e9 56 ff ff ff       	jmp    d82 <free+0x72>
+ e2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e30:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e31:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ e36:	89 e5                	mov    %esp,%ebp
+ e38:	57                   	push   %edi
+ e39:	56                   	push   %esi
+ e3a:	53                   	push   %ebx
+ e3b:	83 ec 1c             	sub    $0x1c,%esp
+ e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ e41:	83 f8 10             	cmp    $0x10,%eax
+ e44:	0f 86 92 00 00 00    	jbe    edc <malloc+0xac>
+ e4a:	ba 01 00 00 00       	mov    $0x1,%edx
+ e4f:	eb 13                	jmp    e64 <malloc+0x34>
+ e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e58:	89 d3                	mov    %edx,%ebx
+ e5a:	d3 e3                	shl    %cl,%ebx
+ e5c:	39 c3                	cmp    %eax,%ebx
+ e5e:	0f 83 84 00 00 00    	jae    ee8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ e64:	83 c1 01             	add    $0x1,%ecx
+ e67:	83 f9 0b             	cmp    $0xb,%ecx
+ e6a:	75 ec                	jne    e58 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ e6c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ e71:	0f 87 c9 00 00 00    	ja     f40 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ e77:	05 17 10 00 00       	add    $0x1017,%eax
+ e7c:	89 c3                	mov    %eax,%ebx
+ e7e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ e81:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ e86:	77 28                	ja     eb0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ e88:	89 d8                	mov    %ebx,%eax
+ e8a:	e8 91 fd ff ff       	call   c20 <getpages>
+ e8f:	85 c0                	test   %eax,%eax
+ e91:	0f 84 a9 00 00 00    	je     f40 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ e97:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ e9e:	83 c0 18             	add    $0x18,%eax
+}
+ ea1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ea4:	5b                   	pop    %ebx
+ ea5:	5e                   	pop    %esi
+ ea6:	5f                   	pop    %edi
+ ea7:	5d                   	pop    %ebp
+ ea8:	c3                   	ret
+ ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ eb0:	89 d8                	mov    %ebx,%eax
+ eb2:	83 ec 08             	sub    $0x8,%esp
+ eb5:	c1 e0 0c             	shl    $0xc,%eax
+ eb8:	6a 00                	push   $0x0
+ eba:	6a ff                	push   $0xffffffff
+ ebc:	6a 22                	push   $0x22
+ ebe:	6a 03                	push   $0x3
+ ec0:	50                   	push   %eax
+ ec1:	6a 00                	push   $0x0
+ ec3:	e8 53 f7 ff ff       	call   61b <mmap>
+    if(s == MAP_FAILED)
+ ec8:	83 c4 20             	add    $0x20,%esp
+ ecb:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ece:	74 b8                	je     e88 <malloc+0x58>
+      s->shift = MAPRUN;
+ ed0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ ed7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ eda:	eb c2                	jmp    e9e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ edc:	bb 10 00 00 00       	mov    $0x10,%ebx
+ ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ ee8:	8b 34 cd 40 1b 00 00 	mov    0x1b40(,%ecx,8),%esi
+ eef:	85 f6                	test   %esi,%esi
+ ef1:	74 57                	je     f4a <malloc+0x11a>
+  classes[shift].nfree--;
+ ef3:	8b 1c cd 44 1b 00 00 	mov    0x1b44(,%ecx,8),%ebx
+  o = s->free;
+ efa:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ efd:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ f00:	89 14 cd 44 1b 00 00 	mov    %edx,0x1b44(,%ecx,8)
+  s->free = NEXTFREE(o);
+ f07:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ f09:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ f0d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ f10:	85 ff                	test   %edi,%edi
+ f12:	75 8d                	jne    ea1 <malloc+0x71>
+  if(s->prev)
+ f14:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ f17:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ f19:	85 db                	test   %ebx,%ebx
+ f1b:	0f 84 b7 00 00 00    	je     fd8 <malloc+0x1a8>
+    s->prev->next = s->next;
+ f21:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ f23:	85 d2                	test   %edx,%edx
+ f25:	0f 84 76 ff ff ff    	je     ea1 <malloc+0x71>
+    s->next->prev = s->prev;
+ f2b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ f2e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ f31:	e9 6b ff ff ff       	jmp    ea1 <malloc+0x71>
+ f36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f3d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ f40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ f43:	31 c0                	xor    %eax,%eax
+}
+ f45:	5b                   	pop    %ebx
+ f46:	5e                   	pop    %esi
+ f47:	5f                   	pop    %edi
+ f48:	5d                   	pop    %ebp
+ f49:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ f4a:	b8 01 00 00 00       	mov    $0x1,%eax
+ f4f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ f52:	e8 c9 fc ff ff       	call   c20 <getpages>
+ f57:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ f5a:	85 c0                	test   %eax,%eax
+ f5c:	89 c2                	mov    %eax,%edx
+ f5e:	74 e0                	je     f40 <malloc+0x110>
+    s->shift = shift;
+ f60:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f63:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ f65:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ f6c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f71:	89 df                	mov    %ebx,%edi
+ f73:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ f75:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ f77:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ f7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ f7d:	83 e8 01             	sub    $0x1,%eax
+ f80:	d3 e0                	shl    %cl,%eax
+ f82:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ f85:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f89:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ f8c:	eb 04                	jmp    f92 <malloc+0x162>
+ f8e:	66 90                	xchg   %ax,%ax
+ f90:	89 c8                	mov    %ecx,%eax
+ f92:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ f95:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ f97:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ f9a:	89 c6                	mov    %eax,%esi
+ f9c:	39 da                	cmp    %ebx,%edx
+ f9e:	7f f0                	jg     f90 <malloc+0x160>
+ fa0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ fa3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ fa6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ fa9:	8b 04 cd 40 1b 00 00 	mov    0x1b40(,%ecx,8),%eax
+  s->prev = 0;
+ fb0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ fb7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ fb9:	85 c0                	test   %eax,%eax
+ fbb:	74 03                	je     fc0 <malloc+0x190>
+    (*l)->prev = s;
+ fbd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ fc0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ fc3:	89 14 cd 40 1b 00 00 	mov    %edx,0x1b40(,%ecx,8)
+    classes[shift].nfree += n;
+ fca:	89 d6                	mov    %edx,%esi
+ fcc:	03 1c cd 44 1b 00 00 	add    0x1b44(,%ecx,8),%ebx
+ fd3:	e9 22 ff ff ff       	jmp    efa <malloc+0xca>
+    *l = s->next;
+ fd8:	89 14 cd 40 1b 00 00 	mov    %edx,0x1b40(,%ecx,8)
+ fdf:	e9 3f ff ff ff       	jmp    f23 <malloc+0xf3>
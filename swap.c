@@ -0,0 +1,315 @@
+//
+// Paging user memory out to the swap area, the disk blocks
+// that mkfs leaves after the file system, when physical memory
+// runs out. The PTE of a page that is out has PTE_SWAP instead
+// of PTE_P, the slot number in place of the page address, and
+// the page's other flags; pagefault() reads it back with
+// swapin(). fork shares slots as it shares pages, so each slot
+// has a reference count.
+//
+// Victims are picked by a clock hand sweeping the user pages
+// of the current process and of processes preempted in user
+// space: a page goes out if it was not accessed (PTE_A) since
+// the hand last passed it and no other page table or cache
+// holds it. Processes sleeping in the kernel are left alone,
+// since the kernel may touch their memory while holding a
+// spinlock, where a fault cannot sleep to read a page back.
+// For the same reason the current process keeps its pages
+// while a system call has prefaulted them (see uvmprefault).
+//
+// swapout() changes other processes' PTEs with interrupts off
+// and relies on their TLB being flushed when they are next
+// switched to. That holds only with one CPU: another CPU
+// could be running the process and keep using its cached
+// mapping of the page, so NCPU > 1 would need a TLB shootdown.
+//
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "mman.h"
+
+#if NCPU > 1
+#error "swapout() does not invalidate other CPUs' TLBs"
+#endif
+
+#define PGBLOCKS (PGSIZE / BSIZE)
+#define NSLOT (SWAPBLOCKS / PGBLOCKS)
+
+#define SLOT(pte) ((uint)(pte) >> PTXSHIFT)
+
+struct {
+  struct spinlock lock;   // protects ref and nused
+  struct sleeplock io;    // one page in or out at a time
+  struct buf buf;
+  uint dev;
+  uint start;             // first block of the swap area
+  int nslot;              // 0 if there is no swap area
+  uchar ref[NSLOT];       // page tables holding each slot
+  int nused;
+  int rotor;              // where to look for a free slot
+  int hand;               // clock hand: process table slot
+  uint handva;            // and user address
+  uint nout;
+  uint nin;
+} swap;
+
+// Find the swap area on dev, which mkfs describes in the
+// superblock. Must run in a process, after iinit.
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swap.io, "swapio");
+  initsleeplock(&swap.buf.lock, "swapbuf");
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / PGBLOCKS;
+  if(swap.nslot > NSLOT)
+    swap.nslot = NSLOT;
+}
+
+// Read or write page mem from or to slot.
+// Caller holds swap.io.
+static void
+swapio(char *mem, uint slot, int write)
+{
+  int i;
+
+  acquiresleep(&swap.buf.lock);
+  for(i = 0; i < PGBLOCKS; i++){
+    swap.buf.dev = swap.dev;
+    swap.buf.blockno = swap.start + slot*PGBLOCKS + i;
+    if(write){
+      memmove(swap.buf.data, mem + i*BSIZE, BSIZE);
+      swap.buf.flags = B_DIRTY;
+    } else
+      swap.buf.flags = 0;
+    iderw(&swap.buf);
+    if(!write)
+      memmove(mem + i*BSIZE, swap.buf.data, BSIZE);
+  }
+  releasesleep(&swap.buf.lock);
+}
+
+static int
+slotalloc(void)
+{
+  int i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < swap.nslot; i++){
+    s = (swap.rotor + i) % swap.nslot;
+    if(swap.ref[s] == 0){
+      swap.ref[s] = 1;
+      swap.nused++;
+      swap.rotor = s + 1;
+      release(&swap.lock);
+      return s;
+    }
+  }
+  release(&swap.lock);
+  return -1;
+}
+
+// Another page table holds the swapped-out page pte.
+void
+swapdup(uint pte)
+{
+  acquire(&swap.lock);
+  swap.ref[SLOT(pte)]++;
+  release(&swap.lock);
+}
+
+// A page table drops the swapped-out page pte.
+void
+swapfree(uint pte)
+{
+  acquire(&swap.lock);
+  if(--swap.ref[SLOT(pte)] == 0)
+    swap.nused--;
+  release(&swap.lock);
+}
+
+// Pages the swap area has room for.
+int
+swapfreepages(void)
+{
+  return swap.nslot - swap.nused;
+}
+
+// Pages the swap area holds in all.
+int
+swappages(void)
+{
+  return swap.nslot;
+}
+
+// Advance the clock hand over the pages of p to one that may
+// be paged out, giving each accessed page a second chance.
+// Returns its PTE, with its address in *va, or 0 if there is
+// none after a few sweeps of p. Interrupts are off.
+static pte_t*
+victim(struct proc *p, uint *va)
+{
+  struct vma *v;
+  pde_t pde;
+  pte_t *pte;
+  uint a;
+  int wraps;
+
+  for(wraps = 0; wraps < 3; ){
+    a = swap.handva;
+    if(a >= KERNBASE){
+      swap.handva = 0;
+      wraps++;
+      continue;
+    }
+    pde = p->pgdir[PDX(a)];
+    if((pde & PTE_P) == 0 || (pde & PTE_PS)){
+      // No page table, or a 4 MB page, which stays in.
+      swap.handva = PGADDR(PDX(a) + 1, 0, 0);
+      continue;
+    }
+    swap.handva += PGSIZE;
+    pte = &((pte_t*)P2V(PTE_ADDR(pde)))[PTX(a)];
+    if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      continue;
+    }
+    if(krefcount(P2V(PTE_ADDR(*pte))) != 1)
+      continue;
+    if((v = findvma(p, a)) != 0 && (v->flags & MAP_SHARED))
+      continue;
+    *va = a;
+    return pte;
+  }
+  return 0;
+}
+
+// Page out one user page. Returns 0, or -1 if there is no
+// page to page out or no free slot.
+int
+swapout(void)
+{
+  struct proc *p;
+  pte_t *pte;
+  char *mem;
+  uint va;
+  int i, slot;
+
+  if(swap.nslot == 0)
+    return -1;
+  acquiresleep(&swap.io);
+  if((slot = slotalloc()) < 0){
+    releasesleep(&swap.io);
+    return -1;
+  }
+  // Pick the page and unmap it before anyone can run.
+  pushcli();
+  p = 0;
+  pte = 0;
+  va = 0;
+  mem = 0;
+  for(i = 0; i < NPROC && pte == 0; i++){
+    if((p = swapproc(&swap.hand)) == 0)
+      break;
+    if((pte = victim(p, &va)) == 0){
+      swap.hand = (swap.hand + 1) % NPROC;
+      swap.handva = 0;
+    }
+  }
+  if(pte){
+    mem = P2V(PTE_ADDR(*pte));
+    *pte = slot << PTXSHIFT | PTE_SWAP |
+           (PTE_FLAGS(*pte) & ~(PTE_P|PTE_A|PTE_D));
+    // Other processes flush their TLB when switched to;
+    // with one CPU none of them is running now.
+    if(p == myproc())
+      invlpg((void*)va);
+  }
+  popcli();
+  if(pte == 0){
+    swapfree(slot << PTXSHIFT);
+    releasesleep(&swap.io);
+    return -1;
+  }
+  swapio(mem, slot, 1);
+  kfree(mem);
+  swap.nout++;
+  releasesleep(&swap.io);
+  return 0;
+}
+
+// Read the page at va of the current process back in.
+// Returns 0, or -1 if out of memory.
+int
+swapin(uint va)
+{
+  pte_t *pte;
+  char *mem;
+  uint e;
+
+  if((mem = kallocswap(0)) == 0)
+    return -1;
+  acquiresleep(&swap.io);
+  pte = walkpgdir(myproc()->pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & PTE_SWAP) == 0){
+    releasesleep(&swap.io);
+    kfree(mem);
+    return 0;
+  }
+  e = *pte;
+  swapio(mem, SLOT(e), 0);
+  *pte = V2P(mem) | PTE_P | (PTE_FLAGS(e) & ~PTE_SWAP);
+  swapfree(e);
+  swap.nin++;
+  releasesleep(&swap.io);
+  return 0;
+}
+
+// Allocate a page for user memory, zeroed if zeroed is set,
+// paging others out while memory is low. The caller must not
+// hold a spinlock. Returns 0 if memory is low and nothing can
+// be paged out.
+//
+// With a swap area, user pages leave the last SWAPRESERVE
+// free pages to the kernel's own allocations, which cannot
+// page anything out: page tables (walkpgdir called by
+// mappages), page directories and kernel stacks of fork, pipes
+// and slabs. Those still fail once the reserve is used up too,
+// e.g. when many processes fault across 4 MB boundaries while
+// memory is exhausted.
+char*
+kallocswap(int zeroed)
+{
+  char *mem;
+
+  for(;;){
+    if(swap.nslot == 0 || kfreepages() > SWAPRESERVE)
+      if((mem = zeroed ? kalloc_zeroed() : kalloc()) != 0)
+        return mem;
+    if(swapout() < 0)
+      return 0;
+  }
+}
+
+void
+print_swap_stats(void)
+{
+  cprintf("swap: %d of %d pages in use, %d paged out, %d paged in\n",
+          swap.nused, swap.nslot, swap.nout, swap.nin);
+}
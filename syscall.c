@@ -16,9 +16,9 @@
 // Fetch the int at addr from the current process.
 int fetchint(uint addr, int *ip)
 {
-  struct proc *curproc = myproc();
+  uint end = uvmlimit(myproc(), addr);
 
-  if (addr >= curproc->sz || addr + 4 > curproc->sz)
+  if (addr >= end || addr + 4 > end)
     return -1;
   *ip = *(int *)(addr);
   return 0;
@@ -30,12 +30,12 @@ int fetchint(uint addr, int *ip)
 int fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
-  struct proc *curproc = myproc();
+  uint end = uvmlimit(myproc(), addr);
 
-  if (addr >= curproc->sz)
+  if (addr >= end)
     return -1;
   *pp = (char *)addr;
-  ep = (char *)curproc->sz;
+  ep = (char *)end;
   for (s = *pp; s < ep; s++)
   {
     if (*s == 0)
@@ -52,15 +52,16 @@ int argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the heap or a single mapped region.
 int argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
+  uint end;
 
   if (argint(n, &i) < 0)
     return -1;
-  if (size < 0 || (uint)i >= curproc->sz || (uint)i + size > curproc->sz)
+  end = uvmlimit(myproc(), i);
+  if (size < 0 || (uint)i >= end || (uint)i + size > end)
     return -1;
   *pp = (char *)i;
   return 0;
@@ -113,6 +114,24 @@ extern int sys_print_processes_info(void);
 extern int sys_barrier_init(void);
 extern int sys_barrier_wait(void);
 extern int sys_reentrant_spinlock_test(void);
+extern int sys_print_lock_stats(void);
+extern int sys_set_process_gang(void);
+extern int sys_set_gang_scheduling(void);
+extern int sys_sem_create(void);
+extern int sys_event_create(void);
+extern int sys_sync_post(void);
+extern int sys_sync_wait(void);
+extern int sys_sync_close(void);
+extern int sys_event_reset(void);
+extern int sys_print_vm_stats(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_shmrm(void);
+extern int sys_spawn(void);
+extern int sys_memstat(void);
 
 static int (*syscalls[])(void) = {
     [SYS_fork] sys_fork,
@@ -148,7 +167,25 @@ static int (*syscalls[])(void) = {
     [SYS_print_processes_info] sys_print_processes_info,
     [SYS_barrier_init] sys_barrier_init,
     [SYS_barrier_wait] sys_barrier_wait,
-    [SYS_reentrant_spinlock_test] sys_reentrant_spinlock_test
+    [SYS_reentrant_spinlock_test] sys_reentrant_spinlock_test,
+    [SYS_print_lock_stats] sys_print_lock_stats,
+    [SYS_set_process_gang] sys_set_process_gang,
+    [SYS_set_gang_scheduling] sys_set_gang_scheduling,
+    [SYS_sem_create] sys_sem_create,
+    [SYS_event_create] sys_event_create,
+    [SYS_sync_post] sys_sync_post,
+    [SYS_sync_wait] sys_sync_wait,
+    [SYS_sync_close] sys_sync_close,
+    [SYS_event_reset] sys_event_reset,
+    [SYS_print_vm_stats] sys_print_vm_stats,
+    [SYS_mmap] sys_mmap,
+    [SYS_munmap] sys_munmap,
+    [SYS_shmget] sys_shmget,
+    [SYS_shmat] sys_shmat,
+    [SYS_shmdt] sys_shmdt,
+    [SYS_shmrm] sys_shmrm,
+    [SYS_spawn] sys_spawn,
+    [SYS_memstat] sys_memstat,
     };
 
 void syscall(void)
@@ -160,6 +197,7 @@ void syscall(void)
   if (num > 0 && num < NELEM(syscalls) && syscalls[num])
   {
     curproc->tf->eax = syscalls[num]();
+    curproc->prefaulted = 0;
   }
   else
   {
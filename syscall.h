@@ -33,4 +33,22 @@
 // Lab 04
 #define SYS_barrier_init 32
 #define SYS_barrier_wait 33
-#define SYS_reentrant_spinlock_test 34
\ No newline at end of file
+#define SYS_reentrant_spinlock_test 34
+#define SYS_print_lock_stats 35
+#define SYS_set_process_gang 36
+#define SYS_set_gang_scheduling 37
+#define SYS_sem_create 38
+#define SYS_event_create 39
+#define SYS_sync_post 40
+#define SYS_sync_wait 41
+#define SYS_sync_close 42
+#define SYS_event_reset 43
+#define SYS_print_vm_stats 44
+#define SYS_mmap 45
+#define SYS_munmap 46
+#define SYS_shmget 47
+#define SYS_shmat 48
+#define SYS_shmdt 49
+#define SYS_shmrm 50
+#define SYS_spawn 51
+#define SYS_memstat 52
@@ -14,6 +14,8 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "mman.h"
+#include "spawn.h"
 #include "fcntl.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
@@ -76,6 +78,9 @@ int sys_read(void)
 
   if (argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
+  // fileread may hold locks that a page fault would need.
+  if (uvmprefault(p, n, 1) < 0)
+    return -1;
   return fileread(f, p, n);
 }
 
@@ -87,6 +92,8 @@ int sys_write(void)
 
   if (argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
+  if (uvmprefault(p, n, 0) < 0)
+    return -1;
   return filewrite(f, p, n);
 }
 
@@ -109,6 +116,8 @@ int sys_fstat(void)
 
   if (argfd(0, 0, &f) < 0 || argptr(1, (void *)&st, sizeof(*st)) < 0)
     return -1;
+  if (uvmprefault((char *)st, sizeof(*st), 1) < 0)
+    return -1;
   return filestat(f, st);
 }
 
@@ -220,6 +229,7 @@ int sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if (writei(dp, (char *)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  cmdinval();
   if (ip->type == T_DIR)
   {
     dp->nlink--;
@@ -287,16 +297,13 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int sys_open(void)
+// Open path with omode as open() does, but without
+// giving it a file descriptor. Returns the file, or 0.
+struct file *fileopen(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
   struct file *f;
   struct inode *ip;
 
-  if (argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
-
   begin_op();
 
   if (omode & O_CREATE)
@@ -305,7 +312,7 @@ int sys_open(void)
     if (ip == 0)
     {
       end_op();
-      return -1;
+      return 0;
     }
   }
   else
@@ -313,24 +320,22 @@ int sys_open(void)
     if ((ip = namei(path)) == 0)
     {
       end_op();
-      return -1;
+      return 0;
     }
     ilock(ip);
     if (ip->type == T_DIR && omode != O_RDONLY)
     {
       iunlockput(ip);
       end_op();
-      return -1;
+      return 0;
     }
   }
 
-  if ((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0)
+  if ((f = filealloc()) == 0)
   {
-    if (f)
-      fileclose(f);
     iunlockput(ip);
     end_op();
-    return -1;
+    return 0;
   }
   iunlock(ip);
   end_op();
@@ -340,6 +345,24 @@ int sys_open(void)
   f->off = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  return f;
+}
+
+int sys_open(void)
+{
+  char *path;
+  int fd, omode;
+  struct file *f;
+
+  if (argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  if ((f = fileopen(path, omode)) == 0)
+    return -1;
+  if ((fd = fdalloc(f)) < 0)
+  {
+    fileclose(f);
+    return -1;
+  }
   return fd;
 }
 
@@ -405,20 +428,18 @@ int sys_chdir(void)
   return 0;
 }
 
-int sys_exec(void)
+// Fetch the null-terminated array of string pointers at
+// uargv, as exec's argv, into argv[MAXARG].
+static int
+fetchargv(uint uargv, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
-  uint uargv, uarg;
+  uint uarg;
 
-  if (argstr(0, &path) < 0 || argint(1, (int *)&uargv) < 0)
-  {
-    return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG * sizeof(argv[0]));
   for (i = 0;; i++)
   {
-    if (i >= NELEM(argv))
+    if (i >= MAXARG)
       return -1;
     if (fetchint(uargv + 4 * i, (int *)&uarg) < 0)
       return -1;
@@ -430,9 +451,54 @@ int sys_exec(void)
     if (fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if (argstr(0, &path) < 0 || argint(1, (int *)&uargv) < 0)
+  {
+    return -1;
+  }
+  if (fetchargv(uargv, argv) < 0)
+    return -1;
   return exec(path, argv);
 }
 
+// Start path in a new child with argv and the file actions
+// at uact (a list ending with SPAWN_END, or 0 for none).
+int sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  uint uargv, uact;
+  struct spawn_action act[SPAWN_MAXACT];
+  int i, n;
+
+  if (argstr(0, &path) < 0 || argint(1, (int *)&uargv) < 0 ||
+      argint(2, (int *)&uact) < 0)
+    return -1;
+  if (fetchargv(uargv, argv) < 0)
+    return -1;
+  for (n = 0; uact; n++, uact += sizeof(act[0]))
+  {
+    if (n >= SPAWN_MAXACT)
+      return -1;
+    // The whole action, a word at a time.
+    for (i = 0; i < sizeof(act[0]) / 4; i++)
+      if (fetchint(uact + 4 * i, (int *)&act[n] + i) < 0)
+        return -1;
+    if (act[n].op == SPAWN_END)
+      break;
+    if (act[n].op == SPAWN_OPEN &&
+        fetchstr((uint)act[n].path, &act[n].path) < 0)
+      return -1;
+  }
+  return spawn(path, argv, act, n);
+}
+
 int sys_pipe(void)
 {
   int *fd;
@@ -456,3 +522,27 @@ int sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Map a file, or zeros with MAP_ANONYMOUS (fd is then ignored).
+int sys_mmap(void)
+{
+  int addr, len, prot, flags, fd, off;
+  struct file *f;
+
+  if (argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+      argint(3, &flags) < 0 || argint(4, &fd) < 0 || argint(5, &off) < 0)
+    return -1;
+  f = 0;
+  if (!(flags & MAP_ANONYMOUS) && argfd(4, 0, &f) < 0)
+    return -1;
+  return vmamap(myproc(), addr, len, prot, flags, f, off);
+}
+
+int sys_munmap(void)
+{
+  int addr, len;
+
+  if (argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  return vmaunmap(myproc(), addr, len);
+}
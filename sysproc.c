@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "memstat.h"
 
 int sys_fork(void)
 {
@@ -163,9 +164,7 @@ int sys_set_path(void)
   char *arg;
   if (argstr(0, &arg) < 0)
     return -1;
-  // cprintf(arg);
-  add_path(arg);
-  return 0;
+  return setpath(arg);
 }
 
 int sys_set_sleep(void)
@@ -256,4 +255,163 @@ int sys_barrier_wait(void){
 int sys_reentrant_spinlock_test(void){
   reentrant_spinlock_test();
   return 0;
-}
\ No newline at end of file
+}
+
+int sys_print_lock_stats(void){
+  print_lock_stats();
+  return 0;
+}
+
+int sys_print_vm_stats(void){
+  print_vm_stats();
+  return 0;
+}
+
+int sys_set_process_gang(void)
+{
+  int pid, gang;
+  if (argint(0, &pid) < 0)
+    return -1;
+  if (argint(1, &gang) < 0)
+    return -1;
+  set_process_gang(pid, gang);
+  return 0;
+}
+
+int sys_set_gang_scheduling(void)
+{
+  int enabled;
+  if (argint(0, &enabled) < 0)
+    return -1;
+  set_gang_scheduling(enabled);
+  return 0;
+}
+
+// Fetch the nth system call argument as a semaphore or event
+// handle and return both the handle and the object.
+static int argksync(int n, int *ph, struct ksync **pk)
+{
+  int h;
+  struct ksync *k;
+
+  if (argint(n, &h) < 0)
+    return -1;
+  if (h < 0 || h >= NOKSYNC || (k = myproc()->oksync[h]) == 0)
+    return -1;
+  if (ph)
+    *ph = h;
+  if (pk)
+    *pk = k;
+  return 0;
+}
+
+// Give k a handle in the current process; on failure, drop it.
+static int ksyncalloc(struct ksync *k)
+{
+  int h;
+  struct proc *curproc = myproc();
+
+  if (k == 0)
+    return -1;
+  for (h = 0; h < NOKSYNC; h++)
+  {
+    if (curproc->oksync[h] == 0)
+    {
+      curproc->oksync[h] = k;
+      return h;
+    }
+  }
+  ksyncclose(k);
+  return -1;
+}
+
+int sys_sem_create(void)
+{
+  int value;
+  if (argint(0, &value) < 0)
+    return -1;
+  return ksyncalloc(semalloc(value));
+}
+
+int sys_event_create(void)
+{
+  return ksyncalloc(eventalloc());
+}
+
+int sys_sync_post(void)
+{
+  struct ksync *k;
+  if (argksync(0, 0, &k) < 0)
+    return -1;
+  ksyncpost(k);
+  return 0;
+}
+
+int sys_sync_wait(void)
+{
+  struct ksync *k;
+  if (argksync(0, 0, &k) < 0)
+    return -1;
+  return ksyncwait(k);
+}
+
+int sys_sync_close(void)
+{
+  int h;
+  struct ksync *k;
+  if (argksync(0, &h, &k) < 0)
+    return -1;
+  myproc()->oksync[h] = 0;
+  ksyncclose(k);
+  return 0;
+}
+
+int sys_event_reset(void)
+{
+  struct ksync *k;
+  if (argksync(0, 0, &k) < 0)
+    return -1;
+  return ksyncreset(k);
+}
+
+int sys_shmget(void)
+{
+  int key, size;
+  if (argint(0, &key) < 0 || argint(1, &size) < 0)
+    return -1;
+  return shmget(key, size);
+}
+
+int sys_shmat(void)
+{
+  int id;
+  if (argint(0, &id) < 0)
+    return -1;
+  return shmat(myproc(), id);
+}
+
+int sys_shmdt(void)
+{
+  int addr;
+  if (argint(0, &addr) < 0)
+    return -1;
+  return shmdt(myproc(), addr);
+}
+
+int sys_shmrm(void)
+{
+  int id;
+  if (argint(0, &id) < 0)
+    return -1;
+  return shmrm(id);
+}
+
+int sys_memstat(void)
+{
+  int pid;
+  struct memstat *ms;
+
+  if (argint(0, &pid) < 0 || argptr(1, (void *)&ms, sizeof(*ms)) < 0)
+    return -1;
+  return memstat(pid, ms);
+}
@@ -0,0 +1,2321 @@
+
+_tlbbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  sink = sum;
+  return uptime() - t0;
+}
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+  int passes = argc > 2 ? atoi(argv[2]) : 200;
+       f:	be c8 00 00 00       	mov    $0xc8,%esi
+{
+      14:	53                   	push   %ebx
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+      15:	bb 40 00 00 00       	mov    $0x40,%ebx
+{
+      1a:	51                   	push   %ecx
+      1b:	83 ec 18             	sub    $0x18,%esp
+      1e:	8b 11                	mov    (%ecx),%edx
+      20:	8b 79 04             	mov    0x4(%ecx),%edi
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+      23:	83 fa 01             	cmp    $0x1,%edx
+      26:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      29:	7f 7e                	jg     a9 <main+0xa9>
+  char *brk, *heap;
+  int t;
+
+  // Start the heap on a 4 MB boundary.
+  brk = sbrk(0);
+      2b:	83 ec 0c             	sub    $0xc,%esp
+      2e:	6a 00                	push   $0x0
+      30:	e8 96 05 00 00       	call   5cb <sbrk>
+  if (sbrk((4 * MB - (uint)brk % (4 * MB)) % (4 * MB)) == (char *)-1 ||
+      35:	f7 d8                	neg    %eax
+      37:	25 ff ff 3f 00       	and    $0x3fffff,%eax
+      3c:	89 04 24             	mov    %eax,(%esp)
+      3f:	e8 87 05 00 00       	call   5cb <sbrk>
+      44:	83 c4 10             	add    $0x10,%esp
+      47:	83 f8 ff             	cmp    $0xffffffff,%eax
+      4a:	74 4a                	je     96 <main+0x96>
+      (heap = sbrk(mb * MB)) == (char *)-1)
+      4c:	89 df                	mov    %ebx,%edi
+      4e:	83 ec 0c             	sub    $0xc,%esp
+      51:	c1 e7 14             	shl    $0x14,%edi
+      54:	57                   	push   %edi
+      55:	e8 71 05 00 00       	call   5cb <sbrk>
+  if (sbrk((4 * MB - (uint)brk % (4 * MB)) % (4 * MB)) == (char *)-1 ||
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+      60:	74 34                	je     96 <main+0x96>
+  {
+    printf(1, "tlbbench: cannot grow heap to %d MB\n", mb);
+    exit();
+  }
+  heap[0] = 1;
+      62:	c6 00 01             	movb   $0x1,(%eax)
+
+  t = scan(heap, mb * MB, passes);
+      65:	51                   	push   %ecx
+      66:	56                   	push   %esi
+      67:	57                   	push   %edi
+      68:	50                   	push   %eax
+      69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      6c:	e8 9f 00 00 00       	call   110 <scan>
+  printf(1, "tlbbench: %d scans of %d MB, 4 MB pages: %d ticks\n", passes, mb, t);
+      71:	89 04 24             	mov    %eax,(%esp)
+      74:	53                   	push   %ebx
+      75:	56                   	push   %esi
+      76:	68 8c 10 00 00       	push   $0x108c
+      7b:	6a 01                	push   $0x1
+      7d:	e8 3e 08 00 00       	call   8c0 <printf>
+  if (fork() == 0)
+      82:	83 c4 20             	add    $0x20,%esp
+      85:	e8 16 01 00 00       	call   1a0 <fork>
+      8a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      8d:	85 c0                	test   %eax,%eax
+      8f:	75 49                	jne    da <main+0xda>
+    exit();
+  wait();
+  t = scan(heap, mb * MB, passes);
+  printf(1, "tlbbench: %d scans of %d MB, 4 KB pages: %d ticks\n", passes, mb, t);
+  print_vm_stats();
+  exit();
+      91:	e8 3a 01 00 00       	call   1d0 <exit>
+    printf(1, "tlbbench: cannot grow heap to %d MB\n", mb);
+      96:	56                   	push   %esi
+      97:	53                   	push   %ebx
+      98:	68 64 10 00 00       	push   $0x1064
+      9d:	6a 01                	push   $0x1
+      9f:	e8 1c 08 00 00       	call   8c0 <printf>
+    exit();
+      a4:	e8 27 01 00 00       	call   1d0 <exit>
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	ff 77 04             	push   0x4(%edi)
+      af:	e8 1c 04 00 00       	call   4d0 <atoi>
+  int passes = argc > 2 ? atoi(argv[2]) : 200;
+      b4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      b7:	83 c4 10             	add    $0x10,%esp
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+      ba:	89 c3                	mov    %eax,%ebx
+  int passes = argc > 2 ? atoi(argv[2]) : 200;
+      bc:	83 fa 02             	cmp    $0x2,%edx
+      bf:	0f 84 66 ff ff ff    	je     2b <main+0x2b>
+      c5:	83 ec 0c             	sub    $0xc,%esp
+      c8:	ff 77 08             	push   0x8(%edi)
+      cb:	e8 00 04 00 00       	call   4d0 <atoi>
+      d0:	83 c4 10             	add    $0x10,%esp
+      d3:	89 c6                	mov    %eax,%esi
+      d5:	e9 51 ff ff ff       	jmp    2b <main+0x2b>
+      da:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  wait();
+      dd:	e8 69 04 00 00       	call   54b <wait>
+  t = scan(heap, mb * MB, passes);
+      e2:	50                   	push   %eax
+      e3:	56                   	push   %esi
+      e4:	57                   	push   %edi
+      e5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      e8:	52                   	push   %edx
+      e9:	e8 22 00 00 00       	call   110 <scan>
+  printf(1, "tlbbench: %d scans of %d MB, 4 KB pages: %d ticks\n", passes, mb, t);
+      ee:	89 04 24             	mov    %eax,(%esp)
+      f1:	53                   	push   %ebx
+      f2:	56                   	push   %esi
+      f3:	68 c0 10 00 00       	push   $0x10c0
+      f8:	6a 01                	push   $0x1
+      fa:	e8 c1 07 00 00       	call   8c0 <printf>
+  print_vm_stats();
+      ff:	83 c4 20             	add    $0x20,%esp
+     102:	e8 8c 05 00 00       	call   693 <print_vm_stats>
+     107:	eb 88                	jmp    91 <main+0x91>
+     109:	66 90                	xchg   %ax,%ax
+     10b:	66 90                	xchg   %ax,%ax
+     10d:	66 90                	xchg   %ax,%ax
+     10f:	90                   	nop
+
+00000110 <scan>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	57                   	push   %edi
+     114:	31 ff                	xor    %edi,%edi
+     116:	56                   	push   %esi
+     117:	53                   	push   %ebx
+     118:	83 ec 1c             	sub    $0x1c,%esp
+     11b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     11e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  t0 = uptime();
+     121:	e8 b5 04 00 00       	call   5db <uptime>
+     126:	89 c1                	mov    %eax,%ecx
+  for (p = 0; p < passes; p++)
+     128:	85 db                	test   %ebx,%ebx
+     12a:	7e 66                	jle    192 <scan+0x82>
+    for (i = 0; i < size; i += 4096)
+     12c:	85 f6                	test   %esi,%esi
+     12e:	7e 5b                	jle    18b <scan+0x7b>
+     130:	8d 46 ff             	lea    -0x1(%esi),%eax
+     133:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     136:	8b 75 08             	mov    0x8(%ebp),%esi
+     139:	31 d2                	xor    %edx,%edx
+     13b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+     140:	8d b4 06 00 10 00 00 	lea    0x1000(%esi,%eax,1),%esi
+     147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14e:	66 90                	xchg   %ax,%ax
+     150:	8b 45 08             	mov    0x8(%ebp),%eax
+     153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     157:	90                   	nop
+      sum += heap[i];
+     158:	0f be 08             	movsbl (%eax),%ecx
+    for (i = 0; i < size; i += 4096)
+     15b:	05 00 10 00 00       	add    $0x1000,%eax
+      sum += heap[i];
+     160:	01 ca                	add    %ecx,%edx
+    for (i = 0; i < size; i += 4096)
+     162:	39 f0                	cmp    %esi,%eax
+     164:	75 f2                	jne    158 <scan+0x48>
+  for (p = 0; p < passes; p++)
+     166:	83 c7 01             	add    $0x1,%edi
+     169:	39 fb                	cmp    %edi,%ebx
+     16b:	75 e3                	jne    150 <scan+0x40>
+     16d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     170:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  sink = sum;
+     173:	89 15 c0 15 00 00    	mov    %edx,0x15c0
+  return uptime() - t0;
+     179:	e8 5d 04 00 00       	call   5db <uptime>
+     17e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+}
+     181:	83 c4 1c             	add    $0x1c,%esp
+     184:	5b                   	pop    %ebx
+     185:	5e                   	pop    %esi
+  return uptime() - t0;
+     186:	29 c8                	sub    %ecx,%eax
+}
+     188:	5f                   	pop    %edi
+     189:	5d                   	pop    %ebp
+     18a:	c3                   	ret
+  for (p = 0; p < passes; p++)
+     18b:	83 c7 01             	add    $0x1,%edi
+     18e:	39 fb                	cmp    %edi,%ebx
+     190:	75 9a                	jne    12c <scan+0x1c>
+     192:	31 d2                	xor    %edx,%edx
+     194:	eb da                	jmp    170 <scan+0x60>
+     196:	66 90                	xchg   %ax,%ax
+     198:	66 90                	xchg   %ax,%ax
+     19a:	66 90                	xchg   %ax,%ax
+     19c:	66 90                	xchg   %ax,%ax
+     19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     1a0:	a1 e0 15 00 00       	mov    0x15e0,%eax
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	74 17                	je     1c0 <fork+0x20>
+{
+     1a9:	55                   	push   %ebp
+     1aa:	89 e5                	mov    %esp,%ebp
+     1ac:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     1af:	ff d0                	call   *%eax
+  return _fork();
+}
+     1b1:	c9                   	leave
+  return _fork();
+     1b2:	e9 84 03 00 00       	jmp    53b <_fork>
+     1b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1be:	66 90                	xchg   %ax,%ax
+     1c0:	e9 76 03 00 00       	jmp    53b <_fork>
+     1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <exit>:
+
+int
+exit(void)
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     1d6:	a1 e0 15 00 00       	mov    0x15e0,%eax
+     1db:	85 c0                	test   %eax,%eax
+     1dd:	74 02                	je     1e1 <exit+0x11>
+    stdioflush();
+     1df:	ff d0                	call   *%eax
+  _exit();
+     1e1:	e8 5d 03 00 00       	call   543 <_exit>
+     1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     1f0:	55                   	push   %ebp
+  if(stdioflush)
+     1f1:	a1 e0 15 00 00       	mov    0x15e0,%eax
+{
+     1f6:	89 e5                	mov    %esp,%ebp
+     1f8:	56                   	push   %esi
+     1f9:	53                   	push   %ebx
+     1fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     200:	85 c0                	test   %eax,%eax
+     202:	74 02                	je     206 <exec+0x16>
+    stdioflush();
+     204:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     206:	89 75 0c             	mov    %esi,0xc(%ebp)
+     209:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     20c:	5b                   	pop    %ebx
+     20d:	5e                   	pop    %esi
+     20e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     20f:	e9 67 03 00 00       	jmp    57b <_exec>
+     214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     21f:	90                   	nop
+
+00000220 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	57                   	push   %edi
+     224:	56                   	push   %esi
+     225:	53                   	push   %ebx
+     226:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     229:	a1 e0 15 00 00       	mov    0x15e0,%eax
+{
+     22e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     231:	8b 75 0c             	mov    0xc(%ebp),%esi
+     234:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     237:	85 c0                	test   %eax,%eax
+     239:	74 02                	je     23d <spawn+0x1d>
+    stdioflush();
+     23b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     23d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     240:	89 75 0c             	mov    %esi,0xc(%ebp)
+     243:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     246:	83 c4 0c             	add    $0xc,%esp
+     249:	5b                   	pop    %ebx
+     24a:	5e                   	pop    %esi
+     24b:	5f                   	pop    %edi
+     24c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     24d:	e9 79 04 00 00       	jmp    6cb <_spawn>
+     252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     260:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     261:	31 c0                	xor    %eax,%eax
+{
+     263:	89 e5                	mov    %esp,%ebp
+     265:	53                   	push   %ebx
+     266:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     269:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     270:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     274:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     277:	83 c0 01             	add    $0x1,%eax
+     27a:	84 d2                	test   %dl,%dl
+     27c:	75 f2                	jne    270 <strcpy+0x10>
+    ;
+  return os;
+}
+     27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     281:	89 c8                	mov    %ecx,%eax
+     283:	c9                   	leave
+     284:	c3                   	ret
+     285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	53                   	push   %ebx
+     294:	8b 55 08             	mov    0x8(%ebp),%edx
+     297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     29a:	0f b6 02             	movzbl (%edx),%eax
+     29d:	84 c0                	test   %al,%al
+     29f:	75 17                	jne    2b8 <strcmp+0x28>
+     2a1:	eb 3a                	jmp    2dd <strcmp+0x4d>
+     2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2a7:	90                   	nop
+     2a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2ac:	83 c2 01             	add    $0x1,%edx
+     2af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     2b2:	84 c0                	test   %al,%al
+     2b4:	74 1a                	je     2d0 <strcmp+0x40>
+    p++, q++;
+     2b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     2b8:	0f b6 19             	movzbl (%ecx),%ebx
+     2bb:	38 c3                	cmp    %al,%bl
+     2bd:	74 e9                	je     2a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     2bf:	29 d8                	sub    %ebx,%eax
+}
+     2c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2c4:	c9                   	leave
+     2c5:	c3                   	ret
+     2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2d4:	31 c0                	xor    %eax,%eax
+     2d6:	29 d8                	sub    %ebx,%eax
+}
+     2d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2db:	c9                   	leave
+     2dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2dd:	0f b6 19             	movzbl (%ecx),%ebx
+     2e0:	31 c0                	xor    %eax,%eax
+     2e2:	eb db                	jmp    2bf <strcmp+0x2f>
+     2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+
+000002f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2f6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2f9:	74 15                	je     310 <strlen+0x20>
+     2fb:	31 c0                	xor    %eax,%eax
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+     300:	83 c0 01             	add    $0x1,%eax
+     303:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     307:	89 c1                	mov    %eax,%ecx
+     309:	75 f5                	jne    300 <strlen+0x10>
+    ;
+  return n;
+}
+     30b:	89 c8                	mov    %ecx,%eax
+     30d:	5d                   	pop    %ebp
+     30e:	c3                   	ret
+     30f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     310:	31 c9                	xor    %ecx,%ecx
+}
+     312:	5d                   	pop    %ebp
+     313:	89 c8                	mov    %ecx,%eax
+     315:	c3                   	ret
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	57                   	push   %edi
+     324:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     327:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     32d:	89 d7                	mov    %edx,%edi
+     32f:	fc                   	cld
+     330:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     332:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     335:	89 d0                	mov    %edx,%eax
+     337:	c9                   	leave
+     338:	c3                   	ret
+     339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	8b 45 08             	mov    0x8(%ebp),%eax
+     346:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     34a:	0f b6 10             	movzbl (%eax),%edx
+     34d:	84 d2                	test   %dl,%dl
+     34f:	75 12                	jne    363 <strchr+0x23>
+     351:	eb 1d                	jmp    370 <strchr+0x30>
+     353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     357:	90                   	nop
+     358:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     35c:	83 c0 01             	add    $0x1,%eax
+     35f:	84 d2                	test   %dl,%dl
+     361:	74 0d                	je     370 <strchr+0x30>
+    if(*s == c)
+     363:	38 d1                	cmp    %dl,%cl
+     365:	75 f1                	jne    358 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     367:	5d                   	pop    %ebp
+     368:	c3                   	ret
+     369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     370:	31 c0                	xor    %eax,%eax
+}
+     372:	5d                   	pop    %ebp
+     373:	c3                   	ret
+     374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+
+00000380 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	57                   	push   %edi
+     384:	56                   	push   %esi
+     385:	53                   	push   %ebx
+     386:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     389:	a1 e0 15 00 00       	mov    0x15e0,%eax
+{
+     38e:	8b 75 08             	mov    0x8(%ebp),%esi
+     391:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     394:	85 c0                	test   %eax,%eax
+     396:	74 02                	je     39a <gets+0x1a>
+    stdioflush();
+     398:	ff d0                	call   *%eax
+  if(in.size == 0)
+     39a:	a1 08 18 00 00       	mov    0x1808,%eax
+     39f:	85 c0                	test   %eax,%eax
+     3a1:	0f 84 99 00 00 00    	je     440 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     3a7:	31 db                	xor    %ebx,%ebx
+     3a9:	eb 21                	jmp    3cc <gets+0x4c>
+     3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3af:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     3b0:	8d 50 01             	lea    0x1(%eax),%edx
+     3b3:	0f b6 80 00 16 00 00 	movzbl 0x1600(%eax),%eax
+     3ba:	89 15 00 18 00 00    	mov    %edx,0x1800
+    buf[i++] = c;
+     3c0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3c4:	3c 0a                	cmp    $0xa,%al
+     3c6:	74 60                	je     428 <gets+0xa8>
+     3c8:	3c 0d                	cmp    $0xd,%al
+     3ca:	74 5c                	je     428 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     3cc:	89 da                	mov    %ebx,%edx
+     3ce:	83 c3 01             	add    $0x1,%ebx
+     3d1:	39 fb                	cmp    %edi,%ebx
+     3d3:	7d 55                	jge    42a <gets+0xaa>
+    if(in.r == in.n){
+     3d5:	a1 00 18 00 00       	mov    0x1800,%eax
+     3da:	3b 05 04 18 00 00    	cmp    0x1804,%eax
+     3e0:	75 ce                	jne    3b0 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3e2:	83 ec 04             	sub    $0x4,%esp
+     3e5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     3e8:	c7 05 04 18 00 00 00 	movl   $0x0,0x1804
+     3ef:	00 00 00 
+     3f2:	c7 05 00 18 00 00 00 	movl   $0x0,0x1800
+     3f9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3fc:	ff 35 08 18 00 00    	push   0x1808
+     402:	68 00 16 00 00       	push   $0x1600
+     407:	6a 00                	push   $0x0
+     409:	e8 4d 01 00 00       	call   55b <read>
+     40e:	83 c4 10             	add    $0x10,%esp
+     411:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     414:	85 c0                	test   %eax,%eax
+     416:	a3 04 18 00 00       	mov    %eax,0x1804
+     41b:	7e 56                	jle    473 <gets+0xf3>
+    c = in.buf[in.r++];
+     41d:	a1 00 18 00 00       	mov    0x1800,%eax
+     422:	eb 8c                	jmp    3b0 <gets+0x30>
+     424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     428:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     42a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     42e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     431:	89 f0                	mov    %esi,%eax
+     433:	5b                   	pop    %ebx
+     434:	5e                   	pop    %esi
+     435:	5f                   	pop    %edi
+     436:	5d                   	pop    %ebp
+     437:	c3                   	ret
+     438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     440:	83 ec 08             	sub    $0x8,%esp
+     443:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     446:	50                   	push   %eax
+     447:	6a 00                	push   $0x0
+     449:	e8 4d 01 00 00       	call   59b <fstat>
+     44e:	83 c4 10             	add    $0x10,%esp
+     451:	89 c2                	mov    %eax,%edx
+     453:	b8 01 00 00 00       	mov    $0x1,%eax
+     458:	85 d2                	test   %edx,%edx
+     45a:	75 0d                	jne    469 <gets+0xe9>
+     45c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     461:	ba 00 02 00 00       	mov    $0x200,%edx
+     466:	0f 44 c2             	cmove  %edx,%eax
+     469:	a3 08 18 00 00       	mov    %eax,0x1808
+     46e:	e9 34 ff ff ff       	jmp    3a7 <gets+0x27>
+        in.n = 0;
+     473:	c7 05 04 18 00 00 00 	movl   $0x0,0x1804
+     47a:	00 00 00 
+        break;
+     47d:	eb ab                	jmp    42a <gets+0xaa>
+     47f:	90                   	nop
+
+00000480 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	56                   	push   %esi
+     484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     485:	83 ec 08             	sub    $0x8,%esp
+     488:	6a 00                	push   $0x0
+     48a:	ff 75 08             	push   0x8(%ebp)
+     48d:	e8 f1 00 00 00       	call   583 <open>
+  if(fd < 0)
+     492:	83 c4 10             	add    $0x10,%esp
+     495:	85 c0                	test   %eax,%eax
+     497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     499:	83 ec 08             	sub    $0x8,%esp
+     49c:	ff 75 0c             	push   0xc(%ebp)
+     49f:	89 c3                	mov    %eax,%ebx
+     4a1:	50                   	push   %eax
+     4a2:	e8 f4 00 00 00       	call   59b <fstat>
+  close(fd);
+     4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     4ac:	e8 ba 00 00 00       	call   56b <close>
+  return r;
+     4b1:	83 c4 10             	add    $0x10,%esp
+}
+     4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4b7:	89 f0                	mov    %esi,%eax
+     4b9:	5b                   	pop    %ebx
+     4ba:	5e                   	pop    %esi
+     4bb:	5d                   	pop    %ebp
+     4bc:	c3                   	ret
+     4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4c5:	eb ed                	jmp    4b4 <stat+0x34>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	53                   	push   %ebx
+     4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     4d7:	0f be 02             	movsbl (%edx),%eax
+     4da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4e5:	77 1e                	ja     505 <atoi+0x35>
+     4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4f0:	83 c2 01             	add    $0x1,%edx
+     4f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4fa:	0f be 02             	movsbl (%edx),%eax
+     4fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     500:	80 fb 09             	cmp    $0x9,%bl
+     503:	76 eb                	jbe    4f0 <atoi+0x20>
+  return n;
+}
+     505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     508:	89 c8                	mov    %ecx,%eax
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	57                   	push   %edi
+     514:	56                   	push   %esi
+     515:	8b 45 10             	mov    0x10(%ebp),%eax
+     518:	8b 55 08             	mov    0x8(%ebp),%edx
+     51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     51e:	85 c0                	test   %eax,%eax
+     520:	7e 13                	jle    535 <memmove+0x25>
+     522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     524:	89 d7                	mov    %edx,%edi
+     526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     531:	39 f8                	cmp    %edi,%eax
+     533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+     535:	5e                   	pop    %esi
+     536:	89 d0                	mov    %edx,%eax
+     538:	5f                   	pop    %edi
+     539:	5d                   	pop    %ebp
+     53a:	c3                   	ret
+
+0000053b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     53b:	b8 01 00 00 00       	mov    $0x1,%eax
+     540:	cd 40                	int    $0x40
+     542:	c3                   	ret
+
+00000543 <_exit>:
+RAWSYSCALL(exit)
+     543:	b8 02 00 00 00       	mov    $0x2,%eax
+     548:	cd 40                	int    $0x40
+     54a:	c3                   	ret
+
+0000054b <wait>:
+SYSCALL(wait)
+     54b:	b8 03 00 00 00       	mov    $0x3,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <pipe>:
+SYSCALL(pipe)
+     553:	b8 04 00 00 00       	mov    $0x4,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <read>:
+SYSCALL(read)
+     55b:	b8 05 00 00 00       	mov    $0x5,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <write>:
+SYSCALL(write)
+     563:	b8 10 00 00 00       	mov    $0x10,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <close>:
+SYSCALL(close)
+     56b:	b8 15 00 00 00       	mov    $0x15,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <kill>:
+SYSCALL(kill)
+     573:	b8 06 00 00 00       	mov    $0x6,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <_exec>:
+RAWSYSCALL(exec)
+     57b:	b8 07 00 00 00       	mov    $0x7,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <open>:
+SYSCALL(open)
+     583:	b8 0f 00 00 00       	mov    $0xf,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <mknod>:
+SYSCALL(mknod)
+     58b:	b8 11 00 00 00       	mov    $0x11,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <unlink>:
+SYSCALL(unlink)
+     593:	b8 12 00 00 00       	mov    $0x12,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <fstat>:
+SYSCALL(fstat)
+     59b:	b8 08 00 00 00       	mov    $0x8,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <link>:
+SYSCALL(link)
+     5a3:	b8 13 00 00 00       	mov    $0x13,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <mkdir>:
+SYSCALL(mkdir)
+     5ab:	b8 14 00 00 00       	mov    $0x14,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <chdir>:
+SYSCALL(chdir)
+     5b3:	b8 09 00 00 00       	mov    $0x9,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <dup>:
+SYSCALL(dup)
+     5bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <getpid>:
+SYSCALL(getpid)
+     5c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <sbrk>:
+SYSCALL(sbrk)
+     5cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <sleep>:
+SYSCALL(sleep)
+     5d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <uptime>:
+SYSCALL(uptime)
+     5db:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     5e3:	b8 16 00 00 00       	mov    $0x16,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <get_parent_id>:
+SYSCALL(get_parent_id)
+     5eb:	b8 17 00 00 00       	mov    $0x17,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <get_children>:
+SYSCALL(get_children)
+     5f3:	b8 18 00 00 00       	mov    $0x18,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <set_path>:
+SYSCALL(set_path)
+     5fb:	b8 19 00 00 00       	mov    $0x19,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <set_sleep>:
+SYSCALL(set_sleep)
+     603:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <get_time>:
+SYSCALL(get_time)
+     60b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <change_process_level>:
+SYSCALL(change_process_level)
+     613:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     61b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     623:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <print_processes_info>:
+SYSCALL(print_processes_info)
+     62b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <barrier_init>:
+
+SYSCALL(barrier_init)
+     633:	b8 20 00 00 00       	mov    $0x20,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <barrier_wait>:
+SYSCALL(barrier_wait)
+     63b:	b8 21 00 00 00       	mov    $0x21,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     643:	b8 22 00 00 00       	mov    $0x22,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     64b:	b8 23 00 00 00       	mov    $0x23,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <set_process_gang>:
+SYSCALL(set_process_gang)
+     653:	b8 24 00 00 00       	mov    $0x24,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     65b:	b8 25 00 00 00       	mov    $0x25,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <sem_create>:
+SYSCALL(sem_create)
+     663:	b8 26 00 00 00       	mov    $0x26,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <event_create>:
+SYSCALL(event_create)
+     66b:	b8 27 00 00 00       	mov    $0x27,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <sync_post>:
+SYSCALL(sync_post)
+     673:	b8 28 00 00 00       	mov    $0x28,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+
+0000067b <sync_wait>:
+SYSCALL(sync_wait)
+     67b:	b8 29 00 00 00       	mov    $0x29,%eax
+     680:	cd 40                	int    $0x40
+     682:	c3                   	ret
+
+00000683 <sync_close>:
+SYSCALL(sync_close)
+     683:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     688:	cd 40                	int    $0x40
+     68a:	c3                   	ret
+
+0000068b <event_reset>:
+SYSCALL(event_reset)
+     68b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     690:	cd 40                	int    $0x40
+     692:	c3                   	ret
+
+00000693 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     693:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     698:	cd 40                	int    $0x40
+     69a:	c3                   	ret
+
+0000069b <mmap>:
+SYSCALL(mmap)
+     69b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     6a0:	cd 40                	int    $0x40
+     6a2:	c3                   	ret
+
+000006a3 <munmap>:
+SYSCALL(munmap)
+     6a3:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     6a8:	cd 40                	int    $0x40
+     6aa:	c3                   	ret
+
+000006ab <shmget>:
+SYSCALL(shmget)
+     6ab:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     6b0:	cd 40                	int    $0x40
+     6b2:	c3                   	ret
+
+000006b3 <shmat>:
+SYSCALL(shmat)
+     6b3:	b8 30 00 00 00       	mov    $0x30,%eax
+     6b8:	cd 40                	int    $0x40
+     6ba:	c3                   	ret
+
+000006bb <shmdt>:
+SYSCALL(shmdt)
+     6bb:	b8 31 00 00 00       	mov    $0x31,%eax
+     6c0:	cd 40                	int    $0x40
+     6c2:	c3                   	ret
+
+000006c3 <shmrm>:
+SYSCALL(shmrm)
+     6c3:	b8 32 00 00 00       	mov    $0x32,%eax
+     6c8:	cd 40                	int    $0x40
+     6ca:	c3                   	ret
+
+000006cb <_spawn>:
+RAWSYSCALL(spawn)
+     6cb:	b8 33 00 00 00       	mov    $0x33,%eax
+     6d0:	cd 40                	int    $0x40
+     6d2:	c3                   	ret
+
+000006d3 <memstat>:
+SYSCALL(memstat)
+     6d3:	b8 34 00 00 00       	mov    $0x34,%eax
+     6d8:	cd 40                	int    $0x40
+     6da:	c3                   	ret
+     6db:	66 90                	xchg   %ax,%ax
+     6dd:	66 90                	xchg   %ax,%ax
+     6df:	90                   	nop
+
+000006e0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     6e6:	a1 48 1a 00 00       	mov    0x1a48,%eax
+     6eb:	85 c0                	test   %eax,%eax
+     6ed:	7e 17                	jle    706 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     6ef:	83 ec 04             	sub    $0x4,%esp
+     6f2:	50                   	push   %eax
+     6f3:	68 4c 1a 00 00       	push   $0x1a4c
+     6f8:	ff 35 40 1a 00 00    	push   0x1a40
+     6fe:	e8 60 fe ff ff       	call   563 <write>
+     703:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     706:	c7 05 48 1a 00 00 00 	movl   $0x0,0x1a48
+     70d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     710:	c7 05 44 1a 00 00 00 	movl   $0x0,0x1a44
+     717:	00 00 00 
+}
+     71a:	c9                   	leave
+     71b:	c3                   	ret
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     726:	89 d1                	mov    %edx,%ecx
+{
+     728:	56                   	push   %esi
+     729:	53                   	push   %ebx
+     72a:	89 c3                	mov    %eax,%ebx
+     72c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     72f:	85 d2                	test   %edx,%edx
+     731:	0f 89 b9 00 00 00    	jns    7f0 <printint+0xd0>
+     737:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     73b:	0f 84 af 00 00 00    	je     7f0 <printint+0xd0>
+    x = -xx;
+     741:	f7 d9                	neg    %ecx
+    neg = 1;
+     743:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     748:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     74b:	31 f6                	xor    %esi,%esi
+     74d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     750:	89 c8                	mov    %ecx,%eax
+     752:	31 d2                	xor    %edx,%edx
+     754:	89 f3                	mov    %esi,%ebx
+     756:	f7 f7                	div    %edi
+     758:	8d 76 01             	lea    0x1(%esi),%esi
+     75b:	0f b6 92 54 11 00 00 	movzbl 0x1154(%edx),%edx
+     762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     766:	89 ca                	mov    %ecx,%edx
+     768:	89 c1                	mov    %eax,%ecx
+     76a:	39 fa                	cmp    %edi,%edx
+     76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+     76e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     771:	89 d9                	mov    %ebx,%ecx
+     773:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     776:	85 c0                	test   %eax,%eax
+     778:	74 07                	je     781 <printint+0x61>
+    buf[i++] = '-';
+     77a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     77f:	89 f1                	mov    %esi,%ecx
+     781:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     784:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     786:	8d 43 0c             	lea    0xc(%ebx),%eax
+     789:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     78c:	01 f7                	add    %esi,%edi
+     78e:	eb 09                	jmp    799 <printint+0x79>
+
+  while(--i >= 0)
+     790:	8d 47 ff             	lea    -0x1(%edi),%eax
+     793:	39 f7                	cmp    %esi,%edi
+     795:	74 36                	je     7cd <printint+0xad>
+     797:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     799:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     79c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     79f:	8d 42 01             	lea    0x1(%edx),%eax
+     7a2:	89 43 08             	mov    %eax,0x8(%ebx)
+     7a5:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7a9:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7ae:	74 28                	je     7d8 <printint+0xb8>
+     7b0:	80 f9 0a             	cmp    $0xa,%cl
+     7b3:	75 db                	jne    790 <printint+0x70>
+     7b5:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     7b9:	75 d5                	jne    790 <printint+0x70>
+  if(b->n > 0)
+     7bb:	85 c0                	test   %eax,%eax
+     7bd:	7f 19                	jg     7d8 <printint+0xb8>
+  b->n = 0;
+     7bf:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     7c6:	8d 47 ff             	lea    -0x1(%edi),%eax
+     7c9:	39 f7                	cmp    %esi,%edi
+     7cb:	75 ca                	jne    797 <printint+0x77>
+}
+     7cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7d0:	5b                   	pop    %ebx
+     7d1:	5e                   	pop    %esi
+     7d2:	5f                   	pop    %edi
+     7d3:	5d                   	pop    %ebp
+     7d4:	c3                   	ret
+     7d5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     7d8:	83 ec 04             	sub    $0x4,%esp
+     7db:	50                   	push   %eax
+     7dc:	ff 75 d4             	push   -0x2c(%ebp)
+     7df:	ff 33                	push   (%ebx)
+     7e1:	e8 7d fd ff ff       	call   563 <write>
+     7e6:	83 c4 10             	add    $0x10,%esp
+     7e9:	eb d4                	jmp    7bf <printint+0x9f>
+     7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7ef:	90                   	nop
+  neg = 0;
+     7f0:	31 c0                	xor    %eax,%eax
+     7f2:	e9 51 ff ff ff       	jmp    748 <printint+0x28>
+     7f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <putc>:
+{
+     800:	55                   	push   %ebp
+     801:	89 e5                	mov    %esp,%ebp
+     803:	53                   	push   %ebx
+     804:	89 c3                	mov    %eax,%ebx
+     806:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     809:	8b 48 08             	mov    0x8(%eax),%ecx
+     80c:	8d 41 01             	lea    0x1(%ecx),%eax
+     80f:	89 43 08             	mov    %eax,0x8(%ebx)
+     812:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     816:	3d 00 02 00 00       	cmp    $0x200,%eax
+     81b:	74 33                	je     850 <putc+0x50>
+     81d:	80 fa 0a             	cmp    $0xa,%dl
+     820:	74 0e                	je     830 <putc+0x30>
+}
+     822:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     825:	c9                   	leave
+     826:	c3                   	ret
+     827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     830:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     834:	75 ec                	jne    822 <putc+0x22>
+  if(b->n > 0)
+     836:	85 c0                	test   %eax,%eax
+     838:	7f 16                	jg     850 <putc+0x50>
+  b->n = 0;
+     83a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     844:	c9                   	leave
+     845:	c3                   	ret
+     846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     850:	83 ec 04             	sub    $0x4,%esp
+     853:	50                   	push   %eax
+     854:	8d 43 0c             	lea    0xc(%ebx),%eax
+     857:	50                   	push   %eax
+     858:	ff 33                	push   (%ebx)
+     85a:	e8 04 fd ff ff       	call   563 <write>
+     85f:	83 c4 10             	add    $0x10,%esp
+     862:	eb d6                	jmp    83a <putc+0x3a>
+     864:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     86f:	90                   	nop
+
+00000870 <fflush>:
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     876:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     87a:	74 04                	je     880 <fflush+0x10>
+}
+     87c:	c9                   	leave
+     87d:	c3                   	ret
+     87e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     880:	a1 48 1a 00 00       	mov    0x1a48,%eax
+     885:	85 c0                	test   %eax,%eax
+     887:	7f 17                	jg     8a0 <fflush+0x30>
+  b->n = 0;
+     889:	c7 05 48 1a 00 00 00 	movl   $0x0,0x1a48
+     890:	00 00 00 
+  out.mode = 0;
+     893:	c7 05 44 1a 00 00 00 	movl   $0x0,0x1a44
+     89a:	00 00 00 
+}
+     89d:	c9                   	leave
+     89e:	c3                   	ret
+     89f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     8a0:	83 ec 04             	sub    $0x4,%esp
+     8a3:	50                   	push   %eax
+     8a4:	68 4c 1a 00 00       	push   $0x1a4c
+     8a9:	ff 35 40 1a 00 00    	push   0x1a40
+     8af:	e8 af fc ff ff       	call   563 <write>
+     8b4:	83 c4 10             	add    $0x10,%esp
+     8b7:	eb d0                	jmp    889 <fflush+0x19>
+     8b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 3c             	sub    $0x3c,%esp
+     8c9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     8cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     8cf:	83 fe 01             	cmp    $0x1,%esi
+     8d2:	0f 84 60 01 00 00    	je     a38 <printf+0x178>
+    b->fd = fd;
+     8d8:	89 35 20 18 00 00    	mov    %esi,0x1820
+  for(i = 0; fmt[i]; i++){
+     8de:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     8e1:	bf 20 18 00 00       	mov    $0x1820,%edi
+  for(i = 0; fmt[i]; i++){
+     8e6:	84 c0                	test   %al,%al
+     8e8:	74 65                	je     94f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     8ea:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8ed:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     8f0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     8f2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     8f5:	eb 1f                	jmp    916 <printf+0x56>
+     8f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fe:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     900:	83 f8 25             	cmp    $0x25,%eax
+     903:	74 3b                	je     940 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     905:	89 f8                	mov    %edi,%eax
+     907:	e8 f4 fe ff ff       	call   800 <putc>
+  for(i = 0; fmt[i]; i++){
+     90c:	0f b6 03             	movzbl (%ebx),%eax
+     90f:	83 c3 01             	add    $0x1,%ebx
+     912:	84 c0                	test   %al,%al
+     914:	74 39                	je     94f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     916:	0f be d0             	movsbl %al,%edx
+     919:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     91c:	85 f6                	test   %esi,%esi
+     91e:	74 e0                	je     900 <printf+0x40>
+      }
+    } else if(state == '%'){
+     920:	83 fe 25             	cmp    $0x25,%esi
+     923:	75 e7                	jne    90c <printf+0x4c>
+      if(c == 'd'){
+     925:	83 f8 25             	cmp    $0x25,%eax
+     928:	74 57                	je     981 <printf+0xc1>
+     92a:	83 e8 63             	sub    $0x63,%eax
+     92d:	83 f8 15             	cmp    $0x15,%eax
+     930:	77 36                	ja     968 <printf+0xa8>
+     932:	ff 24 85 fc 10 00 00 	jmp    *0x10fc(,%eax,4)
+     939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     940:	0f b6 03             	movzbl (%ebx),%eax
+     943:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     946:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     94b:	84 c0                	test   %al,%al
+     94d:	75 c7                	jne    916 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     94f:	8b 47 04             	mov    0x4(%edi),%eax
+     952:	85 c0                	test   %eax,%eax
+     954:	0f 84 06 01 00 00    	je     a60 <printf+0x1a0>
+    bflush(b);
+}
+     95a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     95d:	5b                   	pop    %ebx
+     95e:	5e                   	pop    %esi
+     95f:	5f                   	pop    %edi
+     960:	5d                   	pop    %ebp
+     961:	c3                   	ret
+     962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     968:	8b 4f 08             	mov    0x8(%edi),%ecx
+     96b:	8d 41 01             	lea    0x1(%ecx),%eax
+     96e:	89 47 08             	mov    %eax,0x8(%edi)
+     971:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     976:	3d 00 02 00 00       	cmp    $0x200,%eax
+     97b:	0f 84 77 01 00 00    	je     af8 <printf+0x238>
+        putc(b, c);
+     981:	89 f8                	mov    %edi,%eax
+      state = 0;
+     983:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     985:	e8 76 fe ff ff       	call   800 <putc>
+     98a:	eb 80                	jmp    90c <printf+0x4c>
+     98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     990:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     993:	83 ec 0c             	sub    $0xc,%esp
+     996:	b9 10 00 00 00       	mov    $0x10,%ecx
+     99b:	8b 16                	mov    (%esi),%edx
+     99d:	6a 00                	push   $0x0
+        ap++;
+     99f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     9a2:	89 f8                	mov    %edi,%eax
+     9a4:	e8 77 fd ff ff       	call   720 <printint>
+        ap++;
+     9a9:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     9ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9af:	31 f6                	xor    %esi,%esi
+     9b1:	e9 56 ff ff ff       	jmp    90c <printf+0x4c>
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     9c0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     9c3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     9c5:	83 c0 04             	add    $0x4,%eax
+     9c8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     9cb:	85 c9                	test   %ecx,%ecx
+     9cd:	0f 84 cd 00 00 00    	je     aa0 <printf+0x1e0>
+        while(*s != 0){
+     9d3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     9d6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     9d8:	84 d2                	test   %dl,%dl
+     9da:	0f 84 2c ff ff ff    	je     90c <printf+0x4c>
+          putc(b, *s);
+     9e0:	89 f8                	mov    %edi,%eax
+     9e2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     9e5:	e8 16 fe ff ff       	call   800 <putc>
+          s++;
+     9ea:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     9ed:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     9f1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     9f4:	84 d2                	test   %dl,%dl
+     9f6:	75 e8                	jne    9e0 <printf+0x120>
+      state = 0;
+     9f8:	31 f6                	xor    %esi,%esi
+     9fa:	e9 0d ff ff ff       	jmp    90c <printf+0x4c>
+     9ff:	90                   	nop
+        printint(b, *ap, 10, 1);
+     a00:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     a03:	83 ec 0c             	sub    $0xc,%esp
+     a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a0b:	8b 16                	mov    (%esi),%edx
+     a0d:	6a 01                	push   $0x1
+     a0f:	eb 8e                	jmp    99f <printf+0xdf>
+     a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     a18:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     a1b:	89 f8                	mov    %edi,%eax
+     a1d:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     a20:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     a23:	e8 d8 fd ff ff       	call   800 <putc>
+        ap++;
+     a28:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     a2b:	31 f6                	xor    %esi,%esi
+     a2d:	e9 da fe ff ff       	jmp    90c <printf+0x4c>
+     a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     a38:	8b 15 44 1a 00 00    	mov    0x1a44,%edx
+     a3e:	85 d2                	test   %edx,%edx
+     a40:	74 6e                	je     ab0 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     a42:	0f b6 03             	movzbl (%ebx),%eax
+     a45:	bf 40 1a 00 00       	mov    $0x1a40,%edi
+     a4a:	84 c0                	test   %al,%al
+     a4c:	0f 85 98 fe ff ff    	jne    8ea <printf+0x2a>
+     a52:	e9 03 ff ff ff       	jmp    95a <printf+0x9a>
+     a57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a60:	8b 47 08             	mov    0x8(%edi),%eax
+     a63:	85 c0                	test   %eax,%eax
+     a65:	7f 19                	jg     a80 <printf+0x1c0>
+  b->n = 0;
+     a67:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a71:	5b                   	pop    %ebx
+     a72:	5e                   	pop    %esi
+     a73:	5f                   	pop    %edi
+     a74:	5d                   	pop    %ebp
+     a75:	c3                   	ret
+     a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a80:	83 ec 04             	sub    $0x4,%esp
+     a83:	50                   	push   %eax
+     a84:	8d 47 0c             	lea    0xc(%edi),%eax
+     a87:	50                   	push   %eax
+     a88:	ff 37                	push   (%edi)
+     a8a:	e8 d4 fa ff ff       	call   563 <write>
+  b->n = 0;
+     a8f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     a96:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a99:	eb d3                	jmp    a6e <printf+0x1ae>
+     a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+     aa0:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     aa5:	b9 f3 10 00 00       	mov    $0x10f3,%ecx
+     aaa:	e9 31 ff ff ff       	jmp    9e0 <printf+0x120>
+     aaf:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ab0:	83 ec 08             	sub    $0x8,%esp
+     ab3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     ab6:	c7 05 40 1a 00 00 01 	movl   $0x1,0x1a40
+     abd:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ac0:	50                   	push   %eax
+     ac1:	6a 01                	push   $0x1
+     ac3:	e8 d3 fa ff ff       	call   59b <fstat>
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	85 c0                	test   %eax,%eax
+     acd:	75 22                	jne    af1 <printf+0x231>
+     acf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     ad4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ad9:	0f 45 f0             	cmovne %eax,%esi
+     adc:	89 35 44 1a 00 00    	mov    %esi,0x1a44
+      stdioflush = flushout;
+     ae2:	c7 05 e0 15 00 00 e0 	movl   $0x6e0,0x15e0
+     ae9:	06 00 00 
+     aec:	e9 51 ff ff ff       	jmp    a42 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     af1:	be 02 00 00 00       	mov    $0x2,%esi
+     af6:	eb e4                	jmp    adc <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     af8:	83 ec 04             	sub    $0x4,%esp
+     afb:	8d 47 0c             	lea    0xc(%edi),%eax
+     afe:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     b01:	68 00 02 00 00       	push   $0x200
+     b06:	50                   	push   %eax
+     b07:	ff 37                	push   (%edi)
+     b09:	e8 55 fa ff ff       	call   563 <write>
+  b->n = 0;
+     b0e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     b15:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     b18:	83 c4 10             	add    $0x10,%esp
+     b1b:	e9 61 fe ff ff       	jmp    981 <printf+0xc1>
+
+00000b20 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	56                   	push   %esi
+     b24:	53                   	push   %ebx
+     b25:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     b27:	a1 60 1c 00 00       	mov    0x1c60,%eax
+     b2c:	39 d8                	cmp    %ebx,%eax
+     b2e:	0f 83 e4 00 00 00    	jae    c18 <freepages+0xf8>
+     b34:	85 c0                	test   %eax,%eax
+     b36:	0f 84 dc 00 00 00    	je     c18 <freepages+0xf8>
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b40:	89 c2                	mov    %eax,%edx
+     b42:	8b 00                	mov    (%eax),%eax
+     b44:	85 c0                	test   %eax,%eax
+     b46:	74 04                	je     b4c <freepages+0x2c>
+     b48:	39 d8                	cmp    %ebx,%eax
+     b4a:	72 f4                	jb     b40 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     b4c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     b4f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     b51:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     b53:	85 c0                	test   %eax,%eax
+     b55:	74 15                	je     b6c <freepages+0x4c>
+    p->prev = s;
+     b57:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     b5a:	8b 73 10             	mov    0x10(%ebx),%esi
+     b5d:	89 f1                	mov    %esi,%ecx
+     b5f:	c1 e1 0c             	shl    $0xc,%ecx
+     b62:	01 d9                	add    %ebx,%ecx
+     b64:	39 c8                	cmp    %ecx,%eax
+     b66:	0f 84 d8 00 00 00    	je     c44 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     b6c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     b6f:	89 c8                	mov    %ecx,%eax
+     b71:	c1 e0 0c             	shl    $0xc,%eax
+     b74:	01 d0                	add    %edx,%eax
+     b76:	39 c3                	cmp    %eax,%ebx
+     b78:	74 16                	je     b90 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b7a:	8b 03                	mov    (%ebx),%eax
+     b7c:	85 c0                	test   %eax,%eax
+     b7e:	74 40                	je     bc0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     b80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b83:	5b                   	pop    %ebx
+     b84:	5e                   	pop    %esi
+     b85:	5d                   	pop    %ebp
+     b86:	c3                   	ret
+     b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     b90:	03 4b 10             	add    0x10(%ebx),%ecx
+     b93:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     b96:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     b99:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b9b:	85 c9                	test   %ecx,%ecx
+     b9d:	0f 84 dd 00 00 00    	je     c80 <freepages+0x160>
+    s->prev->next = s->next;
+     ba3:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     ba5:	85 c0                	test   %eax,%eax
+     ba7:	74 06                	je     baf <freepages+0x8f>
+    s->next->prev = s->prev;
+     ba9:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     bac:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     baf:	8b 02                	mov    (%edx),%eax
+     bb1:	89 d3                	mov    %edx,%ebx
+     bb3:	85 c0                	test   %eax,%eax
+     bb5:	75 c9                	jne    b80 <freepages+0x60>
+     bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbe:	66 90                	xchg   %ax,%ax
+     bc0:	8b 43 10             	mov    0x10(%ebx),%eax
+     bc3:	83 f8 0f             	cmp    $0xf,%eax
+     bc6:	76 b8                	jbe    b80 <freepages+0x60>
+     bc8:	83 ec 0c             	sub    $0xc,%esp
+     bcb:	c1 e0 0c             	shl    $0xc,%eax
+     bce:	6a 00                	push   $0x0
+     bd0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     bd3:	e8 f3 f9 ff ff       	call   5cb <sbrk>
+     bd8:	83 c4 10             	add    $0x10,%esp
+     bdb:	39 c6                	cmp    %eax,%esi
+     bdd:	75 a1                	jne    b80 <freepages+0x60>
+  if(s->prev)
+     bdf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     be2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     be4:	85 d2                	test   %edx,%edx
+     be6:	0f 84 a5 00 00 00    	je     c91 <freepages+0x171>
+    s->prev->next = s->next;
+     bec:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     bee:	85 c0                	test   %eax,%eax
+     bf0:	74 06                	je     bf8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     bf2:	8b 53 04             	mov    0x4(%ebx),%edx
+     bf5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     bf8:	8b 43 10             	mov    0x10(%ebx),%eax
+     bfb:	83 ec 0c             	sub    $0xc,%esp
+     bfe:	c1 e0 0c             	shl    $0xc,%eax
+     c01:	f7 d8                	neg    %eax
+     c03:	50                   	push   %eax
+     c04:	e8 c2 f9 ff ff       	call   5cb <sbrk>
+     c09:	83 c4 10             	add    $0x10,%esp
+}
+     c0c:	e9 6f ff ff ff       	jmp    b80 <freepages+0x60>
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     c18:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     c1f:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     c21:	89 1d 60 1c 00 00    	mov    %ebx,0x1c60
+  if(p)
+     c27:	85 c0                	test   %eax,%eax
+     c29:	74 95                	je     bc0 <freepages+0xa0>
+    p->prev = s;
+     c2b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     c2e:	8b 73 10             	mov    0x10(%ebx),%esi
+     c31:	89 f2                	mov    %esi,%edx
+     c33:	c1 e2 0c             	shl    $0xc,%edx
+     c36:	01 da                	add    %ebx,%edx
+     c38:	39 d0                	cmp    %edx,%eax
+     c3a:	0f 85 3a ff ff ff    	jne    b7a <freepages+0x5a>
+     c40:	89 c1                	mov    %eax,%ecx
+     c42:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     c44:	8b 41 10             	mov    0x10(%ecx),%eax
+     c47:	01 f0                	add    %esi,%eax
+     c49:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     c4c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     c4f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     c51:	85 f6                	test   %esi,%esi
+     c53:	74 35                	je     c8a <freepages+0x16a>
+    s->prev->next = s->next;
+     c55:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     c57:	85 c0                	test   %eax,%eax
+     c59:	74 06                	je     c61 <freepages+0x141>
+    s->next->prev = s->prev;
+     c5b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     c5e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     c61:	85 d2                	test   %edx,%edx
+     c63:	0f 84 11 ff ff ff    	je     b7a <freepages+0x5a>
+     c69:	8b 4a 10             	mov    0x10(%edx),%ecx
+     c6c:	89 c8                	mov    %ecx,%eax
+     c6e:	c1 e0 0c             	shl    $0xc,%eax
+     c71:	01 d0                	add    %edx,%eax
+     c73:	39 c3                	cmp    %eax,%ebx
+     c75:	0f 85 ff fe ff ff    	jne    b7a <freepages+0x5a>
+     c7b:	e9 10 ff ff ff       	jmp    b90 <freepages+0x70>
+    *l = s->next;
+     c80:	a3 60 1c 00 00       	mov    %eax,0x1c60
+     c85:	e9 1b ff ff ff       	jmp    ba5 <freepages+0x85>
+     c8a:	a3 60 1c 00 00       	mov    %eax,0x1c60
+     c8f:	eb c6                	jmp    c57 <freepages+0x137>
+     c91:	a3 60 1c 00 00       	mov    %eax,0x1c60
+     c96:	e9 53 ff ff ff       	jmp    bee <freepages+0xce>
+     c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c9f:	90                   	nop
+
+00000ca0 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	56                   	push   %esi
+     ca4:	53                   	push   %ebx
+     ca5:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     ca7:	a1 60 1c 00 00       	mov    0x1c60,%eax
+     cac:	85 c0                	test   %eax,%eax
+     cae:	74 5e                	je     d0e <getpages+0x6e>
+    if(s->npages < n)
+     cb0:	8b 50 10             	mov    0x10(%eax),%edx
+     cb3:	39 da                	cmp    %ebx,%edx
+     cb5:	72 51                	jb     d08 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     cb7:	39 d3                	cmp    %edx,%ebx
+     cb9:	72 25                	jb     ce0 <getpages+0x40>
+  if(s->prev)
+     cbb:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     cbe:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     cc0:	85 c9                	test   %ecx,%ecx
+     cc2:	0f 84 a8 00 00 00    	je     d70 <getpages+0xd0>
+    s->prev->next = s->next;
+     cc8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     cca:	85 d2                	test   %edx,%edx
+     ccc:	74 06                	je     cd4 <getpages+0x34>
+    s->next->prev = s->prev;
+     cce:	8b 48 04             	mov    0x4(%eax),%ecx
+     cd1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     cd4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     cd7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cda:	5b                   	pop    %ebx
+     cdb:	5e                   	pop    %esi
+     cdc:	5d                   	pop    %ebp
+     cdd:	c3                   	ret
+     cde:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     ce0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     ce2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     ce4:	c1 e1 0c             	shl    $0xc,%ecx
+     ce7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     ce9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     cec:	8b 70 04             	mov    0x4(%eax),%esi
+     cef:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     cf2:	8b 10                	mov    (%eax),%edx
+     cf4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     cf6:	85 f6                	test   %esi,%esi
+     cf8:	74 66                	je     d60 <getpages+0xc0>
+        rest->prev->next = rest;
+     cfa:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     cfc:	8b 11                	mov    (%ecx),%edx
+     cfe:	85 d2                	test   %edx,%edx
+     d00:	75 cf                	jne    cd1 <getpages+0x31>
+     d02:	eb d0                	jmp    cd4 <getpages+0x34>
+     d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     d08:	8b 00                	mov    (%eax),%eax
+     d0a:	85 c0                	test   %eax,%eax
+     d0c:	75 a2                	jne    cb0 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     d0e:	83 ec 0c             	sub    $0xc,%esp
+     d11:	6a 00                	push   $0x0
+     d13:	e8 b3 f8 ff ff       	call   5cb <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d18:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     d1b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     d21:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d23:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     d29:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d2f:	29 d0                	sub    %edx,%eax
+     d31:	c1 e8 0c             	shr    $0xc,%eax
+     d34:	39 d8                	cmp    %ebx,%eax
+     d36:	72 48                	jb     d80 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     d38:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d3a:	89 d8                	mov    %ebx,%eax
+     d3c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     d3f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d41:	c1 e0 0c             	shl    $0xc,%eax
+     d44:	01 f0                	add    %esi,%eax
+     d46:	50                   	push   %eax
+     d47:	e8 7f f8 ff ff       	call   5cb <sbrk>
+     d4c:	83 c4 10             	add    $0x10,%esp
+     d4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d52:	74 2c                	je     d80 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     d54:	01 f0                	add    %esi,%eax
+     d56:	e9 79 ff ff ff       	jmp    cd4 <getpages+0x34>
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+        runs = rest;
+     d60:	89 0d 60 1c 00 00    	mov    %ecx,0x1c60
+     d66:	eb 96                	jmp    cfe <getpages+0x5e>
+     d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+    *l = s->next;
+     d70:	89 15 60 1c 00 00    	mov    %edx,0x1c60
+     d76:	e9 4f ff ff ff       	jmp    cca <getpages+0x2a>
+     d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+    return 0;
+     d80:	31 c0                	xor    %eax,%eax
+     d82:	e9 50 ff ff ff       	jmp    cd7 <getpages+0x37>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+
+00000d90 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	83 ec 1c             	sub    $0x1c,%esp
+     d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     d9c:	85 c0                	test   %eax,%eax
+     d9e:	0f 84 97 00 00 00    	je     e3b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     da4:	89 c3                	mov    %eax,%ebx
+     da6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     dac:	8b 73 14             	mov    0x14(%ebx),%esi
+     daf:	83 fe 01             	cmp    $0x1,%esi
+     db2:	74 74                	je     e28 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     db4:	85 f6                	test   %esi,%esi
+     db6:	74 5d                	je     e15 <free+0x85>
+  if(s->free == 0)
+     db8:	8b 53 08             	mov    0x8(%ebx),%edx
+     dbb:	85 d2                	test   %edx,%edx
+     dbd:	0f 84 85 00 00 00    	je     e48 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     dc3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     dc5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     dc8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     dcb:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     dce:	8b 04 f5 84 1c 00 00 	mov    0x1c84(,%esi,8),%eax
+  s->inuse--;
+     dd5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     dd8:	83 c0 01             	add    $0x1,%eax
+     ddb:	89 04 f5 84 1c 00 00 	mov    %eax,0x1c84(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     de2:	85 d2                	test   %edx,%edx
+     de4:	75 55                	jne    e3b <free+0xab>
+     de6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     deb:	89 f1                	mov    %esi,%ecx
+     ded:	d3 ea                	shr    %cl,%edx
+     def:	39 c2                	cmp    %eax,%edx
+     df1:	73 7d                	jae    e70 <free+0xe0>
+  if(s->prev)
+     df3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     df6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     df8:	85 ff                	test   %edi,%edi
+     dfa:	0f 84 a0 00 00 00    	je     ea0 <free+0x110>
+    s->prev->next = s->next;
+     e00:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     e02:	85 c9                	test   %ecx,%ecx
+     e04:	74 06                	je     e0c <free+0x7c>
+    s->next->prev = s->prev;
+     e06:	8b 7b 04             	mov    0x4(%ebx),%edi
+     e09:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     e0c:	29 d0                	sub    %edx,%eax
+     e0e:	89 04 f5 84 1c 00 00 	mov    %eax,0x1c84(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     e18:	89 d8                	mov    %ebx,%eax
+}
+     e1a:	5b                   	pop    %ebx
+     e1b:	5e                   	pop    %esi
+     e1c:	5f                   	pop    %edi
+     e1d:	5d                   	pop    %ebp
+    freepages(s);
+     e1e:	e9 fd fc ff ff       	jmp    b20 <freepages>
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     e28:	8b 43 10             	mov    0x10(%ebx),%eax
+     e2b:	83 ec 08             	sub    $0x8,%esp
+     e2e:	c1 e0 0c             	shl    $0xc,%eax
+     e31:	50                   	push   %eax
+     e32:	53                   	push   %ebx
+     e33:	e8 6b f8 ff ff       	call   6a3 <munmap>
+     e38:	83 c4 10             	add    $0x10,%esp
+}
+     e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e3e:	5b                   	pop    %ebx
+     e3f:	5e                   	pop    %esi
+     e40:	5f                   	pop    %edi
+     e41:	5d                   	pop    %ebp
+     e42:	c3                   	ret
+     e43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e47:	90                   	nop
+  s->next = *l;
+     e48:	8b 14 f5 80 1c 00 00 	mov    0x1c80(,%esi,8),%edx
+  s->prev = 0;
+     e4f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     e56:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     e58:	85 d2                	test   %edx,%edx
+     e5a:	74 06                	je     e62 <free+0xd2>
+    (*l)->prev = s;
+     e5c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     e5f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+     e62:	89 1c f5 80 1c 00 00 	mov    %ebx,0x1c80(,%esi,8)
+}
+     e69:	e9 55 ff ff ff       	jmp    dc3 <free+0x33>
+     e6e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+     e70:	83 ec 0c             	sub    $0xc,%esp
+     e73:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e76:	8b 7b 10             	mov    0x10(%ebx),%edi
+     e79:	6a 00                	push   $0x0
+     e7b:	c1 e7 0c             	shl    $0xc,%edi
+     e7e:	01 df                	add    %ebx,%edi
+     e80:	e8 46 f7 ff ff       	call   5cb <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     e8b:	39 c7                	cmp    %eax,%edi
+     e8d:	75 ac                	jne    e3b <free+0xab>
+     e8f:	8b 04 f5 84 1c 00 00 	mov    0x1c84(,%esi,8),%eax
+     e96:	e9 58 ff ff ff       	jmp    df3 <free+0x63>
+     e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+    *l = s->next;
+     ea0:	89 0c f5 80 1c 00 00 	mov    %ecx,0x1c80(,%esi,8)
+     ea7:	e9 56 ff ff ff       	jmp    e02 <free+0x72>
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000eb0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     eb0:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     eb1:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+     eb6:	89 e5                	mov    %esp,%ebp
+     eb8:	57                   	push   %edi
+     eb9:	56                   	push   %esi
+     eba:	53                   	push   %ebx
+     ebb:	83 ec 1c             	sub    $0x1c,%esp
+     ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+     ec1:	83 f8 10             	cmp    $0x10,%eax
+     ec4:	0f 86 92 00 00 00    	jbe    f5c <malloc+0xac>
+     eca:	ba 01 00 00 00       	mov    $0x1,%edx
+     ecf:	eb 13                	jmp    ee4 <malloc+0x34>
+     ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ed8:	89 d3                	mov    %edx,%ebx
+     eda:	d3 e3                	shl    %cl,%ebx
+     edc:	39 c3                	cmp    %eax,%ebx
+     ede:	0f 83 84 00 00 00    	jae    f68 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     ee4:	83 c1 01             	add    $0x1,%ecx
+     ee7:	83 f9 0b             	cmp    $0xb,%ecx
+     eea:	75 ec                	jne    ed8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+     eec:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+     ef1:	0f 87 c9 00 00 00    	ja     fc0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+     ef7:	05 17 10 00 00       	add    $0x1017,%eax
+     efc:	89 c3                	mov    %eax,%ebx
+     efe:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+     f01:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+     f06:	77 28                	ja     f30 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+     f08:	89 d8                	mov    %ebx,%eax
+     f0a:	e8 91 fd ff ff       	call   ca0 <getpages>
+     f0f:	85 c0                	test   %eax,%eax
+     f11:	0f 84 a9 00 00 00    	je     fc0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+     f17:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+     f1e:	83 c0 18             	add    $0x18,%eax
+}
+     f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f24:	5b                   	pop    %ebx
+     f25:	5e                   	pop    %esi
+     f26:	5f                   	pop    %edi
+     f27:	5d                   	pop    %ebp
+     f28:	c3                   	ret
+     f29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+     f30:	89 d8                	mov    %ebx,%eax
+     f32:	83 ec 08             	sub    $0x8,%esp
+     f35:	c1 e0 0c             	shl    $0xc,%eax
+     f38:	6a 00                	push   $0x0
+     f3a:	6a ff                	push   $0xffffffff
+     f3c:	6a 22                	push   $0x22
+     f3e:	6a 03                	push   $0x3
+     f40:	50                   	push   %eax
+     f41:	6a 00                	push   $0x0
+     f43:	e8 53 f7 ff ff       	call   69b <mmap>
+    if(s == MAP_FAILED)
+     f48:	83 c4 20             	add    $0x20,%esp
+     f4b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f4e:	74 b8                	je     f08 <malloc+0x58>
+      s->shift = MAPRUN;
+     f50:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+     f57:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+     f5a:	eb c2                	jmp    f1e <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+     f5c:	bb 10 00 00 00       	mov    $0x10,%ebx
+     f61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+     f68:	8b 34 cd 80 1c 00 00 	mov    0x1c80(,%ecx,8),%esi
+     f6f:	85 f6                	test   %esi,%esi
+     f71:	74 57                	je     fca <malloc+0x11a>
+  classes[shift].nfree--;
+     f73:	8b 1c cd 84 1c 00 00 	mov    0x1c84(,%ecx,8),%ebx
+  o = s->free;
+     f7a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+     f7d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     f80:	89 14 cd 84 1c 00 00 	mov    %edx,0x1c84(,%ecx,8)
+  s->free = NEXTFREE(o);
+     f87:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+     f89:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+     f8d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+     f90:	85 ff                	test   %edi,%edi
+     f92:	75 8d                	jne    f21 <malloc+0x71>
+  if(s->prev)
+     f94:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+     f97:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+     f99:	85 db                	test   %ebx,%ebx
+     f9b:	0f 84 b7 00 00 00    	je     1058 <malloc+0x1a8>
+    s->prev->next = s->next;
+     fa1:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+     fa3:	85 d2                	test   %edx,%edx
+     fa5:	0f 84 76 ff ff ff    	je     f21 <malloc+0x71>
+    s->next->prev = s->prev;
+     fab:	8b 4e 04             	mov    0x4(%esi),%ecx
+     fae:	89 4a 04             	mov    %ecx,0x4(%edx)
+     fb1:	e9 6b ff ff ff       	jmp    f21 <malloc+0x71>
+     fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     fc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     fc3:	31 c0                	xor    %eax,%eax
+}
+     fc5:	5b                   	pop    %ebx
+     fc6:	5e                   	pop    %esi
+     fc7:	5f                   	pop    %edi
+     fc8:	5d                   	pop    %ebp
+     fc9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+     fca:	b8 01 00 00 00       	mov    $0x1,%eax
+     fcf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     fd2:	e8 c9 fc ff ff       	call   ca0 <getpages>
+     fd7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     fda:	85 c0                	test   %eax,%eax
+     fdc:	89 c2                	mov    %eax,%edx
+     fde:	74 e0                	je     fc0 <malloc+0x110>
+    s->shift = shift;
+     fe0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fe3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+     fe5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+     fec:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     ff1:	89 df                	mov    %ebx,%edi
+     ff3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+     ff5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+     ff7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     ffa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     ffd:	83 e8 01             	sub    $0x1,%eax
+    1000:	d3 e0                	shl    %cl,%eax
+    1002:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1005:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1009:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    100c:	eb 04                	jmp    1012 <malloc+0x162>
+    100e:	66 90                	xchg   %ax,%ax
+    1010:	89 c8                	mov    %ecx,%eax
+    1012:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    1015:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1017:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    101a:	89 c6                	mov    %eax,%esi
+    101c:	39 da                	cmp    %ebx,%edx
+    101e:	7f f0                	jg     1010 <malloc+0x160>
+    1020:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1023:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1026:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1029:	8b 04 cd 80 1c 00 00 	mov    0x1c80(,%ecx,8),%eax
+  s->prev = 0;
+    1030:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1037:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1039:	85 c0                	test   %eax,%eax
+    103b:	74 03                	je     1040 <malloc+0x190>
+    (*l)->prev = s;
+    103d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1040:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1043:	89 14 cd 80 1c 00 00 	mov    %edx,0x1c80(,%ecx,8)
+    classes[shift].nfree += n;
+    104a:	89 d6                	mov    %edx,%esi
+    104c:	03 1c cd 84 1c 00 00 	add    0x1c84(,%ecx,8),%ebx
+    1053:	e9 22 ff ff ff       	jmp    f7a <malloc+0xca>
+    *l = s->next;
+    1058:	89 14 cd 80 1c 00 00 	mov    %edx,0x1c80(,%ecx,8)
+    105f:	e9 3f ff ff ff       	jmp    fa3 <malloc+0xf3>
@@ -0,0 +1,57 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Measure a page-strided scan of a large heap, which misses
+// the TLB on nearly every access.
+// tlbbench [heap MB] [passes]
+//
+// The first scan runs over the heap as the kernel mapped it,
+// with 4 MB pages where the heap covers whole aligned 4 MB
+// regions. fork() splits those into 4 KB pages, so the second
+// scan, after a fork, shows the cost of the 4 KB mappings.
+
+#define MB (1024 * 1024)
+
+int sink;  // keeps the loads
+
+int scan(char *heap, int size, int passes)
+{
+  int i, p, t0, sum;
+
+  sum = 0;
+  t0 = uptime();
+  for (p = 0; p < passes; p++)
+    for (i = 0; i < size; i += 4096)
+      sum += heap[i];
+  sink = sum;
+  return uptime() - t0;
+}
+
+int main(int argc, char *argv[])
+{
+  int mb = argc > 1 ? atoi(argv[1]) : 64;
+  int passes = argc > 2 ? atoi(argv[2]) : 200;
+  char *brk, *heap;
+  int t;
+
+  // Start the heap on a 4 MB boundary.
+  brk = sbrk(0);
+  if (sbrk((4 * MB - (uint)brk % (4 * MB)) % (4 * MB)) == (char *)-1 ||
+      (heap = sbrk(mb * MB)) == (char *)-1)
+  {
+    printf(1, "tlbbench: cannot grow heap to %d MB\n", mb);
+    exit();
+  }
+  heap[0] = 1;
+
+  t = scan(heap, mb * MB, passes);
+  printf(1, "tlbbench: %d scans of %d MB, 4 MB pages: %d ticks\n", passes, mb, t);
+  if (fork() == 0)
+    exit();
+  wait();
+  t = scan(heap, mb * MB, passes);
+  printf(1, "tlbbench: %d scans of %d MB, 4 KB pages: %d ticks\n", passes, mb, t);
+  print_vm_stats();
+  exit();
+}
@@ -78,6 +78,12 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    if(pagefault(rcr2(), tf->err) == 0)
+      break;
+    // Not a fault we can resolve; treat it as any other trap.
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -103,8 +109,13 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER){
+    // Its pages may be paged out while it waits, unless it
+    // is in the middle of something in the kernel; see swap.c.
+    myproc()->upreempted = (tf->cs&3) == DPL_USER;
     yield();
+    myproc()->upreempted = 0;
+  }
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
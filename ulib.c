@@ -4,6 +4,43 @@
 #include "user.h"
 #include "x86.h"
 
+// Set by printf.c to write out its buffered output, which
+// must happen before the process exits, forks, execs, or
+// waits for input that the output may prompt for.
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+    stdioflush();
+  return _fork();
+}
+
+int
+exit(void)
+{
+  if(stdioflush)
+    stdioflush();
+  _exit();
+}
+
+int
+exec(char *path, char **argv)
+{
+  if(stdioflush)
+    stdioflush();
+  return _exec(path, argv);
+}
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+  if(stdioflush)
+    stdioflush();
+  return _spawn(path, argv, actions);
+}
+
 char*
 strcpy(char *s, const char *t)
 {
@@ -49,16 +86,37 @@ strchr(const char *s, char c)
   return 0;
 }
 
+// Input for gets(). The console returns at most a line per
+// read, so it is read a buffer at a time. A file or pipe is
+// read a byte at a time, so that what follows the line is
+// left for the programs this one starts.
+static struct {
+  char buf[512];
+  int r;        // next byte to return
+  int n;        // bytes in buf
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
 char*
 gets(char *buf, int max)
 {
-  int i, cc;
+  struct stat st;
+  int i;
   char c;
 
+  if(stdioflush)
+    stdioflush();
+  if(in.size == 0)
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
   for(i=0; i+1 < max; ){
-    cc = read(0, &c, 1);
-    if(cc < 1)
-      break;
+    if(in.r == in.n){
+      in.r = in.n = 0;
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
     buf[i++] = c;
     if(c == '\n' || c == '\r')
       break;
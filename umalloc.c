@@ -2,89 +2,258 @@
 #include "stat.h"
 #include "user.h"
 #include "param.h"
+#include "mman.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator for user programs.
+//
+// Small blocks come from size classes of powers of two, each
+// carved from pages of its own like the kernel's slab caches
+// (see slab.c): a page starts with a struct upage header, so
+// free() finds a block's class by rounding its address down,
+// and allocating or freeing one is a list push or pop.
+//
+// Larger blocks are runs of whole pages, from the heap or, when
+// big, from mmap(). Free runs of heap pages are kept in address
+// order and merged, and a large enough free run at the top of
+// the heap is given back to the kernel with sbrk().
 
-typedef long Align;
+#define PGSIZE 4096
+#define PGROUNDUP(a) (((a) + PGSIZE - 1) & ~(PGSIZE - 1))
+#define PGROUNDDOWN(a) ((a) & ~(PGSIZE - 1))
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
+// Smallest and largest size classes, as powers of two.
+#define MINSHIFT 4
+#define MAXSHIFT 10
+
+// upage.shift of the runs of pages holding one large block.
+#define HEAPRUN 0
+#define MAPRUN 1
+
+#define TRIMPAGES 16   // free run at the top of the heap given back from this size
+#define MAPPAGES 32    // blocks of this many pages come from mmap()
+
+struct upage {
+  struct upage *next;   // in its class's partial list or free runs
+  struct upage *prev;
+  char *free;           // first free block
+  int inuse;            // blocks handed out
+  uint npages;          // pages in this run
+  int shift;            // block size is 1<<shift, or HEAPRUN or MAPRUN
 };
 
-typedef union header Header;
+static struct {
+  struct upage *partial;  // pages with free blocks
+  int nfree;              // free blocks over all its pages
+} classes[MAXSHIFT + 1];
 
-static Header base;
-static Header *freep;
+static struct upage *runs;  // free runs of heap pages, by address
 
-void
-free(void *ap)
+#define PERPAGE(shift) ((PGSIZE - sizeof(struct upage)) >> (shift))
+#define NEXTFREE(o) (*(char**)(o))
+#define RUNEND(s) ((char*)(s) + (s)->npages * PGSIZE)
+
+static void
+push(struct upage **l, struct upage *s)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  s->prev = 0;
+  s->next = *l;
+  if(*l)
+    (*l)->prev = s;
+  *l = s;
 }
 
-static Header*
-morecore(uint nu)
+static void
+delist(struct upage **l, struct upage *s)
 {
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    *l = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+    prevp = p;
+  s->prev = prevp;
+  s->next = p;
+  if(prevp)
+    prevp->next = s;
+  else
+    runs = s;
+  if(p)
+    p->prev = s;
+
+  if(p && RUNEND(s) == (char*)p){
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+  struct upage *s, *rest;
+  uint brk, pad;
   char *p;
-  Header *hp;
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
+  for(s = runs; s; s = s->next){
+    if(s->npages < n)
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+      rest->npages = s->npages - n;
+      rest->prev = s->prev;
+      rest->next = s->next;
+      if(rest->prev)
+        rest->prev->next = rest;
+      else
+        runs = rest;
+      if(rest->next)
+        rest->next->prev = rest;
+    } else
+      delist(&runs, s);
+    s->npages = n;
+    return s;
+  }
+
+  // Others may have moved the break to the middle of a page.
+  brk = (uint)sbrk(0);
+  pad = PGROUNDUP(brk) - brk;
+  if(n > (0x80000000 - pad) / PGSIZE)
     return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+  return s;
+}
+
+// Allocate a block of class shift.
+static void*
+smalloc(int shift)
+{
+  struct upage *s;
+  char *o;
+  int i, n;
+
+  if(classes[shift].partial == 0){
+    if((s = getpages(1)) == 0)
+      return 0;
+    s->shift = shift;
+    s->inuse = 0;
+    s->free = 0;
+    n = PERPAGE(shift);
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    for(i = 0; i < n; i++, o -= 1 << shift){
+      NEXTFREE(o) = s->free;
+      s->free = o;
+    }
+    push(&classes[shift].partial, s);
+    classes[shift].nfree += n;
+  }
+  s = classes[shift].partial;
+  o = s->free;
+  s->free = NEXTFREE(o);
+  s->inuse++;
+  classes[shift].nfree--;
+  if(s->free == 0)
+    delist(&classes[shift].partial, s);
+  return o;
+}
+
+// Free block o of page s.
+static void
+sfree(struct upage *s, char *o)
+{
+  int shift = s->shift;
+
+  if(s->free == 0)
+    push(&classes[shift].partial, s);
+  NEXTFREE(o) = s->free;
+  s->free = o;
+  s->inuse--;
+  classes[shift].nfree++;
+  // Keep an empty page if it is the class's only spare room,
+  // so that allocating and freeing one block in a loop does
+  // not carve a page each time, unless it would keep the heap
+  // from shrinking.
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+                       RUNEND(s) == sbrk(0))){
+    delist(&classes[shift].partial, s);
+    classes[shift].nfree -= PERPAGE(shift);
+    freepages(s);
+  }
+}
+
+void
+free(void *ap)
+{
+  struct upage *s;
+
+  if(ap == 0)
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+  if(s->shift == MAPRUN)
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    freepages(s);
+  else
+    sfree(s, ap);
 }
 
 void*
 malloc(uint nbytes)
 {
-  Header *p, *prevp;
-  uint nunits;
+  struct upage *s;
+  uint n;
+  int shift;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
-  }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    if(nbytes <= (1 << shift))
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+  s = 0;
+  if(n >= MAPPAGES){
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+             MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(s == MAP_FAILED)
+      s = 0;
+    else {
+      s->shift = MAPRUN;
+      s->npages = n;
     }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
   }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+      return 0;
+    s->shift = HEAPRUN;
+  }
+  return s + 1;
 }
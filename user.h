@@ -1,4 +1,6 @@
 struct stat;
+struct spawn_action;
+struct memstat;
 struct rtcdate;
 
 // system calls
@@ -26,7 +28,7 @@ int uptime(void);
 int count_num_of_digits(void);
 int get_parent_id(void);
 int get_children(int);
-void set_path(char *);
+int set_path(char *);
 void set_sleep(int);
 int get_time(void);
 void change_process_level(int, int);
@@ -37,6 +39,28 @@ void print_processes_info(void);
 void barrier_init(int);
 void barrier_wait(void);
 void reentrant_spinlock_test(void);
+void print_lock_stats(void);
+void set_process_gang(int, int);
+void set_gang_scheduling(int);
+int sem_create(int);
+int event_create(void);
+int sync_post(int);
+int sync_wait(int);
+int sync_close(int);
+int event_reset(int);
+void print_vm_stats(void);
+void *mmap(void *, uint, int, int, int, uint);
+int munmap(void *, uint);
+int shmget(int, uint);
+void *shmat(int);
+int shmdt(void *);
+int shmrm(int);
+int spawn(char *, char **, struct spawn_action *);
+int memstat(int, struct memstat *);
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _exec(char *, char **);
+int _spawn(char *, char **, struct spawn_action *);
 
 // ulib.c
 int stat(const char *, struct stat *);
@@ -45,6 +69,7 @@ void *memmove(void *, const void *, int);
 char *strchr(const char *, char c);
 int strcmp(const char *, const char *);
 void printf(int, const char *, ...);
+void fflush(int);
 char *gets(char *, int max);
 uint strlen(const char *);
 void *memset(void *, int, uint);
@@ -0,0 +1,7086 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 20 4f 00 00       	push   $0x4f20
+      16:	6a 01                	push   $0x1
+      18:	e8 53 38 00 00       	call   3870 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 34 4f 00 00       	push   $0x4f34
+      26:	e8 08 35 00 00       	call   3533 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 a8 55 00 00       	push   $0x55a8
+      39:	6a 01                	push   $0x1
+      3b:	e8 30 38 00 00       	call   3870 <printf>
+    exit();
+      40:	e8 3b 31 00 00       	call   3180 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 34 4f 00 00       	push   $0x4f34
+      51:	e8 dd 34 00 00       	call   3533 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 bd 34 00 00       	call   351b <close>
+
+  argptest();
+      5e:	e8 5d 30 00 00       	call   30c0 <argptest>
+  createdelete();
+      63:	e8 e8 10 00 00       	call   1150 <createdelete>
+  linkunlink();
+      68:	e8 83 19 00 00       	call   19f0 <linkunlink>
+  concreate();
+      6d:	e8 7e 16 00 00       	call   16f0 <concreate>
+  fourfiles();
+      72:	e8 d9 0e 00 00       	call   f50 <fourfiles>
+  sharedfd();
+      77:	e8 14 0d 00 00       	call   d90 <sharedfd>
+
+  bigargtest();
+      7c:	e8 ff 2c 00 00       	call   2d80 <bigargtest>
+  bigwrite();
+      81:	e8 8a 22 00 00       	call   2310 <bigwrite>
+  bigargtest();
+      86:	e8 f5 2c 00 00       	call   2d80 <bigargtest>
+  bsstest();
+      8b:	e8 80 2c 00 00       	call   2d10 <bsstest>
+  validatetest();
+      90:	e8 cb 2b 00 00       	call   2c60 <validatetest>
+
+  opentest();
+      95:	e8 56 03 00 00       	call   3f0 <opentest>
+  writetest();
+      9a:	e8 e1 03 00 00       	call   480 <writetest>
+  writetest1();
+      9f:	e8 bc 05 00 00       	call   660 <writetest1>
+  createtest();
+      a4:	e8 87 07 00 00       	call   830 <createtest>
+
+  openiputtest();
+      a9:	e8 42 02 00 00       	call   2f0 <openiputtest>
+  exitiputtest();
+      ae:	e8 3d 01 00 00       	call   1f0 <exitiputtest>
+  iputtest();
+      b3:	e8 58 00 00 00       	call   110 <iputtest>
+
+  pipe1();
+      b8:	e8 53 09 00 00       	call   a10 <pipe1>
+  preempt();
+      bd:	e8 ee 0a 00 00       	call   bb0 <preempt>
+  exitwait();
+      c2:	e8 49 0c 00 00       	call   d10 <exitwait>
+
+  rmdot();
+      c7:	e8 34 26 00 00       	call   2700 <rmdot>
+  fourteen();
+      cc:	e8 ef 24 00 00       	call   25c0 <fourteen>
+  bigfile();
+      d1:	e8 1a 23 00 00       	call   23f0 <bigfile>
+  subdir();
+      d6:	e8 55 1b 00 00       	call   1c30 <subdir>
+  linktest();
+      db:	e8 00 14 00 00       	call   14e0 <linktest>
+  unlinkread();
+      e0:	e8 6b 12 00 00       	call   1350 <unlinkread>
+  dirfile();
+      e5:	e8 96 27 00 00       	call   2880 <dirfile>
+  iref();
+      ea:	e8 91 29 00 00       	call   2a80 <iref>
+  forktest();
+      ef:	e8 ac 2a 00 00       	call   2ba0 <forktest>
+  bigdir(); // slow
+      f4:	e8 07 1a 00 00       	call   1b00 <bigdir>
+
+  uio();
+      f9:	e8 52 2f 00 00       	call   3050 <uio>
+
+  exectest();
+      fe:	e8 bd 08 00 00       	call   9c0 <exectest>
+
+  exit();
+     103:	e8 78 30 00 00       	call   3180 <exit>
+     108:	66 90                	xchg   %ax,%ax
+     10a:	66 90                	xchg   %ax,%ax
+     10c:	66 90                	xchg   %ax,%ax
+     10e:	66 90                	xchg   %ax,%ax
+
+00000110 <iputtest>:
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     116:	68 a8 40 00 00       	push   $0x40a8
+     11b:	ff 35 34 60 00 00    	push   0x6034
+     121:	e8 4a 37 00 00       	call   3870 <printf>
+  if(mkdir("iputdir") < 0){
+     126:	c7 04 24 3b 40 00 00 	movl   $0x403b,(%esp)
+     12d:	e8 29 34 00 00       	call   355b <mkdir>
+     132:	83 c4 10             	add    $0x10,%esp
+     135:	85 c0                	test   %eax,%eax
+     137:	78 58                	js     191 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     139:	83 ec 0c             	sub    $0xc,%esp
+     13c:	68 3b 40 00 00       	push   $0x403b
+     141:	e8 1d 34 00 00       	call   3563 <chdir>
+     146:	83 c4 10             	add    $0x10,%esp
+     149:	85 c0                	test   %eax,%eax
+     14b:	0f 88 85 00 00 00    	js     1d6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     151:	83 ec 0c             	sub    $0xc,%esp
+     154:	68 38 40 00 00       	push   $0x4038
+     159:	e8 e5 33 00 00       	call   3543 <unlink>
+     15e:	83 c4 10             	add    $0x10,%esp
+     161:	85 c0                	test   %eax,%eax
+     163:	78 5a                	js     1bf <iputtest+0xaf>
+  if(chdir("/") < 0){
+     165:	83 ec 0c             	sub    $0xc,%esp
+     168:	68 5d 40 00 00       	push   $0x405d
+     16d:	e8 f1 33 00 00       	call   3563 <chdir>
+     172:	83 c4 10             	add    $0x10,%esp
+     175:	85 c0                	test   %eax,%eax
+     177:	78 2f                	js     1a8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     179:	83 ec 08             	sub    $0x8,%esp
+     17c:	68 e0 40 00 00       	push   $0x40e0
+     181:	ff 35 34 60 00 00    	push   0x6034
+     187:	e8 e4 36 00 00       	call   3870 <printf>
+}
+     18c:	83 c4 10             	add    $0x10,%esp
+     18f:	c9                   	leave
+     190:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     191:	50                   	push   %eax
+     192:	50                   	push   %eax
+     193:	68 14 40 00 00       	push   $0x4014
+     198:	ff 35 34 60 00 00    	push   0x6034
+     19e:	e8 cd 36 00 00       	call   3870 <printf>
+    exit();
+     1a3:	e8 d8 2f 00 00       	call   3180 <exit>
+    printf(stdout, "chdir / failed\n");
+     1a8:	50                   	push   %eax
+     1a9:	50                   	push   %eax
+     1aa:	68 5f 40 00 00       	push   $0x405f
+     1af:	ff 35 34 60 00 00    	push   0x6034
+     1b5:	e8 b6 36 00 00       	call   3870 <printf>
+    exit();
+     1ba:	e8 c1 2f 00 00       	call   3180 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1bf:	52                   	push   %edx
+     1c0:	52                   	push   %edx
+     1c1:	68 43 40 00 00       	push   $0x4043
+     1c6:	ff 35 34 60 00 00    	push   0x6034
+     1cc:	e8 9f 36 00 00       	call   3870 <printf>
+    exit();
+     1d1:	e8 aa 2f 00 00       	call   3180 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1d6:	51                   	push   %ecx
+     1d7:	51                   	push   %ecx
+     1d8:	68 22 40 00 00       	push   $0x4022
+     1dd:	ff 35 34 60 00 00    	push   0x6034
+     1e3:	e8 88 36 00 00       	call   3870 <printf>
+    exit();
+     1e8:	e8 93 2f 00 00       	call   3180 <exit>
+     1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <exitiputtest>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     1f6:	68 6f 40 00 00       	push   $0x406f
+     1fb:	ff 35 34 60 00 00    	push   0x6034
+     201:	e8 6a 36 00 00       	call   3870 <printf>
+  pid = fork();
+     206:	e8 45 2f 00 00       	call   3150 <fork>
+  if(pid < 0){
+     20b:	83 c4 10             	add    $0x10,%esp
+     20e:	85 c0                	test   %eax,%eax
+     210:	0f 88 8a 00 00 00    	js     2a0 <exitiputtest+0xb0>
+  if(pid == 0){
+     216:	75 50                	jne    268 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     218:	83 ec 0c             	sub    $0xc,%esp
+     21b:	68 3b 40 00 00       	push   $0x403b
+     220:	e8 36 33 00 00       	call   355b <mkdir>
+     225:	83 c4 10             	add    $0x10,%esp
+     228:	85 c0                	test   %eax,%eax
+     22a:	0f 88 87 00 00 00    	js     2b7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     230:	83 ec 0c             	sub    $0xc,%esp
+     233:	68 3b 40 00 00       	push   $0x403b
+     238:	e8 26 33 00 00       	call   3563 <chdir>
+     23d:	83 c4 10             	add    $0x10,%esp
+     240:	85 c0                	test   %eax,%eax
+     242:	0f 88 86 00 00 00    	js     2ce <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     248:	83 ec 0c             	sub    $0xc,%esp
+     24b:	68 38 40 00 00       	push   $0x4038
+     250:	e8 ee 32 00 00       	call   3543 <unlink>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	78 2c                	js     288 <exitiputtest+0x98>
+    exit();
+     25c:	e8 1f 2f 00 00       	call   3180 <exit>
+     261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     268:	e8 8e 32 00 00       	call   34fb <wait>
+  printf(stdout, "exitiput test ok\n");
+     26d:	83 ec 08             	sub    $0x8,%esp
+     270:	68 92 40 00 00       	push   $0x4092
+     275:	ff 35 34 60 00 00    	push   0x6034
+     27b:	e8 f0 35 00 00       	call   3870 <printf>
+}
+     280:	83 c4 10             	add    $0x10,%esp
+     283:	c9                   	leave
+     284:	c3                   	ret
+     285:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     288:	83 ec 08             	sub    $0x8,%esp
+     28b:	68 43 40 00 00       	push   $0x4043
+     290:	ff 35 34 60 00 00    	push   0x6034
+     296:	e8 d5 35 00 00       	call   3870 <printf>
+      exit();
+     29b:	e8 e0 2e 00 00       	call   3180 <exit>
+    printf(stdout, "fork failed\n");
+     2a0:	51                   	push   %ecx
+     2a1:	51                   	push   %ecx
+     2a2:	68 73 4e 00 00       	push   $0x4e73
+     2a7:	ff 35 34 60 00 00    	push   0x6034
+     2ad:	e8 be 35 00 00       	call   3870 <printf>
+    exit();
+     2b2:	e8 c9 2e 00 00       	call   3180 <exit>
+      printf(stdout, "mkdir failed\n");
+     2b7:	52                   	push   %edx
+     2b8:	52                   	push   %edx
+     2b9:	68 14 40 00 00       	push   $0x4014
+     2be:	ff 35 34 60 00 00    	push   0x6034
+     2c4:	e8 a7 35 00 00       	call   3870 <printf>
+      exit();
+     2c9:	e8 b2 2e 00 00       	call   3180 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ce:	50                   	push   %eax
+     2cf:	50                   	push   %eax
+     2d0:	68 7e 40 00 00       	push   $0x407e
+     2d5:	ff 35 34 60 00 00    	push   0x6034
+     2db:	e8 90 35 00 00       	call   3870 <printf>
+      exit();
+     2e0:	e8 9b 2e 00 00       	call   3180 <exit>
+     2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <openiputtest>:
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     2f6:	68 a4 40 00 00       	push   $0x40a4
+     2fb:	ff 35 34 60 00 00    	push   0x6034
+     301:	e8 6a 35 00 00       	call   3870 <printf>
+  if(mkdir("oidir") < 0){
+     306:	c7 04 24 b3 40 00 00 	movl   $0x40b3,(%esp)
+     30d:	e8 49 32 00 00       	call   355b <mkdir>
+     312:	83 c4 10             	add    $0x10,%esp
+     315:	85 c0                	test   %eax,%eax
+     317:	0f 88 9f 00 00 00    	js     3bc <openiputtest+0xcc>
+  pid = fork();
+     31d:	e8 2e 2e 00 00       	call   3150 <fork>
+  if(pid < 0){
+     322:	85 c0                	test   %eax,%eax
+     324:	78 7f                	js     3a5 <openiputtest+0xb5>
+  if(pid == 0){
+     326:	75 38                	jne    360 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     328:	83 ec 08             	sub    $0x8,%esp
+     32b:	6a 02                	push   $0x2
+     32d:	68 b3 40 00 00       	push   $0x40b3
+     332:	e8 fc 31 00 00       	call   3533 <open>
+    if(fd >= 0){
+     337:	83 c4 10             	add    $0x10,%esp
+     33a:	85 c0                	test   %eax,%eax
+     33c:	78 62                	js     3a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     33e:	83 ec 08             	sub    $0x8,%esp
+     341:	68 54 4f 00 00       	push   $0x4f54
+     346:	ff 35 34 60 00 00    	push   0x6034
+     34c:	e8 1f 35 00 00       	call   3870 <printf>
+      exit();
+     351:	e8 2a 2e 00 00       	call   3180 <exit>
+     356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     360:	83 ec 0c             	sub    $0xc,%esp
+     363:	6a 01                	push   $0x1
+     365:	e8 19 32 00 00       	call   3583 <sleep>
+  if(unlink("oidir") != 0){
+     36a:	c7 04 24 b3 40 00 00 	movl   $0x40b3,(%esp)
+     371:	e8 cd 31 00 00       	call   3543 <unlink>
+     376:	83 c4 10             	add    $0x10,%esp
+     379:	85 c0                	test   %eax,%eax
+     37b:	75 56                	jne    3d3 <openiputtest+0xe3>
+  wait();
+     37d:	e8 79 31 00 00       	call   34fb <wait>
+  printf(stdout, "openiput test ok\n");
+     382:	83 ec 08             	sub    $0x8,%esp
+     385:	68 dc 40 00 00       	push   $0x40dc
+     38a:	ff 35 34 60 00 00    	push   0x6034
+     390:	e8 db 34 00 00       	call   3870 <printf>
+}
+     395:	83 c4 10             	add    $0x10,%esp
+     398:	c9                   	leave
+     399:	c3                   	ret
+     39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3a0:	e8 db 2d 00 00       	call   3180 <exit>
+    printf(stdout, "fork failed\n");
+     3a5:	52                   	push   %edx
+     3a6:	52                   	push   %edx
+     3a7:	68 73 4e 00 00       	push   $0x4e73
+     3ac:	ff 35 34 60 00 00    	push   0x6034
+     3b2:	e8 b9 34 00 00       	call   3870 <printf>
+    exit();
+     3b7:	e8 c4 2d 00 00       	call   3180 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3bc:	51                   	push   %ecx
+     3bd:	51                   	push   %ecx
+     3be:	68 b9 40 00 00       	push   $0x40b9
+     3c3:	ff 35 34 60 00 00    	push   0x6034
+     3c9:	e8 a2 34 00 00       	call   3870 <printf>
+    exit();
+     3ce:	e8 ad 2d 00 00       	call   3180 <exit>
+    printf(stdout, "unlink failed\n");
+     3d3:	50                   	push   %eax
+     3d4:	50                   	push   %eax
+     3d5:	68 cd 40 00 00       	push   $0x40cd
+     3da:	ff 35 34 60 00 00    	push   0x6034
+     3e0:	e8 8b 34 00 00       	call   3870 <printf>
+    exit();
+     3e5:	e8 96 2d 00 00       	call   3180 <exit>
+     3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <opentest>:
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     3f6:	68 ee 40 00 00       	push   $0x40ee
+     3fb:	ff 35 34 60 00 00    	push   0x6034
+     401:	e8 6a 34 00 00       	call   3870 <printf>
+  fd = open("echo", 0);
+     406:	58                   	pop    %eax
+     407:	5a                   	pop    %edx
+     408:	6a 00                	push   $0x0
+     40a:	68 f9 40 00 00       	push   $0x40f9
+     40f:	e8 1f 31 00 00       	call   3533 <open>
+  if(fd < 0){
+     414:	83 c4 10             	add    $0x10,%esp
+     417:	85 c0                	test   %eax,%eax
+     419:	78 36                	js     451 <opentest+0x61>
+  close(fd);
+     41b:	83 ec 0c             	sub    $0xc,%esp
+     41e:	50                   	push   %eax
+     41f:	e8 f7 30 00 00       	call   351b <close>
+  fd = open("doesnotexist", 0);
+     424:	5a                   	pop    %edx
+     425:	59                   	pop    %ecx
+     426:	6a 00                	push   $0x0
+     428:	68 11 41 00 00       	push   $0x4111
+     42d:	e8 01 31 00 00       	call   3533 <open>
+  if(fd >= 0){
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	85 c0                	test   %eax,%eax
+     437:	79 2f                	jns    468 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     439:	83 ec 08             	sub    $0x8,%esp
+     43c:	68 3c 41 00 00       	push   $0x413c
+     441:	ff 35 34 60 00 00    	push   0x6034
+     447:	e8 24 34 00 00       	call   3870 <printf>
+}
+     44c:	83 c4 10             	add    $0x10,%esp
+     44f:	c9                   	leave
+     450:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     451:	50                   	push   %eax
+     452:	50                   	push   %eax
+     453:	68 fe 40 00 00       	push   $0x40fe
+     458:	ff 35 34 60 00 00    	push   0x6034
+     45e:	e8 0d 34 00 00       	call   3870 <printf>
+    exit();
+     463:	e8 18 2d 00 00       	call   3180 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     468:	50                   	push   %eax
+     469:	50                   	push   %eax
+     46a:	68 1e 41 00 00       	push   $0x411e
+     46f:	ff 35 34 60 00 00    	push   0x6034
+     475:	e8 f6 33 00 00       	call   3870 <printf>
+    exit();
+     47a:	e8 01 2d 00 00       	call   3180 <exit>
+     47f:	90                   	nop
+
+00000480 <writetest>:
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	56                   	push   %esi
+     484:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     485:	83 ec 08             	sub    $0x8,%esp
+     488:	68 4a 41 00 00       	push   $0x414a
+     48d:	ff 35 34 60 00 00    	push   0x6034
+     493:	e8 d8 33 00 00       	call   3870 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     498:	58                   	pop    %eax
+     499:	5a                   	pop    %edx
+     49a:	68 02 02 00 00       	push   $0x202
+     49f:	68 5b 41 00 00       	push   $0x415b
+     4a4:	e8 8a 30 00 00       	call   3533 <open>
+  if(fd >= 0){
+     4a9:	83 c4 10             	add    $0x10,%esp
+     4ac:	85 c0                	test   %eax,%eax
+     4ae:	0f 88 88 01 00 00    	js     63c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4b4:	83 ec 08             	sub    $0x8,%esp
+     4b7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4b9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4bb:	68 61 41 00 00       	push   $0x4161
+     4c0:	ff 35 34 60 00 00    	push   0x6034
+     4c6:	e8 a5 33 00 00       	call   3870 <printf>
+     4cb:	83 c4 10             	add    $0x10,%esp
+     4ce:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	6a 0a                	push   $0xa
+     4d5:	68 98 41 00 00       	push   $0x4198
+     4da:	56                   	push   %esi
+     4db:	e8 33 30 00 00       	call   3513 <write>
+     4e0:	83 c4 10             	add    $0x10,%esp
+     4e3:	83 f8 0a             	cmp    $0xa,%eax
+     4e6:	0f 85 d9 00 00 00    	jne    5c5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     4ec:	83 ec 04             	sub    $0x4,%esp
+     4ef:	6a 0a                	push   $0xa
+     4f1:	68 a3 41 00 00       	push   $0x41a3
+     4f6:	56                   	push   %esi
+     4f7:	e8 17 30 00 00       	call   3513 <write>
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	83 f8 0a             	cmp    $0xa,%eax
+     502:	0f 85 d6 00 00 00    	jne    5de <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     508:	83 c3 01             	add    $0x1,%ebx
+     50b:	83 fb 64             	cmp    $0x64,%ebx
+     50e:	75 c0                	jne    4d0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     510:	83 ec 08             	sub    $0x8,%esp
+     513:	68 ae 41 00 00       	push   $0x41ae
+     518:	ff 35 34 60 00 00    	push   0x6034
+     51e:	e8 4d 33 00 00       	call   3870 <printf>
+  close(fd);
+     523:	89 34 24             	mov    %esi,(%esp)
+     526:	e8 f0 2f 00 00       	call   351b <close>
+  fd = open("small", O_RDONLY);
+     52b:	5b                   	pop    %ebx
+     52c:	5e                   	pop    %esi
+     52d:	6a 00                	push   $0x0
+     52f:	68 5b 41 00 00       	push   $0x415b
+     534:	e8 fa 2f 00 00       	call   3533 <open>
+  if(fd >= 0){
+     539:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     53c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     53e:	85 c0                	test   %eax,%eax
+     540:	0f 88 b1 00 00 00    	js     5f7 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     546:	83 ec 08             	sub    $0x8,%esp
+     549:	68 b9 41 00 00       	push   $0x41b9
+     54e:	ff 35 34 60 00 00    	push   0x6034
+     554:	e8 17 33 00 00       	call   3870 <printf>
+  i = read(fd, buf, 2000);
+     559:	83 c4 0c             	add    $0xc,%esp
+     55c:	68 d0 07 00 00       	push   $0x7d0
+     561:	68 80 87 00 00       	push   $0x8780
+     566:	53                   	push   %ebx
+     567:	e8 9f 2f 00 00       	call   350b <read>
+  if(i == 2000){
+     56c:	83 c4 10             	add    $0x10,%esp
+     56f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     574:	0f 85 94 00 00 00    	jne    60e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     57a:	83 ec 08             	sub    $0x8,%esp
+     57d:	68 ed 41 00 00       	push   $0x41ed
+     582:	ff 35 34 60 00 00    	push   0x6034
+     588:	e8 e3 32 00 00       	call   3870 <printf>
+  close(fd);
+     58d:	89 1c 24             	mov    %ebx,(%esp)
+     590:	e8 86 2f 00 00       	call   351b <close>
+  if(unlink("small") < 0){
+     595:	c7 04 24 5b 41 00 00 	movl   $0x415b,(%esp)
+     59c:	e8 a2 2f 00 00       	call   3543 <unlink>
+     5a1:	83 c4 10             	add    $0x10,%esp
+     5a4:	85 c0                	test   %eax,%eax
+     5a6:	78 7d                	js     625 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5a8:	83 ec 08             	sub    $0x8,%esp
+     5ab:	68 15 42 00 00       	push   $0x4215
+     5b0:	ff 35 34 60 00 00    	push   0x6034
+     5b6:	e8 b5 32 00 00       	call   3870 <printf>
+}
+     5bb:	83 c4 10             	add    $0x10,%esp
+     5be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5c1:	5b                   	pop    %ebx
+     5c2:	5e                   	pop    %esi
+     5c3:	5d                   	pop    %ebp
+     5c4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5c5:	83 ec 04             	sub    $0x4,%esp
+     5c8:	53                   	push   %ebx
+     5c9:	68 78 4f 00 00       	push   $0x4f78
+     5ce:	ff 35 34 60 00 00    	push   0x6034
+     5d4:	e8 97 32 00 00       	call   3870 <printf>
+      exit();
+     5d9:	e8 a2 2b 00 00       	call   3180 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5de:	83 ec 04             	sub    $0x4,%esp
+     5e1:	53                   	push   %ebx
+     5e2:	68 9c 4f 00 00       	push   $0x4f9c
+     5e7:	ff 35 34 60 00 00    	push   0x6034
+     5ed:	e8 7e 32 00 00       	call   3870 <printf>
+      exit();
+     5f2:	e8 89 2b 00 00       	call   3180 <exit>
+    printf(stdout, "error: open small failed!\n");
+     5f7:	51                   	push   %ecx
+     5f8:	51                   	push   %ecx
+     5f9:	68 d2 41 00 00       	push   $0x41d2
+     5fe:	ff 35 34 60 00 00    	push   0x6034
+     604:	e8 67 32 00 00       	call   3870 <printf>
+    exit();
+     609:	e8 72 2b 00 00       	call   3180 <exit>
+    printf(stdout, "read failed\n");
+     60e:	52                   	push   %edx
+     60f:	52                   	push   %edx
+     610:	68 ed 44 00 00       	push   $0x44ed
+     615:	ff 35 34 60 00 00    	push   0x6034
+     61b:	e8 50 32 00 00       	call   3870 <printf>
+    exit();
+     620:	e8 5b 2b 00 00       	call   3180 <exit>
+    printf(stdout, "unlink small failed\n");
+     625:	50                   	push   %eax
+     626:	50                   	push   %eax
+     627:	68 00 42 00 00       	push   $0x4200
+     62c:	ff 35 34 60 00 00    	push   0x6034
+     632:	e8 39 32 00 00       	call   3870 <printf>
+    exit();
+     637:	e8 44 2b 00 00       	call   3180 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     63c:	50                   	push   %eax
+     63d:	50                   	push   %eax
+     63e:	68 7c 41 00 00       	push   $0x417c
+     643:	ff 35 34 60 00 00    	push   0x6034
+     649:	e8 22 32 00 00       	call   3870 <printf>
+    exit();
+     64e:	e8 2d 2b 00 00       	call   3180 <exit>
+     653:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000660 <writetest1>:
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	56                   	push   %esi
+     664:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     665:	83 ec 08             	sub    $0x8,%esp
+     668:	68 29 42 00 00       	push   $0x4229
+     66d:	ff 35 34 60 00 00    	push   0x6034
+     673:	e8 f8 31 00 00       	call   3870 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     678:	58                   	pop    %eax
+     679:	5a                   	pop    %edx
+     67a:	68 02 02 00 00       	push   $0x202
+     67f:	68 a3 42 00 00       	push   $0x42a3
+     684:	e8 aa 2e 00 00       	call   3533 <open>
+  if(fd < 0){
+     689:	83 c4 10             	add    $0x10,%esp
+     68c:	85 c0                	test   %eax,%eax
+     68e:	0f 88 61 01 00 00    	js     7f5 <writetest1+0x195>
+     694:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     696:	31 db                	xor    %ebx,%ebx
+     698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6a0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6a3:	89 1d 80 87 00 00    	mov    %ebx,0x8780
+    if(write(fd, buf, 512) != 512){
+     6a9:	68 00 02 00 00       	push   $0x200
+     6ae:	68 80 87 00 00       	push   $0x8780
+     6b3:	56                   	push   %esi
+     6b4:	e8 5a 2e 00 00       	call   3513 <write>
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6c1:	0f 85 b3 00 00 00    	jne    77a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6c7:	83 c3 01             	add    $0x1,%ebx
+     6ca:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     6d0:	75 ce                	jne    6a0 <writetest1+0x40>
+  close(fd);
+     6d2:	83 ec 0c             	sub    $0xc,%esp
+     6d5:	56                   	push   %esi
+     6d6:	e8 40 2e 00 00       	call   351b <close>
+  fd = open("big", O_RDONLY);
+     6db:	5b                   	pop    %ebx
+     6dc:	5e                   	pop    %esi
+     6dd:	6a 00                	push   $0x0
+     6df:	68 a3 42 00 00       	push   $0x42a3
+     6e4:	e8 4a 2e 00 00       	call   3533 <open>
+  if(fd < 0){
+     6e9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     6ec:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     6ee:	85 c0                	test   %eax,%eax
+     6f0:	0f 88 e8 00 00 00    	js     7de <writetest1+0x17e>
+  n = 0;
+     6f6:	31 f6                	xor    %esi,%esi
+     6f8:	eb 1d                	jmp    717 <writetest1+0xb7>
+     6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     700:	3d 00 02 00 00       	cmp    $0x200,%eax
+     705:	0f 85 9f 00 00 00    	jne    7aa <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     70b:	a1 80 87 00 00       	mov    0x8780,%eax
+     710:	39 f0                	cmp    %esi,%eax
+     712:	75 7f                	jne    793 <writetest1+0x133>
+    n++;
+     714:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     717:	83 ec 04             	sub    $0x4,%esp
+     71a:	68 00 02 00 00       	push   $0x200
+     71f:	68 80 87 00 00       	push   $0x8780
+     724:	53                   	push   %ebx
+     725:	e8 e1 2d 00 00       	call   350b <read>
+    if(i == 0){
+     72a:	83 c4 10             	add    $0x10,%esp
+     72d:	85 c0                	test   %eax,%eax
+     72f:	75 cf                	jne    700 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     731:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     737:	0f 84 86 00 00 00    	je     7c3 <writetest1+0x163>
+  close(fd);
+     73d:	83 ec 0c             	sub    $0xc,%esp
+     740:	53                   	push   %ebx
+     741:	e8 d5 2d 00 00       	call   351b <close>
+  if(unlink("big") < 0){
+     746:	c7 04 24 a3 42 00 00 	movl   $0x42a3,(%esp)
+     74d:	e8 f1 2d 00 00       	call   3543 <unlink>
+     752:	83 c4 10             	add    $0x10,%esp
+     755:	85 c0                	test   %eax,%eax
+     757:	0f 88 af 00 00 00    	js     80c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     75d:	83 ec 08             	sub    $0x8,%esp
+     760:	68 ca 42 00 00       	push   $0x42ca
+     765:	ff 35 34 60 00 00    	push   0x6034
+     76b:	e8 00 31 00 00       	call   3870 <printf>
+}
+     770:	83 c4 10             	add    $0x10,%esp
+     773:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     776:	5b                   	pop    %ebx
+     777:	5e                   	pop    %esi
+     778:	5d                   	pop    %ebp
+     779:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     77a:	83 ec 04             	sub    $0x4,%esp
+     77d:	53                   	push   %ebx
+     77e:	68 53 42 00 00       	push   $0x4253
+     783:	ff 35 34 60 00 00    	push   0x6034
+     789:	e8 e2 30 00 00       	call   3870 <printf>
+      exit();
+     78e:	e8 ed 29 00 00       	call   3180 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     793:	50                   	push   %eax
+     794:	56                   	push   %esi
+     795:	68 c0 4f 00 00       	push   $0x4fc0
+     79a:	ff 35 34 60 00 00    	push   0x6034
+     7a0:	e8 cb 30 00 00       	call   3870 <printf>
+      exit();
+     7a5:	e8 d6 29 00 00       	call   3180 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7aa:	83 ec 04             	sub    $0x4,%esp
+     7ad:	50                   	push   %eax
+     7ae:	68 a7 42 00 00       	push   $0x42a7
+     7b3:	ff 35 34 60 00 00    	push   0x6034
+     7b9:	e8 b2 30 00 00       	call   3870 <printf>
+      exit();
+     7be:	e8 bd 29 00 00       	call   3180 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7c3:	52                   	push   %edx
+     7c4:	68 8b 00 00 00       	push   $0x8b
+     7c9:	68 8a 42 00 00       	push   $0x428a
+     7ce:	ff 35 34 60 00 00    	push   0x6034
+     7d4:	e8 97 30 00 00       	call   3870 <printf>
+        exit();
+     7d9:	e8 a2 29 00 00       	call   3180 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7de:	51                   	push   %ecx
+     7df:	51                   	push   %ecx
+     7e0:	68 71 42 00 00       	push   $0x4271
+     7e5:	ff 35 34 60 00 00    	push   0x6034
+     7eb:	e8 80 30 00 00       	call   3870 <printf>
+    exit();
+     7f0:	e8 8b 29 00 00       	call   3180 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     7f5:	50                   	push   %eax
+     7f6:	50                   	push   %eax
+     7f7:	68 39 42 00 00       	push   $0x4239
+     7fc:	ff 35 34 60 00 00    	push   0x6034
+     802:	e8 69 30 00 00       	call   3870 <printf>
+    exit();
+     807:	e8 74 29 00 00       	call   3180 <exit>
+    printf(stdout, "unlink big failed\n");
+     80c:	50                   	push   %eax
+     80d:	50                   	push   %eax
+     80e:	68 b7 42 00 00       	push   $0x42b7
+     813:	ff 35 34 60 00 00    	push   0x6034
+     819:	e8 52 30 00 00       	call   3870 <printf>
+    exit();
+     81e:	e8 5d 29 00 00       	call   3180 <exit>
+     823:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000830 <createtest>:
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	53                   	push   %ebx
+  name[2] = '\0';
+     834:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     839:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     83c:	68 e0 4f 00 00       	push   $0x4fe0
+     841:	ff 35 34 60 00 00    	push   0x6034
+     847:	e8 24 30 00 00       	call   3870 <printf>
+  name[0] = 'a';
+     84c:	c6 05 70 87 00 00 61 	movb   $0x61,0x8770
+  name[2] = '\0';
+     853:	83 c4 10             	add    $0x10,%esp
+     856:	c6 05 72 87 00 00 00 	movb   $0x0,0x8772
+  for(i = 0; i < 52; i++){
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     860:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     863:	88 1d 71 87 00 00    	mov    %bl,0x8771
+  for(i = 0; i < 52; i++){
+     869:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     86c:	68 02 02 00 00       	push   $0x202
+     871:	68 70 87 00 00       	push   $0x8770
+     876:	e8 b8 2c 00 00       	call   3533 <open>
+    close(fd);
+     87b:	89 04 24             	mov    %eax,(%esp)
+     87e:	e8 98 2c 00 00       	call   351b <close>
+  for(i = 0; i < 52; i++){
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	80 fb 64             	cmp    $0x64,%bl
+     889:	75 d5                	jne    860 <createtest+0x30>
+  name[0] = 'a';
+     88b:	c6 05 70 87 00 00 61 	movb   $0x61,0x8770
+  name[2] = '\0';
+     892:	bb 30 00 00 00       	mov    $0x30,%ebx
+     897:	c6 05 72 87 00 00 00 	movb   $0x0,0x8772
+  for(i = 0; i < 52; i++){
+     89e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8a0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8a3:	88 1d 71 87 00 00    	mov    %bl,0x8771
+  for(i = 0; i < 52; i++){
+     8a9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8ac:	68 70 87 00 00       	push   $0x8770
+     8b1:	e8 8d 2c 00 00       	call   3543 <unlink>
+  for(i = 0; i < 52; i++){
+     8b6:	83 c4 10             	add    $0x10,%esp
+     8b9:	80 fb 64             	cmp    $0x64,%bl
+     8bc:	75 e2                	jne    8a0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8be:	83 ec 08             	sub    $0x8,%esp
+     8c1:	68 08 50 00 00       	push   $0x5008
+     8c6:	ff 35 34 60 00 00    	push   0x6034
+     8cc:	e8 9f 2f 00 00       	call   3870 <printf>
+}
+     8d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8d4:	83 c4 10             	add    $0x10,%esp
+     8d7:	c9                   	leave
+     8d8:	c3                   	ret
+     8d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <dirtest>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     8e6:	68 d8 42 00 00       	push   $0x42d8
+     8eb:	ff 35 34 60 00 00    	push   0x6034
+     8f1:	e8 7a 2f 00 00       	call   3870 <printf>
+  if(mkdir("dir0") < 0){
+     8f6:	c7 04 24 e4 42 00 00 	movl   $0x42e4,(%esp)
+     8fd:	e8 59 2c 00 00       	call   355b <mkdir>
+     902:	83 c4 10             	add    $0x10,%esp
+     905:	85 c0                	test   %eax,%eax
+     907:	78 58                	js     961 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     909:	83 ec 0c             	sub    $0xc,%esp
+     90c:	68 e4 42 00 00       	push   $0x42e4
+     911:	e8 4d 2c 00 00       	call   3563 <chdir>
+     916:	83 c4 10             	add    $0x10,%esp
+     919:	85 c0                	test   %eax,%eax
+     91b:	0f 88 85 00 00 00    	js     9a6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     921:	83 ec 0c             	sub    $0xc,%esp
+     924:	68 5d 48 00 00       	push   $0x485d
+     929:	e8 35 2c 00 00       	call   3563 <chdir>
+     92e:	83 c4 10             	add    $0x10,%esp
+     931:	85 c0                	test   %eax,%eax
+     933:	78 5a                	js     98f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	68 e4 42 00 00       	push   $0x42e4
+     93d:	e8 01 2c 00 00       	call   3543 <unlink>
+     942:	83 c4 10             	add    $0x10,%esp
+     945:	85 c0                	test   %eax,%eax
+     947:	78 2f                	js     978 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     949:	83 ec 08             	sub    $0x8,%esp
+     94c:	68 21 43 00 00       	push   $0x4321
+     951:	ff 35 34 60 00 00    	push   0x6034
+     957:	e8 14 2f 00 00       	call   3870 <printf>
+}
+     95c:	83 c4 10             	add    $0x10,%esp
+     95f:	c9                   	leave
+     960:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     961:	50                   	push   %eax
+     962:	50                   	push   %eax
+     963:	68 14 40 00 00       	push   $0x4014
+     968:	ff 35 34 60 00 00    	push   0x6034
+     96e:	e8 fd 2e 00 00       	call   3870 <printf>
+    exit();
+     973:	e8 08 28 00 00       	call   3180 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     978:	50                   	push   %eax
+     979:	50                   	push   %eax
+     97a:	68 0d 43 00 00       	push   $0x430d
+     97f:	ff 35 34 60 00 00    	push   0x6034
+     985:	e8 e6 2e 00 00       	call   3870 <printf>
+    exit();
+     98a:	e8 f1 27 00 00       	call   3180 <exit>
+    printf(stdout, "chdir .. failed\n");
+     98f:	52                   	push   %edx
+     990:	52                   	push   %edx
+     991:	68 fc 42 00 00       	push   $0x42fc
+     996:	ff 35 34 60 00 00    	push   0x6034
+     99c:	e8 cf 2e 00 00       	call   3870 <printf>
+    exit();
+     9a1:	e8 da 27 00 00       	call   3180 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9a6:	51                   	push   %ecx
+     9a7:	51                   	push   %ecx
+     9a8:	68 e9 42 00 00       	push   $0x42e9
+     9ad:	ff 35 34 60 00 00    	push   0x6034
+     9b3:	e8 b8 2e 00 00       	call   3870 <printf>
+    exit();
+     9b8:	e8 c3 27 00 00       	call   3180 <exit>
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <exectest>:
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9c6:	68 30 43 00 00       	push   $0x4330
+     9cb:	ff 35 34 60 00 00    	push   0x6034
+     9d1:	e8 9a 2e 00 00       	call   3870 <printf>
+  if(exec("echo", echoargv) < 0){
+     9d6:	5a                   	pop    %edx
+     9d7:	59                   	pop    %ecx
+     9d8:	68 38 60 00 00       	push   $0x6038
+     9dd:	68 f9 40 00 00       	push   $0x40f9
+     9e2:	e8 b9 27 00 00       	call   31a0 <exec>
+     9e7:	83 c4 10             	add    $0x10,%esp
+     9ea:	85 c0                	test   %eax,%eax
+     9ec:	78 02                	js     9f0 <exectest+0x30>
+}
+     9ee:	c9                   	leave
+     9ef:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     9f0:	50                   	push   %eax
+     9f1:	50                   	push   %eax
+     9f2:	68 3b 43 00 00       	push   $0x433b
+     9f7:	ff 35 34 60 00 00    	push   0x6034
+     9fd:	e8 6e 2e 00 00       	call   3870 <printf>
+    exit();
+     a02:	e8 79 27 00 00       	call   3180 <exit>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+
+00000a10 <pipe1>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	57                   	push   %edi
+     a14:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a18:	53                   	push   %ebx
+     a19:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a1c:	50                   	push   %eax
+     a1d:	e8 e1 2a 00 00       	call   3503 <pipe>
+     a22:	83 c4 10             	add    $0x10,%esp
+     a25:	85 c0                	test   %eax,%eax
+     a27:	0f 85 41 01 00 00    	jne    b6e <pipe1+0x15e>
+     a2d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a2f:	e8 1c 27 00 00       	call   3150 <fork>
+  if(pid == 0){
+     a34:	85 c0                	test   %eax,%eax
+     a36:	0f 84 92 00 00 00    	je     ace <pipe1+0xbe>
+  } else if(pid > 0){
+     a3c:	0f 8e 3f 01 00 00    	jle    b81 <pipe1+0x171>
+    close(fds[1]);
+     a42:	83 ec 0c             	sub    $0xc,%esp
+     a45:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a48:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a4a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a4f:	e8 c7 2a 00 00       	call   351b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a54:	83 c4 10             	add    $0x10,%esp
+     a57:	83 ec 04             	sub    $0x4,%esp
+     a5a:	57                   	push   %edi
+     a5b:	68 80 87 00 00       	push   $0x8780
+     a60:	ff 75 e0             	push   -0x20(%ebp)
+     a63:	e8 a3 2a 00 00       	call   350b <read>
+     a68:	83 c4 10             	add    $0x10,%esp
+     a6b:	89 c1                	mov    %eax,%ecx
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	0f 8e b8 00 00 00    	jle    b2d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a75:	89 f0                	mov    %esi,%eax
+     a77:	32 05 80 87 00 00    	xor    0x8780,%al
+     a7d:	0f b6 c0             	movzbl %al,%eax
+     a80:	85 c0                	test   %eax,%eax
+     a82:	75 30                	jne    ab4 <pipe1+0xa4>
+     a84:	83 c6 01             	add    $0x1,%esi
+     a87:	eb 0f                	jmp    a98 <pipe1+0x88>
+     a89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a90:	38 90 80 87 00 00    	cmp    %dl,0x8780(%eax)
+     a96:	75 1c                	jne    ab4 <pipe1+0xa4>
+     a98:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     a9b:	83 c0 01             	add    $0x1,%eax
+     a9e:	39 c1                	cmp    %eax,%ecx
+     aa0:	75 ee                	jne    a90 <pipe1+0x80>
+      cc = cc * 2;
+     aa2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     aa4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     aa9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     aab:	89 d6                	mov    %edx,%esi
+     aad:	39 c7                	cmp    %eax,%edi
+     aaf:	0f 4f f8             	cmovg  %eax,%edi
+     ab2:	eb a3                	jmp    a57 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ab4:	83 ec 08             	sub    $0x8,%esp
+     ab7:	68 6a 43 00 00       	push   $0x436a
+     abc:	6a 01                	push   $0x1
+     abe:	e8 ad 2d 00 00       	call   3870 <printf>
+     ac3:	83 c4 10             	add    $0x10,%esp
+}
+     ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac9:	5b                   	pop    %ebx
+     aca:	5e                   	pop    %esi
+     acb:	5f                   	pop    %edi
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+    close(fds[0]);
+     ace:	83 ec 0c             	sub    $0xc,%esp
+     ad1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     ad4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     ad6:	e8 40 2a 00 00       	call   351b <close>
+     adb:	83 c4 10             	add    $0x10,%esp
+     ade:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     ae0:	31 c0                	xor    %eax,%eax
+     ae2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     ae8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     aeb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     aee:	88 90 7f 87 00 00    	mov    %dl,0x877f(%eax)
+      for(i = 0; i < 1033; i++)
+     af4:	3d 09 04 00 00       	cmp    $0x409,%eax
+     af9:	75 ed                	jne    ae8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     afb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     afe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b04:	68 09 04 00 00       	push   $0x409
+     b09:	68 80 87 00 00       	push   $0x8780
+     b0e:	ff 75 e4             	push   -0x1c(%ebp)
+     b11:	e8 fd 29 00 00       	call   3513 <write>
+     b16:	83 c4 10             	add    $0x10,%esp
+     b19:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b1e:	75 74                	jne    b94 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b20:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b26:	75 b8                	jne    ae0 <pipe1+0xd0>
+    exit();
+     b28:	e8 53 26 00 00       	call   3180 <exit>
+    if(total != 5 * 1033){
+     b2d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b33:	75 26                	jne    b5b <pipe1+0x14b>
+    close(fds[0]);
+     b35:	83 ec 0c             	sub    $0xc,%esp
+     b38:	ff 75 e0             	push   -0x20(%ebp)
+     b3b:	e8 db 29 00 00       	call   351b <close>
+    wait();
+     b40:	e8 b6 29 00 00       	call   34fb <wait>
+  printf(1, "pipe1 ok\n");
+     b45:	5a                   	pop    %edx
+     b46:	59                   	pop    %ecx
+     b47:	68 8f 43 00 00       	push   $0x438f
+     b4c:	6a 01                	push   $0x1
+     b4e:	e8 1d 2d 00 00       	call   3870 <printf>
+     b53:	83 c4 10             	add    $0x10,%esp
+     b56:	e9 6b ff ff ff       	jmp    ac6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b5b:	56                   	push   %esi
+     b5c:	53                   	push   %ebx
+     b5d:	68 78 43 00 00       	push   $0x4378
+     b62:	6a 01                	push   $0x1
+     b64:	e8 07 2d 00 00       	call   3870 <printf>
+      exit();
+     b69:	e8 12 26 00 00       	call   3180 <exit>
+    printf(1, "pipe() failed\n");
+     b6e:	50                   	push   %eax
+     b6f:	50                   	push   %eax
+     b70:	68 4d 43 00 00       	push   $0x434d
+     b75:	6a 01                	push   $0x1
+     b77:	e8 f4 2c 00 00       	call   3870 <printf>
+    exit();
+     b7c:	e8 ff 25 00 00       	call   3180 <exit>
+    printf(1, "fork() failed\n");
+     b81:	50                   	push   %eax
+     b82:	50                   	push   %eax
+     b83:	68 99 43 00 00       	push   $0x4399
+     b88:	6a 01                	push   $0x1
+     b8a:	e8 e1 2c 00 00       	call   3870 <printf>
+    exit();
+     b8f:	e8 ec 25 00 00       	call   3180 <exit>
+        printf(1, "pipe1 oops 1\n");
+     b94:	57                   	push   %edi
+     b95:	57                   	push   %edi
+     b96:	68 5c 43 00 00       	push   $0x435c
+     b9b:	6a 01                	push   $0x1
+     b9d:	e8 ce 2c 00 00       	call   3870 <printf>
+        exit();
+     ba2:	e8 d9 25 00 00       	call   3180 <exit>
+     ba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <preempt>:
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bb9:	68 a8 43 00 00       	push   $0x43a8
+     bbe:	6a 01                	push   $0x1
+     bc0:	e8 ab 2c 00 00       	call   3870 <printf>
+  pid1 = fork();
+     bc5:	e8 86 25 00 00       	call   3150 <fork>
+  if(pid1 == 0)
+     bca:	83 c4 10             	add    $0x10,%esp
+     bcd:	85 c0                	test   %eax,%eax
+     bcf:	75 07                	jne    bd8 <preempt+0x28>
+    for(;;)
+     bd1:	eb fe                	jmp    bd1 <preempt+0x21>
+     bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bd7:	90                   	nop
+     bd8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bda:	e8 71 25 00 00       	call   3150 <fork>
+     bdf:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     be1:	85 c0                	test   %eax,%eax
+     be3:	75 0b                	jne    bf0 <preempt+0x40>
+    for(;;)
+     be5:	eb fe                	jmp    be5 <preempt+0x35>
+     be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     bf0:	83 ec 0c             	sub    $0xc,%esp
+     bf3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     bf6:	50                   	push   %eax
+     bf7:	e8 07 29 00 00       	call   3503 <pipe>
+  pid3 = fork();
+     bfc:	e8 4f 25 00 00       	call   3150 <fork>
+  if(pid3 == 0){
+     c01:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c04:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c06:	85 c0                	test   %eax,%eax
+     c08:	75 3e                	jne    c48 <preempt+0x98>
+    close(pfds[0]);
+     c0a:	83 ec 0c             	sub    $0xc,%esp
+     c0d:	ff 75 e0             	push   -0x20(%ebp)
+     c10:	e8 06 29 00 00       	call   351b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c15:	83 c4 0c             	add    $0xc,%esp
+     c18:	6a 01                	push   $0x1
+     c1a:	68 41 49 00 00       	push   $0x4941
+     c1f:	ff 75 e4             	push   -0x1c(%ebp)
+     c22:	e8 ec 28 00 00       	call   3513 <write>
+     c27:	83 c4 10             	add    $0x10,%esp
+     c2a:	83 f8 01             	cmp    $0x1,%eax
+     c2d:	0f 85 b8 00 00 00    	jne    ceb <preempt+0x13b>
+    close(pfds[1]);
+     c33:	83 ec 0c             	sub    $0xc,%esp
+     c36:	ff 75 e4             	push   -0x1c(%ebp)
+     c39:	e8 dd 28 00 00       	call   351b <close>
+     c3e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c41:	eb fe                	jmp    c41 <preempt+0x91>
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+  close(pfds[1]);
+     c48:	83 ec 0c             	sub    $0xc,%esp
+     c4b:	ff 75 e4             	push   -0x1c(%ebp)
+     c4e:	e8 c8 28 00 00       	call   351b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c53:	83 c4 0c             	add    $0xc,%esp
+     c56:	68 00 20 00 00       	push   $0x2000
+     c5b:	68 80 87 00 00       	push   $0x8780
+     c60:	ff 75 e0             	push   -0x20(%ebp)
+     c63:	e8 a3 28 00 00       	call   350b <read>
+     c68:	83 c4 10             	add    $0x10,%esp
+     c6b:	83 f8 01             	cmp    $0x1,%eax
+     c6e:	75 67                	jne    cd7 <preempt+0x127>
+  close(pfds[0]);
+     c70:	83 ec 0c             	sub    $0xc,%esp
+     c73:	ff 75 e0             	push   -0x20(%ebp)
+     c76:	e8 a0 28 00 00       	call   351b <close>
+  printf(1, "kill... ");
+     c7b:	58                   	pop    %eax
+     c7c:	5a                   	pop    %edx
+     c7d:	68 d9 43 00 00       	push   $0x43d9
+     c82:	6a 01                	push   $0x1
+     c84:	e8 e7 2b 00 00       	call   3870 <printf>
+  kill(pid1);
+     c89:	89 1c 24             	mov    %ebx,(%esp)
+     c8c:	e8 92 28 00 00       	call   3523 <kill>
+  kill(pid2);
+     c91:	89 34 24             	mov    %esi,(%esp)
+     c94:	e8 8a 28 00 00       	call   3523 <kill>
+  kill(pid3);
+     c99:	89 3c 24             	mov    %edi,(%esp)
+     c9c:	e8 82 28 00 00       	call   3523 <kill>
+  printf(1, "wait... ");
+     ca1:	59                   	pop    %ecx
+     ca2:	5b                   	pop    %ebx
+     ca3:	68 e2 43 00 00       	push   $0x43e2
+     ca8:	6a 01                	push   $0x1
+     caa:	e8 c1 2b 00 00       	call   3870 <printf>
+  wait();
+     caf:	e8 47 28 00 00       	call   34fb <wait>
+  wait();
+     cb4:	e8 42 28 00 00       	call   34fb <wait>
+  wait();
+     cb9:	e8 3d 28 00 00       	call   34fb <wait>
+  printf(1, "preempt ok\n");
+     cbe:	5e                   	pop    %esi
+     cbf:	5f                   	pop    %edi
+     cc0:	68 eb 43 00 00       	push   $0x43eb
+     cc5:	6a 01                	push   $0x1
+     cc7:	e8 a4 2b 00 00       	call   3870 <printf>
+     ccc:	83 c4 10             	add    $0x10,%esp
+}
+     ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cd2:	5b                   	pop    %ebx
+     cd3:	5e                   	pop    %esi
+     cd4:	5f                   	pop    %edi
+     cd5:	5d                   	pop    %ebp
+     cd6:	c3                   	ret
+    printf(1, "preempt read error");
+     cd7:	83 ec 08             	sub    $0x8,%esp
+     cda:	68 c6 43 00 00       	push   $0x43c6
+     cdf:	6a 01                	push   $0x1
+     ce1:	e8 8a 2b 00 00       	call   3870 <printf>
+     ce6:	83 c4 10             	add    $0x10,%esp
+     ce9:	eb e4                	jmp    ccf <preempt+0x11f>
+      printf(1, "preempt write error");
+     ceb:	83 ec 08             	sub    $0x8,%esp
+     cee:	68 b2 43 00 00       	push   $0x43b2
+     cf3:	6a 01                	push   $0x1
+     cf5:	e8 76 2b 00 00       	call   3870 <printf>
+     cfa:	83 c4 10             	add    $0x10,%esp
+     cfd:	e9 31 ff ff ff       	jmp    c33 <preempt+0x83>
+     d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <exitwait>:
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	56                   	push   %esi
+     d14:	be 64 00 00 00       	mov    $0x64,%esi
+     d19:	53                   	push   %ebx
+     d1a:	eb 14                	jmp    d30 <exitwait+0x20>
+     d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d20:	74 68                	je     d8a <exitwait+0x7a>
+      if(wait() != pid){
+     d22:	e8 d4 27 00 00       	call   34fb <wait>
+     d27:	39 d8                	cmp    %ebx,%eax
+     d29:	75 2d                	jne    d58 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d2b:	83 ee 01             	sub    $0x1,%esi
+     d2e:	74 41                	je     d71 <exitwait+0x61>
+    pid = fork();
+     d30:	e8 1b 24 00 00       	call   3150 <fork>
+     d35:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d37:	85 c0                	test   %eax,%eax
+     d39:	79 e5                	jns    d20 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d3b:	83 ec 08             	sub    $0x8,%esp
+     d3e:	68 73 4e 00 00       	push   $0x4e73
+     d43:	6a 01                	push   $0x1
+     d45:	e8 26 2b 00 00       	call   3870 <printf>
+      return;
+     d4a:	83 c4 10             	add    $0x10,%esp
+}
+     d4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d50:	5b                   	pop    %ebx
+     d51:	5e                   	pop    %esi
+     d52:	5d                   	pop    %ebp
+     d53:	c3                   	ret
+     d54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d58:	83 ec 08             	sub    $0x8,%esp
+     d5b:	68 f7 43 00 00       	push   $0x43f7
+     d60:	6a 01                	push   $0x1
+     d62:	e8 09 2b 00 00       	call   3870 <printf>
+        return;
+     d67:	83 c4 10             	add    $0x10,%esp
+}
+     d6a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5d                   	pop    %ebp
+     d70:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d71:	83 ec 08             	sub    $0x8,%esp
+     d74:	68 07 44 00 00       	push   $0x4407
+     d79:	6a 01                	push   $0x1
+     d7b:	e8 f0 2a 00 00       	call   3870 <printf>
+     d80:	83 c4 10             	add    $0x10,%esp
+}
+     d83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d86:	5b                   	pop    %ebx
+     d87:	5e                   	pop    %esi
+     d88:	5d                   	pop    %ebp
+     d89:	c3                   	ret
+      exit();
+     d8a:	e8 f1 23 00 00       	call   3180 <exit>
+     d8f:	90                   	nop
+
+00000d90 <sharedfd>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     d99:	68 14 44 00 00       	push   $0x4414
+     d9e:	6a 01                	push   $0x1
+     da0:	e8 cb 2a 00 00       	call   3870 <printf>
+  unlink("sharedfd");
+     da5:	c7 04 24 23 44 00 00 	movl   $0x4423,(%esp)
+     dac:	e8 92 27 00 00       	call   3543 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     db1:	5b                   	pop    %ebx
+     db2:	5e                   	pop    %esi
+     db3:	68 02 02 00 00       	push   $0x202
+     db8:	68 23 44 00 00       	push   $0x4423
+     dbd:	e8 71 27 00 00       	call   3533 <open>
+  if(fd < 0){
+     dc2:	83 c4 10             	add    $0x10,%esp
+     dc5:	85 c0                	test   %eax,%eax
+     dc7:	0f 88 2a 01 00 00    	js     ef7 <sharedfd+0x167>
+     dcd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     dcf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     dd2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     dd7:	e8 74 23 00 00       	call   3150 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ddc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     ddf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     de2:	19 c0                	sbb    %eax,%eax
+     de4:	83 ec 04             	sub    $0x4,%esp
+     de7:	83 e0 f3             	and    $0xfffffff3,%eax
+     dea:	6a 0a                	push   $0xa
+     dec:	83 c0 70             	add    $0x70,%eax
+     def:	50                   	push   %eax
+     df0:	56                   	push   %esi
+     df1:	e8 da 24 00 00       	call   32d0 <memset>
+     df6:	83 c4 10             	add    $0x10,%esp
+     df9:	eb 0a                	jmp    e05 <sharedfd+0x75>
+     dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dff:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     e00:	83 eb 01             	sub    $0x1,%ebx
+     e03:	74 26                	je     e2b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     e05:	83 ec 04             	sub    $0x4,%esp
+     e08:	6a 0a                	push   $0xa
+     e0a:	56                   	push   %esi
+     e0b:	57                   	push   %edi
+     e0c:	e8 02 27 00 00       	call   3513 <write>
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	83 f8 0a             	cmp    $0xa,%eax
+     e17:	74 e7                	je     e00 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     e19:	83 ec 08             	sub    $0x8,%esp
+     e1c:	68 5c 50 00 00       	push   $0x505c
+     e21:	6a 01                	push   $0x1
+     e23:	e8 48 2a 00 00       	call   3870 <printf>
+      break;
+     e28:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     e2b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     e2e:	85 c9                	test   %ecx,%ecx
+     e30:	0f 84 f5 00 00 00    	je     f2b <sharedfd+0x19b>
+    wait();
+     e36:	e8 c0 26 00 00       	call   34fb <wait>
+  close(fd);
+     e3b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     e3e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     e40:	57                   	push   %edi
+     e41:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     e44:	e8 d2 26 00 00       	call   351b <close>
+  fd = open("sharedfd", 0);
+     e49:	58                   	pop    %eax
+     e4a:	5a                   	pop    %edx
+     e4b:	6a 00                	push   $0x0
+     e4d:	68 23 44 00 00       	push   $0x4423
+     e52:	e8 dc 26 00 00       	call   3533 <open>
+  if(fd < 0){
+     e57:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     e5a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     e5c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     e5f:	85 c0                	test   %eax,%eax
+     e61:	0f 88 aa 00 00 00    	js     f11 <sharedfd+0x181>
+     e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     e70:	83 ec 04             	sub    $0x4,%esp
+     e73:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     e76:	6a 0a                	push   $0xa
+     e78:	56                   	push   %esi
+     e79:	ff 75 d0             	push   -0x30(%ebp)
+     e7c:	e8 8a 26 00 00       	call   350b <read>
+     e81:	83 c4 10             	add    $0x10,%esp
+     e84:	85 c0                	test   %eax,%eax
+     e86:	7e 28                	jle    eb0 <sharedfd+0x120>
+     e88:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     e8b:	89 f0                	mov    %esi,%eax
+     e8d:	eb 13                	jmp    ea2 <sharedfd+0x112>
+     e8f:	90                   	nop
+        np++;
+     e90:	80 f9 70             	cmp    $0x70,%cl
+     e93:	0f 94 c1             	sete   %cl
+     e96:	0f b6 c9             	movzbl %cl,%ecx
+     e99:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     e9b:	83 c0 01             	add    $0x1,%eax
+     e9e:	39 f8                	cmp    %edi,%eax
+     ea0:	74 ce                	je     e70 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     ea2:	0f b6 08             	movzbl (%eax),%ecx
+     ea5:	80 f9 63             	cmp    $0x63,%cl
+     ea8:	75 e6                	jne    e90 <sharedfd+0x100>
+        nc++;
+     eaa:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     ead:	eb ec                	jmp    e9b <sharedfd+0x10b>
+     eaf:	90                   	nop
+  close(fd);
+     eb0:	83 ec 0c             	sub    $0xc,%esp
+     eb3:	ff 75 d0             	push   -0x30(%ebp)
+     eb6:	e8 60 26 00 00       	call   351b <close>
+  unlink("sharedfd");
+     ebb:	c7 04 24 23 44 00 00 	movl   $0x4423,(%esp)
+     ec2:	e8 7c 26 00 00       	call   3543 <unlink>
+  if(nc == 10000 && np == 10000){
+     ec7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     eca:	83 c4 10             	add    $0x10,%esp
+     ecd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     ed3:	75 5b                	jne    f30 <sharedfd+0x1a0>
+     ed5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     edb:	75 53                	jne    f30 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     edd:	83 ec 08             	sub    $0x8,%esp
+     ee0:	68 2c 44 00 00       	push   $0x442c
+     ee5:	6a 01                	push   $0x1
+     ee7:	e8 84 29 00 00       	call   3870 <printf>
+     eec:	83 c4 10             	add    $0x10,%esp
+}
+     eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ef2:	5b                   	pop    %ebx
+     ef3:	5e                   	pop    %esi
+     ef4:	5f                   	pop    %edi
+     ef5:	5d                   	pop    %ebp
+     ef6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     ef7:	83 ec 08             	sub    $0x8,%esp
+     efa:	68 30 50 00 00       	push   $0x5030
+     eff:	6a 01                	push   $0x1
+     f01:	e8 6a 29 00 00       	call   3870 <printf>
+    return;
+     f06:	83 c4 10             	add    $0x10,%esp
+}
+     f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f0c:	5b                   	pop    %ebx
+     f0d:	5e                   	pop    %esi
+     f0e:	5f                   	pop    %edi
+     f0f:	5d                   	pop    %ebp
+     f10:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     f11:	83 ec 08             	sub    $0x8,%esp
+     f14:	68 7c 50 00 00       	push   $0x507c
+     f19:	6a 01                	push   $0x1
+     f1b:	e8 50 29 00 00       	call   3870 <printf>
+    return;
+     f20:	83 c4 10             	add    $0x10,%esp
+}
+     f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f26:	5b                   	pop    %ebx
+     f27:	5e                   	pop    %esi
+     f28:	5f                   	pop    %edi
+     f29:	5d                   	pop    %ebp
+     f2a:	c3                   	ret
+    exit();
+     f2b:	e8 50 22 00 00       	call   3180 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     f30:	53                   	push   %ebx
+     f31:	52                   	push   %edx
+     f32:	68 39 44 00 00       	push   $0x4439
+     f37:	6a 01                	push   $0x1
+     f39:	e8 32 29 00 00       	call   3870 <printf>
+    exit();
+     f3e:	e8 3d 22 00 00       	call   3180 <exit>
+     f43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f50 <fourfiles>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+     f56:	31 db                	xor    %ebx,%ebx
+{
+     f58:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     f5b:	c7 45 d8 4e 44 00 00 	movl   $0x444e,-0x28(%ebp)
+     f62:	c7 45 dc 97 45 00 00 	movl   $0x4597,-0x24(%ebp)
+     f69:	c7 45 e0 9b 45 00 00 	movl   $0x459b,-0x20(%ebp)
+     f70:	c7 45 e4 51 44 00 00 	movl   $0x4451,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+     f77:	68 54 44 00 00       	push   $0x4454
+     f7c:	6a 01                	push   $0x1
+     f7e:	e8 ed 28 00 00       	call   3870 <printf>
+     f83:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+     f86:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+     f8a:	83 ec 0c             	sub    $0xc,%esp
+     f8d:	56                   	push   %esi
+     f8e:	e8 b0 25 00 00       	call   3543 <unlink>
+    pid = fork();
+     f93:	e8 b8 21 00 00       	call   3150 <fork>
+    if(pid < 0){
+     f98:	83 c4 10             	add    $0x10,%esp
+     f9b:	85 c0                	test   %eax,%eax
+     f9d:	0f 88 65 01 00 00    	js     1108 <fourfiles+0x1b8>
+    if(pid == 0){
+     fa3:	0f 84 eb 00 00 00    	je     1094 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+     fa9:	83 c3 01             	add    $0x1,%ebx
+     fac:	83 fb 04             	cmp    $0x4,%ebx
+     faf:	75 d5                	jne    f86 <fourfiles+0x36>
+    wait();
+     fb1:	e8 45 25 00 00       	call   34fb <wait>
+  for(i = 0; i < 2; i++){
+     fb6:	31 f6                	xor    %esi,%esi
+    wait();
+     fb8:	e8 3e 25 00 00       	call   34fb <wait>
+     fbd:	e8 39 25 00 00       	call   34fb <wait>
+     fc2:	e8 34 25 00 00       	call   34fb <wait>
+    fname = names[i];
+     fc7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+     fcb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+     fce:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+     fd0:	6a 00                	push   $0x0
+     fd2:	53                   	push   %ebx
+     fd3:	e8 5b 25 00 00       	call   3533 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fd8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     fdb:	83 c4 10             	add    $0x10,%esp
+     fde:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     fe1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fe8:	83 ec 04             	sub    $0x4,%esp
+     feb:	68 00 20 00 00       	push   $0x2000
+     ff0:	68 80 87 00 00       	push   $0x8780
+     ff5:	ff 75 d4             	push   -0x2c(%ebp)
+     ff8:	e8 0e 25 00 00       	call   350b <read>
+     ffd:	83 c4 10             	add    $0x10,%esp
+    1000:	89 c3                	mov    %eax,%ebx
+    1002:	85 c0                	test   %eax,%eax
+    1004:	7e 28                	jle    102e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1006:	31 c0                	xor    %eax,%eax
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1010:	83 fe 01             	cmp    $0x1,%esi
+    1013:	0f be 88 80 87 00 00 	movsbl 0x8780(%eax),%ecx
+    101a:	19 d2                	sbb    %edx,%edx
+    101c:	83 c2 31             	add    $0x31,%edx
+    101f:	39 d1                	cmp    %edx,%ecx
+    1021:	75 5d                	jne    1080 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1023:	83 c0 01             	add    $0x1,%eax
+    1026:	39 c3                	cmp    %eax,%ebx
+    1028:	75 e6                	jne    1010 <fourfiles+0xc0>
+      total += n;
+    102a:	01 df                	add    %ebx,%edi
+    102c:	eb ba                	jmp    fe8 <fourfiles+0x98>
+    close(fd);
+    102e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1031:	83 ec 0c             	sub    $0xc,%esp
+    1034:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1037:	51                   	push   %ecx
+    1038:	e8 de 24 00 00       	call   351b <close>
+    if(total != 12*500){
+    103d:	83 c4 10             	add    $0x10,%esp
+    1040:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1046:	0f 85 d0 00 00 00    	jne    111c <fourfiles+0x1cc>
+    unlink(fname);
+    104c:	83 ec 0c             	sub    $0xc,%esp
+    104f:	53                   	push   %ebx
+    1050:	e8 ee 24 00 00       	call   3543 <unlink>
+  for(i = 0; i < 2; i++){
+    1055:	83 c4 10             	add    $0x10,%esp
+    1058:	85 f6                	test   %esi,%esi
+    105a:	75 0a                	jne    1066 <fourfiles+0x116>
+    105c:	be 01 00 00 00       	mov    $0x1,%esi
+    1061:	e9 61 ff ff ff       	jmp    fc7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1066:	83 ec 08             	sub    $0x8,%esp
+    1069:	68 92 44 00 00       	push   $0x4492
+    106e:	6a 01                	push   $0x1
+    1070:	e8 fb 27 00 00       	call   3870 <printf>
+}
+    1075:	83 c4 10             	add    $0x10,%esp
+    1078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    107b:	5b                   	pop    %ebx
+    107c:	5e                   	pop    %esi
+    107d:	5f                   	pop    %edi
+    107e:	5d                   	pop    %ebp
+    107f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1080:	83 ec 08             	sub    $0x8,%esp
+    1083:	68 75 44 00 00       	push   $0x4475
+    1088:	6a 01                	push   $0x1
+    108a:	e8 e1 27 00 00       	call   3870 <printf>
+          exit();
+    108f:	e8 ec 20 00 00       	call   3180 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1094:	83 ec 08             	sub    $0x8,%esp
+    1097:	68 02 02 00 00       	push   $0x202
+    109c:	56                   	push   %esi
+    109d:	e8 91 24 00 00       	call   3533 <open>
+      if(fd < 0){
+    10a2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    10a5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    10a7:	85 c0                	test   %eax,%eax
+    10a9:	78 45                	js     10f0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    10ab:	83 ec 04             	sub    $0x4,%esp
+    10ae:	83 c3 30             	add    $0x30,%ebx
+    10b1:	68 00 02 00 00       	push   $0x200
+    10b6:	53                   	push   %ebx
+    10b7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    10bc:	68 80 87 00 00       	push   $0x8780
+    10c1:	e8 0a 22 00 00       	call   32d0 <memset>
+    10c6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    10c9:	83 ec 04             	sub    $0x4,%esp
+    10cc:	68 f4 01 00 00       	push   $0x1f4
+    10d1:	68 80 87 00 00       	push   $0x8780
+    10d6:	56                   	push   %esi
+    10d7:	e8 37 24 00 00       	call   3513 <write>
+    10dc:	83 c4 10             	add    $0x10,%esp
+    10df:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    10e4:	75 49                	jne    112f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    10e6:	83 eb 01             	sub    $0x1,%ebx
+    10e9:	75 de                	jne    10c9 <fourfiles+0x179>
+      exit();
+    10eb:	e8 90 20 00 00       	call   3180 <exit>
+        printf(1, "create failed\n");
+    10f0:	51                   	push   %ecx
+    10f1:	51                   	push   %ecx
+    10f2:	68 ef 46 00 00       	push   $0x46ef
+    10f7:	6a 01                	push   $0x1
+    10f9:	e8 72 27 00 00       	call   3870 <printf>
+        exit();
+    10fe:	e8 7d 20 00 00       	call   3180 <exit>
+    1103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1107:	90                   	nop
+      printf(1, "fork failed\n");
+    1108:	83 ec 08             	sub    $0x8,%esp
+    110b:	68 73 4e 00 00       	push   $0x4e73
+    1110:	6a 01                	push   $0x1
+    1112:	e8 59 27 00 00       	call   3870 <printf>
+      exit();
+    1117:	e8 64 20 00 00       	call   3180 <exit>
+      printf(1, "wrong length %d\n", total);
+    111c:	50                   	push   %eax
+    111d:	57                   	push   %edi
+    111e:	68 81 44 00 00       	push   $0x4481
+    1123:	6a 01                	push   $0x1
+    1125:	e8 46 27 00 00       	call   3870 <printf>
+      exit();
+    112a:	e8 51 20 00 00       	call   3180 <exit>
+          printf(1, "write failed %d\n", n);
+    112f:	52                   	push   %edx
+    1130:	50                   	push   %eax
+    1131:	68 64 44 00 00       	push   $0x4464
+    1136:	6a 01                	push   $0x1
+    1138:	e8 33 27 00 00       	call   3870 <printf>
+          exit();
+    113d:	e8 3e 20 00 00       	call   3180 <exit>
+    1142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <createdelete>:
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1155:	31 f6                	xor    %esi,%esi
+{
+    1157:	53                   	push   %ebx
+    1158:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    115b:	68 a0 44 00 00       	push   $0x44a0
+    1160:	6a 01                	push   $0x1
+    1162:	e8 09 27 00 00       	call   3870 <printf>
+    1167:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    116a:	e8 e1 1f 00 00       	call   3150 <fork>
+    116f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1171:	85 c0                	test   %eax,%eax
+    1173:	0f 88 ac 01 00 00    	js     1325 <createdelete+0x1d5>
+    if(pid == 0){
+    1179:	0f 84 01 01 00 00    	je     1280 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    117f:	83 c6 01             	add    $0x1,%esi
+    1182:	83 fe 04             	cmp    $0x4,%esi
+    1185:	75 e3                	jne    116a <createdelete+0x1a>
+    wait();
+    1187:	e8 6f 23 00 00       	call   34fb <wait>
+  for(i = 0; i < N; i++){
+    118c:	31 ff                	xor    %edi,%edi
+    118e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1191:	e8 65 23 00 00       	call   34fb <wait>
+    1196:	e8 60 23 00 00       	call   34fb <wait>
+    119b:	e8 5b 23 00 00       	call   34fb <wait>
+  name[0] = name[1] = name[2] = 0;
+    11a0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    11a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    11a8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    11aa:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    11ad:	bb 70 00 00 00       	mov    $0x70,%ebx
+    11b2:	0f 94 c2             	sete   %dl
+    11b5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    11b8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    11bb:	0f 9f c0             	setg   %al
+    11be:	09 c2                	or     %eax,%edx
+    11c0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    11c3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    11c7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    11ca:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    11cd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    11d0:	6a 00                	push   $0x0
+    11d2:	56                   	push   %esi
+    11d3:	e8 5b 23 00 00       	call   3533 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    11d8:	83 c4 10             	add    $0x10,%esp
+    11db:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    11df:	74 7f                	je     1260 <createdelete+0x110>
+    11e1:	85 c0                	test   %eax,%eax
+    11e3:	0f 88 27 01 00 00    	js     1310 <createdelete+0x1c0>
+        close(fd);
+    11e9:	83 ec 0c             	sub    $0xc,%esp
+    11ec:	50                   	push   %eax
+    11ed:	e8 29 23 00 00       	call   351b <close>
+    11f2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    11f5:	83 c3 01             	add    $0x1,%ebx
+    11f8:	80 fb 74             	cmp    $0x74,%bl
+    11fb:	75 c6                	jne    11c3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    11fd:	83 c7 01             	add    $0x1,%edi
+    1200:	83 ff 14             	cmp    $0x14,%edi
+    1203:	75 a3                	jne    11a8 <createdelete+0x58>
+    1205:	bf 70 00 00 00       	mov    $0x70,%edi
+    120a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1210:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1213:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1218:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    121b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    121d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1220:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1223:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1227:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    122a:	56                   	push   %esi
+    122b:	e8 13 23 00 00       	call   3543 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1230:	83 c4 10             	add    $0x10,%esp
+    1233:	83 eb 01             	sub    $0x1,%ebx
+    1236:	75 e3                	jne    121b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1238:	83 c7 01             	add    $0x1,%edi
+    123b:	89 f8                	mov    %edi,%eax
+    123d:	3c 84                	cmp    $0x84,%al
+    123f:	75 cf                	jne    1210 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1241:	83 ec 08             	sub    $0x8,%esp
+    1244:	68 b3 44 00 00       	push   $0x44b3
+    1249:	6a 01                	push   $0x1
+    124b:	e8 20 26 00 00       	call   3870 <printf>
+}
+    1250:	83 c4 10             	add    $0x10,%esp
+    1253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1256:	5b                   	pop    %ebx
+    1257:	5e                   	pop    %esi
+    1258:	5f                   	pop    %edi
+    1259:	5d                   	pop    %ebp
+    125a:	c3                   	ret
+    125b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    125f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1260:	85 c0                	test   %eax,%eax
+    1262:	78 91                	js     11f5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1264:	50                   	push   %eax
+    1265:	56                   	push   %esi
+    1266:	68 cc 50 00 00       	push   $0x50cc
+    126b:	6a 01                	push   $0x1
+    126d:	e8 fe 25 00 00       	call   3870 <printf>
+        exit();
+    1272:	e8 09 1f 00 00       	call   3180 <exit>
+    1277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    127e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1280:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1283:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1287:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    128a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1290:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1293:	8d 43 30             	lea    0x30(%ebx),%eax
+    1296:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1299:	68 02 02 00 00       	push   $0x202
+    129e:	56                   	push   %esi
+    129f:	e8 8f 22 00 00       	call   3533 <open>
+        if(fd < 0){
+    12a4:	83 c4 10             	add    $0x10,%esp
+    12a7:	85 c0                	test   %eax,%eax
+    12a9:	0f 88 8a 00 00 00    	js     1339 <createdelete+0x1e9>
+        close(fd);
+    12af:	83 ec 0c             	sub    $0xc,%esp
+    12b2:	50                   	push   %eax
+    12b3:	e8 63 22 00 00       	call   351b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    12b8:	83 c4 10             	add    $0x10,%esp
+    12bb:	85 db                	test   %ebx,%ebx
+    12bd:	74 19                	je     12d8 <createdelete+0x188>
+    12bf:	f6 c3 01             	test   $0x1,%bl
+    12c2:	74 1b                	je     12df <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    12c4:	83 c3 01             	add    $0x1,%ebx
+    12c7:	83 fb 14             	cmp    $0x14,%ebx
+    12ca:	75 c4                	jne    1290 <createdelete+0x140>
+      exit();
+    12cc:	e8 af 1e 00 00       	call   3180 <exit>
+    12d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    12d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    12dd:	eb b1                	jmp    1290 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    12df:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    12e1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    12e4:	d1 f8                	sar    %eax
+    12e6:	83 c0 30             	add    $0x30,%eax
+    12e9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    12ec:	56                   	push   %esi
+    12ed:	e8 51 22 00 00       	call   3543 <unlink>
+    12f2:	83 c4 10             	add    $0x10,%esp
+    12f5:	85 c0                	test   %eax,%eax
+    12f7:	79 cb                	jns    12c4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    12f9:	52                   	push   %edx
+    12fa:	52                   	push   %edx
+    12fb:	68 cd 40 00 00       	push   $0x40cd
+    1300:	6a 01                	push   $0x1
+    1302:	e8 69 25 00 00       	call   3870 <printf>
+            exit();
+    1307:	e8 74 1e 00 00       	call   3180 <exit>
+    130c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1310:	83 ec 04             	sub    $0x4,%esp
+    1313:	56                   	push   %esi
+    1314:	68 a8 50 00 00       	push   $0x50a8
+    1319:	6a 01                	push   $0x1
+    131b:	e8 50 25 00 00       	call   3870 <printf>
+        exit();
+    1320:	e8 5b 1e 00 00       	call   3180 <exit>
+      printf(1, "fork failed\n");
+    1325:	83 ec 08             	sub    $0x8,%esp
+    1328:	68 73 4e 00 00       	push   $0x4e73
+    132d:	6a 01                	push   $0x1
+    132f:	e8 3c 25 00 00       	call   3870 <printf>
+      exit();
+    1334:	e8 47 1e 00 00       	call   3180 <exit>
+          printf(1, "create failed\n");
+    1339:	83 ec 08             	sub    $0x8,%esp
+    133c:	68 ef 46 00 00       	push   $0x46ef
+    1341:	6a 01                	push   $0x1
+    1343:	e8 28 25 00 00       	call   3870 <printf>
+          exit();
+    1348:	e8 33 1e 00 00       	call   3180 <exit>
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001350 <unlinkread>:
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	56                   	push   %esi
+    1354:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1355:	83 ec 08             	sub    $0x8,%esp
+    1358:	68 c4 44 00 00       	push   $0x44c4
+    135d:	6a 01                	push   $0x1
+    135f:	e8 0c 25 00 00       	call   3870 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1364:	5b                   	pop    %ebx
+    1365:	5e                   	pop    %esi
+    1366:	68 02 02 00 00       	push   $0x202
+    136b:	68 d5 44 00 00       	push   $0x44d5
+    1370:	e8 be 21 00 00       	call   3533 <open>
+  if(fd < 0){
+    1375:	83 c4 10             	add    $0x10,%esp
+    1378:	85 c0                	test   %eax,%eax
+    137a:	0f 88 e6 00 00 00    	js     1466 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1380:	83 ec 04             	sub    $0x4,%esp
+    1383:	89 c3                	mov    %eax,%ebx
+    1385:	6a 05                	push   $0x5
+    1387:	68 fa 44 00 00       	push   $0x44fa
+    138c:	50                   	push   %eax
+    138d:	e8 81 21 00 00       	call   3513 <write>
+  close(fd);
+    1392:	89 1c 24             	mov    %ebx,(%esp)
+    1395:	e8 81 21 00 00       	call   351b <close>
+  fd = open("unlinkread", O_RDWR);
+    139a:	58                   	pop    %eax
+    139b:	5a                   	pop    %edx
+    139c:	6a 02                	push   $0x2
+    139e:	68 d5 44 00 00       	push   $0x44d5
+    13a3:	e8 8b 21 00 00       	call   3533 <open>
+  if(fd < 0){
+    13a8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    13ab:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    13ad:	85 c0                	test   %eax,%eax
+    13af:	0f 88 10 01 00 00    	js     14c5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    13b5:	83 ec 0c             	sub    $0xc,%esp
+    13b8:	68 d5 44 00 00       	push   $0x44d5
+    13bd:	e8 81 21 00 00       	call   3543 <unlink>
+    13c2:	83 c4 10             	add    $0x10,%esp
+    13c5:	85 c0                	test   %eax,%eax
+    13c7:	0f 85 e5 00 00 00    	jne    14b2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    13cd:	83 ec 08             	sub    $0x8,%esp
+    13d0:	68 02 02 00 00       	push   $0x202
+    13d5:	68 d5 44 00 00       	push   $0x44d5
+    13da:	e8 54 21 00 00       	call   3533 <open>
+  write(fd1, "yyy", 3);
+    13df:	83 c4 0c             	add    $0xc,%esp
+    13e2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    13e4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    13e6:	68 32 45 00 00       	push   $0x4532
+    13eb:	50                   	push   %eax
+    13ec:	e8 22 21 00 00       	call   3513 <write>
+  close(fd1);
+    13f1:	89 34 24             	mov    %esi,(%esp)
+    13f4:	e8 22 21 00 00       	call   351b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    13f9:	83 c4 0c             	add    $0xc,%esp
+    13fc:	68 00 20 00 00       	push   $0x2000
+    1401:	68 80 87 00 00       	push   $0x8780
+    1406:	53                   	push   %ebx
+    1407:	e8 ff 20 00 00       	call   350b <read>
+    140c:	83 c4 10             	add    $0x10,%esp
+    140f:	83 f8 05             	cmp    $0x5,%eax
+    1412:	0f 85 87 00 00 00    	jne    149f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1418:	80 3d 80 87 00 00 68 	cmpb   $0x68,0x8780
+    141f:	75 6b                	jne    148c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1421:	83 ec 04             	sub    $0x4,%esp
+    1424:	6a 0a                	push   $0xa
+    1426:	68 80 87 00 00       	push   $0x8780
+    142b:	53                   	push   %ebx
+    142c:	e8 e2 20 00 00       	call   3513 <write>
+    1431:	83 c4 10             	add    $0x10,%esp
+    1434:	83 f8 0a             	cmp    $0xa,%eax
+    1437:	75 40                	jne    1479 <unlinkread+0x129>
+  close(fd);
+    1439:	83 ec 0c             	sub    $0xc,%esp
+    143c:	53                   	push   %ebx
+    143d:	e8 d9 20 00 00       	call   351b <close>
+  unlink("unlinkread");
+    1442:	c7 04 24 d5 44 00 00 	movl   $0x44d5,(%esp)
+    1449:	e8 f5 20 00 00       	call   3543 <unlink>
+  printf(1, "unlinkread ok\n");
+    144e:	58                   	pop    %eax
+    144f:	5a                   	pop    %edx
+    1450:	68 7d 45 00 00       	push   $0x457d
+    1455:	6a 01                	push   $0x1
+    1457:	e8 14 24 00 00       	call   3870 <printf>
+}
+    145c:	83 c4 10             	add    $0x10,%esp
+    145f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1462:	5b                   	pop    %ebx
+    1463:	5e                   	pop    %esi
+    1464:	5d                   	pop    %ebp
+    1465:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1466:	51                   	push   %ecx
+    1467:	51                   	push   %ecx
+    1468:	68 e0 44 00 00       	push   $0x44e0
+    146d:	6a 01                	push   $0x1
+    146f:	e8 fc 23 00 00       	call   3870 <printf>
+    exit();
+    1474:	e8 07 1d 00 00       	call   3180 <exit>
+    printf(1, "unlinkread write failed\n");
+    1479:	51                   	push   %ecx
+    147a:	51                   	push   %ecx
+    147b:	68 64 45 00 00       	push   $0x4564
+    1480:	6a 01                	push   $0x1
+    1482:	e8 e9 23 00 00       	call   3870 <printf>
+    exit();
+    1487:	e8 f4 1c 00 00       	call   3180 <exit>
+    printf(1, "unlinkread wrong data\n");
+    148c:	53                   	push   %ebx
+    148d:	53                   	push   %ebx
+    148e:	68 4d 45 00 00       	push   $0x454d
+    1493:	6a 01                	push   $0x1
+    1495:	e8 d6 23 00 00       	call   3870 <printf>
+    exit();
+    149a:	e8 e1 1c 00 00       	call   3180 <exit>
+    printf(1, "unlinkread read failed");
+    149f:	56                   	push   %esi
+    14a0:	56                   	push   %esi
+    14a1:	68 36 45 00 00       	push   $0x4536
+    14a6:	6a 01                	push   $0x1
+    14a8:	e8 c3 23 00 00       	call   3870 <printf>
+    exit();
+    14ad:	e8 ce 1c 00 00       	call   3180 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    14b2:	50                   	push   %eax
+    14b3:	50                   	push   %eax
+    14b4:	68 18 45 00 00       	push   $0x4518
+    14b9:	6a 01                	push   $0x1
+    14bb:	e8 b0 23 00 00       	call   3870 <printf>
+    exit();
+    14c0:	e8 bb 1c 00 00       	call   3180 <exit>
+    printf(1, "open unlinkread failed\n");
+    14c5:	50                   	push   %eax
+    14c6:	50                   	push   %eax
+    14c7:	68 00 45 00 00       	push   $0x4500
+    14cc:	6a 01                	push   $0x1
+    14ce:	e8 9d 23 00 00       	call   3870 <printf>
+    exit();
+    14d3:	e8 a8 1c 00 00       	call   3180 <exit>
+    14d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14df:	90                   	nop
+
+000014e0 <linktest>:
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	53                   	push   %ebx
+    14e4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    14e7:	68 8c 45 00 00       	push   $0x458c
+    14ec:	6a 01                	push   $0x1
+    14ee:	e8 7d 23 00 00       	call   3870 <printf>
+  unlink("lf1");
+    14f3:	c7 04 24 96 45 00 00 	movl   $0x4596,(%esp)
+    14fa:	e8 44 20 00 00       	call   3543 <unlink>
+  unlink("lf2");
+    14ff:	c7 04 24 9a 45 00 00 	movl   $0x459a,(%esp)
+    1506:	e8 38 20 00 00       	call   3543 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    150b:	58                   	pop    %eax
+    150c:	5a                   	pop    %edx
+    150d:	68 02 02 00 00       	push   $0x202
+    1512:	68 96 45 00 00       	push   $0x4596
+    1517:	e8 17 20 00 00       	call   3533 <open>
+  if(fd < 0){
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	85 c0                	test   %eax,%eax
+    1521:	0f 88 1e 01 00 00    	js     1645 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1527:	83 ec 04             	sub    $0x4,%esp
+    152a:	89 c3                	mov    %eax,%ebx
+    152c:	6a 05                	push   $0x5
+    152e:	68 fa 44 00 00       	push   $0x44fa
+    1533:	50                   	push   %eax
+    1534:	e8 da 1f 00 00       	call   3513 <write>
+    1539:	83 c4 10             	add    $0x10,%esp
+    153c:	83 f8 05             	cmp    $0x5,%eax
+    153f:	0f 85 98 01 00 00    	jne    16dd <linktest+0x1fd>
+  close(fd);
+    1545:	83 ec 0c             	sub    $0xc,%esp
+    1548:	53                   	push   %ebx
+    1549:	e8 cd 1f 00 00       	call   351b <close>
+  if(link("lf1", "lf2") < 0){
+    154e:	5b                   	pop    %ebx
+    154f:	58                   	pop    %eax
+    1550:	68 9a 45 00 00       	push   $0x459a
+    1555:	68 96 45 00 00       	push   $0x4596
+    155a:	e8 f4 1f 00 00       	call   3553 <link>
+    155f:	83 c4 10             	add    $0x10,%esp
+    1562:	85 c0                	test   %eax,%eax
+    1564:	0f 88 60 01 00 00    	js     16ca <linktest+0x1ea>
+  unlink("lf1");
+    156a:	83 ec 0c             	sub    $0xc,%esp
+    156d:	68 96 45 00 00       	push   $0x4596
+    1572:	e8 cc 1f 00 00       	call   3543 <unlink>
+  if(open("lf1", 0) >= 0){
+    1577:	58                   	pop    %eax
+    1578:	5a                   	pop    %edx
+    1579:	6a 00                	push   $0x0
+    157b:	68 96 45 00 00       	push   $0x4596
+    1580:	e8 ae 1f 00 00       	call   3533 <open>
+    1585:	83 c4 10             	add    $0x10,%esp
+    1588:	85 c0                	test   %eax,%eax
+    158a:	0f 89 27 01 00 00    	jns    16b7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1590:	83 ec 08             	sub    $0x8,%esp
+    1593:	6a 00                	push   $0x0
+    1595:	68 9a 45 00 00       	push   $0x459a
+    159a:	e8 94 1f 00 00       	call   3533 <open>
+  if(fd < 0){
+    159f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    15a2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    15a4:	85 c0                	test   %eax,%eax
+    15a6:	0f 88 f8 00 00 00    	js     16a4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    15ac:	83 ec 04             	sub    $0x4,%esp
+    15af:	68 00 20 00 00       	push   $0x2000
+    15b4:	68 80 87 00 00       	push   $0x8780
+    15b9:	50                   	push   %eax
+    15ba:	e8 4c 1f 00 00       	call   350b <read>
+    15bf:	83 c4 10             	add    $0x10,%esp
+    15c2:	83 f8 05             	cmp    $0x5,%eax
+    15c5:	0f 85 c6 00 00 00    	jne    1691 <linktest+0x1b1>
+  close(fd);
+    15cb:	83 ec 0c             	sub    $0xc,%esp
+    15ce:	53                   	push   %ebx
+    15cf:	e8 47 1f 00 00       	call   351b <close>
+  if(link("lf2", "lf2") >= 0){
+    15d4:	58                   	pop    %eax
+    15d5:	5a                   	pop    %edx
+    15d6:	68 9a 45 00 00       	push   $0x459a
+    15db:	68 9a 45 00 00       	push   $0x459a
+    15e0:	e8 6e 1f 00 00       	call   3553 <link>
+    15e5:	83 c4 10             	add    $0x10,%esp
+    15e8:	85 c0                	test   %eax,%eax
+    15ea:	0f 89 8e 00 00 00    	jns    167e <linktest+0x19e>
+  unlink("lf2");
+    15f0:	83 ec 0c             	sub    $0xc,%esp
+    15f3:	68 9a 45 00 00       	push   $0x459a
+    15f8:	e8 46 1f 00 00       	call   3543 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    15fd:	59                   	pop    %ecx
+    15fe:	5b                   	pop    %ebx
+    15ff:	68 96 45 00 00       	push   $0x4596
+    1604:	68 9a 45 00 00       	push   $0x459a
+    1609:	e8 45 1f 00 00       	call   3553 <link>
+    160e:	83 c4 10             	add    $0x10,%esp
+    1611:	85 c0                	test   %eax,%eax
+    1613:	79 56                	jns    166b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1615:	83 ec 08             	sub    $0x8,%esp
+    1618:	68 96 45 00 00       	push   $0x4596
+    161d:	68 5e 48 00 00       	push   $0x485e
+    1622:	e8 2c 1f 00 00       	call   3553 <link>
+    1627:	83 c4 10             	add    $0x10,%esp
+    162a:	85 c0                	test   %eax,%eax
+    162c:	79 2a                	jns    1658 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    162e:	83 ec 08             	sub    $0x8,%esp
+    1631:	68 34 46 00 00       	push   $0x4634
+    1636:	6a 01                	push   $0x1
+    1638:	e8 33 22 00 00       	call   3870 <printf>
+}
+    163d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1640:	83 c4 10             	add    $0x10,%esp
+    1643:	c9                   	leave
+    1644:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1645:	50                   	push   %eax
+    1646:	50                   	push   %eax
+    1647:	68 9e 45 00 00       	push   $0x459e
+    164c:	6a 01                	push   $0x1
+    164e:	e8 1d 22 00 00       	call   3870 <printf>
+    exit();
+    1653:	e8 28 1b 00 00       	call   3180 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1658:	50                   	push   %eax
+    1659:	50                   	push   %eax
+    165a:	68 18 46 00 00       	push   $0x4618
+    165f:	6a 01                	push   $0x1
+    1661:	e8 0a 22 00 00       	call   3870 <printf>
+    exit();
+    1666:	e8 15 1b 00 00       	call   3180 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    166b:	52                   	push   %edx
+    166c:	52                   	push   %edx
+    166d:	68 14 51 00 00       	push   $0x5114
+    1672:	6a 01                	push   $0x1
+    1674:	e8 f7 21 00 00       	call   3870 <printf>
+    exit();
+    1679:	e8 02 1b 00 00       	call   3180 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    167e:	50                   	push   %eax
+    167f:	50                   	push   %eax
+    1680:	68 fa 45 00 00       	push   $0x45fa
+    1685:	6a 01                	push   $0x1
+    1687:	e8 e4 21 00 00       	call   3870 <printf>
+    exit();
+    168c:	e8 ef 1a 00 00       	call   3180 <exit>
+    printf(1, "read lf2 failed\n");
+    1691:	51                   	push   %ecx
+    1692:	51                   	push   %ecx
+    1693:	68 e9 45 00 00       	push   $0x45e9
+    1698:	6a 01                	push   $0x1
+    169a:	e8 d1 21 00 00       	call   3870 <printf>
+    exit();
+    169f:	e8 dc 1a 00 00       	call   3180 <exit>
+    printf(1, "open lf2 failed\n");
+    16a4:	53                   	push   %ebx
+    16a5:	53                   	push   %ebx
+    16a6:	68 d8 45 00 00       	push   $0x45d8
+    16ab:	6a 01                	push   $0x1
+    16ad:	e8 be 21 00 00       	call   3870 <printf>
+    exit();
+    16b2:	e8 c9 1a 00 00       	call   3180 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    16b7:	50                   	push   %eax
+    16b8:	50                   	push   %eax
+    16b9:	68 ec 50 00 00       	push   $0x50ec
+    16be:	6a 01                	push   $0x1
+    16c0:	e8 ab 21 00 00       	call   3870 <printf>
+    exit();
+    16c5:	e8 b6 1a 00 00       	call   3180 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    16ca:	51                   	push   %ecx
+    16cb:	51                   	push   %ecx
+    16cc:	68 c3 45 00 00       	push   $0x45c3
+    16d1:	6a 01                	push   $0x1
+    16d3:	e8 98 21 00 00       	call   3870 <printf>
+    exit();
+    16d8:	e8 a3 1a 00 00       	call   3180 <exit>
+    printf(1, "write lf1 failed\n");
+    16dd:	50                   	push   %eax
+    16de:	50                   	push   %eax
+    16df:	68 b1 45 00 00       	push   $0x45b1
+    16e4:	6a 01                	push   $0x1
+    16e6:	e8 85 21 00 00       	call   3870 <printf>
+    exit();
+    16eb:	e8 90 1a 00 00       	call   3180 <exit>
+
+000016f0 <concreate>:
+{
+    16f0:	55                   	push   %ebp
+    16f1:	89 e5                	mov    %esp,%ebp
+    16f3:	57                   	push   %edi
+    16f4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    16f5:	31 f6                	xor    %esi,%esi
+{
+    16f7:	53                   	push   %ebx
+    16f8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    16fb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    16fe:	68 41 46 00 00       	push   $0x4641
+    1703:	6a 01                	push   $0x1
+    1705:	e8 66 21 00 00       	call   3870 <printf>
+  file[0] = 'C';
+    170a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    170e:	83 c4 10             	add    $0x10,%esp
+    1711:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1715:	eb 4c                	jmp    1763 <concreate+0x73>
+    1717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171e:	66 90                	xchg   %ax,%ax
+    1720:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1726:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    172b:	0f 83 8f 00 00 00    	jae    17c0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1731:	83 ec 08             	sub    $0x8,%esp
+    1734:	68 02 02 00 00       	push   $0x202
+    1739:	53                   	push   %ebx
+    173a:	e8 f4 1d 00 00       	call   3533 <open>
+      if(fd < 0){
+    173f:	83 c4 10             	add    $0x10,%esp
+    1742:	85 c0                	test   %eax,%eax
+    1744:	78 63                	js     17a9 <concreate+0xb9>
+      close(fd);
+    1746:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1749:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    174c:	50                   	push   %eax
+    174d:	e8 c9 1d 00 00       	call   351b <close>
+    1752:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1755:	e8 a1 1d 00 00       	call   34fb <wait>
+  for(i = 0; i < 40; i++){
+    175a:	83 fe 28             	cmp    $0x28,%esi
+    175d:	0f 84 7f 00 00 00    	je     17e2 <concreate+0xf2>
+    unlink(file);
+    1763:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1766:	8d 46 30             	lea    0x30(%esi),%eax
+    1769:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    176c:	53                   	push   %ebx
+    176d:	e8 d1 1d 00 00       	call   3543 <unlink>
+    pid = fork();
+    1772:	e8 d9 19 00 00       	call   3150 <fork>
+    if(pid && (i % 3) == 1){
+    1777:	83 c4 10             	add    $0x10,%esp
+    177a:	85 c0                	test   %eax,%eax
+    177c:	75 a2                	jne    1720 <concreate+0x30>
+      link("C0", file);
+    177e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1784:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    178a:	0f 83 d0 00 00 00    	jae    1860 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1790:	83 ec 08             	sub    $0x8,%esp
+    1793:	68 02 02 00 00       	push   $0x202
+    1798:	53                   	push   %ebx
+    1799:	e8 95 1d 00 00       	call   3533 <open>
+      if(fd < 0){
+    179e:	83 c4 10             	add    $0x10,%esp
+    17a1:	85 c0                	test   %eax,%eax
+    17a3:	0f 89 ea 01 00 00    	jns    1993 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    17a9:	83 ec 04             	sub    $0x4,%esp
+    17ac:	53                   	push   %ebx
+    17ad:	68 54 46 00 00       	push   $0x4654
+    17b2:	6a 01                	push   $0x1
+    17b4:	e8 b7 20 00 00       	call   3870 <printf>
+        exit();
+    17b9:	e8 c2 19 00 00       	call   3180 <exit>
+    17be:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    17c0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    17c3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    17c6:	53                   	push   %ebx
+    17c7:	68 51 46 00 00       	push   $0x4651
+    17cc:	e8 82 1d 00 00       	call   3553 <link>
+    17d1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    17d4:	e8 22 1d 00 00       	call   34fb <wait>
+  for(i = 0; i < 40; i++){
+    17d9:	83 fe 28             	cmp    $0x28,%esi
+    17dc:	0f 85 81 ff ff ff    	jne    1763 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    17e2:	83 ec 04             	sub    $0x4,%esp
+    17e5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    17e8:	6a 28                	push   $0x28
+    17ea:	6a 00                	push   $0x0
+    17ec:	50                   	push   %eax
+    17ed:	e8 de 1a 00 00       	call   32d0 <memset>
+  fd = open(".", 0);
+    17f2:	5e                   	pop    %esi
+    17f3:	5f                   	pop    %edi
+    17f4:	6a 00                	push   $0x0
+    17f6:	68 5e 48 00 00       	push   $0x485e
+    17fb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    17fe:	e8 30 1d 00 00       	call   3533 <open>
+  n = 0;
+    1803:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    180a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    180d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    180f:	90                   	nop
+    1810:	83 ec 04             	sub    $0x4,%esp
+    1813:	6a 10                	push   $0x10
+    1815:	57                   	push   %edi
+    1816:	56                   	push   %esi
+    1817:	e8 ef 1c 00 00       	call   350b <read>
+    181c:	83 c4 10             	add    $0x10,%esp
+    181f:	85 c0                	test   %eax,%eax
+    1821:	7e 5d                	jle    1880 <concreate+0x190>
+    if(de.inum == 0)
+    1823:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1828:	74 e6                	je     1810 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    182a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    182e:	75 e0                	jne    1810 <concreate+0x120>
+    1830:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1834:	75 da                	jne    1810 <concreate+0x120>
+      i = de.name[1] - '0';
+    1836:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    183a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    183d:	83 f8 27             	cmp    $0x27,%eax
+    1840:	0f 87 5e 01 00 00    	ja     19a4 <concreate+0x2b4>
+      if(fa[i]){
+    1846:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    184b:	0f 85 7e 01 00 00    	jne    19cf <concreate+0x2df>
+      n++;
+    1851:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1855:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    185a:	eb b4                	jmp    1810 <concreate+0x120>
+    185c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1860:	83 ec 08             	sub    $0x8,%esp
+    1863:	53                   	push   %ebx
+    1864:	68 51 46 00 00       	push   $0x4651
+    1869:	e8 e5 1c 00 00       	call   3553 <link>
+    186e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1871:	e8 0a 19 00 00       	call   3180 <exit>
+    1876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1880:	83 ec 0c             	sub    $0xc,%esp
+    1883:	56                   	push   %esi
+    1884:	e8 92 1c 00 00       	call   351b <close>
+  if(n != 40){
+    1889:	83 c4 10             	add    $0x10,%esp
+    188c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1890:	0f 85 26 01 00 00    	jne    19bc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1896:	31 f6                	xor    %esi,%esi
+    1898:	eb 48                	jmp    18e2 <concreate+0x1f2>
+    189a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    18a0:	85 ff                	test   %edi,%edi
+    18a2:	74 05                	je     18a9 <concreate+0x1b9>
+    18a4:	83 f8 01             	cmp    $0x1,%eax
+    18a7:	74 68                	je     1911 <concreate+0x221>
+      unlink(file);
+    18a9:	83 ec 0c             	sub    $0xc,%esp
+    18ac:	53                   	push   %ebx
+    18ad:	e8 91 1c 00 00       	call   3543 <unlink>
+      unlink(file);
+    18b2:	89 1c 24             	mov    %ebx,(%esp)
+    18b5:	e8 89 1c 00 00       	call   3543 <unlink>
+      unlink(file);
+    18ba:	89 1c 24             	mov    %ebx,(%esp)
+    18bd:	e8 81 1c 00 00       	call   3543 <unlink>
+      unlink(file);
+    18c2:	89 1c 24             	mov    %ebx,(%esp)
+    18c5:	e8 79 1c 00 00       	call   3543 <unlink>
+    18ca:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    18cd:	85 ff                	test   %edi,%edi
+    18cf:	74 a0                	je     1871 <concreate+0x181>
+      wait();
+    18d1:	e8 25 1c 00 00       	call   34fb <wait>
+  for(i = 0; i < 40; i++){
+    18d6:	83 c6 01             	add    $0x1,%esi
+    18d9:	83 fe 28             	cmp    $0x28,%esi
+    18dc:	0f 84 86 00 00 00    	je     1968 <concreate+0x278>
+    file[1] = '0' + i;
+    18e2:	8d 46 30             	lea    0x30(%esi),%eax
+    18e5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    18e8:	e8 63 18 00 00       	call   3150 <fork>
+    18ed:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    18ef:	85 c0                	test   %eax,%eax
+    18f1:	0f 88 88 00 00 00    	js     197f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    18f7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    18fc:	f7 e6                	mul    %esi
+    18fe:	89 d0                	mov    %edx,%eax
+    1900:	83 e2 fe             	and    $0xfffffffe,%edx
+    1903:	d1 e8                	shr    %eax
+    1905:	01 c2                	add    %eax,%edx
+    1907:	89 f0                	mov    %esi,%eax
+    1909:	29 d0                	sub    %edx,%eax
+    190b:	89 c1                	mov    %eax,%ecx
+    190d:	09 f9                	or     %edi,%ecx
+    190f:	75 8f                	jne    18a0 <concreate+0x1b0>
+      close(open(file, 0));
+    1911:	83 ec 08             	sub    $0x8,%esp
+    1914:	6a 00                	push   $0x0
+    1916:	53                   	push   %ebx
+    1917:	e8 17 1c 00 00       	call   3533 <open>
+    191c:	89 04 24             	mov    %eax,(%esp)
+    191f:	e8 f7 1b 00 00       	call   351b <close>
+      close(open(file, 0));
+    1924:	58                   	pop    %eax
+    1925:	5a                   	pop    %edx
+    1926:	6a 00                	push   $0x0
+    1928:	53                   	push   %ebx
+    1929:	e8 05 1c 00 00       	call   3533 <open>
+    192e:	89 04 24             	mov    %eax,(%esp)
+    1931:	e8 e5 1b 00 00       	call   351b <close>
+      close(open(file, 0));
+    1936:	59                   	pop    %ecx
+    1937:	58                   	pop    %eax
+    1938:	6a 00                	push   $0x0
+    193a:	53                   	push   %ebx
+    193b:	e8 f3 1b 00 00       	call   3533 <open>
+    1940:	89 04 24             	mov    %eax,(%esp)
+    1943:	e8 d3 1b 00 00       	call   351b <close>
+      close(open(file, 0));
+    1948:	58                   	pop    %eax
+    1949:	5a                   	pop    %edx
+    194a:	6a 00                	push   $0x0
+    194c:	53                   	push   %ebx
+    194d:	e8 e1 1b 00 00       	call   3533 <open>
+    1952:	89 04 24             	mov    %eax,(%esp)
+    1955:	e8 c1 1b 00 00       	call   351b <close>
+    195a:	83 c4 10             	add    $0x10,%esp
+    195d:	e9 6b ff ff ff       	jmp    18cd <concreate+0x1dd>
+    1962:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1968:	83 ec 08             	sub    $0x8,%esp
+    196b:	68 a6 46 00 00       	push   $0x46a6
+    1970:	6a 01                	push   $0x1
+    1972:	e8 f9 1e 00 00       	call   3870 <printf>
+}
+    1977:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    197a:	5b                   	pop    %ebx
+    197b:	5e                   	pop    %esi
+    197c:	5f                   	pop    %edi
+    197d:	5d                   	pop    %ebp
+    197e:	c3                   	ret
+      printf(1, "fork failed\n");
+    197f:	83 ec 08             	sub    $0x8,%esp
+    1982:	68 73 4e 00 00       	push   $0x4e73
+    1987:	6a 01                	push   $0x1
+    1989:	e8 e2 1e 00 00       	call   3870 <printf>
+      exit();
+    198e:	e8 ed 17 00 00       	call   3180 <exit>
+      close(fd);
+    1993:	83 ec 0c             	sub    $0xc,%esp
+    1996:	50                   	push   %eax
+    1997:	e8 7f 1b 00 00       	call   351b <close>
+    199c:	83 c4 10             	add    $0x10,%esp
+    199f:	e9 cd fe ff ff       	jmp    1871 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    19a4:	83 ec 04             	sub    $0x4,%esp
+    19a7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    19aa:	50                   	push   %eax
+    19ab:	68 70 46 00 00       	push   $0x4670
+    19b0:	6a 01                	push   $0x1
+    19b2:	e8 b9 1e 00 00       	call   3870 <printf>
+        exit();
+    19b7:	e8 c4 17 00 00       	call   3180 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    19bc:	51                   	push   %ecx
+    19bd:	51                   	push   %ecx
+    19be:	68 38 51 00 00       	push   $0x5138
+    19c3:	6a 01                	push   $0x1
+    19c5:	e8 a6 1e 00 00       	call   3870 <printf>
+    exit();
+    19ca:	e8 b1 17 00 00       	call   3180 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    19cf:	83 ec 04             	sub    $0x4,%esp
+    19d2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    19d5:	50                   	push   %eax
+    19d6:	68 89 46 00 00       	push   $0x4689
+    19db:	6a 01                	push   $0x1
+    19dd:	e8 8e 1e 00 00       	call   3870 <printf>
+        exit();
+    19e2:	e8 99 17 00 00       	call   3180 <exit>
+    19e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ee:	66 90                	xchg   %ax,%ax
+
+000019f0 <linkunlink>:
+{
+    19f0:	55                   	push   %ebp
+    19f1:	89 e5                	mov    %esp,%ebp
+    19f3:	57                   	push   %edi
+    19f4:	56                   	push   %esi
+    19f5:	53                   	push   %ebx
+    19f6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    19f9:	68 b4 46 00 00       	push   $0x46b4
+    19fe:	6a 01                	push   $0x1
+    1a00:	e8 6b 1e 00 00       	call   3870 <printf>
+  unlink("x");
+    1a05:	c7 04 24 41 49 00 00 	movl   $0x4941,(%esp)
+    1a0c:	e8 32 1b 00 00       	call   3543 <unlink>
+  pid = fork();
+    1a11:	e8 3a 17 00 00       	call   3150 <fork>
+  if(pid < 0){
+    1a16:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1a19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1a1c:	85 c0                	test   %eax,%eax
+    1a1e:	0f 88 b6 00 00 00    	js     1ada <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1a24:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1a28:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1a2d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1a32:	19 ff                	sbb    %edi,%edi
+    1a34:	83 e7 60             	and    $0x60,%edi
+    1a37:	83 c7 01             	add    $0x1,%edi
+    1a3a:	eb 1e                	jmp    1a5a <linkunlink+0x6a>
+    1a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1a40:	83 f8 01             	cmp    $0x1,%eax
+    1a43:	74 7b                	je     1ac0 <linkunlink+0xd0>
+      unlink("x");
+    1a45:	83 ec 0c             	sub    $0xc,%esp
+    1a48:	68 41 49 00 00       	push   $0x4941
+    1a4d:	e8 f1 1a 00 00       	call   3543 <unlink>
+    1a52:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1a55:	83 eb 01             	sub    $0x1,%ebx
+    1a58:	74 41                	je     1a9b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1a5a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1a60:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1a66:	89 f8                	mov    %edi,%eax
+    1a68:	f7 e6                	mul    %esi
+    1a6a:	89 d0                	mov    %edx,%eax
+    1a6c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1a6f:	d1 e8                	shr    %eax
+    1a71:	01 c2                	add    %eax,%edx
+    1a73:	89 f8                	mov    %edi,%eax
+    1a75:	29 d0                	sub    %edx,%eax
+    1a77:	75 c7                	jne    1a40 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1a79:	83 ec 08             	sub    $0x8,%esp
+    1a7c:	68 02 02 00 00       	push   $0x202
+    1a81:	68 41 49 00 00       	push   $0x4941
+    1a86:	e8 a8 1a 00 00       	call   3533 <open>
+    1a8b:	89 04 24             	mov    %eax,(%esp)
+    1a8e:	e8 88 1a 00 00       	call   351b <close>
+    1a93:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1a96:	83 eb 01             	sub    $0x1,%ebx
+    1a99:	75 bf                	jne    1a5a <linkunlink+0x6a>
+  if(pid)
+    1a9b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1a9e:	85 c0                	test   %eax,%eax
+    1aa0:	74 4b                	je     1aed <linkunlink+0xfd>
+    wait();
+    1aa2:	e8 54 1a 00 00       	call   34fb <wait>
+  printf(1, "linkunlink ok\n");
+    1aa7:	83 ec 08             	sub    $0x8,%esp
+    1aaa:	68 c9 46 00 00       	push   $0x46c9
+    1aaf:	6a 01                	push   $0x1
+    1ab1:	e8 ba 1d 00 00       	call   3870 <printf>
+}
+    1ab6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ab9:	5b                   	pop    %ebx
+    1aba:	5e                   	pop    %esi
+    1abb:	5f                   	pop    %edi
+    1abc:	5d                   	pop    %ebp
+    1abd:	c3                   	ret
+    1abe:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1ac0:	83 ec 08             	sub    $0x8,%esp
+    1ac3:	68 41 49 00 00       	push   $0x4941
+    1ac8:	68 c5 46 00 00       	push   $0x46c5
+    1acd:	e8 81 1a 00 00       	call   3553 <link>
+    1ad2:	83 c4 10             	add    $0x10,%esp
+    1ad5:	e9 7b ff ff ff       	jmp    1a55 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1ada:	52                   	push   %edx
+    1adb:	52                   	push   %edx
+    1adc:	68 73 4e 00 00       	push   $0x4e73
+    1ae1:	6a 01                	push   $0x1
+    1ae3:	e8 88 1d 00 00       	call   3870 <printf>
+    exit();
+    1ae8:	e8 93 16 00 00       	call   3180 <exit>
+    exit();
+    1aed:	e8 8e 16 00 00       	call   3180 <exit>
+    1af2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b00 <bigdir>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1b09:	68 d8 46 00 00       	push   $0x46d8
+    1b0e:	6a 01                	push   $0x1
+    1b10:	e8 5b 1d 00 00       	call   3870 <printf>
+  unlink("bd");
+    1b15:	c7 04 24 e5 46 00 00 	movl   $0x46e5,(%esp)
+    1b1c:	e8 22 1a 00 00       	call   3543 <unlink>
+  fd = open("bd", O_CREATE);
+    1b21:	5a                   	pop    %edx
+    1b22:	59                   	pop    %ecx
+    1b23:	68 00 02 00 00       	push   $0x200
+    1b28:	68 e5 46 00 00       	push   $0x46e5
+    1b2d:	e8 01 1a 00 00       	call   3533 <open>
+  if(fd < 0){
+    1b32:	83 c4 10             	add    $0x10,%esp
+    1b35:	85 c0                	test   %eax,%eax
+    1b37:	0f 88 de 00 00 00    	js     1c1b <bigdir+0x11b>
+  close(fd);
+    1b3d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1b40:	31 f6                	xor    %esi,%esi
+    1b42:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1b45:	50                   	push   %eax
+    1b46:	e8 d0 19 00 00       	call   351b <close>
+    1b4b:	83 c4 10             	add    $0x10,%esp
+    1b4e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1b50:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1b52:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1b55:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1b59:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1b5c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1b60:	83 c0 30             	add    $0x30,%eax
+    1b63:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1b66:	89 f0                	mov    %esi,%eax
+    1b68:	83 e0 3f             	and    $0x3f,%eax
+    1b6b:	83 c0 30             	add    $0x30,%eax
+    1b6e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1b71:	57                   	push   %edi
+    1b72:	68 e5 46 00 00       	push   $0x46e5
+    1b77:	e8 d7 19 00 00       	call   3553 <link>
+    1b7c:	83 c4 10             	add    $0x10,%esp
+    1b7f:	89 c3                	mov    %eax,%ebx
+    1b81:	85 c0                	test   %eax,%eax
+    1b83:	75 6e                	jne    1bf3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1b85:	83 c6 01             	add    $0x1,%esi
+    1b88:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1b8e:	75 c0                	jne    1b50 <bigdir+0x50>
+  unlink("bd");
+    1b90:	83 ec 0c             	sub    $0xc,%esp
+    1b93:	68 e5 46 00 00       	push   $0x46e5
+    1b98:	e8 a6 19 00 00       	call   3543 <unlink>
+    1b9d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1ba0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1ba2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1ba5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1ba9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1bac:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1bb0:	83 c0 30             	add    $0x30,%eax
+    1bb3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1bb6:	89 d8                	mov    %ebx,%eax
+    1bb8:	83 e0 3f             	and    $0x3f,%eax
+    1bbb:	83 c0 30             	add    $0x30,%eax
+    1bbe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1bc1:	57                   	push   %edi
+    1bc2:	e8 7c 19 00 00       	call   3543 <unlink>
+    1bc7:	83 c4 10             	add    $0x10,%esp
+    1bca:	85 c0                	test   %eax,%eax
+    1bcc:	75 39                	jne    1c07 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1bce:	83 c3 01             	add    $0x1,%ebx
+    1bd1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1bd7:	75 c7                	jne    1ba0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1bd9:	83 ec 08             	sub    $0x8,%esp
+    1bdc:	68 27 47 00 00       	push   $0x4727
+    1be1:	6a 01                	push   $0x1
+    1be3:	e8 88 1c 00 00       	call   3870 <printf>
+    1be8:	83 c4 10             	add    $0x10,%esp
+}
+    1beb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bee:	5b                   	pop    %ebx
+    1bef:	5e                   	pop    %esi
+    1bf0:	5f                   	pop    %edi
+    1bf1:	5d                   	pop    %ebp
+    1bf2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1bf3:	83 ec 08             	sub    $0x8,%esp
+    1bf6:	68 fe 46 00 00       	push   $0x46fe
+    1bfb:	6a 01                	push   $0x1
+    1bfd:	e8 6e 1c 00 00       	call   3870 <printf>
+      exit();
+    1c02:	e8 79 15 00 00       	call   3180 <exit>
+      printf(1, "bigdir unlink failed");
+    1c07:	83 ec 08             	sub    $0x8,%esp
+    1c0a:	68 12 47 00 00       	push   $0x4712
+    1c0f:	6a 01                	push   $0x1
+    1c11:	e8 5a 1c 00 00       	call   3870 <printf>
+      exit();
+    1c16:	e8 65 15 00 00       	call   3180 <exit>
+    printf(1, "bigdir create failed\n");
+    1c1b:	50                   	push   %eax
+    1c1c:	50                   	push   %eax
+    1c1d:	68 e8 46 00 00       	push   $0x46e8
+    1c22:	6a 01                	push   $0x1
+    1c24:	e8 47 1c 00 00       	call   3870 <printf>
+    exit();
+    1c29:	e8 52 15 00 00       	call   3180 <exit>
+    1c2e:	66 90                	xchg   %ax,%ax
+
+00001c30 <subdir>:
+{
+    1c30:	55                   	push   %ebp
+    1c31:	89 e5                	mov    %esp,%ebp
+    1c33:	53                   	push   %ebx
+    1c34:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1c37:	68 32 47 00 00       	push   $0x4732
+    1c3c:	6a 01                	push   $0x1
+    1c3e:	e8 2d 1c 00 00       	call   3870 <printf>
+  unlink("ff");
+    1c43:	c7 04 24 bb 47 00 00 	movl   $0x47bb,(%esp)
+    1c4a:	e8 f4 18 00 00       	call   3543 <unlink>
+  if(mkdir("dd") != 0){
+    1c4f:	c7 04 24 58 48 00 00 	movl   $0x4858,(%esp)
+    1c56:	e8 00 19 00 00       	call   355b <mkdir>
+    1c5b:	83 c4 10             	add    $0x10,%esp
+    1c5e:	85 c0                	test   %eax,%eax
+    1c60:	0f 85 b3 05 00 00    	jne    2219 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1c66:	83 ec 08             	sub    $0x8,%esp
+    1c69:	68 02 02 00 00       	push   $0x202
+    1c6e:	68 91 47 00 00       	push   $0x4791
+    1c73:	e8 bb 18 00 00       	call   3533 <open>
+  if(fd < 0){
+    1c78:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1c7b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1c7d:	85 c0                	test   %eax,%eax
+    1c7f:	0f 88 81 05 00 00    	js     2206 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1c85:	83 ec 04             	sub    $0x4,%esp
+    1c88:	6a 02                	push   $0x2
+    1c8a:	68 bb 47 00 00       	push   $0x47bb
+    1c8f:	50                   	push   %eax
+    1c90:	e8 7e 18 00 00       	call   3513 <write>
+  close(fd);
+    1c95:	89 1c 24             	mov    %ebx,(%esp)
+    1c98:	e8 7e 18 00 00       	call   351b <close>
+  if(unlink("dd") >= 0){
+    1c9d:	c7 04 24 58 48 00 00 	movl   $0x4858,(%esp)
+    1ca4:	e8 9a 18 00 00       	call   3543 <unlink>
+    1ca9:	83 c4 10             	add    $0x10,%esp
+    1cac:	85 c0                	test   %eax,%eax
+    1cae:	0f 89 3f 05 00 00    	jns    21f3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1cb4:	83 ec 0c             	sub    $0xc,%esp
+    1cb7:	68 6c 47 00 00       	push   $0x476c
+    1cbc:	e8 9a 18 00 00       	call   355b <mkdir>
+    1cc1:	83 c4 10             	add    $0x10,%esp
+    1cc4:	85 c0                	test   %eax,%eax
+    1cc6:	0f 85 14 05 00 00    	jne    21e0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1ccc:	83 ec 08             	sub    $0x8,%esp
+    1ccf:	68 02 02 00 00       	push   $0x202
+    1cd4:	68 8e 47 00 00       	push   $0x478e
+    1cd9:	e8 55 18 00 00       	call   3533 <open>
+  if(fd < 0){
+    1cde:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1ce1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ce3:	85 c0                	test   %eax,%eax
+    1ce5:	0f 88 24 04 00 00    	js     210f <subdir+0x4df>
+  write(fd, "FF", 2);
+    1ceb:	83 ec 04             	sub    $0x4,%esp
+    1cee:	6a 02                	push   $0x2
+    1cf0:	68 af 47 00 00       	push   $0x47af
+    1cf5:	50                   	push   %eax
+    1cf6:	e8 18 18 00 00       	call   3513 <write>
+  close(fd);
+    1cfb:	89 1c 24             	mov    %ebx,(%esp)
+    1cfe:	e8 18 18 00 00       	call   351b <close>
+  fd = open("dd/dd/../ff", 0);
+    1d03:	58                   	pop    %eax
+    1d04:	5a                   	pop    %edx
+    1d05:	6a 00                	push   $0x0
+    1d07:	68 b2 47 00 00       	push   $0x47b2
+    1d0c:	e8 22 18 00 00       	call   3533 <open>
+  if(fd < 0){
+    1d11:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1d14:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d16:	85 c0                	test   %eax,%eax
+    1d18:	0f 88 de 03 00 00    	js     20fc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1d1e:	83 ec 04             	sub    $0x4,%esp
+    1d21:	68 00 20 00 00       	push   $0x2000
+    1d26:	68 80 87 00 00       	push   $0x8780
+    1d2b:	50                   	push   %eax
+    1d2c:	e8 da 17 00 00       	call   350b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1d31:	83 c4 10             	add    $0x10,%esp
+    1d34:	83 f8 02             	cmp    $0x2,%eax
+    1d37:	0f 85 3a 03 00 00    	jne    2077 <subdir+0x447>
+    1d3d:	80 3d 80 87 00 00 66 	cmpb   $0x66,0x8780
+    1d44:	0f 85 2d 03 00 00    	jne    2077 <subdir+0x447>
+  close(fd);
+    1d4a:	83 ec 0c             	sub    $0xc,%esp
+    1d4d:	53                   	push   %ebx
+    1d4e:	e8 c8 17 00 00       	call   351b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1d53:	59                   	pop    %ecx
+    1d54:	5b                   	pop    %ebx
+    1d55:	68 f2 47 00 00       	push   $0x47f2
+    1d5a:	68 8e 47 00 00       	push   $0x478e
+    1d5f:	e8 ef 17 00 00       	call   3553 <link>
+    1d64:	83 c4 10             	add    $0x10,%esp
+    1d67:	85 c0                	test   %eax,%eax
+    1d69:	0f 85 c6 03 00 00    	jne    2135 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1d6f:	83 ec 0c             	sub    $0xc,%esp
+    1d72:	68 8e 47 00 00       	push   $0x478e
+    1d77:	e8 c7 17 00 00       	call   3543 <unlink>
+    1d7c:	83 c4 10             	add    $0x10,%esp
+    1d7f:	85 c0                	test   %eax,%eax
+    1d81:	0f 85 16 03 00 00    	jne    209d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d87:	83 ec 08             	sub    $0x8,%esp
+    1d8a:	6a 00                	push   $0x0
+    1d8c:	68 8e 47 00 00       	push   $0x478e
+    1d91:	e8 9d 17 00 00       	call   3533 <open>
+    1d96:	83 c4 10             	add    $0x10,%esp
+    1d99:	85 c0                	test   %eax,%eax
+    1d9b:	0f 89 2c 04 00 00    	jns    21cd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1da1:	83 ec 0c             	sub    $0xc,%esp
+    1da4:	68 58 48 00 00       	push   $0x4858
+    1da9:	e8 b5 17 00 00       	call   3563 <chdir>
+    1dae:	83 c4 10             	add    $0x10,%esp
+    1db1:	85 c0                	test   %eax,%eax
+    1db3:	0f 85 01 04 00 00    	jne    21ba <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1db9:	83 ec 0c             	sub    $0xc,%esp
+    1dbc:	68 26 48 00 00       	push   $0x4826
+    1dc1:	e8 9d 17 00 00       	call   3563 <chdir>
+    1dc6:	83 c4 10             	add    $0x10,%esp
+    1dc9:	85 c0                	test   %eax,%eax
+    1dcb:	0f 85 b9 02 00 00    	jne    208a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1dd1:	83 ec 0c             	sub    $0xc,%esp
+    1dd4:	68 4c 48 00 00       	push   $0x484c
+    1dd9:	e8 85 17 00 00       	call   3563 <chdir>
+    1dde:	83 c4 10             	add    $0x10,%esp
+    1de1:	85 c0                	test   %eax,%eax
+    1de3:	0f 85 a1 02 00 00    	jne    208a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1de9:	83 ec 0c             	sub    $0xc,%esp
+    1dec:	68 5b 48 00 00       	push   $0x485b
+    1df1:	e8 6d 17 00 00       	call   3563 <chdir>
+    1df6:	83 c4 10             	add    $0x10,%esp
+    1df9:	85 c0                	test   %eax,%eax
+    1dfb:	0f 85 21 03 00 00    	jne    2122 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1e01:	83 ec 08             	sub    $0x8,%esp
+    1e04:	6a 00                	push   $0x0
+    1e06:	68 f2 47 00 00       	push   $0x47f2
+    1e0b:	e8 23 17 00 00       	call   3533 <open>
+  if(fd < 0){
+    1e10:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1e13:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e15:	85 c0                	test   %eax,%eax
+    1e17:	0f 88 e0 04 00 00    	js     22fd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1e1d:	83 ec 04             	sub    $0x4,%esp
+    1e20:	68 00 20 00 00       	push   $0x2000
+    1e25:	68 80 87 00 00       	push   $0x8780
+    1e2a:	50                   	push   %eax
+    1e2b:	e8 db 16 00 00       	call   350b <read>
+    1e30:	83 c4 10             	add    $0x10,%esp
+    1e33:	83 f8 02             	cmp    $0x2,%eax
+    1e36:	0f 85 ae 04 00 00    	jne    22ea <subdir+0x6ba>
+  close(fd);
+    1e3c:	83 ec 0c             	sub    $0xc,%esp
+    1e3f:	53                   	push   %ebx
+    1e40:	e8 d6 16 00 00       	call   351b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1e45:	58                   	pop    %eax
+    1e46:	5a                   	pop    %edx
+    1e47:	6a 00                	push   $0x0
+    1e49:	68 8e 47 00 00       	push   $0x478e
+    1e4e:	e8 e0 16 00 00       	call   3533 <open>
+    1e53:	83 c4 10             	add    $0x10,%esp
+    1e56:	85 c0                	test   %eax,%eax
+    1e58:	0f 89 65 02 00 00    	jns    20c3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1e5e:	83 ec 08             	sub    $0x8,%esp
+    1e61:	68 02 02 00 00       	push   $0x202
+    1e66:	68 a6 48 00 00       	push   $0x48a6
+    1e6b:	e8 c3 16 00 00       	call   3533 <open>
+    1e70:	83 c4 10             	add    $0x10,%esp
+    1e73:	85 c0                	test   %eax,%eax
+    1e75:	0f 89 35 02 00 00    	jns    20b0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1e7b:	83 ec 08             	sub    $0x8,%esp
+    1e7e:	68 02 02 00 00       	push   $0x202
+    1e83:	68 cb 48 00 00       	push   $0x48cb
+    1e88:	e8 a6 16 00 00       	call   3533 <open>
+    1e8d:	83 c4 10             	add    $0x10,%esp
+    1e90:	85 c0                	test   %eax,%eax
+    1e92:	0f 89 0f 03 00 00    	jns    21a7 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1e98:	83 ec 08             	sub    $0x8,%esp
+    1e9b:	68 00 02 00 00       	push   $0x200
+    1ea0:	68 58 48 00 00       	push   $0x4858
+    1ea5:	e8 89 16 00 00       	call   3533 <open>
+    1eaa:	83 c4 10             	add    $0x10,%esp
+    1ead:	85 c0                	test   %eax,%eax
+    1eaf:	0f 89 df 02 00 00    	jns    2194 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1eb5:	83 ec 08             	sub    $0x8,%esp
+    1eb8:	6a 02                	push   $0x2
+    1eba:	68 58 48 00 00       	push   $0x4858
+    1ebf:	e8 6f 16 00 00       	call   3533 <open>
+    1ec4:	83 c4 10             	add    $0x10,%esp
+    1ec7:	85 c0                	test   %eax,%eax
+    1ec9:	0f 89 b2 02 00 00    	jns    2181 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    1ecf:	83 ec 08             	sub    $0x8,%esp
+    1ed2:	6a 01                	push   $0x1
+    1ed4:	68 58 48 00 00       	push   $0x4858
+    1ed9:	e8 55 16 00 00       	call   3533 <open>
+    1ede:	83 c4 10             	add    $0x10,%esp
+    1ee1:	85 c0                	test   %eax,%eax
+    1ee3:	0f 89 85 02 00 00    	jns    216e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1ee9:	83 ec 08             	sub    $0x8,%esp
+    1eec:	68 3a 49 00 00       	push   $0x493a
+    1ef1:	68 a6 48 00 00       	push   $0x48a6
+    1ef6:	e8 58 16 00 00       	call   3553 <link>
+    1efb:	83 c4 10             	add    $0x10,%esp
+    1efe:	85 c0                	test   %eax,%eax
+    1f00:	0f 84 55 02 00 00    	je     215b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1f06:	83 ec 08             	sub    $0x8,%esp
+    1f09:	68 3a 49 00 00       	push   $0x493a
+    1f0e:	68 cb 48 00 00       	push   $0x48cb
+    1f13:	e8 3b 16 00 00       	call   3553 <link>
+    1f18:	83 c4 10             	add    $0x10,%esp
+    1f1b:	85 c0                	test   %eax,%eax
+    1f1d:	0f 84 25 02 00 00    	je     2148 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1f23:	83 ec 08             	sub    $0x8,%esp
+    1f26:	68 f2 47 00 00       	push   $0x47f2
+    1f2b:	68 91 47 00 00       	push   $0x4791
+    1f30:	e8 1e 16 00 00       	call   3553 <link>
+    1f35:	83 c4 10             	add    $0x10,%esp
+    1f38:	85 c0                	test   %eax,%eax
+    1f3a:	0f 84 a9 01 00 00    	je     20e9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    1f40:	83 ec 0c             	sub    $0xc,%esp
+    1f43:	68 a6 48 00 00       	push   $0x48a6
+    1f48:	e8 0e 16 00 00       	call   355b <mkdir>
+    1f4d:	83 c4 10             	add    $0x10,%esp
+    1f50:	85 c0                	test   %eax,%eax
+    1f52:	0f 84 7e 01 00 00    	je     20d6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    1f58:	83 ec 0c             	sub    $0xc,%esp
+    1f5b:	68 cb 48 00 00       	push   $0x48cb
+    1f60:	e8 f6 15 00 00       	call   355b <mkdir>
+    1f65:	83 c4 10             	add    $0x10,%esp
+    1f68:	85 c0                	test   %eax,%eax
+    1f6a:	0f 84 67 03 00 00    	je     22d7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	68 f2 47 00 00       	push   $0x47f2
+    1f78:	e8 de 15 00 00       	call   355b <mkdir>
+    1f7d:	83 c4 10             	add    $0x10,%esp
+    1f80:	85 c0                	test   %eax,%eax
+    1f82:	0f 84 3c 03 00 00    	je     22c4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    1f88:	83 ec 0c             	sub    $0xc,%esp
+    1f8b:	68 cb 48 00 00       	push   $0x48cb
+    1f90:	e8 ae 15 00 00       	call   3543 <unlink>
+    1f95:	83 c4 10             	add    $0x10,%esp
+    1f98:	85 c0                	test   %eax,%eax
+    1f9a:	0f 84 11 03 00 00    	je     22b1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    1fa0:	83 ec 0c             	sub    $0xc,%esp
+    1fa3:	68 a6 48 00 00       	push   $0x48a6
+    1fa8:	e8 96 15 00 00       	call   3543 <unlink>
+    1fad:	83 c4 10             	add    $0x10,%esp
+    1fb0:	85 c0                	test   %eax,%eax
+    1fb2:	0f 84 e6 02 00 00    	je     229e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    1fb8:	83 ec 0c             	sub    $0xc,%esp
+    1fbb:	68 91 47 00 00       	push   $0x4791
+    1fc0:	e8 9e 15 00 00       	call   3563 <chdir>
+    1fc5:	83 c4 10             	add    $0x10,%esp
+    1fc8:	85 c0                	test   %eax,%eax
+    1fca:	0f 84 bb 02 00 00    	je     228b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    1fd0:	83 ec 0c             	sub    $0xc,%esp
+    1fd3:	68 3d 49 00 00       	push   $0x493d
+    1fd8:	e8 86 15 00 00       	call   3563 <chdir>
+    1fdd:	83 c4 10             	add    $0x10,%esp
+    1fe0:	85 c0                	test   %eax,%eax
+    1fe2:	0f 84 90 02 00 00    	je     2278 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    1fe8:	83 ec 0c             	sub    $0xc,%esp
+    1feb:	68 f2 47 00 00       	push   $0x47f2
+    1ff0:	e8 4e 15 00 00       	call   3543 <unlink>
+    1ff5:	83 c4 10             	add    $0x10,%esp
+    1ff8:	85 c0                	test   %eax,%eax
+    1ffa:	0f 85 9d 00 00 00    	jne    209d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2000:	83 ec 0c             	sub    $0xc,%esp
+    2003:	68 91 47 00 00       	push   $0x4791
+    2008:	e8 36 15 00 00       	call   3543 <unlink>
+    200d:	83 c4 10             	add    $0x10,%esp
+    2010:	85 c0                	test   %eax,%eax
+    2012:	0f 85 4d 02 00 00    	jne    2265 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2018:	83 ec 0c             	sub    $0xc,%esp
+    201b:	68 58 48 00 00       	push   $0x4858
+    2020:	e8 1e 15 00 00       	call   3543 <unlink>
+    2025:	83 c4 10             	add    $0x10,%esp
+    2028:	85 c0                	test   %eax,%eax
+    202a:	0f 84 22 02 00 00    	je     2252 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2030:	83 ec 0c             	sub    $0xc,%esp
+    2033:	68 6d 47 00 00       	push   $0x476d
+    2038:	e8 06 15 00 00       	call   3543 <unlink>
+    203d:	83 c4 10             	add    $0x10,%esp
+    2040:	85 c0                	test   %eax,%eax
+    2042:	0f 88 f7 01 00 00    	js     223f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2048:	83 ec 0c             	sub    $0xc,%esp
+    204b:	68 58 48 00 00       	push   $0x4858
+    2050:	e8 ee 14 00 00       	call   3543 <unlink>
+    2055:	83 c4 10             	add    $0x10,%esp
+    2058:	85 c0                	test   %eax,%eax
+    205a:	0f 88 cc 01 00 00    	js     222c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2060:	83 ec 08             	sub    $0x8,%esp
+    2063:	68 3a 4a 00 00       	push   $0x4a3a
+    2068:	6a 01                	push   $0x1
+    206a:	e8 01 18 00 00       	call   3870 <printf>
+}
+    206f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2072:	83 c4 10             	add    $0x10,%esp
+    2075:	c9                   	leave
+    2076:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2077:	50                   	push   %eax
+    2078:	50                   	push   %eax
+    2079:	68 d7 47 00 00       	push   $0x47d7
+    207e:	6a 01                	push   $0x1
+    2080:	e8 eb 17 00 00       	call   3870 <printf>
+    exit();
+    2085:	e8 f6 10 00 00       	call   3180 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    208a:	50                   	push   %eax
+    208b:	50                   	push   %eax
+    208c:	68 32 48 00 00       	push   $0x4832
+    2091:	6a 01                	push   $0x1
+    2093:	e8 d8 17 00 00       	call   3870 <printf>
+    exit();
+    2098:	e8 e3 10 00 00       	call   3180 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    209d:	50                   	push   %eax
+    209e:	50                   	push   %eax
+    209f:	68 fd 47 00 00       	push   $0x47fd
+    20a4:	6a 01                	push   $0x1
+    20a6:	e8 c5 17 00 00       	call   3870 <printf>
+    exit();
+    20ab:	e8 d0 10 00 00       	call   3180 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    20b0:	51                   	push   %ecx
+    20b1:	51                   	push   %ecx
+    20b2:	68 af 48 00 00       	push   $0x48af
+    20b7:	6a 01                	push   $0x1
+    20b9:	e8 b2 17 00 00       	call   3870 <printf>
+    exit();
+    20be:	e8 bd 10 00 00       	call   3180 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    20c3:	53                   	push   %ebx
+    20c4:	53                   	push   %ebx
+    20c5:	68 dc 51 00 00       	push   $0x51dc
+    20ca:	6a 01                	push   $0x1
+    20cc:	e8 9f 17 00 00       	call   3870 <printf>
+    exit();
+    20d1:	e8 aa 10 00 00       	call   3180 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    20d6:	51                   	push   %ecx
+    20d7:	51                   	push   %ecx
+    20d8:	68 43 49 00 00       	push   $0x4943
+    20dd:	6a 01                	push   $0x1
+    20df:	e8 8c 17 00 00       	call   3870 <printf>
+    exit();
+    20e4:	e8 97 10 00 00       	call   3180 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    20e9:	53                   	push   %ebx
+    20ea:	53                   	push   %ebx
+    20eb:	68 4c 52 00 00       	push   $0x524c
+    20f0:	6a 01                	push   $0x1
+    20f2:	e8 79 17 00 00       	call   3870 <printf>
+    exit();
+    20f7:	e8 84 10 00 00       	call   3180 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    20fc:	50                   	push   %eax
+    20fd:	50                   	push   %eax
+    20fe:	68 be 47 00 00       	push   $0x47be
+    2103:	6a 01                	push   $0x1
+    2105:	e8 66 17 00 00       	call   3870 <printf>
+    exit();
+    210a:	e8 71 10 00 00       	call   3180 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    210f:	51                   	push   %ecx
+    2110:	51                   	push   %ecx
+    2111:	68 97 47 00 00       	push   $0x4797
+    2116:	6a 01                	push   $0x1
+    2118:	e8 53 17 00 00       	call   3870 <printf>
+    exit();
+    211d:	e8 5e 10 00 00       	call   3180 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2122:	50                   	push   %eax
+    2123:	50                   	push   %eax
+    2124:	68 60 48 00 00       	push   $0x4860
+    2129:	6a 01                	push   $0x1
+    212b:	e8 40 17 00 00       	call   3870 <printf>
+    exit();
+    2130:	e8 4b 10 00 00       	call   3180 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2135:	52                   	push   %edx
+    2136:	52                   	push   %edx
+    2137:	68 94 51 00 00       	push   $0x5194
+    213c:	6a 01                	push   $0x1
+    213e:	e8 2d 17 00 00       	call   3870 <printf>
+    exit();
+    2143:	e8 38 10 00 00       	call   3180 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2148:	50                   	push   %eax
+    2149:	50                   	push   %eax
+    214a:	68 28 52 00 00       	push   $0x5228
+    214f:	6a 01                	push   $0x1
+    2151:	e8 1a 17 00 00       	call   3870 <printf>
+    exit();
+    2156:	e8 25 10 00 00       	call   3180 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    215b:	50                   	push   %eax
+    215c:	50                   	push   %eax
+    215d:	68 04 52 00 00       	push   $0x5204
+    2162:	6a 01                	push   $0x1
+    2164:	e8 07 17 00 00       	call   3870 <printf>
+    exit();
+    2169:	e8 12 10 00 00       	call   3180 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    216e:	50                   	push   %eax
+    216f:	50                   	push   %eax
+    2170:	68 1f 49 00 00       	push   $0x491f
+    2175:	6a 01                	push   $0x1
+    2177:	e8 f4 16 00 00       	call   3870 <printf>
+    exit();
+    217c:	e8 ff 0f 00 00       	call   3180 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2181:	50                   	push   %eax
+    2182:	50                   	push   %eax
+    2183:	68 06 49 00 00       	push   $0x4906
+    2188:	6a 01                	push   $0x1
+    218a:	e8 e1 16 00 00       	call   3870 <printf>
+    exit();
+    218f:	e8 ec 0f 00 00       	call   3180 <exit>
+    printf(1, "create dd succeeded!\n");
+    2194:	50                   	push   %eax
+    2195:	50                   	push   %eax
+    2196:	68 f0 48 00 00       	push   $0x48f0
+    219b:	6a 01                	push   $0x1
+    219d:	e8 ce 16 00 00       	call   3870 <printf>
+    exit();
+    21a2:	e8 d9 0f 00 00       	call   3180 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    21a7:	52                   	push   %edx
+    21a8:	52                   	push   %edx
+    21a9:	68 d4 48 00 00       	push   $0x48d4
+    21ae:	6a 01                	push   $0x1
+    21b0:	e8 bb 16 00 00       	call   3870 <printf>
+    exit();
+    21b5:	e8 c6 0f 00 00       	call   3180 <exit>
+    printf(1, "chdir dd failed\n");
+    21ba:	50                   	push   %eax
+    21bb:	50                   	push   %eax
+    21bc:	68 15 48 00 00       	push   $0x4815
+    21c1:	6a 01                	push   $0x1
+    21c3:	e8 a8 16 00 00       	call   3870 <printf>
+    exit();
+    21c8:	e8 b3 0f 00 00       	call   3180 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    21cd:	50                   	push   %eax
+    21ce:	50                   	push   %eax
+    21cf:	68 b8 51 00 00       	push   $0x51b8
+    21d4:	6a 01                	push   $0x1
+    21d6:	e8 95 16 00 00       	call   3870 <printf>
+    exit();
+    21db:	e8 a0 0f 00 00       	call   3180 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    21e0:	53                   	push   %ebx
+    21e1:	53                   	push   %ebx
+    21e2:	68 73 47 00 00       	push   $0x4773
+    21e7:	6a 01                	push   $0x1
+    21e9:	e8 82 16 00 00       	call   3870 <printf>
+    exit();
+    21ee:	e8 8d 0f 00 00       	call   3180 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    21f3:	50                   	push   %eax
+    21f4:	50                   	push   %eax
+    21f5:	68 6c 51 00 00       	push   $0x516c
+    21fa:	6a 01                	push   $0x1
+    21fc:	e8 6f 16 00 00       	call   3870 <printf>
+    exit();
+    2201:	e8 7a 0f 00 00       	call   3180 <exit>
+    printf(1, "create dd/ff failed\n");
+    2206:	50                   	push   %eax
+    2207:	50                   	push   %eax
+    2208:	68 57 47 00 00       	push   $0x4757
+    220d:	6a 01                	push   $0x1
+    220f:	e8 5c 16 00 00       	call   3870 <printf>
+    exit();
+    2214:	e8 67 0f 00 00       	call   3180 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2219:	50                   	push   %eax
+    221a:	50                   	push   %eax
+    221b:	68 3f 47 00 00       	push   $0x473f
+    2220:	6a 01                	push   $0x1
+    2222:	e8 49 16 00 00       	call   3870 <printf>
+    exit();
+    2227:	e8 54 0f 00 00       	call   3180 <exit>
+    printf(1, "unlink dd failed\n");
+    222c:	50                   	push   %eax
+    222d:	50                   	push   %eax
+    222e:	68 28 4a 00 00       	push   $0x4a28
+    2233:	6a 01                	push   $0x1
+    2235:	e8 36 16 00 00       	call   3870 <printf>
+    exit();
+    223a:	e8 41 0f 00 00       	call   3180 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    223f:	52                   	push   %edx
+    2240:	52                   	push   %edx
+    2241:	68 13 4a 00 00       	push   $0x4a13
+    2246:	6a 01                	push   $0x1
+    2248:	e8 23 16 00 00       	call   3870 <printf>
+    exit();
+    224d:	e8 2e 0f 00 00       	call   3180 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2252:	51                   	push   %ecx
+    2253:	51                   	push   %ecx
+    2254:	68 70 52 00 00       	push   $0x5270
+    2259:	6a 01                	push   $0x1
+    225b:	e8 10 16 00 00       	call   3870 <printf>
+    exit();
+    2260:	e8 1b 0f 00 00       	call   3180 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2265:	53                   	push   %ebx
+    2266:	53                   	push   %ebx
+    2267:	68 fe 49 00 00       	push   $0x49fe
+    226c:	6a 01                	push   $0x1
+    226e:	e8 fd 15 00 00       	call   3870 <printf>
+    exit();
+    2273:	e8 08 0f 00 00       	call   3180 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2278:	50                   	push   %eax
+    2279:	50                   	push   %eax
+    227a:	68 e6 49 00 00       	push   $0x49e6
+    227f:	6a 01                	push   $0x1
+    2281:	e8 ea 15 00 00       	call   3870 <printf>
+    exit();
+    2286:	e8 f5 0e 00 00       	call   3180 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    228b:	50                   	push   %eax
+    228c:	50                   	push   %eax
+    228d:	68 ce 49 00 00       	push   $0x49ce
+    2292:	6a 01                	push   $0x1
+    2294:	e8 d7 15 00 00       	call   3870 <printf>
+    exit();
+    2299:	e8 e2 0e 00 00       	call   3180 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    229e:	50                   	push   %eax
+    229f:	50                   	push   %eax
+    22a0:	68 b2 49 00 00       	push   $0x49b2
+    22a5:	6a 01                	push   $0x1
+    22a7:	e8 c4 15 00 00       	call   3870 <printf>
+    exit();
+    22ac:	e8 cf 0e 00 00       	call   3180 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    22b1:	50                   	push   %eax
+    22b2:	50                   	push   %eax
+    22b3:	68 96 49 00 00       	push   $0x4996
+    22b8:	6a 01                	push   $0x1
+    22ba:	e8 b1 15 00 00       	call   3870 <printf>
+    exit();
+    22bf:	e8 bc 0e 00 00       	call   3180 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    22c4:	50                   	push   %eax
+    22c5:	50                   	push   %eax
+    22c6:	68 79 49 00 00       	push   $0x4979
+    22cb:	6a 01                	push   $0x1
+    22cd:	e8 9e 15 00 00       	call   3870 <printf>
+    exit();
+    22d2:	e8 a9 0e 00 00       	call   3180 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    22d7:	52                   	push   %edx
+    22d8:	52                   	push   %edx
+    22d9:	68 5e 49 00 00       	push   $0x495e
+    22de:	6a 01                	push   $0x1
+    22e0:	e8 8b 15 00 00       	call   3870 <printf>
+    exit();
+    22e5:	e8 96 0e 00 00       	call   3180 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    22ea:	51                   	push   %ecx
+    22eb:	51                   	push   %ecx
+    22ec:	68 8b 48 00 00       	push   $0x488b
+    22f1:	6a 01                	push   $0x1
+    22f3:	e8 78 15 00 00       	call   3870 <printf>
+    exit();
+    22f8:	e8 83 0e 00 00       	call   3180 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    22fd:	53                   	push   %ebx
+    22fe:	53                   	push   %ebx
+    22ff:	68 73 48 00 00       	push   $0x4873
+    2304:	6a 01                	push   $0x1
+    2306:	e8 65 15 00 00       	call   3870 <printf>
+    exit();
+    230b:	e8 70 0e 00 00       	call   3180 <exit>
+
+00002310 <bigwrite>:
+{
+    2310:	55                   	push   %ebp
+    2311:	89 e5                	mov    %esp,%ebp
+    2313:	56                   	push   %esi
+    2314:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2315:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    231a:	83 ec 08             	sub    $0x8,%esp
+    231d:	68 45 4a 00 00       	push   $0x4a45
+    2322:	6a 01                	push   $0x1
+    2324:	e8 47 15 00 00       	call   3870 <printf>
+  unlink("bigwrite");
+    2329:	c7 04 24 54 4a 00 00 	movl   $0x4a54,(%esp)
+    2330:	e8 0e 12 00 00       	call   3543 <unlink>
+    2335:	83 c4 10             	add    $0x10,%esp
+    2338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    233f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2340:	83 ec 08             	sub    $0x8,%esp
+    2343:	68 02 02 00 00       	push   $0x202
+    2348:	68 54 4a 00 00       	push   $0x4a54
+    234d:	e8 e1 11 00 00       	call   3533 <open>
+    if(fd < 0){
+    2352:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2355:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2357:	85 c0                	test   %eax,%eax
+    2359:	78 7e                	js     23d9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    235b:	83 ec 04             	sub    $0x4,%esp
+    235e:	53                   	push   %ebx
+    235f:	68 80 87 00 00       	push   $0x8780
+    2364:	50                   	push   %eax
+    2365:	e8 a9 11 00 00       	call   3513 <write>
+      if(cc != sz){
+    236a:	83 c4 10             	add    $0x10,%esp
+    236d:	39 d8                	cmp    %ebx,%eax
+    236f:	75 55                	jne    23c6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2371:	83 ec 04             	sub    $0x4,%esp
+    2374:	53                   	push   %ebx
+    2375:	68 80 87 00 00       	push   $0x8780
+    237a:	56                   	push   %esi
+    237b:	e8 93 11 00 00       	call   3513 <write>
+      if(cc != sz){
+    2380:	83 c4 10             	add    $0x10,%esp
+    2383:	39 c3                	cmp    %eax,%ebx
+    2385:	75 3f                	jne    23c6 <bigwrite+0xb6>
+    close(fd);
+    2387:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    238a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2390:	56                   	push   %esi
+    2391:	e8 85 11 00 00       	call   351b <close>
+    unlink("bigwrite");
+    2396:	c7 04 24 54 4a 00 00 	movl   $0x4a54,(%esp)
+    239d:	e8 a1 11 00 00       	call   3543 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    23a2:	83 c4 10             	add    $0x10,%esp
+    23a5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    23ab:	75 93                	jne    2340 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    23ad:	83 ec 08             	sub    $0x8,%esp
+    23b0:	68 87 4a 00 00       	push   $0x4a87
+    23b5:	6a 01                	push   $0x1
+    23b7:	e8 b4 14 00 00       	call   3870 <printf>
+}
+    23bc:	83 c4 10             	add    $0x10,%esp
+    23bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    23c2:	5b                   	pop    %ebx
+    23c3:	5e                   	pop    %esi
+    23c4:	5d                   	pop    %ebp
+    23c5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    23c6:	50                   	push   %eax
+    23c7:	53                   	push   %ebx
+    23c8:	68 75 4a 00 00       	push   $0x4a75
+    23cd:	6a 01                	push   $0x1
+    23cf:	e8 9c 14 00 00       	call   3870 <printf>
+        exit();
+    23d4:	e8 a7 0d 00 00       	call   3180 <exit>
+      printf(1, "cannot create bigwrite\n");
+    23d9:	83 ec 08             	sub    $0x8,%esp
+    23dc:	68 5d 4a 00 00       	push   $0x4a5d
+    23e1:	6a 01                	push   $0x1
+    23e3:	e8 88 14 00 00       	call   3870 <printf>
+      exit();
+    23e8:	e8 93 0d 00 00       	call   3180 <exit>
+    23ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000023f0 <bigfile>:
+{
+    23f0:	55                   	push   %ebp
+    23f1:	89 e5                	mov    %esp,%ebp
+    23f3:	57                   	push   %edi
+    23f4:	56                   	push   %esi
+    23f5:	53                   	push   %ebx
+    23f6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    23f9:	68 94 4a 00 00       	push   $0x4a94
+    23fe:	6a 01                	push   $0x1
+    2400:	e8 6b 14 00 00       	call   3870 <printf>
+  unlink("bigfile");
+    2405:	c7 04 24 b0 4a 00 00 	movl   $0x4ab0,(%esp)
+    240c:	e8 32 11 00 00       	call   3543 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2411:	58                   	pop    %eax
+    2412:	5a                   	pop    %edx
+    2413:	68 02 02 00 00       	push   $0x202
+    2418:	68 b0 4a 00 00       	push   $0x4ab0
+    241d:	e8 11 11 00 00       	call   3533 <open>
+  if(fd < 0){
+    2422:	83 c4 10             	add    $0x10,%esp
+    2425:	85 c0                	test   %eax,%eax
+    2427:	0f 88 5e 01 00 00    	js     258b <bigfile+0x19b>
+    242d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    242f:	31 db                	xor    %ebx,%ebx
+    2431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2438:	83 ec 04             	sub    $0x4,%esp
+    243b:	68 58 02 00 00       	push   $0x258
+    2440:	53                   	push   %ebx
+    2441:	68 80 87 00 00       	push   $0x8780
+    2446:	e8 85 0e 00 00       	call   32d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    244b:	83 c4 0c             	add    $0xc,%esp
+    244e:	68 58 02 00 00       	push   $0x258
+    2453:	68 80 87 00 00       	push   $0x8780
+    2458:	56                   	push   %esi
+    2459:	e8 b5 10 00 00       	call   3513 <write>
+    245e:	83 c4 10             	add    $0x10,%esp
+    2461:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2466:	0f 85 f8 00 00 00    	jne    2564 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    246c:	83 c3 01             	add    $0x1,%ebx
+    246f:	83 fb 14             	cmp    $0x14,%ebx
+    2472:	75 c4                	jne    2438 <bigfile+0x48>
+  close(fd);
+    2474:	83 ec 0c             	sub    $0xc,%esp
+    2477:	56                   	push   %esi
+    2478:	e8 9e 10 00 00       	call   351b <close>
+  fd = open("bigfile", 0);
+    247d:	5e                   	pop    %esi
+    247e:	5f                   	pop    %edi
+    247f:	6a 00                	push   $0x0
+    2481:	68 b0 4a 00 00       	push   $0x4ab0
+    2486:	e8 a8 10 00 00       	call   3533 <open>
+  if(fd < 0){
+    248b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    248e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2490:	85 c0                	test   %eax,%eax
+    2492:	0f 88 e0 00 00 00    	js     2578 <bigfile+0x188>
+  total = 0;
+    2498:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    249a:	31 ff                	xor    %edi,%edi
+    249c:	eb 30                	jmp    24ce <bigfile+0xde>
+    249e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    24a0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    24a5:	0f 85 91 00 00 00    	jne    253c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    24ab:	89 fa                	mov    %edi,%edx
+    24ad:	0f be 05 80 87 00 00 	movsbl 0x8780,%eax
+    24b4:	d1 fa                	sar    %edx
+    24b6:	39 d0                	cmp    %edx,%eax
+    24b8:	75 6e                	jne    2528 <bigfile+0x138>
+    24ba:	0f be 15 ab 88 00 00 	movsbl 0x88ab,%edx
+    24c1:	39 d0                	cmp    %edx,%eax
+    24c3:	75 63                	jne    2528 <bigfile+0x138>
+    total += cc;
+    24c5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    24cb:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    24ce:	83 ec 04             	sub    $0x4,%esp
+    24d1:	68 2c 01 00 00       	push   $0x12c
+    24d6:	68 80 87 00 00       	push   $0x8780
+    24db:	56                   	push   %esi
+    24dc:	e8 2a 10 00 00       	call   350b <read>
+    if(cc < 0){
+    24e1:	83 c4 10             	add    $0x10,%esp
+    24e4:	85 c0                	test   %eax,%eax
+    24e6:	78 68                	js     2550 <bigfile+0x160>
+    if(cc == 0)
+    24e8:	75 b6                	jne    24a0 <bigfile+0xb0>
+  close(fd);
+    24ea:	83 ec 0c             	sub    $0xc,%esp
+    24ed:	56                   	push   %esi
+    24ee:	e8 28 10 00 00       	call   351b <close>
+  if(total != 20*600){
+    24f3:	83 c4 10             	add    $0x10,%esp
+    24f6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    24fc:	0f 85 9c 00 00 00    	jne    259e <bigfile+0x1ae>
+  unlink("bigfile");
+    2502:	83 ec 0c             	sub    $0xc,%esp
+    2505:	68 b0 4a 00 00       	push   $0x4ab0
+    250a:	e8 34 10 00 00       	call   3543 <unlink>
+  printf(1, "bigfile test ok\n");
+    250f:	58                   	pop    %eax
+    2510:	5a                   	pop    %edx
+    2511:	68 3f 4b 00 00       	push   $0x4b3f
+    2516:	6a 01                	push   $0x1
+    2518:	e8 53 13 00 00       	call   3870 <printf>
+}
+    251d:	83 c4 10             	add    $0x10,%esp
+    2520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2523:	5b                   	pop    %ebx
+    2524:	5e                   	pop    %esi
+    2525:	5f                   	pop    %edi
+    2526:	5d                   	pop    %ebp
+    2527:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2528:	83 ec 08             	sub    $0x8,%esp
+    252b:	68 0c 4b 00 00       	push   $0x4b0c
+    2530:	6a 01                	push   $0x1
+    2532:	e8 39 13 00 00       	call   3870 <printf>
+      exit();
+    2537:	e8 44 0c 00 00       	call   3180 <exit>
+      printf(1, "short read bigfile\n");
+    253c:	83 ec 08             	sub    $0x8,%esp
+    253f:	68 f8 4a 00 00       	push   $0x4af8
+    2544:	6a 01                	push   $0x1
+    2546:	e8 25 13 00 00       	call   3870 <printf>
+      exit();
+    254b:	e8 30 0c 00 00       	call   3180 <exit>
+      printf(1, "read bigfile failed\n");
+    2550:	83 ec 08             	sub    $0x8,%esp
+    2553:	68 e3 4a 00 00       	push   $0x4ae3
+    2558:	6a 01                	push   $0x1
+    255a:	e8 11 13 00 00       	call   3870 <printf>
+      exit();
+    255f:	e8 1c 0c 00 00       	call   3180 <exit>
+      printf(1, "write bigfile failed\n");
+    2564:	83 ec 08             	sub    $0x8,%esp
+    2567:	68 b8 4a 00 00       	push   $0x4ab8
+    256c:	6a 01                	push   $0x1
+    256e:	e8 fd 12 00 00       	call   3870 <printf>
+      exit();
+    2573:	e8 08 0c 00 00       	call   3180 <exit>
+    printf(1, "cannot open bigfile\n");
+    2578:	53                   	push   %ebx
+    2579:	53                   	push   %ebx
+    257a:	68 ce 4a 00 00       	push   $0x4ace
+    257f:	6a 01                	push   $0x1
+    2581:	e8 ea 12 00 00       	call   3870 <printf>
+    exit();
+    2586:	e8 f5 0b 00 00       	call   3180 <exit>
+    printf(1, "cannot create bigfile");
+    258b:	50                   	push   %eax
+    258c:	50                   	push   %eax
+    258d:	68 a2 4a 00 00       	push   $0x4aa2
+    2592:	6a 01                	push   $0x1
+    2594:	e8 d7 12 00 00       	call   3870 <printf>
+    exit();
+    2599:	e8 e2 0b 00 00       	call   3180 <exit>
+    printf(1, "read bigfile wrong total\n");
+    259e:	51                   	push   %ecx
+    259f:	51                   	push   %ecx
+    25a0:	68 25 4b 00 00       	push   $0x4b25
+    25a5:	6a 01                	push   $0x1
+    25a7:	e8 c4 12 00 00       	call   3870 <printf>
+    exit();
+    25ac:	e8 cf 0b 00 00       	call   3180 <exit>
+    25b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25bf:	90                   	nop
+
+000025c0 <fourteen>:
+{
+    25c0:	55                   	push   %ebp
+    25c1:	89 e5                	mov    %esp,%ebp
+    25c3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    25c6:	68 50 4b 00 00       	push   $0x4b50
+    25cb:	6a 01                	push   $0x1
+    25cd:	e8 9e 12 00 00       	call   3870 <printf>
+  if(mkdir("12345678901234") != 0){
+    25d2:	c7 04 24 8b 4b 00 00 	movl   $0x4b8b,(%esp)
+    25d9:	e8 7d 0f 00 00       	call   355b <mkdir>
+    25de:	83 c4 10             	add    $0x10,%esp
+    25e1:	85 c0                	test   %eax,%eax
+    25e3:	0f 85 97 00 00 00    	jne    2680 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    25e9:	83 ec 0c             	sub    $0xc,%esp
+    25ec:	68 90 52 00 00       	push   $0x5290
+    25f1:	e8 65 0f 00 00       	call   355b <mkdir>
+    25f6:	83 c4 10             	add    $0x10,%esp
+    25f9:	85 c0                	test   %eax,%eax
+    25fb:	0f 85 de 00 00 00    	jne    26df <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2601:	83 ec 08             	sub    $0x8,%esp
+    2604:	68 00 02 00 00       	push   $0x200
+    2609:	68 e0 52 00 00       	push   $0x52e0
+    260e:	e8 20 0f 00 00       	call   3533 <open>
+  if(fd < 0){
+    2613:	83 c4 10             	add    $0x10,%esp
+    2616:	85 c0                	test   %eax,%eax
+    2618:	0f 88 ae 00 00 00    	js     26cc <fourteen+0x10c>
+  close(fd);
+    261e:	83 ec 0c             	sub    $0xc,%esp
+    2621:	50                   	push   %eax
+    2622:	e8 f4 0e 00 00       	call   351b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2627:	58                   	pop    %eax
+    2628:	5a                   	pop    %edx
+    2629:	6a 00                	push   $0x0
+    262b:	68 50 53 00 00       	push   $0x5350
+    2630:	e8 fe 0e 00 00       	call   3533 <open>
+  if(fd < 0){
+    2635:	83 c4 10             	add    $0x10,%esp
+    2638:	85 c0                	test   %eax,%eax
+    263a:	78 7d                	js     26b9 <fourteen+0xf9>
+  close(fd);
+    263c:	83 ec 0c             	sub    $0xc,%esp
+    263f:	50                   	push   %eax
+    2640:	e8 d6 0e 00 00       	call   351b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2645:	c7 04 24 7c 4b 00 00 	movl   $0x4b7c,(%esp)
+    264c:	e8 0a 0f 00 00       	call   355b <mkdir>
+    2651:	83 c4 10             	add    $0x10,%esp
+    2654:	85 c0                	test   %eax,%eax
+    2656:	74 4e                	je     26a6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2658:	83 ec 0c             	sub    $0xc,%esp
+    265b:	68 ec 53 00 00       	push   $0x53ec
+    2660:	e8 f6 0e 00 00       	call   355b <mkdir>
+    2665:	83 c4 10             	add    $0x10,%esp
+    2668:	85 c0                	test   %eax,%eax
+    266a:	74 27                	je     2693 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    266c:	83 ec 08             	sub    $0x8,%esp
+    266f:	68 9a 4b 00 00       	push   $0x4b9a
+    2674:	6a 01                	push   $0x1
+    2676:	e8 f5 11 00 00       	call   3870 <printf>
+}
+    267b:	83 c4 10             	add    $0x10,%esp
+    267e:	c9                   	leave
+    267f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2680:	50                   	push   %eax
+    2681:	50                   	push   %eax
+    2682:	68 5f 4b 00 00       	push   $0x4b5f
+    2687:	6a 01                	push   $0x1
+    2689:	e8 e2 11 00 00       	call   3870 <printf>
+    exit();
+    268e:	e8 ed 0a 00 00       	call   3180 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2693:	50                   	push   %eax
+    2694:	50                   	push   %eax
+    2695:	68 0c 54 00 00       	push   $0x540c
+    269a:	6a 01                	push   $0x1
+    269c:	e8 cf 11 00 00       	call   3870 <printf>
+    exit();
+    26a1:	e8 da 0a 00 00       	call   3180 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    26a6:	52                   	push   %edx
+    26a7:	52                   	push   %edx
+    26a8:	68 bc 53 00 00       	push   $0x53bc
+    26ad:	6a 01                	push   $0x1
+    26af:	e8 bc 11 00 00       	call   3870 <printf>
+    exit();
+    26b4:	e8 c7 0a 00 00       	call   3180 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    26b9:	51                   	push   %ecx
+    26ba:	51                   	push   %ecx
+    26bb:	68 80 53 00 00       	push   $0x5380
+    26c0:	6a 01                	push   $0x1
+    26c2:	e8 a9 11 00 00       	call   3870 <printf>
+    exit();
+    26c7:	e8 b4 0a 00 00       	call   3180 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    26cc:	51                   	push   %ecx
+    26cd:	51                   	push   %ecx
+    26ce:	68 10 53 00 00       	push   $0x5310
+    26d3:	6a 01                	push   $0x1
+    26d5:	e8 96 11 00 00       	call   3870 <printf>
+    exit();
+    26da:	e8 a1 0a 00 00       	call   3180 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    26df:	50                   	push   %eax
+    26e0:	50                   	push   %eax
+    26e1:	68 b0 52 00 00       	push   $0x52b0
+    26e6:	6a 01                	push   $0x1
+    26e8:	e8 83 11 00 00       	call   3870 <printf>
+    exit();
+    26ed:	e8 8e 0a 00 00       	call   3180 <exit>
+    26f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002700 <rmdot>:
+{
+    2700:	55                   	push   %ebp
+    2701:	89 e5                	mov    %esp,%ebp
+    2703:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2706:	68 a7 4b 00 00       	push   $0x4ba7
+    270b:	6a 01                	push   $0x1
+    270d:	e8 5e 11 00 00       	call   3870 <printf>
+  if(mkdir("dots") != 0){
+    2712:	c7 04 24 b3 4b 00 00 	movl   $0x4bb3,(%esp)
+    2719:	e8 3d 0e 00 00       	call   355b <mkdir>
+    271e:	83 c4 10             	add    $0x10,%esp
+    2721:	85 c0                	test   %eax,%eax
+    2723:	0f 85 b0 00 00 00    	jne    27d9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2729:	83 ec 0c             	sub    $0xc,%esp
+    272c:	68 b3 4b 00 00       	push   $0x4bb3
+    2731:	e8 2d 0e 00 00       	call   3563 <chdir>
+    2736:	83 c4 10             	add    $0x10,%esp
+    2739:	85 c0                	test   %eax,%eax
+    273b:	0f 85 1d 01 00 00    	jne    285e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2741:	83 ec 0c             	sub    $0xc,%esp
+    2744:	68 5e 48 00 00       	push   $0x485e
+    2749:	e8 f5 0d 00 00       	call   3543 <unlink>
+    274e:	83 c4 10             	add    $0x10,%esp
+    2751:	85 c0                	test   %eax,%eax
+    2753:	0f 84 f2 00 00 00    	je     284b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2759:	83 ec 0c             	sub    $0xc,%esp
+    275c:	68 5d 48 00 00       	push   $0x485d
+    2761:	e8 dd 0d 00 00       	call   3543 <unlink>
+    2766:	83 c4 10             	add    $0x10,%esp
+    2769:	85 c0                	test   %eax,%eax
+    276b:	0f 84 c7 00 00 00    	je     2838 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2771:	83 ec 0c             	sub    $0xc,%esp
+    2774:	68 5d 40 00 00       	push   $0x405d
+    2779:	e8 e5 0d 00 00       	call   3563 <chdir>
+    277e:	83 c4 10             	add    $0x10,%esp
+    2781:	85 c0                	test   %eax,%eax
+    2783:	0f 85 9c 00 00 00    	jne    2825 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2789:	83 ec 0c             	sub    $0xc,%esp
+    278c:	68 fb 4b 00 00       	push   $0x4bfb
+    2791:	e8 ad 0d 00 00       	call   3543 <unlink>
+    2796:	83 c4 10             	add    $0x10,%esp
+    2799:	85 c0                	test   %eax,%eax
+    279b:	74 75                	je     2812 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    279d:	83 ec 0c             	sub    $0xc,%esp
+    27a0:	68 19 4c 00 00       	push   $0x4c19
+    27a5:	e8 99 0d 00 00       	call   3543 <unlink>
+    27aa:	83 c4 10             	add    $0x10,%esp
+    27ad:	85 c0                	test   %eax,%eax
+    27af:	74 4e                	je     27ff <rmdot+0xff>
+  if(unlink("dots") != 0){
+    27b1:	83 ec 0c             	sub    $0xc,%esp
+    27b4:	68 b3 4b 00 00       	push   $0x4bb3
+    27b9:	e8 85 0d 00 00       	call   3543 <unlink>
+    27be:	83 c4 10             	add    $0x10,%esp
+    27c1:	85 c0                	test   %eax,%eax
+    27c3:	75 27                	jne    27ec <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    27c5:	83 ec 08             	sub    $0x8,%esp
+    27c8:	68 4e 4c 00 00       	push   $0x4c4e
+    27cd:	6a 01                	push   $0x1
+    27cf:	e8 9c 10 00 00       	call   3870 <printf>
+}
+    27d4:	83 c4 10             	add    $0x10,%esp
+    27d7:	c9                   	leave
+    27d8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    27d9:	50                   	push   %eax
+    27da:	50                   	push   %eax
+    27db:	68 b8 4b 00 00       	push   $0x4bb8
+    27e0:	6a 01                	push   $0x1
+    27e2:	e8 89 10 00 00       	call   3870 <printf>
+    exit();
+    27e7:	e8 94 09 00 00       	call   3180 <exit>
+    printf(1, "unlink dots failed!\n");
+    27ec:	50                   	push   %eax
+    27ed:	50                   	push   %eax
+    27ee:	68 39 4c 00 00       	push   $0x4c39
+    27f3:	6a 01                	push   $0x1
+    27f5:	e8 76 10 00 00       	call   3870 <printf>
+    exit();
+    27fa:	e8 81 09 00 00       	call   3180 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    27ff:	52                   	push   %edx
+    2800:	52                   	push   %edx
+    2801:	68 21 4c 00 00       	push   $0x4c21
+    2806:	6a 01                	push   $0x1
+    2808:	e8 63 10 00 00       	call   3870 <printf>
+    exit();
+    280d:	e8 6e 09 00 00       	call   3180 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2812:	51                   	push   %ecx
+    2813:	51                   	push   %ecx
+    2814:	68 02 4c 00 00       	push   $0x4c02
+    2819:	6a 01                	push   $0x1
+    281b:	e8 50 10 00 00       	call   3870 <printf>
+    exit();
+    2820:	e8 5b 09 00 00       	call   3180 <exit>
+    printf(1, "chdir / failed\n");
+    2825:	50                   	push   %eax
+    2826:	50                   	push   %eax
+    2827:	68 5f 40 00 00       	push   $0x405f
+    282c:	6a 01                	push   $0x1
+    282e:	e8 3d 10 00 00       	call   3870 <printf>
+    exit();
+    2833:	e8 48 09 00 00       	call   3180 <exit>
+    printf(1, "rm .. worked!\n");
+    2838:	50                   	push   %eax
+    2839:	50                   	push   %eax
+    283a:	68 ec 4b 00 00       	push   $0x4bec
+    283f:	6a 01                	push   $0x1
+    2841:	e8 2a 10 00 00       	call   3870 <printf>
+    exit();
+    2846:	e8 35 09 00 00       	call   3180 <exit>
+    printf(1, "rm . worked!\n");
+    284b:	50                   	push   %eax
+    284c:	50                   	push   %eax
+    284d:	68 de 4b 00 00       	push   $0x4bde
+    2852:	6a 01                	push   $0x1
+    2854:	e8 17 10 00 00       	call   3870 <printf>
+    exit();
+    2859:	e8 22 09 00 00       	call   3180 <exit>
+    printf(1, "chdir dots failed\n");
+    285e:	50                   	push   %eax
+    285f:	50                   	push   %eax
+    2860:	68 cb 4b 00 00       	push   $0x4bcb
+    2865:	6a 01                	push   $0x1
+    2867:	e8 04 10 00 00       	call   3870 <printf>
+    exit();
+    286c:	e8 0f 09 00 00       	call   3180 <exit>
+    2871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    287f:	90                   	nop
+
+00002880 <dirfile>:
+{
+    2880:	55                   	push   %ebp
+    2881:	89 e5                	mov    %esp,%ebp
+    2883:	53                   	push   %ebx
+    2884:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2887:	68 58 4c 00 00       	push   $0x4c58
+    288c:	6a 01                	push   $0x1
+    288e:	e8 dd 0f 00 00       	call   3870 <printf>
+  fd = open("dirfile", O_CREATE);
+    2893:	5b                   	pop    %ebx
+    2894:	58                   	pop    %eax
+    2895:	68 00 02 00 00       	push   $0x200
+    289a:	68 65 4c 00 00       	push   $0x4c65
+    289f:	e8 8f 0c 00 00       	call   3533 <open>
+  if(fd < 0){
+    28a4:	83 c4 10             	add    $0x10,%esp
+    28a7:	85 c0                	test   %eax,%eax
+    28a9:	0f 88 43 01 00 00    	js     29f2 <dirfile+0x172>
+  close(fd);
+    28af:	83 ec 0c             	sub    $0xc,%esp
+    28b2:	50                   	push   %eax
+    28b3:	e8 63 0c 00 00       	call   351b <close>
+  if(chdir("dirfile") == 0){
+    28b8:	c7 04 24 65 4c 00 00 	movl   $0x4c65,(%esp)
+    28bf:	e8 9f 0c 00 00       	call   3563 <chdir>
+    28c4:	83 c4 10             	add    $0x10,%esp
+    28c7:	85 c0                	test   %eax,%eax
+    28c9:	0f 84 10 01 00 00    	je     29df <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    28cf:	83 ec 08             	sub    $0x8,%esp
+    28d2:	6a 00                	push   $0x0
+    28d4:	68 9e 4c 00 00       	push   $0x4c9e
+    28d9:	e8 55 0c 00 00       	call   3533 <open>
+  if(fd >= 0){
+    28de:	83 c4 10             	add    $0x10,%esp
+    28e1:	85 c0                	test   %eax,%eax
+    28e3:	0f 89 e3 00 00 00    	jns    29cc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    28e9:	83 ec 08             	sub    $0x8,%esp
+    28ec:	68 00 02 00 00       	push   $0x200
+    28f1:	68 9e 4c 00 00       	push   $0x4c9e
+    28f6:	e8 38 0c 00 00       	call   3533 <open>
+  if(fd >= 0){
+    28fb:	83 c4 10             	add    $0x10,%esp
+    28fe:	85 c0                	test   %eax,%eax
+    2900:	0f 89 c6 00 00 00    	jns    29cc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2906:	83 ec 0c             	sub    $0xc,%esp
+    2909:	68 9e 4c 00 00       	push   $0x4c9e
+    290e:	e8 48 0c 00 00       	call   355b <mkdir>
+    2913:	83 c4 10             	add    $0x10,%esp
+    2916:	85 c0                	test   %eax,%eax
+    2918:	0f 84 46 01 00 00    	je     2a64 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    291e:	83 ec 0c             	sub    $0xc,%esp
+    2921:	68 9e 4c 00 00       	push   $0x4c9e
+    2926:	e8 18 0c 00 00       	call   3543 <unlink>
+    292b:	83 c4 10             	add    $0x10,%esp
+    292e:	85 c0                	test   %eax,%eax
+    2930:	0f 84 1b 01 00 00    	je     2a51 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2936:	83 ec 08             	sub    $0x8,%esp
+    2939:	68 9e 4c 00 00       	push   $0x4c9e
+    293e:	68 02 4d 00 00       	push   $0x4d02
+    2943:	e8 0b 0c 00 00       	call   3553 <link>
+    2948:	83 c4 10             	add    $0x10,%esp
+    294b:	85 c0                	test   %eax,%eax
+    294d:	0f 84 eb 00 00 00    	je     2a3e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2953:	83 ec 0c             	sub    $0xc,%esp
+    2956:	68 65 4c 00 00       	push   $0x4c65
+    295b:	e8 e3 0b 00 00       	call   3543 <unlink>
+    2960:	83 c4 10             	add    $0x10,%esp
+    2963:	85 c0                	test   %eax,%eax
+    2965:	0f 85 c0 00 00 00    	jne    2a2b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    296b:	83 ec 08             	sub    $0x8,%esp
+    296e:	6a 02                	push   $0x2
+    2970:	68 5e 48 00 00       	push   $0x485e
+    2975:	e8 b9 0b 00 00       	call   3533 <open>
+  if(fd >= 0){
+    297a:	83 c4 10             	add    $0x10,%esp
+    297d:	85 c0                	test   %eax,%eax
+    297f:	0f 89 93 00 00 00    	jns    2a18 <dirfile+0x198>
+  fd = open(".", 0);
+    2985:	83 ec 08             	sub    $0x8,%esp
+    2988:	6a 00                	push   $0x0
+    298a:	68 5e 48 00 00       	push   $0x485e
+    298f:	e8 9f 0b 00 00       	call   3533 <open>
+  if(write(fd, "x", 1) > 0){
+    2994:	83 c4 0c             	add    $0xc,%esp
+    2997:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2999:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    299b:	68 41 49 00 00       	push   $0x4941
+    29a0:	50                   	push   %eax
+    29a1:	e8 6d 0b 00 00       	call   3513 <write>
+    29a6:	83 c4 10             	add    $0x10,%esp
+    29a9:	85 c0                	test   %eax,%eax
+    29ab:	7f 58                	jg     2a05 <dirfile+0x185>
+  close(fd);
+    29ad:	83 ec 0c             	sub    $0xc,%esp
+    29b0:	53                   	push   %ebx
+    29b1:	e8 65 0b 00 00       	call   351b <close>
+  printf(1, "dir vs file OK\n");
+    29b6:	58                   	pop    %eax
+    29b7:	5a                   	pop    %edx
+    29b8:	68 35 4d 00 00       	push   $0x4d35
+    29bd:	6a 01                	push   $0x1
+    29bf:	e8 ac 0e 00 00       	call   3870 <printf>
+}
+    29c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    29c7:	83 c4 10             	add    $0x10,%esp
+    29ca:	c9                   	leave
+    29cb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    29cc:	50                   	push   %eax
+    29cd:	50                   	push   %eax
+    29ce:	68 a9 4c 00 00       	push   $0x4ca9
+    29d3:	6a 01                	push   $0x1
+    29d5:	e8 96 0e 00 00       	call   3870 <printf>
+    exit();
+    29da:	e8 a1 07 00 00       	call   3180 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    29df:	52                   	push   %edx
+    29e0:	52                   	push   %edx
+    29e1:	68 84 4c 00 00       	push   $0x4c84
+    29e6:	6a 01                	push   $0x1
+    29e8:	e8 83 0e 00 00       	call   3870 <printf>
+    exit();
+    29ed:	e8 8e 07 00 00       	call   3180 <exit>
+    printf(1, "create dirfile failed\n");
+    29f2:	51                   	push   %ecx
+    29f3:	51                   	push   %ecx
+    29f4:	68 6d 4c 00 00       	push   $0x4c6d
+    29f9:	6a 01                	push   $0x1
+    29fb:	e8 70 0e 00 00       	call   3870 <printf>
+    exit();
+    2a00:	e8 7b 07 00 00       	call   3180 <exit>
+    printf(1, "write . succeeded!\n");
+    2a05:	51                   	push   %ecx
+    2a06:	51                   	push   %ecx
+    2a07:	68 21 4d 00 00       	push   $0x4d21
+    2a0c:	6a 01                	push   $0x1
+    2a0e:	e8 5d 0e 00 00       	call   3870 <printf>
+    exit();
+    2a13:	e8 68 07 00 00       	call   3180 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2a18:	53                   	push   %ebx
+    2a19:	53                   	push   %ebx
+    2a1a:	68 60 54 00 00       	push   $0x5460
+    2a1f:	6a 01                	push   $0x1
+    2a21:	e8 4a 0e 00 00       	call   3870 <printf>
+    exit();
+    2a26:	e8 55 07 00 00       	call   3180 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2a2b:	50                   	push   %eax
+    2a2c:	50                   	push   %eax
+    2a2d:	68 09 4d 00 00       	push   $0x4d09
+    2a32:	6a 01                	push   $0x1
+    2a34:	e8 37 0e 00 00       	call   3870 <printf>
+    exit();
+    2a39:	e8 42 07 00 00       	call   3180 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2a3e:	50                   	push   %eax
+    2a3f:	50                   	push   %eax
+    2a40:	68 40 54 00 00       	push   $0x5440
+    2a45:	6a 01                	push   $0x1
+    2a47:	e8 24 0e 00 00       	call   3870 <printf>
+    exit();
+    2a4c:	e8 2f 07 00 00       	call   3180 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2a51:	50                   	push   %eax
+    2a52:	50                   	push   %eax
+    2a53:	68 e4 4c 00 00       	push   $0x4ce4
+    2a58:	6a 01                	push   $0x1
+    2a5a:	e8 11 0e 00 00       	call   3870 <printf>
+    exit();
+    2a5f:	e8 1c 07 00 00       	call   3180 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2a64:	50                   	push   %eax
+    2a65:	50                   	push   %eax
+    2a66:	68 c7 4c 00 00       	push   $0x4cc7
+    2a6b:	6a 01                	push   $0x1
+    2a6d:	e8 fe 0d 00 00       	call   3870 <printf>
+    exit();
+    2a72:	e8 09 07 00 00       	call   3180 <exit>
+    2a77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a7e:	66 90                	xchg   %ax,%ax
+
+00002a80 <iref>:
+{
+    2a80:	55                   	push   %ebp
+    2a81:	89 e5                	mov    %esp,%ebp
+    2a83:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2a84:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2a89:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2a8c:	68 45 4d 00 00       	push   $0x4d45
+    2a91:	6a 01                	push   $0x1
+    2a93:	e8 d8 0d 00 00       	call   3870 <printf>
+    2a98:	83 c4 10             	add    $0x10,%esp
+    2a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a9f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2aa0:	83 ec 0c             	sub    $0xc,%esp
+    2aa3:	68 56 4d 00 00       	push   $0x4d56
+    2aa8:	e8 ae 0a 00 00       	call   355b <mkdir>
+    2aad:	83 c4 10             	add    $0x10,%esp
+    2ab0:	85 c0                	test   %eax,%eax
+    2ab2:	0f 85 bb 00 00 00    	jne    2b73 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2ab8:	83 ec 0c             	sub    $0xc,%esp
+    2abb:	68 56 4d 00 00       	push   $0x4d56
+    2ac0:	e8 9e 0a 00 00       	call   3563 <chdir>
+    2ac5:	83 c4 10             	add    $0x10,%esp
+    2ac8:	85 c0                	test   %eax,%eax
+    2aca:	0f 85 b7 00 00 00    	jne    2b87 <iref+0x107>
+    mkdir("");
+    2ad0:	83 ec 0c             	sub    $0xc,%esp
+    2ad3:	68 34 4d 00 00       	push   $0x4d34
+    2ad8:	e8 7e 0a 00 00       	call   355b <mkdir>
+    link("README", "");
+    2add:	59                   	pop    %ecx
+    2ade:	58                   	pop    %eax
+    2adf:	68 34 4d 00 00       	push   $0x4d34
+    2ae4:	68 02 4d 00 00       	push   $0x4d02
+    2ae9:	e8 65 0a 00 00       	call   3553 <link>
+    fd = open("", O_CREATE);
+    2aee:	58                   	pop    %eax
+    2aef:	5a                   	pop    %edx
+    2af0:	68 00 02 00 00       	push   $0x200
+    2af5:	68 34 4d 00 00       	push   $0x4d34
+    2afa:	e8 34 0a 00 00       	call   3533 <open>
+    if(fd >= 0)
+    2aff:	83 c4 10             	add    $0x10,%esp
+    2b02:	85 c0                	test   %eax,%eax
+    2b04:	78 0c                	js     2b12 <iref+0x92>
+      close(fd);
+    2b06:	83 ec 0c             	sub    $0xc,%esp
+    2b09:	50                   	push   %eax
+    2b0a:	e8 0c 0a 00 00       	call   351b <close>
+    2b0f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2b12:	83 ec 08             	sub    $0x8,%esp
+    2b15:	68 00 02 00 00       	push   $0x200
+    2b1a:	68 40 49 00 00       	push   $0x4940
+    2b1f:	e8 0f 0a 00 00       	call   3533 <open>
+    if(fd >= 0)
+    2b24:	83 c4 10             	add    $0x10,%esp
+    2b27:	85 c0                	test   %eax,%eax
+    2b29:	78 0c                	js     2b37 <iref+0xb7>
+      close(fd);
+    2b2b:	83 ec 0c             	sub    $0xc,%esp
+    2b2e:	50                   	push   %eax
+    2b2f:	e8 e7 09 00 00       	call   351b <close>
+    2b34:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2b37:	83 ec 0c             	sub    $0xc,%esp
+    2b3a:	68 40 49 00 00       	push   $0x4940
+    2b3f:	e8 ff 09 00 00       	call   3543 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2b44:	83 c4 10             	add    $0x10,%esp
+    2b47:	83 eb 01             	sub    $0x1,%ebx
+    2b4a:	0f 85 50 ff ff ff    	jne    2aa0 <iref+0x20>
+  chdir("/");
+    2b50:	83 ec 0c             	sub    $0xc,%esp
+    2b53:	68 5d 40 00 00       	push   $0x405d
+    2b58:	e8 06 0a 00 00       	call   3563 <chdir>
+  printf(1, "empty file name OK\n");
+    2b5d:	58                   	pop    %eax
+    2b5e:	5a                   	pop    %edx
+    2b5f:	68 84 4d 00 00       	push   $0x4d84
+    2b64:	6a 01                	push   $0x1
+    2b66:	e8 05 0d 00 00       	call   3870 <printf>
+}
+    2b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b6e:	83 c4 10             	add    $0x10,%esp
+    2b71:	c9                   	leave
+    2b72:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2b73:	83 ec 08             	sub    $0x8,%esp
+    2b76:	68 5c 4d 00 00       	push   $0x4d5c
+    2b7b:	6a 01                	push   $0x1
+    2b7d:	e8 ee 0c 00 00       	call   3870 <printf>
+      exit();
+    2b82:	e8 f9 05 00 00       	call   3180 <exit>
+      printf(1, "chdir irefd failed\n");
+    2b87:	83 ec 08             	sub    $0x8,%esp
+    2b8a:	68 70 4d 00 00       	push   $0x4d70
+    2b8f:	6a 01                	push   $0x1
+    2b91:	e8 da 0c 00 00       	call   3870 <printf>
+      exit();
+    2b96:	e8 e5 05 00 00       	call   3180 <exit>
+    2b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2b9f:	90                   	nop
+
+00002ba0 <forktest>:
+{
+    2ba0:	55                   	push   %ebp
+    2ba1:	89 e5                	mov    %esp,%ebp
+    2ba3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2ba4:	31 db                	xor    %ebx,%ebx
+{
+    2ba6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2ba9:	68 98 4d 00 00       	push   $0x4d98
+    2bae:	6a 01                	push   $0x1
+    2bb0:	e8 bb 0c 00 00       	call   3870 <printf>
+    2bb5:	83 c4 10             	add    $0x10,%esp
+    2bb8:	eb 13                	jmp    2bcd <forktest+0x2d>
+    2bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2bc0:	74 4d                	je     2c0f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2bc2:	83 c3 01             	add    $0x1,%ebx
+    2bc5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2bcb:	74 6e                	je     2c3b <forktest+0x9b>
+    pid = fork();
+    2bcd:	e8 7e 05 00 00       	call   3150 <fork>
+    if(pid < 0)
+    2bd2:	85 c0                	test   %eax,%eax
+    2bd4:	79 ea                	jns    2bc0 <forktest+0x20>
+  for(; n > 0; n--){
+    2bd6:	85 db                	test   %ebx,%ebx
+    2bd8:	74 14                	je     2bee <forktest+0x4e>
+    2bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2be0:	e8 16 09 00 00       	call   34fb <wait>
+    2be5:	85 c0                	test   %eax,%eax
+    2be7:	78 2b                	js     2c14 <forktest+0x74>
+  for(; n > 0; n--){
+    2be9:	83 eb 01             	sub    $0x1,%ebx
+    2bec:	75 f2                	jne    2be0 <forktest+0x40>
+  if(wait() != -1){
+    2bee:	e8 08 09 00 00       	call   34fb <wait>
+    2bf3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2bf6:	75 30                	jne    2c28 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2bf8:	83 ec 08             	sub    $0x8,%esp
+    2bfb:	68 ca 4d 00 00       	push   $0x4dca
+    2c00:	6a 01                	push   $0x1
+    2c02:	e8 69 0c 00 00       	call   3870 <printf>
+}
+    2c07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c0a:	83 c4 10             	add    $0x10,%esp
+    2c0d:	c9                   	leave
+    2c0e:	c3                   	ret
+      exit();
+    2c0f:	e8 6c 05 00 00       	call   3180 <exit>
+      printf(1, "wait stopped early\n");
+    2c14:	83 ec 08             	sub    $0x8,%esp
+    2c17:	68 a3 4d 00 00       	push   $0x4da3
+    2c1c:	6a 01                	push   $0x1
+    2c1e:	e8 4d 0c 00 00       	call   3870 <printf>
+      exit();
+    2c23:	e8 58 05 00 00       	call   3180 <exit>
+    printf(1, "wait got too many\n");
+    2c28:	50                   	push   %eax
+    2c29:	50                   	push   %eax
+    2c2a:	68 b7 4d 00 00       	push   $0x4db7
+    2c2f:	6a 01                	push   $0x1
+    2c31:	e8 3a 0c 00 00       	call   3870 <printf>
+    exit();
+    2c36:	e8 45 05 00 00       	call   3180 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2c3b:	52                   	push   %edx
+    2c3c:	52                   	push   %edx
+    2c3d:	68 80 54 00 00       	push   $0x5480
+    2c42:	6a 01                	push   $0x1
+    2c44:	e8 27 0c 00 00       	call   3870 <printf>
+    exit();
+    2c49:	e8 32 05 00 00       	call   3180 <exit>
+    2c4e:	66 90                	xchg   %ax,%ax
+
+00002c50 <validateint>:
+}
+    2c50:	c3                   	ret
+    2c51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c5f:	90                   	nop
+
+00002c60 <validatetest>:
+{
+    2c60:	55                   	push   %ebp
+    2c61:	89 e5                	mov    %esp,%ebp
+    2c63:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2c64:	31 f6                	xor    %esi,%esi
+{
+    2c66:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    2c67:	83 ec 08             	sub    $0x8,%esp
+    2c6a:	68 d8 4d 00 00       	push   $0x4dd8
+    2c6f:	ff 35 34 60 00 00    	push   0x6034
+    2c75:	e8 f6 0b 00 00       	call   3870 <printf>
+    2c7a:	83 c4 10             	add    $0x10,%esp
+    2c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    2c80:	e8 cb 04 00 00       	call   3150 <fork>
+    2c85:	89 c3                	mov    %eax,%ebx
+    2c87:	85 c0                	test   %eax,%eax
+    2c89:	74 63                	je     2cee <validatetest+0x8e>
+    sleep(0);
+    2c8b:	83 ec 0c             	sub    $0xc,%esp
+    2c8e:	6a 00                	push   $0x0
+    2c90:	e8 ee 08 00 00       	call   3583 <sleep>
+    sleep(0);
+    2c95:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2c9c:	e8 e2 08 00 00       	call   3583 <sleep>
+    kill(pid);
+    2ca1:	89 1c 24             	mov    %ebx,(%esp)
+    2ca4:	e8 7a 08 00 00       	call   3523 <kill>
+    wait();
+    2ca9:	e8 4d 08 00 00       	call   34fb <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    2cae:	58                   	pop    %eax
+    2caf:	5a                   	pop    %edx
+    2cb0:	56                   	push   %esi
+    2cb1:	68 e7 4d 00 00       	push   $0x4de7
+    2cb6:	e8 98 08 00 00       	call   3553 <link>
+    2cbb:	83 c4 10             	add    $0x10,%esp
+    2cbe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2cc1:	75 30                	jne    2cf3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    2cc3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    2cc9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    2ccf:	75 af                	jne    2c80 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    2cd1:	83 ec 08             	sub    $0x8,%esp
+    2cd4:	68 0b 4e 00 00       	push   $0x4e0b
+    2cd9:	ff 35 34 60 00 00    	push   0x6034
+    2cdf:	e8 8c 0b 00 00       	call   3870 <printf>
+}
+    2ce4:	83 c4 10             	add    $0x10,%esp
+    2ce7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2cea:	5b                   	pop    %ebx
+    2ceb:	5e                   	pop    %esi
+    2cec:	5d                   	pop    %ebp
+    2ced:	c3                   	ret
+      exit();
+    2cee:	e8 8d 04 00 00       	call   3180 <exit>
+      printf(stdout, "link should not succeed\n");
+    2cf3:	83 ec 08             	sub    $0x8,%esp
+    2cf6:	68 f2 4d 00 00       	push   $0x4df2
+    2cfb:	ff 35 34 60 00 00    	push   0x6034
+    2d01:	e8 6a 0b 00 00       	call   3870 <printf>
+      exit();
+    2d06:	e8 75 04 00 00       	call   3180 <exit>
+    2d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d0f:	90                   	nop
+
+00002d10 <bsstest>:
+{
+    2d10:	55                   	push   %ebp
+    2d11:	89 e5                	mov    %esp,%ebp
+    2d13:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    2d16:	68 18 4e 00 00       	push   $0x4e18
+    2d1b:	ff 35 34 60 00 00    	push   0x6034
+    2d21:	e8 4a 0b 00 00       	call   3870 <printf>
+    2d26:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    2d29:	31 c0                	xor    %eax,%eax
+    2d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d2f:	90                   	nop
+    if(uninit[i] != '\0'){
+    2d30:	80 b8 60 60 00 00 00 	cmpb   $0x0,0x6060(%eax)
+    2d37:	75 22                	jne    2d5b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    2d39:	83 c0 01             	add    $0x1,%eax
+    2d3c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    2d41:	75 ed                	jne    2d30 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    2d43:	83 ec 08             	sub    $0x8,%esp
+    2d46:	68 33 4e 00 00       	push   $0x4e33
+    2d4b:	ff 35 34 60 00 00    	push   0x6034
+    2d51:	e8 1a 0b 00 00       	call   3870 <printf>
+}
+    2d56:	83 c4 10             	add    $0x10,%esp
+    2d59:	c9                   	leave
+    2d5a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    2d5b:	83 ec 08             	sub    $0x8,%esp
+    2d5e:	68 22 4e 00 00       	push   $0x4e22
+    2d63:	ff 35 34 60 00 00    	push   0x6034
+    2d69:	e8 02 0b 00 00       	call   3870 <printf>
+      exit();
+    2d6e:	e8 0d 04 00 00       	call   3180 <exit>
+    2d73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002d80 <bigargtest>:
+{
+    2d80:	55                   	push   %ebp
+    2d81:	89 e5                	mov    %esp,%ebp
+    2d83:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    2d86:	68 40 4e 00 00       	push   $0x4e40
+    2d8b:	e8 b3 07 00 00       	call   3543 <unlink>
+  pid = fork();
+    2d90:	e8 bb 03 00 00       	call   3150 <fork>
+  if(pid == 0){
+    2d95:	83 c4 10             	add    $0x10,%esp
+    2d98:	85 c0                	test   %eax,%eax
+    2d9a:	74 44                	je     2de0 <bigargtest+0x60>
+  } else if(pid < 0){
+    2d9c:	0f 88 c3 00 00 00    	js     2e65 <bigargtest+0xe5>
+  wait();
+    2da2:	e8 54 07 00 00       	call   34fb <wait>
+  fd = open("bigarg-ok", 0);
+    2da7:	83 ec 08             	sub    $0x8,%esp
+    2daa:	6a 00                	push   $0x0
+    2dac:	68 40 4e 00 00       	push   $0x4e40
+    2db1:	e8 7d 07 00 00       	call   3533 <open>
+  if(fd < 0){
+    2db6:	83 c4 10             	add    $0x10,%esp
+    2db9:	85 c0                	test   %eax,%eax
+    2dbb:	0f 88 8d 00 00 00    	js     2e4e <bigargtest+0xce>
+  close(fd);
+    2dc1:	83 ec 0c             	sub    $0xc,%esp
+    2dc4:	50                   	push   %eax
+    2dc5:	e8 51 07 00 00       	call   351b <close>
+  unlink("bigarg-ok");
+    2dca:	c7 04 24 40 4e 00 00 	movl   $0x4e40,(%esp)
+    2dd1:	e8 6d 07 00 00       	call   3543 <unlink>
+}
+    2dd6:	83 c4 10             	add    $0x10,%esp
+    2dd9:	c9                   	leave
+    2dda:	c3                   	ret
+    2ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2ddf:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    2de0:	c7 04 85 80 a7 00 00 	movl   $0x54a4,0xa780(,%eax,4)
+    2de7:	a4 54 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    2deb:	83 c0 01             	add    $0x1,%eax
+    2dee:	83 f8 1f             	cmp    $0x1f,%eax
+    2df1:	75 ed                	jne    2de0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    2df3:	31 c9                	xor    %ecx,%ecx
+    2df5:	89 0d fc a7 00 00    	mov    %ecx,0xa7fc
+    printf(stdout, "bigarg test\n");
+    2dfb:	50                   	push   %eax
+    2dfc:	50                   	push   %eax
+    2dfd:	68 4a 4e 00 00       	push   $0x4e4a
+    2e02:	ff 35 34 60 00 00    	push   0x6034
+    2e08:	e8 63 0a 00 00       	call   3870 <printf>
+    exec("echo", args);
+    2e0d:	58                   	pop    %eax
+    2e0e:	5a                   	pop    %edx
+    2e0f:	68 80 a7 00 00       	push   $0xa780
+    2e14:	68 f9 40 00 00       	push   $0x40f9
+    2e19:	e8 82 03 00 00       	call   31a0 <exec>
+    printf(stdout, "bigarg test ok\n");
+    2e1e:	59                   	pop    %ecx
+    2e1f:	58                   	pop    %eax
+    2e20:	68 57 4e 00 00       	push   $0x4e57
+    2e25:	ff 35 34 60 00 00    	push   0x6034
+    2e2b:	e8 40 0a 00 00       	call   3870 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    2e30:	58                   	pop    %eax
+    2e31:	5a                   	pop    %edx
+    2e32:	68 00 02 00 00       	push   $0x200
+    2e37:	68 40 4e 00 00       	push   $0x4e40
+    2e3c:	e8 f2 06 00 00       	call   3533 <open>
+    close(fd);
+    2e41:	89 04 24             	mov    %eax,(%esp)
+    2e44:	e8 d2 06 00 00       	call   351b <close>
+    exit();
+    2e49:	e8 32 03 00 00       	call   3180 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    2e4e:	50                   	push   %eax
+    2e4f:	50                   	push   %eax
+    2e50:	68 80 4e 00 00       	push   $0x4e80
+    2e55:	ff 35 34 60 00 00    	push   0x6034
+    2e5b:	e8 10 0a 00 00       	call   3870 <printf>
+    exit();
+    2e60:	e8 1b 03 00 00       	call   3180 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    2e65:	52                   	push   %edx
+    2e66:	52                   	push   %edx
+    2e67:	68 67 4e 00 00       	push   $0x4e67
+    2e6c:	ff 35 34 60 00 00    	push   0x6034
+    2e72:	e8 f9 09 00 00       	call   3870 <printf>
+    exit();
+    2e77:	e8 04 03 00 00       	call   3180 <exit>
+    2e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002e80 <fsfull>:
+{
+    2e80:	55                   	push   %ebp
+    2e81:	89 e5                	mov    %esp,%ebp
+    2e83:	57                   	push   %edi
+    2e84:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    2e85:	31 f6                	xor    %esi,%esi
+{
+    2e87:	53                   	push   %ebx
+    2e88:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    2e8b:	68 95 4e 00 00       	push   $0x4e95
+    2e90:	6a 01                	push   $0x1
+    2e92:	e8 d9 09 00 00       	call   3870 <printf>
+    2e97:	83 c4 10             	add    $0x10,%esp
+    2e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    2ea0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    2ea5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    2eaa:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    2ead:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    2eb1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    2eb3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    2eb7:	c1 ea 06             	shr    $0x6,%edx
+    2eba:	8d 42 30             	lea    0x30(%edx),%eax
+    2ebd:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2ec0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    2ec6:	89 f2                	mov    %esi,%edx
+    2ec8:	29 c2                	sub    %eax,%edx
+    2eca:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    2ecf:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    2ed1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2ed6:	c1 ea 05             	shr    $0x5,%edx
+    2ed9:	83 c2 30             	add    $0x30,%edx
+    2edc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    2edf:	f7 e6                	mul    %esi
+    2ee1:	c1 ea 05             	shr    $0x5,%edx
+    2ee4:	6b c2 64             	imul   $0x64,%edx,%eax
+    2ee7:	89 f2                	mov    %esi,%edx
+    2ee9:	29 c2                	sub    %eax,%edx
+    2eeb:	89 d0                	mov    %edx,%eax
+    2eed:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    2eef:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    2ef1:	c1 ea 03             	shr    $0x3,%edx
+    2ef4:	83 c2 30             	add    $0x30,%edx
+    2ef7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    2efa:	f7 e1                	mul    %ecx
+    2efc:	89 f0                	mov    %esi,%eax
+    2efe:	c1 ea 03             	shr    $0x3,%edx
+    2f01:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    2f04:	01 d2                	add    %edx,%edx
+    2f06:	29 d0                	sub    %edx,%eax
+    2f08:	83 c0 30             	add    $0x30,%eax
+    2f0b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    2f0e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    2f11:	50                   	push   %eax
+    2f12:	68 a2 4e 00 00       	push   $0x4ea2
+    2f17:	6a 01                	push   $0x1
+    2f19:	e8 52 09 00 00       	call   3870 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    2f1e:	58                   	pop    %eax
+    2f1f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    2f22:	5a                   	pop    %edx
+    2f23:	68 02 02 00 00       	push   $0x202
+    2f28:	50                   	push   %eax
+    2f29:	e8 05 06 00 00       	call   3533 <open>
+    if(fd < 0){
+    2f2e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    2f31:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    2f33:	85 c0                	test   %eax,%eax
+    2f35:	78 4f                	js     2f86 <fsfull+0x106>
+    int total = 0;
+    2f37:	31 db                	xor    %ebx,%ebx
+    2f39:	eb 07                	jmp    2f42 <fsfull+0xc2>
+    2f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2f3f:	90                   	nop
+      total += cc;
+    2f40:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    2f42:	83 ec 04             	sub    $0x4,%esp
+    2f45:	68 00 02 00 00       	push   $0x200
+    2f4a:	68 80 87 00 00       	push   $0x8780
+    2f4f:	57                   	push   %edi
+    2f50:	e8 be 05 00 00       	call   3513 <write>
+      if(cc < 512)
+    2f55:	83 c4 10             	add    $0x10,%esp
+    2f58:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    2f5d:	7f e1                	jg     2f40 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    2f5f:	83 ec 04             	sub    $0x4,%esp
+    2f62:	53                   	push   %ebx
+    2f63:	68 be 4e 00 00       	push   $0x4ebe
+    2f68:	6a 01                	push   $0x1
+    2f6a:	e8 01 09 00 00       	call   3870 <printf>
+    close(fd);
+    2f6f:	89 3c 24             	mov    %edi,(%esp)
+    2f72:	e8 a4 05 00 00       	call   351b <close>
+    if(total == 0)
+    2f77:	83 c4 10             	add    $0x10,%esp
+    2f7a:	85 db                	test   %ebx,%ebx
+    2f7c:	74 1e                	je     2f9c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    2f7e:	83 c6 01             	add    $0x1,%esi
+    2f81:	e9 1a ff ff ff       	jmp    2ea0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    2f86:	83 ec 04             	sub    $0x4,%esp
+    2f89:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    2f8c:	50                   	push   %eax
+    2f8d:	68 ae 4e 00 00       	push   $0x4eae
+    2f92:	6a 01                	push   $0x1
+    2f94:	e8 d7 08 00 00       	call   3870 <printf>
+      break;
+    2f99:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    2f9c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2fa1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    2fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2fad:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    2fb0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    2fb2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    2fb5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    2fb9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    2fbb:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    2fbf:	c1 ea 06             	shr    $0x6,%edx
+    2fc2:	8d 42 30             	lea    0x30(%edx),%eax
+    2fc5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2fc8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    2fce:	89 f2                	mov    %esi,%edx
+    2fd0:	29 c2                	sub    %eax,%edx
+    2fd2:	89 d0                	mov    %edx,%eax
+    2fd4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    2fd6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2fd8:	c1 ea 05             	shr    $0x5,%edx
+    2fdb:	83 c2 30             	add    $0x30,%edx
+    2fde:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    2fe1:	f7 e3                	mul    %ebx
+    2fe3:	c1 ea 05             	shr    $0x5,%edx
+    2fe6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    2fe9:	89 f2                	mov    %esi,%edx
+    2feb:	29 ca                	sub    %ecx,%edx
+    2fed:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    2ff2:	89 d0                	mov    %edx,%eax
+    2ff4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    2ff6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    2ff8:	c1 ea 03             	shr    $0x3,%edx
+    2ffb:	83 c2 30             	add    $0x30,%edx
+    2ffe:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3001:	f7 e1                	mul    %ecx
+    3003:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3005:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3008:	c1 ea 03             	shr    $0x3,%edx
+    300b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    300e:	01 d2                	add    %edx,%edx
+    3010:	29 d0                	sub    %edx,%eax
+    3012:	83 c0 30             	add    $0x30,%eax
+    3015:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3018:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    301b:	50                   	push   %eax
+    301c:	e8 22 05 00 00       	call   3543 <unlink>
+  while(nfiles >= 0){
+    3021:	83 c4 10             	add    $0x10,%esp
+    3024:	83 fe ff             	cmp    $0xffffffff,%esi
+    3027:	75 87                	jne    2fb0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3029:	83 ec 08             	sub    $0x8,%esp
+    302c:	68 ce 4e 00 00       	push   $0x4ece
+    3031:	6a 01                	push   $0x1
+    3033:	e8 38 08 00 00       	call   3870 <printf>
+}
+    3038:	83 c4 10             	add    $0x10,%esp
+    303b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    303e:	5b                   	pop    %ebx
+    303f:	5e                   	pop    %esi
+    3040:	5f                   	pop    %edi
+    3041:	5d                   	pop    %ebp
+    3042:	c3                   	ret
+    3043:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    304a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003050 <uio>:
+{
+    3050:	55                   	push   %ebp
+    3051:	89 e5                	mov    %esp,%ebp
+    3053:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3056:	68 e4 4e 00 00       	push   $0x4ee4
+    305b:	6a 01                	push   $0x1
+    305d:	e8 0e 08 00 00       	call   3870 <printf>
+  pid = fork();
+    3062:	e8 e9 00 00 00       	call   3150 <fork>
+  if(pid == 0){
+    3067:	83 c4 10             	add    $0x10,%esp
+    306a:	85 c0                	test   %eax,%eax
+    306c:	74 1b                	je     3089 <uio+0x39>
+  } else if(pid < 0){
+    306e:	78 3d                	js     30ad <uio+0x5d>
+  wait();
+    3070:	e8 86 04 00 00       	call   34fb <wait>
+  printf(1, "uio test done\n");
+    3075:	83 ec 08             	sub    $0x8,%esp
+    3078:	68 ee 4e 00 00       	push   $0x4eee
+    307d:	6a 01                	push   $0x1
+    307f:	e8 ec 07 00 00       	call   3870 <printf>
+}
+    3084:	83 c4 10             	add    $0x10,%esp
+    3087:	c9                   	leave
+    3088:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3089:	b8 09 00 00 00       	mov    $0x9,%eax
+    308e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3093:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3094:	ba 71 00 00 00       	mov    $0x71,%edx
+    3099:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    309a:	52                   	push   %edx
+    309b:	52                   	push   %edx
+    309c:	68 84 55 00 00       	push   $0x5584
+    30a1:	6a 01                	push   $0x1
+    30a3:	e8 c8 07 00 00       	call   3870 <printf>
+    exit();
+    30a8:	e8 d3 00 00 00       	call   3180 <exit>
+    printf (1, "fork failed\n");
+    30ad:	50                   	push   %eax
+    30ae:	50                   	push   %eax
+    30af:	68 73 4e 00 00       	push   $0x4e73
+    30b4:	6a 01                	push   $0x1
+    30b6:	e8 b5 07 00 00       	call   3870 <printf>
+    exit();
+    30bb:	e8 c0 00 00 00       	call   3180 <exit>
+
+000030c0 <argptest>:
+{
+    30c0:	55                   	push   %ebp
+    30c1:	89 e5                	mov    %esp,%ebp
+    30c3:	53                   	push   %ebx
+    30c4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    30c7:	6a 00                	push   $0x0
+    30c9:	68 fd 4e 00 00       	push   $0x4efd
+    30ce:	e8 60 04 00 00       	call   3533 <open>
+  if (fd < 0) {
+    30d3:	83 c4 10             	add    $0x10,%esp
+    30d6:	85 c0                	test   %eax,%eax
+    30d8:	78 39                	js     3113 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    30da:	83 ec 0c             	sub    $0xc,%esp
+    30dd:	89 c3                	mov    %eax,%ebx
+    30df:	6a 00                	push   $0x0
+    30e1:	e8 95 04 00 00       	call   357b <sbrk>
+    30e6:	83 c4 0c             	add    $0xc,%esp
+    30e9:	83 e8 01             	sub    $0x1,%eax
+    30ec:	6a ff                	push   $0xffffffff
+    30ee:	50                   	push   %eax
+    30ef:	53                   	push   %ebx
+    30f0:	e8 16 04 00 00       	call   350b <read>
+  close(fd);
+    30f5:	89 1c 24             	mov    %ebx,(%esp)
+    30f8:	e8 1e 04 00 00       	call   351b <close>
+  printf(1, "arg test passed\n");
+    30fd:	58                   	pop    %eax
+    30fe:	5a                   	pop    %edx
+    30ff:	68 0f 4f 00 00       	push   $0x4f0f
+    3104:	6a 01                	push   $0x1
+    3106:	e8 65 07 00 00       	call   3870 <printf>
+}
+    310b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    310e:	83 c4 10             	add    $0x10,%esp
+    3111:	c9                   	leave
+    3112:	c3                   	ret
+    printf(2, "open failed\n");
+    3113:	51                   	push   %ecx
+    3114:	51                   	push   %ecx
+    3115:	68 02 4f 00 00       	push   $0x4f02
+    311a:	6a 02                	push   $0x2
+    311c:	e8 4f 07 00 00       	call   3870 <printf>
+    exit();
+    3121:	e8 5a 00 00 00       	call   3180 <exit>
+    3126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    312d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003130 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3130:	69 05 30 60 00 00 0d 	imul   $0x19660d,0x6030,%eax
+    3137:	66 19 00 
+    313a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    313f:	a3 30 60 00 00       	mov    %eax,0x6030
+}
+    3144:	c3                   	ret
+    3145:	66 90                	xchg   %ax,%ax
+    3147:	66 90                	xchg   %ax,%ax
+    3149:	66 90                	xchg   %ax,%ax
+    314b:	66 90                	xchg   %ax,%ax
+    314d:	66 90                	xchg   %ax,%ax
+    314f:	90                   	nop
+
+00003150 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+    3150:	a1 00 a8 00 00       	mov    0xa800,%eax
+    3155:	85 c0                	test   %eax,%eax
+    3157:	74 17                	je     3170 <fork+0x20>
+{
+    3159:	55                   	push   %ebp
+    315a:	89 e5                	mov    %esp,%ebp
+    315c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+    315f:	ff d0                	call   *%eax
+  return _fork();
+}
+    3161:	c9                   	leave
+  return _fork();
+    3162:	e9 84 03 00 00       	jmp    34eb <_fork>
+    3167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    316e:	66 90                	xchg   %ax,%ax
+    3170:	e9 76 03 00 00       	jmp    34eb <_fork>
+    3175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    317c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003180 <exit>:
+
+int
+exit(void)
+{
+    3180:	55                   	push   %ebp
+    3181:	89 e5                	mov    %esp,%ebp
+    3183:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+    3186:	a1 00 a8 00 00       	mov    0xa800,%eax
+    318b:	85 c0                	test   %eax,%eax
+    318d:	74 02                	je     3191 <exit+0x11>
+    stdioflush();
+    318f:	ff d0                	call   *%eax
+  _exit();
+    3191:	e8 5d 03 00 00       	call   34f3 <_exit>
+    3196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    319d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000031a0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    31a0:	55                   	push   %ebp
+  if(stdioflush)
+    31a1:	a1 00 a8 00 00       	mov    0xa800,%eax
+{
+    31a6:	89 e5                	mov    %esp,%ebp
+    31a8:	56                   	push   %esi
+    31a9:	53                   	push   %ebx
+    31aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    31ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+    31b0:	85 c0                	test   %eax,%eax
+    31b2:	74 02                	je     31b6 <exec+0x16>
+    stdioflush();
+    31b4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+    31b6:	89 75 0c             	mov    %esi,0xc(%ebp)
+    31b9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    31bc:	5b                   	pop    %ebx
+    31bd:	5e                   	pop    %esi
+    31be:	5d                   	pop    %ebp
+  return _exec(path, argv);
+    31bf:	e9 67 03 00 00       	jmp    352b <_exec>
+    31c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    31cf:	90                   	nop
+
+000031d0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+    31d0:	55                   	push   %ebp
+    31d1:	89 e5                	mov    %esp,%ebp
+    31d3:	57                   	push   %edi
+    31d4:	56                   	push   %esi
+    31d5:	53                   	push   %ebx
+    31d6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+    31d9:	a1 00 a8 00 00       	mov    0xa800,%eax
+{
+    31de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    31e1:	8b 75 0c             	mov    0xc(%ebp),%esi
+    31e4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+    31e7:	85 c0                	test   %eax,%eax
+    31e9:	74 02                	je     31ed <spawn+0x1d>
+    stdioflush();
+    31eb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+    31ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+    31f0:	89 75 0c             	mov    %esi,0xc(%ebp)
+    31f3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+    31f6:	83 c4 0c             	add    $0xc,%esp
+    31f9:	5b                   	pop    %ebx
+    31fa:	5e                   	pop    %esi
+    31fb:	5f                   	pop    %edi
+    31fc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+    31fd:	e9 79 04 00 00       	jmp    367b <_spawn>
+    3202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003210 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+    3210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3211:	31 c0                	xor    %eax,%eax
+{
+    3213:	89 e5                	mov    %esp,%ebp
+    3215:	53                   	push   %ebx
+    3216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    321c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3227:	83 c0 01             	add    $0x1,%eax
+    322a:	84 d2                	test   %dl,%dl
+    322c:	75 f2                	jne    3220 <strcpy+0x10>
+    ;
+  return os;
+}
+    322e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3231:	89 c8                	mov    %ecx,%eax
+    3233:	c9                   	leave
+    3234:	c3                   	ret
+    3235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    323c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3240:	55                   	push   %ebp
+    3241:	89 e5                	mov    %esp,%ebp
+    3243:	53                   	push   %ebx
+    3244:	8b 55 08             	mov    0x8(%ebp),%edx
+    3247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    324a:	0f b6 02             	movzbl (%edx),%eax
+    324d:	84 c0                	test   %al,%al
+    324f:	75 17                	jne    3268 <strcmp+0x28>
+    3251:	eb 3a                	jmp    328d <strcmp+0x4d>
+    3253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3257:	90                   	nop
+    3258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    325c:	83 c2 01             	add    $0x1,%edx
+    325f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3262:	84 c0                	test   %al,%al
+    3264:	74 1a                	je     3280 <strcmp+0x40>
+    p++, q++;
+    3266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3268:	0f b6 19             	movzbl (%ecx),%ebx
+    326b:	38 c3                	cmp    %al,%bl
+    326d:	74 e9                	je     3258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    326f:	29 d8                	sub    %ebx,%eax
+}
+    3271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3274:	c9                   	leave
+    3275:	c3                   	ret
+    3276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    327d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3284:	31 c0                	xor    %eax,%eax
+    3286:	29 d8                	sub    %ebx,%eax
+}
+    3288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    328b:	c9                   	leave
+    328c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    328d:	0f b6 19             	movzbl (%ecx),%ebx
+    3290:	31 c0                	xor    %eax,%eax
+    3292:	eb db                	jmp    326f <strcmp+0x2f>
+    3294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    329b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    329f:	90                   	nop
+
+000032a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    32a0:	55                   	push   %ebp
+    32a1:	89 e5                	mov    %esp,%ebp
+    32a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    32a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    32a9:	74 15                	je     32c0 <strlen+0x20>
+    32ab:	31 c0                	xor    %eax,%eax
+    32ad:	8d 76 00             	lea    0x0(%esi),%esi
+    32b0:	83 c0 01             	add    $0x1,%eax
+    32b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    32b7:	89 c1                	mov    %eax,%ecx
+    32b9:	75 f5                	jne    32b0 <strlen+0x10>
+    ;
+  return n;
+}
+    32bb:	89 c8                	mov    %ecx,%eax
+    32bd:	5d                   	pop    %ebp
+    32be:	c3                   	ret
+    32bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    32c0:	31 c9                	xor    %ecx,%ecx
+}
+    32c2:	5d                   	pop    %ebp
+    32c3:	89 c8                	mov    %ecx,%eax
+    32c5:	c3                   	ret
+    32c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000032d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    32d0:	55                   	push   %ebp
+    32d1:	89 e5                	mov    %esp,%ebp
+    32d3:	57                   	push   %edi
+    32d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    32d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    32da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    32dd:	89 d7                	mov    %edx,%edi
+    32df:	fc                   	cld
+    32e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    32e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    32e5:	89 d0                	mov    %edx,%eax
+    32e7:	c9                   	leave
+    32e8:	c3                   	ret
+    32e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000032f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    32f0:	55                   	push   %ebp
+    32f1:	89 e5                	mov    %esp,%ebp
+    32f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    32f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    32fa:	0f b6 10             	movzbl (%eax),%edx
+    32fd:	84 d2                	test   %dl,%dl
+    32ff:	75 12                	jne    3313 <strchr+0x23>
+    3301:	eb 1d                	jmp    3320 <strchr+0x30>
+    3303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3307:	90                   	nop
+    3308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    330c:	83 c0 01             	add    $0x1,%eax
+    330f:	84 d2                	test   %dl,%dl
+    3311:	74 0d                	je     3320 <strchr+0x30>
+    if(*s == c)
+    3313:	38 d1                	cmp    %dl,%cl
+    3315:	75 f1                	jne    3308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3317:	5d                   	pop    %ebp
+    3318:	c3                   	ret
+    3319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3320:	31 c0                	xor    %eax,%eax
+}
+    3322:	5d                   	pop    %ebp
+    3323:	c3                   	ret
+    3324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    332b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    332f:	90                   	nop
+
+00003330 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+    3330:	55                   	push   %ebp
+    3331:	89 e5                	mov    %esp,%ebp
+    3333:	57                   	push   %edi
+    3334:	56                   	push   %esi
+    3335:	53                   	push   %ebx
+    3336:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+    3339:	a1 00 a8 00 00       	mov    0xa800,%eax
+{
+    333e:	8b 75 08             	mov    0x8(%ebp),%esi
+    3341:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+    3344:	85 c0                	test   %eax,%eax
+    3346:	74 02                	je     334a <gets+0x1a>
+    stdioflush();
+    3348:	ff d0                	call   *%eax
+  if(in.size == 0)
+    334a:	a1 28 aa 00 00       	mov    0xaa28,%eax
+    334f:	85 c0                	test   %eax,%eax
+    3351:	0f 84 99 00 00 00    	je     33f0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    3357:	31 db                	xor    %ebx,%ebx
+    3359:	eb 21                	jmp    337c <gets+0x4c>
+    335b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    335f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+    3360:	8d 50 01             	lea    0x1(%eax),%edx
+    3363:	0f b6 80 20 a8 00 00 	movzbl 0xa820(%eax),%eax
+    336a:	89 15 20 aa 00 00    	mov    %edx,0xaa20
+    buf[i++] = c;
+    3370:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3374:	3c 0a                	cmp    $0xa,%al
+    3376:	74 60                	je     33d8 <gets+0xa8>
+    3378:	3c 0d                	cmp    $0xd,%al
+    337a:	74 5c                	je     33d8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+    337c:	89 da                	mov    %ebx,%edx
+    337e:	83 c3 01             	add    $0x1,%ebx
+    3381:	39 fb                	cmp    %edi,%ebx
+    3383:	7d 55                	jge    33da <gets+0xaa>
+    if(in.r == in.n){
+    3385:	a1 20 aa 00 00       	mov    0xaa20,%eax
+    338a:	3b 05 24 aa 00 00    	cmp    0xaa24,%eax
+    3390:	75 ce                	jne    3360 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    3392:	83 ec 04             	sub    $0x4,%esp
+    3395:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+    3398:	c7 05 24 aa 00 00 00 	movl   $0x0,0xaa24
+    339f:	00 00 00 
+    33a2:	c7 05 20 aa 00 00 00 	movl   $0x0,0xaa20
+    33a9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+    33ac:	ff 35 28 aa 00 00    	push   0xaa28
+    33b2:	68 20 a8 00 00       	push   $0xa820
+    33b7:	6a 00                	push   $0x0
+    33b9:	e8 4d 01 00 00       	call   350b <read>
+    33be:	83 c4 10             	add    $0x10,%esp
+    33c1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    33c4:	85 c0                	test   %eax,%eax
+    33c6:	a3 24 aa 00 00       	mov    %eax,0xaa24
+    33cb:	7e 56                	jle    3423 <gets+0xf3>
+    c = in.buf[in.r++];
+    33cd:	a1 20 aa 00 00       	mov    0xaa20,%eax
+    33d2:	eb 8c                	jmp    3360 <gets+0x30>
+    33d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+    33d8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+    33da:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+    33de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    33e1:	89 f0                	mov    %esi,%eax
+    33e3:	5b                   	pop    %ebx
+    33e4:	5e                   	pop    %esi
+    33e5:	5f                   	pop    %edi
+    33e6:	5d                   	pop    %ebp
+    33e7:	c3                   	ret
+    33e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33ef:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+    33f0:	83 ec 08             	sub    $0x8,%esp
+    33f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    33f6:	50                   	push   %eax
+    33f7:	6a 00                	push   $0x0
+    33f9:	e8 4d 01 00 00       	call   354b <fstat>
+    33fe:	83 c4 10             	add    $0x10,%esp
+    3401:	89 c2                	mov    %eax,%edx
+    3403:	b8 01 00 00 00       	mov    $0x1,%eax
+    3408:	85 d2                	test   %edx,%edx
+    340a:	75 0d                	jne    3419 <gets+0xe9>
+    340c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    3411:	ba 00 02 00 00       	mov    $0x200,%edx
+    3416:	0f 44 c2             	cmove  %edx,%eax
+    3419:	a3 28 aa 00 00       	mov    %eax,0xaa28
+    341e:	e9 34 ff ff ff       	jmp    3357 <gets+0x27>
+        in.n = 0;
+    3423:	c7 05 24 aa 00 00 00 	movl   $0x0,0xaa24
+    342a:	00 00 00 
+        break;
+    342d:	eb ab                	jmp    33da <gets+0xaa>
+    342f:	90                   	nop
+
+00003430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3430:	55                   	push   %ebp
+    3431:	89 e5                	mov    %esp,%ebp
+    3433:	56                   	push   %esi
+    3434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3435:	83 ec 08             	sub    $0x8,%esp
+    3438:	6a 00                	push   $0x0
+    343a:	ff 75 08             	push   0x8(%ebp)
+    343d:	e8 f1 00 00 00       	call   3533 <open>
+  if(fd < 0)
+    3442:	83 c4 10             	add    $0x10,%esp
+    3445:	85 c0                	test   %eax,%eax
+    3447:	78 27                	js     3470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3449:	83 ec 08             	sub    $0x8,%esp
+    344c:	ff 75 0c             	push   0xc(%ebp)
+    344f:	89 c3                	mov    %eax,%ebx
+    3451:	50                   	push   %eax
+    3452:	e8 f4 00 00 00       	call   354b <fstat>
+  close(fd);
+    3457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    345a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    345c:	e8 ba 00 00 00       	call   351b <close>
+  return r;
+    3461:	83 c4 10             	add    $0x10,%esp
+}
+    3464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3467:	89 f0                	mov    %esi,%eax
+    3469:	5b                   	pop    %ebx
+    346a:	5e                   	pop    %esi
+    346b:	5d                   	pop    %ebp
+    346c:	c3                   	ret
+    346d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3475:	eb ed                	jmp    3464 <stat+0x34>
+    3477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    347e:	66 90                	xchg   %ax,%ax
+
+00003480 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3480:	55                   	push   %ebp
+    3481:	89 e5                	mov    %esp,%ebp
+    3483:	53                   	push   %ebx
+    3484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3487:	0f be 02             	movsbl (%edx),%eax
+    348a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    348d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3495:	77 1e                	ja     34b5 <atoi+0x35>
+    3497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    349e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    34a0:	83 c2 01             	add    $0x1,%edx
+    34a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    34a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    34aa:	0f be 02             	movsbl (%edx),%eax
+    34ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    34b0:	80 fb 09             	cmp    $0x9,%bl
+    34b3:	76 eb                	jbe    34a0 <atoi+0x20>
+  return n;
+}
+    34b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    34b8:	89 c8                	mov    %ecx,%eax
+    34ba:	c9                   	leave
+    34bb:	c3                   	ret
+    34bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000034c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    34c0:	55                   	push   %ebp
+    34c1:	89 e5                	mov    %esp,%ebp
+    34c3:	57                   	push   %edi
+    34c4:	56                   	push   %esi
+    34c5:	8b 45 10             	mov    0x10(%ebp),%eax
+    34c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    34cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    34ce:	85 c0                	test   %eax,%eax
+    34d0:	7e 13                	jle    34e5 <memmove+0x25>
+    34d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    34d4:	89 d7                	mov    %edx,%edi
+    34d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    34e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    34e1:	39 f8                	cmp    %edi,%eax
+    34e3:	75 fb                	jne    34e0 <memmove+0x20>
+  return vdst;
+}
+    34e5:	5e                   	pop    %esi
+    34e6:	89 d0                	mov    %edx,%eax
+    34e8:	5f                   	pop    %edi
+    34e9:	5d                   	pop    %ebp
+    34ea:	c3                   	ret
+
+000034eb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+    34eb:	b8 01 00 00 00       	mov    $0x1,%eax
+    34f0:	cd 40                	int    $0x40
+    34f2:	c3                   	ret
+
+000034f3 <_exit>:
+RAWSYSCALL(exit)
+    34f3:	b8 02 00 00 00       	mov    $0x2,%eax
+    34f8:	cd 40                	int    $0x40
+    34fa:	c3                   	ret
+
+000034fb <wait>:
+SYSCALL(wait)
+    34fb:	b8 03 00 00 00       	mov    $0x3,%eax
+    3500:	cd 40                	int    $0x40
+    3502:	c3                   	ret
+
+00003503 <pipe>:
+SYSCALL(pipe)
+    3503:	b8 04 00 00 00       	mov    $0x4,%eax
+    3508:	cd 40                	int    $0x40
+    350a:	c3                   	ret
+
+0000350b <read>:
+SYSCALL(read)
+    350b:	b8 05 00 00 00       	mov    $0x5,%eax
+    3510:	cd 40                	int    $0x40
+    3512:	c3                   	ret
+
+00003513 <write>:
+SYSCALL(write)
+    3513:	b8 10 00 00 00       	mov    $0x10,%eax
+    3518:	cd 40                	int    $0x40
+    351a:	c3                   	ret
+
+0000351b <close>:
+SYSCALL(close)
+    351b:	b8 15 00 00 00       	mov    $0x15,%eax
+    3520:	cd 40                	int    $0x40
+    3522:	c3                   	ret
+
+00003523 <kill>:
+SYSCALL(kill)
+    3523:	b8 06 00 00 00       	mov    $0x6,%eax
+    3528:	cd 40                	int    $0x40
+    352a:	c3                   	ret
+
+0000352b <_exec>:
+RAWSYSCALL(exec)
+    352b:	b8 07 00 00 00       	mov    $0x7,%eax
+    3530:	cd 40                	int    $0x40
+    3532:	c3                   	ret
+
+00003533 <open>:
+SYSCALL(open)
+    3533:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3538:	cd 40                	int    $0x40
+    353a:	c3                   	ret
+
+0000353b <mknod>:
+SYSCALL(mknod)
+    353b:	b8 11 00 00 00       	mov    $0x11,%eax
+    3540:	cd 40                	int    $0x40
+    3542:	c3                   	ret
+
+00003543 <unlink>:
+SYSCALL(unlink)
+    3543:	b8 12 00 00 00       	mov    $0x12,%eax
+    3548:	cd 40                	int    $0x40
+    354a:	c3                   	ret
+
+0000354b <fstat>:
+SYSCALL(fstat)
+    354b:	b8 08 00 00 00       	mov    $0x8,%eax
+    3550:	cd 40                	int    $0x40
+    3552:	c3                   	ret
+
+00003553 <link>:
+SYSCALL(link)
+    3553:	b8 13 00 00 00       	mov    $0x13,%eax
+    3558:	cd 40                	int    $0x40
+    355a:	c3                   	ret
+
+0000355b <mkdir>:
+SYSCALL(mkdir)
+    355b:	b8 14 00 00 00       	mov    $0x14,%eax
+    3560:	cd 40                	int    $0x40
+    3562:	c3                   	ret
+
+00003563 <chdir>:
+SYSCALL(chdir)
+    3563:	b8 09 00 00 00       	mov    $0x9,%eax
+    3568:	cd 40                	int    $0x40
+    356a:	c3                   	ret
+
+0000356b <dup>:
+SYSCALL(dup)
+    356b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3570:	cd 40                	int    $0x40
+    3572:	c3                   	ret
+
+00003573 <getpid>:
+SYSCALL(getpid)
+    3573:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3578:	cd 40                	int    $0x40
+    357a:	c3                   	ret
+
+0000357b <sbrk>:
+SYSCALL(sbrk)
+    357b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3580:	cd 40                	int    $0x40
+    3582:	c3                   	ret
+
+00003583 <sleep>:
+SYSCALL(sleep)
+    3583:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3588:	cd 40                	int    $0x40
+    358a:	c3                   	ret
+
+0000358b <uptime>:
+SYSCALL(uptime)
+    358b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3590:	cd 40                	int    $0x40
+    3592:	c3                   	ret
+
+00003593 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+    3593:	b8 16 00 00 00       	mov    $0x16,%eax
+    3598:	cd 40                	int    $0x40
+    359a:	c3                   	ret
+
+0000359b <get_parent_id>:
+SYSCALL(get_parent_id)
+    359b:	b8 17 00 00 00       	mov    $0x17,%eax
+    35a0:	cd 40                	int    $0x40
+    35a2:	c3                   	ret
+
+000035a3 <get_children>:
+SYSCALL(get_children)
+    35a3:	b8 18 00 00 00       	mov    $0x18,%eax
+    35a8:	cd 40                	int    $0x40
+    35aa:	c3                   	ret
+
+000035ab <set_path>:
+SYSCALL(set_path)
+    35ab:	b8 19 00 00 00       	mov    $0x19,%eax
+    35b0:	cd 40                	int    $0x40
+    35b2:	c3                   	ret
+
+000035b3 <set_sleep>:
+SYSCALL(set_sleep)
+    35b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    35b8:	cd 40                	int    $0x40
+    35ba:	c3                   	ret
+
+000035bb <get_time>:
+SYSCALL(get_time)
+    35bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    35c0:	cd 40                	int    $0x40
+    35c2:	c3                   	ret
+
+000035c3 <change_process_level>:
+SYSCALL(change_process_level)
+    35c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    35c8:	cd 40                	int    $0x40
+    35ca:	c3                   	ret
+
+000035cb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+    35cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    35d0:	cd 40                	int    $0x40
+    35d2:	c3                   	ret
+
+000035d3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+    35d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    35d8:	cd 40                	int    $0x40
+    35da:	c3                   	ret
+
+000035db <print_processes_info>:
+SYSCALL(print_processes_info)
+    35db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    35e0:	cd 40                	int    $0x40
+    35e2:	c3                   	ret
+
+000035e3 <barrier_init>:
+
+SYSCALL(barrier_init)
+    35e3:	b8 20 00 00 00       	mov    $0x20,%eax
+    35e8:	cd 40                	int    $0x40
+    35ea:	c3                   	ret
+
+000035eb <barrier_wait>:
+SYSCALL(barrier_wait)
+    35eb:	b8 21 00 00 00       	mov    $0x21,%eax
+    35f0:	cd 40                	int    $0x40
+    35f2:	c3                   	ret
+
+000035f3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+    35f3:	b8 22 00 00 00       	mov    $0x22,%eax
+    35f8:	cd 40                	int    $0x40
+    35fa:	c3                   	ret
+
+000035fb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+    35fb:	b8 23 00 00 00       	mov    $0x23,%eax
+    3600:	cd 40                	int    $0x40
+    3602:	c3                   	ret
+
+00003603 <set_process_gang>:
+SYSCALL(set_process_gang)
+    3603:	b8 24 00 00 00       	mov    $0x24,%eax
+    3608:	cd 40                	int    $0x40
+    360a:	c3                   	ret
+
+0000360b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+    360b:	b8 25 00 00 00       	mov    $0x25,%eax
+    3610:	cd 40                	int    $0x40
+    3612:	c3                   	ret
+
+00003613 <sem_create>:
+SYSCALL(sem_create)
+    3613:	b8 26 00 00 00       	mov    $0x26,%eax
+    3618:	cd 40                	int    $0x40
+    361a:	c3                   	ret
+
+0000361b <event_create>:
+SYSCALL(event_create)
+    361b:	b8 27 00 00 00       	mov    $0x27,%eax
+    3620:	cd 40                	int    $0x40
+    3622:	c3                   	ret
+
+00003623 <sync_post>:
+SYSCALL(sync_post)
+    3623:	b8 28 00 00 00       	mov    $0x28,%eax
+    3628:	cd 40                	int    $0x40
+    362a:	c3                   	ret
+
+0000362b <sync_wait>:
+SYSCALL(sync_wait)
+    362b:	b8 29 00 00 00       	mov    $0x29,%eax
+    3630:	cd 40                	int    $0x40
+    3632:	c3                   	ret
+
+00003633 <sync_close>:
+SYSCALL(sync_close)
+    3633:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    3638:	cd 40                	int    $0x40
+    363a:	c3                   	ret
+
+0000363b <event_reset>:
+SYSCALL(event_reset)
+    363b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    3640:	cd 40                	int    $0x40
+    3642:	c3                   	ret
+
+00003643 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+    3643:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    3648:	cd 40                	int    $0x40
+    364a:	c3                   	ret
+
+0000364b <mmap>:
+SYSCALL(mmap)
+    364b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    3650:	cd 40                	int    $0x40
+    3652:	c3                   	ret
+
+00003653 <munmap>:
+SYSCALL(munmap)
+    3653:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    3658:	cd 40                	int    $0x40
+    365a:	c3                   	ret
+
+0000365b <shmget>:
+SYSCALL(shmget)
+    365b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    3660:	cd 40                	int    $0x40
+    3662:	c3                   	ret
+
+00003663 <shmat>:
+SYSCALL(shmat)
+    3663:	b8 30 00 00 00       	mov    $0x30,%eax
+    3668:	cd 40                	int    $0x40
+    366a:	c3                   	ret
+
+0000366b <shmdt>:
+SYSCALL(shmdt)
+    366b:	b8 31 00 00 00       	mov    $0x31,%eax
+    3670:	cd 40                	int    $0x40
+    3672:	c3                   	ret
+
+00003673 <shmrm>:
+SYSCALL(shmrm)
+    3673:	b8 32 00 00 00       	mov    $0x32,%eax
+    3678:	cd 40                	int    $0x40
+    367a:	c3                   	ret
+
+0000367b <_spawn>:
+RAWSYSCALL(spawn)
+    367b:	b8 33 00 00 00       	mov    $0x33,%eax
+    3680:	cd 40                	int    $0x40
+    3682:	c3                   	ret
+
+00003683 <memstat>:
+SYSCALL(memstat)
+    3683:	b8 34 00 00 00       	mov    $0x34,%eax
+    3688:	cd 40                	int    $0x40
+    368a:	c3                   	ret
+    368b:	66 90                	xchg   %ax,%ax
+    368d:	66 90                	xchg   %ax,%ax
+    368f:	90                   	nop
+
+00003690 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+    3690:	55                   	push   %ebp
+    3691:	89 e5                	mov    %esp,%ebp
+    3693:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+    3696:	a1 68 ac 00 00       	mov    0xac68,%eax
+    369b:	85 c0                	test   %eax,%eax
+    369d:	7e 17                	jle    36b6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+    369f:	83 ec 04             	sub    $0x4,%esp
+    36a2:	50                   	push   %eax
+    36a3:	68 6c ac 00 00       	push   $0xac6c
+    36a8:	ff 35 60 ac 00 00    	push   0xac60
+    36ae:	e8 60 fe ff ff       	call   3513 <write>
+    36b3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    36b6:	c7 05 68 ac 00 00 00 	movl   $0x0,0xac68
+    36bd:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+    36c0:	c7 05 64 ac 00 00 00 	movl   $0x0,0xac64
+    36c7:	00 00 00 
+}
+    36ca:	c9                   	leave
+    36cb:	c3                   	ret
+    36cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000036d0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+    36d0:	55                   	push   %ebp
+    36d1:	89 e5                	mov    %esp,%ebp
+    36d3:	57                   	push   %edi
+    36d4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    36d6:	89 d1                	mov    %edx,%ecx
+{
+    36d8:	56                   	push   %esi
+    36d9:	53                   	push   %ebx
+    36da:	89 c3                	mov    %eax,%ebx
+    36dc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+    36df:	85 d2                	test   %edx,%edx
+    36e1:	0f 89 b9 00 00 00    	jns    37a0 <printint+0xd0>
+    36e7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    36eb:	0f 84 af 00 00 00    	je     37a0 <printint+0xd0>
+    x = -xx;
+    36f1:	f7 d9                	neg    %ecx
+    neg = 1;
+    36f3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    36f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    36fb:	31 f6                	xor    %esi,%esi
+    36fd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    3700:	89 c8                	mov    %ecx,%eax
+    3702:	31 d2                	xor    %edx,%edx
+    3704:	89 f3                	mov    %esi,%ebx
+    3706:	f7 f7                	div    %edi
+    3708:	8d 76 01             	lea    0x1(%esi),%esi
+    370b:	0f b6 92 34 56 00 00 	movzbl 0x5634(%edx),%edx
+    3712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3716:	89 ca                	mov    %ecx,%edx
+    3718:	89 c1                	mov    %eax,%ecx
+    371a:	39 fa                	cmp    %edi,%edx
+    371c:	73 e2                	jae    3700 <printint+0x30>
+  if(neg)
+    371e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    3721:	89 d9                	mov    %ebx,%ecx
+    3723:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3726:	85 c0                	test   %eax,%eax
+    3728:	74 07                	je     3731 <printint+0x61>
+    buf[i++] = '-';
+    372a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    372f:	89 f1                	mov    %esi,%ecx
+    3731:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    3734:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+    3736:	8d 43 0c             	lea    0xc(%ebx),%eax
+    3739:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    373c:	01 f7                	add    %esi,%edi
+    373e:	eb 09                	jmp    3749 <printint+0x79>
+
+  while(--i >= 0)
+    3740:	8d 47 ff             	lea    -0x1(%edi),%eax
+    3743:	39 f7                	cmp    %esi,%edi
+    3745:	74 36                	je     377d <printint+0xad>
+    3747:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+    3749:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+    374c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+    374f:	8d 42 01             	lea    0x1(%edx),%eax
+    3752:	89 43 08             	mov    %eax,0x8(%ebx)
+    3755:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    3759:	3d 00 02 00 00       	cmp    $0x200,%eax
+    375e:	74 28                	je     3788 <printint+0xb8>
+    3760:	80 f9 0a             	cmp    $0xa,%cl
+    3763:	75 db                	jne    3740 <printint+0x70>
+    3765:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    3769:	75 d5                	jne    3740 <printint+0x70>
+  if(b->n > 0)
+    376b:	85 c0                	test   %eax,%eax
+    376d:	7f 19                	jg     3788 <printint+0xb8>
+  b->n = 0;
+    376f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+    3776:	8d 47 ff             	lea    -0x1(%edi),%eax
+    3779:	39 f7                	cmp    %esi,%edi
+    377b:	75 ca                	jne    3747 <printint+0x77>
+}
+    377d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3780:	5b                   	pop    %ebx
+    3781:	5e                   	pop    %esi
+    3782:	5f                   	pop    %edi
+    3783:	5d                   	pop    %ebp
+    3784:	c3                   	ret
+    3785:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    3788:	83 ec 04             	sub    $0x4,%esp
+    378b:	50                   	push   %eax
+    378c:	ff 75 d4             	push   -0x2c(%ebp)
+    378f:	ff 33                	push   (%ebx)
+    3791:	e8 7d fd ff ff       	call   3513 <write>
+    3796:	83 c4 10             	add    $0x10,%esp
+    3799:	eb d4                	jmp    376f <printint+0x9f>
+    379b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    379f:	90                   	nop
+  neg = 0;
+    37a0:	31 c0                	xor    %eax,%eax
+    37a2:	e9 51 ff ff ff       	jmp    36f8 <printint+0x28>
+    37a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37ae:	66 90                	xchg   %ax,%ax
+
+000037b0 <putc>:
+{
+    37b0:	55                   	push   %ebp
+    37b1:	89 e5                	mov    %esp,%ebp
+    37b3:	53                   	push   %ebx
+    37b4:	89 c3                	mov    %eax,%ebx
+    37b6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+    37b9:	8b 48 08             	mov    0x8(%eax),%ecx
+    37bc:	8d 41 01             	lea    0x1(%ecx),%eax
+    37bf:	89 43 08             	mov    %eax,0x8(%ebx)
+    37c2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    37c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+    37cb:	74 33                	je     3800 <putc+0x50>
+    37cd:	80 fa 0a             	cmp    $0xa,%dl
+    37d0:	74 0e                	je     37e0 <putc+0x30>
+}
+    37d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37d5:	c9                   	leave
+    37d6:	c3                   	ret
+    37d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37de:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    37e0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+    37e4:	75 ec                	jne    37d2 <putc+0x22>
+  if(b->n > 0)
+    37e6:	85 c0                	test   %eax,%eax
+    37e8:	7f 16                	jg     3800 <putc+0x50>
+  b->n = 0;
+    37ea:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    37f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37f4:	c9                   	leave
+    37f5:	c3                   	ret
+    37f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37fd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    3800:	83 ec 04             	sub    $0x4,%esp
+    3803:	50                   	push   %eax
+    3804:	8d 43 0c             	lea    0xc(%ebx),%eax
+    3807:	50                   	push   %eax
+    3808:	ff 33                	push   (%ebx)
+    380a:	e8 04 fd ff ff       	call   3513 <write>
+    380f:	83 c4 10             	add    $0x10,%esp
+    3812:	eb d6                	jmp    37ea <putc+0x3a>
+    3814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    381b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    381f:	90                   	nop
+
+00003820 <fflush>:
+{
+    3820:	55                   	push   %ebp
+    3821:	89 e5                	mov    %esp,%ebp
+    3823:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+    3826:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    382a:	74 04                	je     3830 <fflush+0x10>
+}
+    382c:	c9                   	leave
+    382d:	c3                   	ret
+    382e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    3830:	a1 68 ac 00 00       	mov    0xac68,%eax
+    3835:	85 c0                	test   %eax,%eax
+    3837:	7f 17                	jg     3850 <fflush+0x30>
+  b->n = 0;
+    3839:	c7 05 68 ac 00 00 00 	movl   $0x0,0xac68
+    3840:	00 00 00 
+  out.mode = 0;
+    3843:	c7 05 64 ac 00 00 00 	movl   $0x0,0xac64
+    384a:	00 00 00 
+}
+    384d:	c9                   	leave
+    384e:	c3                   	ret
+    384f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+    3850:	83 ec 04             	sub    $0x4,%esp
+    3853:	50                   	push   %eax
+    3854:	68 6c ac 00 00       	push   $0xac6c
+    3859:	ff 35 60 ac 00 00    	push   0xac60
+    385f:	e8 af fc ff ff       	call   3513 <write>
+    3864:	83 c4 10             	add    $0x10,%esp
+    3867:	eb d0                	jmp    3839 <fflush+0x19>
+    3869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003870 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3870:	55                   	push   %ebp
+    3871:	89 e5                	mov    %esp,%ebp
+    3873:	57                   	push   %edi
+    3874:	56                   	push   %esi
+    3875:	53                   	push   %ebx
+    3876:	83 ec 3c             	sub    $0x3c,%esp
+    3879:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    387c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+    387f:	83 fe 01             	cmp    $0x1,%esi
+    3882:	0f 84 60 01 00 00    	je     39e8 <printf+0x178>
+    b->fd = fd;
+    3888:	89 35 40 aa 00 00    	mov    %esi,0xaa40
+  for(i = 0; fmt[i]; i++){
+    388e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+    3891:	bf 40 aa 00 00       	mov    $0xaa40,%edi
+  for(i = 0; fmt[i]; i++){
+    3896:	84 c0                	test   %al,%al
+    3898:	74 65                	je     38ff <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+    389a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    389d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+    38a0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    38a2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+    38a5:	eb 1f                	jmp    38c6 <printf+0x56>
+    38a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38ae:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+    38b0:	83 f8 25             	cmp    $0x25,%eax
+    38b3:	74 3b                	je     38f0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+    38b5:	89 f8                	mov    %edi,%eax
+    38b7:	e8 f4 fe ff ff       	call   37b0 <putc>
+  for(i = 0; fmt[i]; i++){
+    38bc:	0f b6 03             	movzbl (%ebx),%eax
+    38bf:	83 c3 01             	add    $0x1,%ebx
+    38c2:	84 c0                	test   %al,%al
+    38c4:	74 39                	je     38ff <printf+0x8f>
+    c = fmt[i] & 0xff;
+    38c6:	0f be d0             	movsbl %al,%edx
+    38c9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    38cc:	85 f6                	test   %esi,%esi
+    38ce:	74 e0                	je     38b0 <printf+0x40>
+      }
+    } else if(state == '%'){
+    38d0:	83 fe 25             	cmp    $0x25,%esi
+    38d3:	75 e7                	jne    38bc <printf+0x4c>
+      if(c == 'd'){
+    38d5:	83 f8 25             	cmp    $0x25,%eax
+    38d8:	74 57                	je     3931 <printf+0xc1>
+    38da:	83 e8 63             	sub    $0x63,%eax
+    38dd:	83 f8 15             	cmp    $0x15,%eax
+    38e0:	77 36                	ja     3918 <printf+0xa8>
+    38e2:	ff 24 85 dc 55 00 00 	jmp    *0x55dc(,%eax,4)
+    38e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+    38f0:	0f b6 03             	movzbl (%ebx),%eax
+    38f3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+    38f6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+    38fb:	84 c0                	test   %al,%al
+    38fd:	75 c7                	jne    38c6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+    38ff:	8b 47 04             	mov    0x4(%edi),%eax
+    3902:	85 c0                	test   %eax,%eax
+    3904:	0f 84 06 01 00 00    	je     3a10 <printf+0x1a0>
+    bflush(b);
+}
+    390a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    390d:	5b                   	pop    %ebx
+    390e:	5e                   	pop    %esi
+    390f:	5f                   	pop    %edi
+    3910:	5d                   	pop    %ebp
+    3911:	c3                   	ret
+    3912:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+    3918:	8b 4f 08             	mov    0x8(%edi),%ecx
+    391b:	8d 41 01             	lea    0x1(%ecx),%eax
+    391e:	89 47 08             	mov    %eax,0x8(%edi)
+    3921:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+    3926:	3d 00 02 00 00       	cmp    $0x200,%eax
+    392b:	0f 84 77 01 00 00    	je     3aa8 <printf+0x238>
+        putc(b, c);
+    3931:	89 f8                	mov    %edi,%eax
+      state = 0;
+    3933:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+    3935:	e8 76 fe ff ff       	call   37b0 <putc>
+    393a:	eb 80                	jmp    38bc <printf+0x4c>
+    393c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+    3940:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3943:	83 ec 0c             	sub    $0xc,%esp
+    3946:	b9 10 00 00 00       	mov    $0x10,%ecx
+    394b:	8b 16                	mov    (%esi),%edx
+    394d:	6a 00                	push   $0x0
+        ap++;
+    394f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+    3952:	89 f8                	mov    %edi,%eax
+    3954:	e8 77 fd ff ff       	call   36d0 <printint>
+        ap++;
+    3959:	89 75 c0             	mov    %esi,-0x40(%ebp)
+    395c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    395f:	31 f6                	xor    %esi,%esi
+    3961:	e9 56 ff ff ff       	jmp    38bc <printf+0x4c>
+    3966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    396d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3970:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    3973:	8b 08                	mov    (%eax),%ecx
+        ap++;
+    3975:	83 c0 04             	add    $0x4,%eax
+    3978:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+    397b:	85 c9                	test   %ecx,%ecx
+    397d:	0f 84 cd 00 00 00    	je     3a50 <printf+0x1e0>
+        while(*s != 0){
+    3983:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+    3986:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+    3988:	84 d2                	test   %dl,%dl
+    398a:	0f 84 2c ff ff ff    	je     38bc <printf+0x4c>
+          putc(b, *s);
+    3990:	89 f8                	mov    %edi,%eax
+    3992:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+    3995:	e8 16 fe ff ff       	call   37b0 <putc>
+          s++;
+    399a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+    399d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+    39a1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+    39a4:	84 d2                	test   %dl,%dl
+    39a6:	75 e8                	jne    3990 <printf+0x120>
+      state = 0;
+    39a8:	31 f6                	xor    %esi,%esi
+    39aa:	e9 0d ff ff ff       	jmp    38bc <printf+0x4c>
+    39af:	90                   	nop
+        printint(b, *ap, 10, 1);
+    39b0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    39b3:	83 ec 0c             	sub    $0xc,%esp
+    39b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    39bb:	8b 16                	mov    (%esi),%edx
+    39bd:	6a 01                	push   $0x1
+    39bf:	eb 8e                	jmp    394f <printf+0xdf>
+    39c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+    39c8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    39cb:	89 f8                	mov    %edi,%eax
+    39cd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+    39d0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+    39d3:	e8 d8 fd ff ff       	call   37b0 <putc>
+        ap++;
+    39d8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+    39db:	31 f6                	xor    %esi,%esi
+    39dd:	e9 da fe ff ff       	jmp    38bc <printf+0x4c>
+    39e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+    39e8:	8b 15 64 ac 00 00    	mov    0xac64,%edx
+    39ee:	85 d2                	test   %edx,%edx
+    39f0:	74 6e                	je     3a60 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+    39f2:	0f b6 03             	movzbl (%ebx),%eax
+    39f5:	bf 60 ac 00 00       	mov    $0xac60,%edi
+    39fa:	84 c0                	test   %al,%al
+    39fc:	0f 85 98 fe ff ff    	jne    389a <printf+0x2a>
+    3a02:	e9 03 ff ff ff       	jmp    390a <printf+0x9a>
+    3a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a0e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+    3a10:	8b 47 08             	mov    0x8(%edi),%eax
+    3a13:	85 c0                	test   %eax,%eax
+    3a15:	7f 19                	jg     3a30 <printf+0x1c0>
+  b->n = 0;
+    3a17:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    3a1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a21:	5b                   	pop    %ebx
+    3a22:	5e                   	pop    %esi
+    3a23:	5f                   	pop    %edi
+    3a24:	5d                   	pop    %ebp
+    3a25:	c3                   	ret
+    3a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+    3a30:	83 ec 04             	sub    $0x4,%esp
+    3a33:	50                   	push   %eax
+    3a34:	8d 47 0c             	lea    0xc(%edi),%eax
+    3a37:	50                   	push   %eax
+    3a38:	ff 37                	push   (%edi)
+    3a3a:	e8 d4 fa ff ff       	call   3513 <write>
+  b->n = 0;
+    3a3f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+    3a46:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+    3a49:	eb d3                	jmp    3a1e <printf+0x1ae>
+    3a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a4f:	90                   	nop
+    3a50:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+    3a55:	b9 d2 55 00 00       	mov    $0x55d2,%ecx
+    3a5a:	e9 31 ff ff ff       	jmp    3990 <printf+0x120>
+    3a5f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    3a60:	83 ec 08             	sub    $0x8,%esp
+    3a63:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+    3a66:	c7 05 60 ac 00 00 01 	movl   $0x1,0xac60
+    3a6d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    3a70:	50                   	push   %eax
+    3a71:	6a 01                	push   $0x1
+    3a73:	e8 d3 fa ff ff       	call   354b <fstat>
+    3a78:	83 c4 10             	add    $0x10,%esp
+    3a7b:	85 c0                	test   %eax,%eax
+    3a7d:	75 22                	jne    3aa1 <printf+0x231>
+    3a7f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    3a84:	b8 02 00 00 00       	mov    $0x2,%eax
+    3a89:	0f 45 f0             	cmovne %eax,%esi
+    3a8c:	89 35 64 ac 00 00    	mov    %esi,0xac64
+      stdioflush = flushout;
+    3a92:	c7 05 00 a8 00 00 90 	movl   $0x3690,0xa800
+    3a99:	36 00 00 
+    3a9c:	e9 51 ff ff ff       	jmp    39f2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+    3aa1:	be 02 00 00 00       	mov    $0x2,%esi
+    3aa6:	eb e4                	jmp    3a8c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+    3aa8:	83 ec 04             	sub    $0x4,%esp
+    3aab:	8d 47 0c             	lea    0xc(%edi),%eax
+    3aae:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    3ab1:	68 00 02 00 00       	push   $0x200
+    3ab6:	50                   	push   %eax
+    3ab7:	ff 37                	push   (%edi)
+    3ab9:	e8 55 fa ff ff       	call   3513 <write>
+  b->n = 0;
+    3abe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+    3ac5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    3ac8:	83 c4 10             	add    $0x10,%esp
+    3acb:	e9 61 fe ff ff       	jmp    3931 <printf+0xc1>
+
+00003ad0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+    3ad0:	55                   	push   %ebp
+    3ad1:	89 e5                	mov    %esp,%ebp
+    3ad3:	56                   	push   %esi
+    3ad4:	53                   	push   %ebx
+    3ad5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+    3ad7:	a1 80 ae 00 00       	mov    0xae80,%eax
+    3adc:	39 d8                	cmp    %ebx,%eax
+    3ade:	0f 83 e4 00 00 00    	jae    3bc8 <freepages+0xf8>
+    3ae4:	85 c0                	test   %eax,%eax
+    3ae6:	0f 84 dc 00 00 00    	je     3bc8 <freepages+0xf8>
+    3aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3af0:	89 c2                	mov    %eax,%edx
+    3af2:	8b 00                	mov    (%eax),%eax
+    3af4:	85 c0                	test   %eax,%eax
+    3af6:	74 04                	je     3afc <freepages+0x2c>
+    3af8:	39 d8                	cmp    %ebx,%eax
+    3afa:	72 f4                	jb     3af0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+    3afc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+    3aff:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+    3b01:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+    3b03:	85 c0                	test   %eax,%eax
+    3b05:	74 15                	je     3b1c <freepages+0x4c>
+    p->prev = s;
+    3b07:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+    3b0a:	8b 73 10             	mov    0x10(%ebx),%esi
+    3b0d:	89 f1                	mov    %esi,%ecx
+    3b0f:	c1 e1 0c             	shl    $0xc,%ecx
+    3b12:	01 d9                	add    %ebx,%ecx
+    3b14:	39 c8                	cmp    %ecx,%eax
+    3b16:	0f 84 d8 00 00 00    	je     3bf4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+    3b1c:	8b 4a 10             	mov    0x10(%edx),%ecx
+    3b1f:	89 c8                	mov    %ecx,%eax
+    3b21:	c1 e0 0c             	shl    $0xc,%eax
+    3b24:	01 d0                	add    %edx,%eax
+    3b26:	39 c3                	cmp    %eax,%ebx
+    3b28:	74 16                	je     3b40 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    3b2a:	8b 03                	mov    (%ebx),%eax
+    3b2c:	85 c0                	test   %eax,%eax
+    3b2e:	74 40                	je     3b70 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+    3b30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b33:	5b                   	pop    %ebx
+    3b34:	5e                   	pop    %esi
+    3b35:	5d                   	pop    %ebp
+    3b36:	c3                   	ret
+    3b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b3e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+    3b40:	03 4b 10             	add    0x10(%ebx),%ecx
+    3b43:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+    3b46:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+    3b49:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    3b4b:	85 c9                	test   %ecx,%ecx
+    3b4d:	0f 84 dd 00 00 00    	je     3c30 <freepages+0x160>
+    s->prev->next = s->next;
+    3b53:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+    3b55:	85 c0                	test   %eax,%eax
+    3b57:	74 06                	je     3b5f <freepages+0x8f>
+    s->next->prev = s->prev;
+    3b59:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    3b5c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    3b5f:	8b 02                	mov    (%edx),%eax
+    3b61:	89 d3                	mov    %edx,%ebx
+    3b63:	85 c0                	test   %eax,%eax
+    3b65:	75 c9                	jne    3b30 <freepages+0x60>
+    3b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b6e:	66 90                	xchg   %ax,%ax
+    3b70:	8b 43 10             	mov    0x10(%ebx),%eax
+    3b73:	83 f8 0f             	cmp    $0xf,%eax
+    3b76:	76 b8                	jbe    3b30 <freepages+0x60>
+    3b78:	83 ec 0c             	sub    $0xc,%esp
+    3b7b:	c1 e0 0c             	shl    $0xc,%eax
+    3b7e:	6a 00                	push   $0x0
+    3b80:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    3b83:	e8 f3 f9 ff ff       	call   357b <sbrk>
+    3b88:	83 c4 10             	add    $0x10,%esp
+    3b8b:	39 c6                	cmp    %eax,%esi
+    3b8d:	75 a1                	jne    3b30 <freepages+0x60>
+  if(s->prev)
+    3b8f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+    3b92:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    3b94:	85 d2                	test   %edx,%edx
+    3b96:	0f 84 a5 00 00 00    	je     3c41 <freepages+0x171>
+    s->prev->next = s->next;
+    3b9c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+    3b9e:	85 c0                	test   %eax,%eax
+    3ba0:	74 06                	je     3ba8 <freepages+0xd8>
+    s->next->prev = s->prev;
+    3ba2:	8b 53 04             	mov    0x4(%ebx),%edx
+    3ba5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+    3ba8:	8b 43 10             	mov    0x10(%ebx),%eax
+    3bab:	83 ec 0c             	sub    $0xc,%esp
+    3bae:	c1 e0 0c             	shl    $0xc,%eax
+    3bb1:	f7 d8                	neg    %eax
+    3bb3:	50                   	push   %eax
+    3bb4:	e8 c2 f9 ff ff       	call   357b <sbrk>
+    3bb9:	83 c4 10             	add    $0x10,%esp
+}
+    3bbc:	e9 6f ff ff ff       	jmp    3b30 <freepages+0x60>
+    3bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+    3bc8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+    3bcf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+    3bd1:	89 1d 80 ae 00 00    	mov    %ebx,0xae80
+  if(p)
+    3bd7:	85 c0                	test   %eax,%eax
+    3bd9:	74 95                	je     3b70 <freepages+0xa0>
+    p->prev = s;
+    3bdb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+    3bde:	8b 73 10             	mov    0x10(%ebx),%esi
+    3be1:	89 f2                	mov    %esi,%edx
+    3be3:	c1 e2 0c             	shl    $0xc,%edx
+    3be6:	01 da                	add    %ebx,%edx
+    3be8:	39 d0                	cmp    %edx,%eax
+    3bea:	0f 85 3a ff ff ff    	jne    3b2a <freepages+0x5a>
+    3bf0:	89 c1                	mov    %eax,%ecx
+    3bf2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+    3bf4:	8b 41 10             	mov    0x10(%ecx),%eax
+    3bf7:	01 f0                	add    %esi,%eax
+    3bf9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+    3bfc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+    3bff:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+    3c01:	85 f6                	test   %esi,%esi
+    3c03:	74 35                	je     3c3a <freepages+0x16a>
+    s->prev->next = s->next;
+    3c05:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+    3c07:	85 c0                	test   %eax,%eax
+    3c09:	74 06                	je     3c11 <freepages+0x141>
+    s->next->prev = s->prev;
+    3c0b:	8b 49 04             	mov    0x4(%ecx),%ecx
+    3c0e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+    3c11:	85 d2                	test   %edx,%edx
+    3c13:	0f 84 11 ff ff ff    	je     3b2a <freepages+0x5a>
+    3c19:	8b 4a 10             	mov    0x10(%edx),%ecx
+    3c1c:	89 c8                	mov    %ecx,%eax
+    3c1e:	c1 e0 0c             	shl    $0xc,%eax
+    3c21:	01 d0                	add    %edx,%eax
+    3c23:	39 c3                	cmp    %eax,%ebx
+    3c25:	0f 85 ff fe ff ff    	jne    3b2a <freepages+0x5a>
+    3c2b:	e9 10 ff ff ff       	jmp    3b40 <freepages+0x70>
+    *l = s->next;
+    3c30:	a3 80 ae 00 00       	mov    %eax,0xae80
+    3c35:	e9 1b ff ff ff       	jmp    3b55 <freepages+0x85>
+    3c3a:	a3 80 ae 00 00       	mov    %eax,0xae80
+    3c3f:	eb c6                	jmp    3c07 <freepages+0x137>
+    3c41:	a3 80 ae 00 00       	mov    %eax,0xae80
+    3c46:	e9 53 ff ff ff       	jmp    3b9e <freepages+0xce>
+    3c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c4f:	90                   	nop
+
+00003c50 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+    3c50:	55                   	push   %ebp
+    3c51:	89 e5                	mov    %esp,%ebp
+    3c53:	56                   	push   %esi
+    3c54:	53                   	push   %ebx
+    3c55:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+    3c57:	a1 80 ae 00 00       	mov    0xae80,%eax
+    3c5c:	85 c0                	test   %eax,%eax
+    3c5e:	74 5e                	je     3cbe <getpages+0x6e>
+    if(s->npages < n)
+    3c60:	8b 50 10             	mov    0x10(%eax),%edx
+    3c63:	39 da                	cmp    %ebx,%edx
+    3c65:	72 51                	jb     3cb8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+    3c67:	39 d3                	cmp    %edx,%ebx
+    3c69:	72 25                	jb     3c90 <getpages+0x40>
+  if(s->prev)
+    3c6b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+    3c6e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+    3c70:	85 c9                	test   %ecx,%ecx
+    3c72:	0f 84 a8 00 00 00    	je     3d20 <getpages+0xd0>
+    s->prev->next = s->next;
+    3c78:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+    3c7a:	85 d2                	test   %edx,%edx
+    3c7c:	74 06                	je     3c84 <getpages+0x34>
+    s->next->prev = s->prev;
+    3c7e:	8b 48 04             	mov    0x4(%eax),%ecx
+    3c81:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+    3c84:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+    3c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3c8a:	5b                   	pop    %ebx
+    3c8b:	5e                   	pop    %esi
+    3c8c:	5d                   	pop    %ebp
+    3c8d:	c3                   	ret
+    3c8e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    3c90:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+    3c92:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    3c94:	c1 e1 0c             	shl    $0xc,%ecx
+    3c97:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+    3c99:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+    3c9c:	8b 70 04             	mov    0x4(%eax),%esi
+    3c9f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+    3ca2:	8b 10                	mov    (%eax),%edx
+    3ca4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+    3ca6:	85 f6                	test   %esi,%esi
+    3ca8:	74 66                	je     3d10 <getpages+0xc0>
+        rest->prev->next = rest;
+    3caa:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+    3cac:	8b 11                	mov    (%ecx),%edx
+    3cae:	85 d2                	test   %edx,%edx
+    3cb0:	75 cf                	jne    3c81 <getpages+0x31>
+    3cb2:	eb d0                	jmp    3c84 <getpages+0x34>
+    3cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+    3cb8:	8b 00                	mov    (%eax),%eax
+    3cba:	85 c0                	test   %eax,%eax
+    3cbc:	75 a2                	jne    3c60 <getpages+0x10>
+  brk = (uint)sbrk(0);
+    3cbe:	83 ec 0c             	sub    $0xc,%esp
+    3cc1:	6a 00                	push   $0x0
+    3cc3:	e8 b3 f8 ff ff       	call   357b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+    3cc8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+    3ccb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+    3cd1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    3cd3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+    3cd9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    3cdf:	29 d0                	sub    %edx,%eax
+    3ce1:	c1 e8 0c             	shr    $0xc,%eax
+    3ce4:	39 d8                	cmp    %ebx,%eax
+    3ce6:	72 48                	jb     3d30 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+    3ce8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    3cea:	89 d8                	mov    %ebx,%eax
+    3cec:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+    3cef:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    3cf1:	c1 e0 0c             	shl    $0xc,%eax
+    3cf4:	01 f0                	add    %esi,%eax
+    3cf6:	50                   	push   %eax
+    3cf7:	e8 7f f8 ff ff       	call   357b <sbrk>
+    3cfc:	83 c4 10             	add    $0x10,%esp
+    3cff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d02:	74 2c                	je     3d30 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+    3d04:	01 f0                	add    %esi,%eax
+    3d06:	e9 79 ff ff ff       	jmp    3c84 <getpages+0x34>
+    3d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d0f:	90                   	nop
+        runs = rest;
+    3d10:	89 0d 80 ae 00 00    	mov    %ecx,0xae80
+    3d16:	eb 96                	jmp    3cae <getpages+0x5e>
+    3d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d1f:	90                   	nop
+    *l = s->next;
+    3d20:	89 15 80 ae 00 00    	mov    %edx,0xae80
+    3d26:	e9 4f ff ff ff       	jmp    3c7a <getpages+0x2a>
+    3d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d2f:	90                   	nop
+    return 0;
+    3d30:	31 c0                	xor    %eax,%eax
+    3d32:	e9 50 ff ff ff       	jmp    3c87 <getpages+0x37>
+    3d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d3e:	66 90                	xchg   %ax,%ax
+
+00003d40 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    3d40:	55                   	push   %ebp
+    3d41:	89 e5                	mov    %esp,%ebp
+    3d43:	57                   	push   %edi
+    3d44:	56                   	push   %esi
+    3d45:	53                   	push   %ebx
+    3d46:	83 ec 1c             	sub    $0x1c,%esp
+    3d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+    3d4c:	85 c0                	test   %eax,%eax
+    3d4e:	0f 84 97 00 00 00    	je     3deb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+    3d54:	89 c3                	mov    %eax,%ebx
+    3d56:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+    3d5c:	8b 73 14             	mov    0x14(%ebx),%esi
+    3d5f:	83 fe 01             	cmp    $0x1,%esi
+    3d62:	74 74                	je     3dd8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    3d64:	85 f6                	test   %esi,%esi
+    3d66:	74 5d                	je     3dc5 <free+0x85>
+  if(s->free == 0)
+    3d68:	8b 53 08             	mov    0x8(%ebx),%edx
+    3d6b:	85 d2                	test   %edx,%edx
+    3d6d:	0f 84 85 00 00 00    	je     3df8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+    3d73:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+    3d75:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+    3d78:	8b 43 0c             	mov    0xc(%ebx),%eax
+    3d7b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+    3d7e:	8b 04 f5 a4 ae 00 00 	mov    0xaea4(,%esi,8),%eax
+  s->inuse--;
+    3d85:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+    3d88:	83 c0 01             	add    $0x1,%eax
+    3d8b:	89 04 f5 a4 ae 00 00 	mov    %eax,0xaea4(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    3d92:	85 d2                	test   %edx,%edx
+    3d94:	75 55                	jne    3deb <free+0xab>
+    3d96:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+    3d9b:	89 f1                	mov    %esi,%ecx
+    3d9d:	d3 ea                	shr    %cl,%edx
+    3d9f:	39 c2                	cmp    %eax,%edx
+    3da1:	73 7d                	jae    3e20 <free+0xe0>
+  if(s->prev)
+    3da3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+    3da6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+    3da8:	85 ff                	test   %edi,%edi
+    3daa:	0f 84 a0 00 00 00    	je     3e50 <free+0x110>
+    s->prev->next = s->next;
+    3db0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    3db2:	85 c9                	test   %ecx,%ecx
+    3db4:	74 06                	je     3dbc <free+0x7c>
+    s->next->prev = s->prev;
+    3db6:	8b 7b 04             	mov    0x4(%ebx),%edi
+    3db9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    3dbc:	29 d0                	sub    %edx,%eax
+    3dbe:	89 04 f5 a4 ae 00 00 	mov    %eax,0xaea4(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    3dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    3dc8:	89 d8                	mov    %ebx,%eax
+}
+    3dca:	5b                   	pop    %ebx
+    3dcb:	5e                   	pop    %esi
+    3dcc:	5f                   	pop    %edi
+    3dcd:	5d                   	pop    %ebp
+    freepages(s);
+    3dce:	e9 fd fc ff ff       	jmp    3ad0 <freepages>
+    3dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dd7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    3dd8:	8b 43 10             	mov    0x10(%ebx),%eax
+    3ddb:	83 ec 08             	sub    $0x8,%esp
+    3dde:	c1 e0 0c             	shl    $0xc,%eax
+    3de1:	50                   	push   %eax
+    3de2:	53                   	push   %ebx
+    3de3:	e8 6b f8 ff ff       	call   3653 <munmap>
+    3de8:	83 c4 10             	add    $0x10,%esp
+}
+    3deb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3dee:	5b                   	pop    %ebx
+    3def:	5e                   	pop    %esi
+    3df0:	5f                   	pop    %edi
+    3df1:	5d                   	pop    %ebp
+    3df2:	c3                   	ret
+    3df3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3df7:	90                   	nop
+  s->next = *l;
+    3df8:	8b 14 f5 a0 ae 00 00 	mov    0xaea0(,%esi,8),%edx
+  s->prev = 0;
+    3dff:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    3e06:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    3e08:	85 d2                	test   %edx,%edx
+    3e0a:	74 06                	je     3e12 <free+0xd2>
+    (*l)->prev = s;
+    3e0c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    3e0f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    3e12:	89 1c f5 a0 ae 00 00 	mov    %ebx,0xaea0(,%esi,8)
+}
+    3e19:	e9 55 ff ff ff       	jmp    3d73 <free+0x33>
+    3e1e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    3e20:	83 ec 0c             	sub    $0xc,%esp
+    3e23:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    3e26:	8b 7b 10             	mov    0x10(%ebx),%edi
+    3e29:	6a 00                	push   $0x0
+    3e2b:	c1 e7 0c             	shl    $0xc,%edi
+    3e2e:	01 df                	add    %ebx,%edi
+    3e30:	e8 46 f7 ff ff       	call   357b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    3e35:	83 c4 10             	add    $0x10,%esp
+    3e38:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    3e3b:	39 c7                	cmp    %eax,%edi
+    3e3d:	75 ac                	jne    3deb <free+0xab>
+    3e3f:	8b 04 f5 a4 ae 00 00 	mov    0xaea4(,%esi,8),%eax
+    3e46:	e9 58 ff ff ff       	jmp    3da3 <free+0x63>
+    3e4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3e4f:	90                   	nop
+    *l = s->next;
+    3e50:	89 0c f5 a0 ae 00 00 	mov    %ecx,0xaea0(,%esi,8)
+    3e57:	e9 56 ff ff ff       	jmp    3db2 <free+0x72>
+    3e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003e60 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    3e60:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    3e61:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    3e66:	89 e5                	mov    %esp,%ebp
+    3e68:	57                   	push   %edi
+    3e69:	56                   	push   %esi
+    3e6a:	53                   	push   %ebx
+    3e6b:	83 ec 1c             	sub    $0x1c,%esp
+    3e6e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    3e71:	83 f8 10             	cmp    $0x10,%eax
+    3e74:	0f 86 92 00 00 00    	jbe    3f0c <malloc+0xac>
+    3e7a:	ba 01 00 00 00       	mov    $0x1,%edx
+    3e7f:	eb 13                	jmp    3e94 <malloc+0x34>
+    3e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e88:	89 d3                	mov    %edx,%ebx
+    3e8a:	d3 e3                	shl    %cl,%ebx
+    3e8c:	39 c3                	cmp    %eax,%ebx
+    3e8e:	0f 83 84 00 00 00    	jae    3f18 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    3e94:	83 c1 01             	add    $0x1,%ecx
+    3e97:	83 f9 0b             	cmp    $0xb,%ecx
+    3e9a:	75 ec                	jne    3e88 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    3e9c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    3ea1:	0f 87 c9 00 00 00    	ja     3f70 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    3ea7:	05 17 10 00 00       	add    $0x1017,%eax
+    3eac:	89 c3                	mov    %eax,%ebx
+    3eae:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    3eb1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    3eb6:	77 28                	ja     3ee0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    3eb8:	89 d8                	mov    %ebx,%eax
+    3eba:	e8 91 fd ff ff       	call   3c50 <getpages>
+    3ebf:	85 c0                	test   %eax,%eax
+    3ec1:	0f 84 a9 00 00 00    	je     3f70 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    3ec7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    3ece:	83 c0 18             	add    $0x18,%eax
+}
+    3ed1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ed4:	5b                   	pop    %ebx
+    3ed5:	5e                   	pop    %esi
+    3ed6:	5f                   	pop    %edi
+    3ed7:	5d                   	pop    %ebp
+    3ed8:	c3                   	ret
+    3ed9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    3ee0:	89 d8                	mov    %ebx,%eax
+    3ee2:	83 ec 08             	sub    $0x8,%esp
+    3ee5:	c1 e0 0c             	shl    $0xc,%eax
+    3ee8:	6a 00                	push   $0x0
+    3eea:	6a ff                	push   $0xffffffff
+    3eec:	6a 22                	push   $0x22
+    3eee:	6a 03                	push   $0x3
+    3ef0:	50                   	push   %eax
+    3ef1:	6a 00                	push   $0x0
+    3ef3:	e8 53 f7 ff ff       	call   364b <mmap>
+    if(s == MAP_FAILED)
+    3ef8:	83 c4 20             	add    $0x20,%esp
+    3efb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3efe:	74 b8                	je     3eb8 <malloc+0x58>
+      s->shift = MAPRUN;
+    3f00:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    3f07:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    3f0a:	eb c2                	jmp    3ece <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    3f0c:	bb 10 00 00 00       	mov    $0x10,%ebx
+    3f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    3f18:	8b 34 cd a0 ae 00 00 	mov    0xaea0(,%ecx,8),%esi
+    3f1f:	85 f6                	test   %esi,%esi
+    3f21:	74 57                	je     3f7a <malloc+0x11a>
+  classes[shift].nfree--;
+    3f23:	8b 1c cd a4 ae 00 00 	mov    0xaea4(,%ecx,8),%ebx
+  o = s->free;
+    3f2a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    3f2d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    3f30:	89 14 cd a4 ae 00 00 	mov    %edx,0xaea4(,%ecx,8)
+  s->free = NEXTFREE(o);
+    3f37:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    3f39:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    3f3d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    3f40:	85 ff                	test   %edi,%edi
+    3f42:	75 8d                	jne    3ed1 <malloc+0x71>
+  if(s->prev)
+    3f44:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    3f47:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    3f49:	85 db                	test   %ebx,%ebx
+    3f4b:	0f 84 b7 00 00 00    	je     4008 <malloc+0x1a8>
+    s->prev->next = s->next;
+    3f51:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    3f53:	85 d2                	test   %edx,%edx
+    3f55:	0f 84 76 ff ff ff    	je     3ed1 <malloc+0x71>
+    s->next->prev = s->prev;
+    3f5b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    3f5e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    3f61:	e9 6b ff ff ff       	jmp    3ed1 <malloc+0x71>
+    3f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f6d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    3f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    3f73:	31 c0                	xor    %eax,%eax
+}
+    3f75:	5b                   	pop    %ebx
+    3f76:	5e                   	pop    %esi
+    3f77:	5f                   	pop    %edi
+    3f78:	5d                   	pop    %ebp
+    3f79:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    3f7a:	b8 01 00 00 00       	mov    $0x1,%eax
+    3f7f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    3f82:	e8 c9 fc ff ff       	call   3c50 <getpages>
+    3f87:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    3f8a:	85 c0                	test   %eax,%eax
+    3f8c:	89 c2                	mov    %eax,%edx
+    3f8e:	74 e0                	je     3f70 <malloc+0x110>
+    s->shift = shift;
+    3f90:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    3f93:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    3f95:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    3f9c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    3fa1:	89 df                	mov    %ebx,%edi
+    3fa3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    3fa5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    3fa7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    3faa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    3fad:	83 e8 01             	sub    $0x1,%eax
+    3fb0:	d3 e0                	shl    %cl,%eax
+    3fb2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    3fb5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    3fb9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    3fbc:	eb 04                	jmp    3fc2 <malloc+0x162>
+    3fbe:	66 90                	xchg   %ax,%ax
+    3fc0:	89 c8                	mov    %ecx,%eax
+    3fc2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    3fc5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    3fc7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    3fca:	89 c6                	mov    %eax,%esi
+    3fcc:	39 da                	cmp    %ebx,%edx
+    3fce:	7f f0                	jg     3fc0 <malloc+0x160>
+    3fd0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    3fd3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    3fd6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    3fd9:	8b 04 cd a0 ae 00 00 	mov    0xaea0(,%ecx,8),%eax
+  s->prev = 0;
+    3fe0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    3fe7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    3fe9:	85 c0                	test   %eax,%eax
+    3feb:	74 03                	je     3ff0 <malloc+0x190>
+    (*l)->prev = s;
+    3fed:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    3ff0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    3ff3:	89 14 cd a0 ae 00 00 	mov    %edx,0xaea0(,%ecx,8)
+    classes[shift].nfree += n;
+    3ffa:	89 d6                	mov    %edx,%esi
+    3ffc:	03 1c cd a4 ae 00 00 	add    0xaea4(,%ecx,8),%ebx
+    4003:	e9 22 ff ff ff       	jmp    3f2a <malloc+0xca>
+    *l = s->next;
+    4008:	89 14 cd a0 ae 00 00 	mov    %edx,0xaea0(,%ecx,8)
+    400f:	e9 3f ff ff ff       	jmp    3f53 <malloc+0xf3>
@@ -6,10 +6,72 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "mman.h"
+#include "memstat.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
+static int npgtables;  // page directories and page tables
+
+// Page faults resolved without I/O; see print_vm_stats.
+struct {
+  uint lazy;      // heap pages allocated on first touch
+  uint cowcopy;   // copy-on-write pages copied
+  uint cowreuse;  // copy-on-write pages made writable in place
+  uint super;     // 4 MB user pages mapped
+  uint split;     // 4 MB user pages split into 4 KB pages
+  uint vma;       // pages of mapped regions filled
+  uint exec;      // pages of program segments read in
+} vmstats;
+
+// User memory may be mapped with 4 MB pages (PTE_PS in the page
+// directory entry) from buddy blocks of this order, when a whole
+// aligned 4 MB of heap is allocated at once. Anything that works
+// on single pages splits them first; see walkpgdir.
+#define SUPERORDER 10
+
+// Replace the 4 MB page mapping va by a page table of the
+// same 4 KB mappings. Returns -1 if memory is exhausted.
+static int
+splitsuper(pde_t *pgdir, uint va)
+{
+  pde_t *pde;
+  pte_t *pgtab;
+  uint pa, flags;
+  int i;
+
+  pde = &pgdir[PDX(va)];
+  if((pgtab = (pte_t*)kalloc()) == 0)
+    return -1;
+  __sync_fetch_and_add(&npgtables, 1);
+  pa = PTE_ADDR(*pde);
+  flags = PTE_FLAGS(*pde) & ~PTE_PS;
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  // Drop the 4 MB TLB entry.
+  if(myproc() && myproc()->pgdir == pgdir)
+    lcr3(V2P(pgdir));
+  __sync_fetch_and_add(&vmstats.split, 1);
+  return 0;
+}
+
+// Map a zeroed 4 MB page at va, which must be 4 MB aligned
+// and have no page table. Returns -1 if no block is free.
+static int
+mapsuper(pde_t *pgdir, uint va)
+{
+  char *mem;
+
+  if((mem = kalloc_pages(SUPERORDER)) == 0)
+    return -1;
+  memset(mem, 0, PDSIZE);
+  pgdir[PDX(va)] = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+  __sync_fetch_and_add(&vmstats.super, 1);
+  return 0;
+}
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -31,21 +93,26 @@ seginit(void)
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
-static pte_t *
+// create any required page table pages. A 4 MB user page
+// is split into a page table first, whatever alloc says;
+// if that fails, return 0.
+pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
   pde_t *pde;
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if((*pde & PTE_PS) && (uint)va < KERNBASE &&
+     splitsuper(pgdir, (uint)va) < 0)
+    return 0;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    // kalloc_zeroed makes sure all those PTE_P bits are zero.
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
       return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    __sync_fetch_and_add(&npgtables, 1);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -57,7 +124,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -92,13 +159,13 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
+//   data..KERNBASE+physstop: mapped to V2P(data)..physstop,
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (physstop, found
+// at boot by kinit1) (directly addressable from end..P2V(physstop)).
 
 // This table defines the kernel's mappings, which are present in
 // every process's page table.
@@ -110,37 +177,67 @@ static struct kmap {
 } kmap[] = {
  { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
  { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
+ { (void*)data,     V2P(data),     0,         PTE_W}, // kern data+memory
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
-// Set up kernel part of a page table.
+// Map [va, va+size) to pa in the kernel half of pgdir, using
+// 4 MB pages where va and pa are suitably aligned. All kernel
+// mappings are global, so lcr3 does not flush them.
+static void
+kmapregion(pde_t *pgdir, uint va, uint size, uint pa, int perm)
+{
+  uint a, last;
+
+  a = va;
+  last = va + size;  // 0 for a region at the top of memory
+  while(a != last){
+    if(a % PDSIZE == 0 && pa % PDSIZE == 0 && last - a >= PDSIZE){
+      pgdir[PDX(a)] = pa | perm | PTE_P | PTE_PS | PTE_G;
+      a += PDSIZE;
+      pa += PDSIZE;
+    } else {
+      if(mappages(pgdir, (char*)a, PGSIZE, pa, perm | PTE_G) < 0)
+        panic("kmapregion");
+      a += PGSIZE;
+      pa += PGSIZE;
+    }
+  }
+}
+
+// Set up kernel part of a page table. Every page directory
+// shares the kernel page tables built once by kvmalloc(),
+// so this only copies the kernel half of kpgdir.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  __sync_fetch_and_add(&npgtables, 1);
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes, holding the kernel mappings
+// that setupkvm() gives every process.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  kmap[2].phys_end = physstop;  // known only once kinit1 has run
+  if (P2V(physstop) > (void*)DEVSPACE)
+    panic("physstop too high");
+  if((kpgdir = (pde_t*)kalloc_zeroed()) == 0)
+    panic("kvmalloc");
+  npgtables++;
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    kmapregion(kpgdir, (uint)k->virt, k->phys_end - k->phys_start,
+               k->phys_start, k->perm);
   switchkvm();
 }
 
@@ -186,36 +283,11 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -231,13 +303,17 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    if(a % PDSIZE == 0 && newsz - a >= PDSIZE &&
+       (pgdir[PDX(a)] & PTE_P) == 0 && mapsuper(pgdir, a) == 0){
+      a += PDSIZE - PGSIZE;
+      continue;
+    }
+    mem = kallocswap(1);
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -263,6 +339,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if(pgdir[PDX(a)] & PTE_PS){
+      if(a % PDSIZE == 0 && oldsz - a >= PDSIZE){
+        kfree_pages(P2V(PTE_ADDR(pgdir[PDX(a)])), SUPERORDER);
+        pgdir[PDX(a)] = 0;
+        a += PDSIZE - PGSIZE;
+        continue;
+      }
+      // Partly freed: split, or if that is impossible leave the
+      // whole 4 MB mapped until freevm.
+      if(splitsuper(pgdir, a) < 0){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
@@ -273,6 +363,9 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = P2V(pa);
       kfree(v);
       *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(*pte);
+      *pte = 0;
     }
   }
   return newsz;
@@ -288,13 +381,16 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  // The kernel half is shared; see setupkvm.
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
+      __sync_fetch_and_sub(&npgtables, 1);
     }
   }
   kfree((char*)pgdir);
+  __sync_fetch_and_sub(&npgtables, 1);
 }
 
 // Clear PTE_U on a page. Used to create an inaccessible
@@ -310,40 +406,269 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Share the pages of [start, end) in s with d, as fork does.
+// If shared is set, writable pages stay writable in both;
+// otherwise they are made read-only and copy-on-write in
+// both page tables, and copied by cowfault() on first write.
+// Returns 0, or -1 if out of memory.
+int
+shareuvm(pde_t *d, pde_t *s, uint start, uint end, int shared)
+{
+  pte_t *pte, *dpte;
+  uint pa, i, flags;
+  int r;
+
+  r = 0;
+  for(i = start; i < end; i += PGSIZE){
+    // Pages are shared 4 KB at a time; see walkpgdir.
+    if((s[PDX(i)] & PTE_PS) && splitsuper(s, i) < 0){
+      r = -1;
+      break;
+    }
+    if((pte = walkpgdir(s, (void *) i, 0)) == 0){
+      // Untouched heap, all the way to the next page table.
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    if(*pte & PTE_SWAP){
+      // Both read the page back from the same slot.
+      if((dpte = walkpgdir(d, (void*)i, 1)) == 0){
+        r = -1;
+        break;
+      }
+      *dpte = *pte;
+      swapdup(*pte);
+      continue;
+    }
+    if(!(*pte & PTE_P))
+      continue;  // untouched heap page
+    if((*pte & PTE_W) && !shared)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+    pa = PTE_ADDR(*pte);
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0){
+      r = -1;
+      break;
+    }
+    kref(P2V(pa));
+  }
+  // The parent's TLB may still hold the writable mappings.
+  if(myproc() && myproc()->pgdir == s)
+    lcr3(V2P(s));
+  return r;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child, sharing the pages up to sz
+// copy-on-write (see shareuvm).
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+  if(shareuvm(d, pgdir, 0, sz, 0) < 0){
+    freevm(d);
+    return 0;
+  }
+  return d;
+}
+
+// Give pgdir a private, writable copy of the copy-on-write
+// page at va. Returns 0 on success, -1 if va is not a
+// copy-on-write page or memory is exhausted.
+static int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  mem = 0;
+again:
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0 ||
+     (*pte & (PTE_P|PTE_COW)) != (PTE_P|PTE_COW)){
+    if(mem)
       kfree(mem);
-      goto bad;
+    // Paged out meanwhile: retry, to read it back.
+    return pte && (*pte & PTE_SWAP) ? 0 : -1;
+  }
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW;
+  if(krefcount(P2V(pa)) == 1){
+    // Every other sharer has copied or exited already.
+    *pte = pa | flags;
+    if(mem)
+      kfree(mem);
+    __sync_fetch_and_add(&vmstats.cowreuse, 1);
+  } else {
+    if(mem == 0){
+      // Paging out to make room may sleep, and the page
+      // may change meanwhile: look again.
+      if((mem = kallocswap(0)) == 0)
+        return -1;
+      goto again;
     }
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+    __sync_fetch_and_add(&vmstats.cowcopy, 1);
   }
-  return d;
+  if(myproc() && myproc()->pgdir == pgdir)
+    invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// Map a zeroed page at va, an untouched part of the heap of p;
+// a 4 MB page if all of va's 4 MB is heap without a page table
+// yet and without program segments still to be read in.
+// Returns 0 on success, -1 if memory is exhausted.
+static int
+lazyfault(struct proc *p, uint va)
+{
+  pde_t *pgdir = p->pgdir;
+  char *mem;
+  uint base;
+
+  base = va & ~(PDSIZE - 1);
+  if((pgdir[PDX(va)] & PTE_P) == 0 && p->sz - base >= PDSIZE &&
+     !vmaoverlap(p, base, base + PDSIZE) && mapsuper(pgdir, base) == 0)
+    return 0;
+
+  if((mem = kallocswap(1)) == 0)
+    return -1;
+  if(mappages(pgdir, (char*)PGROUNDDOWN(va), PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  __sync_fetch_and_add(&vmstats.lazy, 1);
+  return 0;
+}
+
+// Handle a page fault at va in the current process, from user
+// mode or from the kernel touching user memory (err is the
+// hardware error code). Returns 0 if the faulting access can
+// be retried, -1 if it is a genuine error.
+int
+pagefault(uint va, uint err)
+{
+  struct proc *curproc = myproc();
+  struct vma *v;
+  pte_t *pte;
+
+  if(curproc == 0 || va >= KERNBASE)
+    return -1;
+  if((curproc->pgdir[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+     (pte = walkpgdir(curproc->pgdir, (char*)va, 0)) != 0 &&
+     (*pte & PTE_SWAP))
+    return swapin(va);
+  if((v = findvma(curproc, va)) != 0){
+    if((err & FEC_WR) && !(v->prot & PROT_WRITE))
+      return -1;
+    if((err & FEC_PR) == 0){
+      if(vmafault(curproc, v, va) < 0)
+        return -1;
+      if(v->start < curproc->sz)
+        __sync_fetch_and_add(&vmstats.exec, 1);
+      else
+        __sync_fetch_and_add(&vmstats.vma, 1);
+      return 0;
+    }
+  } else if((err & FEC_PR) == 0 && va < curproc->sz)
+    return lazyfault(curproc, va);
+  if((err & (FEC_PR|FEC_WR)) == (FEC_PR|FEC_WR))
+    return cowfault(curproc->pgdir, va);
+  return -1;
+}
+
+// Fault in the pages of [addr, addr+n) in the current process,
+// for writing if write is set, so that the kernel can then copy
+// to or from them while holding locks that filling a page from
+// a file would need. Returns -1 if some page is not accessible.
+int
+uvmprefault(char *addr, uint n, int write)
+{
+  struct proc *curproc = myproc();
+  pte_t *pte;
+  uint a, err;
 
-bad:
-  freevm(d);
+  if(n == 0)
+    return 0;
+  // Keep the pages in until the system call returns; see swap.c.
+  curproc->prefaulted = 1;
+  for(a = PGROUNDDOWN((uint)addr); a < (uint)addr + n; a += PGSIZE){
+    if(curproc->pgdir[PDX(a)] & PTE_PS)
+      continue;  // always present and writable
+    pte = walkpgdir(curproc->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && (!write || (*pte & PTE_W)))
+      continue;
+    err = FEC_U | (write ? FEC_WR : 0);
+    if(pte && (*pte & PTE_P))
+      err |= FEC_PR;
+    if(pagefault(a, err) < 0)
+      return -1;
+  }
   return 0;
 }
 
+// Fill in the system-wide numbers of ms.
+void
+vmmemstat(struct memstat *ms)
+{
+  ms->total = ktotalpages();
+  ms->free = kfreepages();
+  ms->pgtables = npgtables;
+  ms->slab = kmem_cache_pages(0);
+  ms->pipes = pipepages();
+  ms->pcache = pcachepages();
+  ms->swap = swappages();
+  ms->swapfree = swapfreepages();
+}
+
+// Count the pages of the user part of pgdir into ms: those
+// resident, those of them also mapped elsewhere, and those
+// paged out.
+void
+uvmresident(pde_t *pgdir, struct memstat *ms)
+{
+  pte_t *pgtab;
+  uint i, j;
+
+  for(i = 0; i < PDX(KERNBASE); i++){
+    if((pgdir[i] & PTE_P) == 0)
+      continue;
+    if(pgdir[i] & PTE_PS){
+      ms->rss += NPTENTRIES;
+      continue;
+    }
+    pgtab = (pte_t*)P2V(PTE_ADDR(pgdir[i]));
+    for(j = 0; j < NPTENTRIES; j++){
+      if(pgtab[j] & PTE_P){
+        ms->rss++;
+        if(krefcount(P2V(PTE_ADDR(pgtab[j]))) > 1)
+          ms->shared++;
+      } else if(pgtab[j] & PTE_SWAP)
+        ms->swapped++;
+    }
+  }
+}
+
+void
+print_vm_stats(void)
+{
+  cprintf("minor faults: heap %d, cow copy %d, cow reuse %d\n",
+          vmstats.lazy, vmstats.cowcopy, vmstats.cowreuse);
+  cprintf("4 MB pages: mapped %d, split %d\n", vmstats.super, vmstats.split);
+  cprintf("mapped region pages filled: %d\n", vmstats.vma);
+  cprintf("program pages read in: %d\n", vmstats.exec);
+  cprintf("free pages: %d, page tables: %d\n", kfreepages(), npgtables);
+  print_pcache_stats();
+  print_swap_stats();
+  print_kalloc_stats();
+  print_slab_stats();
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +677,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -367,10 +692,16 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // Writing through the kernel mapping bypasses the
+    // read-only PTE, so break copy-on-write sharing first.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
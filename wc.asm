@@ -0,0 +1,2302 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	be 01 00 00 00       	mov    $0x1,%esi
+      14:	53                   	push   %ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+      19:	8b 01                	mov    (%ecx),%eax
+      1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+      1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+      24:	83 f8 01             	cmp    $0x1,%eax
+      27:	7f 28                	jg     51 <main+0x51>
+      29:	eb 54                	jmp    7f <main+0x7f>
+      2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+      30:	83 ec 08             	sub    $0x8,%esp
+      33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+      35:	83 c6 01             	add    $0x1,%esi
+      38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+      3b:	50                   	push   %eax
+      3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+      41:	89 3c 24             	mov    %edi,(%esp)
+      44:	e8 02 05 00 00       	call   54b <close>
+  for(i = 1; i < argc; i++){
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+      51:	83 ec 08             	sub    $0x8,%esp
+      54:	6a 00                	push   $0x0
+      56:	ff 33                	push   (%ebx)
+      58:	e8 06 05 00 00       	call   563 <open>
+      5d:	83 c4 10             	add    $0x10,%esp
+      60:	89 c7                	mov    %eax,%edi
+      62:	85 c0                	test   %eax,%eax
+      64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      66:	50                   	push   %eax
+      67:	ff 33                	push   (%ebx)
+      69:	68 67 10 00 00       	push   $0x1067
+      6e:	6a 01                	push   $0x1
+      70:	e8 2b 08 00 00       	call   8a0 <printf>
+      exit();
+      75:	e8 36 01 00 00       	call   1b0 <exit>
+  }
+  exit();
+      7a:	e8 31 01 00 00       	call   1b0 <exit>
+    wc(0, "");
+      7f:	52                   	push   %edx
+      80:	52                   	push   %edx
+      81:	68 59 10 00 00       	push   $0x1059
+      86:	6a 00                	push   $0x0
+      88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+      8d:	e8 1e 01 00 00       	call   1b0 <exit>
+      92:	66 90                	xchg   %ax,%ax
+      94:	66 90                	xchg   %ax,%ax
+      96:	66 90                	xchg   %ax,%ax
+      98:	66 90                	xchg   %ax,%ax
+      9a:	66 90                	xchg   %ax,%ax
+      9c:	66 90                	xchg   %ax,%ax
+      9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+      a0:	55                   	push   %ebp
+  l = w = c = 0;
+      a1:	31 d2                	xor    %edx,%edx
+{
+      a3:	89 e5                	mov    %esp,%ebp
+      a5:	57                   	push   %edi
+      a6:	56                   	push   %esi
+  inword = 0;
+      a7:	31 f6                	xor    %esi,%esi
+{
+      a9:	53                   	push   %ebx
+  l = w = c = 0;
+      aa:	31 db                	xor    %ebx,%ebx
+{
+      ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+      af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+      b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      c0:	83 ec 04             	sub    $0x4,%esp
+      c3:	68 00 02 00 00       	push   $0x200
+      c8:	68 40 15 00 00       	push   $0x1540
+      cd:	ff 75 08             	push   0x8(%ebp)
+      d0:	e8 66 04 00 00       	call   53b <read>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	89 c1                	mov    %eax,%ecx
+      da:	85 c0                	test   %eax,%eax
+      dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+      de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+      e1:	31 ff                	xor    %edi,%edi
+      e3:	eb 0d                	jmp    f2 <wc+0x52>
+      e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+      e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+      ea:	83 c7 01             	add    $0x1,%edi
+      ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+      f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+      f2:	0f be 87 40 15 00 00 	movsbl 0x1540(%edi),%eax
+        l++;
+      f9:	31 c9                	xor    %ecx,%ecx
+      fb:	3c 0a                	cmp    $0xa,%al
+      fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	50                   	push   %eax
+        l++;
+     104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+     106:	68 44 10 00 00       	push   $0x1044
+     10b:	e8 10 02 00 00       	call   320 <strchr>
+     110:	83 c4 10             	add    $0x10,%esp
+     113:	85 c0                	test   %eax,%eax
+     115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+     117:	85 f6                	test   %esi,%esi
+     119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+     11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+     11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+     124:	83 c7 01             	add    $0x1,%edi
+     127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     12a:	75 c6                	jne    f2 <wc+0x52>
+     12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+     130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+     136:	eb 88                	jmp    c0 <wc+0x20>
+     138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13f:	90                   	nop
+  if(n < 0){
+     140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+     145:	83 ec 08             	sub    $0x8,%esp
+     148:	ff 75 0c             	push   0xc(%ebp)
+     14b:	52                   	push   %edx
+     14c:	ff 75 e0             	push   -0x20(%ebp)
+     14f:	53                   	push   %ebx
+     150:	68 5a 10 00 00       	push   $0x105a
+     155:	6a 01                	push   $0x1
+     157:	e8 44 07 00 00       	call   8a0 <printf>
+}
+     15c:	83 c4 20             	add    $0x20,%esp
+     15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     162:	5b                   	pop    %ebx
+     163:	5e                   	pop    %esi
+     164:	5f                   	pop    %edi
+     165:	5d                   	pop    %ebp
+     166:	c3                   	ret
+    printf(1, "wc: read error\n");
+     167:	50                   	push   %eax
+     168:	50                   	push   %eax
+     169:	68 4a 10 00 00       	push   $0x104a
+     16e:	6a 01                	push   $0x1
+     170:	e8 2b 07 00 00       	call   8a0 <printf>
+    exit();
+     175:	e8 36 00 00 00       	call   1b0 <exit>
+     17a:	66 90                	xchg   %ax,%ax
+     17c:	66 90                	xchg   %ax,%ax
+     17e:	66 90                	xchg   %ax,%ax
+
+00000180 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     180:	a1 40 17 00 00       	mov    0x1740,%eax
+     185:	85 c0                	test   %eax,%eax
+     187:	74 17                	je     1a0 <fork+0x20>
+{
+     189:	55                   	push   %ebp
+     18a:	89 e5                	mov    %esp,%ebp
+     18c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     18f:	ff d0                	call   *%eax
+  return _fork();
+}
+     191:	c9                   	leave
+  return _fork();
+     192:	e9 84 03 00 00       	jmp    51b <_fork>
+     197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19e:	66 90                	xchg   %ax,%ax
+     1a0:	e9 76 03 00 00       	jmp    51b <_fork>
+     1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <exit>:
+
+int
+exit(void)
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     1b6:	a1 40 17 00 00       	mov    0x1740,%eax
+     1bb:	85 c0                	test   %eax,%eax
+     1bd:	74 02                	je     1c1 <exit+0x11>
+    stdioflush();
+     1bf:	ff d0                	call   *%eax
+  _exit();
+     1c1:	e8 5d 03 00 00       	call   523 <_exit>
+     1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     1d0:	55                   	push   %ebp
+  if(stdioflush)
+     1d1:	a1 40 17 00 00       	mov    0x1740,%eax
+{
+     1d6:	89 e5                	mov    %esp,%ebp
+     1d8:	56                   	push   %esi
+     1d9:	53                   	push   %ebx
+     1da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     1e0:	85 c0                	test   %eax,%eax
+     1e2:	74 02                	je     1e6 <exec+0x16>
+    stdioflush();
+     1e4:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     1e6:	89 75 0c             	mov    %esi,0xc(%ebp)
+     1e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1ec:	5b                   	pop    %ebx
+     1ed:	5e                   	pop    %esi
+     1ee:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     1ef:	e9 67 03 00 00       	jmp    55b <_exec>
+     1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	57                   	push   %edi
+     204:	56                   	push   %esi
+     205:	53                   	push   %ebx
+     206:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     209:	a1 40 17 00 00       	mov    0x1740,%eax
+{
+     20e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     211:	8b 75 0c             	mov    0xc(%ebp),%esi
+     214:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     217:	85 c0                	test   %eax,%eax
+     219:	74 02                	je     21d <spawn+0x1d>
+    stdioflush();
+     21b:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     21d:	89 7d 10             	mov    %edi,0x10(%ebp)
+     220:	89 75 0c             	mov    %esi,0xc(%ebp)
+     223:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     226:	83 c4 0c             	add    $0xc,%esp
+     229:	5b                   	pop    %ebx
+     22a:	5e                   	pop    %esi
+     22b:	5f                   	pop    %edi
+     22c:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     22d:	e9 79 04 00 00       	jmp    6ab <_spawn>
+     232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     240:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     241:	31 c0                	xor    %eax,%eax
+{
+     243:	89 e5                	mov    %esp,%ebp
+     245:	53                   	push   %ebx
+     246:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     250:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     254:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     257:	83 c0 01             	add    $0x1,%eax
+     25a:	84 d2                	test   %dl,%dl
+     25c:	75 f2                	jne    250 <strcpy+0x10>
+    ;
+  return os;
+}
+     25e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     261:	89 c8                	mov    %ecx,%eax
+     263:	c9                   	leave
+     264:	c3                   	ret
+     265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	53                   	push   %ebx
+     274:	8b 55 08             	mov    0x8(%ebp),%edx
+     277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     27a:	0f b6 02             	movzbl (%edx),%eax
+     27d:	84 c0                	test   %al,%al
+     27f:	75 17                	jne    298 <strcmp+0x28>
+     281:	eb 3a                	jmp    2bd <strcmp+0x4d>
+     283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     287:	90                   	nop
+     288:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     28c:	83 c2 01             	add    $0x1,%edx
+     28f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     292:	84 c0                	test   %al,%al
+     294:	74 1a                	je     2b0 <strcmp+0x40>
+    p++, q++;
+     296:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     298:	0f b6 19             	movzbl (%ecx),%ebx
+     29b:	38 c3                	cmp    %al,%bl
+     29d:	74 e9                	je     288 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     29f:	29 d8                	sub    %ebx,%eax
+}
+     2a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a4:	c9                   	leave
+     2a5:	c3                   	ret
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     2b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     2b4:	31 c0                	xor    %eax,%eax
+     2b6:	29 d8                	sub    %ebx,%eax
+}
+     2b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2bb:	c9                   	leave
+     2bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     2bd:	0f b6 19             	movzbl (%ecx),%ebx
+     2c0:	31 c0                	xor    %eax,%eax
+     2c2:	eb db                	jmp    29f <strcmp+0x2f>
+     2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2cf:	90                   	nop
+
+000002d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     2d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     2d9:	74 15                	je     2f0 <strlen+0x20>
+     2db:	31 c0                	xor    %eax,%eax
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+     2e0:	83 c0 01             	add    $0x1,%eax
+     2e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     2e7:	89 c1                	mov    %eax,%ecx
+     2e9:	75 f5                	jne    2e0 <strlen+0x10>
+    ;
+  return n;
+}
+     2eb:	89 c8                	mov    %ecx,%eax
+     2ed:	5d                   	pop    %ebp
+     2ee:	c3                   	ret
+     2ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     2f0:	31 c9                	xor    %ecx,%ecx
+}
+     2f2:	5d                   	pop    %ebp
+     2f3:	89 c8                	mov    %ecx,%eax
+     2f5:	c3                   	ret
+     2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     307:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     30a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     30d:	89 d7                	mov    %edx,%edi
+     30f:	fc                   	cld
+     310:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     312:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     315:	89 d0                	mov    %edx,%eax
+     317:	c9                   	leave
+     318:	c3                   	ret
+     319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	8b 45 08             	mov    0x8(%ebp),%eax
+     326:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     32a:	0f b6 10             	movzbl (%eax),%edx
+     32d:	84 d2                	test   %dl,%dl
+     32f:	75 12                	jne    343 <strchr+0x23>
+     331:	eb 1d                	jmp    350 <strchr+0x30>
+     333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     337:	90                   	nop
+     338:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     33c:	83 c0 01             	add    $0x1,%eax
+     33f:	84 d2                	test   %dl,%dl
+     341:	74 0d                	je     350 <strchr+0x30>
+    if(*s == c)
+     343:	38 d1                	cmp    %dl,%cl
+     345:	75 f1                	jne    338 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     347:	5d                   	pop    %ebp
+     348:	c3                   	ret
+     349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     350:	31 c0                	xor    %eax,%eax
+}
+     352:	5d                   	pop    %ebp
+     353:	c3                   	ret
+     354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+
+00000360 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	57                   	push   %edi
+     364:	56                   	push   %esi
+     365:	53                   	push   %ebx
+     366:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     369:	a1 40 17 00 00       	mov    0x1740,%eax
+{
+     36e:	8b 75 08             	mov    0x8(%ebp),%esi
+     371:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     374:	85 c0                	test   %eax,%eax
+     376:	74 02                	je     37a <gets+0x1a>
+    stdioflush();
+     378:	ff d0                	call   *%eax
+  if(in.size == 0)
+     37a:	a1 68 19 00 00       	mov    0x1968,%eax
+     37f:	85 c0                	test   %eax,%eax
+     381:	0f 84 99 00 00 00    	je     420 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     387:	31 db                	xor    %ebx,%ebx
+     389:	eb 21                	jmp    3ac <gets+0x4c>
+     38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     38f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     390:	8d 50 01             	lea    0x1(%eax),%edx
+     393:	0f b6 80 60 17 00 00 	movzbl 0x1760(%eax),%eax
+     39a:	89 15 60 19 00 00    	mov    %edx,0x1960
+    buf[i++] = c;
+     3a0:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3a4:	3c 0a                	cmp    $0xa,%al
+     3a6:	74 60                	je     408 <gets+0xa8>
+     3a8:	3c 0d                	cmp    $0xd,%al
+     3aa:	74 5c                	je     408 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     3ac:	89 da                	mov    %ebx,%edx
+     3ae:	83 c3 01             	add    $0x1,%ebx
+     3b1:	39 fb                	cmp    %edi,%ebx
+     3b3:	7d 55                	jge    40a <gets+0xaa>
+    if(in.r == in.n){
+     3b5:	a1 60 19 00 00       	mov    0x1960,%eax
+     3ba:	3b 05 64 19 00 00    	cmp    0x1964,%eax
+     3c0:	75 ce                	jne    390 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3c2:	83 ec 04             	sub    $0x4,%esp
+     3c5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     3c8:	c7 05 64 19 00 00 00 	movl   $0x0,0x1964
+     3cf:	00 00 00 
+     3d2:	c7 05 60 19 00 00 00 	movl   $0x0,0x1960
+     3d9:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     3dc:	ff 35 68 19 00 00    	push   0x1968
+     3e2:	68 60 17 00 00       	push   $0x1760
+     3e7:	6a 00                	push   $0x0
+     3e9:	e8 4d 01 00 00       	call   53b <read>
+     3ee:	83 c4 10             	add    $0x10,%esp
+     3f1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     3f4:	85 c0                	test   %eax,%eax
+     3f6:	a3 64 19 00 00       	mov    %eax,0x1964
+     3fb:	7e 56                	jle    453 <gets+0xf3>
+    c = in.buf[in.r++];
+     3fd:	a1 60 19 00 00       	mov    0x1960,%eax
+     402:	eb 8c                	jmp    390 <gets+0x30>
+     404:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     408:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     40a:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     40e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     411:	89 f0                	mov    %esi,%eax
+     413:	5b                   	pop    %ebx
+     414:	5e                   	pop    %esi
+     415:	5f                   	pop    %edi
+     416:	5d                   	pop    %ebp
+     417:	c3                   	ret
+     418:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41f:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     420:	83 ec 08             	sub    $0x8,%esp
+     423:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     426:	50                   	push   %eax
+     427:	6a 00                	push   $0x0
+     429:	e8 4d 01 00 00       	call   57b <fstat>
+     42e:	83 c4 10             	add    $0x10,%esp
+     431:	89 c2                	mov    %eax,%edx
+     433:	b8 01 00 00 00       	mov    $0x1,%eax
+     438:	85 d2                	test   %edx,%edx
+     43a:	75 0d                	jne    449 <gets+0xe9>
+     43c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     441:	ba 00 02 00 00       	mov    $0x200,%edx
+     446:	0f 44 c2             	cmove  %edx,%eax
+     449:	a3 68 19 00 00       	mov    %eax,0x1968
+     44e:	e9 34 ff ff ff       	jmp    387 <gets+0x27>
+        in.n = 0;
+     453:	c7 05 64 19 00 00 00 	movl   $0x0,0x1964
+     45a:	00 00 00 
+        break;
+     45d:	eb ab                	jmp    40a <gets+0xaa>
+     45f:	90                   	nop
+
+00000460 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	56                   	push   %esi
+     464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     465:	83 ec 08             	sub    $0x8,%esp
+     468:	6a 00                	push   $0x0
+     46a:	ff 75 08             	push   0x8(%ebp)
+     46d:	e8 f1 00 00 00       	call   563 <open>
+  if(fd < 0)
+     472:	83 c4 10             	add    $0x10,%esp
+     475:	85 c0                	test   %eax,%eax
+     477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     479:	83 ec 08             	sub    $0x8,%esp
+     47c:	ff 75 0c             	push   0xc(%ebp)
+     47f:	89 c3                	mov    %eax,%ebx
+     481:	50                   	push   %eax
+     482:	e8 f4 00 00 00       	call   57b <fstat>
+  close(fd);
+     487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     48c:	e8 ba 00 00 00       	call   54b <close>
+  return r;
+     491:	83 c4 10             	add    $0x10,%esp
+}
+     494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     497:	89 f0                	mov    %esi,%eax
+     499:	5b                   	pop    %ebx
+     49a:	5e                   	pop    %esi
+     49b:	5d                   	pop    %ebp
+     49c:	c3                   	ret
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4a5:	eb ed                	jmp    494 <stat+0x34>
+     4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	53                   	push   %ebx
+     4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     4b7:	0f be 02             	movsbl (%edx),%eax
+     4ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     4bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     4c5:	77 1e                	ja     4e5 <atoi+0x35>
+     4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4d0:	83 c2 01             	add    $0x1,%edx
+     4d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4da:	0f be 02             	movsbl (%edx),%eax
+     4dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4e0:	80 fb 09             	cmp    $0x9,%bl
+     4e3:	76 eb                	jbe    4d0 <atoi+0x20>
+  return n;
+}
+     4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e8:	89 c8                	mov    %ecx,%eax
+     4ea:	c9                   	leave
+     4eb:	c3                   	ret
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	57                   	push   %edi
+     4f4:	56                   	push   %esi
+     4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     4fe:	85 c0                	test   %eax,%eax
+     500:	7e 13                	jle    515 <memmove+0x25>
+     502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     504:	89 d7                	mov    %edx,%edi
+     506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     511:	39 f8                	cmp    %edi,%eax
+     513:	75 fb                	jne    510 <memmove+0x20>
+  return vdst;
+}
+     515:	5e                   	pop    %esi
+     516:	89 d0                	mov    %edx,%eax
+     518:	5f                   	pop    %edi
+     519:	5d                   	pop    %ebp
+     51a:	c3                   	ret
+
+0000051b <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     51b:	b8 01 00 00 00       	mov    $0x1,%eax
+     520:	cd 40                	int    $0x40
+     522:	c3                   	ret
+
+00000523 <_exit>:
+RAWSYSCALL(exit)
+     523:	b8 02 00 00 00       	mov    $0x2,%eax
+     528:	cd 40                	int    $0x40
+     52a:	c3                   	ret
+
+0000052b <wait>:
+SYSCALL(wait)
+     52b:	b8 03 00 00 00       	mov    $0x3,%eax
+     530:	cd 40                	int    $0x40
+     532:	c3                   	ret
+
+00000533 <pipe>:
+SYSCALL(pipe)
+     533:	b8 04 00 00 00       	mov    $0x4,%eax
+     538:	cd 40                	int    $0x40
+     53a:	c3                   	ret
+
+0000053b <read>:
+SYSCALL(read)
+     53b:	b8 05 00 00 00       	mov    $0x5,%eax
+     540:	cd 40                	int    $0x40
+     542:	c3                   	ret
+
+00000543 <write>:
+SYSCALL(write)
+     543:	b8 10 00 00 00       	mov    $0x10,%eax
+     548:	cd 40                	int    $0x40
+     54a:	c3                   	ret
+
+0000054b <close>:
+SYSCALL(close)
+     54b:	b8 15 00 00 00       	mov    $0x15,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <kill>:
+SYSCALL(kill)
+     553:	b8 06 00 00 00       	mov    $0x6,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <_exec>:
+RAWSYSCALL(exec)
+     55b:	b8 07 00 00 00       	mov    $0x7,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <open>:
+SYSCALL(open)
+     563:	b8 0f 00 00 00       	mov    $0xf,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <mknod>:
+SYSCALL(mknod)
+     56b:	b8 11 00 00 00       	mov    $0x11,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <unlink>:
+SYSCALL(unlink)
+     573:	b8 12 00 00 00       	mov    $0x12,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <fstat>:
+SYSCALL(fstat)
+     57b:	b8 08 00 00 00       	mov    $0x8,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <link>:
+SYSCALL(link)
+     583:	b8 13 00 00 00       	mov    $0x13,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <mkdir>:
+SYSCALL(mkdir)
+     58b:	b8 14 00 00 00       	mov    $0x14,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <chdir>:
+SYSCALL(chdir)
+     593:	b8 09 00 00 00       	mov    $0x9,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <dup>:
+SYSCALL(dup)
+     59b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <getpid>:
+SYSCALL(getpid)
+     5a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <sbrk>:
+SYSCALL(sbrk)
+     5ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <sleep>:
+SYSCALL(sleep)
+     5b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <uptime>:
+SYSCALL(uptime)
+     5bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     5c3:	b8 16 00 00 00       	mov    $0x16,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <get_parent_id>:
+SYSCALL(get_parent_id)
+     5cb:	b8 17 00 00 00       	mov    $0x17,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <get_children>:
+SYSCALL(get_children)
+     5d3:	b8 18 00 00 00       	mov    $0x18,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <set_path>:
+SYSCALL(set_path)
+     5db:	b8 19 00 00 00       	mov    $0x19,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <set_sleep>:
+SYSCALL(set_sleep)
+     5e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <get_time>:
+SYSCALL(get_time)
+     5eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <change_process_level>:
+SYSCALL(change_process_level)
+     5f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     5fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     603:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <print_processes_info>:
+SYSCALL(print_processes_info)
+     60b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <barrier_init>:
+
+SYSCALL(barrier_init)
+     613:	b8 20 00 00 00       	mov    $0x20,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <barrier_wait>:
+SYSCALL(barrier_wait)
+     61b:	b8 21 00 00 00       	mov    $0x21,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     623:	b8 22 00 00 00       	mov    $0x22,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     62b:	b8 23 00 00 00       	mov    $0x23,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <set_process_gang>:
+SYSCALL(set_process_gang)
+     633:	b8 24 00 00 00       	mov    $0x24,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     63b:	b8 25 00 00 00       	mov    $0x25,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <sem_create>:
+SYSCALL(sem_create)
+     643:	b8 26 00 00 00       	mov    $0x26,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <event_create>:
+SYSCALL(event_create)
+     64b:	b8 27 00 00 00       	mov    $0x27,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <sync_post>:
+SYSCALL(sync_post)
+     653:	b8 28 00 00 00       	mov    $0x28,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <sync_wait>:
+SYSCALL(sync_wait)
+     65b:	b8 29 00 00 00       	mov    $0x29,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <sync_close>:
+SYSCALL(sync_close)
+     663:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <event_reset>:
+SYSCALL(event_reset)
+     66b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     673:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+
+0000067b <mmap>:
+SYSCALL(mmap)
+     67b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     680:	cd 40                	int    $0x40
+     682:	c3                   	ret
+
+00000683 <munmap>:
+SYSCALL(munmap)
+     683:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     688:	cd 40                	int    $0x40
+     68a:	c3                   	ret
+
+0000068b <shmget>:
+SYSCALL(shmget)
+     68b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     690:	cd 40                	int    $0x40
+     692:	c3                   	ret
+
+00000693 <shmat>:
+SYSCALL(shmat)
+     693:	b8 30 00 00 00       	mov    $0x30,%eax
+     698:	cd 40                	int    $0x40
+     69a:	c3                   	ret
+
+0000069b <shmdt>:
+SYSCALL(shmdt)
+     69b:	b8 31 00 00 00       	mov    $0x31,%eax
+     6a0:	cd 40                	int    $0x40
+     6a2:	c3                   	ret
+
+000006a3 <shmrm>:
+SYSCALL(shmrm)
+     6a3:	b8 32 00 00 00       	mov    $0x32,%eax
+     6a8:	cd 40                	int    $0x40
+     6aa:	c3                   	ret
+
+000006ab <_spawn>:
+RAWSYSCALL(spawn)
+     6ab:	b8 33 00 00 00       	mov    $0x33,%eax
+     6b0:	cd 40                	int    $0x40
+     6b2:	c3                   	ret
+
+000006b3 <memstat>:
+SYSCALL(memstat)
+     6b3:	b8 34 00 00 00       	mov    $0x34,%eax
+     6b8:	cd 40                	int    $0x40
+     6ba:	c3                   	ret
+     6bb:	66 90                	xchg   %ax,%ax
+     6bd:	66 90                	xchg   %ax,%ax
+     6bf:	90                   	nop
+
+000006c0 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     6c6:	a1 a8 1b 00 00       	mov    0x1ba8,%eax
+     6cb:	85 c0                	test   %eax,%eax
+     6cd:	7e 17                	jle    6e6 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     6cf:	83 ec 04             	sub    $0x4,%esp
+     6d2:	50                   	push   %eax
+     6d3:	68 ac 1b 00 00       	push   $0x1bac
+     6d8:	ff 35 a0 1b 00 00    	push   0x1ba0
+     6de:	e8 60 fe ff ff       	call   543 <write>
+     6e3:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     6e6:	c7 05 a8 1b 00 00 00 	movl   $0x0,0x1ba8
+     6ed:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     6f0:	c7 05 a4 1b 00 00 00 	movl   $0x0,0x1ba4
+     6f7:	00 00 00 
+}
+     6fa:	c9                   	leave
+     6fb:	c3                   	ret
+     6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	57                   	push   %edi
+     704:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     706:	89 d1                	mov    %edx,%ecx
+{
+     708:	56                   	push   %esi
+     709:	53                   	push   %ebx
+     70a:	89 c3                	mov    %eax,%ebx
+     70c:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     70f:	85 d2                	test   %edx,%edx
+     711:	0f 89 b9 00 00 00    	jns    7d0 <printint+0xd0>
+     717:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     71b:	0f 84 af 00 00 00    	je     7d0 <printint+0xd0>
+    x = -xx;
+     721:	f7 d9                	neg    %ecx
+    neg = 1;
+     723:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     728:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     72b:	31 f6                	xor    %esi,%esi
+     72d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     730:	89 c8                	mov    %ecx,%eax
+     732:	31 d2                	xor    %edx,%edx
+     734:	89 f3                	mov    %esi,%ebx
+     736:	f7 f7                	div    %edi
+     738:	8d 76 01             	lea    0x1(%esi),%esi
+     73b:	0f b6 92 dc 10 00 00 	movzbl 0x10dc(%edx),%edx
+     742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     746:	89 ca                	mov    %ecx,%edx
+     748:	89 c1                	mov    %eax,%ecx
+     74a:	39 fa                	cmp    %edi,%edx
+     74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+     74e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     751:	89 d9                	mov    %ebx,%ecx
+     753:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     756:	85 c0                	test   %eax,%eax
+     758:	74 07                	je     761 <printint+0x61>
+    buf[i++] = '-';
+     75a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     75f:	89 f1                	mov    %esi,%ecx
+     761:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     764:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     766:	8d 43 0c             	lea    0xc(%ebx),%eax
+     769:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     76c:	01 f7                	add    %esi,%edi
+     76e:	eb 09                	jmp    779 <printint+0x79>
+
+  while(--i >= 0)
+     770:	8d 47 ff             	lea    -0x1(%edi),%eax
+     773:	39 f7                	cmp    %esi,%edi
+     775:	74 36                	je     7ad <printint+0xad>
+     777:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     779:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     77c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     77f:	8d 42 01             	lea    0x1(%edx),%eax
+     782:	89 43 08             	mov    %eax,0x8(%ebx)
+     785:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     789:	3d 00 02 00 00       	cmp    $0x200,%eax
+     78e:	74 28                	je     7b8 <printint+0xb8>
+     790:	80 f9 0a             	cmp    $0xa,%cl
+     793:	75 db                	jne    770 <printint+0x70>
+     795:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     799:	75 d5                	jne    770 <printint+0x70>
+  if(b->n > 0)
+     79b:	85 c0                	test   %eax,%eax
+     79d:	7f 19                	jg     7b8 <printint+0xb8>
+  b->n = 0;
+     79f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     7a6:	8d 47 ff             	lea    -0x1(%edi),%eax
+     7a9:	39 f7                	cmp    %esi,%edi
+     7ab:	75 ca                	jne    777 <printint+0x77>
+}
+     7ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7b0:	5b                   	pop    %ebx
+     7b1:	5e                   	pop    %esi
+     7b2:	5f                   	pop    %edi
+     7b3:	5d                   	pop    %ebp
+     7b4:	c3                   	ret
+     7b5:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     7b8:	83 ec 04             	sub    $0x4,%esp
+     7bb:	50                   	push   %eax
+     7bc:	ff 75 d4             	push   -0x2c(%ebp)
+     7bf:	ff 33                	push   (%ebx)
+     7c1:	e8 7d fd ff ff       	call   543 <write>
+     7c6:	83 c4 10             	add    $0x10,%esp
+     7c9:	eb d4                	jmp    79f <printint+0x9f>
+     7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+  neg = 0;
+     7d0:	31 c0                	xor    %eax,%eax
+     7d2:	e9 51 ff ff ff       	jmp    728 <printint+0x28>
+     7d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <putc>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	53                   	push   %ebx
+     7e4:	89 c3                	mov    %eax,%ebx
+     7e6:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     7e9:	8b 48 08             	mov    0x8(%eax),%ecx
+     7ec:	8d 41 01             	lea    0x1(%ecx),%eax
+     7ef:	89 43 08             	mov    %eax,0x8(%ebx)
+     7f2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     7f6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7fb:	74 33                	je     830 <putc+0x50>
+     7fd:	80 fa 0a             	cmp    $0xa,%dl
+     800:	74 0e                	je     810 <putc+0x30>
+}
+     802:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     805:	c9                   	leave
+     806:	c3                   	ret
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     810:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     814:	75 ec                	jne    802 <putc+0x22>
+  if(b->n > 0)
+     816:	85 c0                	test   %eax,%eax
+     818:	7f 16                	jg     830 <putc+0x50>
+  b->n = 0;
+     81a:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     824:	c9                   	leave
+     825:	c3                   	ret
+     826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     830:	83 ec 04             	sub    $0x4,%esp
+     833:	50                   	push   %eax
+     834:	8d 43 0c             	lea    0xc(%ebx),%eax
+     837:	50                   	push   %eax
+     838:	ff 33                	push   (%ebx)
+     83a:	e8 04 fd ff ff       	call   543 <write>
+     83f:	83 c4 10             	add    $0x10,%esp
+     842:	eb d6                	jmp    81a <putc+0x3a>
+     844:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     84f:	90                   	nop
+
+00000850 <fflush>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     856:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     85a:	74 04                	je     860 <fflush+0x10>
+}
+     85c:	c9                   	leave
+     85d:	c3                   	ret
+     85e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     860:	a1 a8 1b 00 00       	mov    0x1ba8,%eax
+     865:	85 c0                	test   %eax,%eax
+     867:	7f 17                	jg     880 <fflush+0x30>
+  b->n = 0;
+     869:	c7 05 a8 1b 00 00 00 	movl   $0x0,0x1ba8
+     870:	00 00 00 
+  out.mode = 0;
+     873:	c7 05 a4 1b 00 00 00 	movl   $0x0,0x1ba4
+     87a:	00 00 00 
+}
+     87d:	c9                   	leave
+     87e:	c3                   	ret
+     87f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     880:	83 ec 04             	sub    $0x4,%esp
+     883:	50                   	push   %eax
+     884:	68 ac 1b 00 00       	push   $0x1bac
+     889:	ff 35 a0 1b 00 00    	push   0x1ba0
+     88f:	e8 af fc ff ff       	call   543 <write>
+     894:	83 c4 10             	add    $0x10,%esp
+     897:	eb d0                	jmp    869 <fflush+0x19>
+     899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	56                   	push   %esi
+     8a5:	53                   	push   %ebx
+     8a6:	83 ec 3c             	sub    $0x3c,%esp
+     8a9:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     8ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     8af:	83 fe 01             	cmp    $0x1,%esi
+     8b2:	0f 84 60 01 00 00    	je     a18 <printf+0x178>
+    b->fd = fd;
+     8b8:	89 35 80 19 00 00    	mov    %esi,0x1980
+  for(i = 0; fmt[i]; i++){
+     8be:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     8c1:	bf 80 19 00 00       	mov    $0x1980,%edi
+  for(i = 0; fmt[i]; i++){
+     8c6:	84 c0                	test   %al,%al
+     8c8:	74 65                	je     92f <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     8ca:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     8cd:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     8d0:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     8d2:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     8d5:	eb 1f                	jmp    8f6 <printf+0x56>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     8e0:	83 f8 25             	cmp    $0x25,%eax
+     8e3:	74 3b                	je     920 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     8e5:	89 f8                	mov    %edi,%eax
+     8e7:	e8 f4 fe ff ff       	call   7e0 <putc>
+  for(i = 0; fmt[i]; i++){
+     8ec:	0f b6 03             	movzbl (%ebx),%eax
+     8ef:	83 c3 01             	add    $0x1,%ebx
+     8f2:	84 c0                	test   %al,%al
+     8f4:	74 39                	je     92f <printf+0x8f>
+    c = fmt[i] & 0xff;
+     8f6:	0f be d0             	movsbl %al,%edx
+     8f9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     8fc:	85 f6                	test   %esi,%esi
+     8fe:	74 e0                	je     8e0 <printf+0x40>
+      }
+    } else if(state == '%'){
+     900:	83 fe 25             	cmp    $0x25,%esi
+     903:	75 e7                	jne    8ec <printf+0x4c>
+      if(c == 'd'){
+     905:	83 f8 25             	cmp    $0x25,%eax
+     908:	74 57                	je     961 <printf+0xc1>
+     90a:	83 e8 63             	sub    $0x63,%eax
+     90d:	83 f8 15             	cmp    $0x15,%eax
+     910:	77 36                	ja     948 <printf+0xa8>
+     912:	ff 24 85 84 10 00 00 	jmp    *0x1084(,%eax,4)
+     919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     920:	0f b6 03             	movzbl (%ebx),%eax
+     923:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     926:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     92b:	84 c0                	test   %al,%al
+     92d:	75 c7                	jne    8f6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     92f:	8b 47 04             	mov    0x4(%edi),%eax
+     932:	85 c0                	test   %eax,%eax
+     934:	0f 84 06 01 00 00    	je     a40 <printf+0x1a0>
+    bflush(b);
+}
+     93a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     93d:	5b                   	pop    %ebx
+     93e:	5e                   	pop    %esi
+     93f:	5f                   	pop    %edi
+     940:	5d                   	pop    %ebp
+     941:	c3                   	ret
+     942:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     948:	8b 4f 08             	mov    0x8(%edi),%ecx
+     94b:	8d 41 01             	lea    0x1(%ecx),%eax
+     94e:	89 47 08             	mov    %eax,0x8(%edi)
+     951:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     956:	3d 00 02 00 00       	cmp    $0x200,%eax
+     95b:	0f 84 77 01 00 00    	je     ad8 <printf+0x238>
+        putc(b, c);
+     961:	89 f8                	mov    %edi,%eax
+      state = 0;
+     963:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     965:	e8 76 fe ff ff       	call   7e0 <putc>
+     96a:	eb 80                	jmp    8ec <printf+0x4c>
+     96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     970:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     973:	83 ec 0c             	sub    $0xc,%esp
+     976:	b9 10 00 00 00       	mov    $0x10,%ecx
+     97b:	8b 16                	mov    (%esi),%edx
+     97d:	6a 00                	push   $0x0
+        ap++;
+     97f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     982:	89 f8                	mov    %edi,%eax
+     984:	e8 77 fd ff ff       	call   700 <printint>
+        ap++;
+     989:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     98f:	31 f6                	xor    %esi,%esi
+     991:	e9 56 ff ff ff       	jmp    8ec <printf+0x4c>
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     9a0:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     9a3:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     9a5:	83 c0 04             	add    $0x4,%eax
+     9a8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     9ab:	85 c9                	test   %ecx,%ecx
+     9ad:	0f 84 cd 00 00 00    	je     a80 <printf+0x1e0>
+        while(*s != 0){
+     9b3:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     9b6:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     9b8:	84 d2                	test   %dl,%dl
+     9ba:	0f 84 2c ff ff ff    	je     8ec <printf+0x4c>
+          putc(b, *s);
+     9c0:	89 f8                	mov    %edi,%eax
+     9c2:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     9c5:	e8 16 fe ff ff       	call   7e0 <putc>
+          s++;
+     9ca:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     9cd:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     9d1:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     9d4:	84 d2                	test   %dl,%dl
+     9d6:	75 e8                	jne    9c0 <printf+0x120>
+      state = 0;
+     9d8:	31 f6                	xor    %esi,%esi
+     9da:	e9 0d ff ff ff       	jmp    8ec <printf+0x4c>
+     9df:	90                   	nop
+        printint(b, *ap, 10, 1);
+     9e0:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9e3:	83 ec 0c             	sub    $0xc,%esp
+     9e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     9eb:	8b 16                	mov    (%esi),%edx
+     9ed:	6a 01                	push   $0x1
+     9ef:	eb 8e                	jmp    97f <printf+0xdf>
+     9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     9f8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9fb:	89 f8                	mov    %edi,%eax
+     9fd:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     a00:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     a03:	e8 d8 fd ff ff       	call   7e0 <putc>
+        ap++;
+     a08:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     a0b:	31 f6                	xor    %esi,%esi
+     a0d:	e9 da fe ff ff       	jmp    8ec <printf+0x4c>
+     a12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     a18:	8b 15 a4 1b 00 00    	mov    0x1ba4,%edx
+     a1e:	85 d2                	test   %edx,%edx
+     a20:	74 6e                	je     a90 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     a22:	0f b6 03             	movzbl (%ebx),%eax
+     a25:	bf a0 1b 00 00       	mov    $0x1ba0,%edi
+     a2a:	84 c0                	test   %al,%al
+     a2c:	0f 85 98 fe ff ff    	jne    8ca <printf+0x2a>
+     a32:	e9 03 ff ff ff       	jmp    93a <printf+0x9a>
+     a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     a40:	8b 47 08             	mov    0x8(%edi),%eax
+     a43:	85 c0                	test   %eax,%eax
+     a45:	7f 19                	jg     a60 <printf+0x1c0>
+  b->n = 0;
+     a47:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a51:	5b                   	pop    %ebx
+     a52:	5e                   	pop    %esi
+     a53:	5f                   	pop    %edi
+     a54:	5d                   	pop    %ebp
+     a55:	c3                   	ret
+     a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     a60:	83 ec 04             	sub    $0x4,%esp
+     a63:	50                   	push   %eax
+     a64:	8d 47 0c             	lea    0xc(%edi),%eax
+     a67:	50                   	push   %eax
+     a68:	ff 37                	push   (%edi)
+     a6a:	e8 d4 fa ff ff       	call   543 <write>
+  b->n = 0;
+     a6f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     a76:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     a79:	eb d3                	jmp    a4e <printf+0x1ae>
+     a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a7f:	90                   	nop
+     a80:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     a85:	b9 7b 10 00 00       	mov    $0x107b,%ecx
+     a8a:	e9 31 ff ff ff       	jmp    9c0 <printf+0x120>
+     a8f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     a90:	83 ec 08             	sub    $0x8,%esp
+     a93:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     a96:	c7 05 a0 1b 00 00 01 	movl   $0x1,0x1ba0
+     a9d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     aa0:	50                   	push   %eax
+     aa1:	6a 01                	push   $0x1
+     aa3:	e8 d3 fa ff ff       	call   57b <fstat>
+     aa8:	83 c4 10             	add    $0x10,%esp
+     aab:	85 c0                	test   %eax,%eax
+     aad:	75 22                	jne    ad1 <printf+0x231>
+     aaf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     ab4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ab9:	0f 45 f0             	cmovne %eax,%esi
+     abc:	89 35 a4 1b 00 00    	mov    %esi,0x1ba4
+      stdioflush = flushout;
+     ac2:	c7 05 40 17 00 00 c0 	movl   $0x6c0,0x1740
+     ac9:	06 00 00 
+     acc:	e9 51 ff ff ff       	jmp    a22 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     ad1:	be 02 00 00 00       	mov    $0x2,%esi
+     ad6:	eb e4                	jmp    abc <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     ad8:	83 ec 04             	sub    $0x4,%esp
+     adb:	8d 47 0c             	lea    0xc(%edi),%eax
+     ade:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     ae1:	68 00 02 00 00       	push   $0x200
+     ae6:	50                   	push   %eax
+     ae7:	ff 37                	push   (%edi)
+     ae9:	e8 55 fa ff ff       	call   543 <write>
+  b->n = 0;
+     aee:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     af5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     af8:	83 c4 10             	add    $0x10,%esp
+     afb:	e9 61 fe ff ff       	jmp    961 <printf+0xc1>
+
+00000b00 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	56                   	push   %esi
+     b04:	53                   	push   %ebx
+     b05:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     b07:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     b0c:	39 d8                	cmp    %ebx,%eax
+     b0e:	0f 83 e4 00 00 00    	jae    bf8 <freepages+0xf8>
+     b14:	85 c0                	test   %eax,%eax
+     b16:	0f 84 dc 00 00 00    	je     bf8 <freepages+0xf8>
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b20:	89 c2                	mov    %eax,%edx
+     b22:	8b 00                	mov    (%eax),%eax
+     b24:	85 c0                	test   %eax,%eax
+     b26:	74 04                	je     b2c <freepages+0x2c>
+     b28:	39 d8                	cmp    %ebx,%eax
+     b2a:	72 f4                	jb     b20 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     b2c:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     b2f:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     b31:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     b33:	85 c0                	test   %eax,%eax
+     b35:	74 15                	je     b4c <freepages+0x4c>
+    p->prev = s;
+     b37:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     b3a:	8b 73 10             	mov    0x10(%ebx),%esi
+     b3d:	89 f1                	mov    %esi,%ecx
+     b3f:	c1 e1 0c             	shl    $0xc,%ecx
+     b42:	01 d9                	add    %ebx,%ecx
+     b44:	39 c8                	cmp    %ecx,%eax
+     b46:	0f 84 d8 00 00 00    	je     c24 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     b4c:	8b 4a 10             	mov    0x10(%edx),%ecx
+     b4f:	89 c8                	mov    %ecx,%eax
+     b51:	c1 e0 0c             	shl    $0xc,%eax
+     b54:	01 d0                	add    %edx,%eax
+     b56:	39 c3                	cmp    %eax,%ebx
+     b58:	74 16                	je     b70 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b5a:	8b 03                	mov    (%ebx),%eax
+     b5c:	85 c0                	test   %eax,%eax
+     b5e:	74 40                	je     ba0 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+     b60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b63:	5b                   	pop    %ebx
+     b64:	5e                   	pop    %esi
+     b65:	5d                   	pop    %ebp
+     b66:	c3                   	ret
+     b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+     b70:	03 4b 10             	add    0x10(%ebx),%ecx
+     b73:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+     b76:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+     b79:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     b7b:	85 c9                	test   %ecx,%ecx
+     b7d:	0f 84 dd 00 00 00    	je     c60 <freepages+0x160>
+    s->prev->next = s->next;
+     b83:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+     b85:	85 c0                	test   %eax,%eax
+     b87:	74 06                	je     b8f <freepages+0x8f>
+    s->next->prev = s->prev;
+     b89:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b8c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+     b8f:	8b 02                	mov    (%edx),%eax
+     b91:	89 d3                	mov    %edx,%ebx
+     b93:	85 c0                	test   %eax,%eax
+     b95:	75 c9                	jne    b60 <freepages+0x60>
+     b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9e:	66 90                	xchg   %ax,%ax
+     ba0:	8b 43 10             	mov    0x10(%ebx),%eax
+     ba3:	83 f8 0f             	cmp    $0xf,%eax
+     ba6:	76 b8                	jbe    b60 <freepages+0x60>
+     ba8:	83 ec 0c             	sub    $0xc,%esp
+     bab:	c1 e0 0c             	shl    $0xc,%eax
+     bae:	6a 00                	push   $0x0
+     bb0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     bb3:	e8 f3 f9 ff ff       	call   5ab <sbrk>
+     bb8:	83 c4 10             	add    $0x10,%esp
+     bbb:	39 c6                	cmp    %eax,%esi
+     bbd:	75 a1                	jne    b60 <freepages+0x60>
+  if(s->prev)
+     bbf:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+     bc2:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+     bc4:	85 d2                	test   %edx,%edx
+     bc6:	0f 84 a5 00 00 00    	je     c71 <freepages+0x171>
+    s->prev->next = s->next;
+     bcc:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+     bce:	85 c0                	test   %eax,%eax
+     bd0:	74 06                	je     bd8 <freepages+0xd8>
+    s->next->prev = s->prev;
+     bd2:	8b 53 04             	mov    0x4(%ebx),%edx
+     bd5:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+     bd8:	8b 43 10             	mov    0x10(%ebx),%eax
+     bdb:	83 ec 0c             	sub    $0xc,%esp
+     bde:	c1 e0 0c             	shl    $0xc,%eax
+     be1:	f7 d8                	neg    %eax
+     be3:	50                   	push   %eax
+     be4:	e8 c2 f9 ff ff       	call   5ab <sbrk>
+     be9:	83 c4 10             	add    $0x10,%esp
+}
+     bec:	e9 6f ff ff ff       	jmp    b60 <freepages+0x60>
+     bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+     bf8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+     bff:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+     c01:	89 1d c0 1d 00 00    	mov    %ebx,0x1dc0
+  if(p)
+     c07:	85 c0                	test   %eax,%eax
+     c09:	74 95                	je     ba0 <freepages+0xa0>
+    p->prev = s;
+     c0b:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+     c0e:	8b 73 10             	mov    0x10(%ebx),%esi
+     c11:	89 f2                	mov    %esi,%edx
+     c13:	c1 e2 0c             	shl    $0xc,%edx
+     c16:	01 da                	add    %ebx,%edx
+     c18:	39 d0                	cmp    %edx,%eax
+     c1a:	0f 85 3a ff ff ff    	jne    b5a <freepages+0x5a>
+     c20:	89 c1                	mov    %eax,%ecx
+     c22:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+     c24:	8b 41 10             	mov    0x10(%ecx),%eax
+     c27:	01 f0                	add    %esi,%eax
+     c29:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+     c2c:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+     c2f:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+     c31:	85 f6                	test   %esi,%esi
+     c33:	74 35                	je     c6a <freepages+0x16a>
+    s->prev->next = s->next;
+     c35:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+     c37:	85 c0                	test   %eax,%eax
+     c39:	74 06                	je     c41 <freepages+0x141>
+    s->next->prev = s->prev;
+     c3b:	8b 49 04             	mov    0x4(%ecx),%ecx
+     c3e:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+     c41:	85 d2                	test   %edx,%edx
+     c43:	0f 84 11 ff ff ff    	je     b5a <freepages+0x5a>
+     c49:	8b 4a 10             	mov    0x10(%edx),%ecx
+     c4c:	89 c8                	mov    %ecx,%eax
+     c4e:	c1 e0 0c             	shl    $0xc,%eax
+     c51:	01 d0                	add    %edx,%eax
+     c53:	39 c3                	cmp    %eax,%ebx
+     c55:	0f 85 ff fe ff ff    	jne    b5a <freepages+0x5a>
+     c5b:	e9 10 ff ff ff       	jmp    b70 <freepages+0x70>
+    *l = s->next;
+     c60:	a3 c0 1d 00 00       	mov    %eax,0x1dc0
+     c65:	e9 1b ff ff ff       	jmp    b85 <freepages+0x85>
+     c6a:	a3 c0 1d 00 00       	mov    %eax,0x1dc0
+     c6f:	eb c6                	jmp    c37 <freepages+0x137>
+     c71:	a3 c0 1d 00 00       	mov    %eax,0x1dc0
+     c76:	e9 53 ff ff ff       	jmp    bce <freepages+0xce>
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+
+00000c80 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	56                   	push   %esi
+     c84:	53                   	push   %ebx
+     c85:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+     c87:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+     c8c:	85 c0                	test   %eax,%eax
+     c8e:	74 5e                	je     cee <getpages+0x6e>
+    if(s->npages < n)
+     c90:	8b 50 10             	mov    0x10(%eax),%edx
+     c93:	39 da                	cmp    %ebx,%edx
+     c95:	72 51                	jb     ce8 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+     c97:	39 d3                	cmp    %edx,%ebx
+     c99:	72 25                	jb     cc0 <getpages+0x40>
+  if(s->prev)
+     c9b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+     c9e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+     ca0:	85 c9                	test   %ecx,%ecx
+     ca2:	0f 84 a8 00 00 00    	je     d50 <getpages+0xd0>
+    s->prev->next = s->next;
+     ca8:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+     caa:	85 d2                	test   %edx,%edx
+     cac:	74 06                	je     cb4 <getpages+0x34>
+    s->next->prev = s->prev;
+     cae:	8b 48 04             	mov    0x4(%eax),%ecx
+     cb1:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+     cb4:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+     cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cba:	5b                   	pop    %ebx
+     cbb:	5e                   	pop    %esi
+     cbc:	5d                   	pop    %ebp
+     cbd:	c3                   	ret
+     cbe:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     cc0:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+     cc2:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+     cc4:	c1 e1 0c             	shl    $0xc,%ecx
+     cc7:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+     cc9:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+     ccc:	8b 70 04             	mov    0x4(%eax),%esi
+     ccf:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+     cd2:	8b 10                	mov    (%eax),%edx
+     cd4:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+     cd6:	85 f6                	test   %esi,%esi
+     cd8:	74 66                	je     d40 <getpages+0xc0>
+        rest->prev->next = rest;
+     cda:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+     cdc:	8b 11                	mov    (%ecx),%edx
+     cde:	85 d2                	test   %edx,%edx
+     ce0:	75 cf                	jne    cb1 <getpages+0x31>
+     ce2:	eb d0                	jmp    cb4 <getpages+0x34>
+     ce4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+     ce8:	8b 00                	mov    (%eax),%eax
+     cea:	85 c0                	test   %eax,%eax
+     cec:	75 a2                	jne    c90 <getpages+0x10>
+  brk = (uint)sbrk(0);
+     cee:	83 ec 0c             	sub    $0xc,%esp
+     cf1:	6a 00                	push   $0x0
+     cf3:	e8 b3 f8 ff ff       	call   5ab <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+     cf8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+     cfb:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+     d01:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d03:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+     d09:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+     d0f:	29 d0                	sub    %edx,%eax
+     d11:	c1 e8 0c             	shr    $0xc,%eax
+     d14:	39 d8                	cmp    %ebx,%eax
+     d16:	72 48                	jb     d60 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+     d18:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d1a:	89 d8                	mov    %ebx,%eax
+     d1c:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+     d1f:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+     d21:	c1 e0 0c             	shl    $0xc,%eax
+     d24:	01 f0                	add    %esi,%eax
+     d26:	50                   	push   %eax
+     d27:	e8 7f f8 ff ff       	call   5ab <sbrk>
+     d2c:	83 c4 10             	add    $0x10,%esp
+     d2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d32:	74 2c                	je     d60 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+     d34:	01 f0                	add    %esi,%eax
+     d36:	e9 79 ff ff ff       	jmp    cb4 <getpages+0x34>
+     d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+        runs = rest;
+     d40:	89 0d c0 1d 00 00    	mov    %ecx,0x1dc0
+     d46:	eb 96                	jmp    cde <getpages+0x5e>
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+    *l = s->next;
+     d50:	89 15 c0 1d 00 00    	mov    %edx,0x1dc0
+     d56:	e9 4f ff ff ff       	jmp    caa <getpages+0x2a>
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+    return 0;
+     d60:	31 c0                	xor    %eax,%eax
+     d62:	e9 50 ff ff ff       	jmp    cb7 <getpages+0x37>
+     d67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6e:	66 90                	xchg   %ax,%ax
+
+00000d70 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	57                   	push   %edi
+     d74:	56                   	push   %esi
+     d75:	53                   	push   %ebx
+     d76:	83 ec 1c             	sub    $0x1c,%esp
+     d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+     d7c:	85 c0                	test   %eax,%eax
+     d7e:	0f 84 97 00 00 00    	je     e1b <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+     d84:	89 c3                	mov    %eax,%ebx
+     d86:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+     d8c:	8b 73 14             	mov    0x14(%ebx),%esi
+     d8f:	83 fe 01             	cmp    $0x1,%esi
+     d92:	74 74                	je     e08 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+     d94:	85 f6                	test   %esi,%esi
+     d96:	74 5d                	je     df5 <free+0x85>
+  if(s->free == 0)
+     d98:	8b 53 08             	mov    0x8(%ebx),%edx
+     d9b:	85 d2                	test   %edx,%edx
+     d9d:	0f 84 85 00 00 00    	je     e28 <free+0xb8>
+  NEXTFREE(o) = s->free;
+     da3:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+     da5:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+     da8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     dab:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+     dae:	8b 04 f5 e4 1d 00 00 	mov    0x1de4(,%esi,8),%eax
+  s->inuse--;
+     db5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+     db8:	83 c0 01             	add    $0x1,%eax
+     dbb:	89 04 f5 e4 1d 00 00 	mov    %eax,0x1de4(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     dc2:	85 d2                	test   %edx,%edx
+     dc4:	75 55                	jne    e1b <free+0xab>
+     dc6:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+     dcb:	89 f1                	mov    %esi,%ecx
+     dcd:	d3 ea                	shr    %cl,%edx
+     dcf:	39 c2                	cmp    %eax,%edx
+     dd1:	73 7d                	jae    e50 <free+0xe0>
+  if(s->prev)
+     dd3:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+     dd6:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+     dd8:	85 ff                	test   %edi,%edi
+     dda:	0f 84 a0 00 00 00    	je     e80 <free+0x110>
+    s->prev->next = s->next;
+     de0:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+     de2:	85 c9                	test   %ecx,%ecx
+     de4:	74 06                	je     dec <free+0x7c>
+    s->next->prev = s->prev;
+     de6:	8b 7b 04             	mov    0x4(%ebx),%edi
+     de9:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+     dec:	29 d0                	sub    %edx,%eax
+     dee:	89 04 f5 e4 1d 00 00 	mov    %eax,0x1de4(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+     df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+     df8:	89 d8                	mov    %ebx,%eax
+}
+     dfa:	5b                   	pop    %ebx
+     dfb:	5e                   	pop    %esi
+     dfc:	5f                   	pop    %edi
+     dfd:	5d                   	pop    %ebp
+    freepages(s);
+     dfe:	e9 fd fc ff ff       	jmp    b00 <freepages>
+     e03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e07:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+     e08:	8b 43 10             	mov    0x10(%ebx),%eax
+     e0b:	83 ec 08             	sub    $0x8,%esp
+     e0e:	c1 e0 0c             	shl    $0xc,%eax
+     e11:	50                   	push   %eax
+     e12:	53                   	push   %ebx
+     e13:	e8 6b f8 ff ff       	call   683 <munmap>
+     e18:	83 c4 10             	add    $0x10,%esp
+}
+     e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e1e:	5b                   	pop    %ebx
+     e1f:	5e                   	pop    %esi
+     e20:	5f                   	pop    %edi
+     e21:	5d                   	pop    %ebp
+     e22:	c3                   	ret
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+  s->next = *l;
+     e28:	8b 14 f5 e0 1d 00 00 	mov    0x1de0(,%esi,8),%edx
+  s->prev = 0;
+     e2f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+     e36:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+     e38:	85 d2                	test   %edx,%edx
+     e3a:	74 06                	je     e42 <free+0xd2>
+    (*l)->prev = s;
+     e3c:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+     e3f:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+     e42:	89 1c f5 e0 1d 00 00 	mov    %ebx,0x1de0(,%esi,8)
+}
+     e49:	e9 55 ff ff ff       	jmp    da3 <free+0x33>
+     e4e:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+     e50:	83 ec 0c             	sub    $0xc,%esp
+     e53:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e56:	8b 7b 10             	mov    0x10(%ebx),%edi
+     e59:	6a 00                	push   $0x0
+     e5b:	c1 e7 0c             	shl    $0xc,%edi
+     e5e:	01 df                	add    %ebx,%edi
+     e60:	e8 46 f7 ff ff       	call   5ab <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+     e65:	83 c4 10             	add    $0x10,%esp
+     e68:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     e6b:	39 c7                	cmp    %eax,%edi
+     e6d:	75 ac                	jne    e1b <free+0xab>
+     e6f:	8b 04 f5 e4 1d 00 00 	mov    0x1de4(,%esi,8),%eax
+     e76:	e9 58 ff ff ff       	jmp    dd3 <free+0x63>
+     e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+    *l = s->next;
+     e80:	89 0c f5 e0 1d 00 00 	mov    %ecx,0x1de0(,%esi,8)
+     e87:	e9 56 ff ff ff       	jmp    de2 <free+0x72>
+     e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e90 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     e90:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     e91:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+     e96:	89 e5                	mov    %esp,%ebp
+     e98:	57                   	push   %edi
+     e99:	56                   	push   %esi
+     e9a:	53                   	push   %ebx
+     e9b:	83 ec 1c             	sub    $0x1c,%esp
+     e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+     ea1:	83 f8 10             	cmp    $0x10,%eax
+     ea4:	0f 86 92 00 00 00    	jbe    f3c <malloc+0xac>
+     eaa:	ba 01 00 00 00       	mov    $0x1,%edx
+     eaf:	eb 13                	jmp    ec4 <malloc+0x34>
+     eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eb8:	89 d3                	mov    %edx,%ebx
+     eba:	d3 e3                	shl    %cl,%ebx
+     ebc:	39 c3                	cmp    %eax,%ebx
+     ebe:	0f 83 84 00 00 00    	jae    f48 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+     ec4:	83 c1 01             	add    $0x1,%ecx
+     ec7:	83 f9 0b             	cmp    $0xb,%ecx
+     eca:	75 ec                	jne    eb8 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+     ecc:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+     ed1:	0f 87 c9 00 00 00    	ja     fa0 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+     ed7:	05 17 10 00 00       	add    $0x1017,%eax
+     edc:	89 c3                	mov    %eax,%ebx
+     ede:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+     ee1:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+     ee6:	77 28                	ja     f10 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+     ee8:	89 d8                	mov    %ebx,%eax
+     eea:	e8 91 fd ff ff       	call   c80 <getpages>
+     eef:	85 c0                	test   %eax,%eax
+     ef1:	0f 84 a9 00 00 00    	je     fa0 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+     ef7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+     efe:	83 c0 18             	add    $0x18,%eax
+}
+     f01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f04:	5b                   	pop    %ebx
+     f05:	5e                   	pop    %esi
+     f06:	5f                   	pop    %edi
+     f07:	5d                   	pop    %ebp
+     f08:	c3                   	ret
+     f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+     f10:	89 d8                	mov    %ebx,%eax
+     f12:	83 ec 08             	sub    $0x8,%esp
+     f15:	c1 e0 0c             	shl    $0xc,%eax
+     f18:	6a 00                	push   $0x0
+     f1a:	6a ff                	push   $0xffffffff
+     f1c:	6a 22                	push   $0x22
+     f1e:	6a 03                	push   $0x3
+     f20:	50                   	push   %eax
+     f21:	6a 00                	push   $0x0
+     f23:	e8 53 f7 ff ff       	call   67b <mmap>
+    if(s == MAP_FAILED)
+     f28:	83 c4 20             	add    $0x20,%esp
+     f2b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f2e:	74 b8                	je     ee8 <malloc+0x58>
+      s->shift = MAPRUN;
+     f30:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+     f37:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+     f3a:	eb c2                	jmp    efe <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+     f3c:	bb 10 00 00 00       	mov    $0x10,%ebx
+     f41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+     f48:	8b 34 cd e0 1d 00 00 	mov    0x1de0(,%ecx,8),%esi
+     f4f:	85 f6                	test   %esi,%esi
+     f51:	74 57                	je     faa <malloc+0x11a>
+  classes[shift].nfree--;
+     f53:	8b 1c cd e4 1d 00 00 	mov    0x1de4(,%ecx,8),%ebx
+  o = s->free;
+     f5a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+     f5d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     f60:	89 14 cd e4 1d 00 00 	mov    %edx,0x1de4(,%ecx,8)
+  s->free = NEXTFREE(o);
+     f67:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+     f69:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+     f6d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+     f70:	85 ff                	test   %edi,%edi
+     f72:	75 8d                	jne    f01 <malloc+0x71>
+  if(s->prev)
+     f74:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+     f77:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+     f79:	85 db                	test   %ebx,%ebx
+     f7b:	0f 84 b7 00 00 00    	je     1038 <malloc+0x1a8>
+    s->prev->next = s->next;
+     f81:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+     f83:	85 d2                	test   %edx,%edx
+     f85:	0f 84 76 ff ff ff    	je     f01 <malloc+0x71>
+    s->next->prev = s->prev;
+     f8b:	8b 4e 04             	mov    0x4(%esi),%ecx
+     f8e:	89 4a 04             	mov    %ecx,0x4(%edx)
+     f91:	e9 6b ff ff ff       	jmp    f01 <malloc+0x71>
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+     fa3:	31 c0                	xor    %eax,%eax
+}
+     fa5:	5b                   	pop    %ebx
+     fa6:	5e                   	pop    %esi
+     fa7:	5f                   	pop    %edi
+     fa8:	5d                   	pop    %ebp
+     fa9:	c3                   	ret
+    if((s = getpages(1)) == 0)
+     faa:	b8 01 00 00 00       	mov    $0x1,%eax
+     faf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     fb2:	e8 c9 fc ff ff       	call   c80 <getpages>
+     fb7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     fba:	85 c0                	test   %eax,%eax
+     fbc:	89 c2                	mov    %eax,%edx
+     fbe:	74 e0                	je     fa0 <malloc+0x110>
+    s->shift = shift;
+     fc0:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fc3:	f7 db                	neg    %ebx
+    s->inuse = 0;
+     fc5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+     fcc:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fd1:	89 df                	mov    %ebx,%edi
+     fd3:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+     fd5:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+     fd7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     fda:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     fdd:	83 e8 01             	sub    $0x1,%eax
+     fe0:	d3 e0                	shl    %cl,%eax
+     fe2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+     fe5:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     fe9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     fec:	eb 04                	jmp    ff2 <malloc+0x162>
+     fee:	66 90                	xchg   %ax,%ax
+     ff0:	89 c8                	mov    %ecx,%eax
+     ff2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+     ff5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+     ff7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+     ffa:	89 c6                	mov    %eax,%esi
+     ffc:	39 da                	cmp    %ebx,%edx
+     ffe:	7f f0                	jg     ff0 <malloc+0x160>
+    1000:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    1003:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1006:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    1009:	8b 04 cd e0 1d 00 00 	mov    0x1de0(,%ecx,8),%eax
+  s->prev = 0;
+    1010:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    1017:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    1019:	85 c0                	test   %eax,%eax
+    101b:	74 03                	je     1020 <malloc+0x190>
+    (*l)->prev = s;
+    101d:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    1020:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    1023:	89 14 cd e0 1d 00 00 	mov    %edx,0x1de0(,%ecx,8)
+    classes[shift].nfree += n;
+    102a:	89 d6                	mov    %edx,%esi
+    102c:	03 1c cd e4 1d 00 00 	add    0x1de4(,%ecx,8),%ebx
+    1033:	e9 22 ff ff ff       	jmp    f5a <malloc+0xca>
+    *l = s->next;
+    1038:	89 14 cd e0 1d 00 00 	mov    %edx,0x1de0(,%ecx,8)
+    103f:	e9 3f ff ff ff       	jmp    f83 <malloc+0xf3>
@@ -0,0 +1,2776 @@
+
+_zhi:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define COMMAND_GANG "gang"
+#define COMMAND_SEM "sem"
+#define COMMAND_VM "vm"
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+    printf(1, "----------------------------------\nCurrent pid = %d\n", getpid());
+      19:	e8 35 0a 00 00       	call   a53 <getpid>
+      1e:	83 ec 04             	sub    $0x4,%esp
+      21:	50                   	push   %eax
+      22:	68 f4 14 00 00       	push   $0x14f4
+      27:	6a 01                	push   $0x1
+      29:	e8 22 0d 00 00       	call   d50 <printf>
+    if(argc < 2){
+      2e:	83 c4 10             	add    $0x10,%esp
+      31:	83 fe 01             	cmp    $0x1,%esi
+      34:	0f 8e 2e 01 00 00    	jle    168 <main+0x168>
+        printf(1, "Error: Too few args \nuse {count 123}/{parent}/{children 2}/{path /:bin: cmd}\n");
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_COUNT)  == 0 && argc == 3)
+      3a:	51                   	push   %ecx
+      3b:	51                   	push   %ecx
+      3c:	68 aa 16 00 00       	push   $0x16aa
+      41:	ff 73 04             	push   0x4(%ebx)
+      44:	e8 d7 06 00 00       	call   720 <strcmp>
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	83 fe 03             	cmp    $0x3,%esi
+      4f:	0f 94 c2             	sete   %dl
+      52:	89 d7                	mov    %edx,%edi
+      54:	85 c0                	test   %eax,%eax
+      56:	75 08                	jne    60 <main+0x60>
+      58:	84 d2                	test   %dl,%dl
+      5a:	0f 85 e7 01 00 00    	jne    247 <main+0x247>
+        count_num_of_digits();
+        asm("movl %0, %%ebx" : : "r"(saved_ebx) );
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_PARENT)  == 0 && argc == 2)
+      60:	50                   	push   %eax
+      61:	50                   	push   %eax
+      62:	68 b0 16 00 00       	push   $0x16b0
+      67:	ff 73 04             	push   0x4(%ebx)
+      6a:	e8 b1 06 00 00       	call   720 <strcmp>
+      6f:	83 c4 10             	add    $0x10,%esp
+      72:	85 c0                	test   %eax,%eax
+      74:	0f 85 01 01 00 00    	jne    17b <main+0x17b>
+      7a:	83 fe 02             	cmp    $0x2,%esi
+      7d:	0f 84 93 02 00 00    	je     316 <main+0x316>
+    {
+        printf(1, "parent id: %d \n", get_parent_id());
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_PATH)  == 0 && argc >= 3)
+      83:	52                   	push   %edx
+      84:	52                   	push   %edx
+      85:	68 c7 16 00 00       	push   $0x16c7
+      8a:	ff 73 04             	push   0x4(%ebx)
+      8d:	e8 8e 06 00 00       	call   720 <strcmp>
+      92:	83 c4 10             	add    $0x10,%esp
+      95:	85 c0                	test   %eax,%eax
+      97:	75 43                	jne    dc <main+0xdc>
+    {
+        // The path is per process: run a command with it.
+        if (set_path(argv[2]) < 0)
+      99:	83 ec 0c             	sub    $0xc,%esp
+      9c:	ff 73 08             	push   0x8(%ebx)
+      9f:	e8 e7 09 00 00       	call   a8b <set_path>
+      a4:	83 c4 10             	add    $0x10,%esp
+      a7:	85 c0                	test   %eax,%eax
+      a9:	0f 88 0e 03 00 00    	js     3bd <main+0x3bd>
+            printf(1, "path too long\n");
+        else if (argc > 3)
+      af:	83 fe 03             	cmp    $0x3,%esi
+      b2:	74 23                	je     d7 <main+0xd7>
+        {
+            exec(argv[3], argv + 3);
+      b4:	50                   	push   %eax
+      b5:	50                   	push   %eax
+      b6:	8d 43 0c             	lea    0xc(%ebx),%eax
+      b9:	50                   	push   %eax
+      ba:	ff 73 0c             	push   0xc(%ebx)
+      bd:	e8 be 05 00 00       	call   680 <exec>
+            printf(1, "exec %s failed\n", argv[3]);
+      c2:	83 c4 0c             	add    $0xc,%esp
+      c5:	ff 73 0c             	push   0xc(%ebx)
+      c8:	68 db 16 00 00       	push   $0x16db
+      cd:	6a 01                	push   $0x1
+      cf:	e8 7c 0c 00 00       	call   d50 <printf>
+      d4:	83 c4 10             	add    $0x10,%esp
+        // if(p1!=0 && p2!=0)
+        printf(1, "children of %d are: %d \n", number, get_children(number));
+        wait();
+        wait();
+        wait();
+        exit();
+      d7:	e8 84 05 00 00       	call   660 <exit>
+    if (strcmp(argv[1], COMMAND_CHILDREN)  == 0 && argc == 3){
+      dc:	50                   	push   %eax
+      dd:	50                   	push   %eax
+      de:	68 eb 16 00 00       	push   $0x16eb
+      e3:	ff 73 04             	push   0x4(%ebx)
+      e6:	e8 35 06 00 00       	call   720 <strcmp>
+      eb:	83 c4 10             	add    $0x10,%esp
+      ee:	85 c0                	test   %eax,%eax
+      f0:	0f 85 7a 01 00 00    	jne    270 <main+0x270>
+      f6:	83 fe 03             	cmp    $0x3,%esi
+      f9:	0f 85 b1 00 00 00    	jne    1b0 <main+0x1b0>
+        int number = atoi(argv[2]);
+      ff:	83 ec 0c             	sub    $0xc,%esp
+     102:	ff 73 08             	push   0x8(%ebx)
+     105:	e8 56 08 00 00       	call   960 <atoi>
+     10a:	89 c3                	mov    %eax,%ebx
+        p1=fork();
+     10c:	e8 1f 05 00 00       	call   630 <fork>
+        if(p1==0){
+     111:	83 c4 10             	add    $0x10,%esp
+        p1=fork();
+     114:	89 c6                	mov    %eax,%esi
+        if(p1==0){
+     116:	85 c0                	test   %eax,%eax
+     118:	0f 85 5f 03 00 00    	jne    47d <main+0x47d>
+            int p3 = fork();
+     11e:	e8 0d 05 00 00       	call   630 <fork>
+     123:	89 c6                	mov    %eax,%esi
+            if(p3!=0)
+     125:	85 c0                	test   %eax,%eax
+     127:	0f 85 e6 03 00 00    	jne    513 <main+0x513>
+            sleep(2);
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	6a 02                	push   $0x2
+     132:	e8 2c 09 00 00       	call   a63 <sleep>
+     137:	83 c4 10             	add    $0x10,%esp
+        printf(1, "children of %d are: %d \n", number, get_children(number));
+     13a:	83 ec 0c             	sub    $0xc,%esp
+     13d:	53                   	push   %ebx
+     13e:	e8 40 09 00 00       	call   a83 <get_children>
+     143:	50                   	push   %eax
+     144:	53                   	push   %ebx
+     145:	68 09 17 00 00       	push   $0x1709
+     14a:	6a 01                	push   $0x1
+     14c:	e8 ff 0b 00 00       	call   d50 <printf>
+        wait();
+     151:	83 c4 20             	add    $0x20,%esp
+     154:	e8 82 08 00 00       	call   9db <wait>
+        wait();
+     159:	e8 7d 08 00 00       	call   9db <wait>
+        wait();
+     15e:	e8 78 08 00 00       	call   9db <wait>
+     163:	e9 6f ff ff ff       	jmp    d7 <main+0xd7>
+        printf(1, "Error: Too few args \nuse {count 123}/{parent}/{children 2}/{path /:bin: cmd}\n");
+     168:	53                   	push   %ebx
+     169:	53                   	push   %ebx
+     16a:	68 2c 15 00 00       	push   $0x152c
+     16f:	6a 01                	push   $0x1
+     171:	e8 da 0b 00 00       	call   d50 <printf>
+        exit();
+     176:	e8 e5 04 00 00       	call   660 <exit>
+    if (strcmp(argv[1], COMMAND_PATH)  == 0 && argc >= 3)
+     17b:	50                   	push   %eax
+     17c:	50                   	push   %eax
+     17d:	68 c7 16 00 00       	push   $0x16c7
+     182:	ff 73 04             	push   0x4(%ebx)
+     185:	e8 96 05 00 00       	call   720 <strcmp>
+     18a:	83 c4 10             	add    $0x10,%esp
+     18d:	85 c0                	test   %eax,%eax
+     18f:	0f 85 47 ff ff ff    	jne    dc <main+0xdc>
+     195:	83 fe 02             	cmp    $0x2,%esi
+     198:	0f 85 fb fe ff ff    	jne    99 <main+0x99>
+    if (strcmp(argv[1], COMMAND_CHILDREN)  == 0 && argc == 3){
+     19e:	50                   	push   %eax
+     19f:	50                   	push   %eax
+     1a0:	68 eb 16 00 00       	push   $0x16eb
+     1a5:	ff 73 04             	push   0x4(%ebx)
+     1a8:	e8 73 05 00 00       	call   720 <strcmp>
+     1ad:	83 c4 10             	add    $0x10,%esp
+    }
+
+    if (strcmp(argv[1], COMMAND_SLEEP)  == 0 && argc == 3)
+     1b0:	50                   	push   %eax
+     1b1:	50                   	push   %eax
+     1b2:	68 22 17 00 00       	push   $0x1722
+     1b7:	ff 73 04             	push   0x4(%ebx)
+     1ba:	e8 61 05 00 00       	call   720 <strcmp>
+     1bf:	83 c4 10             	add    $0x10,%esp
+        int t2 = get_time();
+        printf(1, "user: sleep real duration: %d\n", t2-t1);
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_BARRIER)  == 0)
+     1c2:	57                   	push   %edi
+     1c3:	57                   	push   %edi
+     1c4:	68 43 17 00 00       	push   $0x1743
+     1c9:	ff 73 04             	push   0x4(%ebx)
+     1cc:	e8 4f 05 00 00       	call   720 <strcmp>
+     1d1:	83 c4 10             	add    $0x10,%esp
+     1d4:	85 c0                	test   %eax,%eax
+     1d6:	0f 85 fe 00 00 00    	jne    2da <main+0x2da>
+    {
+        printf(1, "user: starting barrier ... \n");
+     1dc:	56                   	push   %esi
+     1dd:	56                   	push   %esi
+     1de:	68 4b 17 00 00       	push   $0x174b
+     1e3:	6a 01                	push   $0x1
+     1e5:	e8 66 0b 00 00       	call   d50 <printf>
+        barrier_init(4);
+     1ea:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     1f1:	e8 cd 08 00 00       	call   ac3 <barrier_init>
+        if(fork() != 0){
+     1f6:	e8 35 04 00 00       	call   630 <fork>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	85 c0                	test   %eax,%eax
+     200:	0f 85 b3 02 00 00    	jne    4b9 <main+0x4b9>
+            sleep(100);
+        }
+        fork();
+     206:	e8 25 04 00 00       	call   630 <fork>
+        printf(1, "user: before barrier pid: %d\n", getpid());
+     20b:	e8 43 08 00 00       	call   a53 <getpid>
+     210:	53                   	push   %ebx
+     211:	50                   	push   %eax
+     212:	68 68 17 00 00       	push   $0x1768
+     217:	6a 01                	push   $0x1
+     219:	e8 32 0b 00 00       	call   d50 <printf>
+        barrier_wait();
+     21e:	e8 a8 08 00 00       	call   acb <barrier_wait>
+        printf(1, "user: after barrier pid: %d\n", getpid());
+     223:	e8 2b 08 00 00       	call   a53 <getpid>
+     228:	83 c4 0c             	add    $0xc,%esp
+     22b:	50                   	push   %eax
+     22c:	68 86 17 00 00       	push   $0x1786
+     231:	6a 01                	push   $0x1
+     233:	e8 18 0b 00 00       	call   d50 <printf>
+        wait();
+     238:	e8 9e 07 00 00       	call   9db <wait>
+        wait();
+     23d:	e8 99 07 00 00       	call   9db <wait>
+        exit();
+     242:	e8 19 04 00 00       	call   660 <exit>
+        int saved_ebx, number = atoi(argv[2]);
+     247:	83 ec 0c             	sub    $0xc,%esp
+     24a:	ff 73 08             	push   0x8(%ebx)
+     24d:	e8 0e 07 00 00       	call   960 <atoi>
+        asm volatile(
+     252:	89 db                	mov    %ebx,%ebx
+     254:	89 c3                	mov    %eax,%ebx
+        printf(1, "count_num_of_digits() from user: \n");
+     256:	58                   	pop    %eax
+     257:	5a                   	pop    %edx
+     258:	68 7c 15 00 00       	push   $0x157c
+     25d:	6a 01                	push   $0x1
+     25f:	e8 ec 0a 00 00       	call   d50 <printf>
+        count_num_of_digits();
+     264:	e8 0a 08 00 00       	call   a73 <count_num_of_digits>
+        asm("movl %0, %%ebx" : : "r"(saved_ebx) );
+     269:	89 db                	mov    %ebx,%ebx
+        exit();
+     26b:	e8 f0 03 00 00       	call   660 <exit>
+    if (strcmp(argv[1], COMMAND_SLEEP)  == 0 && argc == 3)
+     270:	51                   	push   %ecx
+     271:	51                   	push   %ecx
+     272:	68 22 17 00 00       	push   $0x1722
+     277:	ff 73 04             	push   0x4(%ebx)
+     27a:	e8 a1 04 00 00       	call   720 <strcmp>
+     27f:	83 c4 10             	add    $0x10,%esp
+     282:	85 c0                	test   %eax,%eax
+     284:	0f 85 38 ff ff ff    	jne    1c2 <main+0x1c2>
+     28a:	89 f8                	mov    %edi,%eax
+     28c:	84 c0                	test   %al,%al
+     28e:	0f 84 2e ff ff ff    	je     1c2 <main+0x1c2>
+        int sleep_seconds = atoi(argv[2]);
+     294:	83 ec 0c             	sub    $0xc,%esp
+     297:	ff 73 08             	push   0x8(%ebx)
+     29a:	e8 c1 06 00 00       	call   960 <atoi>
+     29f:	89 c6                	mov    %eax,%esi
+        printf(1, "user: starting sleep ... \n");
+     2a1:	58                   	pop    %eax
+     2a2:	5a                   	pop    %edx
+     2a3:	68 28 17 00 00       	push   $0x1728
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 a1 0a 00 00       	call   d50 <printf>
+        int t1 = get_time();
+     2af:	e8 e7 07 00 00       	call   a9b <get_time>
+        set_sleep(sleep_seconds);
+     2b4:	89 34 24             	mov    %esi,(%esp)
+        int t1 = get_time();
+     2b7:	89 c3                	mov    %eax,%ebx
+        set_sleep(sleep_seconds);
+     2b9:	e8 d5 07 00 00       	call   a93 <set_sleep>
+        int t2 = get_time();
+     2be:	e8 d8 07 00 00       	call   a9b <get_time>
+        printf(1, "user: sleep real duration: %d\n", t2-t1);
+     2c3:	83 c4 0c             	add    $0xc,%esp
+     2c6:	29 d8                	sub    %ebx,%eax
+     2c8:	50                   	push   %eax
+     2c9:	68 a0 15 00 00       	push   $0x15a0
+     2ce:	6a 01                	push   $0x1
+     2d0:	e8 7b 0a 00 00       	call   d50 <printf>
+        exit();
+     2d5:	e8 86 03 00 00       	call   660 <exit>
+    }
+
+    if (strcmp(argv[1], COMMAND_REENTRANT)  == 0)
+     2da:	51                   	push   %ecx
+     2db:	51                   	push   %ecx
+     2dc:	68 a3 17 00 00       	push   $0x17a3
+     2e1:	ff 73 04             	push   0x4(%ebx)
+     2e4:	e8 37 04 00 00       	call   720 <strcmp>
+     2e9:	83 c4 10             	add    $0x10,%esp
+     2ec:	85 c0                	test   %eax,%eax
+     2ee:	75 3e                	jne    32e <main+0x32e>
+    {
+        printf(1, "user: starting reentrant spinlock test ... \n");
+     2f0:	50                   	push   %eax
+     2f1:	50                   	push   %eax
+     2f2:	68 c0 15 00 00       	push   $0x15c0
+     2f7:	6a 01                	push   $0x1
+     2f9:	e8 52 0a 00 00       	call   d50 <printf>
+        reentrant_spinlock_test();
+     2fe:	e8 d0 07 00 00       	call   ad3 <reentrant_spinlock_test>
+        printf(1, "user: test completed ... \n");
+     303:	58                   	pop    %eax
+     304:	5a                   	pop    %edx
+     305:	68 ad 17 00 00       	push   $0x17ad
+     30a:	6a 01                	push   $0x1
+     30c:	e8 3f 0a 00 00       	call   d50 <printf>
+        exit();
+     311:	e8 4a 03 00 00       	call   660 <exit>
+        printf(1, "parent id: %d \n", get_parent_id());
+     316:	e8 60 07 00 00       	call   a7b <get_parent_id>
+     31b:	51                   	push   %ecx
+     31c:	50                   	push   %eax
+     31d:	68 b7 16 00 00       	push   $0x16b7
+     322:	6a 01                	push   $0x1
+     324:	e8 27 0a 00 00       	call   d50 <printf>
+        exit();
+     329:	e8 32 03 00 00       	call   660 <exit>
+    }
+
+    if (strcmp(argv[1], COMMAND_GANG)  == 0)
+     32e:	50                   	push   %eax
+     32f:	50                   	push   %eax
+     330:	68 c8 17 00 00       	push   $0x17c8
+     335:	ff 73 04             	push   0x4(%ebx)
+     338:	e8 e3 03 00 00       	call   720 <strcmp>
+     33d:	83 c4 10             	add    $0x10,%esp
+     340:	85 c0                	test   %eax,%eax
+     342:	0f 84 8b 00 00 00    	je     3d3 <main+0x3d3>
+        if(getpid() == leader)
+            set_gang_scheduling(0);
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_SEM)  == 0)
+     348:	57                   	push   %edi
+     349:	57                   	push   %edi
+     34a:	68 cd 17 00 00       	push   $0x17cd
+     34f:	ff 73 04             	push   0x4(%ebx)
+     352:	e8 c9 03 00 00       	call   720 <strcmp>
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	89 c7                	mov    %eax,%edi
+     35c:	85 c0                	test   %eax,%eax
+     35e:	0f 85 8b 01 00 00    	jne    4ef <main+0x4ef>
+    {
+        // Producer/consumer handing off items through two semaphores;
+        // an event tells the consumer when the producer is done.
+        int items = argc == 3 ? atoi(argv[2]) : 5;
+     364:	c7 45 e4 05 00 00 00 	movl   $0x5,-0x1c(%ebp)
+     36b:	83 fe 03             	cmp    $0x3,%esi
+     36e:	0f 84 93 02 00 00    	je     607 <main+0x607>
+        int full = sem_create(0), empty = sem_create(1), done = event_create();
+     374:	83 ec 0c             	sub    $0xc,%esp
+     377:	6a 00                	push   $0x0
+     379:	e8 75 07 00 00       	call   af3 <sem_create>
+     37e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     385:	89 c6                	mov    %eax,%esi
+     387:	e8 67 07 00 00       	call   af3 <sem_create>
+     38c:	89 c3                	mov    %eax,%ebx
+     38e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     391:	e8 65 07 00 00       	call   afb <event_create>
+        if(full < 0 || empty < 0 || done < 0){
+     396:	09 f3                	or     %esi,%ebx
+     398:	83 c4 10             	add    $0x10,%esp
+        int full = sem_create(0), empty = sem_create(1), done = event_create();
+     39b:	89 c2                	mov    %eax,%edx
+     39d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+        if(full < 0 || empty < 0 || done < 0){
+     3a0:	89 d8                	mov    %ebx,%eax
+     3a2:	09 d0                	or     %edx,%eax
+     3a4:	0f 89 84 01 00 00    	jns    52e <main+0x52e>
+            printf(1, "user: cannot create semaphores\n");
+     3aa:	53                   	push   %ebx
+     3ab:	53                   	push   %ebx
+     3ac:	68 1c 16 00 00       	push   $0x161c
+     3b1:	6a 01                	push   $0x1
+     3b3:	e8 98 09 00 00       	call   d50 <printf>
+            exit();
+     3b8:	e8 a3 02 00 00       	call   660 <exit>
+            printf(1, "path too long\n");
+     3bd:	50                   	push   %eax
+     3be:	50                   	push   %eax
+     3bf:	68 cc 16 00 00       	push   $0x16cc
+     3c4:	6a 01                	push   $0x1
+     3c6:	e8 85 09 00 00       	call   d50 <printf>
+     3cb:	83 c4 10             	add    $0x10,%esp
+     3ce:	e9 04 fd ff ff       	jmp    d7 <main+0xd7>
+        int leader = getpid();
+     3d3:	e8 7b 06 00 00       	call   a53 <getpid>
+        printf(1, "user: starting gang-scheduled barrier ... \n");
+     3d8:	51                   	push   %ecx
+        int leader = getpid();
+     3d9:	89 c3                	mov    %eax,%ebx
+        printf(1, "user: starting gang-scheduled barrier ... \n");
+     3db:	51                   	push   %ecx
+     3dc:	68 f0 15 00 00       	push   $0x15f0
+     3e1:	6a 01                	push   $0x1
+     3e3:	e8 68 09 00 00       	call   d50 <printf>
+        set_gang_scheduling(1);
+     3e8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     3ef:	e8 f7 06 00 00       	call   aeb <set_gang_scheduling>
+        set_process_gang(getpid(), 1);  // inherited by the children
+     3f4:	e8 5a 06 00 00       	call   a53 <getpid>
+     3f9:	5e                   	pop    %esi
+     3fa:	5f                   	pop    %edi
+     3fb:	6a 01                	push   $0x1
+     3fd:	50                   	push   %eax
+     3fe:	e8 e0 06 00 00       	call   ae3 <set_process_gang>
+        barrier_init(4);
+     403:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+     40a:	e8 b4 06 00 00       	call   ac3 <barrier_init>
+        if(fork() != 0){
+     40f:	e8 1c 02 00 00       	call   630 <fork>
+     414:	83 c4 10             	add    $0x10,%esp
+     417:	85 c0                	test   %eax,%eax
+     419:	0f 85 be 00 00 00    	jne    4dd <main+0x4dd>
+        fork();
+     41f:	e8 0c 02 00 00       	call   630 <fork>
+        printf(1, "user: before barrier pid: %d\n", getpid());
+     424:	e8 2a 06 00 00       	call   a53 <getpid>
+     429:	52                   	push   %edx
+     42a:	50                   	push   %eax
+     42b:	68 68 17 00 00       	push   $0x1768
+     430:	6a 01                	push   $0x1
+     432:	e8 19 09 00 00       	call   d50 <printf>
+        barrier_wait();
+     437:	e8 8f 06 00 00       	call   acb <barrier_wait>
+        printf(1, "user: after barrier pid: %d\n", getpid());
+     43c:	e8 12 06 00 00       	call   a53 <getpid>
+     441:	83 c4 0c             	add    $0xc,%esp
+     444:	50                   	push   %eax
+     445:	68 86 17 00 00       	push   $0x1786
+     44a:	6a 01                	push   $0x1
+     44c:	e8 ff 08 00 00       	call   d50 <printf>
+        wait();
+     451:	e8 85 05 00 00       	call   9db <wait>
+        wait();
+     456:	e8 80 05 00 00       	call   9db <wait>
+        if(getpid() == leader)
+     45b:	e8 f3 05 00 00       	call   a53 <getpid>
+     460:	83 c4 10             	add    $0x10,%esp
+     463:	39 d8                	cmp    %ebx,%eax
+     465:	0f 85 6c fc ff ff    	jne    d7 <main+0xd7>
+            set_gang_scheduling(0);
+     46b:	83 ec 0c             	sub    $0xc,%esp
+     46e:	6a 00                	push   $0x0
+     470:	e8 76 06 00 00       	call   aeb <set_gang_scheduling>
+     475:	83 c4 10             	add    $0x10,%esp
+     478:	e9 5a fc ff ff       	jmp    d7 <main+0xd7>
+            printf(1, "new Child of %d: %d\n", getpid(), p1);
+     47d:	e8 d1 05 00 00       	call   a53 <getpid>
+     482:	56                   	push   %esi
+     483:	50                   	push   %eax
+     484:	68 f4 16 00 00       	push   $0x16f4
+     489:	6a 01                	push   $0x1
+     48b:	e8 c0 08 00 00       	call   d50 <printf>
+            p2=fork();
+     490:	e8 9b 01 00 00       	call   630 <fork>
+            if(p2!=0)
+     495:	83 c4 10             	add    $0x10,%esp
+            p2=fork();
+     498:	89 c6                	mov    %eax,%esi
+            if(p2!=0)
+     49a:	85 c0                	test   %eax,%eax
+     49c:	74 2d                	je     4cb <main+0x4cb>
+                printf(1, "new Child of %d: %d\n", getpid(), p2);
+     49e:	e8 b0 05 00 00       	call   a53 <getpid>
+     4a3:	56                   	push   %esi
+     4a4:	50                   	push   %eax
+     4a5:	68 f4 16 00 00       	push   $0x16f4
+     4aa:	6a 01                	push   $0x1
+     4ac:	e8 9f 08 00 00       	call   d50 <printf>
+     4b1:	83 c4 10             	add    $0x10,%esp
+     4b4:	e9 81 fc ff ff       	jmp    13a <main+0x13a>
+            sleep(100);
+     4b9:	83 ec 0c             	sub    $0xc,%esp
+     4bc:	6a 64                	push   $0x64
+     4be:	e8 a0 05 00 00       	call   a63 <sleep>
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	e9 3b fd ff ff       	jmp    206 <main+0x206>
+                sleep(1);
+     4cb:	83 ec 0c             	sub    $0xc,%esp
+     4ce:	6a 01                	push   $0x1
+     4d0:	e8 8e 05 00 00       	call   a63 <sleep>
+     4d5:	83 c4 10             	add    $0x10,%esp
+     4d8:	e9 5d fc ff ff       	jmp    13a <main+0x13a>
+            sleep(100);
+     4dd:	83 ec 0c             	sub    $0xc,%esp
+     4e0:	6a 64                	push   $0x64
+     4e2:	e8 7c 05 00 00       	call   a63 <sleep>
+     4e7:	83 c4 10             	add    $0x10,%esp
+     4ea:	e9 30 ff ff ff       	jmp    41f <main+0x41f>
+        sync_close(empty);
+        sync_close(done);
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_VM)  == 0)
+     4ef:	56                   	push   %esi
+     4f0:	56                   	push   %esi
+     4f1:	68 f7 17 00 00       	push   $0x17f7
+     4f6:	ff 73 04             	push   0x4(%ebx)
+     4f9:	e8 22 02 00 00       	call   720 <strcmp>
+     4fe:	83 c4 10             	add    $0x10,%esp
+     501:	85 c0                	test   %eax,%eax
+     503:	0f 85 de 00 00 00    	jne    5e7 <main+0x5e7>
+    {
+        print_vm_stats();
+     509:	e8 15 06 00 00       	call   b23 <print_vm_stats>
+        exit();
+     50e:	e8 4d 01 00 00       	call   660 <exit>
+                printf(1, "new Child of %d: %d\n", getpid(), p3);
+     513:	e8 3b 05 00 00       	call   a53 <getpid>
+     518:	56                   	push   %esi
+     519:	50                   	push   %eax
+     51a:	68 f4 16 00 00       	push   $0x16f4
+     51f:	6a 01                	push   $0x1
+     521:	e8 2a 08 00 00       	call   d50 <printf>
+     526:	83 c4 10             	add    $0x10,%esp
+     529:	e9 ff fb ff ff       	jmp    12d <main+0x12d>
+        if(fork() == 0){
+     52e:	e8 fd 00 00 00       	call   630 <fork>
+     533:	89 c3                	mov    %eax,%ebx
+     535:	85 c0                	test   %eax,%eax
+     537:	74 2a                	je     563 <main+0x563>
+     539:	eb 76                	jmp    5b1 <main+0x5b1>
+                sync_wait(full);
+     53b:	83 ec 0c             	sub    $0xc,%esp
+     53e:	56                   	push   %esi
+     53f:	e8 c7 05 00 00       	call   b0b <sync_wait>
+                printf(1, "user: consumed %d\n", i);
+     544:	83 c4 0c             	add    $0xc,%esp
+     547:	53                   	push   %ebx
+            for(int i = 0; i < items; i++){
+     548:	83 c3 01             	add    $0x1,%ebx
+                printf(1, "user: consumed %d\n", i);
+     54b:	68 d1 17 00 00       	push   $0x17d1
+     550:	6a 01                	push   $0x1
+     552:	e8 f9 07 00 00       	call   d50 <printf>
+                sync_post(empty);
+     557:	59                   	pop    %ecx
+     558:	ff 75 e0             	push   -0x20(%ebp)
+     55b:	e8 a3 05 00 00       	call   b03 <sync_post>
+            for(int i = 0; i < items; i++){
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     566:	39 c3                	cmp    %eax,%ebx
+     568:	7c d1                	jl     53b <main+0x53b>
+            sync_wait(done);
+     56a:	83 ec 0c             	sub    $0xc,%esp
+     56d:	ff 75 dc             	push   -0x24(%ebp)
+     570:	e8 96 05 00 00       	call   b0b <sync_wait>
+            printf(1, "user: consumer saw producer finish\n");
+     575:	58                   	pop    %eax
+     576:	5a                   	pop    %edx
+     577:	68 3c 16 00 00       	push   $0x163c
+     57c:	6a 01                	push   $0x1
+     57e:	e8 cd 07 00 00       	call   d50 <printf>
+            exit();
+     583:	e8 d8 00 00 00       	call   660 <exit>
+            sync_wait(empty);
+     588:	83 ec 0c             	sub    $0xc,%esp
+     58b:	ff 75 e0             	push   -0x20(%ebp)
+     58e:	e8 78 05 00 00       	call   b0b <sync_wait>
+            printf(1, "user: produced %d\n", i);
+     593:	83 c4 0c             	add    $0xc,%esp
+     596:	57                   	push   %edi
+        for(int i = 0; i < items; i++){
+     597:	83 c7 01             	add    $0x1,%edi
+            printf(1, "user: produced %d\n", i);
+     59a:	68 e4 17 00 00       	push   $0x17e4
+     59f:	6a 01                	push   $0x1
+     5a1:	e8 aa 07 00 00       	call   d50 <printf>
+            sync_post(full);
+     5a6:	89 34 24             	mov    %esi,(%esp)
+     5a9:	e8 55 05 00 00       	call   b03 <sync_post>
+        for(int i = 0; i < items; i++){
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     5b4:	39 c7                	cmp    %eax,%edi
+     5b6:	7c d0                	jl     588 <main+0x588>
+        sync_post(done);
+     5b8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+     5bb:	83 ec 0c             	sub    $0xc,%esp
+     5be:	57                   	push   %edi
+     5bf:	e8 3f 05 00 00       	call   b03 <sync_post>
+        wait();
+     5c4:	e8 12 04 00 00       	call   9db <wait>
+        sync_close(full);
+     5c9:	89 34 24             	mov    %esi,(%esp)
+     5cc:	e8 42 05 00 00       	call   b13 <sync_close>
+        sync_close(empty);
+     5d1:	58                   	pop    %eax
+     5d2:	ff 75 e0             	push   -0x20(%ebp)
+     5d5:	e8 39 05 00 00       	call   b13 <sync_close>
+        sync_close(done);
+     5da:	89 3c 24             	mov    %edi,(%esp)
+     5dd:	e8 31 05 00 00       	call   b13 <sync_close>
+        exit();
+     5e2:	e8 79 00 00 00       	call   660 <exit>
+    }
+
+    if (strcmp(argv[1], COMMAND_LOCKS)  == 0)
+     5e7:	51                   	push   %ecx
+     5e8:	51                   	push   %ecx
+     5e9:	68 fa 17 00 00       	push   $0x17fa
+     5ee:	ff 73 04             	push   0x4(%ebx)
+     5f1:	e8 2a 01 00 00       	call   720 <strcmp>
+     5f6:	83 c4 10             	add    $0x10,%esp
+     5f9:	85 c0                	test   %eax,%eax
+     5fb:	75 20                	jne    61d <main+0x61d>
+    {
+        print_lock_stats();
+     5fd:	e8 d9 04 00 00       	call   adb <print_lock_stats>
+        exit();
+     602:	e8 59 00 00 00       	call   660 <exit>
+        int items = argc == 3 ? atoi(argv[2]) : 5;
+     607:	83 ec 0c             	sub    $0xc,%esp
+     60a:	ff 73 08             	push   0x8(%ebx)
+     60d:	e8 4e 03 00 00       	call   960 <atoi>
+     612:	83 c4 10             	add    $0x10,%esp
+     615:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     618:	e9 57 fd ff ff       	jmp    374 <main+0x374>
+    }
+
+    printf(1, "Error: Bad args \nuse {count 123}/{parent}/{children 2}/{path /:bin: cmd}\n");
+     61d:	52                   	push   %edx
+     61e:	52                   	push   %edx
+     61f:	68 60 16 00 00       	push   $0x1660
+     624:	6a 01                	push   $0x1
+     626:	e8 25 07 00 00       	call   d50 <printf>
+        exit();
+     62b:	e8 30 00 00 00       	call   660 <exit>
+
+00000630 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+     630:	a1 80 1c 00 00       	mov    0x1c80,%eax
+     635:	85 c0                	test   %eax,%eax
+     637:	74 17                	je     650 <fork+0x20>
+{
+     639:	55                   	push   %ebp
+     63a:	89 e5                	mov    %esp,%ebp
+     63c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+     63f:	ff d0                	call   *%eax
+  return _fork();
+}
+     641:	c9                   	leave
+  return _fork();
+     642:	e9 84 03 00 00       	jmp    9cb <_fork>
+     647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64e:	66 90                	xchg   %ax,%ax
+     650:	e9 76 03 00 00       	jmp    9cb <_fork>
+     655:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <exit>:
+
+int
+exit(void)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+     666:	a1 80 1c 00 00       	mov    0x1c80,%eax
+     66b:	85 c0                	test   %eax,%eax
+     66d:	74 02                	je     671 <exit+0x11>
+    stdioflush();
+     66f:	ff d0                	call   *%eax
+  _exit();
+     671:	e8 5d 03 00 00       	call   9d3 <_exit>
+     676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000680 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     680:	55                   	push   %ebp
+  if(stdioflush)
+     681:	a1 80 1c 00 00       	mov    0x1c80,%eax
+{
+     686:	89 e5                	mov    %esp,%ebp
+     688:	56                   	push   %esi
+     689:	53                   	push   %ebx
+     68a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     68d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+     690:	85 c0                	test   %eax,%eax
+     692:	74 02                	je     696 <exec+0x16>
+    stdioflush();
+     694:	ff d0                	call   *%eax
+  return _exec(path, argv);
+     696:	89 75 0c             	mov    %esi,0xc(%ebp)
+     699:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     69c:	5b                   	pop    %ebx
+     69d:	5e                   	pop    %esi
+     69e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+     69f:	e9 67 03 00 00       	jmp    a0b <_exec>
+     6a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+
+000006b0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	57                   	push   %edi
+     6b4:	56                   	push   %esi
+     6b5:	53                   	push   %ebx
+     6b6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+     6b9:	a1 80 1c 00 00       	mov    0x1c80,%eax
+{
+     6be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     6c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+     6c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+     6c7:	85 c0                	test   %eax,%eax
+     6c9:	74 02                	je     6cd <spawn+0x1d>
+    stdioflush();
+     6cb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+     6cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+     6d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     6d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     6d6:	83 c4 0c             	add    $0xc,%esp
+     6d9:	5b                   	pop    %ebx
+     6da:	5e                   	pop    %esi
+     6db:	5f                   	pop    %edi
+     6dc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+     6dd:	e9 79 04 00 00       	jmp    b5b <_spawn>
+     6e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+     6f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     6f1:	31 c0                	xor    %eax,%eax
+{
+     6f3:	89 e5                	mov    %esp,%ebp
+     6f5:	53                   	push   %ebx
+     6f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     700:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     704:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     707:	83 c0 01             	add    $0x1,%eax
+     70a:	84 d2                	test   %dl,%dl
+     70c:	75 f2                	jne    700 <strcpy+0x10>
+    ;
+  return os;
+}
+     70e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     711:	89 c8                	mov    %ecx,%eax
+     713:	c9                   	leave
+     714:	c3                   	ret
+     715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	8b 55 08             	mov    0x8(%ebp),%edx
+     727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     72a:	0f b6 02             	movzbl (%edx),%eax
+     72d:	84 c0                	test   %al,%al
+     72f:	75 17                	jne    748 <strcmp+0x28>
+     731:	eb 3a                	jmp    76d <strcmp+0x4d>
+     733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     737:	90                   	nop
+     738:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     73c:	83 c2 01             	add    $0x1,%edx
+     73f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     742:	84 c0                	test   %al,%al
+     744:	74 1a                	je     760 <strcmp+0x40>
+    p++, q++;
+     746:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     748:	0f b6 19             	movzbl (%ecx),%ebx
+     74b:	38 c3                	cmp    %al,%bl
+     74d:	74 e9                	je     738 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     74f:	29 d8                	sub    %ebx,%eax
+}
+     751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     754:	c9                   	leave
+     755:	c3                   	ret
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     760:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     764:	31 c0                	xor    %eax,%eax
+     766:	29 d8                	sub    %ebx,%eax
+}
+     768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     76b:	c9                   	leave
+     76c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     76d:	0f b6 19             	movzbl (%ecx),%ebx
+     770:	31 c0                	xor    %eax,%eax
+     772:	eb db                	jmp    74f <strcmp+0x2f>
+     774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     786:	80 3a 00             	cmpb   $0x0,(%edx)
+     789:	74 15                	je     7a0 <strlen+0x20>
+     78b:	31 c0                	xor    %eax,%eax
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+     790:	83 c0 01             	add    $0x1,%eax
+     793:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     797:	89 c1                	mov    %eax,%ecx
+     799:	75 f5                	jne    790 <strlen+0x10>
+    ;
+  return n;
+}
+     79b:	89 c8                	mov    %ecx,%eax
+     79d:	5d                   	pop    %ebp
+     79e:	c3                   	ret
+     79f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     7a0:	31 c9                	xor    %ecx,%ecx
+}
+     7a2:	5d                   	pop    %ebp
+     7a3:	89 c8                	mov    %ecx,%eax
+     7a5:	c3                   	ret
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     7b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7bd:	89 d7                	mov    %edx,%edi
+     7bf:	fc                   	cld
+     7c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     7c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7c5:	89 d0                	mov    %edx,%eax
+     7c7:	c9                   	leave
+     7c8:	c3                   	ret
+     7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7da:	0f b6 10             	movzbl (%eax),%edx
+     7dd:	84 d2                	test   %dl,%dl
+     7df:	75 12                	jne    7f3 <strchr+0x23>
+     7e1:	eb 1d                	jmp    800 <strchr+0x30>
+     7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7e7:	90                   	nop
+     7e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7ec:	83 c0 01             	add    $0x1,%eax
+     7ef:	84 d2                	test   %dl,%dl
+     7f1:	74 0d                	je     800 <strchr+0x30>
+    if(*s == c)
+     7f3:	38 d1                	cmp    %dl,%cl
+     7f5:	75 f1                	jne    7e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     7f7:	5d                   	pop    %ebp
+     7f8:	c3                   	ret
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     800:	31 c0                	xor    %eax,%eax
+}
+     802:	5d                   	pop    %ebp
+     803:	c3                   	ret
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+     815:	53                   	push   %ebx
+     816:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+     819:	a1 80 1c 00 00       	mov    0x1c80,%eax
+{
+     81e:	8b 75 08             	mov    0x8(%ebp),%esi
+     821:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+     824:	85 c0                	test   %eax,%eax
+     826:	74 02                	je     82a <gets+0x1a>
+    stdioflush();
+     828:	ff d0                	call   *%eax
+  if(in.size == 0)
+     82a:	a1 a8 1e 00 00       	mov    0x1ea8,%eax
+     82f:	85 c0                	test   %eax,%eax
+     831:	0f 84 99 00 00 00    	je     8d0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     837:	31 db                	xor    %ebx,%ebx
+     839:	eb 21                	jmp    85c <gets+0x4c>
+     83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     83f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+     840:	8d 50 01             	lea    0x1(%eax),%edx
+     843:	0f b6 80 a0 1c 00 00 	movzbl 0x1ca0(%eax),%eax
+     84a:	89 15 a0 1e 00 00    	mov    %edx,0x1ea0
+    buf[i++] = c;
+     850:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     854:	3c 0a                	cmp    $0xa,%al
+     856:	74 60                	je     8b8 <gets+0xa8>
+     858:	3c 0d                	cmp    $0xd,%al
+     85a:	74 5c                	je     8b8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+     85c:	89 da                	mov    %ebx,%edx
+     85e:	83 c3 01             	add    $0x1,%ebx
+     861:	39 fb                	cmp    %edi,%ebx
+     863:	7d 55                	jge    8ba <gets+0xaa>
+    if(in.r == in.n){
+     865:	a1 a0 1e 00 00       	mov    0x1ea0,%eax
+     86a:	3b 05 a4 1e 00 00    	cmp    0x1ea4,%eax
+     870:	75 ce                	jne    840 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     872:	83 ec 04             	sub    $0x4,%esp
+     875:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+     878:	c7 05 a4 1e 00 00 00 	movl   $0x0,0x1ea4
+     87f:	00 00 00 
+     882:	c7 05 a0 1e 00 00 00 	movl   $0x0,0x1ea0
+     889:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+     88c:	ff 35 a8 1e 00 00    	push   0x1ea8
+     892:	68 a0 1c 00 00       	push   $0x1ca0
+     897:	6a 00                	push   $0x0
+     899:	e8 4d 01 00 00       	call   9eb <read>
+     89e:	83 c4 10             	add    $0x10,%esp
+     8a1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     8a4:	85 c0                	test   %eax,%eax
+     8a6:	a3 a4 1e 00 00       	mov    %eax,0x1ea4
+     8ab:	7e 56                	jle    903 <gets+0xf3>
+    c = in.buf[in.r++];
+     8ad:	a1 a0 1e 00 00       	mov    0x1ea0,%eax
+     8b2:	eb 8c                	jmp    840 <gets+0x30>
+     8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+     8b8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+     8ba:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+     8be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8c1:	89 f0                	mov    %esi,%eax
+     8c3:	5b                   	pop    %ebx
+     8c4:	5e                   	pop    %esi
+     8c5:	5f                   	pop    %edi
+     8c6:	5d                   	pop    %ebp
+     8c7:	c3                   	ret
+     8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cf:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+     8d0:	83 ec 08             	sub    $0x8,%esp
+     8d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     8d6:	50                   	push   %eax
+     8d7:	6a 00                	push   $0x0
+     8d9:	e8 4d 01 00 00       	call   a2b <fstat>
+     8de:	83 c4 10             	add    $0x10,%esp
+     8e1:	89 c2                	mov    %eax,%edx
+     8e3:	b8 01 00 00 00       	mov    $0x1,%eax
+     8e8:	85 d2                	test   %edx,%edx
+     8ea:	75 0d                	jne    8f9 <gets+0xe9>
+     8ec:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     8f1:	ba 00 02 00 00       	mov    $0x200,%edx
+     8f6:	0f 44 c2             	cmove  %edx,%eax
+     8f9:	a3 a8 1e 00 00       	mov    %eax,0x1ea8
+     8fe:	e9 34 ff ff ff       	jmp    837 <gets+0x27>
+        in.n = 0;
+     903:	c7 05 a4 1e 00 00 00 	movl   $0x0,0x1ea4
+     90a:	00 00 00 
+        break;
+     90d:	eb ab                	jmp    8ba <gets+0xaa>
+     90f:	90                   	nop
+
+00000910 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	56                   	push   %esi
+     914:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     915:	83 ec 08             	sub    $0x8,%esp
+     918:	6a 00                	push   $0x0
+     91a:	ff 75 08             	push   0x8(%ebp)
+     91d:	e8 f1 00 00 00       	call   a13 <open>
+  if(fd < 0)
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 27                	js     950 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     929:	83 ec 08             	sub    $0x8,%esp
+     92c:	ff 75 0c             	push   0xc(%ebp)
+     92f:	89 c3                	mov    %eax,%ebx
+     931:	50                   	push   %eax
+     932:	e8 f4 00 00 00       	call   a2b <fstat>
+  close(fd);
+     937:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     93a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     93c:	e8 ba 00 00 00       	call   9fb <close>
+  return r;
+     941:	83 c4 10             	add    $0x10,%esp
+}
+     944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     947:	89 f0                	mov    %esi,%eax
+     949:	5b                   	pop    %ebx
+     94a:	5e                   	pop    %esi
+     94b:	5d                   	pop    %ebp
+     94c:	c3                   	ret
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     950:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     955:	eb ed                	jmp    944 <stat+0x34>
+     957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95e:	66 90                	xchg   %ax,%ax
+
+00000960 <atoi>:
+
+int
+atoi(const char *s)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	53                   	push   %ebx
+     964:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     967:	0f be 02             	movsbl (%edx),%eax
+     96a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     96d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     970:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     975:	77 1e                	ja     995 <atoi+0x35>
+     977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     980:	83 c2 01             	add    $0x1,%edx
+     983:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     986:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     98a:	0f be 02             	movsbl (%edx),%eax
+     98d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     990:	80 fb 09             	cmp    $0x9,%bl
+     993:	76 eb                	jbe    980 <atoi+0x20>
+  return n;
+}
+     995:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     998:	89 c8                	mov    %ecx,%eax
+     99a:	c9                   	leave
+     99b:	c3                   	ret
+     99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	57                   	push   %edi
+     9a4:	56                   	push   %esi
+     9a5:	8b 45 10             	mov    0x10(%ebp),%eax
+     9a8:	8b 55 08             	mov    0x8(%ebp),%edx
+     9ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     9ae:	85 c0                	test   %eax,%eax
+     9b0:	7e 13                	jle    9c5 <memmove+0x25>
+     9b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     9b4:	89 d7                	mov    %edx,%edi
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     9c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     9c1:	39 f8                	cmp    %edi,%eax
+     9c3:	75 fb                	jne    9c0 <memmove+0x20>
+  return vdst;
+}
+     9c5:	5e                   	pop    %esi
+     9c6:	89 d0                	mov    %edx,%eax
+     9c8:	5f                   	pop    %edi
+     9c9:	5d                   	pop    %ebp
+     9ca:	c3                   	ret
+
+000009cb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+     9cb:	b8 01 00 00 00       	mov    $0x1,%eax
+     9d0:	cd 40                	int    $0x40
+     9d2:	c3                   	ret
+
+000009d3 <_exit>:
+RAWSYSCALL(exit)
+     9d3:	b8 02 00 00 00       	mov    $0x2,%eax
+     9d8:	cd 40                	int    $0x40
+     9da:	c3                   	ret
+
+000009db <wait>:
+SYSCALL(wait)
+     9db:	b8 03 00 00 00       	mov    $0x3,%eax
+     9e0:	cd 40                	int    $0x40
+     9e2:	c3                   	ret
+
+000009e3 <pipe>:
+SYSCALL(pipe)
+     9e3:	b8 04 00 00 00       	mov    $0x4,%eax
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <read>:
+SYSCALL(read)
+     9eb:	b8 05 00 00 00       	mov    $0x5,%eax
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <write>:
+SYSCALL(write)
+     9f3:	b8 10 00 00 00       	mov    $0x10,%eax
+     9f8:	cd 40                	int    $0x40
+     9fa:	c3                   	ret
+
+000009fb <close>:
+SYSCALL(close)
+     9fb:	b8 15 00 00 00       	mov    $0x15,%eax
+     a00:	cd 40                	int    $0x40
+     a02:	c3                   	ret
+
+00000a03 <kill>:
+SYSCALL(kill)
+     a03:	b8 06 00 00 00       	mov    $0x6,%eax
+     a08:	cd 40                	int    $0x40
+     a0a:	c3                   	ret
+
+00000a0b <_exec>:
+RAWSYSCALL(exec)
+     a0b:	b8 07 00 00 00       	mov    $0x7,%eax
+     a10:	cd 40                	int    $0x40
+     a12:	c3                   	ret
+
+00000a13 <open>:
+SYSCALL(open)
+     a13:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a18:	cd 40                	int    $0x40
+     a1a:	c3                   	ret
+
+00000a1b <mknod>:
+SYSCALL(mknod)
+     a1b:	b8 11 00 00 00       	mov    $0x11,%eax
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <unlink>:
+SYSCALL(unlink)
+     a23:	b8 12 00 00 00       	mov    $0x12,%eax
+     a28:	cd 40                	int    $0x40
+     a2a:	c3                   	ret
+
+00000a2b <fstat>:
+SYSCALL(fstat)
+     a2b:	b8 08 00 00 00       	mov    $0x8,%eax
+     a30:	cd 40                	int    $0x40
+     a32:	c3                   	ret
+
+00000a33 <link>:
+SYSCALL(link)
+     a33:	b8 13 00 00 00       	mov    $0x13,%eax
+     a38:	cd 40                	int    $0x40
+     a3a:	c3                   	ret
+
+00000a3b <mkdir>:
+SYSCALL(mkdir)
+     a3b:	b8 14 00 00 00       	mov    $0x14,%eax
+     a40:	cd 40                	int    $0x40
+     a42:	c3                   	ret
+
+00000a43 <chdir>:
+SYSCALL(chdir)
+     a43:	b8 09 00 00 00       	mov    $0x9,%eax
+     a48:	cd 40                	int    $0x40
+     a4a:	c3                   	ret
+
+00000a4b <dup>:
+SYSCALL(dup)
+     a4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <getpid>:
+SYSCALL(getpid)
+     a53:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <sbrk>:
+SYSCALL(sbrk)
+     a5b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a60:	cd 40                	int    $0x40
+     a62:	c3                   	ret
+
+00000a63 <sleep>:
+SYSCALL(sleep)
+     a63:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a68:	cd 40                	int    $0x40
+     a6a:	c3                   	ret
+
+00000a6b <uptime>:
+SYSCALL(uptime)
+     a6b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a70:	cd 40                	int    $0x40
+     a72:	c3                   	ret
+
+00000a73 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+     a73:	b8 16 00 00 00       	mov    $0x16,%eax
+     a78:	cd 40                	int    $0x40
+     a7a:	c3                   	ret
+
+00000a7b <get_parent_id>:
+SYSCALL(get_parent_id)
+     a7b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a80:	cd 40                	int    $0x40
+     a82:	c3                   	ret
+
+00000a83 <get_children>:
+SYSCALL(get_children)
+     a83:	b8 18 00 00 00       	mov    $0x18,%eax
+     a88:	cd 40                	int    $0x40
+     a8a:	c3                   	ret
+
+00000a8b <set_path>:
+SYSCALL(set_path)
+     a8b:	b8 19 00 00 00       	mov    $0x19,%eax
+     a90:	cd 40                	int    $0x40
+     a92:	c3                   	ret
+
+00000a93 <set_sleep>:
+SYSCALL(set_sleep)
+     a93:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a98:	cd 40                	int    $0x40
+     a9a:	c3                   	ret
+
+00000a9b <get_time>:
+SYSCALL(get_time)
+     a9b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     aa0:	cd 40                	int    $0x40
+     aa2:	c3                   	ret
+
+00000aa3 <change_process_level>:
+SYSCALL(change_process_level)
+     aa3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     aa8:	cd 40                	int    $0x40
+     aaa:	c3                   	ret
+
+00000aab <set_process_ticket>:
+SYSCALL(set_process_ticket)
+     aab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ab0:	cd 40                	int    $0x40
+     ab2:	c3                   	ret
+
+00000ab3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+     ab3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <print_processes_info>:
+SYSCALL(print_processes_info)
+     abb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <barrier_init>:
+
+SYSCALL(barrier_init)
+     ac3:	b8 20 00 00 00       	mov    $0x20,%eax
+     ac8:	cd 40                	int    $0x40
+     aca:	c3                   	ret
+
+00000acb <barrier_wait>:
+SYSCALL(barrier_wait)
+     acb:	b8 21 00 00 00       	mov    $0x21,%eax
+     ad0:	cd 40                	int    $0x40
+     ad2:	c3                   	ret
+
+00000ad3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+     ad3:	b8 22 00 00 00       	mov    $0x22,%eax
+     ad8:	cd 40                	int    $0x40
+     ada:	c3                   	ret
+
+00000adb <print_lock_stats>:
+SYSCALL(print_lock_stats)
+     adb:	b8 23 00 00 00       	mov    $0x23,%eax
+     ae0:	cd 40                	int    $0x40
+     ae2:	c3                   	ret
+
+00000ae3 <set_process_gang>:
+SYSCALL(set_process_gang)
+     ae3:	b8 24 00 00 00       	mov    $0x24,%eax
+     ae8:	cd 40                	int    $0x40
+     aea:	c3                   	ret
+
+00000aeb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+     aeb:	b8 25 00 00 00       	mov    $0x25,%eax
+     af0:	cd 40                	int    $0x40
+     af2:	c3                   	ret
+
+00000af3 <sem_create>:
+SYSCALL(sem_create)
+     af3:	b8 26 00 00 00       	mov    $0x26,%eax
+     af8:	cd 40                	int    $0x40
+     afa:	c3                   	ret
+
+00000afb <event_create>:
+SYSCALL(event_create)
+     afb:	b8 27 00 00 00       	mov    $0x27,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <sync_post>:
+SYSCALL(sync_post)
+     b03:	b8 28 00 00 00       	mov    $0x28,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <sync_wait>:
+SYSCALL(sync_wait)
+     b0b:	b8 29 00 00 00       	mov    $0x29,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <sync_close>:
+SYSCALL(sync_close)
+     b13:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <event_reset>:
+SYSCALL(event_reset)
+     b1b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+     b23:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <mmap>:
+SYSCALL(mmap)
+     b2b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b30:	cd 40                	int    $0x40
+     b32:	c3                   	ret
+
+00000b33 <munmap>:
+SYSCALL(munmap)
+     b33:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b38:	cd 40                	int    $0x40
+     b3a:	c3                   	ret
+
+00000b3b <shmget>:
+SYSCALL(shmget)
+     b3b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b40:	cd 40                	int    $0x40
+     b42:	c3                   	ret
+
+00000b43 <shmat>:
+SYSCALL(shmat)
+     b43:	b8 30 00 00 00       	mov    $0x30,%eax
+     b48:	cd 40                	int    $0x40
+     b4a:	c3                   	ret
+
+00000b4b <shmdt>:
+SYSCALL(shmdt)
+     b4b:	b8 31 00 00 00       	mov    $0x31,%eax
+     b50:	cd 40                	int    $0x40
+     b52:	c3                   	ret
+
+00000b53 <shmrm>:
+SYSCALL(shmrm)
+     b53:	b8 32 00 00 00       	mov    $0x32,%eax
+     b58:	cd 40                	int    $0x40
+     b5a:	c3                   	ret
+
+00000b5b <_spawn>:
+RAWSYSCALL(spawn)
+     b5b:	b8 33 00 00 00       	mov    $0x33,%eax
+     b60:	cd 40                	int    $0x40
+     b62:	c3                   	ret
+
+00000b63 <memstat>:
+SYSCALL(memstat)
+     b63:	b8 34 00 00 00       	mov    $0x34,%eax
+     b68:	cd 40                	int    $0x40
+     b6a:	c3                   	ret
+     b6b:	66 90                	xchg   %ax,%ax
+     b6d:	66 90                	xchg   %ax,%ax
+     b6f:	90                   	nop
+
+00000b70 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+     b76:	a1 e8 20 00 00       	mov    0x20e8,%eax
+     b7b:	85 c0                	test   %eax,%eax
+     b7d:	7e 17                	jle    b96 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+     b7f:	83 ec 04             	sub    $0x4,%esp
+     b82:	50                   	push   %eax
+     b83:	68 ec 20 00 00       	push   $0x20ec
+     b88:	ff 35 e0 20 00 00    	push   0x20e0
+     b8e:	e8 60 fe ff ff       	call   9f3 <write>
+     b93:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     b96:	c7 05 e8 20 00 00 00 	movl   $0x0,0x20e8
+     b9d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+     ba0:	c7 05 e4 20 00 00 00 	movl   $0x0,0x20e4
+     ba7:	00 00 00 
+}
+     baa:	c9                   	leave
+     bab:	c3                   	ret
+     bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     bb6:	89 d1                	mov    %edx,%ecx
+{
+     bb8:	56                   	push   %esi
+     bb9:	53                   	push   %ebx
+     bba:	89 c3                	mov    %eax,%ebx
+     bbc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+     bbf:	85 d2                	test   %edx,%edx
+     bc1:	0f 89 b9 00 00 00    	jns    c80 <printint+0xd0>
+     bc7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     bcb:	0f 84 af 00 00 00    	je     c80 <printint+0xd0>
+    x = -xx;
+     bd1:	f7 d9                	neg    %ecx
+    neg = 1;
+     bd3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     bd8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     bdb:	31 f6                	xor    %esi,%esi
+     bdd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     be0:	89 c8                	mov    %ecx,%eax
+     be2:	31 d2                	xor    %edx,%edx
+     be4:	89 f3                	mov    %esi,%ebx
+     be6:	f7 f7                	div    %edi
+     be8:	8d 76 01             	lea    0x1(%esi),%esi
+     beb:	0f b6 92 60 18 00 00 	movzbl 0x1860(%edx),%edx
+     bf2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     bf6:	89 ca                	mov    %ecx,%edx
+     bf8:	89 c1                	mov    %eax,%ecx
+     bfa:	39 fa                	cmp    %edi,%edx
+     bfc:	73 e2                	jae    be0 <printint+0x30>
+  if(neg)
+     bfe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     c01:	89 d9                	mov    %ebx,%ecx
+     c03:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     c06:	85 c0                	test   %eax,%eax
+     c08:	74 07                	je     c11 <printint+0x61>
+    buf[i++] = '-';
+     c0a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c0f:	89 f1                	mov    %esi,%ecx
+     c11:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     c14:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+     c16:	8d 43 0c             	lea    0xc(%ebx),%eax
+     c19:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     c1c:	01 f7                	add    %esi,%edi
+     c1e:	eb 09                	jmp    c29 <printint+0x79>
+
+  while(--i >= 0)
+     c20:	8d 47 ff             	lea    -0x1(%edi),%eax
+     c23:	39 f7                	cmp    %esi,%edi
+     c25:	74 36                	je     c5d <printint+0xad>
+     c27:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+     c29:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+     c2c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+     c2f:	8d 42 01             	lea    0x1(%edx),%eax
+     c32:	89 43 08             	mov    %eax,0x8(%ebx)
+     c35:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     c39:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c3e:	74 28                	je     c68 <printint+0xb8>
+     c40:	80 f9 0a             	cmp    $0xa,%cl
+     c43:	75 db                	jne    c20 <printint+0x70>
+     c45:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     c49:	75 d5                	jne    c20 <printint+0x70>
+  if(b->n > 0)
+     c4b:	85 c0                	test   %eax,%eax
+     c4d:	7f 19                	jg     c68 <printint+0xb8>
+  b->n = 0;
+     c4f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+     c56:	8d 47 ff             	lea    -0x1(%edi),%eax
+     c59:	39 f7                	cmp    %esi,%edi
+     c5b:	75 ca                	jne    c27 <printint+0x77>
+}
+     c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c60:	5b                   	pop    %ebx
+     c61:	5e                   	pop    %esi
+     c62:	5f                   	pop    %edi
+     c63:	5d                   	pop    %ebp
+     c64:	c3                   	ret
+     c65:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     c68:	83 ec 04             	sub    $0x4,%esp
+     c6b:	50                   	push   %eax
+     c6c:	ff 75 d4             	push   -0x2c(%ebp)
+     c6f:	ff 33                	push   (%ebx)
+     c71:	e8 7d fd ff ff       	call   9f3 <write>
+     c76:	83 c4 10             	add    $0x10,%esp
+     c79:	eb d4                	jmp    c4f <printint+0x9f>
+     c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+  neg = 0;
+     c80:	31 c0                	xor    %eax,%eax
+     c82:	e9 51 ff ff ff       	jmp    bd8 <printint+0x28>
+     c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8e:	66 90                	xchg   %ax,%ax
+
+00000c90 <putc>:
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	53                   	push   %ebx
+     c94:	89 c3                	mov    %eax,%ebx
+     c96:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+     c99:	8b 48 08             	mov    0x8(%eax),%ecx
+     c9c:	8d 41 01             	lea    0x1(%ecx),%eax
+     c9f:	89 43 08             	mov    %eax,0x8(%ebx)
+     ca2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     ca6:	3d 00 02 00 00       	cmp    $0x200,%eax
+     cab:	74 33                	je     ce0 <putc+0x50>
+     cad:	80 fa 0a             	cmp    $0xa,%dl
+     cb0:	74 0e                	je     cc0 <putc+0x30>
+}
+     cb2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cb5:	c9                   	leave
+     cb6:	c3                   	ret
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     cc0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+     cc4:	75 ec                	jne    cb2 <putc+0x22>
+  if(b->n > 0)
+     cc6:	85 c0                	test   %eax,%eax
+     cc8:	7f 16                	jg     ce0 <putc+0x50>
+  b->n = 0;
+     cca:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cd4:	c9                   	leave
+     cd5:	c3                   	ret
+     cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     ce0:	83 ec 04             	sub    $0x4,%esp
+     ce3:	50                   	push   %eax
+     ce4:	8d 43 0c             	lea    0xc(%ebx),%eax
+     ce7:	50                   	push   %eax
+     ce8:	ff 33                	push   (%ebx)
+     cea:	e8 04 fd ff ff       	call   9f3 <write>
+     cef:	83 c4 10             	add    $0x10,%esp
+     cf2:	eb d6                	jmp    cca <putc+0x3a>
+     cf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+
+00000d00 <fflush>:
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+     d06:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     d0a:	74 04                	je     d10 <fflush+0x10>
+}
+     d0c:	c9                   	leave
+     d0d:	c3                   	ret
+     d0e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     d10:	a1 e8 20 00 00       	mov    0x20e8,%eax
+     d15:	85 c0                	test   %eax,%eax
+     d17:	7f 17                	jg     d30 <fflush+0x30>
+  b->n = 0;
+     d19:	c7 05 e8 20 00 00 00 	movl   $0x0,0x20e8
+     d20:	00 00 00 
+  out.mode = 0;
+     d23:	c7 05 e4 20 00 00 00 	movl   $0x0,0x20e4
+     d2a:	00 00 00 
+}
+     d2d:	c9                   	leave
+     d2e:	c3                   	ret
+     d2f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+     d30:	83 ec 04             	sub    $0x4,%esp
+     d33:	50                   	push   %eax
+     d34:	68 ec 20 00 00       	push   $0x20ec
+     d39:	ff 35 e0 20 00 00    	push   0x20e0
+     d3f:	e8 af fc ff ff       	call   9f3 <write>
+     d44:	83 c4 10             	add    $0x10,%esp
+     d47:	eb d0                	jmp    d19 <fflush+0x19>
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	57                   	push   %edi
+     d54:	56                   	push   %esi
+     d55:	53                   	push   %ebx
+     d56:	83 ec 3c             	sub    $0x3c,%esp
+     d59:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     d5c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+     d5f:	83 fe 01             	cmp    $0x1,%esi
+     d62:	0f 84 60 01 00 00    	je     ec8 <printf+0x178>
+    b->fd = fd;
+     d68:	89 35 c0 1e 00 00    	mov    %esi,0x1ec0
+  for(i = 0; fmt[i]; i++){
+     d6e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+     d71:	bf c0 1e 00 00       	mov    $0x1ec0,%edi
+  for(i = 0; fmt[i]; i++){
+     d76:	84 c0                	test   %al,%al
+     d78:	74 65                	je     ddf <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+     d7a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d7d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+     d80:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     d82:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+     d85:	eb 1f                	jmp    da6 <printf+0x56>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+     d90:	83 f8 25             	cmp    $0x25,%eax
+     d93:	74 3b                	je     dd0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+     d95:	89 f8                	mov    %edi,%eax
+     d97:	e8 f4 fe ff ff       	call   c90 <putc>
+  for(i = 0; fmt[i]; i++){
+     d9c:	0f b6 03             	movzbl (%ebx),%eax
+     d9f:	83 c3 01             	add    $0x1,%ebx
+     da2:	84 c0                	test   %al,%al
+     da4:	74 39                	je     ddf <printf+0x8f>
+    c = fmt[i] & 0xff;
+     da6:	0f be d0             	movsbl %al,%edx
+     da9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dac:	85 f6                	test   %esi,%esi
+     dae:	74 e0                	je     d90 <printf+0x40>
+      }
+    } else if(state == '%'){
+     db0:	83 fe 25             	cmp    $0x25,%esi
+     db3:	75 e7                	jne    d9c <printf+0x4c>
+      if(c == 'd'){
+     db5:	83 f8 25             	cmp    $0x25,%eax
+     db8:	74 57                	je     e11 <printf+0xc1>
+     dba:	83 e8 63             	sub    $0x63,%eax
+     dbd:	83 f8 15             	cmp    $0x15,%eax
+     dc0:	77 36                	ja     df8 <printf+0xa8>
+     dc2:	ff 24 85 08 18 00 00 	jmp    *0x1808(,%eax,4)
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+     dd0:	0f b6 03             	movzbl (%ebx),%eax
+     dd3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+     dd6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+     ddb:	84 c0                	test   %al,%al
+     ddd:	75 c7                	jne    da6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+     ddf:	8b 47 04             	mov    0x4(%edi),%eax
+     de2:	85 c0                	test   %eax,%eax
+     de4:	0f 84 06 01 00 00    	je     ef0 <printf+0x1a0>
+    bflush(b);
+}
+     dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ded:	5b                   	pop    %ebx
+     dee:	5e                   	pop    %esi
+     def:	5f                   	pop    %edi
+     df0:	5d                   	pop    %ebp
+     df1:	c3                   	ret
+     df2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+     df8:	8b 4f 08             	mov    0x8(%edi),%ecx
+     dfb:	8d 41 01             	lea    0x1(%ecx),%eax
+     dfe:	89 47 08             	mov    %eax,0x8(%edi)
+     e01:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+     e06:	3d 00 02 00 00       	cmp    $0x200,%eax
+     e0b:	0f 84 77 01 00 00    	je     f88 <printf+0x238>
+        putc(b, c);
+     e11:	89 f8                	mov    %edi,%eax
+      state = 0;
+     e13:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+     e15:	e8 76 fe ff ff       	call   c90 <putc>
+     e1a:	eb 80                	jmp    d9c <printf+0x4c>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+     e20:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e23:	83 ec 0c             	sub    $0xc,%esp
+     e26:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e2b:	8b 16                	mov    (%esi),%edx
+     e2d:	6a 00                	push   $0x0
+        ap++;
+     e2f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+     e32:	89 f8                	mov    %edi,%eax
+     e34:	e8 77 fd ff ff       	call   bb0 <printint>
+        ap++;
+     e39:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     e3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e3f:	31 f6                	xor    %esi,%esi
+     e41:	e9 56 ff ff ff       	jmp    d9c <printf+0x4c>
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     e50:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     e53:	8b 08                	mov    (%eax),%ecx
+        ap++;
+     e55:	83 c0 04             	add    $0x4,%eax
+     e58:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+     e5b:	85 c9                	test   %ecx,%ecx
+     e5d:	0f 84 cd 00 00 00    	je     f30 <printf+0x1e0>
+        while(*s != 0){
+     e63:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+     e66:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+     e68:	84 d2                	test   %dl,%dl
+     e6a:	0f 84 2c ff ff ff    	je     d9c <printf+0x4c>
+          putc(b, *s);
+     e70:	89 f8                	mov    %edi,%eax
+     e72:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     e75:	e8 16 fe ff ff       	call   c90 <putc>
+          s++;
+     e7a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+     e7d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+     e81:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+     e84:	84 d2                	test   %dl,%dl
+     e86:	75 e8                	jne    e70 <printf+0x120>
+      state = 0;
+     e88:	31 f6                	xor    %esi,%esi
+     e8a:	e9 0d ff ff ff       	jmp    d9c <printf+0x4c>
+     e8f:	90                   	nop
+        printint(b, *ap, 10, 1);
+     e90:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e93:	83 ec 0c             	sub    $0xc,%esp
+     e96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e9b:	8b 16                	mov    (%esi),%edx
+     e9d:	6a 01                	push   $0x1
+     e9f:	eb 8e                	jmp    e2f <printf+0xdf>
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+     ea8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     eab:	89 f8                	mov    %edi,%eax
+     ead:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+     eb0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+     eb3:	e8 d8 fd ff ff       	call   c90 <putc>
+        ap++;
+     eb8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+     ebb:	31 f6                	xor    %esi,%esi
+     ebd:	e9 da fe ff ff       	jmp    d9c <printf+0x4c>
+     ec2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+     ec8:	8b 15 e4 20 00 00    	mov    0x20e4,%edx
+     ece:	85 d2                	test   %edx,%edx
+     ed0:	74 6e                	je     f40 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+     ed2:	0f b6 03             	movzbl (%ebx),%eax
+     ed5:	bf e0 20 00 00       	mov    $0x20e0,%edi
+     eda:	84 c0                	test   %al,%al
+     edc:	0f 85 98 fe ff ff    	jne    d7a <printf+0x2a>
+     ee2:	e9 03 ff ff ff       	jmp    dea <printf+0x9a>
+     ee7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eee:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+     ef0:	8b 47 08             	mov    0x8(%edi),%eax
+     ef3:	85 c0                	test   %eax,%eax
+     ef5:	7f 19                	jg     f10 <printf+0x1c0>
+  b->n = 0;
+     ef7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     efe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f01:	5b                   	pop    %ebx
+     f02:	5e                   	pop    %esi
+     f03:	5f                   	pop    %edi
+     f04:	5d                   	pop    %ebp
+     f05:	c3                   	ret
+     f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+     f10:	83 ec 04             	sub    $0x4,%esp
+     f13:	50                   	push   %eax
+     f14:	8d 47 0c             	lea    0xc(%edi),%eax
+     f17:	50                   	push   %eax
+     f18:	ff 37                	push   (%edi)
+     f1a:	e8 d4 fa ff ff       	call   9f3 <write>
+  b->n = 0;
+     f1f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+     f26:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+     f29:	eb d3                	jmp    efe <printf+0x1ae>
+     f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+     f30:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+     f35:	b9 00 18 00 00       	mov    $0x1800,%ecx
+     f3a:	e9 31 ff ff ff       	jmp    e70 <printf+0x120>
+     f3f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     f40:	83 ec 08             	sub    $0x8,%esp
+     f43:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+     f46:	c7 05 e0 20 00 00 01 	movl   $0x1,0x20e0
+     f4d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     f50:	50                   	push   %eax
+     f51:	6a 01                	push   $0x1
+     f53:	e8 d3 fa ff ff       	call   a2b <fstat>
+     f58:	83 c4 10             	add    $0x10,%esp
+     f5b:	85 c0                	test   %eax,%eax
+     f5d:	75 22                	jne    f81 <printf+0x231>
+     f5f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     f64:	b8 02 00 00 00       	mov    $0x2,%eax
+     f69:	0f 45 f0             	cmovne %eax,%esi
+     f6c:	89 35 e4 20 00 00    	mov    %esi,0x20e4
+      stdioflush = flushout;
+     f72:	c7 05 80 1c 00 00 70 	movl   $0xb70,0x1c80
+     f79:	0b 00 00 
+     f7c:	e9 51 ff ff ff       	jmp    ed2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+     f81:	be 02 00 00 00       	mov    $0x2,%esi
+     f86:	eb e4                	jmp    f6c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+     f88:	83 ec 04             	sub    $0x4,%esp
+     f8b:	8d 47 0c             	lea    0xc(%edi),%eax
+     f8e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     f91:	68 00 02 00 00       	push   $0x200
+     f96:	50                   	push   %eax
+     f97:	ff 37                	push   (%edi)
+     f99:	e8 55 fa ff ff       	call   9f3 <write>
+  b->n = 0;
+     f9e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+     fa5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     fa8:	83 c4 10             	add    $0x10,%esp
+     fab:	e9 61 fe ff ff       	jmp    e11 <printf+0xc1>
+
+00000fb0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	56                   	push   %esi
+     fb4:	53                   	push   %ebx
+     fb5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+     fb7:	a1 00 23 00 00       	mov    0x2300,%eax
+     fbc:	39 d8                	cmp    %ebx,%eax
+     fbe:	0f 83 e4 00 00 00    	jae    10a8 <freepages+0xf8>
+     fc4:	85 c0                	test   %eax,%eax
+     fc6:	0f 84 dc 00 00 00    	je     10a8 <freepages+0xf8>
+     fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fd0:	89 c2                	mov    %eax,%edx
+     fd2:	8b 00                	mov    (%eax),%eax
+     fd4:	85 c0                	test   %eax,%eax
+     fd6:	74 04                	je     fdc <freepages+0x2c>
+     fd8:	39 d8                	cmp    %ebx,%eax
+     fda:	72 f4                	jb     fd0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+     fdc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+     fdf:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+     fe1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+     fe3:	85 c0                	test   %eax,%eax
+     fe5:	74 15                	je     ffc <freepages+0x4c>
+    p->prev = s;
+     fe7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+     fea:	8b 73 10             	mov    0x10(%ebx),%esi
+     fed:	89 f1                	mov    %esi,%ecx
+     fef:	c1 e1 0c             	shl    $0xc,%ecx
+     ff2:	01 d9                	add    %ebx,%ecx
+     ff4:	39 c8                	cmp    %ecx,%eax
+     ff6:	0f 84 d8 00 00 00    	je     10d4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+     ffc:	8b 4a 10             	mov    0x10(%edx),%ecx
+     fff:	89 c8                	mov    %ecx,%eax
+    1001:	c1 e0 0c             	shl    $0xc,%eax
+    1004:	01 d0                	add    %edx,%eax
+    1006:	39 c3                	cmp    %eax,%ebx
+    1008:	74 16                	je     1020 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    100a:	8b 03                	mov    (%ebx),%eax
+    100c:	85 c0                	test   %eax,%eax
+    100e:	74 40                	je     1050 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+    1010:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1013:	5b                   	pop    %ebx
+    1014:	5e                   	pop    %esi
+    1015:	5d                   	pop    %ebp
+    1016:	c3                   	ret
+    1017:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+    1020:	03 4b 10             	add    0x10(%ebx),%ecx
+    1023:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+    1026:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+    1029:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    102b:	85 c9                	test   %ecx,%ecx
+    102d:	0f 84 dd 00 00 00    	je     1110 <freepages+0x160>
+    s->prev->next = s->next;
+    1033:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+    1035:	85 c0                	test   %eax,%eax
+    1037:	74 06                	je     103f <freepages+0x8f>
+    s->next->prev = s->prev;
+    1039:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    103c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+    103f:	8b 02                	mov    (%edx),%eax
+    1041:	89 d3                	mov    %edx,%ebx
+    1043:	85 c0                	test   %eax,%eax
+    1045:	75 c9                	jne    1010 <freepages+0x60>
+    1047:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104e:	66 90                	xchg   %ax,%ax
+    1050:	8b 43 10             	mov    0x10(%ebx),%eax
+    1053:	83 f8 0f             	cmp    $0xf,%eax
+    1056:	76 b8                	jbe    1010 <freepages+0x60>
+    1058:	83 ec 0c             	sub    $0xc,%esp
+    105b:	c1 e0 0c             	shl    $0xc,%eax
+    105e:	6a 00                	push   $0x0
+    1060:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1063:	e8 f3 f9 ff ff       	call   a5b <sbrk>
+    1068:	83 c4 10             	add    $0x10,%esp
+    106b:	39 c6                	cmp    %eax,%esi
+    106d:	75 a1                	jne    1010 <freepages+0x60>
+  if(s->prev)
+    106f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+    1072:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+    1074:	85 d2                	test   %edx,%edx
+    1076:	0f 84 a5 00 00 00    	je     1121 <freepages+0x171>
+    s->prev->next = s->next;
+    107c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+    107e:	85 c0                	test   %eax,%eax
+    1080:	74 06                	je     1088 <freepages+0xd8>
+    s->next->prev = s->prev;
+    1082:	8b 53 04             	mov    0x4(%ebx),%edx
+    1085:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+    1088:	8b 43 10             	mov    0x10(%ebx),%eax
+    108b:	83 ec 0c             	sub    $0xc,%esp
+    108e:	c1 e0 0c             	shl    $0xc,%eax
+    1091:	f7 d8                	neg    %eax
+    1093:	50                   	push   %eax
+    1094:	e8 c2 f9 ff ff       	call   a5b <sbrk>
+    1099:	83 c4 10             	add    $0x10,%esp
+}
+    109c:	e9 6f ff ff ff       	jmp    1010 <freepages+0x60>
+    10a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+    10a8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+    10af:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+    10b1:	89 1d 00 23 00 00    	mov    %ebx,0x2300
+  if(p)
+    10b7:	85 c0                	test   %eax,%eax
+    10b9:	74 95                	je     1050 <freepages+0xa0>
+    p->prev = s;
+    10bb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+    10be:	8b 73 10             	mov    0x10(%ebx),%esi
+    10c1:	89 f2                	mov    %esi,%edx
+    10c3:	c1 e2 0c             	shl    $0xc,%edx
+    10c6:	01 da                	add    %ebx,%edx
+    10c8:	39 d0                	cmp    %edx,%eax
+    10ca:	0f 85 3a ff ff ff    	jne    100a <freepages+0x5a>
+    10d0:	89 c1                	mov    %eax,%ecx
+    10d2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+    10d4:	8b 41 10             	mov    0x10(%ecx),%eax
+    10d7:	01 f0                	add    %esi,%eax
+    10d9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+    10dc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+    10df:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+    10e1:	85 f6                	test   %esi,%esi
+    10e3:	74 35                	je     111a <freepages+0x16a>
+    s->prev->next = s->next;
+    10e5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+    10e7:	85 c0                	test   %eax,%eax
+    10e9:	74 06                	je     10f1 <freepages+0x141>
+    s->next->prev = s->prev;
+    10eb:	8b 49 04             	mov    0x4(%ecx),%ecx
+    10ee:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+    10f1:	85 d2                	test   %edx,%edx
+    10f3:	0f 84 11 ff ff ff    	je     100a <freepages+0x5a>
+    10f9:	8b 4a 10             	mov    0x10(%edx),%ecx
+    10fc:	89 c8                	mov    %ecx,%eax
+    10fe:	c1 e0 0c             	shl    $0xc,%eax
+    1101:	01 d0                	add    %edx,%eax
+    1103:	39 c3                	cmp    %eax,%ebx
+    1105:	0f 85 ff fe ff ff    	jne    100a <freepages+0x5a>
+    110b:	e9 10 ff ff ff       	jmp    1020 <freepages+0x70>
+    *l = s->next;
+    1110:	a3 00 23 00 00       	mov    %eax,0x2300
+    1115:	e9 1b ff ff ff       	jmp    1035 <freepages+0x85>
+    111a:	a3 00 23 00 00       	mov    %eax,0x2300
+    111f:	eb c6                	jmp    10e7 <freepages+0x137>
+    1121:	a3 00 23 00 00       	mov    %eax,0x2300
+    1126:	e9 53 ff ff ff       	jmp    107e <freepages+0xce>
+    112b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    112f:	90                   	nop
+
+00001130 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	56                   	push   %esi
+    1134:	53                   	push   %ebx
+    1135:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+    1137:	a1 00 23 00 00       	mov    0x2300,%eax
+    113c:	85 c0                	test   %eax,%eax
+    113e:	74 5e                	je     119e <getpages+0x6e>
+    if(s->npages < n)
+    1140:	8b 50 10             	mov    0x10(%eax),%edx
+    1143:	39 da                	cmp    %ebx,%edx
+    1145:	72 51                	jb     1198 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+    1147:	39 d3                	cmp    %edx,%ebx
+    1149:	72 25                	jb     1170 <getpages+0x40>
+  if(s->prev)
+    114b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+    114e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+    1150:	85 c9                	test   %ecx,%ecx
+    1152:	0f 84 a8 00 00 00    	je     1200 <getpages+0xd0>
+    s->prev->next = s->next;
+    1158:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+    115a:	85 d2                	test   %edx,%edx
+    115c:	74 06                	je     1164 <getpages+0x34>
+    s->next->prev = s->prev;
+    115e:	8b 48 04             	mov    0x4(%eax),%ecx
+    1161:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+    1164:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+    1167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    116a:	5b                   	pop    %ebx
+    116b:	5e                   	pop    %esi
+    116c:	5d                   	pop    %ebp
+    116d:	c3                   	ret
+    116e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1170:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+    1172:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+    1174:	c1 e1 0c             	shl    $0xc,%ecx
+    1177:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+    1179:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+    117c:	8b 70 04             	mov    0x4(%eax),%esi
+    117f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+    1182:	8b 10                	mov    (%eax),%edx
+    1184:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+    1186:	85 f6                	test   %esi,%esi
+    1188:	74 66                	je     11f0 <getpages+0xc0>
+        rest->prev->next = rest;
+    118a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+    118c:	8b 11                	mov    (%ecx),%edx
+    118e:	85 d2                	test   %edx,%edx
+    1190:	75 cf                	jne    1161 <getpages+0x31>
+    1192:	eb d0                	jmp    1164 <getpages+0x34>
+    1194:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+    1198:	8b 00                	mov    (%eax),%eax
+    119a:	85 c0                	test   %eax,%eax
+    119c:	75 a2                	jne    1140 <getpages+0x10>
+  brk = (uint)sbrk(0);
+    119e:	83 ec 0c             	sub    $0xc,%esp
+    11a1:	6a 00                	push   $0x0
+    11a3:	e8 b3 f8 ff ff       	call   a5b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+    11a8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+    11ab:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+    11b1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    11b3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+    11b9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+    11bf:	29 d0                	sub    %edx,%eax
+    11c1:	c1 e8 0c             	shr    $0xc,%eax
+    11c4:	39 d8                	cmp    %ebx,%eax
+    11c6:	72 48                	jb     1210 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+    11c8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    11ca:	89 d8                	mov    %ebx,%eax
+    11cc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+    11cf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    11d1:	c1 e0 0c             	shl    $0xc,%eax
+    11d4:	01 f0                	add    %esi,%eax
+    11d6:	50                   	push   %eax
+    11d7:	e8 7f f8 ff ff       	call   a5b <sbrk>
+    11dc:	83 c4 10             	add    $0x10,%esp
+    11df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11e2:	74 2c                	je     1210 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+    11e4:	01 f0                	add    %esi,%eax
+    11e6:	e9 79 ff ff ff       	jmp    1164 <getpages+0x34>
+    11eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+        runs = rest;
+    11f0:	89 0d 00 23 00 00    	mov    %ecx,0x2300
+    11f6:	eb 96                	jmp    118e <getpages+0x5e>
+    11f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+    *l = s->next;
+    1200:	89 15 00 23 00 00    	mov    %edx,0x2300
+    1206:	e9 4f ff ff ff       	jmp    115a <getpages+0x2a>
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+    return 0;
+    1210:	31 c0                	xor    %eax,%eax
+    1212:	e9 50 ff ff ff       	jmp    1167 <getpages+0x37>
+    1217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121e:	66 90                	xchg   %ax,%ax
+
+00001220 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	57                   	push   %edi
+    1224:	56                   	push   %esi
+    1225:	53                   	push   %ebx
+    1226:	83 ec 1c             	sub    $0x1c,%esp
+    1229:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+    122c:	85 c0                	test   %eax,%eax
+    122e:	0f 84 97 00 00 00    	je     12cb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+    1234:	89 c3                	mov    %eax,%ebx
+    1236:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+    123c:	8b 73 14             	mov    0x14(%ebx),%esi
+    123f:	83 fe 01             	cmp    $0x1,%esi
+    1242:	74 74                	je     12b8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+    1244:	85 f6                	test   %esi,%esi
+    1246:	74 5d                	je     12a5 <free+0x85>
+  if(s->free == 0)
+    1248:	8b 53 08             	mov    0x8(%ebx),%edx
+    124b:	85 d2                	test   %edx,%edx
+    124d:	0f 84 85 00 00 00    	je     12d8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+    1253:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+    1255:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+    1258:	8b 43 0c             	mov    0xc(%ebx),%eax
+    125b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+    125e:	8b 04 f5 24 23 00 00 	mov    0x2324(,%esi,8),%eax
+  s->inuse--;
+    1265:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+    1268:	83 c0 01             	add    $0x1,%eax
+    126b:	89 04 f5 24 23 00 00 	mov    %eax,0x2324(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1272:	85 d2                	test   %edx,%edx
+    1274:	75 55                	jne    12cb <free+0xab>
+    1276:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+    127b:	89 f1                	mov    %esi,%ecx
+    127d:	d3 ea                	shr    %cl,%edx
+    127f:	39 c2                	cmp    %eax,%edx
+    1281:	73 7d                	jae    1300 <free+0xe0>
+  if(s->prev)
+    1283:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+    1286:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+    1288:	85 ff                	test   %edi,%edi
+    128a:	0f 84 a0 00 00 00    	je     1330 <free+0x110>
+    s->prev->next = s->next;
+    1290:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+    1292:	85 c9                	test   %ecx,%ecx
+    1294:	74 06                	je     129c <free+0x7c>
+    s->next->prev = s->prev;
+    1296:	8b 7b 04             	mov    0x4(%ebx),%edi
+    1299:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+    129c:	29 d0                	sub    %edx,%eax
+    129e:	89 04 f5 24 23 00 00 	mov    %eax,0x2324(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+    12a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+    12a8:	89 d8                	mov    %ebx,%eax
+}
+    12aa:	5b                   	pop    %ebx
+    12ab:	5e                   	pop    %esi
+    12ac:	5f                   	pop    %edi
+    12ad:	5d                   	pop    %ebp
+    freepages(s);
+    12ae:	e9 fd fc ff ff       	jmp    fb0 <freepages>
+    12b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12b7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+    12b8:	8b 43 10             	mov    0x10(%ebx),%eax
+    12bb:	83 ec 08             	sub    $0x8,%esp
+    12be:	c1 e0 0c             	shl    $0xc,%eax
+    12c1:	50                   	push   %eax
+    12c2:	53                   	push   %ebx
+    12c3:	e8 6b f8 ff ff       	call   b33 <munmap>
+    12c8:	83 c4 10             	add    $0x10,%esp
+}
+    12cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12ce:	5b                   	pop    %ebx
+    12cf:	5e                   	pop    %esi
+    12d0:	5f                   	pop    %edi
+    12d1:	5d                   	pop    %ebp
+    12d2:	c3                   	ret
+    12d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12d7:	90                   	nop
+  s->next = *l;
+    12d8:	8b 14 f5 20 23 00 00 	mov    0x2320(,%esi,8),%edx
+  s->prev = 0;
+    12df:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+    12e6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+    12e8:	85 d2                	test   %edx,%edx
+    12ea:	74 06                	je     12f2 <free+0xd2>
+    (*l)->prev = s;
+    12ec:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+    12ef:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+    12f2:	89 1c f5 20 23 00 00 	mov    %ebx,0x2320(,%esi,8)
+}
+    12f9:	e9 55 ff ff ff       	jmp    1253 <free+0x33>
+    12fe:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+    1300:	83 ec 0c             	sub    $0xc,%esp
+    1303:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1306:	8b 7b 10             	mov    0x10(%ebx),%edi
+    1309:	6a 00                	push   $0x0
+    130b:	c1 e7 0c             	shl    $0xc,%edi
+    130e:	01 df                	add    %ebx,%edi
+    1310:	e8 46 f7 ff ff       	call   a5b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+    1315:	83 c4 10             	add    $0x10,%esp
+    1318:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    131b:	39 c7                	cmp    %eax,%edi
+    131d:	75 ac                	jne    12cb <free+0xab>
+    131f:	8b 04 f5 24 23 00 00 	mov    0x2324(,%esi,8),%eax
+    1326:	e9 58 ff ff ff       	jmp    1283 <free+0x63>
+    132b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    132f:	90                   	nop
+    *l = s->next;
+    1330:	89 0c f5 20 23 00 00 	mov    %ecx,0x2320(,%esi,8)
+    1337:	e9 56 ff ff ff       	jmp    1292 <free+0x72>
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001340 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1340:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1341:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+    1346:	89 e5                	mov    %esp,%ebp
+    1348:	57                   	push   %edi
+    1349:	56                   	push   %esi
+    134a:	53                   	push   %ebx
+    134b:	83 ec 1c             	sub    $0x1c,%esp
+    134e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+    1351:	83 f8 10             	cmp    $0x10,%eax
+    1354:	0f 86 92 00 00 00    	jbe    13ec <malloc+0xac>
+    135a:	ba 01 00 00 00       	mov    $0x1,%edx
+    135f:	eb 13                	jmp    1374 <malloc+0x34>
+    1361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1368:	89 d3                	mov    %edx,%ebx
+    136a:	d3 e3                	shl    %cl,%ebx
+    136c:	39 c3                	cmp    %eax,%ebx
+    136e:	0f 83 84 00 00 00    	jae    13f8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+    1374:	83 c1 01             	add    $0x1,%ecx
+    1377:	83 f9 0b             	cmp    $0xb,%ecx
+    137a:	75 ec                	jne    1368 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+    137c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+    1381:	0f 87 c9 00 00 00    	ja     1450 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+    1387:	05 17 10 00 00       	add    $0x1017,%eax
+    138c:	89 c3                	mov    %eax,%ebx
+    138e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+    1391:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+    1396:	77 28                	ja     13c0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+    1398:	89 d8                	mov    %ebx,%eax
+    139a:	e8 91 fd ff ff       	call   1130 <getpages>
+    139f:	85 c0                	test   %eax,%eax
+    13a1:	0f 84 a9 00 00 00    	je     1450 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+    13a7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+    13ae:	83 c0 18             	add    $0x18,%eax
+}
+    13b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13b4:	5b                   	pop    %ebx
+    13b5:	5e                   	pop    %esi
+    13b6:	5f                   	pop    %edi
+    13b7:	5d                   	pop    %ebp
+    13b8:	c3                   	ret
+    13b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+    13c0:	89 d8                	mov    %ebx,%eax
+    13c2:	83 ec 08             	sub    $0x8,%esp
+    13c5:	c1 e0 0c             	shl    $0xc,%eax
+    13c8:	6a 00                	push   $0x0
+    13ca:	6a ff                	push   $0xffffffff
+    13cc:	6a 22                	push   $0x22
+    13ce:	6a 03                	push   $0x3
+    13d0:	50                   	push   %eax
+    13d1:	6a 00                	push   $0x0
+    13d3:	e8 53 f7 ff ff       	call   b2b <mmap>
+    if(s == MAP_FAILED)
+    13d8:	83 c4 20             	add    $0x20,%esp
+    13db:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13de:	74 b8                	je     1398 <malloc+0x58>
+      s->shift = MAPRUN;
+    13e0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+    13e7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+    13ea:	eb c2                	jmp    13ae <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+    13ec:	bb 10 00 00 00       	mov    $0x10,%ebx
+    13f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+    13f8:	8b 34 cd 20 23 00 00 	mov    0x2320(,%ecx,8),%esi
+    13ff:	85 f6                	test   %esi,%esi
+    1401:	74 57                	je     145a <malloc+0x11a>
+  classes[shift].nfree--;
+    1403:	8b 1c cd 24 23 00 00 	mov    0x2324(,%ecx,8),%ebx
+  o = s->free;
+    140a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+    140d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+    1410:	89 14 cd 24 23 00 00 	mov    %edx,0x2324(,%ecx,8)
+  s->free = NEXTFREE(o);
+    1417:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+    1419:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+    141d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+    1420:	85 ff                	test   %edi,%edi
+    1422:	75 8d                	jne    13b1 <malloc+0x71>
+  if(s->prev)
+    1424:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+    1427:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+    1429:	85 db                	test   %ebx,%ebx
+    142b:	0f 84 b7 00 00 00    	je     14e8 <malloc+0x1a8>
+    s->prev->next = s->next;
+    1431:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+    1433:	85 d2                	test   %edx,%edx
+    1435:	0f 84 76 ff ff ff    	je     13b1 <malloc+0x71>
+    s->next->prev = s->prev;
+    143b:	8b 4e 04             	mov    0x4(%esi),%ecx
+    143e:	89 4a 04             	mov    %ecx,0x4(%edx)
+    1441:	e9 6b ff ff ff       	jmp    13b1 <malloc+0x71>
+    1446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+    1450:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+    1453:	31 c0                	xor    %eax,%eax
+}
+    1455:	5b                   	pop    %ebx
+    1456:	5e                   	pop    %esi
+    1457:	5f                   	pop    %edi
+    1458:	5d                   	pop    %ebp
+    1459:	c3                   	ret
+    if((s = getpages(1)) == 0)
+    145a:	b8 01 00 00 00       	mov    $0x1,%eax
+    145f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    1462:	e8 c9 fc ff ff       	call   1130 <getpages>
+    1467:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    146a:	85 c0                	test   %eax,%eax
+    146c:	89 c2                	mov    %eax,%edx
+    146e:	74 e0                	je     1450 <malloc+0x110>
+    s->shift = shift;
+    1470:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1473:	f7 db                	neg    %ebx
+    s->inuse = 0;
+    1475:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+    147c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1481:	89 df                	mov    %ebx,%edi
+    1483:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+    1485:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+    1487:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    148a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    148d:	83 e8 01             	sub    $0x1,%eax
+    1490:	d3 e0                	shl    %cl,%eax
+    1492:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1495:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    1499:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    149c:	eb 04                	jmp    14a2 <malloc+0x162>
+    149e:	66 90                	xchg   %ax,%ax
+    14a0:	89 c8                	mov    %ecx,%eax
+    14a2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+    14a5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+    14a7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+    14aa:	89 c6                	mov    %eax,%esi
+    14ac:	39 da                	cmp    %ebx,%edx
+    14ae:	7f f0                	jg     14a0 <malloc+0x160>
+    14b0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    14b3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    14b6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+    14b9:	8b 04 cd 20 23 00 00 	mov    0x2320(,%ecx,8),%eax
+  s->prev = 0;
+    14c0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+    14c7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+    14c9:	85 c0                	test   %eax,%eax
+    14cb:	74 03                	je     14d0 <malloc+0x190>
+    (*l)->prev = s;
+    14cd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+    14d0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+    14d3:	89 14 cd 20 23 00 00 	mov    %edx,0x2320(,%ecx,8)
+    classes[shift].nfree += n;
+    14da:	89 d6                	mov    %edx,%esi
+    14dc:	03 1c cd 24 23 00 00 	add    0x2324(,%ecx,8),%ebx
+    14e3:	e9 22 ff ff ff       	jmp    140a <malloc+0xca>
+    *l = s->next;
+    14e8:	89 14 cd 20 23 00 00 	mov    %edx,0x2320(,%ecx,8)
+    14ef:	e9 3f ff ff ff       	jmp    1433 <malloc+0xf3>
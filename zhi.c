@@ -6,7 +6,7 @@
 // zhi 123 -> count
 
 // mkdir test / cd test / ls not working
-// zhi path /:bin:asdasd -> set set PATH
+// zhi path /:bin:asdasd cmd args -> run cmd with that PATH
 // ls works
 
 #define COMMAND_COUNT "count"
@@ -16,12 +16,16 @@
 #define COMMAND_SLEEP "sleep"
 #define COMMAND_BARRIER "barrier"
 #define COMMAND_REENTRANT "reentrant"
+#define COMMAND_LOCKS "locks"
+#define COMMAND_GANG "gang"
+#define COMMAND_SEM "sem"
+#define COMMAND_VM "vm"
 
 int main(int argc, char *argv[])
 {
     printf(1, "----------------------------------\nCurrent pid = %d\n", getpid());
     if(argc < 2){
-        printf(1, "Error: Too few args \nuse {count 123}/{parent}/{children 2}/{path /:bin:}\n");
+        printf(1, "Error: Too few args \nuse {count 123}/{parent}/{children 2}/{path /:bin: cmd}\n");
         exit();
     }
 
@@ -53,10 +57,16 @@ int main(int argc, char *argv[])
         exit();
     }
 
-    if (strcmp(argv[1], COMMAND_PATH)  == 0 && argc == 3)
+    if (strcmp(argv[1], COMMAND_PATH)  == 0 && argc >= 3)
     {
-        printf(1, "adding the pathes to PATH ... \n");
-        set_path(argv[2]);
+        // The path is per process: run a command with it.
+        if (set_path(argv[2]) < 0)
+            printf(1, "path too long\n");
+        else if (argc > 3)
+        {
+            exec(argv[3], argv + 3);
+            printf(1, "exec %s failed\n", argv[3]);
+        }
         exit();
     }
 
@@ -124,7 +134,73 @@ int main(int argc, char *argv[])
         exit();
     }
 
-    printf(1, "Error: Bad args \nuse {count 123}/{parent}/{children 2}/{path /:bin:}\n");
+    if (strcmp(argv[1], COMMAND_GANG)  == 0)
+    {
+        int leader = getpid();
+        printf(1, "user: starting gang-scheduled barrier ... \n");
+        set_gang_scheduling(1);
+        set_process_gang(getpid(), 1);  // inherited by the children
+        barrier_init(4);
+        if(fork() != 0){
+            sleep(100);
+        }
+        fork();
+        printf(1, "user: before barrier pid: %d\n", getpid());
+        barrier_wait();
+        printf(1, "user: after barrier pid: %d\n", getpid());
+        wait();
+        wait();
+        if(getpid() == leader)
+            set_gang_scheduling(0);
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_SEM)  == 0)
+    {
+        // Producer/consumer handing off items through two semaphores;
+        // an event tells the consumer when the producer is done.
+        int items = argc == 3 ? atoi(argv[2]) : 5;
+        int full = sem_create(0), empty = sem_create(1), done = event_create();
+        if(full < 0 || empty < 0 || done < 0){
+            printf(1, "user: cannot create semaphores\n");
+            exit();
+        }
+        if(fork() == 0){
+            for(int i = 0; i < items; i++){
+                sync_wait(full);
+                printf(1, "user: consumed %d\n", i);
+                sync_post(empty);
+            }
+            sync_wait(done);
+            printf(1, "user: consumer saw producer finish\n");
+            exit();
+        }
+        for(int i = 0; i < items; i++){
+            sync_wait(empty);
+            printf(1, "user: produced %d\n", i);
+            sync_post(full);
+        }
+        sync_post(done);
+        wait();
+        sync_close(full);
+        sync_close(empty);
+        sync_close(done);
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_VM)  == 0)
+    {
+        print_vm_stats();
+        exit();
+    }
+
+    if (strcmp(argv[1], COMMAND_LOCKS)  == 0)
+    {
+        print_lock_stats();
+        exit();
+    }
+
+    printf(1, "Error: Bad args \nuse {count 123}/{parent}/{children 2}/{path /:bin: cmd}\n");
         exit();
 
 }
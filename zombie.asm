@@ -0,0 +1,2134 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 1a 00 00 00       	call   30 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 3f 04 00 00       	call   463 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 34 00 00 00       	call   60 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <fork>:
+void (*stdioflush)(void);
+
+int
+fork(void)
+{
+  if(stdioflush)
+  30:	a1 80 13 00 00       	mov    0x1380,%eax
+  35:	85 c0                	test   %eax,%eax
+  37:	74 17                	je     50 <fork+0x20>
+{
+  39:	55                   	push   %ebp
+  3a:	89 e5                	mov    %esp,%ebp
+  3c:	83 ec 08             	sub    $0x8,%esp
+    stdioflush();
+  3f:	ff d0                	call   *%eax
+  return _fork();
+}
+  41:	c9                   	leave
+  return _fork();
+  42:	e9 84 03 00 00       	jmp    3cb <_fork>
+  47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4e:	66 90                	xchg   %ax,%ax
+  50:	e9 76 03 00 00       	jmp    3cb <_fork>
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <exit>:
+
+int
+exit(void)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	83 ec 08             	sub    $0x8,%esp
+  if(stdioflush)
+  66:	a1 80 13 00 00       	mov    0x1380,%eax
+  6b:	85 c0                	test   %eax,%eax
+  6d:	74 02                	je     71 <exit+0x11>
+    stdioflush();
+  6f:	ff d0                	call   *%eax
+  _exit();
+  71:	e8 5d 03 00 00       	call   3d3 <_exit>
+  76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000080 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+  80:	55                   	push   %ebp
+  if(stdioflush)
+  81:	a1 80 13 00 00       	mov    0x1380,%eax
+{
+  86:	89 e5                	mov    %esp,%ebp
+  88:	56                   	push   %esi
+  89:	53                   	push   %ebx
+  8a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(stdioflush)
+  90:	85 c0                	test   %eax,%eax
+  92:	74 02                	je     96 <exec+0x16>
+    stdioflush();
+  94:	ff d0                	call   *%eax
+  return _exec(path, argv);
+  96:	89 75 0c             	mov    %esi,0xc(%ebp)
+  99:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+  9c:	5b                   	pop    %ebx
+  9d:	5e                   	pop    %esi
+  9e:	5d                   	pop    %ebp
+  return _exec(path, argv);
+  9f:	e9 67 03 00 00       	jmp    40b <_exec>
+  a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+
+000000b0 <spawn>:
+
+int
+spawn(char *path, char **argv, struct spawn_action *actions)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	57                   	push   %edi
+  b4:	56                   	push   %esi
+  b5:	53                   	push   %ebx
+  b6:	83 ec 0c             	sub    $0xc,%esp
+  if(stdioflush)
+  b9:	a1 80 13 00 00       	mov    0x1380,%eax
+{
+  be:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  c4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(stdioflush)
+  c7:	85 c0                	test   %eax,%eax
+  c9:	74 02                	je     cd <spawn+0x1d>
+    stdioflush();
+  cb:	ff d0                	call   *%eax
+  return _spawn(path, argv, actions);
+  cd:	89 7d 10             	mov    %edi,0x10(%ebp)
+  d0:	89 75 0c             	mov    %esi,0xc(%ebp)
+  d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	5b                   	pop    %ebx
+  da:	5e                   	pop    %esi
+  db:	5f                   	pop    %edi
+  dc:	5d                   	pop    %ebp
+  return _spawn(path, argv, actions);
+  dd:	e9 79 04 00 00       	jmp    55b <_spawn>
+  e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strcpy>:
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+  int size;     // bytes per read, 0 until the first gets
+} in;
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+ 215:	53                   	push   %ebx
+ 216:	83 ec 3c             	sub    $0x3c,%esp
+  struct stat st;
+  int i;
+  char c;
+
+  if(stdioflush)
+ 219:	a1 80 13 00 00       	mov    0x1380,%eax
+{
+ 21e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 221:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(stdioflush)
+ 224:	85 c0                	test   %eax,%eax
+ 226:	74 02                	je     22a <gets+0x1a>
+    stdioflush();
+ 228:	ff d0                	call   *%eax
+  if(in.size == 0)
+ 22a:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ 22f:	85 c0                	test   %eax,%eax
+ 231:	0f 84 99 00 00 00    	je     2d0 <gets+0xc0>
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 237:	31 db                	xor    %ebx,%ebx
+ 239:	eb 21                	jmp    25c <gets+0x4c>
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+      if((in.n = read(0, in.buf, in.size)) < 1){
+        in.n = 0;
+        break;
+      }
+    }
+    c = in.buf[in.r++];
+ 240:	8d 50 01             	lea    0x1(%eax),%edx
+ 243:	0f b6 80 a0 13 00 00 	movzbl 0x13a0(%eax),%eax
+ 24a:	89 15 a0 15 00 00    	mov    %edx,0x15a0
+    buf[i++] = c;
+ 250:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 254:	3c 0a                	cmp    $0xa,%al
+ 256:	74 60                	je     2b8 <gets+0xa8>
+ 258:	3c 0d                	cmp    $0xd,%al
+ 25a:	74 5c                	je     2b8 <gets+0xa8>
+  for(i=0; i+1 < max; ){
+ 25c:	89 da                	mov    %ebx,%edx
+ 25e:	83 c3 01             	add    $0x1,%ebx
+ 261:	39 fb                	cmp    %edi,%ebx
+ 263:	7d 55                	jge    2ba <gets+0xaa>
+    if(in.r == in.n){
+ 265:	a1 a0 15 00 00       	mov    0x15a0,%eax
+ 26a:	3b 05 a4 15 00 00    	cmp    0x15a4,%eax
+ 270:	75 ce                	jne    240 <gets+0x30>
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 272:	83 ec 04             	sub    $0x4,%esp
+ 275:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+      in.r = in.n = 0;
+ 278:	c7 05 a4 15 00 00 00 	movl   $0x0,0x15a4
+ 27f:	00 00 00 
+ 282:	c7 05 a0 15 00 00 00 	movl   $0x0,0x15a0
+ 289:	00 00 00 
+      if((in.n = read(0, in.buf, in.size)) < 1){
+ 28c:	ff 35 a8 15 00 00    	push   0x15a8
+ 292:	68 a0 13 00 00       	push   $0x13a0
+ 297:	6a 00                	push   $0x0
+ 299:	e8 4d 01 00 00       	call   3eb <read>
+ 29e:	83 c4 10             	add    $0x10,%esp
+ 2a1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 2a4:	85 c0                	test   %eax,%eax
+ 2a6:	a3 a4 15 00 00       	mov    %eax,0x15a4
+ 2ab:	7e 56                	jle    303 <gets+0xf3>
+    c = in.buf[in.r++];
+ 2ad:	a1 a0 15 00 00       	mov    0x15a0,%eax
+ 2b2:	eb 8c                	jmp    240 <gets+0x30>
+ 2b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i=0; i+1 < max; ){
+ 2b8:	89 da                	mov    %ebx,%edx
+      break;
+  }
+  buf[i] = '\0';
+ 2ba:	c6 04 16 00          	movb   $0x0,(%esi,%edx,1)
+  return buf;
+}
+ 2be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2c1:	89 f0                	mov    %esi,%eax
+ 2c3:	5b                   	pop    %ebx
+ 2c4:	5e                   	pop    %esi
+ 2c5:	5f                   	pop    %edi
+ 2c6:	5d                   	pop    %ebp
+ 2c7:	c3                   	ret
+ 2c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+    in.size = fstat(0, &st) == 0 && st.type == T_DEV ? sizeof(in.buf) : 1;
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 2d6:	50                   	push   %eax
+ 2d7:	6a 00                	push   $0x0
+ 2d9:	e8 4d 01 00 00       	call   42b <fstat>
+ 2de:	83 c4 10             	add    $0x10,%esp
+ 2e1:	89 c2                	mov    %eax,%edx
+ 2e3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e8:	85 d2                	test   %edx,%edx
+ 2ea:	75 0d                	jne    2f9 <gets+0xe9>
+ 2ec:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 2f1:	ba 00 02 00 00       	mov    $0x200,%edx
+ 2f6:	0f 44 c2             	cmove  %edx,%eax
+ 2f9:	a3 a8 15 00 00       	mov    %eax,0x15a8
+ 2fe:	e9 34 ff ff ff       	jmp    237 <gets+0x27>
+        in.n = 0;
+ 303:	c7 05 a4 15 00 00 00 	movl   $0x0,0x15a4
+ 30a:	00 00 00 
+        break;
+ 30d:	eb ab                	jmp    2ba <gets+0xaa>
+ 30f:	90                   	nop
+
+00000310 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+ 314:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	6a 00                	push   $0x0
+ 31a:	ff 75 08             	push   0x8(%ebp)
+ 31d:	e8 f1 00 00 00       	call   413 <open>
+  if(fd < 0)
+ 322:	83 c4 10             	add    $0x10,%esp
+ 325:	85 c0                	test   %eax,%eax
+ 327:	78 27                	js     350 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 329:	83 ec 08             	sub    $0x8,%esp
+ 32c:	ff 75 0c             	push   0xc(%ebp)
+ 32f:	89 c3                	mov    %eax,%ebx
+ 331:	50                   	push   %eax
+ 332:	e8 f4 00 00 00       	call   42b <fstat>
+  close(fd);
+ 337:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 33a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 33c:	e8 ba 00 00 00       	call   3fb <close>
+  return r;
+ 341:	83 c4 10             	add    $0x10,%esp
+}
+ 344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 347:	89 f0                	mov    %esi,%eax
+ 349:	5b                   	pop    %ebx
+ 34a:	5e                   	pop    %esi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 355:	eb ed                	jmp    344 <stat+0x34>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 367:	0f be 02             	movsbl (%edx),%eax
+ 36a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 36d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 375:	77 1e                	ja     395 <atoi+0x35>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 386:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 38a:	0f be 02             	movsbl (%edx),%eax
+ 38d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 390:	80 fb 09             	cmp    $0x9,%bl
+ 393:	76 eb                	jbe    380 <atoi+0x20>
+  return n;
+}
+ 395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 398:	89 c8                	mov    %ecx,%eax
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	7e 13                	jle    3c5 <memmove+0x25>
+ 3b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3b4:	89 d7                	mov    %edx,%edi
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3c1:	39 f8                	cmp    %edi,%eax
+ 3c3:	75 fb                	jne    3c0 <memmove+0x20>
+  return vdst;
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	89 d0                	mov    %edx,%eax
+ 3c8:	5f                   	pop    %edi
+ 3c9:	5d                   	pop    %ebp
+ 3ca:	c3                   	ret
+
+000003cb <_fork>:
+  _ ## name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+RAWSYSCALL(fork)
+ 3cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <_exit>:
+RAWSYSCALL(exit)
+ 3d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait>:
+SYSCALL(wait)
+ 3db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <pipe>:
+SYSCALL(pipe)
+ 3e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <read>:
+SYSCALL(read)
+ 3eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <write>:
+SYSCALL(write)
+ 3f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <close>:
+SYSCALL(close)
+ 3fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <kill>:
+SYSCALL(kill)
+ 403:	b8 06 00 00 00       	mov    $0x6,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <_exec>:
+RAWSYSCALL(exec)
+ 40b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <open>:
+SYSCALL(open)
+ 413:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mknod>:
+SYSCALL(mknod)
+ 41b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <unlink>:
+SYSCALL(unlink)
+ 423:	b8 12 00 00 00       	mov    $0x12,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <fstat>:
+SYSCALL(fstat)
+ 42b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <link>:
+SYSCALL(link)
+ 433:	b8 13 00 00 00       	mov    $0x13,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mkdir>:
+SYSCALL(mkdir)
+ 43b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <chdir>:
+SYSCALL(chdir)
+ 443:	b8 09 00 00 00       	mov    $0x9,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <dup>:
+SYSCALL(dup)
+ 44b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getpid>:
+SYSCALL(getpid)
+ 453:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <sbrk>:
+SYSCALL(sbrk)
+ 45b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sleep>:
+SYSCALL(sleep)
+ 463:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <uptime>:
+SYSCALL(uptime)
+ 46b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <count_num_of_digits>:
+SYSCALL(count_num_of_digits)
+ 473:	b8 16 00 00 00       	mov    $0x16,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <get_parent_id>:
+SYSCALL(get_parent_id)
+ 47b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <get_children>:
+SYSCALL(get_children)
+ 483:	b8 18 00 00 00       	mov    $0x18,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <set_path>:
+SYSCALL(set_path)
+ 48b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <set_sleep>:
+SYSCALL(set_sleep)
+ 493:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <get_time>:
+SYSCALL(get_time)
+ 49b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <change_process_level>:
+SYSCALL(change_process_level)
+ 4a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <set_process_ticket>:
+SYSCALL(set_process_ticket)
+ 4ab:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <set_process_remaining_priority>:
+SYSCALL(set_process_remaining_priority)
+ 4b3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <print_processes_info>:
+SYSCALL(print_processes_info)
+ 4bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <barrier_init>:
+
+SYSCALL(barrier_init)
+ 4c3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <barrier_wait>:
+SYSCALL(barrier_wait)
+ 4cb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <reentrant_spinlock_test>:
+SYSCALL(reentrant_spinlock_test)
+ 4d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <print_lock_stats>:
+SYSCALL(print_lock_stats)
+ 4db:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <set_process_gang>:
+SYSCALL(set_process_gang)
+ 4e3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <set_gang_scheduling>:
+SYSCALL(set_gang_scheduling)
+ 4eb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sem_create>:
+SYSCALL(sem_create)
+ 4f3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <event_create>:
+SYSCALL(event_create)
+ 4fb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sync_post>:
+SYSCALL(sync_post)
+ 503:	b8 28 00 00 00       	mov    $0x28,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <sync_wait>:
+SYSCALL(sync_wait)
+ 50b:	b8 29 00 00 00       	mov    $0x29,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <sync_close>:
+SYSCALL(sync_close)
+ 513:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <event_reset>:
+SYSCALL(event_reset)
+ 51b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <print_vm_stats>:
+SYSCALL(print_vm_stats)
+ 523:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mmap>:
+SYSCALL(mmap)
+ 52b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <munmap>:
+SYSCALL(munmap)
+ 533:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <shmget>:
+SYSCALL(shmget)
+ 53b:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <shmat>:
+SYSCALL(shmat)
+ 543:	b8 30 00 00 00       	mov    $0x30,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <shmdt>:
+SYSCALL(shmdt)
+ 54b:	b8 31 00 00 00       	mov    $0x31,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <shmrm>:
+SYSCALL(shmrm)
+ 553:	b8 32 00 00 00       	mov    $0x32,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <_spawn>:
+RAWSYSCALL(spawn)
+ 55b:	b8 33 00 00 00       	mov    $0x33,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <memstat>:
+SYSCALL(memstat)
+ 563:	b8 34 00 00 00       	mov    $0x34,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+ 56b:	66 90                	xchg   %ax,%ax
+ 56d:	66 90                	xchg   %ax,%ax
+ 56f:	90                   	nop
+
+00000570 <flushout>:
+  b->n = 0;
+}
+
+static void
+flushout(void)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	83 ec 08             	sub    $0x8,%esp
+  if(b->n > 0)
+ 576:	a1 e8 17 00 00       	mov    0x17e8,%eax
+ 57b:	85 c0                	test   %eax,%eax
+ 57d:	7e 17                	jle    596 <flushout+0x26>
+    write(b->fd, b->buf, b->n);
+ 57f:	83 ec 04             	sub    $0x4,%esp
+ 582:	50                   	push   %eax
+ 583:	68 ec 17 00 00       	push   $0x17ec
+ 588:	ff 35 e0 17 00 00    	push   0x17e0
+ 58e:	e8 60 fe ff ff       	call   3f3 <write>
+ 593:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 596:	c7 05 e8 17 00 00 00 	movl   $0x0,0x17e8
+ 59d:	00 00 00 
+  bflush(&out);
+  out.mode = 0;
+ 5a0:	c7 05 e4 17 00 00 00 	movl   $0x0,0x17e4
+ 5a7:	00 00 00 
+}
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <printint>:
+    bflush(b);
+}
+
+static void
+printint(struct obuf *b, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	89 cf                	mov    %ecx,%edi
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b6:	89 d1                	mov    %edx,%ecx
+{
+ 5b8:	56                   	push   %esi
+ 5b9:	53                   	push   %ebx
+ 5ba:	89 c3                	mov    %eax,%ebx
+ 5bc:	83 ec 2c             	sub    $0x2c,%esp
+  if(sgn && xx < 0){
+ 5bf:	85 d2                	test   %edx,%edx
+ 5c1:	0f 89 b9 00 00 00    	jns    680 <printint+0xd0>
+ 5c7:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cb:	0f 84 af 00 00 00    	je     680 <printint+0xd0>
+    x = -xx;
+ 5d1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 5db:	31 f6                	xor    %esi,%esi
+ 5dd:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f3                	mov    %esi,%ebx
+ 5e6:	f7 f7                	div    %edi
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 54 0f 00 00 	movzbl 0xf54(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 fa                	cmp    %edi,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 601:	89 d9                	mov    %ebx,%ecx
+ 603:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 606:	85 c0                	test   %eax,%eax
+ 608:	74 07                	je     611 <printint+0x61>
+    buf[i++] = '-';
+ 60a:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60f:	89 f1                	mov    %esi,%ecx
+ 611:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 614:	89 cf                	mov    %ecx,%edi
+    write(b->fd, b->buf, b->n);
+ 616:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 619:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 61c:	01 f7                	add    %esi,%edi
+ 61e:	eb 09                	jmp    629 <printint+0x79>
+
+  while(--i >= 0)
+ 620:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 623:	39 f7                	cmp    %esi,%edi
+ 625:	74 36                	je     65d <printint+0xad>
+ 627:	89 c7                	mov    %eax,%edi
+  b->buf[b->n++] = c;
+ 629:	8b 53 08             	mov    0x8(%ebx),%edx
+    putc(b, buf[i]);
+ 62c:	0f b6 0f             	movzbl (%edi),%ecx
+  b->buf[b->n++] = c;
+ 62f:	8d 42 01             	lea    0x1(%edx),%eax
+ 632:	89 43 08             	mov    %eax,0x8(%ebx)
+ 635:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 639:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 63e:	74 28                	je     668 <printint+0xb8>
+ 640:	80 f9 0a             	cmp    $0xa,%cl
+ 643:	75 db                	jne    620 <printint+0x70>
+ 645:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 649:	75 d5                	jne    620 <printint+0x70>
+  if(b->n > 0)
+ 64b:	85 c0                	test   %eax,%eax
+ 64d:	7f 19                	jg     668 <printint+0xb8>
+  b->n = 0;
+ 64f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  while(--i >= 0)
+ 656:	8d 47 ff             	lea    -0x1(%edi),%eax
+ 659:	39 f7                	cmp    %esi,%edi
+ 65b:	75 ca                	jne    627 <printint+0x77>
+}
+ 65d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 660:	5b                   	pop    %ebx
+ 661:	5e                   	pop    %esi
+ 662:	5f                   	pop    %edi
+ 663:	5d                   	pop    %ebp
+ 664:	c3                   	ret
+ 665:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 668:	83 ec 04             	sub    $0x4,%esp
+ 66b:	50                   	push   %eax
+ 66c:	ff 75 d4             	push   -0x2c(%ebp)
+ 66f:	ff 33                	push   (%ebx)
+ 671:	e8 7d fd ff ff       	call   3f3 <write>
+ 676:	83 c4 10             	add    $0x10,%esp
+ 679:	eb d4                	jmp    64f <printint+0x9f>
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  neg = 0;
+ 680:	31 c0                	xor    %eax,%eax
+ 682:	e9 51 ff ff ff       	jmp    5d8 <printint+0x28>
+ 687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <putc>:
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	53                   	push   %ebx
+ 694:	89 c3                	mov    %eax,%ebx
+ 696:	83 ec 04             	sub    $0x4,%esp
+  b->buf[b->n++] = c;
+ 699:	8b 48 08             	mov    0x8(%eax),%ecx
+ 69c:	8d 41 01             	lea    0x1(%ecx),%eax
+ 69f:	89 43 08             	mov    %eax,0x8(%ebx)
+ 6a2:	88 54 0b 0c          	mov    %dl,0xc(%ebx,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6a6:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 6ab:	74 33                	je     6e0 <putc+0x50>
+ 6ad:	80 fa 0a             	cmp    $0xa,%dl
+ 6b0:	74 0e                	je     6c0 <putc+0x30>
+}
+ 6b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6b5:	c9                   	leave
+ 6b6:	c3                   	ret
+ 6b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6be:	66 90                	xchg   %ax,%ax
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 6c0:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+ 6c4:	75 ec                	jne    6b2 <putc+0x22>
+  if(b->n > 0)
+ 6c6:	85 c0                	test   %eax,%eax
+ 6c8:	7f 16                	jg     6e0 <putc+0x50>
+  b->n = 0;
+ 6ca:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 6d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6d4:	c9                   	leave
+ 6d5:	c3                   	ret
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	50                   	push   %eax
+ 6e4:	8d 43 0c             	lea    0xc(%ebx),%eax
+ 6e7:	50                   	push   %eax
+ 6e8:	ff 33                	push   (%ebx)
+ 6ea:	e8 04 fd ff ff       	call   3f3 <write>
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	eb d6                	jmp    6ca <putc+0x3a>
+ 6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+
+00000700 <fflush>:
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	83 ec 08             	sub    $0x8,%esp
+  if(fd == 1)
+ 706:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 70a:	74 04                	je     710 <fflush+0x10>
+}
+ 70c:	c9                   	leave
+ 70d:	c3                   	ret
+ 70e:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 710:	a1 e8 17 00 00       	mov    0x17e8,%eax
+ 715:	85 c0                	test   %eax,%eax
+ 717:	7f 17                	jg     730 <fflush+0x30>
+  b->n = 0;
+ 719:	c7 05 e8 17 00 00 00 	movl   $0x0,0x17e8
+ 720:	00 00 00 
+  out.mode = 0;
+ 723:	c7 05 e4 17 00 00 00 	movl   $0x0,0x17e4
+ 72a:	00 00 00 
+}
+ 72d:	c9                   	leave
+ 72e:	c3                   	ret
+ 72f:	90                   	nop
+    write(b->fd, b->buf, b->n);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	50                   	push   %eax
+ 734:	68 ec 17 00 00       	push   $0x17ec
+ 739:	ff 35 e0 17 00 00    	push   0x17e0
+ 73f:	e8 af fc ff ff       	call   3f3 <write>
+ 744:	83 c4 10             	add    $0x10,%esp
+ 747:	eb d0                	jmp    719 <fflush+0x19>
+ 749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 3c             	sub    $0x3c,%esp
+ 759:	8b 75 08             	mov    0x8(%ebp),%esi
+    b->fd = fd;
+  }
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 75c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(fd == 1){
+ 75f:	83 fe 01             	cmp    $0x1,%esi
+ 762:	0f 84 60 01 00 00    	je     8c8 <printf+0x178>
+    b->fd = fd;
+ 768:	89 35 c0 15 00 00    	mov    %esi,0x15c0
+  for(i = 0; fmt[i]; i++){
+ 76e:	0f b6 03             	movzbl (%ebx),%eax
+    b = &other;
+ 771:	bf c0 15 00 00       	mov    $0x15c0,%edi
+  for(i = 0; fmt[i]; i++){
+ 776:	84 c0                	test   %al,%al
+ 778:	74 65                	je     7df <printf+0x8f>
+  ap = (uint*)(void*)&fmt + 1;
+ 77a:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 77d:	83 c3 01             	add    $0x1,%ebx
+  state = 0;
+ 780:	31 f6                	xor    %esi,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 782:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+ 785:	eb 1f                	jmp    7a6 <printf+0x56>
+ 787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78e:	66 90                	xchg   %ax,%ax
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+ 790:	83 f8 25             	cmp    $0x25,%eax
+ 793:	74 3b                	je     7d0 <printf+0x80>
+        state = '%';
+      } else {
+        putc(b, c);
+ 795:	89 f8                	mov    %edi,%eax
+ 797:	e8 f4 fe ff ff       	call   690 <putc>
+  for(i = 0; fmt[i]; i++){
+ 79c:	0f b6 03             	movzbl (%ebx),%eax
+ 79f:	83 c3 01             	add    $0x1,%ebx
+ 7a2:	84 c0                	test   %al,%al
+ 7a4:	74 39                	je     7df <printf+0x8f>
+    c = fmt[i] & 0xff;
+ 7a6:	0f be d0             	movsbl %al,%edx
+ 7a9:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+ 7ac:	85 f6                	test   %esi,%esi
+ 7ae:	74 e0                	je     790 <printf+0x40>
+      }
+    } else if(state == '%'){
+ 7b0:	83 fe 25             	cmp    $0x25,%esi
+ 7b3:	75 e7                	jne    79c <printf+0x4c>
+      if(c == 'd'){
+ 7b5:	83 f8 25             	cmp    $0x25,%eax
+ 7b8:	74 57                	je     811 <printf+0xc1>
+ 7ba:	83 e8 63             	sub    $0x63,%eax
+ 7bd:	83 f8 15             	cmp    $0x15,%eax
+ 7c0:	77 36                	ja     7f8 <printf+0xa8>
+ 7c2:	ff 24 85 fc 0e 00 00 	jmp    *0xefc(,%eax,4)
+ 7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; fmt[i]; i++){
+ 7d0:	0f b6 03             	movzbl (%ebx),%eax
+ 7d3:	83 c3 01             	add    $0x1,%ebx
+        state = '%';
+ 7d6:	be 25 00 00 00       	mov    $0x25,%esi
+  for(i = 0; fmt[i]; i++){
+ 7db:	84 c0                	test   %al,%al
+ 7dd:	75 c7                	jne    7a6 <printf+0x56>
+        putc(b, c);
+      }
+      state = 0;
+    }
+  }
+  if(b->mode == 0)
+ 7df:	8b 47 04             	mov    0x4(%edi),%eax
+ 7e2:	85 c0                	test   %eax,%eax
+ 7e4:	0f 84 06 01 00 00    	je     8f0 <printf+0x1a0>
+    bflush(b);
+}
+ 7ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ed:	5b                   	pop    %ebx
+ 7ee:	5e                   	pop    %esi
+ 7ef:	5f                   	pop    %edi
+ 7f0:	5d                   	pop    %ebp
+ 7f1:	c3                   	ret
+ 7f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  b->buf[b->n++] = c;
+ 7f8:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 7fb:	8d 41 01             	lea    0x1(%ecx),%eax
+ 7fe:	89 47 08             	mov    %eax,0x8(%edi)
+ 801:	c6 44 0f 0c 25       	movb   $0x25,0xc(%edi,%ecx,1)
+  if(b->n == OBUFSIZE || (c == '\n' && b->mode == LINEBUF))
+ 806:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 80b:	0f 84 77 01 00 00    	je     988 <printf+0x238>
+        putc(b, c);
+ 811:	89 f8                	mov    %edi,%eax
+      state = 0;
+ 813:	31 f6                	xor    %esi,%esi
+        putc(b, c);
+ 815:	e8 76 fe ff ff       	call   690 <putc>
+ 81a:	eb 80                	jmp    79c <printf+0x4c>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printint(b, *ap, 16, 0);
+ 820:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 82b:	8b 16                	mov    (%esi),%edx
+ 82d:	6a 00                	push   $0x0
+        ap++;
+ 82f:	83 c6 04             	add    $0x4,%esi
+        printint(b, *ap, 16, 0);
+ 832:	89 f8                	mov    %edi,%eax
+ 834:	e8 77 fd ff ff       	call   5b0 <printint>
+        ap++;
+ 839:	89 75 c0             	mov    %esi,-0x40(%ebp)
+ 83c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83f:	31 f6                	xor    %esi,%esi
+ 841:	e9 56 ff ff ff       	jmp    79c <printf+0x4c>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 850:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 853:	8b 08                	mov    (%eax),%ecx
+        ap++;
+ 855:	83 c0 04             	add    $0x4,%eax
+ 858:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        if(s == 0)
+ 85b:	85 c9                	test   %ecx,%ecx
+ 85d:	0f 84 cd 00 00 00    	je     930 <printf+0x1e0>
+        while(*s != 0){
+ 863:	0f be 11             	movsbl (%ecx),%edx
+      state = 0;
+ 866:	31 f6                	xor    %esi,%esi
+        while(*s != 0){
+ 868:	84 d2                	test   %dl,%dl
+ 86a:	0f 84 2c ff ff ff    	je     79c <printf+0x4c>
+          putc(b, *s);
+ 870:	89 f8                	mov    %edi,%eax
+ 872:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+ 875:	e8 16 fe ff ff       	call   690 <putc>
+          s++;
+ 87a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+        while(*s != 0){
+ 87d:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+          s++;
+ 881:	83 c1 01             	add    $0x1,%ecx
+        while(*s != 0){
+ 884:	84 d2                	test   %dl,%dl
+ 886:	75 e8                	jne    870 <printf+0x120>
+      state = 0;
+ 888:	31 f6                	xor    %esi,%esi
+ 88a:	e9 0d ff ff ff       	jmp    79c <printf+0x4c>
+ 88f:	90                   	nop
+        printint(b, *ap, 10, 1);
+ 890:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 89b:	8b 16                	mov    (%esi),%edx
+ 89d:	6a 01                	push   $0x1
+ 89f:	eb 8e                	jmp    82f <printf+0xdf>
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        putc(b, *ap);
+ 8a8:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8ab:	89 f8                	mov    %edi,%eax
+ 8ad:	0f be 16             	movsbl (%esi),%edx
+        ap++;
+ 8b0:	83 c6 04             	add    $0x4,%esi
+        putc(b, *ap);
+ 8b3:	e8 d8 fd ff ff       	call   690 <putc>
+        ap++;
+ 8b8:	89 75 c0             	mov    %esi,-0x40(%ebp)
+      state = 0;
+ 8bb:	31 f6                	xor    %esi,%esi
+ 8bd:	e9 da fe ff ff       	jmp    79c <printf+0x4c>
+ 8c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(b->mode == 0){
+ 8c8:	8b 15 e4 17 00 00    	mov    0x17e4,%edx
+ 8ce:	85 d2                	test   %edx,%edx
+ 8d0:	74 6e                	je     940 <printf+0x1f0>
+  for(i = 0; fmt[i]; i++){
+ 8d2:	0f b6 03             	movzbl (%ebx),%eax
+ 8d5:	bf e0 17 00 00       	mov    $0x17e0,%edi
+ 8da:	84 c0                	test   %al,%al
+ 8dc:	0f 85 98 fe ff ff    	jne    77a <printf+0x2a>
+ 8e2:	e9 03 ff ff ff       	jmp    7ea <printf+0x9a>
+ 8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ee:	66 90                	xchg   %ax,%ax
+  if(b->n > 0)
+ 8f0:	8b 47 08             	mov    0x8(%edi),%eax
+ 8f3:	85 c0                	test   %eax,%eax
+ 8f5:	7f 19                	jg     910 <printf+0x1c0>
+  b->n = 0;
+ 8f7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 8fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 901:	5b                   	pop    %ebx
+ 902:	5e                   	pop    %esi
+ 903:	5f                   	pop    %edi
+ 904:	5d                   	pop    %ebp
+ 905:	c3                   	ret
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+    write(b->fd, b->buf, b->n);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	50                   	push   %eax
+ 914:	8d 47 0c             	lea    0xc(%edi),%eax
+ 917:	50                   	push   %eax
+ 918:	ff 37                	push   (%edi)
+ 91a:	e8 d4 fa ff ff       	call   3f3 <write>
+  b->n = 0;
+ 91f:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+    write(b->fd, b->buf, b->n);
+ 926:	83 c4 10             	add    $0x10,%esp
+  b->n = 0;
+ 929:	eb d3                	jmp    8fe <printf+0x1ae>
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+ 930:	ba 28 00 00 00       	mov    $0x28,%edx
+          s = "(null)";
+ 935:	b9 f4 0e 00 00       	mov    $0xef4,%ecx
+ 93a:	e9 31 ff ff ff       	jmp    870 <printf+0x120>
+ 93f:	90                   	nop
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 940:	83 ec 08             	sub    $0x8,%esp
+ 943:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      b->fd = 1;
+ 946:	c7 05 e0 17 00 00 01 	movl   $0x1,0x17e0
+ 94d:	00 00 00 
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 950:	50                   	push   %eax
+ 951:	6a 01                	push   $0x1
+ 953:	e8 d3 fa ff ff       	call   42b <fstat>
+ 958:	83 c4 10             	add    $0x10,%esp
+ 95b:	85 c0                	test   %eax,%eax
+ 95d:	75 22                	jne    981 <printf+0x231>
+ 95f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 964:	b8 02 00 00 00       	mov    $0x2,%eax
+ 969:	0f 45 f0             	cmovne %eax,%esi
+ 96c:	89 35 e4 17 00 00    	mov    %esi,0x17e4
+      stdioflush = flushout;
+ 972:	c7 05 80 13 00 00 70 	movl   $0x570,0x1380
+ 979:	05 00 00 
+ 97c:	e9 51 ff ff ff       	jmp    8d2 <printf+0x182>
+      b->mode = fstat(1, &st) == 0 && st.type == T_DEV ? LINEBUF : FULLBUF;
+ 981:	be 02 00 00 00       	mov    $0x2,%esi
+ 986:	eb e4                	jmp    96c <printf+0x21c>
+    write(b->fd, b->buf, b->n);
+ 988:	83 ec 04             	sub    $0x4,%esp
+ 98b:	8d 47 0c             	lea    0xc(%edi),%eax
+ 98e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 991:	68 00 02 00 00       	push   $0x200
+ 996:	50                   	push   %eax
+ 997:	ff 37                	push   (%edi)
+ 999:	e8 55 fa ff ff       	call   3f3 <write>
+  b->n = 0;
+ 99e:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+}
+ 9a5:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 9a8:	83 c4 10             	add    $0x10,%esp
+ 9ab:	e9 61 fe ff ff       	jmp    811 <printf+0xc1>
+
+000009b0 <freepages>:
+
+// Give back a run of heap pages, merging it with its free
+// neighbours, and shrink the heap if it ends up at the top.
+static void
+freepages(struct upage *s)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	56                   	push   %esi
+ 9b4:	53                   	push   %ebx
+ 9b5:	89 c3                	mov    %eax,%ebx
+  struct upage *p, *prevp;
+
+  prevp = 0;
+  for(p = runs; p && p < s; p = p->next)
+ 9b7:	a1 00 1a 00 00       	mov    0x1a00,%eax
+ 9bc:	39 d8                	cmp    %ebx,%eax
+ 9be:	0f 83 e4 00 00 00    	jae    aa8 <freepages+0xf8>
+ 9c4:	85 c0                	test   %eax,%eax
+ 9c6:	0f 84 dc 00 00 00    	je     aa8 <freepages+0xf8>
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9d0:	89 c2                	mov    %eax,%edx
+ 9d2:	8b 00                	mov    (%eax),%eax
+ 9d4:	85 c0                	test   %eax,%eax
+ 9d6:	74 04                	je     9dc <freepages+0x2c>
+ 9d8:	39 d8                	cmp    %ebx,%eax
+ 9da:	72 f4                	jb     9d0 <freepages+0x20>
+    prevp = p;
+  s->prev = prevp;
+ 9dc:	89 53 04             	mov    %edx,0x4(%ebx)
+  s->next = p;
+ 9df:	89 03                	mov    %eax,(%ebx)
+  if(prevp)
+    prevp->next = s;
+ 9e1:	89 1a                	mov    %ebx,(%edx)
+  else
+    runs = s;
+  if(p)
+ 9e3:	85 c0                	test   %eax,%eax
+ 9e5:	74 15                	je     9fc <freepages+0x4c>
+    p->prev = s;
+ 9e7:	89 58 04             	mov    %ebx,0x4(%eax)
+
+  if(p && RUNEND(s) == (char*)p){
+ 9ea:	8b 73 10             	mov    0x10(%ebx),%esi
+ 9ed:	89 f1                	mov    %esi,%ecx
+ 9ef:	c1 e1 0c             	shl    $0xc,%ecx
+ 9f2:	01 d9                	add    %ebx,%ecx
+ 9f4:	39 c8                	cmp    %ecx,%eax
+ 9f6:	0f 84 d8 00 00 00    	je     ad4 <freepages+0x124>
+    s->npages += p->npages;
+    delist(&runs, p);
+  }
+  if(prevp && RUNEND(prevp) == (char*)s){
+ 9fc:	8b 4a 10             	mov    0x10(%edx),%ecx
+ 9ff:	89 c8                	mov    %ecx,%eax
+ a01:	c1 e0 0c             	shl    $0xc,%eax
+ a04:	01 d0                	add    %edx,%eax
+ a06:	39 c3                	cmp    %eax,%ebx
+ a08:	74 16                	je     a20 <freepages+0x70>
+    prevp->npages += s->npages;
+    delist(&runs, s);
+    s = prevp;
+  }
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a0a:	8b 03                	mov    (%ebx),%eax
+ a0c:	85 c0                	test   %eax,%eax
+ a0e:	74 40                	je     a50 <freepages+0xa0>
+    delist(&runs, s);
+    sbrk(-(int)(s->npages * PGSIZE));
+  }
+}
+ a10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ a13:	5b                   	pop    %ebx
+ a14:	5e                   	pop    %esi
+ a15:	5d                   	pop    %ebp
+ a16:	c3                   	ret
+ a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1e:	66 90                	xchg   %ax,%ax
+    prevp->npages += s->npages;
+ a20:	03 4b 10             	add    0x10(%ebx),%ecx
+ a23:	89 4a 10             	mov    %ecx,0x10(%edx)
+  if(s->prev)
+ a26:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    s->prev->next = s->next;
+ a29:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ a2b:	85 c9                	test   %ecx,%ecx
+ a2d:	0f 84 dd 00 00 00    	je     b10 <freepages+0x160>
+    s->prev->next = s->next;
+ a33:	89 01                	mov    %eax,(%ecx)
+  if(s->next)
+ a35:	85 c0                	test   %eax,%eax
+ a37:	74 06                	je     a3f <freepages+0x8f>
+    s->next->prev = s->prev;
+ a39:	8b 4b 04             	mov    0x4(%ebx),%ecx
+ a3c:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(s->next == 0 && s->npages >= TRIMPAGES && RUNEND(s) == sbrk(0)){
+ a3f:	8b 02                	mov    (%edx),%eax
+ a41:	89 d3                	mov    %edx,%ebx
+ a43:	85 c0                	test   %eax,%eax
+ a45:	75 c9                	jne    a10 <freepages+0x60>
+ a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4e:	66 90                	xchg   %ax,%ax
+ a50:	8b 43 10             	mov    0x10(%ebx),%eax
+ a53:	83 f8 0f             	cmp    $0xf,%eax
+ a56:	76 b8                	jbe    a10 <freepages+0x60>
+ a58:	83 ec 0c             	sub    $0xc,%esp
+ a5b:	c1 e0 0c             	shl    $0xc,%eax
+ a5e:	6a 00                	push   $0x0
+ a60:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ a63:	e8 f3 f9 ff ff       	call   45b <sbrk>
+ a68:	83 c4 10             	add    $0x10,%esp
+ a6b:	39 c6                	cmp    %eax,%esi
+ a6d:	75 a1                	jne    a10 <freepages+0x60>
+  if(s->prev)
+ a6f:	8b 53 04             	mov    0x4(%ebx),%edx
+    s->prev->next = s->next;
+ a72:	8b 03                	mov    (%ebx),%eax
+  if(s->prev)
+ a74:	85 d2                	test   %edx,%edx
+ a76:	0f 84 a5 00 00 00    	je     b21 <freepages+0x171>
+    s->prev->next = s->next;
+ a7c:	89 02                	mov    %eax,(%edx)
+  if(s->next)
+ a7e:	85 c0                	test   %eax,%eax
+ a80:	74 06                	je     a88 <freepages+0xd8>
+    s->next->prev = s->prev;
+ a82:	8b 53 04             	mov    0x4(%ebx),%edx
+ a85:	89 50 04             	mov    %edx,0x4(%eax)
+    sbrk(-(int)(s->npages * PGSIZE));
+ a88:	8b 43 10             	mov    0x10(%ebx),%eax
+ a8b:	83 ec 0c             	sub    $0xc,%esp
+ a8e:	c1 e0 0c             	shl    $0xc,%eax
+ a91:	f7 d8                	neg    %eax
+ a93:	50                   	push   %eax
+ a94:	e8 c2 f9 ff ff       	call   45b <sbrk>
+ a99:	83 c4 10             	add    $0x10,%esp
+}
+ a9c:	e9 6f ff ff ff       	jmp    a10 <freepages+0x60>
+ aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  s->prev = prevp;
+ aa8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = p;
+ aaf:	89 03                	mov    %eax,(%ebx)
+    runs = s;
+ ab1:	89 1d 00 1a 00 00    	mov    %ebx,0x1a00
+  if(p)
+ ab7:	85 c0                	test   %eax,%eax
+ ab9:	74 95                	je     a50 <freepages+0xa0>
+    p->prev = s;
+ abb:	89 58 04             	mov    %ebx,0x4(%eax)
+  if(p && RUNEND(s) == (char*)p){
+ abe:	8b 73 10             	mov    0x10(%ebx),%esi
+ ac1:	89 f2                	mov    %esi,%edx
+ ac3:	c1 e2 0c             	shl    $0xc,%edx
+ ac6:	01 da                	add    %ebx,%edx
+ ac8:	39 d0                	cmp    %edx,%eax
+ aca:	0f 85 3a ff ff ff    	jne    a0a <freepages+0x5a>
+ ad0:	89 c1                	mov    %eax,%ecx
+ ad2:	31 d2                	xor    %edx,%edx
+    s->npages += p->npages;
+ ad4:	8b 41 10             	mov    0x10(%ecx),%eax
+ ad7:	01 f0                	add    %esi,%eax
+ ad9:	89 43 10             	mov    %eax,0x10(%ebx)
+  if(s->prev)
+ adc:	8b 71 04             	mov    0x4(%ecx),%esi
+    s->prev->next = s->next;
+ adf:	8b 01                	mov    (%ecx),%eax
+  if(s->prev)
+ ae1:	85 f6                	test   %esi,%esi
+ ae3:	74 35                	je     b1a <freepages+0x16a>
+    s->prev->next = s->next;
+ ae5:	89 06                	mov    %eax,(%esi)
+  if(s->next)
+ ae7:	85 c0                	test   %eax,%eax
+ ae9:	74 06                	je     af1 <freepages+0x141>
+    s->next->prev = s->prev;
+ aeb:	8b 49 04             	mov    0x4(%ecx),%ecx
+ aee:	89 48 04             	mov    %ecx,0x4(%eax)
+  if(prevp && RUNEND(prevp) == (char*)s){
+ af1:	85 d2                	test   %edx,%edx
+ af3:	0f 84 11 ff ff ff    	je     a0a <freepages+0x5a>
+ af9:	8b 4a 10             	mov    0x10(%edx),%ecx
+ afc:	89 c8                	mov    %ecx,%eax
+ afe:	c1 e0 0c             	shl    $0xc,%eax
+ b01:	01 d0                	add    %edx,%eax
+ b03:	39 c3                	cmp    %eax,%ebx
+ b05:	0f 85 ff fe ff ff    	jne    a0a <freepages+0x5a>
+ b0b:	e9 10 ff ff ff       	jmp    a20 <freepages+0x70>
+    *l = s->next;
+ b10:	a3 00 1a 00 00       	mov    %eax,0x1a00
+ b15:	e9 1b ff ff ff       	jmp    a35 <freepages+0x85>
+ b1a:	a3 00 1a 00 00       	mov    %eax,0x1a00
+ b1f:	eb c6                	jmp    ae7 <freepages+0x137>
+ b21:	a3 00 1a 00 00       	mov    %eax,0x1a00
+ b26:	e9 53 ff ff ff       	jmp    a7e <freepages+0xce>
+ b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+
+00000b30 <getpages>:
+// Return a run of n heap pages, from the free runs if one is
+// big enough and otherwise by growing the heap. Returns 0 if
+// the heap cannot grow.
+static struct upage*
+getpages(uint n)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	56                   	push   %esi
+ b34:	53                   	push   %ebx
+ b35:	89 c3                	mov    %eax,%ebx
+  struct upage *s, *rest;
+  uint brk, pad;
+  char *p;
+
+  for(s = runs; s; s = s->next){
+ b37:	a1 00 1a 00 00       	mov    0x1a00,%eax
+ b3c:	85 c0                	test   %eax,%eax
+ b3e:	74 5e                	je     b9e <getpages+0x6e>
+    if(s->npages < n)
+ b40:	8b 50 10             	mov    0x10(%eax),%edx
+ b43:	39 da                	cmp    %ebx,%edx
+ b45:	72 51                	jb     b98 <getpages+0x68>
+      continue;
+    // Use the bottom of the run, so that free pages
+    // gather at the top of the heap.
+    if(s->npages > n){
+ b47:	39 d3                	cmp    %edx,%ebx
+ b49:	72 25                	jb     b70 <getpages+0x40>
+  if(s->prev)
+ b4b:	8b 48 04             	mov    0x4(%eax),%ecx
+  for(s = runs; s; s = s->next){
+ b4e:	8b 10                	mov    (%eax),%edx
+  if(s->prev)
+ b50:	85 c9                	test   %ecx,%ecx
+ b52:	0f 84 a8 00 00 00    	je     c00 <getpages+0xd0>
+    s->prev->next = s->next;
+ b58:	89 11                	mov    %edx,(%ecx)
+  if(s->next)
+ b5a:	85 d2                	test   %edx,%edx
+ b5c:	74 06                	je     b64 <getpages+0x34>
+    s->next->prev = s->prev;
+ b5e:	8b 48 04             	mov    0x4(%eax),%ecx
+ b61:	89 4a 04             	mov    %ecx,0x4(%edx)
+  if(n > (0x80000000 - pad) / PGSIZE)
+    return 0;
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+    return 0;
+  s = (struct upage*)(p + pad);
+  s->npages = n;
+ b64:	89 58 10             	mov    %ebx,0x10(%eax)
+  return s;
+}
+ b67:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b6a:	5b                   	pop    %ebx
+ b6b:	5e                   	pop    %esi
+ b6c:	5d                   	pop    %ebp
+ b6d:	c3                   	ret
+ b6e:	66 90                	xchg   %ax,%ax
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ b70:	89 d9                	mov    %ebx,%ecx
+      rest->npages = s->npages - n;
+ b72:	29 da                	sub    %ebx,%edx
+      rest = (struct upage*)((char*)s + n * PGSIZE);
+ b74:	c1 e1 0c             	shl    $0xc,%ecx
+ b77:	01 c1                	add    %eax,%ecx
+      rest->npages = s->npages - n;
+ b79:	89 51 10             	mov    %edx,0x10(%ecx)
+      rest->prev = s->prev;
+ b7c:	8b 70 04             	mov    0x4(%eax),%esi
+ b7f:	89 71 04             	mov    %esi,0x4(%ecx)
+      rest->next = s->next;
+ b82:	8b 10                	mov    (%eax),%edx
+ b84:	89 11                	mov    %edx,(%ecx)
+      if(rest->prev)
+ b86:	85 f6                	test   %esi,%esi
+ b88:	74 66                	je     bf0 <getpages+0xc0>
+        rest->prev->next = rest;
+ b8a:	89 0e                	mov    %ecx,(%esi)
+      if(rest->next)
+ b8c:	8b 11                	mov    (%ecx),%edx
+ b8e:	85 d2                	test   %edx,%edx
+ b90:	75 cf                	jne    b61 <getpages+0x31>
+ b92:	eb d0                	jmp    b64 <getpages+0x34>
+ b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(s = runs; s; s = s->next){
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	85 c0                	test   %eax,%eax
+ b9c:	75 a2                	jne    b40 <getpages+0x10>
+  brk = (uint)sbrk(0);
+ b9e:	83 ec 0c             	sub    $0xc,%esp
+ ba1:	6a 00                	push   $0x0
+ ba3:	e8 b3 f8 ff ff       	call   45b <sbrk>
+  if(n > (0x80000000 - pad) / PGSIZE)
+ ba8:	83 c4 10             	add    $0x10,%esp
+  pad = PGROUNDUP(brk) - brk;
+ bab:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  brk = (uint)sbrk(0);
+ bb1:	89 c1                	mov    %eax,%ecx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bb3:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+  pad = PGROUNDUP(brk) - brk;
+ bb9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if(n > (0x80000000 - pad) / PGSIZE)
+ bbf:	29 d0                	sub    %edx,%eax
+ bc1:	c1 e8 0c             	shr    $0xc,%eax
+ bc4:	39 d8                	cmp    %ebx,%eax
+ bc6:	72 48                	jb     c10 <getpages+0xe0>
+  pad = PGROUNDUP(brk) - brk;
+ bc8:	89 d6                	mov    %edx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ bca:	89 d8                	mov    %ebx,%eax
+ bcc:	83 ec 0c             	sub    $0xc,%esp
+  pad = PGROUNDUP(brk) - brk;
+ bcf:	29 ce                	sub    %ecx,%esi
+  if((p = sbrk(pad + n * PGSIZE)) == (char*)-1)
+ bd1:	c1 e0 0c             	shl    $0xc,%eax
+ bd4:	01 f0                	add    %esi,%eax
+ bd6:	50                   	push   %eax
+ bd7:	e8 7f f8 ff ff       	call   45b <sbrk>
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ be2:	74 2c                	je     c10 <getpages+0xe0>
+  s = (struct upage*)(p + pad);
+ be4:	01 f0                	add    %esi,%eax
+ be6:	e9 79 ff ff ff       	jmp    b64 <getpages+0x34>
+ beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+        runs = rest;
+ bf0:	89 0d 00 1a 00 00    	mov    %ecx,0x1a00
+ bf6:	eb 96                	jmp    b8e <getpages+0x5e>
+ bf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bff:	90                   	nop
+    *l = s->next;
+ c00:	89 15 00 1a 00 00    	mov    %edx,0x1a00
+ c06:	e9 4f ff ff ff       	jmp    b5a <getpages+0x2a>
+ c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c0f:	90                   	nop
+    return 0;
+ c10:	31 c0                	xor    %eax,%eax
+ c12:	e9 50 ff ff ff       	jmp    b67 <getpages+0x37>
+ c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1e:	66 90                	xchg   %ax,%ax
+
+00000c20 <free>:
+  }
+}
+
+void
+free(void *ap)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+ c26:	83 ec 1c             	sub    $0x1c,%esp
+ c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct upage *s;
+
+  if(ap == 0)
+ c2c:	85 c0                	test   %eax,%eax
+ c2e:	0f 84 97 00 00 00    	je     ccb <free+0xab>
+    return;
+  s = (struct upage*)PGROUNDDOWN((uint)ap);
+ c34:	89 c3                	mov    %eax,%ebx
+ c36:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if(s->shift == MAPRUN)
+ c3c:	8b 73 14             	mov    0x14(%ebx),%esi
+ c3f:	83 fe 01             	cmp    $0x1,%esi
+ c42:	74 74                	je     cb8 <free+0x98>
+    munmap(s, s->npages * PGSIZE);
+  else if(s->shift == HEAPRUN)
+ c44:	85 f6                	test   %esi,%esi
+ c46:	74 5d                	je     ca5 <free+0x85>
+  if(s->free == 0)
+ c48:	8b 53 08             	mov    0x8(%ebx),%edx
+ c4b:	85 d2                	test   %edx,%edx
+ c4d:	0f 84 85 00 00 00    	je     cd8 <free+0xb8>
+  NEXTFREE(o) = s->free;
+ c53:	89 10                	mov    %edx,(%eax)
+  s->free = o;
+ c55:	89 43 08             	mov    %eax,0x8(%ebx)
+  s->inuse--;
+ c58:	8b 43 0c             	mov    0xc(%ebx),%eax
+ c5b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  classes[shift].nfree++;
+ c5e:	8b 04 f5 24 1a 00 00 	mov    0x1a24(,%esi,8),%eax
+  s->inuse--;
+ c65:	89 53 0c             	mov    %edx,0xc(%ebx)
+  classes[shift].nfree++;
+ c68:	83 c0 01             	add    $0x1,%eax
+ c6b:	89 04 f5 24 1a 00 00 	mov    %eax,0x1a24(,%esi,8)
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ c72:	85 d2                	test   %edx,%edx
+ c74:	75 55                	jne    ccb <free+0xab>
+ c76:	ba e8 0f 00 00       	mov    $0xfe8,%edx
+ c7b:	89 f1                	mov    %esi,%ecx
+ c7d:	d3 ea                	shr    %cl,%edx
+ c7f:	39 c2                	cmp    %eax,%edx
+ c81:	73 7d                	jae    d00 <free+0xe0>
+  if(s->prev)
+ c83:	8b 7b 04             	mov    0x4(%ebx),%edi
+    s->prev->next = s->next;
+ c86:	8b 0b                	mov    (%ebx),%ecx
+  if(s->prev)
+ c88:	85 ff                	test   %edi,%edi
+ c8a:	0f 84 a0 00 00 00    	je     d30 <free+0x110>
+    s->prev->next = s->next;
+ c90:	89 0f                	mov    %ecx,(%edi)
+  if(s->next)
+ c92:	85 c9                	test   %ecx,%ecx
+ c94:	74 06                	je     c9c <free+0x7c>
+    s->next->prev = s->prev;
+ c96:	8b 7b 04             	mov    0x4(%ebx),%edi
+ c99:	89 79 04             	mov    %edi,0x4(%ecx)
+    classes[shift].nfree -= PERPAGE(shift);
+ c9c:	29 d0                	sub    %edx,%eax
+ c9e:	89 04 f5 24 1a 00 00 	mov    %eax,0x1a24(,%esi,8)
+    freepages(s);
+  else
+    sfree(s, ap);
+}
+ ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    freepages(s);
+ ca8:	89 d8                	mov    %ebx,%eax
+}
+ caa:	5b                   	pop    %ebx
+ cab:	5e                   	pop    %esi
+ cac:	5f                   	pop    %edi
+ cad:	5d                   	pop    %ebp
+    freepages(s);
+ cae:	e9 fd fc ff ff       	jmp    9b0 <freepages>
+ cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cb7:	90                   	nop
+    munmap(s, s->npages * PGSIZE);
+ cb8:	8b 43 10             	mov    0x10(%ebx),%eax
+ cbb:	83 ec 08             	sub    $0x8,%esp
+ cbe:	c1 e0 0c             	shl    $0xc,%eax
+ cc1:	50                   	push   %eax
+ cc2:	53                   	push   %ebx
+ cc3:	e8 6b f8 ff ff       	call   533 <munmap>
+ cc8:	83 c4 10             	add    $0x10,%esp
+}
+ ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cce:	5b                   	pop    %ebx
+ ccf:	5e                   	pop    %esi
+ cd0:	5f                   	pop    %edi
+ cd1:	5d                   	pop    %ebp
+ cd2:	c3                   	ret
+ cd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cd7:	90                   	nop
+  s->next = *l;
+ cd8:	8b 14 f5 20 1a 00 00 	mov    0x1a20(,%esi,8),%edx
+  s->prev = 0;
+ cdf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  s->next = *l;
+ ce6:	89 13                	mov    %edx,(%ebx)
+  if(*l)
+ ce8:	85 d2                	test   %edx,%edx
+ cea:	74 06                	je     cf2 <free+0xd2>
+    (*l)->prev = s;
+ cec:	89 5a 04             	mov    %ebx,0x4(%edx)
+  NEXTFREE(o) = s->free;
+ cef:	8b 53 08             	mov    0x8(%ebx),%edx
+  *l = s;
+ cf2:	89 1c f5 20 1a 00 00 	mov    %ebx,0x1a20(,%esi,8)
+}
+ cf9:	e9 55 ff ff ff       	jmp    c53 <free+0x33>
+ cfe:	66 90                	xchg   %ax,%ax
+                       RUNEND(s) == sbrk(0))){
+ d00:	83 ec 0c             	sub    $0xc,%esp
+ d03:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ d06:	8b 7b 10             	mov    0x10(%ebx),%edi
+ d09:	6a 00                	push   $0x0
+ d0b:	c1 e7 0c             	shl    $0xc,%edi
+ d0e:	01 df                	add    %ebx,%edi
+ d10:	e8 46 f7 ff ff       	call   45b <sbrk>
+  if(s->inuse == 0 && (classes[shift].nfree > PERPAGE(shift) ||
+ d15:	83 c4 10             	add    $0x10,%esp
+ d18:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ d1b:	39 c7                	cmp    %eax,%edi
+ d1d:	75 ac                	jne    ccb <free+0xab>
+ d1f:	8b 04 f5 24 1a 00 00 	mov    0x1a24(,%esi,8),%eax
+ d26:	e9 58 ff ff ff       	jmp    c83 <free+0x63>
+ d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+    *l = s->next;
+ d30:	89 0c f5 20 1a 00 00 	mov    %ecx,0x1a20(,%esi,8)
+ d37:	e9 56 ff ff ff       	jmp    c92 <free+0x72>
+ d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d40:	55                   	push   %ebp
+  struct upage *s;
+  uint n;
+  int shift;
+
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ d41:	b9 04 00 00 00       	mov    $0x4,%ecx
+{
+ d46:	89 e5                	mov    %esp,%ebp
+ d48:	57                   	push   %edi
+ d49:	56                   	push   %esi
+ d4a:	53                   	push   %ebx
+ d4b:	83 ec 1c             	sub    $0x1c,%esp
+ d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+    if(nbytes <= (1 << shift))
+ d51:	83 f8 10             	cmp    $0x10,%eax
+ d54:	0f 86 92 00 00 00    	jbe    dec <malloc+0xac>
+ d5a:	ba 01 00 00 00       	mov    $0x1,%edx
+ d5f:	eb 13                	jmp    d74 <malloc+0x34>
+ d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d68:	89 d3                	mov    %edx,%ebx
+ d6a:	d3 e3                	shl    %cl,%ebx
+ d6c:	39 c3                	cmp    %eax,%ebx
+ d6e:	0f 83 84 00 00 00    	jae    df8 <malloc+0xb8>
+  for(shift = MINSHIFT; shift <= MAXSHIFT; shift++)
+ d74:	83 c1 01             	add    $0x1,%ecx
+ d77:	83 f9 0b             	cmp    $0xb,%ecx
+ d7a:	75 ec                	jne    d68 <malloc+0x28>
+      return smalloc(shift);
+
+  if(nbytes > 0x80000000)
+ d7c:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ d81:	0f 87 c9 00 00 00    	ja     e50 <malloc+0x110>
+    return 0;
+  n = PGROUNDUP(nbytes + sizeof(struct upage)) / PGSIZE;
+ d87:	05 17 10 00 00       	add    $0x1017,%eax
+ d8c:	89 c3                	mov    %eax,%ebx
+ d8e:	c1 eb 0c             	shr    $0xc,%ebx
+  s = 0;
+  if(n >= MAPPAGES){
+ d91:	3d ff ff 01 00       	cmp    $0x1ffff,%eax
+ d96:	77 28                	ja     dc0 <malloc+0x80>
+      s->npages = n;
+    }
+  }
+  // The heap, also when the process has no mapping slot left.
+  if(s == 0){
+    if((s = getpages(n)) == 0)
+ d98:	89 d8                	mov    %ebx,%eax
+ d9a:	e8 91 fd ff ff       	call   b30 <getpages>
+ d9f:	85 c0                	test   %eax,%eax
+ da1:	0f 84 a9 00 00 00    	je     e50 <malloc+0x110>
+      return 0;
+    s->shift = HEAPRUN;
+ da7:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+  }
+  return s + 1;
+ dae:	83 c0 18             	add    $0x18,%eax
+}
+ db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ db4:	5b                   	pop    %ebx
+ db5:	5e                   	pop    %esi
+ db6:	5f                   	pop    %edi
+ db7:	5d                   	pop    %ebp
+ db8:	c3                   	ret
+ db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = mmap(0, n * PGSIZE, PROT_READ|PROT_WRITE,
+ dc0:	89 d8                	mov    %ebx,%eax
+ dc2:	83 ec 08             	sub    $0x8,%esp
+ dc5:	c1 e0 0c             	shl    $0xc,%eax
+ dc8:	6a 00                	push   $0x0
+ dca:	6a ff                	push   $0xffffffff
+ dcc:	6a 22                	push   $0x22
+ dce:	6a 03                	push   $0x3
+ dd0:	50                   	push   %eax
+ dd1:	6a 00                	push   $0x0
+ dd3:	e8 53 f7 ff ff       	call   52b <mmap>
+    if(s == MAP_FAILED)
+ dd8:	83 c4 20             	add    $0x20,%esp
+ ddb:	83 f8 ff             	cmp    $0xffffffff,%eax
+ dde:	74 b8                	je     d98 <malloc+0x58>
+      s->shift = MAPRUN;
+ de0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      s->npages = n;
+ de7:	89 58 10             	mov    %ebx,0x10(%eax)
+  if(s == 0){
+ dea:	eb c2                	jmp    dae <malloc+0x6e>
+    if(nbytes <= (1 << shift))
+ dec:	bb 10 00 00 00       	mov    $0x10,%ebx
+ df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(classes[shift].partial == 0){
+ df8:	8b 34 cd 20 1a 00 00 	mov    0x1a20(,%ecx,8),%esi
+ dff:	85 f6                	test   %esi,%esi
+ e01:	74 57                	je     e5a <malloc+0x11a>
+  classes[shift].nfree--;
+ e03:	8b 1c cd 24 1a 00 00 	mov    0x1a24(,%ecx,8),%ebx
+  o = s->free;
+ e0a:	8b 46 08             	mov    0x8(%esi),%eax
+  classes[shift].nfree--;
+ e0d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ e10:	89 14 cd 24 1a 00 00 	mov    %edx,0x1a24(,%ecx,8)
+  s->free = NEXTFREE(o);
+ e17:	8b 38                	mov    (%eax),%edi
+  s->inuse++;
+ e19:	83 46 0c 01          	addl   $0x1,0xc(%esi)
+  s->free = NEXTFREE(o);
+ e1d:	89 7e 08             	mov    %edi,0x8(%esi)
+  if(s->free == 0)
+ e20:	85 ff                	test   %edi,%edi
+ e22:	75 8d                	jne    db1 <malloc+0x71>
+  if(s->prev)
+ e24:	8b 5e 04             	mov    0x4(%esi),%ebx
+    s->prev->next = s->next;
+ e27:	8b 16                	mov    (%esi),%edx
+  if(s->prev)
+ e29:	85 db                	test   %ebx,%ebx
+ e2b:	0f 84 b7 00 00 00    	je     ee8 <malloc+0x1a8>
+    s->prev->next = s->next;
+ e31:	89 13                	mov    %edx,(%ebx)
+  if(s->next)
+ e33:	85 d2                	test   %edx,%edx
+ e35:	0f 84 76 ff ff ff    	je     db1 <malloc+0x71>
+    s->next->prev = s->prev;
+ e3b:	8b 4e 04             	mov    0x4(%esi),%ecx
+ e3e:	89 4a 04             	mov    %ecx,0x4(%edx)
+ e41:	e9 6b ff ff ff       	jmp    db1 <malloc+0x71>
+ e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+ e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 0;
+ e53:	31 c0                	xor    %eax,%eax
+}
+ e55:	5b                   	pop    %ebx
+ e56:	5e                   	pop    %esi
+ e57:	5f                   	pop    %edi
+ e58:	5d                   	pop    %ebp
+ e59:	c3                   	ret
+    if((s = getpages(1)) == 0)
+ e5a:	b8 01 00 00 00       	mov    $0x1,%eax
+ e5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ e62:	e8 c9 fc ff ff       	call   b30 <getpages>
+ e67:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ e6a:	85 c0                	test   %eax,%eax
+ e6c:	89 c2                	mov    %eax,%edx
+ e6e:	74 e0                	je     e50 <malloc+0x110>
+    s->shift = shift;
+ e70:	89 48 14             	mov    %ecx,0x14(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ e73:	f7 db                	neg    %ebx
+    s->inuse = 0;
+ e75:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    n = PERPAGE(shift);
+ e7c:	b8 e8 0f 00 00       	mov    $0xfe8,%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ e81:	89 df                	mov    %ebx,%edi
+ e83:	31 db                	xor    %ebx,%ebx
+    n = PERPAGE(shift);
+ e85:	d3 e8                	shr    %cl,%eax
+    o = (char*)(s + 1) + ((n - 1) << shift);
+ e87:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ e8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ e8d:	83 e8 01             	sub    $0x1,%eax
+ e90:	d3 e0                	shl    %cl,%eax
+ e92:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+ e95:	8d 44 02 18          	lea    0x18(%edx,%eax,1),%eax
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ e99:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ e9c:	eb 04                	jmp    ea2 <malloc+0x162>
+ e9e:	66 90                	xchg   %ax,%ax
+ ea0:	89 c8                	mov    %ecx,%eax
+ ea2:	83 c3 01             	add    $0x1,%ebx
+      NEXTFREE(o) = s->free;
+ ea5:	89 30                	mov    %esi,(%eax)
+    for(i = 0; i < n; i++, o -= 1 << shift){
+ ea7:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+ eaa:	89 c6                	mov    %eax,%esi
+ eac:	39 da                	cmp    %ebx,%edx
+ eae:	7f f0                	jg     ea0 <malloc+0x160>
+ eb0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ eb3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ eb6:	89 42 08             	mov    %eax,0x8(%edx)
+  s->next = *l;
+ eb9:	8b 04 cd 20 1a 00 00 	mov    0x1a20(,%ecx,8),%eax
+  s->prev = 0;
+ ec0:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  s->next = *l;
+ ec7:	89 02                	mov    %eax,(%edx)
+  if(*l)
+ ec9:	85 c0                	test   %eax,%eax
+ ecb:	74 03                	je     ed0 <malloc+0x190>
+    (*l)->prev = s;
+ ecd:	89 50 04             	mov    %edx,0x4(%eax)
+    classes[shift].nfree += n;
+ ed0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  *l = s;
+ ed3:	89 14 cd 20 1a 00 00 	mov    %edx,0x1a20(,%ecx,8)
+    classes[shift].nfree += n;
+ eda:	89 d6                	mov    %edx,%esi
+ edc:	03 1c cd 24 1a 00 00 	add    0x1a24(,%ecx,8),%ebx
+ ee3:	e9 22 ff ff ff       	jmp    e0a <malloc+0xca>
+    *l = s->next;
+ ee8:	89 14 cd 20 1a 00 00 	mov    %edx,0x1a20(,%ecx,8)
+ eef:	e9 3f ff ff ff       	jmp    e33 <malloc+0xf3>